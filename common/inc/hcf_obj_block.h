@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_OBJ_BLOCK_H
+#define HCF_OBJ_BLOCK_H
+
+#include <stdint.h>
+
+/**
+ * @brief One allocation shared by several objects, it is freed when the last of them releases its reference.
+ */
+typedef struct HcfObjBlock HcfObjBlock;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Allocates a block with dataLen zeroed bytes, suitably aligned for any object, owned by refNum references.
+ */
+HcfObjBlock *HcfObjBlockCreate(uint32_t dataLen, uint32_t refNum);
+
+void *HcfObjBlockGetData(HcfObjBlock *block);
+
+/**
+ * @brief Drops refNum references and frees the block when none is left.
+ */
+void HcfObjBlockRelease(HcfObjBlock *block, uint32_t refNum);
+
+/**
+ * @brief Frees obj on its own when block is NULL, otherwise drops the reference obj holds on block.
+ */
+void HcfObjBlockFreeObj(HcfObjBlock *block, void *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_PARALLEL_H
+#define HCF_PARALLEL_H
+
+#include <stdint.h>
+#include "result.h"
+
+#define HCF_PARALLEL_MAX_WORKER_NUM 64
+
+/**
+ * @brief Processes one task, tasks of the same run may be executed concurrently and in any order.
+ */
+typedef HcfResult (*HcfParallelTaskFunc)(void *ctx, uint32_t taskIndex);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Runs taskNum tasks on at most workerNum threads, the calling thread included, and waits for all of them.
+ *
+ * Tasks are handed out in index order. After the first failure no new task is started and that error is returned.
+ * If a worker thread cannot be created the remaining threads take over its share.
+ */
+HcfResult HcfParallelRun(uint32_t taskNum, uint32_t workerNum, HcfParallelTaskFunc func, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
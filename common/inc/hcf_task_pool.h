@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_TASK_POOL_H
+#define HCF_TASK_POOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "result.h"
+
+#define HCF_TASK_POOL_MAX_QUEUE_DEPTH 4096
+
+/**
+ * @brief Task hook, called on a worker thread with the ctx and id the task was submitted with.
+ */
+typedef void (*HcfTaskFunc)(void *ctx, uint64_t taskId);
+
+typedef struct HcfTaskPool HcfTaskPool;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates a pool of workerNum threads serving a queue of at most queueDepth waiting tasks.
+ *
+ * workerNum is at most HCF_PARALLEL_MAX_WORKER_NUM and queueDepth at most HCF_TASK_POOL_MAX_QUEUE_DEPTH.
+ */
+HcfResult HcfTaskPoolCreate(uint32_t workerNum, uint32_t queueDepth, HcfTaskPool **returnPool);
+
+/**
+ * @brief Queues a task and returns its process-wide unique id in taskId, which may be NULL.
+ *
+ * run is called first, then the owner is released and complete is called, so that complete may submit a new task
+ * for the same owner. A non-NULL owner is the object the task works on: while a task of that owner is queued or
+ * running another submit for it fails with HCF_ERR_INVALID_CALL. A full queue fails with HCF_ERR_INVALID_CALL too.
+ */
+HcfResult HcfTaskPoolSubmit(HcfTaskPool *pool, const void *owner, HcfTaskFunc run, HcfTaskFunc complete, void *ctx,
+    uint64_t *taskId);
+
+/**
+ * @brief Removes a task that has not started yet and returns its ctx, neither hook of the task is called.
+ *
+ * Returns HCF_ERR_INVALID_CALL if the task is running, finished or unknown.
+ */
+HcfResult HcfTaskPoolCancel(HcfTaskPool *pool, uint64_t taskId, void **returnCtx);
+
+/**
+ * @brief Checks whether no task is queued or running.
+ */
+bool HcfTaskPoolIsIdle(HcfTaskPool *pool);
+
+/**
+ * @brief Runs the tasks still queued, stops the workers and frees the pool. Must not be called from a task.
+ */
+void HcfTaskPoolDestroy(HcfTaskPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
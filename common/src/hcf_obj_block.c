@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hcf_obj_block.h"
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "log.h"
+#include "memory.h"
+
+struct HcfObjBlock {
+    pthread_mutex_t lock;
+
+    uint32_t refNum;
+};
+
+#define HCF_OBJ_BLOCK_ALIGN 16
+#define HCF_OBJ_BLOCK_HEADER_LEN \
+    ((sizeof(HcfObjBlock) + HCF_OBJ_BLOCK_ALIGN - 1) / HCF_OBJ_BLOCK_ALIGN * HCF_OBJ_BLOCK_ALIGN)
+
+HcfObjBlock *HcfObjBlockCreate(uint32_t dataLen, uint32_t refNum)
+{
+    if ((dataLen == 0) || (refNum == 0) || (dataLen > UINT32_MAX - HCF_OBJ_BLOCK_HEADER_LEN)) {
+        LOGE("Invalid input parameter.");
+        return NULL;
+    }
+    HcfObjBlock *block = (HcfObjBlock *)HcfMalloc((uint32_t)HCF_OBJ_BLOCK_HEADER_LEN + dataLen, 0);
+    if (block == NULL) {
+        LOGE("Failed to allocate block memory!");
+        return NULL;
+    }
+    if (pthread_mutex_init(&block->lock, NULL) != 0) {
+        LOGE("Failed to init block lock.");
+        HcfFree(block);
+        return NULL;
+    }
+    block->refNum = refNum;
+    return block;
+}
+
+void *HcfObjBlockGetData(HcfObjBlock *block)
+{
+    if (block == NULL) {
+        return NULL;
+    }
+    return (uint8_t *)block + HCF_OBJ_BLOCK_HEADER_LEN;
+}
+
+void HcfObjBlockRelease(HcfObjBlock *block, uint32_t refNum)
+{
+    if (block == NULL) {
+        return;
+    }
+    (void)pthread_mutex_lock(&block->lock);
+    if (refNum > block->refNum) {
+        LOGE("Block released more often than referenced.");
+        refNum = block->refNum;
+    }
+    block->refNum -= refNum;
+    uint32_t remainNum = block->refNum;
+    (void)pthread_mutex_unlock(&block->lock);
+    if (remainNum != 0) {
+        return;
+    }
+    (void)pthread_mutex_destroy(&block->lock);
+    HcfFree(block);
+}
+
+void HcfObjBlockFreeObj(HcfObjBlock *block, void *obj)
+{
+    if (block == NULL) {
+        HcfFree(obj);
+        return;
+    }
+    HcfObjBlockRelease(block, 1);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hcf_parallel.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#include "log.h"
+#include "memory.h"
+
+typedef struct {
+    pthread_mutex_t lock;
+
+    HcfParallelTaskFunc func;
+
+    void *ctx;
+
+    uint32_t taskNum;
+
+    uint32_t nextTask;
+
+    HcfResult result;
+} HcfParallelJob;
+
+static bool FetchTask(HcfParallelJob *job, uint32_t *taskIndex)
+{
+    bool fetched = false;
+    (void)pthread_mutex_lock(&job->lock);
+    if ((job->result == HCF_SUCCESS) && (job->nextTask < job->taskNum)) {
+        *taskIndex = job->nextTask;
+        job->nextTask++;
+        fetched = true;
+    }
+    (void)pthread_mutex_unlock(&job->lock);
+    return fetched;
+}
+
+static void *ParallelWorker(void *arg)
+{
+    HcfParallelJob *job = (HcfParallelJob *)arg;
+    uint32_t taskIndex = 0;
+    while (FetchTask(job, &taskIndex)) {
+        HcfResult ret = job->func(job->ctx, taskIndex);
+        if (ret == HCF_SUCCESS) {
+            continue;
+        }
+        (void)pthread_mutex_lock(&job->lock);
+        if (job->result == HCF_SUCCESS) {
+            job->result = ret;
+        }
+        (void)pthread_mutex_unlock(&job->lock);
+    }
+    return NULL;
+}
+
+HcfResult HcfParallelRun(uint32_t taskNum, uint32_t workerNum, HcfParallelTaskFunc func, void *ctx)
+{
+    if ((func == NULL) || (workerNum == 0) || (workerNum > HCF_PARALLEL_MAX_WORKER_NUM)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (taskNum == 0) {
+        return HCF_SUCCESS;
+    }
+    HcfParallelJob job = { .func = func, .ctx = ctx, .taskNum = taskNum, .nextTask = 0, .result = HCF_SUCCESS };
+    if (pthread_mutex_init(&job.lock, NULL) != 0) {
+        LOGE("Failed to init parallel job lock.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    uint32_t threadNum = (workerNum < taskNum) ? workerNum - 1 : taskNum - 1;
+    pthread_t *threads = NULL;
+    if (threadNum > 0) {
+        threads = (pthread_t *)HcfMalloc(sizeof(pthread_t) * threadNum, 0);
+        if (threads == NULL) {
+            LOGE("Failed to allocate worker threads, run on the calling thread.");
+            threadNum = 0;
+        }
+    }
+    uint32_t started = 0;
+    for (; started < threadNum; started++) {
+        if (pthread_create(&threads[started], NULL, ParallelWorker, &job) != 0) {
+            LOGE("Failed to create worker thread, started %{public}u.", started);
+            break;
+        }
+    }
+    (void)ParallelWorker(&job);
+    for (uint32_t i = 0; i < started; i++) {
+        (void)pthread_join(threads[i], NULL);
+    }
+    HcfFree(threads);
+    (void)pthread_mutex_destroy(&job.lock);
+    return job.result;
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hcf_task_pool.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "hcf_parallel.h"
+#include "log.h"
+#include "memory.h"
+
+typedef struct HcfTaskNode {
+    struct HcfTaskNode *next;
+
+    uint64_t taskId;
+
+    const void *owner;
+
+    HcfTaskFunc run;
+
+    HcfTaskFunc complete;
+
+    void *ctx;
+} HcfTaskNode;
+
+typedef struct {
+    HcfTaskPool *pool;
+
+    pthread_t thread;
+
+    /* Owner of the task this worker runs, NULL once run has returned. */
+    const void *owner;
+} HcfTaskWorker;
+
+struct HcfTaskPool {
+    pthread_mutex_t lock;
+
+    pthread_cond_t notEmpty;
+
+    HcfTaskNode *head;
+
+    HcfTaskNode *tail;
+
+    uint32_t queuedNum;
+
+    uint32_t queueDepth;
+
+    uint32_t runningNum;
+
+    HcfTaskWorker *workers;
+
+    uint32_t workerNum;
+
+    bool stopping;
+};
+
+static atomic_uint_fast64_t g_taskIdSeq = 0;
+
+static HcfTaskNode *PopTask(HcfTaskPool *pool)
+{
+    HcfTaskNode *node = pool->head;
+    pool->head = node->next;
+    if (pool->head == NULL) {
+        pool->tail = NULL;
+    }
+    pool->queuedNum--;
+    return node;
+}
+
+static void *TaskWorker(void *arg)
+{
+    HcfTaskWorker *worker = (HcfTaskWorker *)arg;
+    HcfTaskPool *pool = worker->pool;
+    (void)pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while ((pool->head == NULL) && !pool->stopping) {
+            (void)pthread_cond_wait(&pool->notEmpty, &pool->lock);
+        }
+        if (pool->head == NULL) {
+            break;
+        }
+        HcfTaskNode *node = PopTask(pool);
+        worker->owner = node->owner;
+        pool->runningNum++;
+        (void)pthread_mutex_unlock(&pool->lock);
+
+        node->run(node->ctx, node->taskId);
+        (void)pthread_mutex_lock(&pool->lock);
+        worker->owner = NULL;
+        (void)pthread_mutex_unlock(&pool->lock);
+        node->complete(node->ctx, node->taskId);
+        HcfFree(node);
+
+        (void)pthread_mutex_lock(&pool->lock);
+        pool->runningNum--;
+    }
+    (void)pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+static bool IsOwnerBusy(const HcfTaskPool *pool, const void *owner)
+{
+    for (const HcfTaskNode *node = pool->head; node != NULL; node = node->next) {
+        if (node->owner == owner) {
+            return true;
+        }
+    }
+    for (uint32_t i = 0; i < pool->workerNum; i++) {
+        if (pool->workers[i].owner == owner) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void StopWorkers(HcfTaskPool *pool)
+{
+    (void)pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    (void)pthread_cond_broadcast(&pool->notEmpty);
+    (void)pthread_mutex_unlock(&pool->lock);
+    for (uint32_t i = 0; i < pool->workerNum; i++) {
+        (void)pthread_join(pool->workers[i].thread, NULL);
+    }
+}
+
+static void FreeTaskPool(HcfTaskPool *pool)
+{
+    (void)pthread_cond_destroy(&pool->notEmpty);
+    (void)pthread_mutex_destroy(&pool->lock);
+    HcfFree(pool->workers);
+    HcfFree(pool);
+}
+
+static HcfResult InitTaskPool(HcfTaskPool *pool, uint32_t workerNum, uint32_t queueDepth)
+{
+    pool->workers = (HcfTaskWorker *)HcfMalloc(sizeof(HcfTaskWorker) * workerNum, 0);
+    if (pool->workers == NULL) {
+        LOGE("Failed to allocate task workers.");
+        return HCF_ERR_MALLOC;
+    }
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        LOGE("Failed to init task pool lock.");
+        HcfFree(pool->workers);
+        pool->workers = NULL;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (pthread_cond_init(&pool->notEmpty, NULL) != 0) {
+        LOGE("Failed to init task pool cond.");
+        (void)pthread_mutex_destroy(&pool->lock);
+        HcfFree(pool->workers);
+        pool->workers = NULL;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    pool->queueDepth = queueDepth;
+    return HCF_SUCCESS;
+}
+
+HcfResult HcfTaskPoolCreate(uint32_t workerNum, uint32_t queueDepth, HcfTaskPool **returnPool)
+{
+    if ((workerNum == 0) || (workerNum > HCF_PARALLEL_MAX_WORKER_NUM) || (queueDepth == 0) ||
+        (queueDepth > HCF_TASK_POOL_MAX_QUEUE_DEPTH) || (returnPool == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfTaskPool *pool = (HcfTaskPool *)HcfMalloc(sizeof(HcfTaskPool), 0);
+    if (pool == NULL) {
+        LOGE("Failed to allocate task pool.");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = InitTaskPool(pool, workerNum, queueDepth);
+    if (ret != HCF_SUCCESS) {
+        HcfFree(pool);
+        return ret;
+    }
+    for (; pool->workerNum < workerNum; pool->workerNum++) {
+        HcfTaskWorker *worker = &pool->workers[pool->workerNum];
+        worker->pool = pool;
+        if (pthread_create(&worker->thread, NULL, TaskWorker, worker) != 0) {
+            LOGE("Failed to create task worker, started %{public}u.", pool->workerNum);
+            break;
+        }
+    }
+    if (pool->workerNum == 0) {
+        FreeTaskPool(pool);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnPool = pool;
+    return HCF_SUCCESS;
+}
+
+HcfResult HcfTaskPoolSubmit(HcfTaskPool *pool, const void *owner, HcfTaskFunc run, HcfTaskFunc complete, void *ctx,
+    uint64_t *taskId)
+{
+    if ((pool == NULL) || (run == NULL) || (complete == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfTaskNode *node = (HcfTaskNode *)HcfMalloc(sizeof(HcfTaskNode), 0);
+    if (node == NULL) {
+        LOGE("Failed to allocate task.");
+        return HCF_ERR_MALLOC;
+    }
+    node->owner = owner;
+    node->run = run;
+    node->complete = complete;
+    node->ctx = ctx;
+    node->taskId = atomic_fetch_add(&g_taskIdSeq, 1) + 1;
+
+    (void)pthread_mutex_lock(&pool->lock);
+    if (pool->stopping || (pool->queuedNum >= pool->queueDepth)) {
+        (void)pthread_mutex_unlock(&pool->lock);
+        LOGE("Task queue is full.");
+        HcfFree(node);
+        return HCF_ERR_INVALID_CALL;
+    }
+    if ((owner != NULL) && IsOwnerBusy(pool, owner)) {
+        (void)pthread_mutex_unlock(&pool->lock);
+        LOGE("The object is in use by another task.");
+        HcfFree(node);
+        return HCF_ERR_INVALID_CALL;
+    }
+    if (pool->tail == NULL) {
+        pool->head = node;
+    } else {
+        pool->tail->next = node;
+    }
+    pool->tail = node;
+    pool->queuedNum++;
+    if (taskId != NULL) {
+        *taskId = node->taskId;
+    }
+    (void)pthread_cond_signal(&pool->notEmpty);
+    (void)pthread_mutex_unlock(&pool->lock);
+    return HCF_SUCCESS;
+}
+
+HcfResult HcfTaskPoolCancel(HcfTaskPool *pool, uint64_t taskId, void **returnCtx)
+{
+    if ((pool == NULL) || (returnCtx == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfTaskNode *prev = NULL;
+    (void)pthread_mutex_lock(&pool->lock);
+    HcfTaskNode *node = pool->head;
+    while ((node != NULL) && (node->taskId != taskId)) {
+        prev = node;
+        node = node->next;
+    }
+    if (node == NULL) {
+        (void)pthread_mutex_unlock(&pool->lock);
+        LOGD("Task is not waiting in the queue.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    if (prev == NULL) {
+        pool->head = node->next;
+    } else {
+        prev->next = node->next;
+    }
+    if (pool->tail == node) {
+        pool->tail = prev;
+    }
+    pool->queuedNum--;
+    (void)pthread_mutex_unlock(&pool->lock);
+    *returnCtx = node->ctx;
+    HcfFree(node);
+    return HCF_SUCCESS;
+}
+
+bool HcfTaskPoolIsIdle(HcfTaskPool *pool)
+{
+    if (pool == NULL) {
+        return true;
+    }
+    (void)pthread_mutex_lock(&pool->lock);
+    bool idle = (pool->queuedNum == 0) && (pool->runningNum == 0);
+    (void)pthread_mutex_unlock(&pool->lock);
+    return idle;
+}
+
+void HcfTaskPoolDestroy(HcfTaskPool *pool)
+{
+    if (pool == NULL) {
+        return;
+    }
+    StopWorkers(pool);
+    FreeTaskPool(pool);
+}
@@ -54,6 +54,8 @@ enum HcfJsApiId {
     API_CREATE_ASY_KEY_GENERATOR,
     API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIR,
     API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIR_SYNC,
+    API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS,
+    API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS_SYNC,
     API_ASY_KEY_GENERATOR_CONVERT_KEY,
     API_ASY_KEY_GENERATOR_CONVERT_KEY_SYNC,
     API_ASY_KEY_GENERATOR_CONVERT_PEM_KEY,
@@ -90,6 +92,9 @@ enum HcfJsApiId {
     API_CIPHER_DO_FINAL_SYNC,
     API_CIPHER_SET_CIPHER_SPEC,
     API_CIPHER_GET_CIPHER_SPEC,
+    API_CREATE_CIPHER_STREAM,
+    API_CIPHER_STREAM_WRITE,
+    API_CIPHER_STREAM_END,
     /* Sign */
     API_CREATE_SIGN,
     API_SIGN_INIT,
@@ -100,6 +105,9 @@ enum HcfJsApiId {
     API_SIGN_SIGN_SYNC,
     API_SIGN_SET_SIGN_SPEC,
     API_SIGN_GET_SIGN_SPEC,
+    API_SIGN_RESET,
+    API_SIGN_SIGN_BATCH,
+    API_SIGN_SIGN_BATCH_SYNC,
     /* Verify */
     API_CREATE_VERIFY,
     API_VERIFY_INIT,
@@ -112,6 +120,7 @@ enum HcfJsApiId {
     API_VERIFY_RECOVER_SYNC,
     API_VERIFY_SET_VERIFY_SPEC,
     API_VERIFY_GET_VERIFY_SPEC,
+    API_VERIFY_RESET,
     /* KeyAgreement */
     API_CREATE_KEY_AGREEMENT,
     API_KEY_AGREEMENT_GENERATE_SECRET,
@@ -146,6 +155,21 @@ enum HcfJsApiId {
     API_KEM_ENCAPSULATE_SYNC,
     API_KEM_DECAPSULATE,
     API_KEM_DECAPSULATE_SYNC,
+    API_KEM_ENCAPSULATE_BATCH,
+    API_KEM_ENCAPSULATE_BATCH_SYNC,
+    API_KEM_DECAPSULATE_BATCH,
+    API_KEM_DECAPSULATE_BATCH_SYNC,
+    API_CREATE_ENVELOPE,
+    API_ENVELOPE_SEAL,
+    API_ENVELOPE_SEAL_SYNC,
+    API_ENVELOPE_OPEN,
+    API_ENVELOPE_OPEN_SYNC,
+    API_MD_UPDATE_FD,
+    API_MD_UPDATE_FD_SYNC,
+    API_MAC_UPDATE_FD,
+    API_MAC_UPDATE_FD_SYNC,
+    API_CIPHER_UPDATE_FD,
+    API_CIPHER_UPDATE_FD_SYNC,
 };
 
 class HistogramScopeGuard {
@@ -58,6 +58,8 @@ static const std::unordered_map<HcfJsApiId, std::string> API_NAMES = {
     { API_CREATE_ASY_KEY_GENERATOR, HCF "createAsyKeyGenerator" },
     { API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIR, HCF "AsyKeyGenerator.generateKeyPair" },
     { API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIR_SYNC, HCF "AsyKeyGenerator.generateKeyPairSync" },
+    { API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS, HCF "AsyKeyGenerator.generateKeyPairs" },
+    { API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS_SYNC, HCF "AsyKeyGenerator.generateKeyPairsSync" },
     { API_ASY_KEY_GENERATOR_CONVERT_KEY, HCF "AsyKeyGenerator.convertKey" },
     { API_ASY_KEY_GENERATOR_CONVERT_KEY_SYNC, HCF "AsyKeyGenerator.convertKeySync" },
     { API_ASY_KEY_GENERATOR_CONVERT_PEM_KEY, HCF "AsyKeyGenerator.convertPemKey" },
@@ -94,6 +96,9 @@ static const std::unordered_map<HcfJsApiId, std::string> API_NAMES = {
     { API_CIPHER_DO_FINAL_SYNC, HCF "Cipher.doFinalSync" },
     { API_CIPHER_SET_CIPHER_SPEC, HCF "Cipher.setCipherSpec" },
     { API_CIPHER_GET_CIPHER_SPEC, HCF "Cipher.getCipherSpec" },
+    { API_CREATE_CIPHER_STREAM, HCF "createCipherStream" },
+    { API_CIPHER_STREAM_WRITE, HCF "CipherStream.write" },
+    { API_CIPHER_STREAM_END, HCF "CipherStream.end" },
     /* Sign */
     { API_CREATE_SIGN, HCF "createSign" },
     { API_SIGN_INIT, HCF "Sign.init" },
@@ -104,6 +109,9 @@ static const std::unordered_map<HcfJsApiId, std::string> API_NAMES = {
     { API_SIGN_SIGN_SYNC, HCF "Sign.signSync" },
     { API_SIGN_SET_SIGN_SPEC, HCF "Sign.setSignSpec" },
     { API_SIGN_GET_SIGN_SPEC, HCF "Sign.getSignSpec" },
+    { API_SIGN_RESET, HCF "Sign.reset" },
+    { API_SIGN_SIGN_BATCH, HCF "Sign.signBatch" },
+    { API_SIGN_SIGN_BATCH_SYNC, HCF "Sign.signBatchSync" },
     /* Verify */
     { API_CREATE_VERIFY, HCF "createVerify" },
     { API_VERIFY_INIT, HCF "Verify.init" },
@@ -116,6 +124,7 @@ static const std::unordered_map<HcfJsApiId, std::string> API_NAMES = {
     { API_VERIFY_RECOVER_SYNC, HCF "Verify.recoverSync" },
     { API_VERIFY_SET_VERIFY_SPEC, HCF "Verify.setVerifySpec" },
     { API_VERIFY_GET_VERIFY_SPEC, HCF "Verify.getVerifySpec" },
+    { API_VERIFY_RESET, HCF "Verify.reset" },
     /* KeyAgreement */
     { API_CREATE_KEY_AGREEMENT, HCF "createKeyAgreement" },
     { API_KEY_AGREEMENT_GENERATE_SECRET, HCF "KeyAgreement.generateSecret" },
@@ -150,6 +159,22 @@ static const std::unordered_map<HcfJsApiId, std::string> API_NAMES = {
     { API_KEM_ENCAPSULATE_SYNC, HCF "Kem.encapsulateSync" },
     { API_KEM_DECAPSULATE, HCF "Kem.decapsulate" },
     { API_KEM_DECAPSULATE_SYNC, HCF "Kem.decapsulateSync" },
+    { API_KEM_ENCAPSULATE_BATCH, HCF "Kem.encapsulateBatch" },
+    { API_KEM_ENCAPSULATE_BATCH_SYNC, HCF "Kem.encapsulateBatchSync" },
+    { API_KEM_DECAPSULATE_BATCH, HCF "Kem.decapsulateBatch" },
+    { API_KEM_DECAPSULATE_BATCH_SYNC, HCF "Kem.decapsulateBatchSync" },
+    /* Envelope */
+    { API_CREATE_ENVELOPE, HCF "createEnvelope" },
+    { API_ENVELOPE_SEAL, HCF "Envelope.seal" },
+    { API_ENVELOPE_SEAL_SYNC, HCF "Envelope.sealSync" },
+    { API_ENVELOPE_OPEN, HCF "Envelope.open" },
+    { API_ENVELOPE_OPEN_SYNC, HCF "Envelope.openSync" },
+    { API_MD_UPDATE_FD, HCF "Md.updateFd" },
+    { API_MD_UPDATE_FD_SYNC, HCF "Md.updateFdSync" },
+    { API_MAC_UPDATE_FD, HCF "Mac.updateFd" },
+    { API_MAC_UPDATE_FD_SYNC, HCF "Mac.updateFdSync" },
+    { API_CIPHER_UPDATE_FD, HCF "Cipher.updateFd" },
+    { API_CIPHER_UPDATE_FD_SYNC, HCF "Cipher.updateFdSync" },
 };
 
 static const std::unordered_map<HcfResult, int32_t> ERROR_CODES = {
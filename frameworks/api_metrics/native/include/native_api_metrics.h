@@ -61,9 +61,20 @@ typedef enum {
     API_CRYPTO_SYM_CIPHER_FINAL,
     API_CRYPTO_SYM_CIPHER_GET_ALGO_NAME,
     API_CRYPTO_SYM_CIPHER_DESTROY,
+    API_CRYPTO_SYM_CIPHER_SET_PARALLEL_WORKER_NUM,
+    API_CRYPTO_SYM_CIPHER_PROCESS_DATA_UNITS,
+    API_CRYPTO_SYM_CIPHER_SET_AEAD_NONCE_MODE,
+    API_CRYPTO_SYM_CIPHER_SET_AEAD_NONCE_FIXED_FIELD,
+    API_CRYPTO_SYM_CIPHER_STREAM_CREATE,
+    API_CRYPTO_SYM_CIPHER_STREAM_WRITE,
+    API_CRYPTO_SYM_CIPHER_STREAM_TRY_WRITE,
+    API_CRYPTO_SYM_CIPHER_STREAM_FINISH,
+    API_CRYPTO_SYM_CIPHER_STREAM_WAIT,
+    API_CRYPTO_SYM_CIPHER_STREAM_DESTROY,
     /* crypto_asym_key */
     API_CRYPTO_ASYM_KEY_GENERATOR_CREATE,
     API_CRYPTO_ASYM_KEY_GENERATOR_GENERATE,
+    API_CRYPTO_ASYM_KEY_GENERATOR_GENERATE_KEY_PAIRS,
     API_CRYPTO_ASYM_KEY_GENERATOR_CONVERT,
     API_CRYPTO_ASYM_KEY_GENERATOR_GET_ALGO_NAME,
     API_CRYPTO_ASYM_KEY_GENERATOR_DESTROY,
@@ -102,6 +113,7 @@ typedef enum {
     API_CRYPTO_VERIFY_GET_ALGO_NAME,
     API_CRYPTO_VERIFY_SET_PARAM,
     API_CRYPTO_VERIFY_GET_PARAM,
+    API_CRYPTO_VERIFY_RESET,
     API_CRYPTO_VERIFY_DESTROY,
     API_CRYPTO_SIGN_CREATE,
     API_CRYPTO_SIGN_INIT,
@@ -110,6 +122,8 @@ typedef enum {
     API_CRYPTO_SIGN_GET_ALGO_NAME,
     API_CRYPTO_SIGN_SET_PARAM,
     API_CRYPTO_SIGN_GET_PARAM,
+    API_CRYPTO_SIGN_RESET,
+    API_CRYPTO_SIGN_SIGN_BATCH,
     API_CRYPTO_SIGN_DESTROY,
     API_CRYPTO_ECC_SIGNATURE_SPEC_CREATE,
     API_CRYPTO_ECC_SIGNATURE_SPEC_GET_R_AND_S,
@@ -138,12 +152,25 @@ typedef enum {
     API_CRYPTO_ASYM_CIPHER_CREATE,
     API_CRYPTO_ASYM_CIPHER_INIT,
     API_CRYPTO_ASYM_CIPHER_FINAL,
+    API_CRYPTO_ASYM_CIPHER_FINAL_BATCH,
     API_CRYPTO_ASYM_CIPHER_DESTROY,
     API_CRYPTO_SM2_CIPHERTEXT_SPEC_CREATE,
     API_CRYPTO_SM2_CIPHERTEXT_SPEC_GET_ITEM,
     API_CRYPTO_SM2_CIPHERTEXT_SPEC_SET_ITEM,
     API_CRYPTO_SM2_CIPHERTEXT_SPEC_ENCODE,
     API_CRYPTO_SM2_CIPHERTEXT_SPEC_DESTROY,
+    /* crypto_envelope */
+    API_CRYPTO_ENVELOPE_CREATE,
+    API_CRYPTO_ENVELOPE_SEAL,
+    API_CRYPTO_ENVELOPE_OPEN,
+    API_CRYPTO_ENVELOPE_DESTROY,
+    API_CRYPTO_ASYNC_SET_POOL_CONFIG,
+    API_CRYPTO_ASYNC_SUBMIT,
+    API_CRYPTO_ASYNC_CANCEL,
+    API_CRYPTO_KEY_AGREEMENT_DERIVE_KEY,
+    API_CRYPTO_DIGEST_UPDATE_FD,
+    API_CRYPTO_MAC_UPDATE_FD,
+    API_CRYPTO_SYM_CIPHER_UPDATE_FD,
 } HcfNativeApiId;
 
 const char *GetApiName(HcfNativeApiId id);
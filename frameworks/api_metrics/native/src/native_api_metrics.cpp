@@ -61,9 +61,20 @@ static const std::unordered_map<HcfNativeApiId, const char *> API_NAMES = {
     { API_CRYPTO_SYM_CIPHER_FINAL, HCF "SymCipher_Final" },
     { API_CRYPTO_SYM_CIPHER_GET_ALGO_NAME, HCF "SymCipher_GetAlgoName" },
     { API_CRYPTO_SYM_CIPHER_DESTROY, HCF "SymCipher_Destroy" },
+    { API_CRYPTO_SYM_CIPHER_SET_PARALLEL_WORKER_NUM, HCF "SymCipher_SetParallelWorkerNum" },
+    { API_CRYPTO_SYM_CIPHER_PROCESS_DATA_UNITS, HCF "SymCipher_ProcessDataUnits" },
+    { API_CRYPTO_SYM_CIPHER_SET_AEAD_NONCE_MODE, HCF "SymCipher_SetAeadNonceMode" },
+    { API_CRYPTO_SYM_CIPHER_SET_AEAD_NONCE_FIXED_FIELD, HCF "SymCipher_SetAeadNonceFixedField" },
+    { API_CRYPTO_SYM_CIPHER_STREAM_CREATE, HCF "SymCipherStream_Create" },
+    { API_CRYPTO_SYM_CIPHER_STREAM_WRITE, HCF "SymCipherStream_Write" },
+    { API_CRYPTO_SYM_CIPHER_STREAM_TRY_WRITE, HCF "SymCipherStream_TryWrite" },
+    { API_CRYPTO_SYM_CIPHER_STREAM_FINISH, HCF "SymCipherStream_Finish" },
+    { API_CRYPTO_SYM_CIPHER_STREAM_WAIT, HCF "SymCipherStream_Wait" },
+    { API_CRYPTO_SYM_CIPHER_STREAM_DESTROY, HCF "SymCipherStream_Destroy" },
     /* crypto_asym_key */
     { API_CRYPTO_ASYM_KEY_GENERATOR_CREATE, HCF "AsymKeyGenerator_Create" },
     { API_CRYPTO_ASYM_KEY_GENERATOR_GENERATE, HCF "AsymKeyGenerator_Generate" },
+    { API_CRYPTO_ASYM_KEY_GENERATOR_GENERATE_KEY_PAIRS, HCF "AsymKeyGenerator_GenerateKeyPairs" },
     { API_CRYPTO_ASYM_KEY_GENERATOR_CONVERT, HCF "AsymKeyGenerator_Convert" },
     { API_CRYPTO_ASYM_KEY_GENERATOR_GET_ALGO_NAME, HCF "AsymKeyGenerator_GetAlgoName" },
     { API_CRYPTO_ASYM_KEY_GENERATOR_DESTROY, HCF "AsymKeyGenerator_Destroy" },
@@ -102,6 +113,7 @@ static const std::unordered_map<HcfNativeApiId, const char *> API_NAMES = {
     { API_CRYPTO_VERIFY_GET_ALGO_NAME, HCF "Verify_GetAlgoName" },
     { API_CRYPTO_VERIFY_SET_PARAM, HCF "Verify_SetParam" },
     { API_CRYPTO_VERIFY_GET_PARAM, HCF "Verify_GetParam" },
+    { API_CRYPTO_VERIFY_RESET, HCF "Verify_Reset" },
     { API_CRYPTO_VERIFY_DESTROY, HCF "Verify_Destroy" },
     { API_CRYPTO_SIGN_CREATE, HCF "Sign_Create" },
     { API_CRYPTO_SIGN_INIT, HCF "Sign_Init" },
@@ -110,6 +122,8 @@ static const std::unordered_map<HcfNativeApiId, const char *> API_NAMES = {
     { API_CRYPTO_SIGN_GET_ALGO_NAME, HCF "Sign_GetAlgoName" },
     { API_CRYPTO_SIGN_SET_PARAM, HCF "Sign_SetParam" },
     { API_CRYPTO_SIGN_GET_PARAM, HCF "Sign_GetParam" },
+    { API_CRYPTO_SIGN_RESET, HCF "Sign_Reset" },
+    { API_CRYPTO_SIGN_SIGN_BATCH, HCF "Sign_SignBatch" },
     { API_CRYPTO_SIGN_DESTROY, HCF "Sign_Destroy" },
     { API_CRYPTO_ECC_SIGNATURE_SPEC_CREATE, HCF "EccSignatureSpec_Create" },
     { API_CRYPTO_ECC_SIGNATURE_SPEC_GET_R_AND_S, HCF "EccSignatureSpec_GetRAndS" },
@@ -138,12 +152,25 @@ static const std::unordered_map<HcfNativeApiId, const char *> API_NAMES = {
     { API_CRYPTO_ASYM_CIPHER_CREATE, HCF "AsymCipher_Create" },
     { API_CRYPTO_ASYM_CIPHER_INIT, HCF "AsymCipher_Init" },
     { API_CRYPTO_ASYM_CIPHER_FINAL, HCF "AsymCipher_Final" },
+    { API_CRYPTO_ASYM_CIPHER_FINAL_BATCH, HCF "AsymCipher_FinalBatch" },
     { API_CRYPTO_ASYM_CIPHER_DESTROY, HCF "AsymCipher_Destroy" },
     { API_CRYPTO_SM2_CIPHERTEXT_SPEC_CREATE, HCF "Sm2CiphertextSpec_Create" },
     { API_CRYPTO_SM2_CIPHERTEXT_SPEC_GET_ITEM, HCF "Sm2CiphertextSpec_GetItem" },
     { API_CRYPTO_SM2_CIPHERTEXT_SPEC_SET_ITEM, HCF "Sm2CiphertextSpec_SetItem" },
     { API_CRYPTO_SM2_CIPHERTEXT_SPEC_ENCODE, HCF "Sm2CiphertextSpec_Encode" },
     { API_CRYPTO_SM2_CIPHERTEXT_SPEC_DESTROY, HCF "Sm2CiphertextSpec_Destroy" },
+    /* crypto_envelope */
+    { API_CRYPTO_ENVELOPE_CREATE, HCF "Envelope_Create" },
+    { API_CRYPTO_ENVELOPE_SEAL, HCF "Envelope_Seal" },
+    { API_CRYPTO_ENVELOPE_OPEN, HCF "Envelope_Open" },
+    { API_CRYPTO_ENVELOPE_DESTROY, HCF "Envelope_Destroy" },
+    { API_CRYPTO_ASYNC_SET_POOL_CONFIG, HCF "Async_SetPoolConfig" },
+    { API_CRYPTO_ASYNC_SUBMIT, HCF "Async_Submit" },
+    { API_CRYPTO_ASYNC_CANCEL, HCF "Async_Cancel" },
+    { API_CRYPTO_KEY_AGREEMENT_DERIVE_KEY, HCF "KeyAgreement_DeriveKey" },
+    { API_CRYPTO_DIGEST_UPDATE_FD, HCF "Digest_UpdateFd" },
+    { API_CRYPTO_MAC_UPDATE_FD, HCF "Mac_UpdateFd" },
+    { API_CRYPTO_SYM_CIPHER_UPDATE_FD, HCF "SymCipher_UpdateFd" },
 };
 
 static const std::unordered_map<OH_Crypto_ErrCode, int32_t> ERROR_CODES = {
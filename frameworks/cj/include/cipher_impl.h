@@ -16,6 +16,7 @@
 #define CIPHER_IMPL_H
 
 #include "ffi_remote_data.h"
+#include "crypto_handle_table.h"
 #include "algorithm_parameter.h"
 #include "key.h"
 #include "cipher.h"
@@ -35,9 +36,11 @@ public:
     HcfResult GetCipherSpecString(CipherSpecItem item, char **returnString);
     HcfResult GetCipherSpecUint8Array(CipherSpecItem item, HcfBlob *returnUint8Array);
     const char *GetAlgorithm(int32_t* errCode);
+    uint64_t GetHandle() const;
 
 private:
     HcfCipher *cipher_;
+    uint64_t handle_ = 0;
 };
 }
 }
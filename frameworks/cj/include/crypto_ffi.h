@@ -18,6 +18,7 @@
 #include "asy_key_generator_impl.h"
 #include "asy_key_spec_generator_impl.h"
 #include "cipher_impl.h"
+#include "crypto_stream_ffi.h"
 #include "dh_key_util_impl.h"
 #include "detailed_iv_params.h"
 #include "detailed_gcm_params.h"
@@ -62,6 +63,7 @@ extern "C" {
     FFI_EXPORT int32_t FfiOHOSMdUpdate(int64_t id, HcfBlob *input);
     FFI_EXPORT HcfBlob FfiOHOSDigest(int64_t id, int32_t* errCode);
     FFI_EXPORT uint32_t FfiOHOSGetMdLength(int64_t id, int32_t* errCode);
+    FFI_EXPORT uint64_t FfiOHOSMdGetHandle(int64_t id, int32_t* errCode);
 
     // symkeygenerator
     FFI_EXPORT int64_t FfiOHOSCreateSymKeyGenerator(char* algName, int32_t* errCode);
@@ -88,6 +90,7 @@ extern "C" {
     FFI_EXPORT char *FfiOHOSGetCipherSpecString(int64_t id, int32_t item, int32_t *errCode);
     FFI_EXPORT int32_t FfiOHOSGetCipherSpecUint8Array(int64_t id, int32_t item, HcfBlob *returnUint8Array);
     FFI_EXPORT const char *FfiOHOSCipherGetAlgName(int64_t id, int32_t* errCode);
+    FFI_EXPORT uint64_t FfiOHOSCipherGetHandle(int64_t id, int32_t* errCode);
 
     // mac
     FFI_EXPORT int64_t FFiOHOSCryptoMacConstructor(char* algName, int32_t* errCode);
@@ -95,6 +98,7 @@ extern "C" {
     FFI_EXPORT int32_t FfiOHOSCryptoMacUpdate(int64_t id, HcfBlob *input);
     FFI_EXPORT HcfBlob FfiOHOSCryptoMacDoFinal(int64_t id, int32_t* errCode);
     FFI_EXPORT uint32_t FfiOHOSCryptoGetMacLength(int64_t id);
+    FFI_EXPORT uint64_t FfiOHOSCryptoMacGetHandle(int64_t id, int32_t* errCode);
 
     // sign
     FFI_EXPORT int64_t FFiOHOSCryptoSignConstructor(char* algName, int32_t* errCode);
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CRYPTO_HANDLE_TABLE_H
+#define CRYPTO_HANDLE_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OHOS {
+namespace CryptoFramework {
+enum CryptoHandleType : uint32_t {
+    CRYPTO_HANDLE_NONE = 0,
+    CRYPTO_HANDLE_MD,
+    CRYPTO_HANDLE_MAC,
+    CRYPTO_HANDLE_CIPHER,
+};
+
+/*
+ * Maps the streaming objects to 64 bit handles, the low word is the slot index plus one and the high word the
+ * generation of the slot. Lookups are lock free and O(1), a handle of a released object no longer matches the
+ * generation of its slot and resolves to nullptr. Register and Unregister take a lock, they only run when the
+ * FFI objects are created and released.
+ */
+class CryptoHandleTable {
+public:
+    static CryptoHandleTable &GetInstance();
+
+    uint64_t Register(CryptoHandleType type, void *obj);
+    void Unregister(uint64_t handle);
+    void *Lookup(uint64_t handle, CryptoHandleType type) const;
+
+    template <typename T>
+    T *Get(uint64_t handle, CryptoHandleType type) const
+    {
+        return static_cast<T *>(Lookup(handle, type));
+    }
+
+    CryptoHandleTable(const CryptoHandleTable &) = delete;
+    CryptoHandleTable &operator=(const CryptoHandleTable &) = delete;
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> generation;
+        std::atomic<uint32_t> type;
+        std::atomic<void *> obj;
+    };
+
+    static constexpr uint32_t CHUNK_BITS = 10;
+    static constexpr uint32_t CHUNK_SLOTS = 1U << CHUNK_BITS;
+    static constexpr uint32_t MAX_CHUNKS = 1024;
+
+    CryptoHandleTable();
+    ~CryptoHandleTable();
+    Slot *GetSlot(uint32_t index) const;
+
+    std::atomic<Slot *> chunks_[MAX_CHUNKS];
+    std::mutex mutex_;
+    std::vector<uint32_t> freeIndexes_;
+    uint32_t slotCount_ = 0;
+};
+}
+}
+
+#endif // CRYPTO_HANDLE_TABLE_H
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CRYPTO_STREAM_FFI_H
+#define CRYPTO_STREAM_FFI_H
+
+#include <cstdint>
+#include "cj_common_ffi.h"
+
+/*
+ * Streaming entries resolved through CryptoHandleTable, the handle comes from the GetHandle function of the object.
+ * Inputs are read in place and outputs are written into the buffer of the caller, *outLen receives the written
+ * length. For the symmetric ciphers an output buffer of the input length plus CRYPTO_STREAM_CIPHER_OUTPUT_SLACK is
+ * enough. If the cipher output does not fit, HCF_INVALID_PARAMS is returned with the needed length in *outLen and the
+ * output is kept for the handle; calling either cipher entry again with no input and a large enough buffer returns
+ * it, calls with input fail with HCF_ERR_INVALID_CALL until then.
+ */
+#define CRYPTO_STREAM_CIPHER_OUTPUT_SLACK 32
+
+namespace OHOS {
+namespace CryptoFramework {
+/* Frees the cipher output still pending for the handle, called when the object of the handle is released. */
+void CryptoStreamDropPendingOutput(uint64_t handle);
+}
+}
+
+extern "C" {
+    FFI_EXPORT int32_t FfiOHOSMdUpdateByHandle(uint64_t handle, const uint8_t *data, uint64_t len);
+    FFI_EXPORT int32_t FfiOHOSMdDigestInto(uint64_t handle, uint8_t *out, uint64_t outCap, uint64_t *outLen);
+    FFI_EXPORT int32_t FfiOHOSCryptoMacUpdateByHandle(uint64_t handle, const uint8_t *data, uint64_t len);
+    FFI_EXPORT int32_t FfiOHOSCryptoMacDoFinalInto(uint64_t handle, uint8_t *out, uint64_t outCap,
+        uint64_t *outLen);
+    FFI_EXPORT int32_t FfiOHOSCipherUpdateInto(uint64_t handle, const uint8_t *data, uint64_t len, uint8_t *out,
+        uint64_t outCap, uint64_t *outLen);
+    FFI_EXPORT int32_t FfiOHOSCipherDoFinalInto(uint64_t handle, const uint8_t *data, uint64_t len, uint8_t *out,
+        uint64_t outCap, uint64_t *outLen);
+}
+
+#endif // CRYPTO_STREAM_FFI_H
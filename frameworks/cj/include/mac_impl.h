@@ -17,6 +17,7 @@
 #define MAC_IMPL_H
 
 #include "ffi_remote_data.h"
+#include "crypto_handle_table.h"
 #include "mac.h"
 #include "blob.h"
 #include "log.h"
@@ -33,9 +34,11 @@ public:
     HcfResult MacUpdate(HcfBlob *input);
     HcfResult MacDoFinal(HcfBlob *output);
     uint32_t GetMacLength();
+    uint64_t GetHandle() const;
 
 private:
     HcfMac *macObj_ = nullptr;
+    uint64_t handle_ = 0;
 };
 }
 }
@@ -16,6 +16,7 @@
 #define MD_IMPL_H
 
 #include "ffi_remote_data.h"
+#include "crypto_handle_table.h"
 #include "md.h"
 #include "blob.h"
 #include "log.h"
@@ -31,9 +32,11 @@ public:
     HcfResult MdUpdate(HcfBlob *input);
     HcfResult MdDoFinal(HcfBlob *output);
     uint32_t GetMdLength(int32_t* errCode);
+    uint64_t GetHandle() const;
 
 private:
     HcfMd *mdObj_ = nullptr;
+    uint64_t handle_ = 0;
 };
 }
 }
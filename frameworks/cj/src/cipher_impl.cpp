@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "cipher_impl.h"
+#include "crypto_stream_ffi.h"
 #include "log.h"
 
 namespace OHOS {
@@ -20,13 +21,21 @@ namespace OHOS {
         CipherImpl::CipherImpl(HcfCipher *cipher)
         {
             cipher_ = cipher;
+            handle_ = CryptoHandleTable::GetInstance().Register(CRYPTO_HANDLE_CIPHER, cipher);
         }
 
         CipherImpl::~CipherImpl()
         {
+            CryptoStreamDropPendingOutput(handle_);
+            CryptoHandleTable::GetInstance().Unregister(handle_);
             HcfObjDestroy(this->cipher_);
         }
 
+        uint64_t CipherImpl::GetHandle() const
+        {
+            return handle_;
+        }
+
         HcfResult CipherImpl::CipherInit(HcfCryptoMode opMode, HcfKey *key, HcfParamsSpec *params)
         {
             if (cipher_ == nullptr) {
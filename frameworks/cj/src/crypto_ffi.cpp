@@ -156,6 +156,19 @@ namespace OHOS {
                 return res;
             }
 
+            uint64_t FfiOHOSMdGetHandle(int64_t id, int32_t* errCode)
+            {
+                auto instance = FFIData::GetData<MdImpl>(id);
+                if (!instance) {
+                    LOGE("[Md] instance not exist.");
+                    *errCode = HCF_ERR_MALLOC;
+                    return 0;
+                }
+                uint64_t handle = instance->GetHandle();
+                *errCode = (handle == 0) ? HCF_ERR_MALLOC : HCF_SUCCESS;
+                return handle;
+            }
+
             //-------------------symkeygenerator
             int64_t FfiOHOSCreateSymKeyGenerator(char* algName, int32_t* errCode)
             {
@@ -596,6 +609,19 @@ namespace OHOS {
                 return res;
             }
 
+            uint64_t FfiOHOSCipherGetHandle(int64_t id, int32_t* errCode)
+            {
+                auto instance = FFIData::GetData<CipherImpl>(id);
+                if (!instance) {
+                    LOGE("[Cipher] instance not exist.");
+                    *errCode = HCF_ERR_MALLOC;
+                    return 0;
+                }
+                uint64_t handle = instance->GetHandle();
+                *errCode = (handle == 0) ? HCF_ERR_MALLOC : HCF_SUCCESS;
+                return handle;
+            }
+
             //--------------------- mac
             int64_t FFiOHOSCryptoMacConstructor(char* algName, int32_t* errCode)
             {
@@ -694,6 +720,19 @@ namespace OHOS {
                 return res;
             }
 
+            uint64_t FfiOHOSCryptoMacGetHandle(int64_t id, int32_t* errCode)
+            {
+                auto instance = FFIData::GetData<MacImpl>(id);
+                if (!instance) {
+                    LOGE("[Mac] instance not exist.");
+                    *errCode = HCF_ERR_MALLOC;
+                    return 0;
+                }
+                uint64_t handle = instance->GetHandle();
+                *errCode = (handle == 0) ? HCF_ERR_MALLOC : HCF_SUCCESS;
+                return handle;
+            }
+
             //--------------------- sign
             int64_t FFiOHOSCryptoSignConstructor(char* algName, int32_t* errCode)
             {
@@ -1754,9 +1793,16 @@ namespace OHOS {
                     LOGE("[PubKey] FiOHOSKdfGenerateSecretByPB failed to get kdf impl obj!");
                     return HCF_INVALID_PARAMS;
                 }
-                HcfKdfParamsSpec *tmp = reinterpret_cast<HcfKdfParamsSpec *>(params);
+                // the cangjie side passes the spec without threadNum, only its own fields are read
+                HcfPBKDF2ParamsSpec spec = {
+                    .base = params->base,
+                    .password = params->password,
+                    .salt = params->salt,
+                    .iterations = params->iterations,
+                    .output = params->output,
+                };
                 LOGD("[Kdf] FiOHOSKdfGenerateSecretByPB end");
-                return instance->GenerateSecret(tmp);
+                return instance->GenerateSecret(&spec.base);
             }
 
             int32_t FFiOHOSKdfGenerateSecretByH(int64_t id, HcfHkdfParamsSpec *params)
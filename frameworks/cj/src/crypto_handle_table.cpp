@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "crypto_handle_table.h"
+
+#include <new>
+#include "log.h"
+
+namespace OHOS {
+    namespace CryptoFramework {
+        static constexpr uint32_t HANDLE_INDEX_BITS = 32;
+        static constexpr uint32_t FIRST_GENERATION = 1;
+
+        static inline uint64_t MakeHandle(uint32_t generation, uint32_t index)
+        {
+            return (static_cast<uint64_t>(generation) << HANDLE_INDEX_BITS) | (static_cast<uint64_t>(index) + 1);
+        }
+
+        CryptoHandleTable &CryptoHandleTable::GetInstance()
+        {
+            static CryptoHandleTable instance;
+            return instance;
+        }
+
+        CryptoHandleTable::CryptoHandleTable()
+        {
+            for (uint32_t i = 0; i < MAX_CHUNKS; i++) {
+                chunks_[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        CryptoHandleTable::~CryptoHandleTable()
+        {
+            for (uint32_t i = 0; i < MAX_CHUNKS; i++) {
+                delete[] chunks_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        CryptoHandleTable::Slot *CryptoHandleTable::GetSlot(uint32_t index) const
+        {
+            uint32_t chunkIndex = index >> CHUNK_BITS;
+            if (chunkIndex >= MAX_CHUNKS) {
+                return nullptr;
+            }
+            Slot *chunk = chunks_[chunkIndex].load(std::memory_order_acquire);
+            return (chunk == nullptr) ? nullptr : &chunk[index & (CHUNK_SLOTS - 1)];
+        }
+
+        uint64_t CryptoHandleTable::Register(CryptoHandleType type, void *obj)
+        {
+            if ((type == CRYPTO_HANDLE_NONE) || (obj == nullptr)) {
+                return 0;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            uint32_t index;
+            if (!freeIndexes_.empty()) {
+                index = freeIndexes_.back();
+                freeIndexes_.pop_back();
+            } else {
+                if (slotCount_ >= CHUNK_SLOTS * MAX_CHUNKS) {
+                    LOGE("The handle table is full.");
+                    return 0;
+                }
+                index = slotCount_;
+                uint32_t chunkIndex = index >> CHUNK_BITS;
+                if (chunks_[chunkIndex].load(std::memory_order_relaxed) == nullptr) {
+                    Slot *chunk = new (std::nothrow) Slot[CHUNK_SLOTS];
+                    if (chunk == nullptr) {
+                        LOGE("Failed to allocate handle slots.");
+                        return 0;
+                    }
+                    for (uint32_t i = 0; i < CHUNK_SLOTS; i++) {
+                        chunk[i].generation.store(FIRST_GENERATION, std::memory_order_relaxed);
+                        chunk[i].type.store(CRYPTO_HANDLE_NONE, std::memory_order_relaxed);
+                        chunk[i].obj.store(nullptr, std::memory_order_relaxed);
+                    }
+                    chunks_[chunkIndex].store(chunk, std::memory_order_release);
+                }
+                slotCount_++;
+            }
+            Slot *slot = GetSlot(index);
+            slot->type.store(type, std::memory_order_relaxed);
+            slot->obj.store(obj, std::memory_order_release);
+            return MakeHandle(slot->generation.load(std::memory_order_relaxed), index);
+        }
+
+        void CryptoHandleTable::Unregister(uint64_t handle)
+        {
+            uint32_t index = static_cast<uint32_t>(handle);
+            if (index == 0) {
+                return;
+            }
+            index--;
+            std::lock_guard<std::mutex> lock(mutex_);
+            Slot *slot = GetSlot(index);
+            uint32_t generation = static_cast<uint32_t>(handle >> HANDLE_INDEX_BITS);
+            if ((slot == nullptr) || (slot->generation.load(std::memory_order_relaxed) != generation)) {
+                LOGE("Unregister a stale handle.");
+                return;
+            }
+            uint32_t nextGeneration = generation + 1;
+            if (nextGeneration == 0) {
+                nextGeneration = FIRST_GENERATION;
+            }
+            slot->generation.store(nextGeneration, std::memory_order_release);
+            slot->obj.store(nullptr, std::memory_order_release);
+            slot->type.store(CRYPTO_HANDLE_NONE, std::memory_order_relaxed);
+            freeIndexes_.push_back(index);
+        }
+
+        void *CryptoHandleTable::Lookup(uint64_t handle, CryptoHandleType type) const
+        {
+            uint32_t index = static_cast<uint32_t>(handle);
+            if (index == 0) {
+                return nullptr;
+            }
+            Slot *slot = GetSlot(index - 1);
+            if (slot == nullptr) {
+                return nullptr;
+            }
+            uint32_t generation = static_cast<uint32_t>(handle >> HANDLE_INDEX_BITS);
+            if (slot->generation.load(std::memory_order_acquire) != generation) {
+                return nullptr;
+            }
+            void *obj = slot->obj.load(std::memory_order_acquire);
+            if (slot->type.load(std::memory_order_relaxed) != type) {
+                return nullptr;
+            }
+            // The slot may have been released and reused between the loads, the generation tells it apart.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot->generation.load(std::memory_order_relaxed) != generation) {
+                return nullptr;
+            }
+            return obj;
+        }
+    }
+}
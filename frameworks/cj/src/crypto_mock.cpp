@@ -24,6 +24,9 @@ FFI_EXPORT int FfiOHOSCreateMd = 0;
 FFI_EXPORT int FfiOHOSMdUpdate = 0;
 FFI_EXPORT int FfiOHOSDigest = 0;
 FFI_EXPORT int FfiOHOSGetMdLength = 0;
+FFI_EXPORT int FfiOHOSMdGetHandle = 0;
+FFI_EXPORT int FfiOHOSMdUpdateByHandle = 0;
+FFI_EXPORT int FfiOHOSMdDigestInto = 0;
 FFI_EXPORT int FfiOHOSCreateSymKeyGenerator = 0;
 FFI_EXPORT int FfiOHOSSymKeyGeneratorGetAlgName = 0;
 FFI_EXPORT int FfiOHOSGenerateSymKey = 0;
@@ -44,10 +47,16 @@ FFI_EXPORT int FfiOHOSSetCipherSpec = 0;
 FFI_EXPORT int FfiOHOSGetCipherSpecString = 0;
 FFI_EXPORT int FfiOHOSGetCipherSpecUint8Array = 0;
 FFI_EXPORT int FfiOHOSCipherGetAlgName = 0;
+FFI_EXPORT int FfiOHOSCipherGetHandle = 0;
+FFI_EXPORT int FfiOHOSCipherUpdateInto = 0;
+FFI_EXPORT int FfiOHOSCipherDoFinalInto = 0;
 FFI_EXPORT int FFiOHOSCryptoMacConstructor = 0;
 FFI_EXPORT int FfiOHOSCryptoMacInit = 0;
 FFI_EXPORT int FfiOHOSCryptoMacUpdate = 0;
 FFI_EXPORT int FfiOHOSCryptoMacDoFinal = 0;
 FFI_EXPORT int FfiOHOSGCryptoGetMacLength = 0;
+FFI_EXPORT int FfiOHOSCryptoMacGetHandle = 0;
+FFI_EXPORT int FfiOHOSCryptoMacUpdateByHandle = 0;
+FFI_EXPORT int FfiOHOSCryptoMacDoFinalInto = 0;
 FFI_EXPORT int FFiOHOSCryptoSignConstructor = 0;
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "crypto_stream_ffi.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include "blob.h"
+#include "cipher.h"
+#include "crypto_handle_table.h"
+#include "log.h"
+#include "mac.h"
+#include "md.h"
+#include "result.h"
+#include "securec.h"
+
+namespace OHOS {
+    namespace CryptoFramework {
+        static inline HcfBlob InputView(const uint8_t *data, uint64_t len)
+        {
+            return { .data = const_cast<uint8_t *>(data), .len = static_cast<size_t>(len) };
+        }
+
+        static bool IsOutputValid(const uint8_t *out, uint64_t outCap, const uint64_t *outLen)
+        {
+            return (outLen != nullptr) && ((out != nullptr) || (outCap == 0));
+        }
+
+        /* Copies the output of the framework into the buffer of the caller, the blob is left to the caller. */
+        static HcfResult CopyOutput(const HcfBlob *blob, uint8_t *out, uint64_t outCap, uint64_t *outLen)
+        {
+            *outLen = 0;
+            if (blob->len > outCap) {
+                LOGE("The output buffer is too small.");
+                return HCF_INVALID_PARAMS;
+            }
+            if ((blob->len > 0) && (memcpy_s(out, outCap, blob->data, blob->len) != EOK)) {
+                return HCF_ERR_CRYPTO_OPERATION;
+            }
+            *outLen = blob->len;
+            return HCF_SUCCESS;
+        }
+
+        /* Moves the output of the framework into the buffer of the caller and frees it. */
+        static HcfResult MoveOutput(HcfBlob *blob, uint8_t *out, uint64_t outCap, uint64_t *outLen, bool clear)
+        {
+            HcfResult res = CopyOutput(blob, out, outCap, outLen);
+            if (clear) {
+                HcfBlobDataClearAndFree(blob);
+            } else {
+                HcfBlobDataFree(blob);
+            }
+            return res;
+        }
+
+        /*
+         * Cipher output that did not fit the buffer of the caller, kept per handle until a retry collects it. The
+         * count lets the calls skip the lock while nothing is pending.
+         */
+        static std::mutex g_pendingLock;
+        static std::unordered_map<uint64_t, HcfBlob> g_pendingOutputs;
+        static std::atomic<uint32_t> g_pendingCount { 0 };
+
+        static void KeepPendingOutput(uint64_t handle, HcfBlob *output, uint64_t *outLen)
+        {
+            std::lock_guard<std::mutex> lock(g_pendingLock);
+            g_pendingOutputs[handle] = *output;
+            g_pendingCount.fetch_add(1, std::memory_order_release);
+            *outLen = output->len;
+            output->data = nullptr;
+            output->len = 0;
+        }
+
+        /* Returns false if nothing is pending for the handle, otherwise res holds the result of the retry. */
+        static bool TakePendingOutput(uint64_t handle, uint64_t len, uint8_t *out, uint64_t outCap,
+            uint64_t *outLen, HcfResult *res)
+        {
+            if (g_pendingCount.load(std::memory_order_acquire) == 0) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(g_pendingLock);
+            auto it = g_pendingOutputs.find(handle);
+            if (it == g_pendingOutputs.end()) {
+                return false;
+            }
+            if (len != 0) {
+                LOGE("[Cipher] the pending output must be collected before new input.");
+                *outLen = it->second.len;
+                *res = HCF_ERR_INVALID_CALL;
+                return true;
+            }
+            *res = CopyOutput(&it->second, out, outCap, outLen);
+            if (*res == HCF_INVALID_PARAMS) {
+                *outLen = it->second.len;
+                return true;
+            }
+            HcfBlobDataClearAndFree(&it->second);
+            g_pendingOutputs.erase(it);
+            g_pendingCount.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+
+        void CryptoStreamDropPendingOutput(uint64_t handle)
+        {
+            if (g_pendingCount.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(g_pendingLock);
+            auto it = g_pendingOutputs.find(handle);
+            if (it != g_pendingOutputs.end()) {
+                HcfBlobDataClearAndFree(&it->second);
+                g_pendingOutputs.erase(it);
+                g_pendingCount.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        static HcfResult CipherInto(uint64_t handle, const uint8_t *data, uint64_t len, uint8_t *out,
+            uint64_t outCap, uint64_t *outLen, bool isFinal)
+        {
+            HcfCipher *cipher = CryptoHandleTable::GetInstance().Get<HcfCipher>(handle, CRYPTO_HANDLE_CIPHER);
+            if (cipher == nullptr) {
+                LOGE("[Cipher] handle not exist.");
+                return HCF_INVALID_PARAMS;
+            }
+            if (((data == nullptr) && (len != 0)) || !IsOutputValid(out, outCap, outLen)) {
+                LOGE("[Cipher] invalid input or output buffer.");
+                return HCF_INVALID_PARAMS;
+            }
+            HcfResult res = HCF_SUCCESS;
+            if (TakePendingOutput(handle, len, out, outCap, outLen, &res)) {
+                return res;
+            }
+            HcfBlob input = InputView(data, len);
+            HcfBlob output = { .data = nullptr, .len = 0 };
+            res = isFinal ? cipher->doFinal(cipher, (len == 0) ? nullptr : &input, &output) :
+                cipher->update(cipher, &input, &output);
+            if (res != HCF_SUCCESS) {
+                LOGE("[Cipher] update or doFinal failed.");
+                return res;
+            }
+            if (output.len > outCap) {
+                // The input is consumed already, keep the output so that the caller can retry with a larger buffer.
+                LOGE("[Cipher] the output buffer is too small, %{public}zu bytes are pending.", output.len);
+                KeepPendingOutput(handle, &output, outLen);
+                return HCF_INVALID_PARAMS;
+            }
+            return MoveOutput(&output, out, outCap, outLen, true);
+        }
+
+        extern "C" {
+            int32_t FfiOHOSMdUpdateByHandle(uint64_t handle, const uint8_t *data, uint64_t len)
+            {
+                HcfMd *md = CryptoHandleTable::GetInstance().Get<HcfMd>(handle, CRYPTO_HANDLE_MD);
+                if (md == nullptr) {
+                    LOGE("[Md] handle not exist.");
+                    return HCF_INVALID_PARAMS;
+                }
+                HcfBlob input = InputView(data, len);
+                return md->update(md, &input);
+            }
+
+            int32_t FfiOHOSMdDigestInto(uint64_t handle, uint8_t *out, uint64_t outCap, uint64_t *outLen)
+            {
+                HcfMd *md = CryptoHandleTable::GetInstance().Get<HcfMd>(handle, CRYPTO_HANDLE_MD);
+                if (md == nullptr) {
+                    LOGE("[Md] handle not exist.");
+                    return HCF_INVALID_PARAMS;
+                }
+                if (!IsOutputValid(out, outCap, outLen) || (outCap < md->getMdLength(md))) {
+                    LOGE("[Md] invalid output buffer.");
+                    return HCF_INVALID_PARAMS;
+                }
+                HcfBlob output = { .data = nullptr, .len = 0 };
+                HcfResult res = md->doFinal(md, &output);
+                if (res != HCF_SUCCESS) {
+                    LOGE("[Md] doFinal failed.");
+                    return res;
+                }
+                return MoveOutput(&output, out, outCap, outLen, false);
+            }
+
+            int32_t FfiOHOSCryptoMacUpdateByHandle(uint64_t handle, const uint8_t *data, uint64_t len)
+            {
+                HcfMac *mac = CryptoHandleTable::GetInstance().Get<HcfMac>(handle, CRYPTO_HANDLE_MAC);
+                if (mac == nullptr) {
+                    LOGE("[Mac] handle not exist.");
+                    return HCF_INVALID_PARAMS;
+                }
+                HcfBlob input = InputView(data, len);
+                return mac->update(mac, &input);
+            }
+
+            int32_t FfiOHOSCryptoMacDoFinalInto(uint64_t handle, uint8_t *out, uint64_t outCap, uint64_t *outLen)
+            {
+                HcfMac *mac = CryptoHandleTable::GetInstance().Get<HcfMac>(handle, CRYPTO_HANDLE_MAC);
+                if (mac == nullptr) {
+                    LOGE("[Mac] handle not exist.");
+                    return HCF_INVALID_PARAMS;
+                }
+                if (!IsOutputValid(out, outCap, outLen) || (outCap < mac->getMacLength(mac))) {
+                    LOGE("[Mac] invalid output buffer.");
+                    return HCF_INVALID_PARAMS;
+                }
+                HcfBlob output = { .data = nullptr, .len = 0 };
+                HcfResult res = mac->doFinal(mac, &output);
+                if (res != HCF_SUCCESS) {
+                    LOGE("[Mac] doFinal failed.");
+                    return res;
+                }
+                return MoveOutput(&output, out, outCap, outLen, false);
+            }
+
+            int32_t FfiOHOSCipherUpdateInto(uint64_t handle, const uint8_t *data, uint64_t len, uint8_t *out,
+                uint64_t outCap, uint64_t *outLen)
+            {
+                return CipherInto(handle, data, len, out, outCap, outLen, false);
+            }
+
+            int32_t FfiOHOSCipherDoFinalInto(uint64_t handle, const uint8_t *data, uint64_t len, uint8_t *out,
+                uint64_t outCap, uint64_t *outLen)
+            {
+                return CipherInto(handle, data, len, out, outCap, outLen, true);
+            }
+        }
+    }
+}
@@ -20,13 +20,20 @@ namespace OHOS {
         MacImpl::MacImpl(HcfMac *macObj)
         {
             macObj_ = macObj;
+            handle_ = CryptoHandleTable::GetInstance().Register(CRYPTO_HANDLE_MAC, macObj);
         }
 
         MacImpl::~MacImpl()
         {
+            CryptoHandleTable::GetInstance().Unregister(handle_);
             HcfObjDestroy(this->macObj_);
         }
 
+        uint64_t MacImpl::GetHandle() const
+        {
+            return handle_;
+        }
+
         HcfResult MacImpl::MacInit(HcfSymKey *symKey)
         {
             if (macObj_ == nullptr) {
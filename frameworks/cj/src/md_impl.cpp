@@ -19,6 +19,7 @@ namespace OHOS {
         MdImpl::MdImpl(HcfMd *mdObj)
         {
             mdObj_ = mdObj;
+            handle_ = CryptoHandleTable::GetInstance().Register(CRYPTO_HANDLE_MD, mdObj);
         }
 
         HcfResult MdImpl::MdUpdate(HcfBlob *input)
@@ -33,9 +34,15 @@ namespace OHOS {
 
         MdImpl::~MdImpl()
         {
+            CryptoHandleTable::GetInstance().Unregister(handle_);
             HcfObjDestroy(this->mdObj_);
         }
 
+        uint64_t MdImpl::GetHandle() const
+        {
+            return handle_;
+        }
+
         HcfResult MdImpl::MdDoFinal(HcfBlob *output)
         {
             if (mdObj_ == nullptr) {
@@ -14,21 +14,28 @@
  */
 
 #include "cipher.h"
+#ifdef CRYPTO_MBEDTLS
+#include "crypto_operation_err.h"
+#include "mbedtls_cipher.h"
+#else
 #include "aes_openssl.h"
 #include "des_openssl.h"
+#endif
 #include "config.h"
 #include "securec.h"
 #include "result.h"
 #include "string.h"
 #include "log.h"
 #include "memory.h"
+#ifndef CRYPTO_MBEDTLS
 #include "cipher_rsa_openssl.h"
 #include "cipher_sm2_openssl.h"
 #include "sm4_openssl.h"
 #include "chacha20_openssl.h"
 #include "cipher_openssl.h"
-#include "utils.h"
 #include "plugin_operation_err.h"
+#endif
+#include "utils.h"
 
 typedef HcfResult (*HcfCipherGeneratorSpiCreateFunc)(CipherAttr *, HcfCipherGeneratorSpi **);
 
@@ -48,6 +55,9 @@ typedef struct {
 } HcfCipherGenAbility;
 
 static const HcfCipherGenAbility CIPHER_ABILITY_SET[] = {
+#ifdef CRYPTO_MBEDTLS
+    { HCF_ALG_AES, { MbedtlsAesCipherSpiCreate } }
+#else
     { HCF_ALG_RSA, { HcfCipherRsaCipherSpiCreate } },
     { HCF_ALG_SM2, { HcfCipherSm2CipherSpiCreate } },
     { HCF_ALG_AES, { HcfCipherAesGeneratorSpiCreate } },
@@ -61,6 +71,7 @@ static const HcfCipherGenAbility CIPHER_ABILITY_SET[] = {
     { HCF_ALG_RC4, { HcfCipherSymAlgorithmGeneratorSpiCreate } },
     { HCF_ALG_BLOWFISH, { HcfCipherSymAlgorithmGeneratorSpiCreate } },
     { HCF_ALG_CAST, { HcfCipherSymAlgorithmGeneratorSpiCreate } }
+#endif
 };
 
 static void SetKeyType(HcfAlgParaValue value, void *cipher)
@@ -257,13 +268,13 @@ static void CipherDestroy(HcfObjectBase *self)
 
 static HcfResult SetCipherSpecUint8Array(HcfCipher *self, CipherSpecItem item, HcfBlob pSource)
 {
-    // only implemented for OAEP_MGF1_PSRC_UINT8ARR
+    // only implemented for OAEP_MGF1_PSRC_UINT8ARR and CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR
     // if pSource == NULL or len == 0, it means cleaning the pSource
     if (self == NULL) {
         LOGE("Invalid input parameter.");
         return HCF_INVALID_PARAMS;
     }
-    if (item != OAEP_MGF1_PSRC_UINT8ARR) {
+    if ((item != OAEP_MGF1_PSRC_UINT8ARR) && (item != CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR)) {
         LOGE("Spec item not support.");
         return HCF_INVALID_PARAMS;
     }
@@ -317,6 +328,56 @@ static HcfResult GetCipherSpecUint8Array(HcfCipher *self, CipherSpecItem item, H
     return impl->spiObj->getCipherSpecUint8Array(impl->spiObj, item, returnUint8Array);
 }
 
+static bool CheckCipherSpecInt(CipherSpecItem item)
+{
+    return ((item == CIPHER_PARALLEL_WORKER_NUM_INT) || (item == CIPHER_PARALLEL_THRESHOLD_INT) ||
+        (item == CIPHER_AEAD_NONCE_MODE_INT));
+}
+
+static HcfResult SetCipherSpecInt(HcfCipher *self, CipherSpecItem item, int32_t value)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!CheckCipherSpecInt(item)) {
+        LOGE("Spec item not support.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherGeneratorClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    CipherGenImpl *impl = (CipherGenImpl *)self;
+    if (impl->spiObj->setCipherSpecInt == NULL) {
+        LOGE("Algorithm not support int spec.");
+        return HCF_NOT_SUPPORT;
+    }
+    return impl->spiObj->setCipherSpecInt(impl->spiObj, item, value);
+}
+
+static HcfResult GetCipherSpecInt(HcfCipher *self, CipherSpecItem item, int32_t *returnInt)
+{
+    if (self == NULL || returnInt == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!CheckCipherSpecInt(item)) {
+        LOGE("Spec item not support.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherGeneratorClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    CipherGenImpl *impl = (CipherGenImpl *)self;
+    if (impl->spiObj->getCipherSpecInt == NULL) {
+        LOGE("Algorithm not support int spec.");
+        return HCF_NOT_SUPPORT;
+    }
+    return impl->spiObj->getCipherSpecInt(impl->spiObj, item, returnInt);
+}
+
 static HcfResult CipherInit(HcfCipher *self, enum HcfCryptoMode opMode,
     HcfKey *key, HcfParamsSpec *params)
 {
@@ -363,6 +424,57 @@ static HcfResult CipherFinal(HcfCipher *self, HcfBlob *input, HcfBlob *output)
     return impl->spiObj->doFinal(impl->spiObj, input, output);
 }
 
+static HcfResult CipherProcessDataUnits(HcfCipher *self, uint64_t startDataUnit, uint32_t dataUnitLen,
+    HcfBlob *input, HcfBlob *output)
+{
+    if ((self == NULL) || (!HcfIsBlobValid(input)) || (output == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherGeneratorClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    CipherGenImpl *impl = (CipherGenImpl *)self;
+    if (impl->spiObj->processDataUnits == NULL) {
+        LOGE("Algorithm not support data unit processing.");
+        return HCF_NOT_SUPPORT;
+    }
+    HcfClearPluginErrorMessage();
+    return impl->spiObj->processDataUnits(impl->spiObj, startDataUnit, dataUnitLen, input, output);
+}
+
+static HcfResult CipherDoFinalBatch(HcfCipher *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob *returnOutputs)
+{
+    if ((self == NULL) || (inputs == NULL) || (returnArena == NULL) || (returnOutputs == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherGeneratorClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((count == 0) || (workerNum > HCF_CIPHER_MAX_BATCH_WORKER_NUM)) {
+        LOGE("Invalid batch count or worker num.");
+        return HCF_INVALID_PARAMS;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!HcfIsBlobValid(&inputs[i])) {
+            LOGE("Input %{public}u is invalid.", i);
+            return HCF_INVALID_PARAMS;
+        }
+    }
+    CipherGenImpl *impl = (CipherGenImpl *)self;
+    if (impl->spiObj->doFinalBatch == NULL) {
+        LOGE("Algorithm not support batch processing.");
+        return HCF_NOT_SUPPORT;
+    }
+    (void)memset_s(returnOutputs, sizeof(HcfBlob) * count, 0, sizeof(HcfBlob) * count);
+    HcfClearPluginErrorMessage();
+    return impl->spiObj->doFinalBatch(impl->spiObj, inputs, count, workerNum, returnArena, returnOutputs);
+}
+
 static void InitCipher(HcfCipherGeneratorSpi *spiObj, CipherGenImpl *cipher)
 {
     cipher->super.init = CipherInit;
@@ -374,6 +486,10 @@ static void InitCipher(HcfCipherGeneratorSpi *spiObj, CipherGenImpl *cipher)
     cipher->super.getCipherSpecString = GetCipherSpecString;
     cipher->super.getCipherSpecUint8Array = GetCipherSpecUint8Array;
     cipher->super.setCipherSpecUint8Array = SetCipherSpecUint8Array;
+    cipher->super.setCipherSpecInt = SetCipherSpecInt;
+    cipher->super.getCipherSpecInt = GetCipherSpecInt;
+    cipher->super.processDataUnits = CipherProcessDataUnits;
+    cipher->super.doFinalBatch = CipherDoFinalBatch;
 }
 
 static const HcfCipherGenFuncSet *FindAbility(CipherAttr *attr)
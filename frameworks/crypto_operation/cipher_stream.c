@@ -0,0 +1,428 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cipher_stream.h"
+
+#include <pthread.h>
+#include <securec.h>
+
+#include "log.h"
+#include "memory.h"
+#include "utils.h"
+
+typedef struct {
+    HcfCipherStream base;
+
+    HcfCipher *cipher;
+
+    HcfCipherStreamOutputFunc outputFunc;
+
+    void *userData;
+
+    pthread_t worker;
+
+    pthread_mutex_t lock;
+
+    pthread_cond_t notEmpty;
+
+    pthread_cond_t notFull;
+
+    pthread_cond_t idle;
+
+    HcfBlob *queue;
+
+    uint32_t capacity;
+
+    uint32_t head;
+
+    uint32_t count;
+
+    HcfBlob finalInput;
+
+    bool finalPending;
+
+    bool finished;
+
+    bool stopped;
+
+    bool busy;
+
+    bool exiting;
+
+    HcfResult firstError;
+} HcfCipherStreamImpl;
+
+static const char *GetCipherStreamClass(void)
+{
+    return "HcfCipherStream";
+}
+
+static HcfResult CopyChunk(const HcfBlob *input, HcfBlob *chunk)
+{
+    chunk->data = NULL;
+    chunk->len = 0;
+    if (input == NULL || input->len == 0) {
+        return HCF_SUCCESS;
+    }
+    chunk->data = (uint8_t *)HcfMalloc(input->len, 0);
+    if (chunk->data == NULL) {
+        LOGE("Failed to allocate stream chunk.");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(chunk->data, input->len, input->data, input->len);
+    chunk->len = input->len;
+    return HCF_SUCCESS;
+}
+
+static void DeliverOutput(HcfCipherStreamImpl *impl, HcfResult result, HcfBlob *output, bool isFinal)
+{
+    if (impl->outputFunc != NULL) {
+        impl->outputFunc(impl->userData, result, output, isFinal);
+    }
+    HcfBlobDataClearAndFree(output);
+}
+
+static void ProcessChunk(HcfCipherStreamImpl *impl, HcfBlob *input, bool isFinal)
+{
+    HcfBlob output = { .data = NULL, .len = 0 };
+    HcfResult ret;
+    if (isFinal) {
+        ret = impl->cipher->doFinal(impl->cipher, (input->data == NULL) ? NULL : input, &output);
+    } else {
+        ret = impl->cipher->update(impl->cipher, input, &output);
+    }
+    HcfBlobDataClearAndFree(input);
+
+    pthread_mutex_lock(&impl->lock);
+    if (ret != HCF_SUCCESS) {
+        impl->firstError = ret;
+        impl->stopped = true;
+    }
+    pthread_mutex_unlock(&impl->lock);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Stream cipher operation failed, ret = %{public}d.", ret);
+        DeliverOutput(impl, ret, &output, true);
+        return;
+    }
+    DeliverOutput(impl, HCF_SUCCESS, &output, isFinal);
+}
+
+static bool TakeNextChunk(HcfCipherStreamImpl *impl, HcfBlob *chunk, bool *isFinal)
+{
+    while (!impl->exiting && impl->count == 0 && !impl->finalPending) {
+        pthread_cond_wait(&impl->notEmpty, &impl->lock);
+    }
+    if (impl->exiting) {
+        return false;
+    }
+    if (impl->count > 0) {
+        *chunk = impl->queue[impl->head];
+        impl->queue[impl->head].data = NULL;
+        impl->queue[impl->head].len = 0;
+        impl->head = (impl->head + 1) % impl->capacity;
+        impl->count--;
+        *isFinal = false;
+        pthread_cond_signal(&impl->notFull);
+    } else {
+        *chunk = impl->finalInput;
+        impl->finalInput.data = NULL;
+        impl->finalInput.len = 0;
+        impl->finalPending = false;
+        *isFinal = true;
+    }
+    return true;
+}
+
+static void *CipherStreamWorker(void *arg)
+{
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)arg;
+    pthread_mutex_lock(&impl->lock);
+    while (true) {
+        HcfBlob chunk = { .data = NULL, .len = 0 };
+        bool isFinal = false;
+        if (!TakeNextChunk(impl, &chunk, &isFinal)) {
+            break;
+        }
+        if (impl->stopped) {
+            // an earlier chunk failed, the rest of the stream is dropped
+            HcfBlobDataClearAndFree(&chunk);
+        } else {
+            impl->busy = true;
+            pthread_mutex_unlock(&impl->lock);
+            ProcessChunk(impl, &chunk, isFinal);
+            pthread_mutex_lock(&impl->lock);
+            impl->busy = false;
+            if (isFinal) {
+                impl->stopped = true;
+            }
+        }
+        if (impl->count == 0 && !impl->finalPending) {
+            pthread_cond_broadcast(&impl->idle);
+        }
+        if (impl->stopped) {
+            pthread_cond_broadcast(&impl->notFull);
+        }
+    }
+    pthread_mutex_unlock(&impl->lock);
+    return NULL;
+}
+
+static HcfResult CheckWritable(HcfCipherStreamImpl *impl)
+{
+    if (impl->stopped && impl->firstError != HCF_SUCCESS) {
+        return impl->firstError;
+    }
+    if (impl->finished) {
+        LOGE("Stream is already finished.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    return HCF_SUCCESS;
+}
+
+static void PushChunk(HcfCipherStreamImpl *impl, HcfBlob *chunk)
+{
+    uint32_t tail = (impl->head + impl->count) % impl->capacity;
+    impl->queue[tail] = *chunk;
+    impl->count++;
+    pthread_cond_signal(&impl->notEmpty);
+}
+
+static HcfResult EnqueueChunk(HcfCipherStream *self, const HcfBlob *input, bool blocking, bool *accepted)
+{
+    if ((self == NULL) || (input == NULL) || (input->data == NULL) || (input->len == 0)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherStreamClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)self;
+    HcfBlob chunk = { .data = NULL, .len = 0 };
+    HcfResult ret = CopyChunk(input, &chunk);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    pthread_mutex_lock(&impl->lock);
+    ret = CheckWritable(impl);
+    while (ret == HCF_SUCCESS && blocking && impl->count == impl->capacity) {
+        pthread_cond_wait(&impl->notFull, &impl->lock);
+        ret = CheckWritable(impl);
+    }
+    bool pushed = false;
+    if (ret == HCF_SUCCESS && impl->count < impl->capacity) {
+        PushChunk(impl, &chunk);
+        pushed = true;
+    }
+    pthread_mutex_unlock(&impl->lock);
+    if (!pushed) {
+        HcfBlobDataClearAndFree(&chunk);
+    } else if (accepted != NULL) {
+        *accepted = true;
+    }
+    return ret;
+}
+
+static HcfResult CipherStreamWrite(HcfCipherStream *self, const HcfBlob *input)
+{
+    return EnqueueChunk(self, input, true, NULL);
+}
+
+static HcfResult CipherStreamTryWrite(HcfCipherStream *self, const HcfBlob *input, bool *accepted)
+{
+    if (accepted == NULL) {
+        LOGE("Invalid accepted parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    *accepted = false;
+    return EnqueueChunk(self, input, false, accepted);
+}
+
+static HcfResult CipherStreamFinish(HcfCipherStream *self, const HcfBlob *input)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherStreamClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)self;
+    HcfBlob chunk = { .data = NULL, .len = 0 };
+    HcfResult ret = CopyChunk(input, &chunk);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    pthread_mutex_lock(&impl->lock);
+    ret = CheckWritable(impl);
+    if (ret == HCF_SUCCESS) {
+        impl->finalInput = chunk;
+        impl->finalPending = true;
+        impl->finished = true;
+        pthread_cond_signal(&impl->notEmpty);
+    }
+    pthread_mutex_unlock(&impl->lock);
+    if (ret != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(&chunk);
+    }
+    return ret;
+}
+
+static HcfResult CipherStreamWait(HcfCipherStream *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetCipherStreamClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)self;
+    pthread_mutex_lock(&impl->lock);
+    while (impl->count > 0 || impl->finalPending || impl->busy) {
+        pthread_cond_wait(&impl->idle, &impl->lock);
+    }
+    HcfResult ret = impl->firstError;
+    pthread_mutex_unlock(&impl->lock);
+    return ret;
+}
+
+static uint32_t CipherStreamGetPendingCount(HcfCipherStream *self)
+{
+    if (self == NULL || !HcfIsClassMatch((HcfObjectBase *)self, GetCipherStreamClass())) {
+        LOGE("Invalid input parameter.");
+        return 0;
+    }
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)self;
+    pthread_mutex_lock(&impl->lock);
+    uint32_t pending = impl->count + (impl->finalPending ? 1 : 0) + (impl->busy ? 1 : 0);
+    pthread_mutex_unlock(&impl->lock);
+    return pending;
+}
+
+static void ReleaseQueue(HcfCipherStreamImpl *impl)
+{
+    if (impl->queue != NULL) {
+        for (uint32_t i = 0; i < impl->capacity; i++) {
+            HcfBlobDataClearAndFree(&impl->queue[i]);
+        }
+        HcfFree(impl->queue);
+        impl->queue = NULL;
+    }
+    HcfBlobDataClearAndFree(&impl->finalInput);
+}
+
+static void DestroySyncPrimitives(HcfCipherStreamImpl *impl)
+{
+    pthread_cond_destroy(&impl->idle);
+    pthread_cond_destroy(&impl->notFull);
+    pthread_cond_destroy(&impl->notEmpty);
+    pthread_mutex_destroy(&impl->lock);
+}
+
+static void DestroyCipherStream(HcfObjectBase *self)
+{
+    if (self == NULL) {
+        return;
+    }
+    if (!HcfIsClassMatch(self, GetCipherStreamClass())) {
+        LOGE("Class not match.");
+        return;
+    }
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)self;
+    pthread_mutex_lock(&impl->lock);
+    impl->exiting = true;
+    pthread_cond_broadcast(&impl->notEmpty);
+    pthread_mutex_unlock(&impl->lock);
+    (void)pthread_join(impl->worker, NULL);
+
+    ReleaseQueue(impl);
+    DestroySyncPrimitives(impl);
+    HcfFree(impl);
+}
+
+static HcfResult InitSyncPrimitives(HcfCipherStreamImpl *impl)
+{
+    if (pthread_mutex_init(&impl->lock, NULL) != 0) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (pthread_cond_init(&impl->notEmpty, NULL) != 0) {
+        goto ERR_LOCK;
+    }
+    if (pthread_cond_init(&impl->notFull, NULL) != 0) {
+        goto ERR_NOT_EMPTY;
+    }
+    if (pthread_cond_init(&impl->idle, NULL) != 0) {
+        goto ERR_NOT_FULL;
+    }
+    return HCF_SUCCESS;
+ERR_NOT_FULL:
+    pthread_cond_destroy(&impl->notFull);
+ERR_NOT_EMPTY:
+    pthread_cond_destroy(&impl->notEmpty);
+ERR_LOCK:
+    pthread_mutex_destroy(&impl->lock);
+    return HCF_ERR_CRYPTO_OPERATION;
+}
+
+HcfResult HcfCipherStreamCreate(HcfCipher *cipher, uint32_t queueDepth, HcfCipherStreamOutputFunc outputFunc,
+    void *userData, HcfCipherStream **returnObj)
+{
+    if ((cipher == NULL) || (outputFunc == NULL) || (returnObj == NULL) ||
+        (queueDepth > HCF_CIPHER_STREAM_MAX_QUEUE_DEPTH)) {
+        LOGE("Invalid input params while creating cipher stream!");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherStreamImpl *impl = (HcfCipherStreamImpl *)HcfMalloc(sizeof(HcfCipherStreamImpl), 0);
+    if (impl == NULL) {
+        LOGE("Failed to allocate cipher stream memory!");
+        return HCF_ERR_MALLOC;
+    }
+    impl->capacity = (queueDepth == 0) ? HCF_CIPHER_STREAM_DEFAULT_QUEUE_DEPTH : queueDepth;
+    impl->queue = (HcfBlob *)HcfMalloc(sizeof(HcfBlob) * impl->capacity, 0);
+    if (impl->queue == NULL) {
+        LOGE("Failed to allocate cipher stream queue!");
+        HcfFree(impl);
+        return HCF_ERR_MALLOC;
+    }
+    if (InitSyncPrimitives(impl) != HCF_SUCCESS) {
+        LOGE("Failed to init cipher stream lock!");
+        HcfFree(impl->queue);
+        HcfFree(impl);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->cipher = cipher;
+    impl->outputFunc = outputFunc;
+    impl->userData = userData;
+    impl->firstError = HCF_SUCCESS;
+    impl->base.base.getClass = GetCipherStreamClass;
+    impl->base.base.destroy = DestroyCipherStream;
+    impl->base.write = CipherStreamWrite;
+    impl->base.tryWrite = CipherStreamTryWrite;
+    impl->base.finish = CipherStreamFinish;
+    impl->base.wait = CipherStreamWait;
+    impl->base.getPendingCount = CipherStreamGetPendingCount;
+    if (pthread_create(&impl->worker, NULL, CipherStreamWorker, impl) != 0) {
+        LOGE("Failed to start cipher stream worker!");
+        DestroySyncPrimitives(impl);
+        HcfFree(impl->queue);
+        HcfFree(impl);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnObj = (HcfCipherStream *)impl;
+    return HCF_SUCCESS;
+}
@@ -14,9 +14,26 @@
  */
 
 #include "crypto_operation_err.h"
+#ifdef CRYPTO_MBEDTLS
+#include <stddef.h>
+#else
 #include "plugin_operation_err.h"
+#endif
 
 char *HcfGetOperationErrorMessage(char *buff, uint32_t len)
 {
+#ifdef CRYPTO_MBEDTLS
+    // the mbedtls plugin keeps no error queue
+    (void)buff;
+    (void)len;
+    return NULL;
+#else
     return HcfGetPluginErrorMessage(buff, len);
+#endif
 }
+
+#ifdef CRYPTO_MBEDTLS
+void HcfClearPluginErrorMessage(void)
+{
+}
+#endif
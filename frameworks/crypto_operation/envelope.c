@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "envelope.h"
+
+#include <securec.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config.h"
+#include "envelope_openssl.h"
+#include "envelope_spi.h"
+#include "log.h"
+#include "memory.h"
+#include "utils.h"
+
+typedef HcfResult (*HcfEnvelopeSpiCreateFunc)(const char *algoName, HcfEnvelopeSpi **returnObj);
+
+typedef struct {
+    HcfEnvelope base;
+    HcfEnvelopeSpi *spiObj;
+    char algoName[HCF_MAX_ALGO_NAME_LEN];
+} HcfEnvelopeImpl;
+
+typedef struct {
+    const char *algoName;
+    HcfEnvelopeSpiCreateFunc createSpiFunc;
+} HcfEnvelopeAbility;
+
+static const HcfEnvelopeAbility ENVELOPE_ABILITY_SET[] = {
+    { "X25519-AES256-GCM", HcfEnvelopeSpiCreateOpenssl },
+    { "ECC-AES256-GCM", HcfEnvelopeSpiCreateOpenssl },
+    { "SM2-SM4-GCM", HcfEnvelopeSpiCreateOpenssl },
+    { "RSA-KEM-AES256-GCM", HcfEnvelopeSpiCreateOpenssl }
+};
+
+static HcfEnvelopeSpiCreateFunc FindAbility(const char *algoName)
+{
+    for (uint32_t i = 0; i < sizeof(ENVELOPE_ABILITY_SET) / sizeof(ENVELOPE_ABILITY_SET[0]); i++) {
+        if (strcmp(ENVELOPE_ABILITY_SET[i].algoName, algoName) == 0) {
+            return ENVELOPE_ABILITY_SET[i].createSpiFunc;
+        }
+    }
+    LOGE("No matching envelope ability found");
+    return NULL;
+}
+
+static const char *GetEnvelopeClass(void)
+{
+    return "HcfEnvelope";
+}
+
+static bool IsOptionalBlobValid(const HcfBlob *blob)
+{
+    return (blob == NULL) || (blob->len == 0) || (blob->data != NULL);
+}
+
+static HcfResult Seal(HcfEnvelope *self, HcfPubKey *pubKey, const HcfBlob *aad, const HcfBlob *input,
+    HcfBlob *returnEnvelope)
+{
+    if ((self == NULL) || (pubKey == NULL) || !HcfIsBlobValid(input) || !IsOptionalBlobValid(aad) ||
+        (returnEnvelope == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEnvelopeClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfEnvelopeSpi *spiObj = ((HcfEnvelopeImpl *)self)->spiObj;
+    return spiObj->engineSeal(spiObj, pubKey, aad, input, returnEnvelope);
+}
+
+static HcfResult Open(HcfEnvelope *self, HcfPriKey *priKey, const HcfBlob *aad, const HcfBlob *envelope,
+    HcfBlob *returnOutput)
+{
+    if ((self == NULL) || (priKey == NULL) || !HcfIsBlobValid(envelope) || !IsOptionalBlobValid(aad) ||
+        (returnOutput == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEnvelopeClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfEnvelopeSpi *spiObj = ((HcfEnvelopeImpl *)self)->spiObj;
+    return spiObj->engineOpen(spiObj, priKey, aad, envelope, returnOutput);
+}
+
+static const char *GetAlgoName(HcfEnvelope *self)
+{
+    if (self == NULL) {
+        LOGE("The input self ptr is NULL!");
+        return NULL;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEnvelopeClass())) {
+        return NULL;
+    }
+    return ((HcfEnvelopeImpl *)self)->algoName;
+}
+
+static void DestroyEnvelope(HcfObjectBase *self)
+{
+    if (self == NULL) {
+        return;
+    }
+    if (!HcfIsClassMatch(self, GetEnvelopeClass())) {
+        return;
+    }
+    HcfEnvelopeImpl *impl = (HcfEnvelopeImpl *)self;
+    HcfObjDestroy(impl->spiObj);
+    impl->spiObj = NULL;
+    HcfFree(impl);
+}
+
+HcfResult HcfEnvelopeCreate(const char *algoName, HcfEnvelope **returnObj)
+{
+    if (!HcfIsStrValid(algoName, HCF_MAX_ALGO_NAME_LEN) || (returnObj == NULL)) {
+        LOGE("AlgoName is invalid or returnObj is null");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfEnvelopeSpiCreateFunc createSpiFunc = FindAbility(algoName);
+    if (createSpiFunc == NULL) {
+        LOGE("Not support envelope algo: %{public}s", algoName);
+        return HCF_NOT_SUPPORT;
+    }
+    HcfEnvelopeImpl *impl = (HcfEnvelopeImpl *)HcfMalloc(sizeof(HcfEnvelopeImpl), 0);
+    if (impl == NULL) {
+        LOGE("Failed to allocate envelope object.");
+        return HCF_ERR_MALLOC;
+    }
+    if (strcpy_s(impl->algoName, HCF_MAX_ALGO_NAME_LEN, algoName) != EOK) {
+        LOGE("Failed to copy algoName");
+        HcfFree(impl);
+        return HCF_INVALID_PARAMS;
+    }
+    HcfEnvelopeSpi *spiObj = NULL;
+    HcfResult res = createSpiFunc(algoName, &spiObj);
+    if (res != HCF_SUCCESS) {
+        LOGE("Failed to create envelope spi object");
+        HcfFree(impl);
+        return res;
+    }
+    impl->base.base.getClass = GetEnvelopeClass;
+    impl->base.base.destroy = DestroyEnvelope;
+    impl->base.seal = Seal;
+    impl->base.open = Open;
+    impl->base.getAlgoName = GetAlgoName;
+    impl->spiObj = spiObj;
+    *returnObj = (HcfEnvelope *)impl;
+    return HCF_SUCCESS;
+}
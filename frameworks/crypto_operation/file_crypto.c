@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "file_crypto.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <securec.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "log.h"
+#include "memory.h"
+
+#define HCF_FILE_MAP_WINDOW_SIZE (64 * 1024 * 1024)
+#define HCF_FILE_READ_BUFFER_SIZE (1024 * 1024)
+// Bounds the output each cipher update allocates.
+#define HCF_FILE_CIPHER_CHUNK_SIZE (4 * 1024 * 1024)
+
+typedef HcfResult (*HcfFileChunkFunc)(void *obj, HcfBlob *chunk, int outFd);
+
+typedef struct {
+    HcfFileChunkFunc func;
+    void *obj;
+    int outFd;
+    size_t maxChunkLen;
+} HcfFileSink;
+
+static HcfResult FeedChunks(const HcfFileSink *sink, const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        size_t chunkLen = (len < sink->maxChunkLen) ? len : sink->maxChunkLen;
+        HcfBlob chunk = { .data = (uint8_t *)data, .len = chunkLen };
+        HcfResult res = sink->func(sink->obj, &chunk, sink->outFd);
+        if (res != HCF_SUCCESS) {
+            return res;
+        }
+        data += chunkLen;
+        len -= chunkLen;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult ReadStream(int fd, const HcfFileSink *sink, uint64_t offset, uint64_t length, bool isPositioned)
+{
+    uint8_t *buffer = (uint8_t *)HcfMalloc(HCF_FILE_READ_BUFFER_SIZE, 0);
+    if (buffer == NULL) {
+        LOGE("Failed to allocate read buffer.");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult res = HCF_SUCCESS;
+    uint64_t done = 0;
+    while ((length == 0) || (done < length)) {
+        size_t want = HCF_FILE_READ_BUFFER_SIZE;
+        if ((length != 0) && (length - done < want)) {
+            want = (size_t)(length - done);
+        }
+        ssize_t got = isPositioned ? pread(fd, buffer, want, (off_t)(offset + done)) : read(fd, buffer, want);
+        if ((got < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (got < 0) {
+            LOGE("Failed to read file, errno: %{public}d.", errno);
+            res = HCF_ERR_CRYPTO_OPERATION;
+            break;
+        }
+        if (got == 0) {
+            if ((length != 0) && (done < length)) {
+                LOGE("File ended before the requested length.");
+                res = HCF_INVALID_PARAMS;
+            }
+            break;
+        }
+        res = FeedChunks(sink, buffer, (size_t)got);
+        if (res != HCF_SUCCESS) {
+            break;
+        }
+        done += (uint64_t)got;
+    }
+    (void)memset_s(buffer, HCF_FILE_READ_BUFFER_SIZE, 0, HCF_FILE_READ_BUFFER_SIZE);
+    HcfFree(buffer);
+    return res;
+}
+
+/* Maps [offset, end) window by window. On a failed first mapping the rest is read instead. */
+static HcfResult MapRegularFile(int fd, const HcfFileSink *sink, uint64_t offset, uint64_t end)
+{
+    long pageSize = sysconf(_SC_PAGESIZE);
+    uint64_t pageMask = (pageSize > 0) ? (uint64_t)(pageSize - 1) : 0;
+    uint64_t pos = offset;
+    while (pos < end) {
+        uint64_t mapStart = pos & ~pageMask;
+        size_t mapLen = (end - mapStart < HCF_FILE_MAP_WINDOW_SIZE) ? (size_t)(end - mapStart) :
+            HCF_FILE_MAP_WINDOW_SIZE;
+        void *addr = mmap(NULL, mapLen, PROT_READ, MAP_PRIVATE, fd, (off_t)mapStart);
+        if (addr == MAP_FAILED) {
+            LOGD("Failed to map file, read it instead.");
+            (void)posix_fadvise(fd, (off_t)pos, (off_t)(end - pos), POSIX_FADV_SEQUENTIAL);
+            return ReadStream(fd, sink, pos, end - pos, true);
+        }
+        (void)madvise(addr, mapLen, MADV_SEQUENTIAL);
+        size_t skip = (size_t)(pos - mapStart);
+        HcfResult res = FeedChunks(sink, (const uint8_t *)addr + skip, mapLen - skip);
+        (void)munmap(addr, mapLen);
+        if (res != HCF_SUCCESS) {
+            return res;
+        }
+        pos = mapStart + mapLen;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult ProcessFd(int fd, uint64_t offset, uint64_t length, const HcfFileSink *sink)
+{
+    struct stat st;
+    if ((fd < 0) || (fstat(fd, &st) != 0)) {
+        LOGE("Invalid file descriptor.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        if (offset != 0) {
+            LOGE("Offset is not supported on streams.");
+            return HCF_INVALID_PARAMS;
+        }
+        return ReadStream(fd, sink, 0, length, false);
+    }
+    uint64_t size = (uint64_t)st.st_size;
+    if ((offset > size) || (length > size - offset)) {
+        LOGE("Range exceeds the file size.");
+        return HCF_INVALID_PARAMS;
+    }
+    uint64_t end = (length == 0) ? size : offset + length;
+    return MapRegularFile(fd, sink, offset, end);
+}
+
+static HcfResult MdChunk(void *obj, HcfBlob *chunk, int outFd)
+{
+    (void)outFd;
+    HcfMd *md = (HcfMd *)obj;
+    return md->update(md, chunk);
+}
+
+static HcfResult MacChunk(void *obj, HcfBlob *chunk, int outFd)
+{
+    (void)outFd;
+    HcfMac *mac = (HcfMac *)obj;
+    return mac->update(mac, chunk);
+}
+
+static HcfResult WriteAll(int fd, const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        ssize_t written = write(fd, data, len);
+        if ((written < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (written <= 0) {
+            LOGE("Failed to write file, errno: %{public}d.", errno);
+            return HCF_ERR_CRYPTO_OPERATION;
+        }
+        data += written;
+        len -= (size_t)written;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult CipherChunk(void *obj, HcfBlob *chunk, int outFd)
+{
+    HcfCipher *cipher = (HcfCipher *)obj;
+    HcfBlob output = { .data = NULL, .len = 0 };
+    HcfResult res = cipher->update(cipher, chunk, &output);
+    if (res != HCF_SUCCESS) {
+        LOGE("Cipher update failed.");
+        return res;
+    }
+    if ((output.data != NULL) && (output.len > 0)) {
+        res = WriteAll(outFd, output.data, output.len);
+    }
+    HcfBlobDataClearAndFree(&output);
+    return res;
+}
+
+HcfResult HcfMdUpdateFd(HcfMd *md, int fd, uint64_t offset, uint64_t length)
+{
+    if ((md == NULL) || (md->update == NULL)) {
+        LOGE("Invalid md object.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfFileSink sink = { .func = MdChunk, .obj = md, .outFd = -1, .maxChunkLen = HCF_FILE_MAP_WINDOW_SIZE };
+    return ProcessFd(fd, offset, length, &sink);
+}
+
+HcfResult HcfMacUpdateFd(HcfMac *mac, int fd, uint64_t offset, uint64_t length)
+{
+    if ((mac == NULL) || (mac->update == NULL)) {
+        LOGE("Invalid mac object.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfFileSink sink = { .func = MacChunk, .obj = mac, .outFd = -1, .maxChunkLen = HCF_FILE_MAP_WINDOW_SIZE };
+    return ProcessFd(fd, offset, length, &sink);
+}
+
+HcfResult HcfCipherUpdateFd(HcfCipher *cipher, int inFd, uint64_t offset, uint64_t length, int outFd)
+{
+    if ((cipher == NULL) || (cipher->update == NULL) || (outFd < 0)) {
+        LOGE("Invalid cipher object or output fd.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfFileSink sink = { .func = CipherChunk, .obj = cipher, .outFd = outFd,
+        .maxChunkLen = HCF_FILE_CIPHER_CHUNK_SIZE };
+    return ProcessFd(inFd, offset, length, &sink);
+}
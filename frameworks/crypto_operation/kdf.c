@@ -22,10 +22,14 @@
 #include "kdf_spi.h"
 #include "log.h"
 #include "params_parser.h"
+#ifdef CRYPTO_MBEDTLS
+#include "mbedtls_kdf.h"
+#else
 #include "pbkdf2_openssl.h"
 #include "hkdf_openssl.h"
 #include "scrypt_openssl.h"
 #include "x963kdf_openssl.h"
+#endif
 #include "utils.h"
 
 typedef HcfResult (*HcfKdfSpiCreateFunc)(HcfKdfDeriveParams *, HcfKdfSpi **);
@@ -100,10 +104,15 @@ static HcfResult ParseKdfParams(const HcfParaConfig *config, void *params)
 }
 
 static const HcfKdfGenAbility KDF_ABILITY_SET[] = {
+#ifdef CRYPTO_MBEDTLS
+    { HCF_ALG_PKBDF2, MbedtlsPbkdf2SpiCreate },
+    { HCF_ALG_HKDF, MbedtlsHkdfSpiCreate },
+#else
     { HCF_ALG_PKBDF2, HcfKdfPBKDF2SpiCreate },
     { HCF_ALG_HKDF, HcfKdfHkdfSpiCreate},
     { HCF_ALG_SCRYPT, HcfKdfScryptSpiCreate },
     { HCF_ALG_X963KDF, HcfKdfX963SpiCreate },
+#endif
 };
 
 static HcfKdfSpiCreateFunc FindAbility(HcfKdfDeriveParams* params)
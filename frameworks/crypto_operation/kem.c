@@ -16,6 +16,7 @@
 #include "kem.h"
 
 #include <securec.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "config.h"
@@ -97,6 +98,90 @@ static HcfResult Decapsulate(HcfKem *self, HcfPriKey *priKey, const HcfBlob *wra
         returnSharedSecret);
 }
 
+static HcfResult GetOutputLen(HcfKem *self, uint32_t *sharedSecretLen, uint32_t *wrappedKeyLen)
+{
+    if (self == NULL || sharedSecretLen == NULL || wrappedKeyLen == NULL) {
+        LOGE("Self, sharedSecretLen or wrappedKeyLen is null");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetKemClass())) {
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return ((HcfKemImpl *)self)->spiObj->engineGetOutputLen(((HcfKemImpl *)self)->spiObj, sharedSecretLen,
+        wrappedKeyLen);
+}
+
+static bool IsBatchBlobValid(const HcfBlob *blob, uint32_t count, uint32_t unitLen)
+{
+    if (!HcfIsBlobValid(blob) || unitLen == 0 || count > SIZE_MAX / unitLen) {
+        return false;
+    }
+    return blob->len == (size_t)count * unitLen;
+}
+
+static HcfResult CheckBatchParams(HcfKem *self, uint32_t count, uint32_t workerNum,
+    uint32_t *sharedSecretLen, uint32_t *wrappedKeyLen)
+{
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetKemClass())) {
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (count == 0 || workerNum > HCF_KEM_MAX_BATCH_WORKER_NUM) {
+        LOGE("Invalid batch count or worker num");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return GetOutputLen(self, sharedSecretLen, wrappedKeyLen);
+}
+
+static HcfResult EncapsulateBatch(HcfKem *self, HcfPubKey **pubKeys, uint32_t count, uint32_t workerNum,
+    HcfBlob *sharedSecrets, HcfBlob *wrappedKeys)
+{
+    if (self == NULL || pubKeys == NULL || sharedSecrets == NULL || wrappedKeys == NULL) {
+        LOGE("Self, pubKeys, sharedSecrets or wrappedKeys is null");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    HcfResult res = CheckBatchParams(self, count, workerNum, &sharedSecretLen, &wrappedKeyLen);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    if (!IsBatchBlobValid(sharedSecrets, count, sharedSecretLen) ||
+        !IsBatchBlobValid(wrappedKeys, count, wrappedKeyLen)) {
+        LOGE("Output buffers do not match the batch count");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (pubKeys[i] == NULL) {
+            LOGE("PubKey %{public}u is null", i);
+            return HCF_ERR_PARAMETER_CHECK_FAILED;
+        }
+    }
+    return ((HcfKemImpl *)self)->spiObj->engineEncapsulateBatch(((HcfKemImpl *)self)->spiObj, pubKeys, count,
+        workerNum, sharedSecrets, wrappedKeys);
+}
+
+static HcfResult DecapsulateBatch(HcfKem *self, HcfPriKey *priKey, const HcfBlob *wrappedKeys, uint32_t count,
+    uint32_t workerNum, HcfBlob *sharedSecrets)
+{
+    if (self == NULL || priKey == NULL || wrappedKeys == NULL || sharedSecrets == NULL) {
+        LOGE("Self, priKey, wrappedKeys or sharedSecrets is null");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    HcfResult res = CheckBatchParams(self, count, workerNum, &sharedSecretLen, &wrappedKeyLen);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    if (!IsBatchBlobValid(wrappedKeys, count, wrappedKeyLen) ||
+        !IsBatchBlobValid(sharedSecrets, count, sharedSecretLen)) {
+        LOGE("Batch buffers do not match the batch count");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return ((HcfKemImpl *)self)->spiObj->engineDecapsulateBatch(((HcfKemImpl *)self)->spiObj, priKey, wrappedKeys,
+        count, workerNum, sharedSecrets);
+}
+
 static void DestroyKem(HcfObjectBase *self)
 {
     if (self == NULL) {
@@ -147,6 +232,9 @@ HcfResult HcfKemCreate(const char *algoName, HcfKem **returnObj)
     impl->base.base.destroy = DestroyKem;
     impl->base.encapsulate = Encapsulate;
     impl->base.decapsulate = Decapsulate;
+    impl->base.getOutputLen = GetOutputLen;
+    impl->base.encapsulateBatch = EncapsulateBatch;
+    impl->base.decapsulateBatch = DecapsulateBatch;
     impl->spiObj = spiObj;
     *returnObj = (HcfKem *)impl;
     return HCF_SUCCESS;
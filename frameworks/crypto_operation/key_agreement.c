@@ -181,6 +181,24 @@ static HcfResult GenerateSecret(HcfKeyAgreement *self, HcfPriKey *priKey,
         ((HcfKeyAgreementImpl *)self)->spiObj, priKey, pubKey, returnSecret);
 }
 
+static HcfResult DeriveKey(HcfKeyAgreement *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetKeyAgreementClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    HcfKeyAgreementSpi *spiObj = ((HcfKeyAgreementImpl *)self)->spiObj;
+    if (spiObj->engineDeriveKey == NULL) {
+        LOGE("DeriveKey is not supported by the algo.");
+        return HCF_NOT_SUPPORT;
+    }
+    return spiObj->engineDeriveKey(spiObj, priKey, pubKey, spec, returnKey);
+}
+
 static void DestroyKeyAgreement(HcfObjectBase *self)
 {
     if (self == NULL) {
@@ -237,6 +255,7 @@ HcfResult HcfKeyAgreementCreate(const char *algoName, HcfKeyAgreement **returnOb
     returnGenerator->base.base.getClass = GetKeyAgreementClass;
     returnGenerator->base.generateSecret = GenerateSecret;
     returnGenerator->base.getAlgoName = GetAlgoName;
+    returnGenerator->base.deriveKey = DeriveKey;
     returnGenerator->spiObj = spiObj;
 
     *returnObj = (HcfKeyAgreement *)returnGenerator;
@@ -18,7 +18,11 @@
 #include <securec.h>
 
 #include "mac_spi.h"
+#ifdef CRYPTO_MBEDTLS
+#include "mbedtls_hmac.h"
+#else
 #include "mac_openssl.h"
+#endif
 #include "detailed_hmac_params.h"
 #include "detailed_cmac_params.h"
 
@@ -44,6 +48,14 @@ typedef struct {
 } HcfHmacAbility;
 
 static const HcfHmacAbility HMAC_ABILITY_SET[] = {
+#ifdef CRYPTO_MBEDTLS
+    { "SHA1", MbedtlsHmacSpiCreate },
+    { "SHA224", MbedtlsHmacSpiCreate },
+    { "SHA256", MbedtlsHmacSpiCreate },
+    { "SHA384", MbedtlsHmacSpiCreate },
+    { "SHA512", MbedtlsHmacSpiCreate },
+    { "MD5", MbedtlsHmacSpiCreate },
+#else
     { "SHA1", OpensslHmacSpiCreate },
     { "SHA224", OpensslHmacSpiCreate },
     { "SHA256", OpensslHmacSpiCreate },
@@ -54,6 +66,7 @@ static const HcfHmacAbility HMAC_ABILITY_SET[] = {
     { "SHA3-512", OpensslHmacSpiCreate },
     { "SM3", OpensslHmacSpiCreate },
     { "MD5", OpensslHmacSpiCreate },
+#endif
 };
 
 static const char *GetMacClass(void)
@@ -183,8 +196,14 @@ static HcfResult HandleCmacAlgo(HcfMacImpl *macImpl, const HcfMacParamsSpec *par
         LOGE("Unsupported cipher name: %{public}s, only support AES128 and AES256.", cipherName);
         return HCF_INVALID_PARAMS;
     }
+#ifdef CRYPTO_MBEDTLS
+    (void)macImpl;
+    LOGE("CMAC is not supported by the mbedtls plugin.");
+    return HCF_NOT_SUPPORT;
+#else
     *createSpiFunc = OpensslCmacSpiCreate;
     return SetMacAlgoName(macImpl, paramsSpec->algName);
+#endif
 }
 
 static HcfResult HandleHmacAlgo(HcfMacImpl *macImpl, const HcfMacParamsSpec *paramsSpec,
@@ -49,7 +49,9 @@ typedef struct {
 static const HcfMdAbility MD_ABILITY_SET[] = {
 #ifdef CRYPTO_MBEDTLS
     { "SHA1", MbedtlsMdSpiCreate },
+    { "SHA224", MbedtlsMdSpiCreate },
     { "SHA256", MbedtlsMdSpiCreate },
+    { "SHA384", MbedtlsMdSpiCreate },
     { "SHA512", MbedtlsMdSpiCreate },
     { "MD5", MbedtlsMdSpiCreate },
 #else
@@ -477,6 +477,54 @@ static HcfResult SignDoFinal(HcfSign *self, HcfBlob *data, HcfBlob *returnSignat
     return ((HcfSignImpl *)self)->spiObj->engineSign(((HcfSignImpl *)self)->spiObj, data, returnSignatureData);
 }
 
+static HcfResult SignReset(HcfSign *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetSignClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpi *signSpiObj = ((HcfSignImpl *)self)->spiObj;
+    if (signSpiObj->engineReset == NULL) {
+        LOGE("Not support reset operation.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    return signSpiObj->engineReset(signSpiObj);
+}
+
+static HcfResult SignBatch(HcfSign *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob *returnSignatures)
+{
+    if ((self == NULL) || (inputs == NULL) || (returnArena == NULL) || (returnSignatures == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetSignClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((count == 0) || (workerNum > HCF_SIGN_MAX_BATCH_WORKER_NUM)) {
+        LOGE("Invalid batch count or worker num.");
+        return HCF_INVALID_PARAMS;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!HcfIsBlobValid(&inputs[i])) {
+            LOGE("Input %{public}u is invalid.", i);
+            return HCF_INVALID_PARAMS;
+        }
+    }
+    HcfSignSpi *signSpiObj = ((HcfSignImpl *)self)->spiObj;
+    if (signSpiObj->engineSignBatch == NULL) {
+        LOGE("Not support sign batch operation.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    (void)memset_s(returnSignatures, sizeof(HcfBlob) * count, 0, sizeof(HcfBlob) * count);
+    return signSpiObj->engineSignBatch(signSpiObj, inputs, count, workerNum, returnArena, returnSignatures);
+}
+
 static HcfResult SetVerifySpecInt(HcfVerify *self, SignSpecItem item, int32_t saltLen)
 {
     if (self == NULL) {
@@ -614,6 +662,25 @@ static HcfResult VerifyRecover(HcfVerify *self, HcfBlob *signatureData, HcfBlob
     return verifySpiObj->engineRecover(verifySpiObj, signatureData, rawSignatureData);
 }
 
+static HcfResult VerifyReset(HcfVerify *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetVerifyClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpi *verifySpiObj = ((HcfVerifyImpl *)self)->spiObj;
+    if (verifySpiObj->engineReset == NULL) {
+        LOGE("Not support reset operation.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    HcfClearPluginErrorMessage();
+    return verifySpiObj->engineReset(verifySpiObj);
+}
+
 HcfResult HcfSignCreate(const char *algoName, HcfSign **returnObj)
 {
     LOGD("HcfSignCreate start");
@@ -663,6 +730,8 @@ HcfResult HcfSignCreate(const char *algoName, HcfSign **returnObj)
     returnSign->base.getSignSpecString = GetSignSpecString;
     returnSign->base.setSignSpecUint8Array = SetSignSpecUint8Array;
     returnSign->base.setSignSpecBool = SetSignSpecBool;
+    returnSign->base.reset = SignReset;
+    returnSign->base.signBatch = SignBatch;
     returnSign->spiObj = spiObj;
 
     *returnObj = (HcfSign *)returnSign;
@@ -718,6 +787,7 @@ HcfResult HcfVerifyCreate(const char *algoName, HcfVerify **returnObj)
     returnVerify->base.getVerifySpecString = GetVerifySpecString;
     returnVerify->base.setVerifySpecUint8Array = SetVerifySpecUint8Array;
     returnVerify->base.setVerifySpecBool = SetVerifySpecBool;
+    returnVerify->base.reset = VerifyReset;
     returnVerify->spiObj = spiObj;
     *returnObj = (HcfVerify *)returnVerify;
     LOGD("HcfVerifyCreate end");
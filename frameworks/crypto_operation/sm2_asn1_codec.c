@@ -0,0 +1,434 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sm2_asn1_codec.h"
+
+#include <limits.h>
+#include <securec.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "log.h"
+
+#define ASN1_TAG_INTEGER 0x02
+#define ASN1_TAG_OCTET_STRING 0x04
+#define ASN1_TAG_SEQUENCE 0x30
+#define ASN1_LONG_LEN_FLAG 0x80
+#define ASN1_MAX_LEN_BYTES 4
+#define ASN1_SIGN_BIT 0x80
+#define SM2_POINT_UNCOMPRESSED 0x04
+#define SM2_RAW_C1_LEN (1 + 2 * HCF_SM2_COORDINATE_LEN)
+#define BITS_PER_BYTE 8
+
+typedef enum {
+    SM2_RAW_C1C3C2 = 0,
+    SM2_RAW_C1C2C3,
+} Sm2RawLayout;
+
+typedef HcfResult (*Sm2ConvertFunc)(const HcfBlob *input, Sm2RawLayout layout, HcfBlob *output);
+
+static bool GetRawLayout(const char *mode, Sm2RawLayout *layout)
+{
+    // mode default C1C3C2
+    if ((mode == NULL) || (mode[0] == '\0') || (strcmp(mode, "C1C3C2") == 0)) {
+        *layout = SM2_RAW_C1C3C2;
+        return true;
+    }
+    if (strcmp(mode, "C1C2C3") == 0) {
+        *layout = SM2_RAW_C1C2C3;
+        return true;
+    }
+    LOGE("Invalid param mode");
+    return false;
+}
+
+static bool IsInputValid(const HcfBlob *input)
+{
+    return (input != NULL) && (input->data != NULL) && (input->len != 0);
+}
+
+static HcfResult ReadTlv(const uint8_t **cur, const uint8_t *end, uint8_t tag, HcfBlob *content)
+{
+    const uint8_t *p = *cur;
+    if ((end - p < 2) || (p[0] != tag)) {
+        LOGE("Unexpected asn1 tag.");
+        return HCF_INVALID_PARAMS;
+    }
+    p++;
+    size_t len = *p++;
+    if ((len & ASN1_LONG_LEN_FLAG) != 0) {
+        size_t lenBytes = len & ~ASN1_LONG_LEN_FLAG;
+        // DER forbids the indefinite form and long forms that fit in fewer bytes.
+        if ((lenBytes == 0) || (lenBytes > ASN1_MAX_LEN_BYTES) || ((size_t)(end - p) < lenBytes) || (p[0] == 0)) {
+            LOGE("Invalid asn1 length.");
+            return HCF_INVALID_PARAMS;
+        }
+        len = 0;
+        for (size_t i = 0; i < lenBytes; i++) {
+            len = (len << BITS_PER_BYTE) | *p++;
+        }
+        if (len < ASN1_LONG_LEN_FLAG) {
+            LOGE("Invalid asn1 length.");
+            return HCF_INVALID_PARAMS;
+        }
+    }
+    if ((size_t)(end - p) < len) {
+        LOGE("Asn1 length exceeds the input.");
+        return HCF_INVALID_PARAMS;
+    }
+    content->data = (uint8_t *)p;
+    content->len = len;
+    *cur = p + len;
+    return HCF_SUCCESS;
+}
+
+static HcfResult ReadUnsignedInteger(const uint8_t **cur, const uint8_t *end, HcfBlob *magnitude)
+{
+    HcfBlob content = { .data = NULL, .len = 0 };
+    HcfResult res = ReadTlv(cur, end, ASN1_TAG_INTEGER, &content);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    if ((content.len == 0) || ((content.data[0] & ASN1_SIGN_BIT) != 0)) {
+        LOGE("Invalid asn1 integer.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (content.data[0] == 0) {
+        if ((content.len > 1) && ((content.data[1] & ASN1_SIGN_BIT) == 0)) {
+            LOGE("Asn1 integer is not minimal.");
+            return HCF_INVALID_PARAMS;
+        }
+        content.data++;
+        content.len--;
+    }
+    if (content.len > HCF_SM2_COORDINATE_LEN) {
+        LOGE("Asn1 integer is too long.");
+        return HCF_INVALID_PARAMS;
+    }
+    *magnitude = content;
+    return HCF_SUCCESS;
+}
+
+static size_t GetTlvLen(size_t contentLen)
+{
+    size_t lenBytes = 0;
+    if (contentLen >= ASN1_LONG_LEN_FLAG) {
+        for (size_t len = contentLen; len != 0; len >>= BITS_PER_BYTE) {
+            lenBytes++;
+        }
+    }
+    return 1 + 1 + lenBytes + contentLen;
+}
+
+static uint8_t *WriteTlvHeader(uint8_t *p, uint8_t tag, size_t contentLen)
+{
+    *p++ = tag;
+    if (contentLen < ASN1_LONG_LEN_FLAG) {
+        *p++ = (uint8_t)contentLen;
+        return p;
+    }
+    size_t lenBytes = GetTlvLen(contentLen) - contentLen - 2;
+    *p++ = (uint8_t)(ASN1_LONG_LEN_FLAG | lenBytes);
+    for (size_t i = lenBytes; i > 0; i--) {
+        *p++ = (uint8_t)(contentLen >> ((i - 1) * BITS_PER_BYTE));
+    }
+    return p;
+}
+
+/* Trims the fixed length big endian value to the content of a DER INTEGER, without the leading zero byte. */
+static HcfBlob TrimFixedInteger(const uint8_t *value, size_t len, size_t *contentLen)
+{
+    HcfBlob magnitude = { .data = (uint8_t *)value, .len = len };
+    while ((magnitude.len > 0) && (magnitude.data[0] == 0)) {
+        magnitude.data++;
+        magnitude.len--;
+    }
+    *contentLen = ((magnitude.len == 0) || ((magnitude.data[0] & ASN1_SIGN_BIT) != 0)) ? magnitude.len + 1 :
+        magnitude.len;
+    return magnitude;
+}
+
+static uint8_t *WriteInteger(uint8_t *p, const HcfBlob *magnitude, size_t contentLen)
+{
+    p = WriteTlvHeader(p, ASN1_TAG_INTEGER, contentLen);
+    if (contentLen > magnitude->len) {
+        *p++ = 0;
+    }
+    if (magnitude->len > 0) {
+        (void)memcpy_s(p, magnitude->len, magnitude->data, magnitude->len);
+    }
+    return p + magnitude->len;
+}
+
+/* Writes the magnitude right aligned in a fixed length big endian field. */
+static uint8_t *WriteFixedInteger(uint8_t *p, const HcfBlob *magnitude, size_t len)
+{
+    size_t padLen = len - magnitude->len;
+    (void)memset_s(p, len, 0, padLen);
+    if (magnitude->len > 0) {
+        (void)memcpy_s(p + padLen, magnitude->len, magnitude->data, magnitude->len);
+    }
+    return p + len;
+}
+
+static HcfResult CheckOutput(HcfBlob *output, size_t needLen)
+{
+    if (output->data == NULL) {
+        output->len = needLen;
+        return HCF_SUCCESS;
+    }
+    if (output->len < needLen) {
+        LOGE("Output buffer is too small.");
+        return HCF_INVALID_PARAMS;
+    }
+    return HCF_SUCCESS;
+}
+
+HcfResult HcfSm2CipherTextParseAsn1(const HcfBlob *input, Sm2CipherTextView *view)
+{
+    if (!IsInputValid(input) || (view == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    const uint8_t *cur = input->data;
+    const uint8_t *end = input->data + input->len;
+    HcfBlob seq = { .data = NULL, .len = 0 };
+    HcfResult res = ReadTlv(&cur, end, ASN1_TAG_SEQUENCE, &seq);
+    if ((res != HCF_SUCCESS) || (cur != end)) {
+        LOGE("Invalid SM2 ciphertext sequence.");
+        return HCF_INVALID_PARAMS;
+    }
+    cur = seq.data;
+    end = seq.data + seq.len;
+    Sm2CipherTextView tmp;
+    if ((ReadUnsignedInteger(&cur, end, &tmp.xCoordinate) != HCF_SUCCESS) ||
+        (ReadUnsignedInteger(&cur, end, &tmp.yCoordinate) != HCF_SUCCESS) ||
+        (ReadTlv(&cur, end, ASN1_TAG_OCTET_STRING, &tmp.hashData) != HCF_SUCCESS) ||
+        (ReadTlv(&cur, end, ASN1_TAG_OCTET_STRING, &tmp.cipherTextData) != HCF_SUCCESS) || (cur != end)) {
+        LOGE("Invalid SM2 ciphertext fields.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((tmp.hashData.len != HCF_SM2_C3_DATA_LEN) || (tmp.cipherTextData.len == 0) ||
+        (tmp.cipherTextData.len > INT_MAX)) {
+        LOGE("Invalid SM2 ciphertext hash or cipher length.");
+        return HCF_INVALID_PARAMS;
+    }
+    *view = tmp;
+    return HCF_SUCCESS;
+}
+
+static HcfResult CipherTextAsn1ToRaw(const HcfBlob *input, Sm2RawLayout layout, HcfBlob *output)
+{
+    Sm2CipherTextView view;
+    HcfResult res = HcfSm2CipherTextParseAsn1(input, &view);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    size_t needLen = SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + view.cipherTextData.len;
+    res = CheckOutput(output, needLen);
+    if ((res != HCF_SUCCESS) || (output->data == NULL)) {
+        return res;
+    }
+    uint8_t *p = output->data;
+    *p++ = SM2_POINT_UNCOMPRESSED;
+    p = WriteFixedInteger(p, &view.xCoordinate, HCF_SM2_COORDINATE_LEN);
+    p = WriteFixedInteger(p, &view.yCoordinate, HCF_SM2_COORDINATE_LEN);
+    const HcfBlob *first = (layout == SM2_RAW_C1C3C2) ? &view.hashData : &view.cipherTextData;
+    const HcfBlob *second = (layout == SM2_RAW_C1C3C2) ? &view.cipherTextData : &view.hashData;
+    (void)memcpy_s(p, first->len, first->data, first->len);
+    p += first->len;
+    (void)memcpy_s(p, second->len, second->data, second->len);
+    output->len = needLen;
+    return HCF_SUCCESS;
+}
+
+static HcfResult CipherTextRawToAsn1(const HcfBlob *input, Sm2RawLayout layout, HcfBlob *output)
+{
+    if (!IsInputValid(input) || (input->len <= SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN) ||
+        (input->data[0] != SM2_POINT_UNCOMPRESSED)) {
+        LOGE("Invalid raw SM2 ciphertext.");
+        return HCF_INVALID_PARAMS;
+    }
+    size_t c2Len = input->len - SM2_RAW_C1_LEN - HCF_SM2_C3_DATA_LEN;
+    if (c2Len > INT_MAX) {
+        LOGE("Invalid raw SM2 ciphertext length.");
+        return HCF_INVALID_PARAMS;
+    }
+    const uint8_t *body = input->data + SM2_RAW_C1_LEN;
+    const uint8_t *c3 = (layout == SM2_RAW_C1C3C2) ? body : body + c2Len;
+    const uint8_t *c2 = (layout == SM2_RAW_C1C3C2) ? body + HCF_SM2_C3_DATA_LEN : body;
+    size_t xLen = 0;
+    size_t yLen = 0;
+    HcfBlob x = TrimFixedInteger(input->data + 1, HCF_SM2_COORDINATE_LEN, &xLen);
+    HcfBlob y = TrimFixedInteger(input->data + 1 + HCF_SM2_COORDINATE_LEN, HCF_SM2_COORDINATE_LEN, &yLen);
+    size_t seqLen = GetTlvLen(xLen) + GetTlvLen(yLen) + GetTlvLen(HCF_SM2_C3_DATA_LEN) + GetTlvLen(c2Len);
+    size_t needLen = GetTlvLen(seqLen);
+    HcfResult res = CheckOutput(output, needLen);
+    if ((res != HCF_SUCCESS) || (output->data == NULL)) {
+        return res;
+    }
+    uint8_t *p = WriteTlvHeader(output->data, ASN1_TAG_SEQUENCE, seqLen);
+    p = WriteInteger(p, &x, xLen);
+    p = WriteInteger(p, &y, yLen);
+    p = WriteTlvHeader(p, ASN1_TAG_OCTET_STRING, HCF_SM2_C3_DATA_LEN);
+    (void)memcpy_s(p, HCF_SM2_C3_DATA_LEN, c3, HCF_SM2_C3_DATA_LEN);
+    p = WriteTlvHeader(p + HCF_SM2_C3_DATA_LEN, ASN1_TAG_OCTET_STRING, c2Len);
+    (void)memcpy_s(p, c2Len, c2, c2Len);
+    output->len = needLen;
+    return HCF_SUCCESS;
+}
+
+static HcfResult SignatureDerToRaw(const HcfBlob *input, Sm2RawLayout layout, HcfBlob *output)
+{
+    (void)layout;
+    if (!IsInputValid(input)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    const uint8_t *cur = input->data;
+    const uint8_t *end = input->data + input->len;
+    HcfBlob seq = { .data = NULL, .len = 0 };
+    HcfBlob r = { .data = NULL, .len = 0 };
+    HcfBlob s = { .data = NULL, .len = 0 };
+    if ((ReadTlv(&cur, end, ASN1_TAG_SEQUENCE, &seq) != HCF_SUCCESS) || (cur != end)) {
+        LOGE("Invalid SM2 signature sequence.");
+        return HCF_INVALID_PARAMS;
+    }
+    cur = seq.data;
+    end = seq.data + seq.len;
+    if ((ReadUnsignedInteger(&cur, end, &r) != HCF_SUCCESS) || (ReadUnsignedInteger(&cur, end, &s) != HCF_SUCCESS) ||
+        (cur != end)) {
+        LOGE("Invalid SM2 signature fields.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfResult res = CheckOutput(output, HCF_SM2_RAW_SIGNATURE_LEN);
+    if ((res != HCF_SUCCESS) || (output->data == NULL)) {
+        return res;
+    }
+    uint8_t *p = WriteFixedInteger(output->data, &r, HCF_SM2_COORDINATE_LEN);
+    (void)WriteFixedInteger(p, &s, HCF_SM2_COORDINATE_LEN);
+    output->len = HCF_SM2_RAW_SIGNATURE_LEN;
+    return HCF_SUCCESS;
+}
+
+static HcfResult SignatureRawToDer(const HcfBlob *input, Sm2RawLayout layout, HcfBlob *output)
+{
+    (void)layout;
+    if (!IsInputValid(input) || (input->len != HCF_SM2_RAW_SIGNATURE_LEN)) {
+        LOGE("Invalid raw SM2 signature.");
+        return HCF_INVALID_PARAMS;
+    }
+    size_t rLen = 0;
+    size_t sLen = 0;
+    HcfBlob r = TrimFixedInteger(input->data, HCF_SM2_COORDINATE_LEN, &rLen);
+    HcfBlob s = TrimFixedInteger(input->data + HCF_SM2_COORDINATE_LEN, HCF_SM2_COORDINATE_LEN, &sLen);
+    size_t seqLen = GetTlvLen(rLen) + GetTlvLen(sLen);
+    size_t needLen = GetTlvLen(seqLen);
+    HcfResult res = CheckOutput(output, needLen);
+    if ((res != HCF_SUCCESS) || (output->data == NULL)) {
+        return res;
+    }
+    uint8_t *p = WriteTlvHeader(output->data, ASN1_TAG_SEQUENCE, seqLen);
+    p = WriteInteger(p, &r, rLen);
+    (void)WriteInteger(p, &s, sLen);
+    output->len = needLen;
+    return HCF_SUCCESS;
+}
+
+static HcfResult Convert(Sm2ConvertFunc func, const HcfBlob *input, const char *mode, HcfBlob *output)
+{
+    Sm2RawLayout layout = SM2_RAW_C1C3C2;
+    if ((output == NULL) || !GetRawLayout(mode, &layout)) {
+        LOGE("Invalid output or mode.");
+        return HCF_INVALID_PARAMS;
+    }
+    return func(input, layout, output);
+}
+
+/*
+ * With an arena each item is converted straight into the space left in it. The size query converts into NULL
+ * outputs, which only parses the inputs.
+ */
+static HcfResult ConvertBatch(Sm2ConvertFunc func, const HcfBlob *inputs, uint32_t count, const char *mode,
+    HcfBlob *arena, HcfBlob *outputs)
+{
+    Sm2RawLayout layout = SM2_RAW_C1C3C2;
+    if ((inputs == NULL) || (count == 0) || (arena == NULL) || (outputs == NULL) || !GetRawLayout(mode, &layout)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    size_t offset = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        outputs[i].data = (arena->data == NULL) ? NULL : arena->data + offset;
+        outputs[i].len = (arena->data == NULL) ? 0 : arena->len - offset;
+        HcfResult res = func(&inputs[i], layout, &outputs[i]);
+        if ((res != HCF_SUCCESS) || (outputs[i].len > SIZE_MAX - offset)) {
+            LOGE("Failed to convert item %{public}u.", i);
+            if (arena->data != NULL) {
+                (void)memset_s(arena->data, arena->len, 0, offset);
+            }
+            (void)memset_s(outputs, sizeof(HcfBlob) * count, 0, sizeof(HcfBlob) * count);
+            return (res != HCF_SUCCESS) ? res : HCF_INVALID_PARAMS;
+        }
+        offset += outputs[i].len;
+    }
+    if (arena->data == NULL) {
+        (void)memset_s(outputs, sizeof(HcfBlob) * count, 0, sizeof(HcfBlob) * count);
+    }
+    arena->len = offset;
+    return HCF_SUCCESS;
+}
+
+HcfResult HcfSm2CipherTextAsn1ToRaw(const HcfBlob *input, const char *mode, HcfBlob *output)
+{
+    return Convert(CipherTextAsn1ToRaw, input, mode, output);
+}
+
+HcfResult HcfSm2CipherTextRawToAsn1(const HcfBlob *input, const char *mode, HcfBlob *output)
+{
+    return Convert(CipherTextRawToAsn1, input, mode, output);
+}
+
+HcfResult HcfSm2SignatureDerToRaw(const HcfBlob *input, HcfBlob *output)
+{
+    return Convert(SignatureDerToRaw, input, NULL, output);
+}
+
+HcfResult HcfSm2SignatureRawToDer(const HcfBlob *input, HcfBlob *output)
+{
+    return Convert(SignatureRawToDer, input, NULL, output);
+}
+
+HcfResult HcfSm2CipherTextAsn1ToRawBatch(const HcfBlob *inputs, uint32_t count, const char *mode, HcfBlob *arena,
+    HcfBlob *outputs)
+{
+    return ConvertBatch(CipherTextAsn1ToRaw, inputs, count, mode, arena, outputs);
+}
+
+HcfResult HcfSm2CipherTextRawToAsn1Batch(const HcfBlob *inputs, uint32_t count, const char *mode, HcfBlob *arena,
+    HcfBlob *outputs)
+{
+    return ConvertBatch(CipherTextRawToAsn1, inputs, count, mode, arena, outputs);
+}
+
+HcfResult HcfSm2SignatureDerToRawBatch(const HcfBlob *inputs, uint32_t count, HcfBlob *arena, HcfBlob *outputs)
+{
+    return ConvertBatch(SignatureDerToRaw, inputs, count, NULL, arena, outputs);
+}
+
+HcfResult HcfSm2SignatureRawToDerBatch(const HcfBlob *inputs, uint32_t count, HcfBlob *arena, HcfBlob *outputs)
+{
+    return ConvertBatch(SignatureRawToDer, inputs, count, NULL, arena, outputs);
+}
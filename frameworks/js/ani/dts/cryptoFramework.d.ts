@@ -122,6 +122,8 @@ declare namespace cryptoFramework {
     generateKeyPair(callback: AsyncCallback<KeyPair>): void;
     generateKeyPair(): Promise<KeyPair>;
     generateKeyPairSync(): KeyPair;
+    generateKeyPairs(count: int, workerNum?: int): Promise<KeyPair[]>;
+    generateKeyPairsSync(count: int, workerNum?: int): KeyPair[];
     convertKey(pubKey: DataBlob | null, priKey: DataBlob | null, callback: AsyncCallback<KeyPair>): void;
     convertKey(pubKey: DataBlob | null, priKey: DataBlob | null): Promise<KeyPair>;
     convertKeySync(pubKey: DataBlob | null, priKey: DataBlob | null): KeyPair;
@@ -168,6 +170,8 @@ declare namespace cryptoFramework {
     doFinal(): Promise<DataBlob>;
     doFinalSync(): DataBlob;
     getMacLength(): int;
+    updateFd(fd: int, offset?: long, length?: long): Promise<void>;
+    updateFdSync(fd: int, offset?: long, length?: long): void;
     readonly algName: string;
   }
   function createMac(algName: string): Mac;
@@ -181,6 +185,8 @@ declare namespace cryptoFramework {
     digest(): Promise<DataBlob>;
     digestSync(): DataBlob;
     getMdLength(): int;
+    updateFd(fd: int, offset?: long, length?: long): Promise<void>;
+    updateFdSync(fd: int, offset?: long, length?: long): void;
     readonly algName: string;
   }
   function createMd(algName: string): Md;
@@ -202,7 +208,8 @@ declare namespace cryptoFramework {
     SM2_USER_ID_UINT8ARR = 105,
     ML_DSA_DETERMINISTIC_BOOL = 106,
     ML_DSA_MU_BOOL = 107,
-    ML_DSA_CONTEXT_UINT8ARR = 108
+    ML_DSA_CONTEXT_UINT8ARR = 108,
+    SIGN_PREHASH_BOOL = 109
   }
 
   interface Cipher {
@@ -215,6 +222,8 @@ declare namespace cryptoFramework {
     doFinal(data: DataBlob | null, callback: AsyncCallback<DataBlob | null>): void;
     doFinal(data: DataBlob | null): Promise<DataBlob | null>;
     doFinalSync(data: DataBlob | null): DataBlob | null;
+    updateFd(inFd: int, outFd: int, offset?: long, length?: long): Promise<void>;
+    updateFdSync(inFd: int, outFd: int, offset?: long, length?: long): void;
     setCipherSpec(itemType: CipherSpecItem, itemValue: Uint8Array): void;
     getCipherSpec(itemType: CipherSpecItem): string | Uint8Array;
     readonly algName: string;
@@ -234,6 +243,9 @@ declare namespace cryptoFramework {
     setSignSpec(itemType: SignSpecItem, itemValue: int | Uint8Array): void;
     setSignSpec(itemType: SignSpecItem, itemValue: boolean): void;
     getSignSpec(itemType: SignSpecItem): string | int;
+    reset(): void;
+    signBatch(data: DataBlob[], workerNum?: int): Promise<DataBlob[]>;
+    signBatchSync(data: DataBlob[], workerNum?: int): DataBlob[];
     readonly algName: string;
   }
 
@@ -252,6 +264,7 @@ declare namespace cryptoFramework {
     setVerifySpec(itemType: SignSpecItem, itemValue: int | Uint8Array): void;
     setVerifySpec(itemType: SignSpecItem, itemValue: boolean): void;
     getVerifySpec(itemType: SignSpecItem): string | int;
+    reset(): void;
     readonly algName: string;
   }
   function createSign(algName: string): Sign;
@@ -541,11 +554,20 @@ declare namespace cryptoFramework {
     wrappedKey: Uint8Array;
   }
 
+  interface KemBatchEncapResult {
+    sharedSecrets: Uint8Array;
+    wrappedKeys: Uint8Array;
+  }
+
   interface Kem {
     encapsulate(pubKey: PubKey, ikme: Uint8Array | null): Promise<KemEncapResult>;
     encapsulateSync(pubKey: PubKey, ikme: Uint8Array | null): KemEncapResult;
     decapsulate(priKey: PriKey, wrappedKey: Uint8Array): Promise<Uint8Array>;
     decapsulateSync(priKey: PriKey, wrappedKey: Uint8Array): Uint8Array;
+    encapsulateBatch(pubKeys: PubKey[], workerNum?: int): Promise<KemBatchEncapResult>;
+    encapsulateBatchSync(pubKeys: PubKey[], workerNum?: int): KemBatchEncapResult;
+    decapsulateBatch(priKey: PriKey, wrappedKeys: Uint8Array, workerNum?: int): Promise<Uint8Array>;
+    decapsulateBatchSync(priKey: PriKey, wrappedKeys: Uint8Array, workerNum?: int): Uint8Array;
   }
   function createKem(algNameId: KemAlgNameId): Kem;
 }
@@ -27,6 +27,7 @@ public:
     ~AsyKeyGeneratorImpl();
 
     KeyPair GenerateKeyPairSync();
+    array<KeyPair> GenerateKeyPairsSync(int32_t count, optional_view<int32_t> workerNum);
     KeyPair ConvertKeySync(OptDataBlob const& pubKey, OptDataBlob const& priKey);
     KeyPair ConvertPemKeySync(OptString const& pubKey, OptString const& priKey);
     KeyPair ConvertPemKeySyncEx(OptString const& pubKey, OptString const& priKey, string_view password);
@@ -29,6 +29,7 @@ public:
     void InitSync(CryptoMode opMode, weak::Key key, OptParamsSpec const& params);
     OptDataBlob UpdateSync(DataBlob const& input);
     OptDataBlob DoFinalSync(OptDataBlob const& input);
+    void UpdateFdSync(int32_t inFd, int32_t outFd, optional_view<int64_t> offset, optional_view<int64_t> length);
     void SetCipherSpec(ThCipherSpecItem itemType, array_view<uint8_t> itemValue);
     OptStrUint8Arr GetCipherSpec(ThCipherSpecItem itemType);
     string GetAlgName();
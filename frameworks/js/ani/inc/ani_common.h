@@ -72,6 +72,9 @@ void StringToDataBlob(const string &str, HcfBlob &blob);
 
 int GetAsyKeySpecType(HcfAsyKeySpecItem item);
 int GetSignSpecType(HcfSignSpecItem item);
+
+bool GetFileRange(optional_view<int64_t> offset, optional_view<int64_t> length, uint64_t &rangeOffset,
+    uint64_t &rangeLength);
 } // namespace ANI::CryptoFramework
 
 #endif // ANI_COMMON_H
@@ -28,6 +28,9 @@ public:
 
     KemEncapResult EncapsulateSync(weak::PubKey pubKey, OptUint8Arr const& ikme);
     array<uint8_t> DecapsulateSync(weak::PriKey priKey, array_view<uint8_t> wrappedKey);
+    KemBatchEncapResult EncapsulateBatchSync(array_view<PubKey> pubKeys, optional_view<int32_t> workerNum);
+    array<uint8_t> DecapsulateBatchSync(weak::PriKey priKey, array_view<uint8_t> wrappedKeys,
+        optional_view<int32_t> workerNum);
 
 private:
     HcfKem *kem_ = nullptr;
@@ -30,6 +30,7 @@ public:
     void UpdateSync(DataBlob const& input);
     DataBlob DoFinalSync();
     int32_t GetMacLength();
+    void UpdateFdSync(int32_t fd, optional_view<int64_t> offset, optional_view<int64_t> length);
     string GetAlgName();
 
 private:
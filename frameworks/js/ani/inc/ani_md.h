@@ -29,6 +29,7 @@ public:
     void UpdateSync(DataBlob const& input);
     DataBlob DigestSync();
     int32_t GetMdLength();
+    void UpdateFdSync(int32_t fd, optional_view<int64_t> offset, optional_view<int64_t> length);
     string GetAlgName();
 
 private:
@@ -32,6 +32,8 @@ public:
     void SetSignSpec(ThSignSpecItem itemType, OptIntUint8Arr const& itemValue);
     void SetSignSpecBoolean(ThSignSpecItem itemType, bool itemValue);
     OptStrInt GetSignSpec(ThSignSpecItem itemType);
+    void Reset();
+    array<DataBlob> SignBatchSync(array_view<DataBlob> data, optional_view<int32_t> workerNum);
     string GetAlgName();
 
 private:
@@ -33,6 +33,7 @@ public:
     void SetVerifySpec(ThSignSpecItem itemType, OptIntUint8Arr const& itemValue);
     void SetVerifySpecBoolean(ThSignSpecItem itemType, bool itemValue);
     OptStrInt GetVerifySpec(ThSignSpecItem itemType);
+    void Reset();
     string GetAlgName();
 
 private:
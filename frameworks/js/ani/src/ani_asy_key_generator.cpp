@@ -16,6 +16,8 @@
 #include "ani_asy_key_generator.h"
 #include "ani_key_pair.h"
 
+#include <vector>
+
 namespace {
 using namespace ANI::CryptoFramework;
 
@@ -75,6 +77,36 @@ KeyPair AsyKeyGeneratorImpl::GenerateKeyPairSync()
     return make_holder<KeyPairImpl, KeyPair>(keyPair);
 }
 
+array<KeyPair> AsyKeyGeneratorImpl::GenerateKeyPairsSync(int32_t count, optional_view<int32_t> workerNum)
+{
+    HistogramScopeGuard guard(API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS_SYNC);
+    if (this->generator_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "generator obj is nullptr!");
+        return {};
+    }
+    int32_t num = workerNum.has_value() ? workerNum.value() : 0;
+    if (count <= 0 || num < 0 || num > HCF_ASY_KEY_GEN_MAX_BATCH_WORKER_NUM) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        ANI_LOGE_THROW(HCF_ERR_PARAMETER_CHECK_FAILED, "invalid count or workerNum.");
+        return {};
+    }
+    std::vector<HcfKeyPair *> keyPairs(count, nullptr);
+    HcfResult res = this->generator_->generateKeyPairs(this->generator_, static_cast<uint32_t>(count),
+        static_cast<uint32_t>(num), keyPairs.data());
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "generate key pairs fail.");
+        return {};
+    }
+    std::vector<KeyPair> out;
+    out.reserve(keyPairs.size());
+    for (HcfKeyPair *keyPair : keyPairs) {
+        out.push_back(make_holder<KeyPairImpl, KeyPair>(keyPair));
+    }
+    return array<KeyPair>(move_data_t{}, out.data(), out.size());
+}
+
 KeyPair AsyKeyGeneratorImpl::ConvertKeySync(OptDataBlob const& pubKey, OptDataBlob const& priKey)
 {
     HistogramScopeGuard guard(API_ASY_KEY_GENERATOR_CONVERT_KEY_SYNC);
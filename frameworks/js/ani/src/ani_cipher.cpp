@@ -14,6 +14,7 @@
  */
 
 #include "ani_cipher.h"
+#include "file_crypto.h"
 #include "detailed_iv_params.h"
 #include "detailed_gcm_params.h"
 #include "detailed_ccm_params.h"
@@ -258,6 +259,29 @@ OptDataBlob CipherImpl::DoFinalSync(OptDataBlob const& input)
     return OptDataBlob::make_DATABLOB(DataBlob({ data }));
 }
 
+void CipherImpl::UpdateFdSync(int32_t inFd, int32_t outFd, optional_view<int64_t> offset, optional_view<int64_t> length)
+{
+    HistogramScopeGuard guard(API_CIPHER_UPDATE_FD_SYNC);
+    if (this->cipher_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "cipher obj is nullptr!");
+        return;
+    }
+    uint64_t rangeOffset = 0;
+    uint64_t rangeLength = 0;
+    if (!GetFileRange(offset, length, rangeOffset, rangeLength)) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        ANI_LOGE_THROW(HCF_ERR_PARAMETER_CHECK_FAILED, "invalid offset or length.");
+        return;
+    }
+    HcfResult res = HcfCipherUpdateFd(this->cipher_, inFd, rangeOffset, rangeLength, outFd);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "cipher update fd failed!");
+        return;
+    }
+}
+
 void CipherImpl::SetCipherSpec(ThCipherSpecItem itemType, array_view<uint8_t> itemValue)
 {
     HistogramScopeGuard guard(API_CIPHER_SET_CIPHER_SPEC);
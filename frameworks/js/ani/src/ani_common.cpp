@@ -84,6 +84,7 @@ static const std::unordered_map<HcfSignSpecItem, int> SIGN_SPEC_RELATION_MAP = {
     { ML_DSA_DETERMINISTIC_BOOL, SPEC_ITEM_TYPE_BOOL },
     { ML_DSA_MU_BOOL, SPEC_ITEM_TYPE_BOOL },
     { ML_DSA_CONTEXT_UINT8ARR, SPEC_ITEM_TYPE_UINT8ARR },
+    { SIGN_PREHASH_BOOL, SPEC_ITEM_TYPE_BOOL },
 };
 } // namespace
 
@@ -167,4 +168,17 @@ int GetSignSpecType(HcfSignSpecItem item)
     }
     return -1;
 }
+
+bool GetFileRange(optional_view<int64_t> offset, optional_view<int64_t> length, uint64_t &rangeOffset,
+    uint64_t &rangeLength)
+{
+    int64_t offsetValue = offset.has_value() ? offset.value() : 0;
+    int64_t lengthValue = length.has_value() ? length.value() : 0;
+    if (offsetValue < 0 || lengthValue < 0) {
+        return false;
+    }
+    rangeOffset = static_cast<uint64_t>(offsetValue);
+    rangeLength = static_cast<uint64_t>(lengthValue);
+    return true;
+}
 } // namespace ANI::CryptoFramework
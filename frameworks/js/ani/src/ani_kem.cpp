@@ -17,6 +17,29 @@
 
 namespace {
 using namespace ANI::CryptoFramework;
+
+HcfResult GetBatchWorkerNum(optional_view<int32_t> workerNum, uint32_t &num)
+{
+    int32_t value = workerNum.has_value() ? workerNum.value() : 0;
+    if (value < 0 || value > HCF_KEM_MAX_BATCH_WORKER_NUM) {
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    num = static_cast<uint32_t>(value);
+    return HCF_SUCCESS;
+}
+
+HcfResult AllocBatchBlob(uint32_t count, uint32_t unitLen, HcfBlob &blob)
+{
+    if (unitLen == 0 || count > SIZE_MAX / unitLen) {
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    blob.data = static_cast<uint8_t *>(HcfMalloc(static_cast<size_t>(count) * unitLen, 0));
+    if (blob.data == nullptr) {
+        return HCF_ERR_MALLOC;
+    }
+    blob.len = static_cast<size_t>(count) * unitLen;
+    return HCF_SUCCESS;
+}
 } // namespace
 
 namespace ANI::CryptoFramework {
@@ -86,6 +109,107 @@ array<uint8_t> KemImpl::DecapsulateSync(weak::PriKey priKey, array_view<uint8_t>
     return secretData;
 }
 
+KemBatchEncapResult KemImpl::EncapsulateBatchSync(array_view<PubKey> pubKeys, optional_view<int32_t> workerNum)
+{
+    HistogramScopeGuard guard(API_KEM_ENCAPSULATE_BATCH_SYNC);
+    if (this->kem_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "kem obj is nullptr!");
+        return {};
+    }
+    uint32_t num = 0;
+    if (pubKeys.size() == 0 || pubKeys.size() > UINT32_MAX || GetBatchWorkerNum(workerNum, num) != HCF_SUCCESS) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        ANI_LOGE_THROW(HCF_ERR_PARAMETER_CHECK_FAILED, "invalid pubKeys or workerNum.");
+        return {};
+    }
+    uint32_t count = static_cast<uint32_t>(pubKeys.size());
+    HcfPubKey **hcfPubKeys = static_cast<HcfPubKey **>(HcfMalloc(sizeof(HcfPubKey *) * count, 0));
+    if (hcfPubKeys == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        ANI_LOGE_THROW(HCF_ERR_MALLOC, "malloc pubKeys failed.");
+        return {};
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        hcfPubKeys[i] = reinterpret_cast<HcfPubKey *>(pubKeys[i]->GetPubKeyObj());
+    }
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    HcfBlob sharedSecrets = {};
+    HcfBlob wrappedKeys = {};
+    HcfResult res = this->kem_->getOutputLen(this->kem_, &sharedSecretLen, &wrappedKeyLen);
+    if (res == HCF_SUCCESS) {
+        res = AllocBatchBlob(count, sharedSecretLen, sharedSecrets);
+    }
+    if (res == HCF_SUCCESS) {
+        res = AllocBatchBlob(count, wrappedKeyLen, wrappedKeys);
+    }
+    if (res == HCF_SUCCESS) {
+        res = this->kem_->encapsulateBatch(this->kem_, hcfPubKeys, count, num, &sharedSecrets, &wrappedKeys);
+    }
+    HcfFree(hcfPubKeys);
+    if (res != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(&sharedSecrets);
+        HcfBlobDataClearAndFree(&wrappedKeys);
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "kem encapsulate batch failed.");
+        return {};
+    }
+    array<uint8_t> secretsData = {};
+    array<uint8_t> wrappedData = {};
+    DataBlobToArrayU8(sharedSecrets, secretsData);
+    DataBlobToArrayU8(wrappedKeys, wrappedData);
+    HcfBlobDataClearAndFree(&sharedSecrets);
+    HcfBlobDataClearAndFree(&wrappedKeys);
+    return { secretsData, wrappedData };
+}
+
+array<uint8_t> KemImpl::DecapsulateBatchSync(weak::PriKey priKey, array_view<uint8_t> wrappedKeys,
+    optional_view<int32_t> workerNum)
+{
+    HistogramScopeGuard guard(API_KEM_DECAPSULATE_BATCH_SYNC);
+    if (this->kem_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "kem obj is nullptr!");
+        return {};
+    }
+    uint32_t num = 0;
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    HcfResult res = GetBatchWorkerNum(workerNum, num);
+    if (res == HCF_SUCCESS) {
+        res = this->kem_->getOutputLen(this->kem_, &sharedSecretLen, &wrappedKeyLen);
+    }
+    if (res == HCF_SUCCESS && (wrappedKeys.size() == 0 || wrappedKeys.size() % wrappedKeyLen != 0 ||
+        wrappedKeys.size() / wrappedKeyLen > UINT32_MAX)) {
+        res = HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "invalid wrappedKeys or workerNum.");
+        return {};
+    }
+    uint32_t count = static_cast<uint32_t>(wrappedKeys.size() / wrappedKeyLen);
+    HcfPriKey *hcfPriKey = reinterpret_cast<HcfPriKey *>(priKey->GetPriKeyObj());
+    HcfBlob wrappedKeysBlob = {};
+    ArrayU8ToDataBlob(wrappedKeys, wrappedKeysBlob);
+    HcfBlob sharedSecrets = {};
+    res = AllocBatchBlob(count, sharedSecretLen, sharedSecrets);
+    if (res == HCF_SUCCESS) {
+        res = this->kem_->decapsulateBatch(this->kem_, hcfPriKey, &wrappedKeysBlob, count, num, &sharedSecrets);
+    }
+    if (res != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(&sharedSecrets);
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "kem decapsulate batch failed.");
+        return {};
+    }
+    array<uint8_t> secretsData = {};
+    DataBlobToArrayU8(sharedSecrets, secretsData);
+    HcfBlobDataClearAndFree(&sharedSecrets);
+    return secretsData;
+}
+
 static const char *GetKemAlgoNameById(KemAlgNameId algId)
 {
     HcfKemAlgNameId id = static_cast<HcfKemAlgNameId>(algId.get_value());
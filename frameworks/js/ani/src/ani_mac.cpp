@@ -14,6 +14,7 @@
  */
 
 #include "ani_mac.h"
+#include "file_crypto.h"
 #include "detailed_hmac_params.h"
 #include "detailed_cmac_params.h"
 
@@ -115,6 +116,29 @@ int32_t MacImpl::GetMacLength()
     return static_cast<int32_t>(length);
 }
 
+void MacImpl::UpdateFdSync(int32_t fd, optional_view<int64_t> offset, optional_view<int64_t> length)
+{
+    HistogramScopeGuard guard(API_MAC_UPDATE_FD_SYNC);
+    if (this->mac_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "mac obj is nullptr!");
+        return;
+    }
+    uint64_t rangeOffset = 0;
+    uint64_t rangeLength = 0;
+    if (!GetFileRange(offset, length, rangeOffset, rangeLength)) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        ANI_LOGE_THROW(HCF_ERR_PARAMETER_CHECK_FAILED, "invalid offset or length.");
+        return;
+    }
+    HcfResult res = HcfMacUpdateFd(this->mac_, fd, rangeOffset, rangeLength);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "mac update fd failed!");
+        return;
+    }
+}
+
 string MacImpl::GetAlgName()
 {
     if (this->mac_ == nullptr) {
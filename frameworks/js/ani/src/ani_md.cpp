@@ -14,6 +14,7 @@
  */
 
 #include "ani_md.h"
+#include "file_crypto.h"
 
 namespace ANI::CryptoFramework {
 MdImpl::MdImpl() {}
@@ -77,6 +78,29 @@ int32_t MdImpl::GetMdLength()
     return static_cast<int32_t>(length);
 }
 
+void MdImpl::UpdateFdSync(int32_t fd, optional_view<int64_t> offset, optional_view<int64_t> length)
+{
+    HistogramScopeGuard guard(API_MD_UPDATE_FD_SYNC);
+    if (this->md_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "md obj is nullptr!");
+        return;
+    }
+    uint64_t rangeOffset = 0;
+    uint64_t rangeLength = 0;
+    if (!GetFileRange(offset, length, rangeOffset, rangeLength)) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        ANI_LOGE_THROW(HCF_ERR_PARAMETER_CHECK_FAILED, "invalid offset or length.");
+        return;
+    }
+    HcfResult res = HcfMdUpdateFd(this->md_, fd, rangeOffset, rangeLength);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "md update fd failed!");
+        return;
+    }
+}
+
 string MdImpl::GetAlgName()
 {
     if (this->md_ == nullptr) {
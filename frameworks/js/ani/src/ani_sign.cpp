@@ -15,6 +15,8 @@
 
 #include "ani_sign.h"
 
+#include <vector>
+
 namespace {
 using namespace ANI::CryptoFramework;
 
@@ -180,7 +182,7 @@ void SignImpl::SetSignSpecBoolean(ThSignSpecItem itemType, bool itemValue)
         return;
     }
     HcfSignSpecItem item = static_cast<HcfSignSpecItem>(itemType.get_value());
-    if (item == ML_DSA_DETERMINISTIC_BOOL || item == ML_DSA_MU_BOOL) {
+    if (item == ML_DSA_DETERMINISTIC_BOOL || item == ML_DSA_MU_BOOL || item == SIGN_PREHASH_BOOL) {
         return SetSignSpecBool(this->sign_, item, itemValue, guard);
     } else {
         guard.SetErrorCode(HCF_INVALID_PARAMS);
@@ -214,6 +216,58 @@ OptStrInt SignImpl::GetSignSpec(ThSignSpecItem itemType)
     }
 }
 
+void SignImpl::Reset()
+{
+    HistogramScopeGuard guard(API_SIGN_RESET);
+    if (this->sign_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "sign obj is nullptr!");
+        return;
+    }
+    HcfResult res = this->sign_->reset(this->sign_);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "sign reset fail.");
+        return;
+    }
+}
+
+array<DataBlob> SignImpl::SignBatchSync(array_view<DataBlob> data, optional_view<int32_t> workerNum)
+{
+    HistogramScopeGuard guard(API_SIGN_SIGN_BATCH_SYNC);
+    if (this->sign_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "sign obj is nullptr!");
+        return {};
+    }
+    int32_t num = workerNum.has_value() ? workerNum.value() : 0;
+    if (data.size() == 0 || data.size() > UINT32_MAX || num < 0 || num > HCF_SIGN_MAX_BATCH_WORKER_NUM) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        ANI_LOGE_THROW(HCF_ERR_PARAMETER_CHECK_FAILED, "invalid data or workerNum.");
+        return {};
+    }
+    uint32_t count = static_cast<uint32_t>(data.size());
+    std::vector<HcfBlob> inputs(count);
+    for (uint32_t i = 0; i < count; i++) {
+        ArrayU8ToDataBlob(data[i].data, inputs[i]);
+    }
+    std::vector<HcfBlob> signatures(count);
+    HcfBlob arena = {};
+    HcfResult res = this->sign_->signBatch(this->sign_, inputs.data(), count, static_cast<uint32_t>(num), &arena,
+        signatures.data());
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "sign batch failed!");
+        return {};
+    }
+    std::vector<DataBlob> out(count);
+    for (uint32_t i = 0; i < count; i++) {
+        DataBlobToArrayU8(signatures[i], out[i].data);
+    }
+    HcfBlobDataFree(&arena);
+    return array<DataBlob>(move_data_t{}, out.data(), out.size());
+}
+
 string SignImpl::GetAlgName()
 {
     if (this->sign_ == nullptr) {
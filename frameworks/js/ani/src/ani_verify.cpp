@@ -206,7 +206,7 @@ void VerifyImpl::SetVerifySpecBoolean(ThSignSpecItem itemType, bool itemValue)
         return;
     }
     HcfSignSpecItem item = static_cast<HcfSignSpecItem>(itemType.get_value());
-    if (item == ML_DSA_DETERMINISTIC_BOOL || item == ML_DSA_MU_BOOL) {
+    if (item == ML_DSA_DETERMINISTIC_BOOL || item == ML_DSA_MU_BOOL || item == SIGN_PREHASH_BOOL) {
         return SetVerifySpecBool(this->verify_, item, itemValue, guard);
     } else {
         guard.SetErrorCode(HCF_INVALID_PARAMS);
@@ -240,6 +240,22 @@ OptStrInt VerifyImpl::GetVerifySpec(ThSignSpecItem itemType)
     }
 }
 
+void VerifyImpl::Reset()
+{
+    HistogramScopeGuard guard(API_VERIFY_RESET);
+    if (this->verify_ == nullptr) {
+        guard.SetErrorCode(HCF_ERR_ANI);
+        ANI_LOGE_THROW(HCF_ERR_ANI, "verify obj is nullptr!");
+        return;
+    }
+    HcfResult res = this->verify_->reset(this->verify_);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        ANI_LOGE_THROW(res, "verify reset fail.");
+        return;
+    }
+}
+
 string VerifyImpl::GetAlgName()
 {
     if (this->verify_ == nullptr) {
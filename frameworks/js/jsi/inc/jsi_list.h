@@ -16,22 +16,17 @@
 #ifndef JSI_LIST_H
 #define JSI_LIST_H
 
-#include "los_list.h"
 #include "jsi_api_common.h"
+#include "jsi_obj_table.h"
 
 namespace OHOS {
 namespace ACELite {
 
 typedef struct {
     LiteAlgType type;
-    LOS_DL_LIST *objListHeader;
+    ObjTable *objTable;
 } ListInfo;
 
-typedef struct {
-    LOS_DL_LIST listNode;
-    uint32_t objAddr;
-} ObjList;
-
 void ListObjInit(LiteAlgType type);
 HcfResult ListAddObjNode(LiteAlgType type, uint32_t addAddr);
 void ListDeleteObjNode(LiteAlgType type, uint32_t deleteAddr);
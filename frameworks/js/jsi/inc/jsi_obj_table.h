@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JSI_OBJ_TABLE_H
+#define JSI_OBJ_TABLE_H
+
+#include <stdint.h>
+#include "result.h"
+
+namespace OHOS {
+namespace ACELite {
+
+#ifndef JSI_OBJ_TABLE_BITS
+#define JSI_OBJ_TABLE_BITS 8
+#endif
+#define JSI_OBJ_TABLE_CAPACITY (1U << JSI_OBJ_TABLE_BITS)
+/* Three quarters of the slots at most, which keeps the linear probes short. */
+#define JSI_OBJ_TABLE_MAX_COUNT (JSI_OBJ_TABLE_CAPACITY - JSI_OBJ_TABLE_CAPACITY / 4)
+
+/*
+ * Fixed capacity open addressing set of live object addresses with linear probing, 0 marks an empty slot.
+ * Deleting shifts the following entries of the probe run back instead of leaving tombstones, so add, find and
+ * delete take O(1) on average at any fill level up to JSI_OBJ_TABLE_MAX_COUNT.
+ */
+typedef struct {
+    uint32_t slots[JSI_OBJ_TABLE_CAPACITY];
+    uint32_t count;
+} ObjTable;
+
+typedef void (*ObjTableVisitFunc)(uint32_t addr);
+
+void ObjTableInit(ObjTable *table);
+HcfResult ObjTableAdd(ObjTable *table, uint32_t addr);
+bool ObjTableFind(const ObjTable *table, uint32_t addr);
+bool ObjTableDelete(ObjTable *table, uint32_t addr);
+uint32_t ObjTableCount(const ObjTable *table);
+/* Empties the table and passes every address that was in it to func. */
+void ObjTableClear(ObjTable *table, ObjTableVisitFunc func);
+
+}  // namespace ACELite
+}  // namespace OHOS
+
+#endif // JSI_OBJ_TABLE_H
@@ -14,91 +14,58 @@
  */
 
 #include "jsi_list.h"
-#include "memory.h"
 
-static LOS_DL_LIST g_mdObjListHeader = { .pstPrev = nullptr, .pstNext = nullptr };
-static LOS_DL_LIST g_randObjListHeader = { .pstPrev = nullptr, .pstNext = nullptr };
+static OHOS::ACELite::ObjTable g_mdObjTable;
+static OHOS::ACELite::ObjTable g_randObjTable;
 
 namespace OHOS {
 namespace ACELite {
 
 ListInfo g_listMap[] = {
-    { JSI_ALG_MD, &g_mdObjListHeader },
-    { JSI_ALG_RAND, &g_randObjListHeader }
+    { JSI_ALG_MD, &g_mdObjTable },
+    { JSI_ALG_RAND, &g_randObjTable }
 };
 
-LOS_DL_LIST *GetListHeader(LiteAlgType type)
+ObjTable *GetObjTable(LiteAlgType type)
 {
     for (uint32_t index = 0; index < sizeof(g_listMap) / sizeof(g_listMap[0]); index++) {
         if (type == g_listMap[index].type) {
-            return g_listMap[index].objListHeader;
+            return g_listMap[index].objTable;
         }
     }
 
     return nullptr;
 }
 
+static void DestroyObj(uint32_t addr)
+{
+    HcfObjDestroy(reinterpret_cast<void *>(addr));
+}
+
 void ListObjInit(LiteAlgType type)
 {
-    LOS_ListInit(GetListHeader(type));
+    ObjTableInit(GetObjTable(type));
 }
 
 HcfResult ListAddObjNode(LiteAlgType type, uint32_t addAddr)
 {
-    if (GetListHeader(type) == nullptr) {
+    ObjTable *table = GetObjTable(type);
+    if (table == nullptr) {
         return HCF_INVALID_PARAMS;
     }
-    ObjList *obj = static_cast<ObjList *>(HcfMalloc(sizeof(ObjList), 0));
-    if (obj == nullptr) {
-        return HCF_ERR_MALLOC;
-    }
-    obj->objAddr = addAddr;
-
-    if (GetListHeader(type)->pstNext == nullptr) {
-        LOS_ListInit(GetListHeader(type));
-    }
-    LOS_ListAdd(GetListHeader(type), &(obj->listNode));
-
-    return HCF_SUCCESS;
+    return ObjTableAdd(table, addAddr);
 }
 
 void ListDeleteObjNode(LiteAlgType type, uint32_t deleteAddr)
 {
-    ObjList *obj = nullptr;
-    ObjList *objNext = nullptr;
-    if (GetListHeader(type) == nullptr) {
-        return;
-    }
-    LOS_DL_LIST_FOR_EACH_ENTRY_SAFE(obj, objNext, GetListHeader(type), ObjList, listNode) {
-        if (obj == nullptr) {
-            return;
-        }
-        if ((obj->objAddr != 0) && (obj->objAddr == deleteAddr)) {
-            LOS_ListDelete(&(obj->listNode));
-            HcfObjDestroy(reinterpret_cast<void *>(deleteAddr));
-            obj->objAddr = 0;
-            HcfFree(obj);
-            obj = nullptr;
-        }
+    if (ObjTableDelete(GetObjTable(type), deleteAddr)) {
+        HcfObjDestroy(reinterpret_cast<void *>(deleteAddr));
     }
 }
 
 void ListDestroy(LiteAlgType type)
 {
-    ObjList *obj = nullptr;
-    ObjList *objNext = nullptr;
-    if (GetListHeader(type) == nullptr) {
-        return;
-    }
-    LOS_DL_LIST_FOR_EACH_ENTRY_SAFE(obj, objNext, GetListHeader(type), ObjList, listNode) {
-        if (obj == nullptr) {
-            return;
-        }
-        LOS_ListDelete(&(obj->listNode));
-        HcfObjDestroy(reinterpret_cast<void *>(obj->objAddr));
-        HcfFree(obj);
-        obj = nullptr;
-    }
+    ObjTableClear(GetObjTable(type), DestroyObj);
 }
 
 }  // ACELite
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jsi_obj_table.h"
+
+#include "securec.h"
+
+namespace OHOS {
+namespace ACELite {
+
+#define OBJ_TABLE_MASK (JSI_OBJ_TABLE_CAPACITY - 1)
+#define OBJ_HASH_MULTIPLIER 2654435761U
+#define OBJ_HASH_BITS 32
+
+static inline uint32_t HomeSlot(uint32_t addr)
+{
+    return static_cast<uint32_t>(addr * OBJ_HASH_MULTIPLIER) >> (OBJ_HASH_BITS - JSI_OBJ_TABLE_BITS);
+}
+
+/* Returns the slot holding addr, or the empty slot ending its probe run. */
+static uint32_t ProbeSlot(const ObjTable *table, uint32_t addr)
+{
+    uint32_t index = HomeSlot(addr);
+    while ((table->slots[index] != 0) && (table->slots[index] != addr)) {
+        index = (index + 1) & OBJ_TABLE_MASK;
+    }
+    return index;
+}
+
+void ObjTableInit(ObjTable *table)
+{
+    if (table == nullptr) {
+        return;
+    }
+    (void)memset_s(table, sizeof(ObjTable), 0, sizeof(ObjTable));
+}
+
+HcfResult ObjTableAdd(ObjTable *table, uint32_t addr)
+{
+    if ((table == nullptr) || (addr == 0)) {
+        return HCF_INVALID_PARAMS;
+    }
+    if (table->count >= JSI_OBJ_TABLE_MAX_COUNT) {
+        return HCF_ERR_MALLOC;
+    }
+    uint32_t index = ProbeSlot(table, addr);
+    if (table->slots[index] == addr) {
+        return HCF_INVALID_PARAMS;
+    }
+    table->slots[index] = addr;
+    table->count++;
+    return HCF_SUCCESS;
+}
+
+bool ObjTableFind(const ObjTable *table, uint32_t addr)
+{
+    if ((table == nullptr) || (addr == 0)) {
+        return false;
+    }
+    return table->slots[ProbeSlot(table, addr)] == addr;
+}
+
+bool ObjTableDelete(ObjTable *table, uint32_t addr)
+{
+    if ((table == nullptr) || (addr == 0)) {
+        return false;
+    }
+    uint32_t hole = ProbeSlot(table, addr);
+    if (table->slots[hole] != addr) {
+        return false;
+    }
+    table->slots[hole] = 0;
+    table->count--;
+    uint32_t next = (hole + 1) & OBJ_TABLE_MASK;
+    while (table->slots[next] != 0) {
+        /* An entry may fill the hole unless its home slot lies cyclically after the hole up to next. */
+        uint32_t home = HomeSlot(table->slots[next]);
+        if (((next - home) & OBJ_TABLE_MASK) >= ((next - hole) & OBJ_TABLE_MASK)) {
+            table->slots[hole] = table->slots[next];
+            table->slots[next] = 0;
+            hole = next;
+        }
+        next = (next + 1) & OBJ_TABLE_MASK;
+    }
+    return true;
+}
+
+uint32_t ObjTableCount(const ObjTable *table)
+{
+    return (table == nullptr) ? 0 : table->count;
+}
+
+void ObjTableClear(ObjTable *table, ObjTableVisitFunc func)
+{
+    if (table == nullptr) {
+        return;
+    }
+    for (uint32_t index = 0; index < JSI_OBJ_TABLE_CAPACITY; index++) {
+        uint32_t addr = table->slots[index];
+        table->slots[index] = 0;
+        if ((addr != 0) && (func != nullptr)) {
+            func(addr);
+        }
+    }
+    table->count = 0;
+}
+
+}  // namespace ACELite
+}  // namespace OHOS
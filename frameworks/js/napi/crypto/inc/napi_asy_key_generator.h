@@ -37,6 +37,8 @@ public:
 
     static napi_value JsGenerateKeyPair(napi_env env, napi_callback_info info);
     static napi_value JsGenerateKeyPairSync(napi_env env, napi_callback_info info);
+    static napi_value JsGenerateKeyPairs(napi_env env, napi_callback_info info);
+    static napi_value JsGenerateKeyPairsSync(napi_env env, napi_callback_info info);
     static napi_value JsConvertKey(napi_env env, napi_callback_info info);
     static napi_value JsConvertKeySync(napi_env env, napi_callback_info info);
     static napi_value JsConvertPemKey(napi_env env, napi_callback_info info);
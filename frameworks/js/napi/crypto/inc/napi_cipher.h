@@ -44,6 +44,8 @@ public:
 
     static napi_value JsSetCipherSpec(napi_env env, napi_callback_info info);
     static napi_value JsGetCipherSpec(napi_env env, napi_callback_info info);
+    static napi_value JsCipherUpdateFd(napi_env env, napi_callback_info info);
+    static napi_value JsCipherUpdateFdSync(napi_env env, napi_callback_info info);
     HcfCipher *GetCipher() const;
 
     static thread_local napi_ref classRef_;
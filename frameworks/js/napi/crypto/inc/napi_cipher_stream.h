@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NAPI_CIPHER_STREAM_H
+#define NAPI_CIPHER_STREAM_H
+
+#include <deque>
+
+#include "napi/native_api.h"
+#include "napi/native_common.h"
+#include "cipher_stream.h"
+
+namespace OHOS {
+namespace CryptoFramework {
+struct CipherStreamPendingWrite {
+    HcfBlob data = { .data = nullptr, .len = 0 };
+    napi_deferred deferred = nullptr;
+    bool isEnd = false;
+};
+
+class NapiCipherStream {
+public:
+    NapiCipherStream(napi_env env, napi_ref cipherRef, napi_ref onDataRef);
+    ~NapiCipherStream();
+
+    static void DefineCipherStreamJSClass(napi_env env, napi_value exports);
+    static napi_value CreateCipherStream(napi_env env, napi_callback_info info);
+    static napi_value CipherStreamConstructor(napi_env env, napi_callback_info info);
+
+    static napi_value JsWrite(napi_env env, napi_callback_info info);
+    static napi_value JsEnd(napi_env env, napi_callback_info info);
+
+    static thread_local napi_ref classRef_;
+
+    HcfResult Start(HcfCipher *cipher, uint32_t queueDepth);
+    void Write(napi_env env, napi_value data, napi_deferred deferred);
+    void End(napi_env env, napi_value data, napi_deferred deferred);
+    void OnOutput(napi_env env, HcfResult result, HcfBlob *output, bool isFinal);
+
+private:
+    HcfResult ParkWrite(napi_env env, napi_value data, napi_deferred deferred, bool isEnd);
+    HcfResult SubmitEnd(HcfBlob *data, napi_deferred deferred);
+    void FlushPendingWrites(napi_env env);
+    void RejectPendingWrites(napi_env env, HcfResult result);
+    void ReleaseThreadSafeFunction(napi_threadsafe_function_release_mode mode);
+
+    napi_env env_ = nullptr;
+    napi_ref cipherRef_ = nullptr;
+    napi_ref onDataRef_ = nullptr;
+    napi_threadsafe_function tsfn_ = nullptr;
+    HcfCipherStream *stream_ = nullptr;
+    std::deque<CipherStreamPendingWrite> pendingWrites_;
+    napi_deferred endDeferred_ = nullptr;
+    HcfResult result_ = HCF_SUCCESS;
+};
+}  // namespace CryptoFramework
+}  // namespace OHOS
+#endif
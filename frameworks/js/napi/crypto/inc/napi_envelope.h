@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_NAPI_ENVELOPE_H
+#define HCF_NAPI_ENVELOPE_H
+
+#include "envelope.h"
+#include "log.h"
+#include "napi/native_api.h"
+#include "napi/native_common.h"
+
+namespace OHOS {
+namespace CryptoFramework {
+class NapiEnvelope {
+public:
+    explicit NapiEnvelope(HcfEnvelope *envelope);
+    ~NapiEnvelope();
+
+    HcfEnvelope *GetEnvelope() const;
+
+    static void DefineEnvelopeJSClass(napi_env env, napi_value exports);
+    static napi_value EnvelopeConstructor(napi_env env, napi_callback_info info);
+    static napi_value CreateJsEnvelope(napi_env env, napi_callback_info info);
+
+    static napi_value JsSeal(napi_env env, napi_callback_info info);
+    static napi_value JsSealSync(napi_env env, napi_callback_info info);
+    static napi_value JsOpen(napi_env env, napi_callback_info info);
+    static napi_value JsOpenSync(napi_env env, napi_callback_info info);
+    static napi_value JsGetAlgorithm(napi_env env, napi_callback_info info);
+
+    static thread_local napi_ref classRef_;
+
+private:
+    HcfEnvelope *envelope_ = nullptr;
+};
+}  // namespace CryptoFramework
+}  // namespace OHOS
+
+#endif
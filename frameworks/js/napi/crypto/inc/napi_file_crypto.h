@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NAPI_FILE_CRYPTO_H
+#define NAPI_FILE_CRYPTO_H
+
+#include "napi/native_api.h"
+#include "napi/native_common.h"
+
+#include "js_api_metrics.h"
+
+namespace OHOS {
+namespace CryptoFramework {
+enum FileCryptoType {
+    FILE_CRYPTO_MD = 0,
+    FILE_CRYPTO_MAC,
+    FILE_CRYPTO_CIPHER,
+};
+
+/* Returns the HcfMd, HcfMac or HcfCipher wrapped by thisVar, or nullptr. */
+using FileCryptoObjGetter = void *(*)(napi_env env, napi_value thisVar);
+
+struct FileCryptoApi {
+    FileCryptoType type;
+    HcfJsApiId apiId;
+    FileCryptoObjGetter getObj;
+};
+
+/*
+ * Implements updateFd(fd, offset?, length?) of Md and Mac and updateFd(inFd, outFd, offset?, length?) of Cipher.
+ * The async form runs the file I/O and the update on a worker thread and returns a promise.
+ */
+napi_value NapiFileCryptoUpdateFd(napi_env env, napi_callback_info info, const FileCryptoApi &api, bool isSync);
+} // namespace CryptoFramework
+} // namespace OHOS
+
+#endif // NAPI_FILE_CRYPTO_H
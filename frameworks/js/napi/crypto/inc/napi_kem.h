@@ -38,6 +38,10 @@ public:
     static napi_value JsEncapsulateSync(napi_env env, napi_callback_info info);
     static napi_value JsDecapsulate(napi_env env, napi_callback_info info);
     static napi_value JsDecapsulateSync(napi_env env, napi_callback_info info);
+    static napi_value JsEncapsulateBatch(napi_env env, napi_callback_info info);
+    static napi_value JsEncapsulateBatchSync(napi_env env, napi_callback_info info);
+    static napi_value JsDecapsulateBatch(napi_env env, napi_callback_info info);
+    static napi_value JsDecapsulateBatchSync(napi_env env, napi_callback_info info);
     static napi_value JsGetAlgorithm(napi_env env, napi_callback_info info);
 
     static thread_local napi_ref classRef_;
@@ -44,6 +44,8 @@ public:
     static napi_value JsMacDoFinal(napi_env env, napi_callback_info info);
     static napi_value JsMacDoFinalSync(napi_env env, napi_callback_info info);
     static napi_value JsGetMacLength(napi_env env, napi_callback_info info);
+    static napi_value JsMacUpdateFd(napi_env env, napi_callback_info info);
+    static napi_value JsMacUpdateFdSync(napi_env env, napi_callback_info info);
 
 private:
     HcfMac *macObj_ = nullptr;
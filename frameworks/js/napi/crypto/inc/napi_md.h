@@ -42,6 +42,8 @@ public:
     static napi_value JsMdDoFinal(napi_env env, napi_callback_info info);
     static napi_value JsMdDoFinalSync(napi_env env, napi_callback_info info);
     static napi_value JsGetMdLength(napi_env env, napi_callback_info info);
+    static napi_value JsMdUpdateFd(napi_env env, napi_callback_info info);
+    static napi_value JsMdUpdateFdSync(napi_env env, napi_callback_info info);
 
 private:
     HcfMd *mdObj_ = nullptr;
@@ -44,6 +44,9 @@ public:
 
     static napi_value JsSetSignSpec(napi_env env, napi_callback_info info);
     static napi_value JsGetSignSpec(napi_env env, napi_callback_info info);
+    static napi_value JsReset(napi_env env, napi_callback_info info);
+    static napi_value JsSignBatch(napi_env env, napi_callback_info info);
+    static napi_value JsSignBatchSync(napi_env env, napi_callback_info info);
 
     static thread_local napi_ref classRef_;
 
@@ -46,6 +46,7 @@ public:
 
     static napi_value JsSetVerifySpec(napi_env env, napi_callback_info info);
     static napi_value JsGetVerifySpec(napi_env env, napi_callback_info info);
+    static napi_value JsReset(napi_env env, napi_callback_info info);
 
     static thread_local napi_ref classRef_;
 
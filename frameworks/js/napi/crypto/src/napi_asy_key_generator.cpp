@@ -84,6 +84,23 @@ struct ConvertPemKeyCtx {
     HcfKeyPair *returnKeyPair = nullptr;
 };
 
+struct GenKeyPairsCtx {
+    napi_env env = nullptr;
+
+    napi_deferred deferred = nullptr;
+    napi_value promise = nullptr;
+    napi_async_work asyncWork = nullptr;
+    napi_ref generatorRef = nullptr;
+
+    HcfAsyKeyGenerator *generator = nullptr;
+    uint32_t count = 0;
+    uint32_t workerNum = 0;
+
+    HcfResult errCode = HCF_SUCCESS;
+    const char *errMsg = nullptr;
+    HcfKeyPair **returnKeyPairs = nullptr;
+};
+
 constexpr int PASSWORD_MAX_LENGTH = 4096;
 
 thread_local napi_ref NapiAsyKeyGenerator::classRef_ = nullptr;
@@ -112,6 +129,38 @@ static void FreeGenKeyPairCtx(napi_env env, GenKeyPairCtx *ctx)
     HcfFree(ctx);
 }
 
+static void FreeKeyPairs(HcfKeyPair **keyPairs, uint32_t count)
+{
+    if (keyPairs == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        HcfObjDestroy(keyPairs[i]);
+    }
+    HcfFree(keyPairs);
+}
+
+static void FreeGenKeyPairsCtx(napi_env env, GenKeyPairsCtx *ctx)
+{
+    if (ctx == nullptr) {
+        return;
+    }
+
+    if (ctx->asyncWork != nullptr) {
+        napi_delete_async_work(env, ctx->asyncWork);
+        ctx->asyncWork = nullptr;
+    }
+
+    if (ctx->generatorRef != nullptr) {
+        napi_delete_reference(env, ctx->generatorRef);
+        ctx->generatorRef = nullptr;
+    }
+
+    FreeKeyPairs(ctx->returnKeyPairs, ctx->count);
+    ctx->returnKeyPairs = nullptr;
+    HcfFree(ctx);
+}
+
 static void FreeConvertKeyCtx(napi_env env, ConvertKeyCtx *ctx)
 {
     if (ctx == nullptr) {
@@ -879,6 +928,227 @@ napi_value NapiAsyKeyGenerator::JsGenerateKeyPairSync(napi_env env, napi_callbac
     return instance;
 }
 
+static HcfResult GetGenKeyPairsParams(napi_env env, napi_value countArg, napi_value workerNumArg, uint32_t *count,
+    uint32_t *workerNum)
+{
+    if (!GetUint32FromJSParams(env, countArg, *count) || *count == 0 ||
+        *count > std::numeric_limits<uint32_t>::max() / sizeof(HcfKeyPair *)) {
+        LOGE("Invalid key pair count.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    napi_valuetype valueType = napi_undefined;
+    if (workerNumArg != nullptr) {
+        napi_typeof(env, workerNumArg, &valueType);
+    }
+    if (valueType == napi_null || valueType == napi_undefined) {
+        *workerNum = 0;
+        return HCF_SUCCESS;
+    }
+    if (!GetUint32FromJSParams(env, workerNumArg, *workerNum) || *workerNum > HCF_ASY_KEY_GEN_MAX_BATCH_WORKER_NUM) {
+        LOGE("Invalid worker num.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult DoGenerateKeyPairs(HcfAsyKeyGenerator *generator, uint32_t count, uint32_t workerNum,
+    HcfKeyPair ***returnKeyPairs)
+{
+    HcfKeyPair **keyPairs = static_cast<HcfKeyPair **>(HcfMalloc(sizeof(HcfKeyPair *) * count, 0));
+    if (keyPairs == nullptr) {
+        LOGE("Failed to allocate key pairs memory!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = generator->generateKeyPairs(generator, count, workerNum, keyPairs);
+    if (ret != HCF_SUCCESS) {
+        HcfFree(keyPairs);
+        return ret;
+    }
+    *returnKeyPairs = keyPairs;
+    return HCF_SUCCESS;
+}
+
+/* Every key pair is handed over to a JS object or destroyed, the array itself stays with the caller. */
+static napi_value ConvertKeyPairsToNapiArray(napi_env env, HcfKeyPair **keyPairs, uint32_t count)
+{
+    napi_value array = nullptr;
+    if (napi_create_array_with_length(env, count, &array) != napi_ok) {
+        LOGE("create key pair array failed!");
+        array = nullptr;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        HcfKeyPair *keyPair = keyPairs[i];
+        keyPairs[i] = nullptr;
+        if (array == nullptr) {
+            HcfObjDestroy(keyPair);
+            continue;
+        }
+        napi_value instance = nullptr;
+        if (!GetHcfKeyPairInstance(env, keyPair, &instance) || napi_set_element(env, array, i, instance) != napi_ok) {
+            LOGE("convert key pair %{public}u failed!", i);
+            array = nullptr;
+        }
+    }
+    return array;
+}
+
+static HcfResult BuildGenKeyPairsCtx(napi_env env, napi_callback_info info, GenKeyPairsCtx *ctx)
+{
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_TWO;
+    napi_value argv[PARAMS_NUM_TWO] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_ONE && argc != PARAMS_NUM_TWO) {
+        LOGE("wrong argument num. require 1 or 2 arguments. [Argc]: %{public}zu!", argc);
+        return HCF_INVALID_PARAMS;
+    }
+
+    NapiAsyKeyGenerator *napiGenerator = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiGenerator));
+    if (status != napi_ok || napiGenerator == nullptr) {
+        LOGE("failed to unwrap napi asyKeyGenerator obj.");
+        return HCF_ERR_NAPI;
+    }
+    HcfResult ret = GetGenKeyPairsParams(env, argv[PARAM0], argv[PARAM1], &ctx->count, &ctx->workerNum);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ctx->generator = napiGenerator->GetAsyKeyGenerator();
+
+    if (napi_create_reference(env, thisVar, 1, &ctx->generatorRef) != napi_ok) {
+        LOGE("create generator ref failed when generate key pairs!");
+        return HCF_ERR_NAPI;
+    }
+    napi_create_promise(env, &ctx->deferred, &ctx->promise);
+    return HCF_SUCCESS;
+}
+
+static void GenKeyPairsAsyncWorkProcess(napi_env env, void *data)
+{
+    HistogramScopeGuard guard(API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS);
+    GenKeyPairsCtx *ctx = static_cast<GenKeyPairsCtx *>(data);
+
+    ctx->errCode = DoGenerateKeyPairs(ctx->generator, ctx->count, ctx->workerNum, &ctx->returnKeyPairs);
+    if (ctx->errCode != HCF_SUCCESS) {
+        LOGE("generate key pairs fail.");
+        ctx->errMsg = "generate key pairs fail.";
+        guard.SetErrorCode(ctx->errCode);
+    }
+}
+
+static void GenKeyPairsAsyncWorkReturn(napi_env env, napi_status status, void *data)
+{
+    GenKeyPairsCtx *ctx = static_cast<GenKeyPairsCtx *>(data);
+
+    napi_value result = nullptr;
+    if (ctx->errCode == HCF_SUCCESS) {
+        result = ConvertKeyPairsToNapiArray(env, ctx->returnKeyPairs, ctx->count);
+        if (result == nullptr) {
+            ctx->errCode = HCF_ERR_MALLOC;
+            ctx->errMsg = "generate key pairs convert key pairs failed.";
+        }
+    }
+
+    if (ctx->errCode == HCF_SUCCESS) {
+        napi_resolve_deferred(env, ctx->deferred, result);
+    } else {
+        napi_reject_deferred(env, ctx->deferred, GenerateBusinessError(env, ctx->errCode, ctx->errMsg));
+    }
+    FreeGenKeyPairsCtx(env, ctx);
+}
+
+static napi_value NewGenKeyPairsAsyncWork(napi_env env, GenKeyPairsCtx *ctx)
+{
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, "generateKeyPairs", NAPI_AUTO_LENGTH, &resourceName);
+
+    napi_create_async_work(
+        env, nullptr, resourceName,
+        [](napi_env env, void *data) {
+            GenKeyPairsAsyncWorkProcess(env, data);
+            return;
+        },
+        [](napi_env env, napi_status status, void *data) {
+            GenKeyPairsAsyncWorkReturn(env, status, data);
+            return;
+        },
+        static_cast<void *>(ctx),
+        &ctx->asyncWork);
+
+    napi_queue_async_work(env, ctx->asyncWork);
+    return ctx->promise;
+}
+
+napi_value NapiAsyKeyGenerator::JsGenerateKeyPairs(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS);
+    GenKeyPairsCtx *ctx = static_cast<GenKeyPairsCtx *>(HcfMalloc(sizeof(GenKeyPairsCtx), 0));
+    if (ctx == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "malloc ctx fail.");
+        return nullptr;
+    }
+
+    HcfResult ret = BuildGenKeyPairsCtx(env, info, ctx);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "build context fail.");
+        FreeGenKeyPairsCtx(env, ctx);
+        return nullptr;
+    }
+
+    guard.DisableScopeGuard();
+    return NewGenKeyPairsAsyncWork(env, ctx);
+}
+
+napi_value NapiAsyKeyGenerator::JsGenerateKeyPairsSync(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_ASY_KEY_GENERATOR_GENERATE_KEY_PAIRS_SYNC);
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_TWO;
+    napi_value argv[PARAMS_NUM_TWO] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_ONE && argc != PARAMS_NUM_TWO) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "wrong argument num.");
+        return nullptr;
+    }
+
+    NapiAsyKeyGenerator *napiGenerator = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiGenerator));
+    if (status != napi_ok || napiGenerator == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "failed to unwrap napi asyKeyGenerator obj.");
+        return nullptr;
+    }
+
+    uint32_t count = 0;
+    uint32_t workerNum = 0;
+    HcfResult ret = GetGenKeyPairsParams(env, argv[PARAM0], argv[PARAM1], &count, &workerNum);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "invalid count or worker num.");
+        return nullptr;
+    }
+
+    HcfKeyPair **keyPairs = nullptr;
+    ret = DoGenerateKeyPairs(napiGenerator->GetAsyKeyGenerator(), count, workerNum, &keyPairs);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "generate key pairs fail.");
+        return nullptr;
+    }
+
+    napi_value instance = ConvertKeyPairsToNapiArray(env, keyPairs, count);
+    HcfFree(keyPairs);
+    if (instance == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "failed to get generate key pairs instance!");
+        return nullptr;
+    }
+    return instance;
+}
+
 napi_value NapiAsyKeyGenerator::JsConvertKey(napi_env env, napi_callback_info info)
 {
     HistogramScopeGuard guard(API_ASY_KEY_GENERATOR_CONVERT_KEY);
@@ -1135,6 +1405,8 @@ void NapiAsyKeyGenerator::DefineAsyKeyGeneratorJSClass(napi_env env, napi_value
     napi_property_descriptor classDesc[] = {
         DECLARE_NAPI_FUNCTION("generateKeyPair", NapiAsyKeyGenerator::JsGenerateKeyPair),
         DECLARE_NAPI_FUNCTION("generateKeyPairSync", NapiAsyKeyGenerator::JsGenerateKeyPairSync),
+        DECLARE_NAPI_FUNCTION("generateKeyPairs", NapiAsyKeyGenerator::JsGenerateKeyPairs),
+        DECLARE_NAPI_FUNCTION("generateKeyPairsSync", NapiAsyKeyGenerator::JsGenerateKeyPairsSync),
         DECLARE_NAPI_FUNCTION("convertKey", NapiAsyKeyGenerator::JsConvertKey),
         DECLARE_NAPI_FUNCTION("convertKeySync", NapiAsyKeyGenerator::JsConvertKeySync),
         DECLARE_NAPI_FUNCTION("convertPemKey", NapiAsyKeyGenerator::JsConvertPemKey),
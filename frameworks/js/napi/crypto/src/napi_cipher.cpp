@@ -21,6 +21,7 @@
 #include "utils.h"
 
 #include "cipher.h"
+#include "napi_file_crypto.h"
 #include "napi_utils.h"
 #include "napi_crypto_framework_defines.h"
 #include "detailed_iv_params.h"
@@ -395,33 +396,6 @@ static void AsyncInitReturn(napi_env env, napi_status status, void *data)
     FreeCipherFwkCtx(env, context);
 }
 
-static HcfResult CreateNapiUint8ArrayNoCopy(napi_env env, HcfBlob *blob, napi_value *napiValue)
-{
-    if (blob->data == nullptr || blob->len == 0) { // inner api, allow empty data
-        *napiValue = NapiGetNull(env);
-        return HCF_SUCCESS;
-    }
-
-    napi_value outBuffer = nullptr;
-    napi_status status = napi_create_external_arraybuffer(
-        env, blob->data, blob->len, [](napi_env env, void *data, void *hint) { HcfFree(data); }, nullptr, &outBuffer);
-    if (status != napi_ok) {
-        LOGE("create napi uint8 array buffer failed!");
-        return HCF_ERR_NAPI;
-    }
-
-    napi_value outData = nullptr;
-    napi_create_typedarray(env, napi_uint8_array, blob->len, outBuffer, 0, &outData);
-    napi_value dataBlob = nullptr;
-    napi_create_object(env, &dataBlob);
-    napi_set_named_property(env, dataBlob, CRYPTO_TAG_DATA.c_str(), outData);
-    *napiValue = dataBlob;
-
-    blob->data = nullptr;
-    blob->len = 0;
-    return HCF_SUCCESS;
-}
-
 static void AsyncUpdateReturn(napi_env env, napi_status status, void *data)
 {
     CipherFwkCtx context = static_cast<CipherFwkCtx>(data);
@@ -869,6 +843,32 @@ napi_value NapiCipher::CreateCipher(napi_env env, napi_callback_info info)
     return instance;
 }
 
+static napi_value SetCipherSpecNumber(napi_env env, napi_value thisVar, napi_value arg, CipherSpecItem item,
+    HistogramScopeGuard &guard)
+{
+    int32_t value = 0;
+    if (napi_get_value_int32(env, arg, &value) != napi_ok) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "[value]: must be of the number type.");
+        return nullptr;
+    }
+    NapiCipher *napiCipher = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiCipher));
+    if (status != napi_ok || napiCipher == nullptr) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "failed to unwrap napiCipher obj!");
+        return nullptr;
+    }
+    HcfCipher *cipher = napiCipher->GetCipher();
+    HcfResult res = cipher->setCipherSpecInt(cipher, item, value);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        NAPI_LOG_THROW(env, res, "c set cipher spec failed.");
+        return nullptr;
+    }
+    return thisVar;
+}
+
 napi_value NapiCipher::JsSetCipherSpec(napi_env env, napi_callback_info info)
 {
     HistogramScopeGuard guard(API_CIPHER_SET_CIPHER_SPEC);
@@ -889,6 +889,9 @@ napi_value NapiCipher::JsSetCipherSpec(napi_env env, napi_callback_info info)
         NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "get JsGetCipherSpecUint8Array failed!");
         return nullptr;
     }
+    if (GetCipherSpecType(item) == SPEC_ITEM_TYPE_NUM) {
+        return SetCipherSpecNumber(env, thisVar, argv[1], item, guard);
+    }
     HcfBlob *pSource = GetBlobFromNapiUint8Arr(env, argv[1]);
     if (pSource == nullptr || pSource->len == 0) {
         HcfBlobDataFree(pSource);
@@ -953,6 +956,44 @@ static napi_value GetCipherSpecUint8Array(napi_env env, CipherSpecItem item, Hcf
     return instance;
 }
 
+static napi_value GetCipherSpecNumber(napi_env env, CipherSpecItem item, HcfCipher *cipher,
+    HistogramScopeGuard &guard)
+{
+    int32_t returnInt = 0;
+    HcfResult res = cipher->getCipherSpecInt(cipher, item, &returnInt);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        NAPI_LOG_THROW(env, res, "c getCipherSpecInt failed.");
+        return nullptr;
+    }
+
+    napi_value instance = nullptr;
+    napi_create_int32(env, returnInt, &instance);
+    return instance;
+}
+
+static void *GetCipherFromThis(napi_env env, napi_value thisVar)
+{
+    NapiCipher *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || obj == nullptr) {
+        return nullptr;
+    }
+    return obj->GetCipher();
+}
+
+napi_value NapiCipher::JsCipherUpdateFd(napi_env env, napi_callback_info info)
+{
+    FileCryptoApi api = { FILE_CRYPTO_CIPHER, API_CIPHER_UPDATE_FD, GetCipherFromThis };
+    return NapiFileCryptoUpdateFd(env, info, api, false);
+}
+
+napi_value NapiCipher::JsCipherUpdateFdSync(napi_env env, napi_callback_info info)
+{
+    FileCryptoApi api = { FILE_CRYPTO_CIPHER, API_CIPHER_UPDATE_FD_SYNC, GetCipherFromThis };
+    return NapiFileCryptoUpdateFd(env, info, api, true);
+}
+
 napi_value NapiCipher::JsGetCipherSpec(napi_env env, napi_callback_info info)
 {
     HistogramScopeGuard guard(API_CIPHER_GET_CIPHER_SPEC);
@@ -992,6 +1033,8 @@ napi_value NapiCipher::JsGetCipherSpec(napi_env env, napi_callback_info info)
         return GetCipherSpecString(env, item, cipher, guard);
     } else if (type == SPEC_ITEM_TYPE_UINT8ARR) {
         return GetCipherSpecUint8Array(env, item, cipher, guard);
+    } else if (type == SPEC_ITEM_TYPE_NUM) {
+        return GetCipherSpecNumber(env, item, cipher, guard);
     } else {
         guard.SetErrorCode(HCF_INVALID_PARAMS);
         NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "CipherSpecItem not support!");
@@ -1013,6 +1056,8 @@ void NapiCipher::DefineCipherJSClass(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("initSync", NapiCipher::JsCipherInitSync),
         DECLARE_NAPI_FUNCTION("updateSync", NapiCipher::JsCipherUpdateSync),
         DECLARE_NAPI_FUNCTION("doFinalSync", NapiCipher::JsCipherDoFinalSync),
+        DECLARE_NAPI_FUNCTION("updateFd", NapiCipher::JsCipherUpdateFd),
+        DECLARE_NAPI_FUNCTION("updateFdSync", NapiCipher::JsCipherUpdateFdSync),
         DECLARE_NAPI_FUNCTION("setCipherSpec", NapiCipher::JsSetCipherSpec),
         DECLARE_NAPI_FUNCTION("getCipherSpec", NapiCipher::JsGetCipherSpec),
         { .utf8name = "algName", .getter = NapiCipher::JsGetAlgorithm },
@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "napi_cipher_stream.h"
+
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+
+#include "napi_cipher.h"
+#include "napi_utils.h"
+#include "napi_crypto_framework_defines.h"
+
+namespace OHOS {
+namespace CryptoFramework {
+thread_local napi_ref NapiCipherStream::classRef_ = nullptr;
+
+struct CipherStreamEvent {
+    HcfResult result = HCF_SUCCESS;
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    bool isFinal = false;
+};
+
+// runs on the stream worker thread, the output is handed over to the js thread without copying
+static void OnStreamOutput(void *userData, HcfResult result, HcfBlob *output, bool isFinal)
+{
+    napi_threadsafe_function tsfn = static_cast<napi_threadsafe_function>(userData);
+    CipherStreamEvent *event = new (std::nothrow) CipherStreamEvent();
+    if (event == nullptr) {
+        LOGE("new cipher stream event failed!");
+        return;
+    }
+    event->result = result;
+    event->output = *output;
+    event->isFinal = isFinal;
+    output->data = nullptr;
+    output->len = 0;
+    if (napi_call_threadsafe_function(tsfn, event, napi_tsfn_blocking) != napi_ok) {
+        LOGE("post cipher stream event failed!");
+        HcfBlobDataClearAndFree(&event->output);
+        delete event;
+    }
+}
+
+static void CallJsOnStreamOutput(napi_env env, napi_value jsCallback, void *context, void *data)
+{
+    CipherStreamEvent *event = static_cast<CipherStreamEvent *>(data);
+    if (env != nullptr && context != nullptr) {
+        static_cast<NapiCipherStream *>(context)->OnOutput(env, event->result, &event->output, event->isFinal);
+    }
+    HcfBlobDataClearAndFree(&event->output);
+    delete event;
+}
+
+NapiCipherStream::NapiCipherStream(napi_env env, napi_ref cipherRef, napi_ref onDataRef)
+    : env_(env), cipherRef_(cipherRef), onDataRef_(onDataRef)
+{
+}
+
+NapiCipherStream::~NapiCipherStream()
+{
+    // joins the worker, no output is posted afterwards
+    HcfObjDestroy(stream_);
+    stream_ = nullptr;
+    ReleaseThreadSafeFunction(napi_tsfn_abort);
+    for (auto &pending : pendingWrites_) {
+        HcfBlobDataClearAndFree(&pending.data);
+    }
+    pendingWrites_.clear();
+    if (onDataRef_ != nullptr) {
+        napi_delete_reference(env_, onDataRef_);
+        onDataRef_ = nullptr;
+    }
+    if (cipherRef_ != nullptr) {
+        napi_delete_reference(env_, cipherRef_);
+        cipherRef_ = nullptr;
+    }
+}
+
+void NapiCipherStream::ReleaseThreadSafeFunction(napi_threadsafe_function_release_mode mode)
+{
+    if (tsfn_ != nullptr) {
+        napi_release_threadsafe_function(tsfn_, mode);
+        tsfn_ = nullptr;
+    }
+}
+
+HcfResult NapiCipherStream::Start(HcfCipher *cipher, uint32_t queueDepth)
+{
+    napi_status status = napi_create_threadsafe_function(env_, nullptr, nullptr,
+        GetResourceName(env_, "CipherStream"), 0, 1, nullptr, nullptr, this, CallJsOnStreamOutput, &tsfn_);
+    if (status != napi_ok) {
+        LOGE("create threadsafe function failed!");
+        tsfn_ = nullptr;
+        return HCF_ERR_NAPI;
+    }
+    HcfResult res = HcfCipherStreamCreate(cipher, queueDepth, OnStreamOutput, tsfn_, &stream_);
+    if (res != HCF_SUCCESS) {
+        LOGE("create c cipher stream failed!");
+        ReleaseThreadSafeFunction(napi_tsfn_abort);
+        return res;
+    }
+    return HCF_SUCCESS;
+}
+
+HcfResult NapiCipherStream::ParkWrite(napi_env env, napi_value data, napi_deferred deferred, bool isEnd)
+{
+    CipherStreamPendingWrite pending;
+    pending.deferred = deferred;
+    pending.isEnd = isEnd;
+    if (data != nullptr) {
+        HcfBlob *blob = GetBlobFromNapiDataBlob(env, data);
+        if (blob == nullptr) {
+            return HCF_INVALID_PARAMS;
+        }
+        pending.data = *blob;
+        HcfFree(blob);
+    }
+    pendingWrites_.push_back(pending);
+    return HCF_SUCCESS;
+}
+
+HcfResult NapiCipherStream::SubmitEnd(HcfBlob *data, napi_deferred deferred)
+{
+    HcfResult res = stream_->finish(stream_, data);
+    if (res == HCF_SUCCESS) {
+        endDeferred_ = deferred;
+    }
+    return res;
+}
+
+void NapiCipherStream::Write(napi_env env, napi_value data, napi_deferred deferred)
+{
+    HcfResult res = result_;
+    if (res == HCF_SUCCESS && pendingWrites_.empty()) {
+        HcfBlob input = { .data = nullptr, .len = 0 };
+        bool accepted = false;
+        res = GetNapiUint8ArrayDataNoCopy(env, data, &input);
+        if (res == HCF_SUCCESS) {
+            res = stream_->tryWrite(stream_, &input, &accepted);
+        }
+        if (res == HCF_SUCCESS && accepted) {
+            napi_resolve_deferred(env, deferred, NapiGetNull(env));
+            return;
+        }
+    }
+    if (res == HCF_SUCCESS) {
+        // the queue is full, the promise settles once the worker has made room for the chunk
+        res = ParkWrite(env, data, deferred, false);
+    }
+    if (res != HCF_SUCCESS) {
+        napi_reject_deferred(env, deferred, GenerateBusinessError(env, res, "cipher stream write failed."));
+    }
+}
+
+void NapiCipherStream::End(napi_env env, napi_value data, napi_deferred deferred)
+{
+    HcfResult res = result_;
+    if (res == HCF_SUCCESS && (endDeferred_ != nullptr ||
+        (!pendingWrites_.empty() && pendingWrites_.back().isEnd))) {
+        res = HCF_ERR_INVALID_CALL;
+    }
+    if (res == HCF_SUCCESS && pendingWrites_.empty()) {
+        HcfBlob input = { .data = nullptr, .len = 0 };
+        if (data != nullptr) {
+            res = GetNapiUint8ArrayDataNoCopy(env, data, &input);
+        }
+        if (res == HCF_SUCCESS) {
+            res = SubmitEnd((input.data == nullptr) ? nullptr : &input, deferred);
+        }
+    } else if (res == HCF_SUCCESS) {
+        res = ParkWrite(env, data, deferred, true);
+    }
+    if (res != HCF_SUCCESS) {
+        napi_reject_deferred(env, deferred, GenerateBusinessError(env, res, "cipher stream end failed."));
+    }
+}
+
+void NapiCipherStream::FlushPendingWrites(napi_env env)
+{
+    while (!pendingWrites_.empty()) {
+        CipherStreamPendingWrite &pending = pendingWrites_.front();
+        HcfResult res;
+        if (pending.isEnd) {
+            res = SubmitEnd((pending.data.data == nullptr) ? nullptr : &pending.data, pending.deferred);
+        } else {
+            bool accepted = false;
+            res = stream_->tryWrite(stream_, &pending.data, &accepted);
+            if (res == HCF_SUCCESS && !accepted) {
+                return;
+            }
+            if (res == HCF_SUCCESS) {
+                napi_resolve_deferred(env, pending.deferred, NapiGetNull(env));
+            }
+        }
+        if (res != HCF_SUCCESS) {
+            napi_reject_deferred(env, pending.deferred,
+                GenerateBusinessError(env, res, "cipher stream write failed."));
+        }
+        HcfBlobDataClearAndFree(&pending.data);
+        pendingWrites_.pop_front();
+    }
+}
+
+void NapiCipherStream::RejectPendingWrites(napi_env env, HcfResult result)
+{
+    for (auto &pending : pendingWrites_) {
+        napi_reject_deferred(env, pending.deferred, GenerateBusinessError(env, result, "cipher stream failed."));
+        HcfBlobDataClearAndFree(&pending.data);
+    }
+    pendingWrites_.clear();
+    if (endDeferred_ != nullptr) {
+        napi_reject_deferred(env, endDeferred_, GenerateBusinessError(env, result, "cipher stream failed."));
+        endDeferred_ = nullptr;
+    }
+}
+
+void NapiCipherStream::OnOutput(napi_env env, HcfResult result, HcfBlob *output, bool isFinal)
+{
+    napi_value params[ARGS_SIZE_THREE] = { NapiGetNull(env), NapiGetNull(env), nullptr };
+    if (result != HCF_SUCCESS) {
+        params[0] = GenerateBusinessError(env, result, "cipher stream chunk failed.");
+    } else if (CreateNapiUint8ArrayNoCopy(env, output, &params[1]) != HCF_SUCCESS) {
+        LOGE("create cipher stream output failed!");
+    }
+    napi_get_boolean(env, isFinal, &params[ARGS_SIZE_TWO]);
+
+    napi_value func = nullptr;
+    napi_value recv = nullptr;
+    napi_value callFuncRet = nullptr;
+    napi_get_reference_value(env, onDataRef_, &func);
+    napi_get_undefined(env, &recv);
+    napi_call_function(env, recv, func, ARGS_SIZE_THREE, params, &callFuncRet);
+
+    if (result != HCF_SUCCESS) {
+        result_ = result;
+        RejectPendingWrites(env, result);
+    } else {
+        FlushPendingWrites(env);
+        if (isFinal && endDeferred_ != nullptr) {
+            napi_resolve_deferred(env, endDeferred_, NapiGetNull(env));
+            endDeferred_ = nullptr;
+        }
+    }
+    if (isFinal) {
+        result_ = (result != HCF_SUCCESS) ? result : HCF_ERR_INVALID_CALL;
+        // the stream has stopped, nothing else is posted from the worker
+        ReleaseThreadSafeFunction(napi_tsfn_release);
+    }
+}
+
+static NapiCipherStream *UnwrapCipherStream(napi_env env, napi_callback_info info, napi_value *argv, size_t *argc)
+{
+    napi_value thisVar = nullptr;
+    napi_get_cb_info(env, info, argc, argv, &thisVar, nullptr);
+    NapiCipherStream *napiStream = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiStream));
+    if (status != napi_ok || napiStream == nullptr) {
+        LOGE("failed to unwrap napiCipherStream obj!");
+        return nullptr;
+    }
+    return napiStream;
+}
+
+napi_value NapiCipherStream::JsWrite(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_CIPHER_STREAM_WRITE);
+    size_t argc = ARGS_SIZE_ONE;
+    napi_value argv[ARGS_SIZE_ONE] = { nullptr };
+    NapiCipherStream *napiStream = UnwrapCipherStream(env, info, argv, &argc);
+    if (napiStream == nullptr || argc != ARGS_SIZE_ONE) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "invalid parameters.");
+        return nullptr;
+    }
+    napi_deferred deferred = nullptr;
+    napi_value promise = nullptr;
+    napi_create_promise(env, &deferred, &promise);
+    napiStream->Write(env, argv[PARAM0], deferred);
+    return promise;
+}
+
+napi_value NapiCipherStream::JsEnd(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_CIPHER_STREAM_END);
+    size_t argc = ARGS_SIZE_ONE;
+    napi_value argv[ARGS_SIZE_ONE] = { nullptr };
+    NapiCipherStream *napiStream = UnwrapCipherStream(env, info, argv, &argc);
+    if (napiStream == nullptr || argc > ARGS_SIZE_ONE) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "invalid parameters.");
+        return nullptr;
+    }
+    napi_value data = nullptr;
+    if (argc == ARGS_SIZE_ONE) {
+        napi_valuetype valueType;
+        napi_typeof(env, argv[PARAM0], &valueType);
+        if (valueType != napi_null && valueType != napi_undefined) {
+            data = argv[PARAM0];
+        }
+    }
+    napi_deferred deferred = nullptr;
+    napi_value promise = nullptr;
+    napi_create_promise(env, &deferred, &promise);
+    napiStream->End(env, data, deferred);
+    return promise;
+}
+
+napi_value NapiCipherStream::CipherStreamConstructor(napi_env env, napi_callback_info info)
+{
+    napi_value thisVar = nullptr;
+    napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+    return thisVar;
+}
+
+static bool GetCipherStreamArgs(napi_env env, napi_value *argv, size_t argc, HcfCipher **cipher,
+    uint32_t *queueDepth)
+{
+    NapiCipher *napiCipher = nullptr;
+    napi_status status = napi_unwrap(env, argv[PARAM0], reinterpret_cast<void **>(&napiCipher));
+    if (status != napi_ok || napiCipher == nullptr || napiCipher->GetCipher() == nullptr) {
+        LOGE("failed to unwrap napiCipher obj!");
+        return false;
+    }
+    *cipher = napiCipher->GetCipher();
+    napi_valuetype valueType;
+    napi_typeof(env, argv[PARAM1], &valueType);
+    if (valueType != napi_function) {
+        LOGE("onData is not a function.");
+        return false;
+    }
+    *queueDepth = 0;
+    if (argc == ARGS_SIZE_THREE && !GetUint32FromJSParams(env, argv[PARAM2], *queueDepth)) {
+        LOGE("failed to get queueDepth.");
+        return false;
+    }
+    return true;
+}
+
+napi_value NapiCipherStream::CreateCipherStream(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_CREATE_CIPHER_STREAM);
+    size_t argc = ARGS_SIZE_THREE;
+    napi_value argv[ARGS_SIZE_THREE] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    HcfCipher *cipher = nullptr;
+    uint32_t queueDepth = 0;
+    if ((argc != ARGS_SIZE_TWO && argc != ARGS_SIZE_THREE) ||
+        !GetCipherStreamArgs(env, argv, argc, &cipher, &queueDepth)) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "invalid parameters.");
+        return nullptr;
+    }
+
+    napi_value instance = nullptr;
+    napi_value constructor = nullptr;
+    napi_get_reference_value(env, classRef_, &constructor);
+    napi_new_instance(env, constructor, 0, nullptr, &instance);
+
+    napi_ref cipherRef = nullptr;
+    napi_ref onDataRef = nullptr;
+    napi_create_reference(env, argv[PARAM0], 1, &cipherRef);
+    napi_create_reference(env, argv[PARAM1], 1, &onDataRef);
+    NapiCipherStream *napiStream = new (std::nothrow) NapiCipherStream(env, cipherRef, onDataRef);
+    if (napiStream == nullptr) {
+        napi_delete_reference(env, cipherRef);
+        napi_delete_reference(env, onDataRef);
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "new napiCipherStream failed!");
+        return nullptr;
+    }
+    HcfResult res = napiStream->Start(cipher, queueDepth);
+    if (res != HCF_SUCCESS) {
+        delete napiStream;
+        guard.SetErrorCode(res);
+        NAPI_LOG_THROW(env, res, "create C cipher stream fail!");
+        return nullptr;
+    }
+    napi_status status = napi_wrap(env, instance, napiStream,
+        [](napi_env env, void *data, void *hint) {
+            delete static_cast<NapiCipherStream *>(data);
+        }, nullptr, nullptr);
+    if (status != napi_ok) {
+        delete napiStream;
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "failed to wrap napiCipherStream obj.");
+        return nullptr;
+    }
+    return instance;
+}
+
+void NapiCipherStream::DefineCipherStreamJSClass(napi_env env, napi_value exports)
+{
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_FUNCTION("createCipherStream", NapiCipherStream::CreateCipherStream),
+    };
+    napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
+
+    napi_property_descriptor classDesc[] = {
+        DECLARE_NAPI_FUNCTION("write", NapiCipherStream::JsWrite),
+        DECLARE_NAPI_FUNCTION("end", NapiCipherStream::JsEnd),
+    };
+    napi_value constructor = nullptr;
+    napi_define_class(env, "CipherStream", NAPI_AUTO_LENGTH, NapiCipherStream::CipherStreamConstructor, nullptr,
+        sizeof(classDesc) / sizeof(classDesc[0]), classDesc, &constructor);
+    napi_create_reference(env, constructor, 1, &classRef_);
+}
+}  // namespace CryptoFramework
+}  // namespace OHOS
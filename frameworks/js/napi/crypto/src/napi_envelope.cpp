@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "log.h"
+#include "napi_envelope.h"
+
+#include "memory.h"
+#include "napi_crypto_framework_defines.h"
+#include "napi_pri_key.h"
+#include "napi_pub_key.h"
+#include "napi_utils.h"
+
+namespace OHOS {
+namespace CryptoFramework {
+struct EnvelopeArgs {
+    HcfEnvelope *envelope = nullptr;
+    HcfPubKey *pubKey = nullptr;
+    HcfPriKey *priKey = nullptr;
+    HcfBlob *input = nullptr;
+    HcfBlob *aad = nullptr;
+};
+
+struct EnvelopeCtx {
+    napi_deferred deferred = nullptr;
+    napi_value promise = nullptr;
+    napi_async_work asyncWork = nullptr;
+    napi_ref envelopeRef = nullptr;
+    napi_ref keyRef = nullptr;
+
+    bool isSeal = true;
+    EnvelopeArgs args;
+
+    HcfResult errCode = HCF_SUCCESS;
+    const char *errMsg = nullptr;
+    HcfBlob output = { .data = nullptr, .len = 0 };
+};
+
+thread_local napi_ref NapiEnvelope::classRef_ = nullptr;
+
+static bool IsNapiValueNullOrUndefined(napi_env env, napi_value value)
+{
+    napi_valuetype type = napi_undefined;
+    napi_typeof(env, value, &type);
+    return (type == napi_null || type == napi_undefined);
+}
+
+static void FreeEnvelopeArgs(EnvelopeArgs *args)
+{
+    if (args->input != nullptr) {
+        HcfBlobDataClearAndFree(args->input);
+        HCF_FREE_PTR(args->input);
+    }
+    if (args->aad != nullptr) {
+        HcfBlobDataFree(args->aad);
+        HCF_FREE_PTR(args->aad);
+    }
+}
+
+static void FreeEnvelopeCtx(napi_env env, EnvelopeCtx *ctx)
+{
+    if (ctx == nullptr) {
+        return;
+    }
+    if (ctx->asyncWork != nullptr) {
+        napi_delete_async_work(env, ctx->asyncWork);
+        ctx->asyncWork = nullptr;
+    }
+    if (ctx->envelopeRef != nullptr) {
+        napi_delete_reference(env, ctx->envelopeRef);
+        ctx->envelopeRef = nullptr;
+    }
+    if (ctx->keyRef != nullptr) {
+        napi_delete_reference(env, ctx->keyRef);
+        ctx->keyRef = nullptr;
+    }
+    FreeEnvelopeArgs(&ctx->args);
+    HcfBlobDataClearAndFree(&ctx->output);
+    HcfFree(ctx);
+}
+
+/* seal(pubKey, input, aad?) and open(priKey, envelope, aad?) share one argument layout. */
+static HcfResult ParseEnvelopeArgs(napi_env env, napi_callback_info info, bool isSeal, napi_value *jsArgs,
+    EnvelopeArgs *args)
+{
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_THREE;
+    napi_value argv[PARAMS_NUM_THREE] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_THREE && argc != PARAMS_NUM_TWO) {
+        LOGE("wrong argument num. require 2 or 3 arguments. [Argc]: %{public}zu!", argc);
+        return HCF_INVALID_PARAMS;
+    }
+    if (IsNapiValueNullOrUndefined(env, argv[PARAM0]) || IsNapiValueNullOrUndefined(env, argv[PARAM1])) {
+        LOGE("key or data is null or undefined.");
+        return HCF_INVALID_PARAMS;
+    }
+    NapiEnvelope *napiEnvelope = nullptr;
+    if (napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiEnvelope)) != napi_ok || napiEnvelope == nullptr) {
+        LOGE("failed to unwrap napi envelope obj.");
+        return HCF_ERR_NAPI;
+    }
+    args->envelope = napiEnvelope->GetEnvelope();
+    if (isSeal) {
+        NapiPubKey *napiPubKey = nullptr;
+        if (napi_unwrap(env, argv[PARAM0], reinterpret_cast<void **>(&napiPubKey)) != napi_ok ||
+            napiPubKey == nullptr) {
+            LOGE("failed to unwrap napi pubKey obj.");
+            return HCF_ERR_NAPI;
+        }
+        args->pubKey = napiPubKey->GetPubKey();
+    } else {
+        NapiPriKey *napiPriKey = nullptr;
+        if (napi_unwrap(env, argv[PARAM0], reinterpret_cast<void **>(&napiPriKey)) != napi_ok ||
+            napiPriKey == nullptr) {
+            LOGE("failed to unwrap napi priKey obj.");
+            return HCF_ERR_NAPI;
+        }
+        args->priKey = napiPriKey->GetPriKey();
+    }
+    args->input = GetBlobFromNapiDataBlob(env, argv[PARAM1]);
+    if (args->input == nullptr) {
+        LOGE("failed to get data.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (argc == PARAMS_NUM_THREE && !IsNapiValueNullOrUndefined(env, argv[PARAM2])) {
+        args->aad = GetBlobFromNapiDataBlob(env, argv[PARAM2]);
+        if (args->aad == nullptr) {
+            LOGE("failed to get aad.");
+            return HCF_INVALID_PARAMS;
+        }
+    }
+    jsArgs[PARAM0] = thisVar;
+    jsArgs[PARAM1] = argv[PARAM0];
+    return HCF_SUCCESS;
+}
+
+static HcfResult DoEnvelope(const EnvelopeArgs *args, bool isSeal, HcfBlob *output)
+{
+    if (isSeal) {
+        return args->envelope->seal(args->envelope, args->pubKey, args->aad, args->input, output);
+    }
+    return args->envelope->open(args->envelope, args->priKey, args->aad, args->input, output);
+}
+
+static void EnvelopeAsyncWorkProcess(napi_env env, void *data)
+{
+    (void)env;
+    EnvelopeCtx *ctx = static_cast<EnvelopeCtx *>(data);
+    HistogramScopeGuard guard(ctx->isSeal ? API_ENVELOPE_SEAL : API_ENVELOPE_OPEN);
+    ctx->errCode = DoEnvelope(&ctx->args, ctx->isSeal, &ctx->output);
+    if (ctx->errCode != HCF_SUCCESS) {
+        ctx->errMsg = ctx->isSeal ? "envelope seal failed." : "envelope open failed.";
+        guard.SetErrorCode(ctx->errCode);
+    }
+}
+
+static void EnvelopeAsyncWorkReturn(napi_env env, napi_status status, void *data)
+{
+    (void)status;
+    EnvelopeCtx *ctx = static_cast<EnvelopeCtx *>(data);
+    if (ctx->errCode == HCF_SUCCESS) {
+        napi_resolve_deferred(env, ctx->deferred, ConvertBlobToNapiValue(env, &ctx->output));
+    } else {
+        napi_reject_deferred(env, ctx->deferred, GenerateBusinessError(env, ctx->errCode, ctx->errMsg));
+    }
+    FreeEnvelopeCtx(env, ctx);
+}
+
+static napi_value NewEnvelopeAsyncWork(napi_env env, napi_callback_info info, bool isSeal)
+{
+    HistogramScopeGuard guard(isSeal ? API_ENVELOPE_SEAL : API_ENVELOPE_OPEN);
+    EnvelopeCtx *ctx = static_cast<EnvelopeCtx *>(HcfMalloc(sizeof(EnvelopeCtx), 0));
+    if (ctx == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "create context fail.");
+        return nullptr;
+    }
+    ctx->isSeal = isSeal;
+    /* The envelope and key objects are referenced so that they outlive the async work. */
+    napi_value jsArgs[PARAMS_NUM_TWO] = { nullptr };
+    HcfResult ret = ParseEnvelopeArgs(env, info, isSeal, jsArgs, &ctx->args);
+    if (ret == HCF_SUCCESS && (napi_create_reference(env, jsArgs[PARAM0], 1, &ctx->envelopeRef) != napi_ok ||
+        napi_create_reference(env, jsArgs[PARAM1], 1, &ctx->keyRef) != napi_ok)) {
+        ret = HCF_ERR_NAPI;
+    }
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "build envelope context fail.");
+        FreeEnvelopeCtx(env, ctx);
+        return nullptr;
+    }
+    napi_create_promise(env, &ctx->deferred, &ctx->promise);
+    napi_create_async_work(env, nullptr, GetResourceName(env, isSeal ? "EnvelopeSeal" : "EnvelopeOpen"),
+        [](napi_env env, void *data) { EnvelopeAsyncWorkProcess(env, data); },
+        [](napi_env env, napi_status status, void *data) { EnvelopeAsyncWorkReturn(env, status, data); },
+        static_cast<void *>(ctx), &ctx->asyncWork);
+    napi_queue_async_work(env, ctx->asyncWork);
+    guard.DisableScopeGuard();
+    return ctx->promise;
+}
+
+static napi_value EnvelopeSync(napi_env env, napi_callback_info info, bool isSeal)
+{
+    HistogramScopeGuard guard(isSeal ? API_ENVELOPE_SEAL_SYNC : API_ENVELOPE_OPEN_SYNC);
+    EnvelopeArgs args;
+    napi_value jsArgs[PARAMS_NUM_TWO] = { nullptr };
+    HcfResult ret = ParseEnvelopeArgs(env, info, isSeal, jsArgs, &args);
+    if (ret != HCF_SUCCESS) {
+        FreeEnvelopeArgs(&args);
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "parse envelope params fail.");
+        return nullptr;
+    }
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    ret = DoEnvelope(&args, isSeal, &output);
+    FreeEnvelopeArgs(&args);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, isSeal ? "envelope seal failed." : "envelope open failed.");
+        return nullptr;
+    }
+    napi_value instance = nullptr;
+    ret = ConvertDataBlobToNapiValue(env, &output, &instance);
+    HcfBlobDataClearAndFree(&output);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "envelope convert dataBlob to napi_value failed!");
+        return nullptr;
+    }
+    return instance;
+}
+
+NapiEnvelope::NapiEnvelope(HcfEnvelope *envelope)
+{
+    envelope_ = envelope;
+}
+
+NapiEnvelope::~NapiEnvelope()
+{
+    HcfObjDestroy(envelope_);
+    envelope_ = nullptr;
+}
+
+HcfEnvelope *NapiEnvelope::GetEnvelope() const
+{
+    return envelope_;
+}
+
+napi_value NapiEnvelope::JsSeal(napi_env env, napi_callback_info info)
+{
+    return NewEnvelopeAsyncWork(env, info, true);
+}
+
+napi_value NapiEnvelope::JsSealSync(napi_env env, napi_callback_info info)
+{
+    return EnvelopeSync(env, info, true);
+}
+
+napi_value NapiEnvelope::JsOpen(napi_env env, napi_callback_info info)
+{
+    return NewEnvelopeAsyncWork(env, info, false);
+}
+
+napi_value NapiEnvelope::JsOpenSync(napi_env env, napi_callback_info info)
+{
+    return EnvelopeSync(env, info, false);
+}
+
+napi_value NapiEnvelope::EnvelopeConstructor(napi_env env, napi_callback_info info)
+{
+    napi_value thisVar = nullptr;
+    napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+    return thisVar;
+}
+
+napi_value NapiEnvelope::CreateJsEnvelope(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_CREATE_ENVELOPE);
+    size_t argc = PARAMS_NUM_ONE;
+    napi_value argv[PARAMS_NUM_ONE] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr);
+    if (argc != PARAMS_NUM_ONE) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "The input args num is invalid.");
+        return nullptr;
+    }
+    std::string algName;
+    if (!GetStringFromJSParams(env, argv[PARAM0], algName)) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "Get algName is invalid.");
+        return nullptr;
+    }
+    HcfEnvelope *envelope = nullptr;
+    HcfResult res = HcfEnvelopeCreate(algName.c_str(), &envelope);
+    if (res != HCF_SUCCESS) {
+        guard.SetErrorCode(res);
+        NAPI_LOG_THROW(env, res, "create c envelope fail.");
+        return nullptr;
+    }
+    napi_value instance = nullptr;
+    napi_value constructor = nullptr;
+    napi_get_reference_value(env, classRef_, &constructor);
+    napi_new_instance(env, constructor, 0, nullptr, &instance);
+    NapiEnvelope *napiEnvelope = new (std::nothrow) NapiEnvelope(envelope);
+    if (napiEnvelope == nullptr) {
+        HcfObjDestroy(envelope);
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "new napi envelope failed.");
+        return nullptr;
+    }
+    napi_status status = napi_wrap(env, instance, napiEnvelope,
+        [](napi_env env, void *data, void *hint) {
+            delete(static_cast<NapiEnvelope *>(data));
+        }, nullptr, nullptr);
+    if (status != napi_ok) {
+        delete napiEnvelope;
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "wrap napi envelope failed.");
+        return nullptr;
+    }
+    return instance;
+}
+
+napi_value NapiEnvelope::JsGetAlgorithm(napi_env env, napi_callback_info info)
+{
+    napi_value thisVar = nullptr;
+    NapiEnvelope *napiEnvelope = nullptr;
+    napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiEnvelope));
+    if (status != napi_ok || napiEnvelope == nullptr) {
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "failed to unwrap napiEnvelope obj!");
+        return nullptr;
+    }
+    HcfEnvelope *envelope = napiEnvelope->GetEnvelope();
+    const char *algo = envelope->getAlgoName(envelope);
+    napi_value instance = nullptr;
+    napi_create_string_utf8(env, algo, NAPI_AUTO_LENGTH, &instance);
+    return instance;
+}
+
+void NapiEnvelope::DefineEnvelopeJSClass(napi_env env, napi_value exports)
+{
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_FUNCTION("createEnvelope", NapiEnvelope::CreateJsEnvelope),
+    };
+    napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
+
+    napi_property_descriptor classDesc[] = {
+        DECLARE_NAPI_FUNCTION("seal", NapiEnvelope::JsSeal),
+        DECLARE_NAPI_FUNCTION("sealSync", NapiEnvelope::JsSealSync),
+        DECLARE_NAPI_FUNCTION("open", NapiEnvelope::JsOpen),
+        DECLARE_NAPI_FUNCTION("openSync", NapiEnvelope::JsOpenSync),
+        {.utf8name = "algName", .getter = NapiEnvelope::JsGetAlgorithm},
+    };
+    napi_value constructor = nullptr;
+    napi_define_class(env, "Envelope", NAPI_AUTO_LENGTH, NapiEnvelope::EnvelopeConstructor, nullptr,
+        sizeof(classDesc) / sizeof(classDesc[0]), classDesc, &constructor);
+    napi_create_reference(env, constructor, 1, &classRef_);
+}
+}  // namespace CryptoFramework
+}  // namespace OHOS
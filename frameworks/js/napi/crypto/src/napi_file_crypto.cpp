@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "napi_file_crypto.h"
+
+#include "securec.h"
+#include "file_crypto.h"
+#include "log.h"
+#include "memory.h"
+#include "utils.h"
+
+#include "napi_crypto_framework_defines.h"
+#include "napi_utils.h"
+
+namespace OHOS {
+namespace CryptoFramework {
+struct FileCryptoCtx {
+    napi_deferred deferred = nullptr;
+    napi_value promise = nullptr;
+    napi_async_work asyncWork = nullptr;
+    napi_ref objRef = nullptr;
+
+    FileCryptoType type = FILE_CRYPTO_MD;
+    HcfJsApiId apiId;
+    void *obj = nullptr;
+    int32_t inFd = -1;
+    int32_t outFd = -1;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+
+    HcfResult errCode = HCF_SUCCESS;
+    const char *errMsg = nullptr;
+    char *cryptoErrMsg = nullptr;
+};
+
+static void FreeFileCryptoCtx(napi_env env, FileCryptoCtx *ctx)
+{
+    if (ctx == nullptr) {
+        return;
+    }
+    if (ctx->asyncWork != nullptr) {
+        napi_delete_async_work(env, ctx->asyncWork);
+        ctx->asyncWork = nullptr;
+    }
+    if (ctx->objRef != nullptr) {
+        napi_delete_reference(env, ctx->objRef);
+        ctx->objRef = nullptr;
+    }
+    HcfFree(ctx->cryptoErrMsg);
+    HcfFree(ctx);
+}
+
+static HcfResult GetOptionalUint64(napi_env env, napi_value arg, uint64_t *value)
+{
+    napi_valuetype valueType = napi_undefined;
+    if (arg != nullptr) {
+        napi_typeof(env, arg, &valueType);
+    }
+    if (valueType == napi_null || valueType == napi_undefined) {
+        *value = 0;
+        return HCF_SUCCESS;
+    }
+    if (!GetUint64FromJSParams(env, arg, *value)) {
+        LOGE("Invalid offset or length.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult BuildFileCryptoCtx(napi_env env, napi_callback_info info, const FileCryptoApi &api,
+    FileCryptoCtx *ctx, napi_value *thisVar)
+{
+    size_t fdCount = (api.type == FILE_CRYPTO_CIPHER) ? ARGS_SIZE_TWO : ARGS_SIZE_ONE;
+    size_t argc = ARGS_SIZE_FOUR;
+    napi_value argv[ARGS_SIZE_FOUR] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, thisVar, nullptr);
+    if (argc < fdCount || argc > fdCount + ARGS_SIZE_TWO) {
+        LOGE("wrong argument num. [Argc]: %{public}zu!", argc);
+        return HCF_INVALID_PARAMS;
+    }
+    ctx->type = api.type;
+    ctx->apiId = api.apiId;
+    ctx->obj = api.getObj(env, *thisVar);
+    if (ctx->obj == nullptr) {
+        LOGE("failed to unwrap napi obj.");
+        return HCF_ERR_NAPI;
+    }
+    if (!GetInt32FromJSParams(env, argv[PARAM0], ctx->inFd) ||
+        ((api.type == FILE_CRYPTO_CIPHER) && !GetInt32FromJSParams(env, argv[PARAM1], ctx->outFd))) {
+        LOGE("Invalid fd.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfResult ret = GetOptionalUint64(env, argv[fdCount], &ctx->offset);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    return GetOptionalUint64(env, argv[fdCount + 1], &ctx->length);
+}
+
+static HcfResult DoFileCryptoUpdateFd(const FileCryptoCtx *ctx)
+{
+    switch (ctx->type) {
+        case FILE_CRYPTO_MD:
+            return HcfMdUpdateFd(static_cast<HcfMd *>(ctx->obj), ctx->inFd, ctx->offset, ctx->length);
+        case FILE_CRYPTO_MAC:
+            return HcfMacUpdateFd(static_cast<HcfMac *>(ctx->obj), ctx->inFd, ctx->offset, ctx->length);
+        case FILE_CRYPTO_CIPHER:
+            return HcfCipherUpdateFd(static_cast<HcfCipher *>(ctx->obj), ctx->inFd, ctx->offset, ctx->length,
+                ctx->outFd);
+        default:
+            return HCF_INVALID_PARAMS;
+    }
+}
+
+static void FileCryptoAsyncWorkProcess(napi_env env, void *data)
+{
+    FileCryptoCtx *ctx = static_cast<FileCryptoCtx *>(data);
+    HistogramScopeGuard guard(ctx->apiId);
+    ctx->errCode = DoFileCryptoUpdateFd(ctx);
+    if (ctx->errCode != HCF_SUCCESS) {
+        LOGE("update fd fail.");
+        ctx->errMsg = "update fd fail.";
+        HcfGetCryptoOperationErrMsg(ctx->errCode, &ctx->errMsg, &ctx->cryptoErrMsg);
+        guard.SetErrorCode(ctx->errCode);
+    }
+}
+
+static void FileCryptoAsyncWorkReturn(napi_env env, napi_status status, void *data)
+{
+    FileCryptoCtx *ctx = static_cast<FileCryptoCtx *>(data);
+    if (ctx->errCode == HCF_SUCCESS) {
+        napi_resolve_deferred(env, ctx->deferred, NapiGetNull(env));
+    } else {
+        napi_reject_deferred(env, ctx->deferred, GenerateBusinessError(env, ctx->errCode, ctx->errMsg));
+    }
+    FreeFileCryptoCtx(env, ctx);
+}
+
+static napi_value NewFileCryptoAsyncWork(napi_env env, FileCryptoCtx *ctx)
+{
+    napi_create_async_work(
+        env, nullptr, GetResourceName(env, "updateFd"),
+        [](napi_env env, void *data) {
+            FileCryptoAsyncWorkProcess(env, data);
+            return;
+        },
+        [](napi_env env, napi_status status, void *data) {
+            FileCryptoAsyncWorkReturn(env, status, data);
+            return;
+        },
+        static_cast<void *>(ctx),
+        &ctx->asyncWork);
+
+    napi_queue_async_work(env, ctx->asyncWork);
+    return ctx->promise;
+}
+
+napi_value NapiFileCryptoUpdateFd(napi_env env, napi_callback_info info, const FileCryptoApi &api, bool isSync)
+{
+    HistogramScopeGuard guard(api.apiId);
+    FileCryptoCtx *ctx = static_cast<FileCryptoCtx *>(HcfMalloc(sizeof(FileCryptoCtx), 0));
+    if (ctx == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "create context fail.");
+        return nullptr;
+    }
+    napi_value thisVar = nullptr;
+    HcfResult ret = BuildFileCryptoCtx(env, info, api, ctx, &thisVar);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "build context fail.");
+        FreeFileCryptoCtx(env, ctx);
+        return nullptr;
+    }
+    if (isSync) {
+        ret = DoFileCryptoUpdateFd(ctx);
+        FreeFileCryptoCtx(env, ctx);
+        if (ret != HCF_SUCCESS) {
+            guard.SetErrorCode(ret);
+            NAPI_LOG_THROW_EX(env, ret, "update fd fail.");
+            return nullptr;
+        }
+        return NapiGetNull(env);
+    }
+    // The reference keeps the object alive until the worker is done with it.
+    if (napi_create_reference(env, thisVar, 1, &ctx->objRef) != napi_ok) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "create ref fail.");
+        FreeFileCryptoCtx(env, ctx);
+        return nullptr;
+    }
+    napi_create_promise(env, &ctx->deferred, &ctx->promise);
+    guard.DisableScopeGuard();
+    return NewFileCryptoAsyncWork(env, ctx);
+}
+} // namespace CryptoFramework
+} // namespace OHOS
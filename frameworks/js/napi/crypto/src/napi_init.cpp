@@ -20,8 +20,10 @@
 #include "napi_asy_key_spec_generator.h"
 #include "napi_sym_key_generator.h"
 #include "napi_cipher.h"
+#include "napi_cipher_stream.h"
 #include "napi_dh_key_util.h"
 #include "napi_ecc_key_util.h"
+#include "napi_envelope.h"
 #include "napi_key_pair.h"
 #include "napi_pri_key.h"
 #include "napi_pub_key.h"
@@ -196,6 +198,20 @@ static napi_value CreateCipherSpecItemCode(napi_env env)
     AddUint32Property(env, code, "OAEP_MGF1_MD_STR", OAEP_MGF1_MD_STR);
     AddUint32Property(env, code, "SM2_MD_NAME_STR", SM2_MD_NAME_STR);
     AddUint32Property(env, code, "OAEP_MGF1_PSRC_UINT8ARR", OAEP_MGF1_PSRC_UINT8ARR);
+    AddUint32Property(env, code, "AEAD_NONCE_MODE_NUM", CIPHER_AEAD_NONCE_MODE_INT);
+    AddUint32Property(env, code, "AEAD_NONCE_FIXED_FIELD_UINT8ARR", CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR);
+    return code;
+}
+
+// enum AeadNonceMode in JS
+static napi_value CreateAeadNonceModeCode(napi_env env)
+{
+    napi_value code = nullptr;
+    napi_create_object(env, &code);
+
+    AddUint32Property(env, code, "EXTERNAL", HCF_AEAD_NONCE_EXTERNAL);
+    AddUint32Property(env, code, "COUNTER", HCF_AEAD_NONCE_COUNTER);
+    AddUint32Property(env, code, "RANDOM", HCF_AEAD_NONCE_RANDOM);
     return code;
 }
 
@@ -203,6 +219,7 @@ static void DefineCipherSpecItemProperties(napi_env env, napi_value exports)
 {
     napi_property_descriptor desc[] = {
         DECLARE_NAPI_PROPERTY("CipherSpecItem", CreateCipherSpecItemCode(env)),
+        DECLARE_NAPI_PROPERTY("AeadNonceMode", CreateAeadNonceModeCode(env)),
     };
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
 }
@@ -222,6 +239,7 @@ static napi_value CreateSignSpecItemCode(napi_env env)
     AddUint32Property(env, code, "ML_DSA_DETERMINISTIC_BOOL", ML_DSA_DETERMINISTIC_BOOL);
     AddUint32Property(env, code, "ML_DSA_MU_BOOL", ML_DSA_MU_BOOL);
     AddUint32Property(env, code, "ML_DSA_CONTEXT_UINT8ARR", ML_DSA_CONTEXT_UINT8ARR);
+    AddUint32Property(env, code, "SIGN_PREHASH_BOOL", SIGN_PREHASH_BOOL);
     return code;
 }
 
@@ -286,8 +304,10 @@ static napi_value ModuleExport(napi_env env, napi_value exports)
     NapiMd::DefineMdJSClass(env, exports);
     NapiRand::DefineRandJSClass(env, exports);
     NapiCipher::DefineCipherJSClass(env, exports);
+    NapiCipherStream::DefineCipherStreamJSClass(env, exports);
     NapiKdf::DefineKdfJSClass(env, exports);
     NapiKem::DefineKemJSClass(env, exports);
+    NapiEnvelope::DefineEnvelopeJSClass(env, exports);
     NapiECCKeyUtil::DefineNapiECCKeyUtilJSClass(env, exports);
     NapiDHKeyUtil::DefineNapiDHKeyUtilJSClass(env, exports);
     NapiSm2CryptoUtil::DefineNapiSm2CryptoUtilJSClass(env, exports);
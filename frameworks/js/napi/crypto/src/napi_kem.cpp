@@ -27,7 +27,9 @@ namespace CryptoFramework {
 
 enum KemOpType {
     KEM_ENCAPSULATE = 1,
-    KEM_DECAPSULATE = 2
+    KEM_DECAPSULATE = 2,
+    KEM_ENCAPSULATE_BATCH = 3,
+    KEM_DECAPSULATE_BATCH = 4
 };
 
 struct KemCtx {
@@ -46,6 +48,9 @@ struct KemCtx {
     HcfPriKey *priKey = nullptr;
     HcfBlob *ikme = nullptr;
     HcfBlob *wrappedKey = nullptr;
+    HcfPubKey **pubKeys = nullptr;
+    uint32_t pubKeyNum = 0;
+    uint32_t workerNum = 0;
 
     HcfResult errCode = HCF_SUCCESS;
     const char *errMsg = nullptr;
@@ -108,6 +113,7 @@ static void FreeKemCtx(napi_env env, KemCtx *ctx)
         HcfBlobDataClearAndFree(ctx->wrappedKey);
         HCF_FREE_PTR(ctx->wrappedKey);
     }
+    HCF_FREE_PTR(ctx->pubKeys);
     HcfFree(ctx);
 }
 
@@ -122,6 +128,120 @@ static napi_value BuildEncapsulateResult(napi_env env, HcfBlob *sharedSecret, Hc
     return result;
 }
 
+static napi_value BuildEncapsulateBatchResult(napi_env env, HcfBlob *sharedSecrets, HcfBlob *wrappedKeys)
+{
+    napi_value result = nullptr;
+    napi_create_object(env, &result);
+    napi_value sharedSecretsData = ConvertObjectBlobToNapiValue(env, sharedSecrets);
+    napi_value wrappedKeysData = ConvertObjectBlobToNapiValue(env, wrappedKeys);
+    napi_set_named_property(env, result, "sharedSecrets", sharedSecretsData);
+    napi_set_named_property(env, result, "wrappedKeys", wrappedKeysData);
+    return result;
+}
+
+static HcfResult AllocKemBatchBlob(uint32_t count, uint32_t unitLen, HcfBlob *blob)
+{
+    if (unitLen == 0 || count > SIZE_MAX / unitLen) {
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    blob->data = static_cast<uint8_t *>(HcfMalloc(static_cast<size_t>(count) * unitLen, 0));
+    if (blob->data == nullptr) {
+        return HCF_ERR_MALLOC;
+    }
+    blob->len = static_cast<size_t>(count) * unitLen;
+    return HCF_SUCCESS;
+}
+
+static HcfResult DoKemEncapsulateBatch(HcfKem *kem, HcfPubKey **pubKeys, uint32_t count, uint32_t workerNum,
+    HcfBlob *sharedSecrets, HcfBlob *wrappedKeys)
+{
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    HcfResult ret = kem->getOutputLen(kem, &sharedSecretLen, &wrappedKeyLen);
+    if (ret == HCF_SUCCESS) {
+        ret = AllocKemBatchBlob(count, sharedSecretLen, sharedSecrets);
+    }
+    if (ret == HCF_SUCCESS) {
+        ret = AllocKemBatchBlob(count, wrappedKeyLen, wrappedKeys);
+    }
+    if (ret == HCF_SUCCESS) {
+        ret = kem->encapsulateBatch(kem, pubKeys, count, workerNum, sharedSecrets, wrappedKeys);
+    }
+    if (ret != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(sharedSecrets);
+        HcfBlobDataClearAndFree(wrappedKeys);
+    }
+    return ret;
+}
+
+/* The number of wrapped keys follows from the length of the input, which must be a multiple of one wrapped key. */
+static HcfResult DoKemDecapsulateBatch(HcfKem *kem, HcfPriKey *priKey, const HcfBlob *wrappedKeys,
+    uint32_t workerNum, HcfBlob *sharedSecrets)
+{
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    HcfResult ret = kem->getOutputLen(kem, &sharedSecretLen, &wrappedKeyLen);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (wrappedKeys->len == 0 || wrappedKeys->len % wrappedKeyLen != 0 ||
+        wrappedKeys->len / wrappedKeyLen > UINT32_MAX) {
+        LOGE("Wrapped keys length is not a multiple of one wrapped key.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    uint32_t count = static_cast<uint32_t>(wrappedKeys->len / wrappedKeyLen);
+    ret = AllocKemBatchBlob(count, sharedSecretLen, sharedSecrets);
+    if (ret == HCF_SUCCESS) {
+        ret = kem->decapsulateBatch(kem, priKey, wrappedKeys, count, workerNum, sharedSecrets);
+    }
+    if (ret != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(sharedSecrets);
+    }
+    return ret;
+}
+
+static HcfResult GetPubKeysFromNapiArray(napi_env env, napi_value arg, HcfPubKey ***pubKeys, uint32_t *count)
+{
+    bool isArray = false;
+    uint32_t length = 0;
+    if (napi_is_array(env, arg, &isArray) != napi_ok || !isArray ||
+        napi_get_array_length(env, arg, &length) != napi_ok || length == 0) {
+        LOGE("PubKeys is not a non-empty array.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    HcfPubKey **keys = static_cast<HcfPubKey **>(HcfMalloc(sizeof(HcfPubKey *) * length, 0));
+    if (keys == nullptr) {
+        return HCF_ERR_MALLOC;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        napi_value element = nullptr;
+        NapiPubKey *napiPubKey = nullptr;
+        if (napi_get_element(env, arg, i, &element) != napi_ok || IsNapiValueNullOrUndefined(env, element) ||
+            napi_unwrap(env, element, reinterpret_cast<void **>(&napiPubKey)) != napi_ok || napiPubKey == nullptr) {
+            LOGE("PubKey %{public}u is invalid.", i);
+            HcfFree(keys);
+            return HCF_ERR_PARAMETER_CHECK_FAILED;
+        }
+        keys[i] = napiPubKey->GetPubKey();
+    }
+    *pubKeys = keys;
+    *count = length;
+    return HCF_SUCCESS;
+}
+
+static HcfResult GetKemBatchWorkerNum(napi_env env, napi_value arg, uint32_t *workerNum)
+{
+    if (arg == nullptr || IsNapiValueNullOrUndefined(env, arg)) {
+        *workerNum = 0;
+        return HCF_SUCCESS;
+    }
+    if (!GetUint32FromJSParams(env, arg, *workerNum) || *workerNum > HCF_KEM_MAX_BATCH_WORKER_NUM) {
+        LOGE("Invalid worker num.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return HCF_SUCCESS;
+}
+
 static void ReturnCallbackResult(napi_env env, KemCtx *ctx, napi_value result)
 {
     napi_value businessError = nullptr;
@@ -245,10 +365,100 @@ static HcfResult BuildDecapsulateCtx(napi_env env, napi_callback_info info, KemC
     return SetupKemAsyncCtx(env, thisVar, argv[PARAM0], argv[expectedArgc - 1], ctx);
 }
 
+static HcfResult BuildEncapsulateBatchCtx(napi_env env, napi_callback_info info, KemCtx *ctx)
+{
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_TWO;
+    napi_value argv[PARAMS_NUM_TWO] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_ONE && argc != PARAMS_NUM_TWO) {
+        return HCF_INVALID_PARAMS;
+    }
+    ctx->asyncType = ASYNC_PROMISE;
+    NapiKem *napiKem = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiKem));
+    if (status != napi_ok || napiKem == nullptr) {
+        return HCF_ERR_NAPI;
+    }
+    HcfResult ret = GetPubKeysFromNapiArray(env, argv[PARAM0], &ctx->pubKeys, &ctx->pubKeyNum);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = GetKemBatchWorkerNum(env, argv[PARAM1], &ctx->workerNum);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ctx->kem = napiKem->GetKem();
+    ctx->opType = KEM_ENCAPSULATE_BATCH;
+    return SetupKemAsyncCtx(env, thisVar, argv[PARAM0], nullptr, ctx);
+}
+
+static HcfResult BuildDecapsulateBatchCtx(napi_env env, napi_callback_info info, KemCtx *ctx)
+{
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_THREE;
+    napi_value argv[PARAMS_NUM_THREE] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_TWO && argc != PARAMS_NUM_THREE) {
+        return HCF_INVALID_PARAMS;
+    }
+    ctx->asyncType = ASYNC_PROMISE;
+    NapiKem *napiKem = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiKem));
+    if (status != napi_ok || napiKem == nullptr) {
+        return HCF_ERR_NAPI;
+    }
+    if (IsNapiValueNullOrUndefined(env, argv[PARAM0]) || IsNapiValueNullOrUndefined(env, argv[PARAM1])) {
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    NapiPriKey *napiPriKey = nullptr;
+    status = napi_unwrap(env, argv[PARAM0], reinterpret_cast<void **>(&napiPriKey));
+    if (status != napi_ok || napiPriKey == nullptr) {
+        return HCF_ERR_NAPI;
+    }
+    HcfResult ret = GetKemBatchWorkerNum(env, argv[PARAM2], &ctx->workerNum);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ctx->wrappedKey = GetBlobFromNapiUint8Arr(env, argv[PARAM1]);
+    if (ctx->wrappedKey == nullptr) {
+        return HCF_ERR_NAPI;
+    }
+    ctx->kem = napiKem->GetKem();
+    ctx->priKey = napiPriKey->GetPriKey();
+    ctx->opType = KEM_DECAPSULATE_BATCH;
+    return SetupKemAsyncCtx(env, thisVar, argv[PARAM0], nullptr, ctx);
+}
+
+static void KemBatchAsyncWorkProcess(KemCtx *ctx)
+{
+    if (ctx->opType == KEM_ENCAPSULATE_BATCH) {
+        HistogramScopeGuard guard(API_KEM_ENCAPSULATE_BATCH);
+        ctx->errCode = DoKemEncapsulateBatch(ctx->kem, ctx->pubKeys, ctx->pubKeyNum, ctx->workerNum,
+            &ctx->returnSharedSecret, &ctx->returnWrappedKey);
+        if (ctx->errCode != HCF_SUCCESS) {
+            ctx->errMsg = "kem encapsulate batch failed.";
+            guard.SetErrorCode(ctx->errCode);
+        }
+        return;
+    }
+    HistogramScopeGuard guard(API_KEM_DECAPSULATE_BATCH);
+    ctx->errCode = DoKemDecapsulateBatch(ctx->kem, ctx->priKey, ctx->wrappedKey, ctx->workerNum,
+        &ctx->returnSharedSecret);
+    if (ctx->errCode != HCF_SUCCESS) {
+        ctx->errMsg = "kem decapsulate batch failed.";
+        guard.SetErrorCode(ctx->errCode);
+    }
+}
+
 static void KemAsyncWorkProcess(napi_env env, void *data)
 {
     (void)env;
     KemCtx *ctx = static_cast<KemCtx *>(data);
+    if (ctx->opType == KEM_ENCAPSULATE_BATCH || ctx->opType == KEM_DECAPSULATE_BATCH) {
+        KemBatchAsyncWorkProcess(ctx);
+        return;
+    }
     if (ctx->opType == KEM_ENCAPSULATE) {
         HistogramScopeGuard guard(API_KEM_ENCAPSULATE);
         const HcfBlob *ikmePtr = (ctx->ikme == nullptr) ? nullptr : ctx->ikme;
@@ -277,6 +487,8 @@ static void KemAsyncWorkReturn(napi_env env, napi_status status, void *data)
     if (ctx->errCode == HCF_SUCCESS) {
         if (ctx->opType == KEM_ENCAPSULATE) {
             result = BuildEncapsulateResult(env, &ctx->returnSharedSecret, &ctx->returnWrappedKey);
+        } else if (ctx->opType == KEM_ENCAPSULATE_BATCH) {
+            result = BuildEncapsulateBatchResult(env, &ctx->returnSharedSecret, &ctx->returnWrappedKey);
         } else {
             result = ConvertObjectBlobToNapiValue(env, &ctx->returnSharedSecret);
         }
@@ -462,6 +674,143 @@ napi_value NapiKem::JsDecapsulateSync(napi_env env, napi_callback_info info)
     return result;
 }
 
+napi_value NapiKem::JsEncapsulateBatch(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_KEM_ENCAPSULATE_BATCH);
+    KemCtx *ctx = static_cast<KemCtx *>(HcfMalloc(sizeof(KemCtx), 0));
+    if (ctx == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "create context fail.");
+        return nullptr;
+    }
+    HcfResult ret = BuildEncapsulateBatchCtx(env, info, ctx);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, ret, "build encapsulate batch context fail.");
+        FreeKemCtx(env, ctx);
+        return nullptr;
+    }
+    guard.DisableScopeGuard();
+    return NewKemAsyncWork(env, ctx, "KemEncapsulateBatch");
+}
+
+napi_value NapiKem::JsDecapsulateBatch(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_KEM_DECAPSULATE_BATCH);
+    KemCtx *ctx = static_cast<KemCtx *>(HcfMalloc(sizeof(KemCtx), 0));
+    if (ctx == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "create context fail.");
+        return nullptr;
+    }
+    HcfResult ret = BuildDecapsulateBatchCtx(env, info, ctx);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, ret, "build decapsulate batch context fail.");
+        FreeKemCtx(env, ctx);
+        return nullptr;
+    }
+    guard.DisableScopeGuard();
+    return NewKemAsyncWork(env, ctx, "KemDecapsulateBatch");
+}
+
+napi_value NapiKem::JsEncapsulateBatchSync(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_KEM_ENCAPSULATE_BATCH_SYNC);
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_TWO;
+    napi_value argv[PARAMS_NUM_TWO] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_ONE && argc != PARAMS_NUM_TWO) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "wrong argument num.");
+        return nullptr;
+    }
+    NapiKem *napiKem = nullptr;
+    if (napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiKem)) != napi_ok || napiKem == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "unwrap napi object failed.");
+        return nullptr;
+    }
+    uint32_t workerNum = 0;
+    HcfPubKey **pubKeys = nullptr;
+    uint32_t count = 0;
+    HcfResult ret = GetKemBatchWorkerNum(env, argv[PARAM1], &workerNum);
+    if (ret == HCF_SUCCESS) {
+        ret = GetPubKeysFromNapiArray(env, argv[PARAM0], &pubKeys, &count);
+    }
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "parse encapsulate batch params failed.");
+        return nullptr;
+    }
+    HcfBlob sharedSecrets = { .data = nullptr, .len = 0 };
+    HcfBlob wrappedKeys = { .data = nullptr, .len = 0 };
+    ret = DoKemEncapsulateBatch(napiKem->GetKem(), pubKeys, count, workerNum, &sharedSecrets, &wrappedKeys);
+    HcfFree(pubKeys);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "kem encapsulate batch failed.");
+        return nullptr;
+    }
+    napi_value result = BuildEncapsulateBatchResult(env, &sharedSecrets, &wrappedKeys);
+    HcfBlobDataClearAndFree(&sharedSecrets);
+    HcfBlobDataClearAndFree(&wrappedKeys);
+    return result;
+}
+
+napi_value NapiKem::JsDecapsulateBatchSync(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_KEM_DECAPSULATE_BATCH_SYNC);
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_THREE;
+    napi_value argv[PARAMS_NUM_THREE] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_TWO && argc != PARAMS_NUM_THREE) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "wrong argument num.");
+        return nullptr;
+    }
+    if (IsNapiValueNullOrUndefined(env, argv[PARAM0]) || IsNapiValueNullOrUndefined(env, argv[PARAM1])) {
+        guard.SetErrorCode(HCF_ERR_PARAMETER_CHECK_FAILED);
+        NAPI_LOG_THROW(env, HCF_ERR_PARAMETER_CHECK_FAILED, "priKey or wrappedKeys is null or undefined.");
+        return nullptr;
+    }
+    NapiKem *napiKem = nullptr;
+    NapiPriKey *napiPriKey = nullptr;
+    if (napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiKem)) != napi_ok || napiKem == nullptr ||
+        napi_unwrap(env, argv[PARAM0], reinterpret_cast<void **>(&napiPriKey)) != napi_ok || napiPriKey == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "unwrap napi object failed.");
+        return nullptr;
+    }
+    uint32_t workerNum = 0;
+    HcfResult ret = GetKemBatchWorkerNum(env, argv[PARAM2], &workerNum);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "invalid worker num.");
+        return nullptr;
+    }
+    HcfBlob *wrappedKeys = GetBlobFromNapiUint8Arr(env, argv[PARAM1]);
+    if (wrappedKeys == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "parse wrappedKeys failed.");
+        return nullptr;
+    }
+    HcfBlob sharedSecrets = { .data = nullptr, .len = 0 };
+    ret = DoKemDecapsulateBatch(napiKem->GetKem(), napiPriKey->GetPriKey(), wrappedKeys, workerNum, &sharedSecrets);
+    HcfBlobDataClearAndFree(wrappedKeys);
+    HCF_FREE_PTR(wrappedKeys);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "kem decapsulate batch failed.");
+        return nullptr;
+    }
+    napi_value result = ConvertObjectBlobToNapiValue(env, &sharedSecrets);
+    HcfBlobDataClearAndFree(&sharedSecrets);
+    return result;
+}
+
 napi_value NapiKem::KemConstructor(napi_env env, napi_callback_info info)
 {
     napi_value thisVar = nullptr;
@@ -541,6 +890,10 @@ void NapiKem::DefineKemJSClass(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("encapsulateSync", NapiKem::JsEncapsulateSync),
         DECLARE_NAPI_FUNCTION("decapsulate", NapiKem::JsDecapsulate),
         DECLARE_NAPI_FUNCTION("decapsulateSync", NapiKem::JsDecapsulateSync),
+        DECLARE_NAPI_FUNCTION("encapsulateBatch", NapiKem::JsEncapsulateBatch),
+        DECLARE_NAPI_FUNCTION("encapsulateBatchSync", NapiKem::JsEncapsulateBatchSync),
+        DECLARE_NAPI_FUNCTION("decapsulateBatch", NapiKem::JsDecapsulateBatch),
+        DECLARE_NAPI_FUNCTION("decapsulateBatchSync", NapiKem::JsDecapsulateBatchSync),
     };
     napi_value constructor = nullptr;
     napi_define_class(env, "Kem", NAPI_AUTO_LENGTH, NapiKem::KemConstructor, nullptr,
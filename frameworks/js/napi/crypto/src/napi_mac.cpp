@@ -22,6 +22,7 @@
 #include "mac_params.h"
 #include "detailed_hmac_params.h"
 #include "detailed_cmac_params.h"
+#include "napi_file_crypto.h"
 #include "napi_sym_key.h"
 #include "napi_utils.h"
 #include "napi_crypto_framework_defines.h"
@@ -631,6 +632,28 @@ napi_value NapiMac::JsMacDoFinalSync(napi_env env, napi_callback_info info)
     return returnOutBlob;
 }
 
+static void *GetMacFromThis(napi_env env, napi_value thisVar)
+{
+    NapiMac *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || obj == nullptr) {
+        return nullptr;
+    }
+    return obj->GetMac();
+}
+
+napi_value NapiMac::JsMacUpdateFd(napi_env env, napi_callback_info info)
+{
+    FileCryptoApi api = { FILE_CRYPTO_MAC, API_MAC_UPDATE_FD, GetMacFromThis };
+    return NapiFileCryptoUpdateFd(env, info, api, false);
+}
+
+napi_value NapiMac::JsMacUpdateFdSync(napi_env env, napi_callback_info info)
+{
+    FileCryptoApi api = { FILE_CRYPTO_MAC, API_MAC_UPDATE_FD_SYNC, GetMacFromThis };
+    return NapiFileCryptoUpdateFd(env, info, api, true);
+}
+
 napi_value NapiMac::JsGetMacLength(napi_env env, napi_callback_info info)
 {
     HistogramScopeGuard guard(API_MAC_GET_MAC_LENGTH);
@@ -919,6 +942,8 @@ void NapiMac::DefineMacJSClass(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("doFinal", NapiMac::JsMacDoFinal),
         DECLARE_NAPI_FUNCTION("doFinalSync", NapiMac::JsMacDoFinalSync),
         DECLARE_NAPI_FUNCTION("getMacLength", NapiMac::JsGetMacLength),
+        DECLARE_NAPI_FUNCTION("updateFd", NapiMac::JsMacUpdateFd),
+        DECLARE_NAPI_FUNCTION("updateFdSync", NapiMac::JsMacUpdateFdSync),
     };
     napi_value constructor = nullptr;
     napi_define_class(env, "Mac", NAPI_AUTO_LENGTH, MacConstructor, nullptr,
@@ -19,6 +19,7 @@
 #include "log.h"
 #include "memory.h"
 
+#include "napi_file_crypto.h"
 #include "napi_utils.h"
 #include "napi_crypto_framework_defines.h"
 
@@ -475,6 +476,28 @@ napi_value NapiMd::JsGetMdLength(napi_env env, napi_callback_info info)
     return napiLen;
 }
 
+static void *GetMdFromThis(napi_env env, napi_value thisVar)
+{
+    NapiMd *obj = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&obj));
+    if (status != napi_ok || obj == nullptr) {
+        return nullptr;
+    }
+    return obj->GetMd();
+}
+
+napi_value NapiMd::JsMdUpdateFd(napi_env env, napi_callback_info info)
+{
+    FileCryptoApi api = { FILE_CRYPTO_MD, API_MD_UPDATE_FD, GetMdFromThis };
+    return NapiFileCryptoUpdateFd(env, info, api, false);
+}
+
+napi_value NapiMd::JsMdUpdateFdSync(napi_env env, napi_callback_info info)
+{
+    FileCryptoApi api = { FILE_CRYPTO_MD, API_MD_UPDATE_FD_SYNC, GetMdFromThis };
+    return NapiFileCryptoUpdateFd(env, info, api, true);
+}
+
 napi_value NapiMd::MdConstructor(napi_env env, napi_callback_info info)
 {
     napi_value thisVar = nullptr;
@@ -554,6 +577,8 @@ void NapiMd::DefineMdJSClass(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("digest", NapiMd::JsMdDoFinal),
         DECLARE_NAPI_FUNCTION("digestSync", NapiMd::JsMdDoFinalSync),
         DECLARE_NAPI_FUNCTION("getMdLength", NapiMd::JsGetMdLength),
+        DECLARE_NAPI_FUNCTION("updateFd", NapiMd::JsMdUpdateFd),
+        DECLARE_NAPI_FUNCTION("updateFdSync", NapiMd::JsMdUpdateFdSync),
     };
     napi_value constructor = nullptr;
     napi_define_class(env, "Md", NAPI_AUTO_LENGTH, MdConstructor, nullptr,
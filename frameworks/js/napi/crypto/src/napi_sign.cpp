@@ -84,6 +84,26 @@ struct SignDoFinalCtx {
     HcfBlob returnSignatureData;
 };
 
+struct SignBatchCtx {
+    napi_env env = nullptr;
+
+    napi_deferred deferred = nullptr;
+    napi_value promise = nullptr;
+    napi_async_work asyncWork = nullptr;
+    napi_ref signRef = nullptr;
+
+    HcfSign *sign = nullptr;
+    HcfBlob *inputs = nullptr;
+    uint32_t count = 0;
+    uint32_t workerNum = 0;
+
+    HcfResult errCode = HCF_SUCCESS;
+    const char *errMsg = nullptr;
+    char *cryptoErrMsg = nullptr;
+    HcfBlob returnArena;
+    HcfBlob *returnSignatures = nullptr;
+};
+
 thread_local napi_ref NapiSign::classRef_ = nullptr;
 
 static bool IsMlDsaSign(HcfSign *sign, SignSpecItem item)
@@ -189,6 +209,41 @@ static void FreeSignDoFinalCtx(napi_env env, SignDoFinalCtx *ctx)
     HcfFree(ctx);
 }
 
+static void FreeSignBatchInputs(HcfBlob *inputs, uint32_t count)
+{
+    if (inputs == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        HcfBlobDataClearAndFree(&inputs[i]);
+    }
+    HcfFree(inputs);
+}
+
+static void FreeSignBatchCtx(napi_env env, SignBatchCtx *ctx)
+{
+    if (ctx == nullptr) {
+        return;
+    }
+
+    if (ctx->asyncWork != nullptr) {
+        napi_delete_async_work(env, ctx->asyncWork);
+        ctx->asyncWork = nullptr;
+    }
+
+    if (ctx->signRef != nullptr) {
+        napi_delete_reference(env, ctx->signRef);
+        ctx->signRef = nullptr;
+    }
+
+    HcfBlobDataFree(&ctx->returnArena);
+    HCF_FREE_PTR(ctx->returnSignatures);
+    FreeSignBatchInputs(ctx->inputs, ctx->count);
+    ctx->inputs = nullptr;
+    HcfFree(ctx->cryptoErrMsg);
+    HcfFree(ctx);
+}
+
 static bool BuildSignJsInitCtx(napi_env env, napi_callback_info info, SignInitCtx *ctx)
 {
     napi_value thisVar = nullptr;
@@ -333,6 +388,127 @@ static bool BuildSignJsDoFinalCtx(napi_env env, napi_callback_info info, SignDoF
     }
 }
 
+static HcfResult GetSignBatchInputs(napi_env env, napi_value arg, HcfBlob **inputs, uint32_t *count)
+{
+    bool isArray = false;
+    uint32_t length = 0;
+    if (napi_is_array(env, arg, &isArray) != napi_ok || !isArray ||
+        napi_get_array_length(env, arg, &length) != napi_ok || length == 0) {
+        LOGE("Data is not a non-empty array.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    HcfBlob *blobs = static_cast<HcfBlob *>(HcfMalloc(sizeof(HcfBlob) * length, 0));
+    if (blobs == nullptr) {
+        LOGE("Failed to allocate inputs memory!");
+        return HCF_ERR_MALLOC;
+    }
+    for (uint32_t i = 0; i < length; i++) {
+        napi_value element = nullptr;
+        HcfBlob *blob = nullptr;
+        if (napi_get_element(env, arg, i, &element) == napi_ok) {
+            blob = GetBlobFromNapiDataBlob(env, element);
+        }
+        if (blob == nullptr) {
+            LOGE("Data %{public}u is invalid.", i);
+            FreeSignBatchInputs(blobs, i);
+            return HCF_ERR_PARAMETER_CHECK_FAILED;
+        }
+        blobs[i] = *blob;
+        HcfFree(blob);
+    }
+    *inputs = blobs;
+    *count = length;
+    return HCF_SUCCESS;
+}
+
+static HcfResult GetSignBatchWorkerNum(napi_env env, napi_value arg, uint32_t *workerNum)
+{
+    napi_valuetype valueType = napi_undefined;
+    if (arg != nullptr) {
+        napi_typeof(env, arg, &valueType);
+    }
+    if (valueType == napi_null || valueType == napi_undefined) {
+        *workerNum = 0;
+        return HCF_SUCCESS;
+    }
+    if (!GetUint32FromJSParams(env, arg, *workerNum) || *workerNum > HCF_SIGN_MAX_BATCH_WORKER_NUM) {
+        LOGE("Invalid worker num.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult DoSignBatch(HcfSign *sign, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob **returnSignatures)
+{
+    HcfBlob *signatures = static_cast<HcfBlob *>(HcfMalloc(sizeof(HcfBlob) * count, 0));
+    if (signatures == nullptr) {
+        LOGE("Failed to allocate signatures memory!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = sign->signBatch(sign, inputs, count, workerNum, returnArena, signatures);
+    if (ret != HCF_SUCCESS) {
+        HcfFree(signatures);
+        return ret;
+    }
+    *returnSignatures = signatures;
+    return HCF_SUCCESS;
+}
+
+static napi_value ConvertSignaturesToNapiArray(napi_env env, HcfBlob *signatures, uint32_t count)
+{
+    napi_value array = nullptr;
+    if (napi_create_array_with_length(env, count, &array) != napi_ok) {
+        LOGE("create signature array failed!");
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        napi_value dataBlob = ConvertBlobToNapiValue(env, &signatures[i]);
+        napi_valuetype valueType = napi_null;
+        napi_typeof(env, dataBlob, &valueType);
+        if (valueType == napi_null || napi_set_element(env, array, i, dataBlob) != napi_ok) {
+            LOGE("convert signature %{public}u failed!", i);
+            return nullptr;
+        }
+    }
+    return array;
+}
+
+static HcfResult BuildSignJsBatchCtx(napi_env env, napi_callback_info info, SignBatchCtx *ctx)
+{
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_TWO;
+    napi_value argv[PARAMS_NUM_TWO] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_ONE && argc != PARAMS_NUM_TWO) {
+        LOGE("wrong argument num. require 1 or 2 arguments. [Argc]: %{public}zu!", argc);
+        return HCF_INVALID_PARAMS;
+    }
+
+    NapiSign *napiSign = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiSign));
+    if (status != napi_ok || napiSign == nullptr) {
+        LOGE("failed to unwrap napi sign obj.");
+        return HCF_ERR_NAPI;
+    }
+    HcfResult ret = GetSignBatchWorkerNum(env, argv[PARAM1], &ctx->workerNum);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = GetSignBatchInputs(env, argv[PARAM0], &ctx->inputs, &ctx->count);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ctx->sign = napiSign->GetSign();
+
+    if (napi_create_reference(env, thisVar, 1, &ctx->signRef) != napi_ok) {
+        LOGE("create sign ref failed when do sign batch!");
+        return HCF_ERR_NAPI;
+    }
+    napi_create_promise(env, &ctx->deferred, &ctx->promise);
+    return HCF_SUCCESS;
+}
+
 static void ReturnInitCallbackResult(napi_env env, SignInitCtx *ctx, napi_value result)
 {
     napi_value businessError = nullptr;
@@ -497,6 +673,64 @@ static void SignJsDoFinalAsyncWorkReturn(napi_env env, napi_status status, void
     FreeSignDoFinalCtx(env, ctx);
 }
 
+static void SignJsBatchAsyncWorkProcess(napi_env env, void *data)
+{
+    HistogramScopeGuard guard(API_SIGN_SIGN_BATCH);
+    SignBatchCtx *ctx = static_cast<SignBatchCtx *>(data);
+
+    ctx->errCode = DoSignBatch(ctx->sign, ctx->inputs, ctx->count, ctx->workerNum, &ctx->returnArena,
+        &ctx->returnSignatures);
+    if (ctx->errCode != HCF_SUCCESS) {
+        LOGE("sign batch fail.");
+        ctx->errMsg = "sign batch fail.";
+        HcfGetCryptoOperationErrMsg(ctx->errCode, &ctx->errMsg, &ctx->cryptoErrMsg);
+        guard.SetErrorCode(ctx->errCode);
+    }
+}
+
+static void SignJsBatchAsyncWorkReturn(napi_env env, napi_status status, void *data)
+{
+    SignBatchCtx *ctx = static_cast<SignBatchCtx *>(data);
+
+    napi_value result = nullptr;
+    if (ctx->errCode == HCF_SUCCESS) {
+        result = ConvertSignaturesToNapiArray(env, ctx->returnSignatures, ctx->count);
+        if (result == nullptr) {
+            ctx->errCode = HCF_ERR_NAPI;
+            ctx->errMsg = "sign batch convert signatures failed.";
+        }
+    }
+
+    if (ctx->errCode == HCF_SUCCESS) {
+        napi_resolve_deferred(env, ctx->deferred, result);
+    } else {
+        napi_reject_deferred(env, ctx->deferred, GenerateBusinessError(env, ctx->errCode, ctx->errMsg));
+    }
+    FreeSignBatchCtx(env, ctx);
+}
+
+static napi_value NewSignJsBatchAsyncWork(napi_env env, SignBatchCtx *ctx)
+{
+    napi_value resourceName = nullptr;
+    napi_create_string_utf8(env, "signBatch", NAPI_AUTO_LENGTH, &resourceName);
+
+    napi_create_async_work(
+        env, nullptr, resourceName,
+        [](napi_env env, void *data) {
+            SignJsBatchAsyncWorkProcess(env, data);
+            return;
+        },
+        [](napi_env env, napi_status status, void *data) {
+            SignJsBatchAsyncWorkReturn(env, status, data);
+            return;
+        },
+        static_cast<void *>(ctx),
+        &ctx->asyncWork);
+
+    napi_queue_async_work(env, ctx->asyncWork);
+    return ctx->promise;
+}
+
 static napi_value NewSignJsInitAsyncWork(napi_env env, SignInitCtx *ctx)
 {
     napi_value resourceName = nullptr;
@@ -917,7 +1151,7 @@ static HcfResult SetSignMlDsaContext(napi_env env, napi_value *argv, HcfSign *si
     return ret;
 }
 
-static HcfResult SetSignMlDsaBool(napi_env env, napi_value *argv, SignSpecItem item, HcfSign *sign)
+static HcfResult SetSignSpecBool(napi_env env, napi_value *argv, SignSpecItem item, HcfSign *sign)
 {
     napi_valuetype valueType;
     napi_typeof(env, argv[1], &valueType);
@@ -953,7 +1187,8 @@ static HcfResult SetDetailSignSpec(napi_env env, napi_value *argv, SignSpecItem
             break;
         case ML_DSA_DETERMINISTIC_BOOL:
         case ML_DSA_MU_BOOL:
-            result = SetSignMlDsaBool(env, argv, item, sign);
+        case SIGN_PREHASH_BOOL:
+            result = SetSignSpecBool(env, argv, item, sign);
             break;
         default:
             LOGE("specItem not support.");
@@ -1085,6 +1320,111 @@ napi_value NapiSign::JsGetSignSpec(napi_env env, napi_callback_info info)
     }
 }
 
+napi_value NapiSign::JsReset(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_SIGN_RESET);
+    napi_value thisVar = nullptr;
+    napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+
+    NapiSign *napiSign = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiSign));
+    if (status != napi_ok || napiSign == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "failed to unwrap napi sign obj.");
+        return nullptr;
+    }
+
+    HcfSign *sign = napiSign->GetSign();
+    HcfResult ret = sign->reset(sign);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW_EX(env, ret, "sign reset fail.");
+        return nullptr;
+    }
+    napi_value instance = NapiGetNull(env);
+    return instance;
+}
+
+napi_value NapiSign::JsSignBatch(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_SIGN_SIGN_BATCH);
+    SignBatchCtx *ctx = static_cast<SignBatchCtx *>(HcfMalloc(sizeof(SignBatchCtx), 0));
+    if (ctx == nullptr) {
+        guard.SetErrorCode(HCF_ERR_MALLOC);
+        NAPI_LOG_THROW(env, HCF_ERR_MALLOC, "create context fail.");
+        return nullptr;
+    }
+
+    HcfResult ret = BuildSignJsBatchCtx(env, info, ctx);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "build context fail.");
+        FreeSignBatchCtx(env, ctx);
+        return nullptr;
+    }
+
+    guard.DisableScopeGuard();
+    return NewSignJsBatchAsyncWork(env, ctx);
+}
+
+napi_value NapiSign::JsSignBatchSync(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_SIGN_SIGN_BATCH_SYNC);
+    napi_value thisVar = nullptr;
+    size_t argc = PARAMS_NUM_TWO;
+    napi_value argv[PARAMS_NUM_TWO] = { nullptr };
+    napi_get_cb_info(env, info, &argc, argv, &thisVar, nullptr);
+    if (argc != PARAMS_NUM_ONE && argc != PARAMS_NUM_TWO) {
+        guard.SetErrorCode(HCF_INVALID_PARAMS);
+        NAPI_LOG_THROW(env, HCF_INVALID_PARAMS, "wrong argument num.");
+        return nullptr;
+    }
+
+    NapiSign *napiSign = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiSign));
+    if (status != napi_ok || napiSign == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "failed to unwrap napi sign obj.");
+        return nullptr;
+    }
+
+    uint32_t workerNum = 0;
+    HcfResult ret = GetSignBatchWorkerNum(env, argv[PARAM1], &workerNum);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "invalid worker num.");
+        return nullptr;
+    }
+    HcfBlob *inputs = nullptr;
+    uint32_t count = 0;
+    ret = GetSignBatchInputs(env, argv[PARAM0], &inputs, &count);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW(env, ret, "failed to get data.");
+        return nullptr;
+    }
+
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    HcfBlob *signatures = nullptr;
+    ret = DoSignBatch(napiSign->GetSign(), inputs, count, workerNum, &arena, &signatures);
+    FreeSignBatchInputs(inputs, count);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW_EX(env, ret, "sign batch fail.");
+        return nullptr;
+    }
+
+    napi_value instance = ConvertSignaturesToNapiArray(env, signatures, count);
+    HcfFree(signatures);
+    HcfBlobDataFree(&arena);
+    if (instance == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "sign batch convert signatures failed.");
+        return nullptr;
+    }
+    return instance;
+}
+
 void NapiSign::DefineSignJSClass(napi_env env, napi_value exports)
 {
     napi_property_descriptor desc[] = {
@@ -1101,6 +1441,9 @@ void NapiSign::DefineSignJSClass(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("signSync", NapiSign::JsSignSync),
         DECLARE_NAPI_FUNCTION("setSignSpec", NapiSign::JsSetSignSpec),
         DECLARE_NAPI_FUNCTION("getSignSpec", NapiSign::JsGetSignSpec),
+        DECLARE_NAPI_FUNCTION("reset", NapiSign::JsReset),
+        DECLARE_NAPI_FUNCTION("signBatch", NapiSign::JsSignBatch),
+        DECLARE_NAPI_FUNCTION("signBatchSync", NapiSign::JsSignBatchSync),
     };
     napi_value constructor = nullptr;
     napi_define_class(env, "Sign", NAPI_AUTO_LENGTH, NapiSign::SignConstructor, nullptr,
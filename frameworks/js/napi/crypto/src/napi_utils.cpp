@@ -102,7 +102,8 @@ int32_t GetSignSpecType(SignSpecItem targetItemType)
     if (targetItemType == PSS_SALT_LEN_INT || targetItemType == PSS_TRAILER_FIELD_INT) {
         return SPEC_ITEM_TYPE_NUM;
     }
-    if (targetItemType == ML_DSA_DETERMINISTIC_BOOL || targetItemType == ML_DSA_MU_BOOL) {
+    if (targetItemType == ML_DSA_DETERMINISTIC_BOOL || targetItemType == ML_DSA_MU_BOOL ||
+        targetItemType == SIGN_PREHASH_BOOL) {
         return SPEC_ITEM_TYPE_BOOL;
     }
     LOGE("SignSpecItem not support! ItemType: %{public}d", targetItemType);
@@ -115,9 +116,12 @@ int32_t GetCipherSpecType(CipherSpecItem targetItemType)
         targetItemType == OAEP_MGF1_MD_STR || targetItemType == SM2_MD_NAME_STR) {
         return SPEC_ITEM_TYPE_STR;
     }
-    if (targetItemType == OAEP_MGF1_PSRC_UINT8ARR) {
+    if (targetItemType == OAEP_MGF1_PSRC_UINT8ARR || targetItemType == CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR) {
         return SPEC_ITEM_TYPE_UINT8ARR;
     }
+    if (targetItemType == CIPHER_AEAD_NONCE_MODE_INT) {
+        return SPEC_ITEM_TYPE_NUM;
+    }
     LOGE("CipherSpecItem not support! ItemType: %{public}d", targetItemType);
     return -1;
 }
@@ -225,6 +229,33 @@ HcfResult GetNapiUint8ArrayDataNoCopy(napi_env env, napi_value arg, HcfBlob *blo
     return HCF_SUCCESS;
 }
 
+HcfResult CreateNapiUint8ArrayNoCopy(napi_env env, HcfBlob *blob, napi_value *napiValue)
+{
+    if (blob->data == nullptr || blob->len == 0) { // inner api, allow empty data
+        *napiValue = NapiGetNull(env);
+        return HCF_SUCCESS;
+    }
+
+    napi_value outBuffer = nullptr;
+    napi_status status = napi_create_external_arraybuffer(
+        env, blob->data, blob->len, [](napi_env env, void *data, void *hint) { HcfFree(data); }, nullptr, &outBuffer);
+    if (status != napi_ok) {
+        LOGE("create napi uint8 array buffer failed!");
+        return HCF_ERR_NAPI;
+    }
+
+    napi_value outData = nullptr;
+    napi_create_typedarray(env, napi_uint8_array, blob->len, outBuffer, 0, &outData);
+    napi_value dataBlob = nullptr;
+    napi_create_object(env, &dataBlob);
+    napi_set_named_property(env, dataBlob, CRYPTO_TAG_DATA.c_str(), outData);
+    *napiValue = dataBlob;
+
+    blob->data = nullptr;
+    blob->len = 0;
+    return HCF_SUCCESS;
+}
+
 HcfResult GetBlobFromNapiValue(napi_env env, napi_value arg, HcfBlob *blob)
 {
     napi_value data = GetUint8ArrFromNapiDataBlob(env, arg);
@@ -1189,7 +1189,7 @@ static HcfResult SetVerifyMlDsaContext(napi_env env, napi_value *argv, HcfVerify
     return ret;
 }
 
-static HcfResult SetVerifyMlDsaBool(napi_env env, napi_value *argv, SignSpecItem item, HcfVerify *verify)
+static HcfResult SetVerifySpecBool(napi_env env, napi_value *argv, SignSpecItem item, HcfVerify *verify)
 {
     napi_valuetype valueType;
     napi_typeof(env, argv[1], &valueType);
@@ -1225,7 +1225,8 @@ static HcfResult SetDetailVerifySpec(napi_env env, napi_value *argv, SignSpecIte
             break;
         case ML_DSA_MU_BOOL:
         case ML_DSA_DETERMINISTIC_BOOL:
-            result = SetVerifyMlDsaBool(env, argv, item, verify);
+        case SIGN_PREHASH_BOOL:
+            result = SetVerifySpecBool(env, argv, item, verify);
             break;
         default:
             LOGE("specItem not support.");
@@ -1356,6 +1357,31 @@ napi_value NapiVerify::JsGetVerifySpec(napi_env env, napi_callback_info info)
     }
 }
 
+napi_value NapiVerify::JsReset(napi_env env, napi_callback_info info)
+{
+    HistogramScopeGuard guard(API_VERIFY_RESET);
+    napi_value thisVar = nullptr;
+    napi_get_cb_info(env, info, nullptr, nullptr, &thisVar, nullptr);
+
+    NapiVerify *napiVerify = nullptr;
+    napi_status status = napi_unwrap(env, thisVar, reinterpret_cast<void **>(&napiVerify));
+    if (status != napi_ok || napiVerify == nullptr) {
+        guard.SetErrorCode(HCF_ERR_NAPI);
+        NAPI_LOG_THROW(env, HCF_ERR_NAPI, "failed to unwrap napi verify obj.");
+        return nullptr;
+    }
+
+    HcfVerify *verify = napiVerify->GetVerify();
+    HcfResult ret = verify->reset(verify);
+    if (ret != HCF_SUCCESS) {
+        guard.SetErrorCode(ret);
+        NAPI_LOG_THROW_EX(env, ret, "verify reset fail.");
+        return nullptr;
+    }
+    napi_value instance = NapiGetNull(env);
+    return instance;
+}
+
 void NapiVerify::DefineVerifyJSClass(napi_env env, napi_value exports)
 {
     napi_property_descriptor desc[] = {
@@ -1374,6 +1400,7 @@ void NapiVerify::DefineVerifyJSClass(napi_env env, napi_value exports)
         DECLARE_NAPI_FUNCTION("recoverSync", NapiVerify::JsRecoverSync),
         DECLARE_NAPI_FUNCTION("setVerifySpec", NapiVerify::JsSetVerifySpec),
         DECLARE_NAPI_FUNCTION("getVerifySpec", NapiVerify::JsGetVerifySpec),
+        DECLARE_NAPI_FUNCTION("reset", NapiVerify::JsReset),
     };
     napi_value constructor = nullptr;
     napi_define_class(env, "Verify", NAPI_AUTO_LENGTH, NapiVerify::VerifyConstructor, nullptr,
@@ -1359,6 +1359,33 @@ static HcfResult GenerateKeyPair(HcfAsyKeyGenerator *self, HcfParamsSpec *params
     return impl->spiObj->engineGenerateKeyPair(impl->spiObj, returnKeyPair);
 }
 
+static HcfResult GenerateKeyPairs(HcfAsyKeyGenerator *self, uint32_t count, uint32_t workerNum,
+    HcfKeyPair **returnKeyPairs)
+{
+    if ((self == NULL) || (returnKeyPairs == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetAsyKeyGeneratorClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    if ((count == 0) || (workerNum > HCF_ASY_KEY_GEN_MAX_BATCH_WORKER_NUM)) {
+        LOGE("Invalid batch count or worker num.");
+        return HCF_INVALID_PARAMS;
+    }
+    (void)memset_s(returnKeyPairs, sizeof(HcfKeyPair *) * count, 0, sizeof(HcfKeyPair *) * count);
+    HcfAsyKeyGeneratorImpl *impl = (HcfAsyKeyGeneratorImpl *)self;
+    if (impl->spiObj == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->spiObj->engineGenerateKeyPairs == NULL) {
+        LOGE("Not support generate key pairs operation.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    return impl->spiObj->engineGenerateKeyPairs(impl->spiObj, count, workerNum, returnKeyPairs);
+}
+
 static HcfResult GenerateKeyPairBySpec(const HcfAsyKeyGeneratorBySpec *self, HcfKeyPair **returnKeyPair)
 {
     if (self == NULL) {
@@ -1484,6 +1511,7 @@ HcfResult HcfAsyKeyGeneratorCreate(const char *algoName, HcfAsyKeyGenerator **re
     returnGenerator->base.convertKey = ConvertKey;
     returnGenerator->base.convertPemKey = ConvertPemKey;
     returnGenerator->base.generateKeyPair = GenerateKeyPair;
+    returnGenerator->base.generateKeyPairs = GenerateKeyPairs;
     returnGenerator->base.getAlgoName = GetAlgoName;
     returnGenerator->spiObj = spiObj;
     *returnObj = (HcfAsyKeyGenerator *)returnGenerator;
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pub_key_cache.h"
+#include "pub_key_cache_openssl.h"
+#include "log.h"
+
+HcfResult HcfPubKeyCacheSetCapacity(uint32_t capacity)
+{
+    if (capacity > HCF_PUB_KEY_CACHE_MAX_CAPACITY) {
+        LOGE("Invalid capacity, the max is %{public}u.", HCF_PUB_KEY_CACHE_MAX_CAPACITY);
+        return HCF_INVALID_PARAMS;
+    }
+    return OpensslPubKeyCacheSetCapacity(capacity);
+}
+
+HcfResult HcfPubKeyCacheGetStats(HcfPubKeyCacheStats *stats)
+{
+    if (stats == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    OpensslPubKeyCacheGetStats(stats);
+    return HCF_SUCCESS;
+}
+
+void HcfPubKeyCachePurge(void)
+{
+    OpensslPubKeyCachePurge();
+}
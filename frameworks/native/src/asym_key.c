@@ -152,6 +152,26 @@ OH_Crypto_ErrCode OH_CryptoAsymKeyGenerator_Generate(OH_CryptoAsymKeyGenerator *
     return code;
 }
 
+static OH_Crypto_ErrCode CryptoAsymKeyGeneratorGenerateKeyPairs(OH_CryptoAsymKeyGenerator *ctx, uint32_t count,
+    uint32_t workerNum, OH_CryptoKeyPair **keyCtxs)
+{
+    if ((ctx == NULL) || (ctx->base == NULL) || (ctx->base->generateKeyPairs == NULL) || (keyCtxs == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->base->generateKeyPairs(ctx->base, count, workerNum, (HcfKeyPair **)keyCtxs);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsymKeyGenerator_GenerateKeyPairs(OH_CryptoAsymKeyGenerator *ctx, uint32_t count,
+    uint32_t workerNum, OH_CryptoKeyPair **keyCtxs)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoAsymKeyGeneratorGenerateKeyPairs(ctx, count, workerNum, keyCtxs);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ASYM_KEY_GENERATOR_GENERATE_KEY_PAIRS, code, time);
+    return code;
+}
+
 static OH_Crypto_ErrCode CryptoAsymKeyGeneratorSetPassword(OH_CryptoAsymKeyGenerator *ctx,
     const unsigned char *password, uint32_t passwordLen)
 {
@@ -43,6 +43,16 @@ typedef struct OH_CryptoAsymCipher {
     HcfResult (*getCipherSpecString)(HcfCipher *self, CipherSpecItem item, char **returnString);
 
     HcfResult (*getCipherSpecUint8Array)(HcfCipher *self, CipherSpecItem item, HcfBlob *returnUint8Array);
+
+    HcfResult (*setCipherSpecInt)(HcfCipher *self, CipherSpecItem item, int32_t value);
+
+    HcfResult (*getCipherSpecInt)(HcfCipher *self, CipherSpecItem item, int32_t *returnInt);
+
+    HcfResult (*processDataUnits)(HcfCipher *self, uint64_t startDataUnit, uint32_t dataUnitLen,
+        HcfBlob *input, HcfBlob *output);
+
+    HcfResult (*doFinalBatch)(HcfCipher *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnOutputs);
 } OH_CryptoAsymCipher;
 
 typedef struct OH_CryptoKeyPair {
@@ -128,6 +138,27 @@ OH_Crypto_ErrCode OH_CryptoAsymCipher_Final(OH_CryptoAsymCipher *ctx, const Cryp
     return code;
 }
 
+static OH_Crypto_ErrCode CryptoAsymCipherFinalBatch(OH_CryptoAsymCipher *ctx, const Crypto_DataBlob *in,
+    uint32_t count, uint32_t workerNum, Crypto_DataBlob *arena, Crypto_DataBlob *out)
+{
+    if ((ctx == NULL) || (ctx->doFinalBatch == NULL) || (in == NULL) || (arena == NULL) || (out == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->doFinalBatch((HcfCipher *)ctx, (const HcfBlob *)in, count, workerNum, (HcfBlob *)arena,
+        (HcfBlob *)out);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsymCipher_FinalBatch(OH_CryptoAsymCipher *ctx, const Crypto_DataBlob *in, uint32_t count,
+    uint32_t workerNum, Crypto_DataBlob *arena, Crypto_DataBlob *out)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoAsymCipherFinalBatch(ctx, in, count, workerNum, arena, out);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ASYM_CIPHER_FINAL_BATCH, code, time);
+    return code;
+}
+
 static void CryptoAsymCipherDestroy(OH_CryptoAsymCipher *ctx)
 {
     if ((ctx == NULL) || (ctx->base.destroy == NULL)) {
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "crypto_async.h"
+
+#include <pthread.h>
+
+#include "hcf_parallel.h"
+#include "hcf_task_pool.h"
+#include "log.h"
+#include "memory.h"
+#include "native_common.h"
+
+#define CRYPTO_ASYNC_DEFAULT_WORKER_NUM 4
+#define CRYPTO_ASYNC_DEFAULT_QUEUE_DEPTH 64
+
+typedef enum {
+    CRYPTO_ASYNC_GENERATE_KEY_PAIR,
+    CRYPTO_ASYNC_SYM_CIPHER_FINAL,
+    CRYPTO_ASYNC_ASYM_CIPHER_FINAL,
+    CRYPTO_ASYNC_DIGEST_FINAL,
+    CRYPTO_ASYNC_SIGN_FINAL,
+    CRYPTO_ASYNC_VERIFY_FINAL,
+    CRYPTO_ASYNC_KDF_DERIVE,
+} CryptoAsyncOpType;
+
+/* Everything a task touches, the caller handed it over at submission. */
+typedef struct {
+    CryptoAsyncOpType opType;
+
+    void *ctx;
+
+    const Crypto_DataBlob *in;
+
+    Crypto_DataBlob *signData;
+
+    Crypto_DataBlob *out;
+
+    OH_CryptoKeyPair **keyPair;
+
+    bool *verifyResult;
+
+    const OH_CryptoKdfParams *kdfParams;
+
+    int keyLen;
+
+    OH_CryptoAsync_Callback callback;
+
+    void *userData;
+
+    OH_Crypto_ErrCode result;
+} CryptoAsyncTask;
+
+static pthread_mutex_t g_asyncLock = PTHREAD_MUTEX_INITIALIZER;
+static HcfTaskPool *g_asyncPool = NULL;
+static uint32_t g_asyncWorkerNum = CRYPTO_ASYNC_DEFAULT_WORKER_NUM;
+static uint32_t g_asyncQueueDepth = CRYPTO_ASYNC_DEFAULT_QUEUE_DEPTH;
+
+static OH_Crypto_ErrCode RunDigestFinal(CryptoAsyncTask *task)
+{
+    if (task->in != NULL) {
+        OH_Crypto_ErrCode code = OH_CryptoDigest_Update((OH_CryptoDigest *)task->ctx, (Crypto_DataBlob *)task->in);
+        if (code != CRYPTO_SUCCESS) {
+            return code;
+        }
+    }
+    return OH_CryptoDigest_Final((OH_CryptoDigest *)task->ctx, task->out);
+}
+
+static OH_Crypto_ErrCode RunVerifyFinal(CryptoAsyncTask *task)
+{
+    *task->verifyResult = OH_CryptoVerify_Final((OH_CryptoVerify *)task->ctx, (Crypto_DataBlob *)task->in,
+        task->signData);
+    return CRYPTO_SUCCESS;
+}
+
+static void RunAsyncTask(void *ctx, uint64_t taskId)
+{
+    (void)taskId;
+    CryptoAsyncTask *task = (CryptoAsyncTask *)ctx;
+    switch (task->opType) {
+        case CRYPTO_ASYNC_GENERATE_KEY_PAIR:
+            task->result = OH_CryptoAsymKeyGenerator_Generate((OH_CryptoAsymKeyGenerator *)task->ctx,
+                task->keyPair);
+            break;
+        case CRYPTO_ASYNC_SYM_CIPHER_FINAL:
+            task->result = OH_CryptoSymCipher_Final((OH_CryptoSymCipher *)task->ctx, (Crypto_DataBlob *)task->in,
+                task->out);
+            break;
+        case CRYPTO_ASYNC_ASYM_CIPHER_FINAL:
+            task->result = OH_CryptoAsymCipher_Final((OH_CryptoAsymCipher *)task->ctx, task->in, task->out);
+            break;
+        case CRYPTO_ASYNC_DIGEST_FINAL:
+            task->result = RunDigestFinal(task);
+            break;
+        case CRYPTO_ASYNC_SIGN_FINAL:
+            task->result = OH_CryptoSign_Final((OH_CryptoSign *)task->ctx, task->in, task->out);
+            break;
+        case CRYPTO_ASYNC_VERIFY_FINAL:
+            task->result = RunVerifyFinal(task);
+            break;
+        case CRYPTO_ASYNC_KDF_DERIVE:
+            task->result = OH_CryptoKdf_Derive((OH_CryptoKdf *)task->ctx, task->kdfParams, task->keyLen,
+                task->out);
+            break;
+        default:
+            task->result = CRYPTO_NOT_SUPPORTED;
+            break;
+    }
+}
+
+static void CompleteAsyncTask(void *ctx, uint64_t taskId)
+{
+    CryptoAsyncTask *task = (CryptoAsyncTask *)ctx;
+    task->callback(taskId, task->result, task->userData);
+    HcfFree(task);
+}
+
+static OH_Crypto_ErrCode GetAsyncErrCode(HcfResult ret)
+{
+    if (ret == HCF_ERR_INVALID_CALL) {
+        return CRYPTO_INVALID_CALL;
+    }
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+static bool IsAsyncTaskValid(const CryptoAsyncTask *params)
+{
+    if ((params->ctx == NULL) || (params->callback == NULL)) {
+        return false;
+    }
+    switch (params->opType) {
+        case CRYPTO_ASYNC_GENERATE_KEY_PAIR:
+            return params->keyPair != NULL;
+        case CRYPTO_ASYNC_ASYM_CIPHER_FINAL:
+            return (params->in != NULL) && (params->out != NULL);
+        case CRYPTO_ASYNC_VERIFY_FINAL:
+            return (params->signData != NULL) && (params->verifyResult != NULL);
+        case CRYPTO_ASYNC_KDF_DERIVE:
+            return (params->kdfParams != NULL) && (params->out != NULL);
+        default:
+            return params->out != NULL;
+    }
+}
+
+static OH_Crypto_ErrCode CryptoAsyncSubmit(const CryptoAsyncTask *params, uint64_t *taskId)
+{
+    if (!IsAsyncTaskValid(params)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    CryptoAsyncTask *task = (CryptoAsyncTask *)HcfMalloc(sizeof(CryptoAsyncTask), 0);
+    if (task == NULL) {
+        return CRYPTO_MEMORY_ERROR;
+    }
+    *task = *params;
+    HcfResult ret = HCF_SUCCESS;
+    (void)pthread_mutex_lock(&g_asyncLock);
+    if (g_asyncPool == NULL) {
+        ret = HcfTaskPoolCreate(g_asyncWorkerNum, g_asyncQueueDepth, &g_asyncPool);
+    }
+    if (ret == HCF_SUCCESS) {
+        ret = HcfTaskPoolSubmit(g_asyncPool, task->ctx, RunAsyncTask, CompleteAsyncTask, task, taskId);
+    }
+    (void)pthread_mutex_unlock(&g_asyncLock);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to submit async task.");
+        HcfFree(task);
+    }
+    return GetAsyncErrCode(ret);
+}
+
+static OH_Crypto_ErrCode ReportAsyncSubmit(const CryptoAsyncTask *params, uint64_t *taskId)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoAsyncSubmit(params, taskId);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ASYNC_SUBMIT, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoAsyncSetPoolConfig(uint32_t workerNum, uint32_t queueDepth)
+{
+    if ((workerNum == 0) || (workerNum > HCF_PARALLEL_MAX_WORKER_NUM) || (queueDepth == 0) ||
+        (queueDepth > HCF_TASK_POOL_MAX_QUEUE_DEPTH)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    OH_Crypto_ErrCode code = CRYPTO_SUCCESS;
+    (void)pthread_mutex_lock(&g_asyncLock);
+    if (!HcfTaskPoolIsIdle(g_asyncPool)) {
+        code = CRYPTO_INVALID_CALL;
+    } else {
+        // Submissions hold g_asyncLock, so the idle pool stays idle and can be replaced on the next submission.
+        HcfTaskPoolDestroy(g_asyncPool);
+        g_asyncPool = NULL;
+        g_asyncWorkerNum = workerNum;
+        g_asyncQueueDepth = queueDepth;
+    }
+    (void)pthread_mutex_unlock(&g_asyncLock);
+    return code;
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_SetPoolConfig(uint32_t workerNum, uint32_t queueDepth)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoAsyncSetPoolConfig(workerNum, queueDepth);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ASYNC_SET_POOL_CONFIG, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoAsyncCancel(uint64_t taskId)
+{
+    void *task = NULL;
+    HcfResult ret = HCF_ERR_INVALID_CALL;
+    (void)pthread_mutex_lock(&g_asyncLock);
+    if (g_asyncPool != NULL) {
+        ret = HcfTaskPoolCancel(g_asyncPool, taskId, &task);
+    }
+    (void)pthread_mutex_unlock(&g_asyncLock);
+    if (ret == HCF_SUCCESS) {
+        HcfFree(task);
+    }
+    return GetAsyncErrCode(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_Cancel(uint64_t taskId)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoAsyncCancel(taskId);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ASYNC_CANCEL, code, time);
+    return code;
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_GenerateKeyPair(OH_CryptoAsymKeyGenerator *ctx, OH_CryptoKeyPair **keyCtx,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask params = { .opType = CRYPTO_ASYNC_GENERATE_KEY_PAIR, .ctx = ctx, .keyPair = keyCtx,
+        .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&params, taskId);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_SymCipherFinal(OH_CryptoSymCipher *ctx, Crypto_DataBlob *in, Crypto_DataBlob *out,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask params = { .opType = CRYPTO_ASYNC_SYM_CIPHER_FINAL, .ctx = ctx, .in = in, .out = out,
+        .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&params, taskId);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_AsymCipherFinal(OH_CryptoAsymCipher *ctx, const Crypto_DataBlob *in,
+    Crypto_DataBlob *out, OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask params = { .opType = CRYPTO_ASYNC_ASYM_CIPHER_FINAL, .ctx = ctx, .in = in, .out = out,
+        .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&params, taskId);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_DigestFinal(OH_CryptoDigest *ctx, Crypto_DataBlob *in, Crypto_DataBlob *out,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask params = { .opType = CRYPTO_ASYNC_DIGEST_FINAL, .ctx = ctx, .in = in, .out = out,
+        .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&params, taskId);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_SignFinal(OH_CryptoSign *ctx, const Crypto_DataBlob *in, Crypto_DataBlob *out,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask params = { .opType = CRYPTO_ASYNC_SIGN_FINAL, .ctx = ctx, .in = in, .out = out,
+        .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&params, taskId);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_VerifyFinal(OH_CryptoVerify *ctx, Crypto_DataBlob *in, Crypto_DataBlob *signData,
+    bool *result, OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask params = { .opType = CRYPTO_ASYNC_VERIFY_FINAL, .ctx = ctx, .in = in, .signData = signData,
+        .verifyResult = result, .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&params, taskId);
+}
+
+OH_Crypto_ErrCode OH_CryptoAsync_KdfDerive(OH_CryptoKdf *ctx, const OH_CryptoKdfParams *params, int keyLen,
+    Crypto_DataBlob *key, OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId)
+{
+    CryptoAsyncTask taskParams = { .opType = CRYPTO_ASYNC_KDF_DERIVE, .ctx = ctx, .kdfParams = params,
+        .keyLen = keyLen, .out = key, .callback = callback, .userData = userData };
+    return ReportAsyncSubmit(&taskParams, taskId);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "crypto_envelope.h"
+#include "native_common.h"
+#include "crypto_common.h"
+#include "crypto_asym_key.h"
+#include "envelope.h"
+
+typedef struct OH_CryptoEnvelope {
+    HcfObjectBase base;
+
+    HcfResult (*seal)(HcfEnvelope *self, HcfPubKey *pubKey, const HcfBlob *aad, const HcfBlob *input,
+        HcfBlob *returnEnvelope);
+
+    HcfResult (*open)(HcfEnvelope *self, HcfPriKey *priKey, const HcfBlob *aad, const HcfBlob *envelope,
+        HcfBlob *returnOutput);
+
+    const char *(*getAlgoName)(HcfEnvelope *self);
+} OH_CryptoEnvelope;
+
+static OH_Crypto_ErrCode CryptoEnvelopeCreate(const char *algoName, OH_CryptoEnvelope **ctx)
+{
+    if (ctx == NULL) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = HcfEnvelopeCreate(algoName, (HcfEnvelope **)ctx);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoEnvelope_Create(const char *algoName, OH_CryptoEnvelope **ctx)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoEnvelopeCreate(algoName, ctx);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ENVELOPE_CREATE, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoEnvelopeSeal(OH_CryptoEnvelope *ctx, OH_CryptoPubKey *pubkey,
+    const Crypto_DataBlob *aad, const Crypto_DataBlob *in, Crypto_DataBlob *out)
+{
+    if ((ctx == NULL) || (ctx->seal == NULL) || (pubkey == NULL) || (in == NULL) || (out == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->seal((HcfEnvelope *)ctx, (HcfPubKey *)pubkey, (const HcfBlob *)aad, (const HcfBlob *)in,
+        (HcfBlob *)out);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoEnvelope_Seal(OH_CryptoEnvelope *ctx, OH_CryptoPubKey *pubkey, const Crypto_DataBlob *aad,
+    const Crypto_DataBlob *in, Crypto_DataBlob *out)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoEnvelopeSeal(ctx, pubkey, aad, in, out);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ENVELOPE_SEAL, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoEnvelopeOpen(OH_CryptoEnvelope *ctx, OH_CryptoPrivKey *privkey,
+    const Crypto_DataBlob *aad, const Crypto_DataBlob *in, Crypto_DataBlob *out)
+{
+    if ((ctx == NULL) || (ctx->open == NULL) || (privkey == NULL) || (in == NULL) || (out == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->open((HcfEnvelope *)ctx, (HcfPriKey *)privkey, (const HcfBlob *)aad, (const HcfBlob *)in,
+        (HcfBlob *)out);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoEnvelope_Open(OH_CryptoEnvelope *ctx, OH_CryptoPrivKey *privkey,
+    const Crypto_DataBlob *aad, const Crypto_DataBlob *in, Crypto_DataBlob *out)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoEnvelopeOpen(ctx, privkey, aad, in, out);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ENVELOPE_OPEN, code, time);
+    return code;
+}
+
+static void CryptoEnvelopeDestroy(OH_CryptoEnvelope *ctx)
+{
+    HcfObjDestroy((HcfEnvelope *)ctx);
+}
+
+void OH_CryptoEnvelope_Destroy(OH_CryptoEnvelope *ctx)
+{
+    int64_t start = GetTimeMilliseconds();
+    CryptoEnvelopeDestroy(ctx);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_ENVELOPE_DESTROY, true, time);
+}
@@ -148,6 +148,13 @@ static OH_Crypto_ErrCode SetPbkdf2Param(HcfPBKDF2ParamsSpec *params, CryptoKdf_P
             params->iterations = *(int *)(value->data);
             break;
         }
+        case CRYPTO_KDF_THREAD_NUM_UINT32: {
+            if (value->len != sizeof(uint32_t)) {
+                return CRYPTO_PARAMETER_CHECK_FAILED;
+            }
+            params->threadNum = *(uint32_t *)(value->data);
+            break;
+        }
         default:
             return CRYPTO_PARAMETER_CHECK_FAILED;
     }
@@ -204,6 +211,12 @@ static OH_Crypto_ErrCode SetScryptParam(HcfScryptParamsSpec *params, CryptoKdf_P
             return SetScryptUint64Param(params, value, &params->p);
         case CRYPTO_KDF_SCRYPT_MAX_MEM_UINT64:
             return SetScryptUint64Param(params, value, &params->maxMem);
+        case CRYPTO_KDF_THREAD_NUM_UINT32:
+            if (value->len != sizeof(uint32_t)) {
+                return CRYPTO_PARAMETER_CHECK_FAILED;
+            }
+            params->threadNum = *(uint32_t *)(value->data);
+            return CRYPTO_SUCCESS;
         default:
             return CRYPTO_PARAMETER_CHECK_FAILED;
     }
@@ -382,6 +395,7 @@ static OH_Crypto_ErrCode Pbkdf2Derive(HcfKdf *ctx, const HcfPBKDF2ParamsSpec *pa
         .salt = params->salt,
         .iterations = params->iterations,
         .output = output,
+        .threadNum = params->threadNum,
     };
     HcfResult ret = ctx->generateSecret(ctx, &(pbkdf2Params.base));
     if (ret != HCF_SUCCESS) {
@@ -409,6 +423,7 @@ static OH_Crypto_ErrCode ScryptDerive(HcfKdf *ctx, const HcfScryptParamsSpec *pa
         .r = params->r,
         .maxMem = params->maxMem,
         .output = output,
+        .threadNum = params->threadNum,
     };
     HcfResult ret = ctx->generateSecret(ctx, &(scryptParams.base));
     if (ret != HCF_SUCCESS) {
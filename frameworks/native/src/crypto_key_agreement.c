@@ -14,9 +14,15 @@
  */
 
 #include "crypto_key_agreement.h"
+#include <string.h>
+#include <securec.h>
 #include "native_common.h"
 #include "crypto_common.h"
 #include "crypto_asym_key.h"
+#include "config.h"
+#include "detailed_hkdf_params.h"
+#include "detailed_x963kdf_params.h"
+#include "kdf_params.h"
 #include "key_agreement.h"
 
 typedef struct OH_CryptoKeyAgreement {
@@ -26,6 +32,9 @@ typedef struct OH_CryptoKeyAgreement {
         HcfPubKey *pubKey, HcfBlob *returnSecret);
 
     const char *(*getAlgoName)(HcfKeyAgreement *self);
+
+    HcfResult (*deriveKey)(HcfKeyAgreement *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+        const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey);
 } OH_CryptoKeyAgreement;
 
 static OH_Crypto_ErrCode CryptoKeyAgreementCreate(const char *algoName, OH_CryptoKeyAgreement **ctx)
@@ -67,6 +76,63 @@ OH_Crypto_ErrCode OH_CryptoKeyAgreement_GenerateSecret(OH_CryptoKeyAgreement *ct
     return code;
 }
 
+/* The params of OH_CryptoKdfParams_Create are an HcfKdfParamsSpec of the KDF named by its algName. */
+static OH_Crypto_ErrCode SetKdfSpecBlobs(const OH_CryptoKdfParams *params, HcfKeyAgreementKdfSpec *spec)
+{
+    if (params == NULL) {
+        return CRYPTO_SUCCESS;
+    }
+    const HcfKdfParamsSpec *base = (const HcfKdfParamsSpec *)params;
+    if ((base->algName == NULL) || (strcmp(base->algName, spec->algName) != 0)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    if (strcmp(base->algName, "HKDF") == 0) {
+        spec->salt = ((const HcfHkdfParamsSpec *)params)->salt;
+        spec->info = ((const HcfHkdfParamsSpec *)params)->info;
+    } else {
+        spec->info = ((const HcfX963KDFParamsSpec *)params)->info;
+    }
+    return CRYPTO_SUCCESS;
+}
+
+static OH_Crypto_ErrCode CryptoKeyAgreementDeriveKey(OH_CryptoKeyAgreement *ctx, OH_CryptoPrivKey *privkey,
+    OH_CryptoPubKey *pubkey, const char *kdfAlgoName, const OH_CryptoKdfParams *params, uint32_t keyLen,
+    Crypto_DataBlob *key)
+{
+    if ((ctx == NULL) || (ctx->deriveKey == NULL) || (privkey == NULL) || (pubkey == NULL) ||
+        (kdfAlgoName == NULL) || (key == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    char kdfName[HCF_MAX_ALGO_NAME_LEN] = { 0 };
+    if (strcpy_s(kdfName, sizeof(kdfName), kdfAlgoName) != EOK) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    char *mdName = strchr(kdfName, '|');
+    if (mdName == NULL) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    *mdName++ = '\0';
+    HcfKeyAgreementKdfSpec spec = { .algName = kdfName, .mdName = mdName, .keyLen = keyLen };
+    OH_Crypto_ErrCode code = SetKdfSpecBlobs(params, &spec);
+    if (code != CRYPTO_SUCCESS) {
+        return code;
+    }
+    HcfResult ret = ctx->deriveKey((HcfKeyAgreement *)ctx, (HcfPriKey *)privkey, (HcfPubKey *)pubkey, &spec,
+        (HcfBlob *)key);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoKeyAgreement_DeriveKey(OH_CryptoKeyAgreement *ctx, OH_CryptoPrivKey *privkey,
+    OH_CryptoPubKey *pubkey, const char *kdfAlgoName, const OH_CryptoKdfParams *params, uint32_t keyLen,
+    Crypto_DataBlob *key)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoKeyAgreementDeriveKey(ctx, privkey, pubkey, kdfAlgoName, params, keyLen, key);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_KEY_AGREEMENT_DERIVE_KEY, code, time);
+    return code;
+}
+
 static void CryptoKeyAgreementDestroy(OH_CryptoKeyAgreement *ctx)
 {
     HcfObjDestroy((HcfKeyAgreement*)ctx);
@@ -21,6 +21,7 @@
 #include "crypto_sym_key.h"
 #include "native_common.h"
 #include "mac.h"
+#include "file_crypto.h"
 #include "mac_params.h"
 #include "detailed_cmac_params.h"
 #include "detailed_hmac_params.h"
@@ -187,6 +188,24 @@ OH_Crypto_ErrCode OH_CryptoMac_Update(OH_CryptoMac *ctx, const Crypto_DataBlob *
     return code;
 }
 
+static OH_Crypto_ErrCode CryptoMacUpdateFd(OH_CryptoMac *ctx, int32_t fd, uint64_t offset, uint64_t length)
+{
+    if ((ctx == NULL) || (ctx->macObj == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = HcfMacUpdateFd(ctx->macObj, fd, offset, length);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoMac_UpdateFd(OH_CryptoMac *ctx, int32_t fd, uint64_t offset, uint64_t length)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoMacUpdateFd(ctx, fd, offset, length);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_MAC_UPDATE_FD, code, time);
+    return code;
+}
+
 static OH_Crypto_ErrCode CryptoMacFinal(OH_CryptoMac *ctx, Crypto_DataBlob *out)
 {
     if ((ctx == NULL) || (ctx->macObj == NULL) || (ctx->macObj->doFinal == NULL) || (out == NULL)) {
@@ -15,6 +15,7 @@
 
 #include "crypto_digest.h"
 #include "md.h"
+#include "file_crypto.h"
 #include "crypto_common.h"
 #include "blob.h"
 #include "object_base.h"
@@ -69,6 +70,24 @@ OH_Crypto_ErrCode OH_CryptoDigest_Update(OH_CryptoDigest *ctx, Crypto_DataBlob *
     return code;
 }
 
+static OH_Crypto_ErrCode CryptoDigestUpdateFd(OH_CryptoDigest *ctx, int32_t fd, uint64_t offset, uint64_t length)
+{
+    if (ctx == NULL) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = HcfMdUpdateFd((HcfMd *)ctx, fd, offset, length);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoDigest_UpdateFd(OH_CryptoDigest *ctx, int32_t fd, uint64_t offset, uint64_t length)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoDigestUpdateFd(ctx, fd, offset, length);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_DIGEST_UPDATE_FD, code, time);
+    return code;
+}
+
 static OH_Crypto_ErrCode CryptoDigestFinal(OH_CryptoDigest *ctx, Crypto_DataBlob *out)
 {
     if ((ctx == NULL) || (ctx->doFinal == NULL) || (out == NULL)) {
@@ -47,6 +47,10 @@ struct OH_CryptoVerify {
     HcfResult (*getVerifySpecInt)(HcfVerify *self, SignSpecItem item, int32_t *returnInt);
 
     HcfResult (*setVerifySpecUint8Array)(HcfVerify *self, SignSpecItem item, HcfBlob blob);
+
+    HcfResult (*setVerifySpecBool)(HcfVerify *self, SignSpecItem item, bool flag);
+
+    HcfResult (*reset)(HcfVerify *self);
 };
 
 struct OH_CryptoSign {
@@ -67,6 +71,13 @@ struct OH_CryptoSign {
     HcfResult (*getSignSpecInt)(HcfSign *self, SignSpecItem item, int32_t *returnInt);
 
     HcfResult (*setSignSpecUint8Array)(HcfSign *self, SignSpecItem item, HcfBlob blob);
+
+    HcfResult (*setSignSpecBool)(HcfSign *self, SignSpecItem item, bool flag);
+
+    HcfResult (*reset)(HcfSign *self);
+
+    HcfResult (*signBatch)(HcfSign *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnSignatures);
 };
 
 static OH_Crypto_ErrCode CryptoVerifyCreate(const char *algoName, OH_CryptoVerify **verify)
@@ -208,6 +219,13 @@ static OH_Crypto_ErrCode CryptoVerifySetParam(OH_CryptoVerify *ctx, CryptoSignat
             }
             ret = ctx->setVerifySpecUint8Array((HcfVerify *)ctx, (SignSpecItem)type, *((HcfBlob *)value));
             break;
+        case CRYPTO_SIGN_PREHASH_BOOL:
+            if ((value->data == NULL) || (value->len != sizeof(bool)) || (ctx->setVerifySpecBool == NULL)) {
+                ret = HCF_INVALID_PARAMS;
+                break;
+            }
+            ret = ctx->setVerifySpecBool((HcfVerify *)ctx, (SignSpecItem)type, *((bool *)value->data));
+            break;
         default:
             return CRYPTO_INVALID_PARAMS;
     }
@@ -284,6 +302,23 @@ OH_Crypto_ErrCode OH_CryptoVerify_GetParam(OH_CryptoVerify *ctx, CryptoSignature
     return code;
 }
 
+static OH_Crypto_ErrCode CryptoVerifyReset(OH_CryptoVerify *ctx)
+{
+    if ((ctx == NULL) || (ctx->reset == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->reset((HcfVerify *)ctx);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoVerify_Reset(OH_CryptoVerify *ctx)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoVerifyReset(ctx);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_VERIFY_RESET, code, time);
+    return code;
+}
 
 static void CryptoVerifyDestroy(OH_CryptoVerify *ctx)
 {
@@ -416,6 +451,13 @@ static OH_Crypto_ErrCode CryptoSignSetParam(OH_CryptoSign *ctx, CryptoSignature_
             }
             ret = ctx->setSignSpecUint8Array((HcfSign *)ctx, (SignSpecItem)type, *((HcfBlob *)value));
             break;
+        case CRYPTO_SIGN_PREHASH_BOOL:
+            if ((value->data == NULL) || (value->len != sizeof(bool)) || (ctx->setSignSpecBool == NULL)) {
+                ret = HCF_INVALID_PARAMS;
+                break;
+            }
+            ret = ctx->setSignSpecBool((HcfSign *)ctx, (SignSpecItem)type, *((bool *)value->data));
+            break;
         default:
             return CRYPTO_PARAMETER_CHECK_FAILED;
     }
@@ -490,6 +532,45 @@ OH_Crypto_ErrCode OH_CryptoSign_GetParam(OH_CryptoSign *ctx, CryptoSignature_Par
     return code;
 }
 
+static OH_Crypto_ErrCode CryptoSignReset(OH_CryptoSign *ctx)
+{
+    if ((ctx == NULL) || (ctx->reset == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->reset((HcfSign *)ctx);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSign_Reset(OH_CryptoSign *ctx)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSignReset(ctx);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SIGN_RESET, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSignSignBatch(OH_CryptoSign *ctx, const Crypto_DataBlob *in, uint32_t count,
+    uint32_t workerNum, Crypto_DataBlob *arena, Crypto_DataBlob *out)
+{
+    if ((ctx == NULL) || (ctx->signBatch == NULL) || (in == NULL) || (arena == NULL) || (out == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->signBatch((HcfSign *)ctx, (const HcfBlob *)in, count, workerNum, (HcfBlob *)arena,
+        (HcfBlob *)out);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSign_SignBatch(OH_CryptoSign *ctx, const Crypto_DataBlob *in, uint32_t count,
+    uint32_t workerNum, Crypto_DataBlob *arena, Crypto_DataBlob *out)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSignSignBatch(ctx, in, count, workerNum, arena, out);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SIGN_SIGN_BATCH, code, time);
+    return code;
+}
+
 static void CryptoSignDestroy(OH_CryptoSign *ctx)
 {
     if (ctx == NULL || ctx->base.destroy == NULL) {
@@ -19,6 +19,8 @@
 #include "sym_key_generator.h"
 #include "crypto_common.h"
 #include "cipher.h"
+#include "cipher_stream.h"
+#include "file_crypto.h"
 #include "blob.h"
 #include "object_base.h"
 #include "result.h"
@@ -41,6 +43,16 @@ struct OH_CryptoSymCipher {
     HcfResult (*getCipherSpecString)(HcfCipher *self, CipherSpecItem item, char **returnString);
 
     HcfResult (*getCipherSpecUint8Array)(HcfCipher *self, CipherSpecItem item, HcfBlob *returnUint8Array);
+
+    HcfResult (*setCipherSpecInt)(HcfCipher *self, CipherSpecItem item, int32_t value);
+
+    HcfResult (*getCipherSpecInt)(HcfCipher *self, CipherSpecItem item, int32_t *returnInt);
+
+    HcfResult (*processDataUnits)(HcfCipher *self, uint64_t startDataUnit, uint32_t dataUnitLen,
+        HcfBlob *input, HcfBlob *output);
+
+    HcfResult (*doFinalBatch)(HcfCipher *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnOutputs);
 };
 
 struct OH_CryptoSymCipherParams {
@@ -50,6 +62,12 @@ struct OH_CryptoSymCipherParams {
     HcfBlob tag;
 };
 
+struct OH_CryptoSymCipherStream {
+    HcfCipherStream *stream;
+    OH_CryptoSymCipherStream_OnData onData;
+    void *userData;
+};
+
 struct OH_CryptoSymKey {
     HcfKey key;
 
@@ -234,3 +252,238 @@ void OH_CryptoSymCipher_Destroy(OH_CryptoSymCipher *ctx)
     int64_t time = GetTimeMilliseconds() - start;
     HistogramApiReport(API_CRYPTO_SYM_CIPHER_DESTROY, true, time);
 }
+
+static OH_Crypto_ErrCode CryptoSymCipherSetParallelWorkerNum(OH_CryptoSymCipher *ctx, uint32_t workerNum)
+{
+    if ((ctx == NULL) || (ctx->setCipherSpecInt == NULL) || (workerNum > INT32_MAX)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->setCipherSpecInt((HcfCipher *)ctx, CIPHER_PARALLEL_WORKER_NUM_INT, (int32_t)workerNum);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipher_SetParallelWorkerNum(OH_CryptoSymCipher *ctx, uint32_t workerNum)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherSetParallelWorkerNum(ctx, workerNum);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_SET_PARALLEL_WORKER_NUM, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherProcessDataUnits(OH_CryptoSymCipher *ctx, uint64_t startDataUnit,
+    uint32_t dataUnitSize, const Crypto_DataBlob *in, Crypto_DataBlob *out)
+{
+    if ((ctx == NULL) || (ctx->processDataUnits == NULL) || (in == NULL) || (out == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->processDataUnits((HcfCipher *)ctx, startDataUnit, dataUnitSize, (HcfBlob *)in,
+        (HcfBlob *)out);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipher_ProcessDataUnits(OH_CryptoSymCipher *ctx, uint64_t startDataUnit,
+    uint32_t dataUnitSize, const Crypto_DataBlob *in, Crypto_DataBlob *out)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherProcessDataUnits(ctx, startDataUnit, dataUnitSize, in, out);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_PROCESS_DATA_UNITS, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherUpdateFd(OH_CryptoSymCipher *ctx, int32_t inFd, uint64_t offset,
+    uint64_t length, int32_t outFd)
+{
+    if (ctx == NULL) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = HcfCipherUpdateFd((HcfCipher *)ctx, inFd, offset, length, outFd);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipher_UpdateFd(OH_CryptoSymCipher *ctx, int32_t inFd, uint64_t offset,
+    uint64_t length, int32_t outFd)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherUpdateFd(ctx, inFd, offset, length, outFd);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_UPDATE_FD, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherSetAeadNonceMode(OH_CryptoSymCipher *ctx, Crypto_AeadNonceMode mode)
+{
+    if ((ctx == NULL) || (ctx->setCipherSpecInt == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = ctx->setCipherSpecInt((HcfCipher *)ctx, CIPHER_AEAD_NONCE_MODE_INT, (int32_t)mode);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipher_SetAeadNonceMode(OH_CryptoSymCipher *ctx, Crypto_AeadNonceMode mode)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherSetAeadNonceMode(ctx, mode);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_SET_AEAD_NONCE_MODE, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherSetAeadNonceFixedField(OH_CryptoSymCipher *ctx,
+    const Crypto_DataBlob *fixedField)
+{
+    if ((ctx == NULL) || (ctx->setCipherSpecUint8Array == NULL) || (fixedField == NULL) ||
+        (fixedField->data == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfBlob blob = { .data = fixedField->data, .len = fixedField->len };
+    HcfResult ret = ctx->setCipherSpecUint8Array((HcfCipher *)ctx, CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR, blob);
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipher_SetAeadNonceFixedField(OH_CryptoSymCipher *ctx,
+    const Crypto_DataBlob *fixedField)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherSetAeadNonceFixedField(ctx, fixedField);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_SET_AEAD_NONCE_FIXED_FIELD, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode GetCipherStreamErrCode(HcfResult ret)
+{
+    if (ret == HCF_ERR_INVALID_CALL) {
+        return CRYPTO_INVALID_CALL;
+    }
+    return GetOhCryptoErrCodeNew(ret);
+}
+
+static void OnCipherStreamOutput(void *userData, HcfResult result, HcfBlob *output, bool isFinal)
+{
+    OH_CryptoSymCipherStream *stream = (OH_CryptoSymCipherStream *)userData;
+    stream->onData(stream->userData, GetCipherStreamErrCode(result), (const Crypto_DataBlob *)output, isFinal);
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherStreamCreate(OH_CryptoSymCipher *cipher, uint32_t queueDepth,
+    OH_CryptoSymCipherStream_OnData onData, void *userData, OH_CryptoSymCipherStream **stream)
+{
+    if ((cipher == NULL) || (onData == NULL) || (stream == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    OH_CryptoSymCipherStream *tmp = (OH_CryptoSymCipherStream *)HcfMalloc(sizeof(OH_CryptoSymCipherStream), 0);
+    if (tmp == NULL) {
+        return CRYPTO_MEMORY_ERROR;
+    }
+    tmp->onData = onData;
+    tmp->userData = userData;
+    HcfResult ret = HcfCipherStreamCreate((HcfCipher *)cipher, queueDepth, OnCipherStreamOutput, tmp, &tmp->stream);
+    if (ret != HCF_SUCCESS) {
+        HcfFree(tmp);
+        return GetOhCryptoErrCodeNew(ret);
+    }
+    *stream = tmp;
+    return CRYPTO_SUCCESS;
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Create(OH_CryptoSymCipher *cipher, uint32_t queueDepth,
+    OH_CryptoSymCipherStream_OnData onData, void *userData, OH_CryptoSymCipherStream **stream)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherStreamCreate(cipher, queueDepth, onData, userData, stream);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_STREAM_CREATE, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherStreamWrite(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in)
+{
+    if ((stream == NULL) || (in == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = stream->stream->write(stream->stream, (const HcfBlob *)in);
+    return GetCipherStreamErrCode(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Write(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherStreamWrite(stream, in);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_STREAM_WRITE, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherStreamTryWrite(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in,
+    bool *accepted)
+{
+    if ((stream == NULL) || (in == NULL) || (accepted == NULL)) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = stream->stream->tryWrite(stream->stream, (const HcfBlob *)in, accepted);
+    return GetCipherStreamErrCode(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_TryWrite(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in,
+    bool *accepted)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherStreamTryWrite(stream, in, accepted);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_STREAM_TRY_WRITE, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherStreamFinish(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in)
+{
+    if (stream == NULL) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = stream->stream->finish(stream->stream, (const HcfBlob *)in);
+    return GetCipherStreamErrCode(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Finish(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherStreamFinish(stream, in);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_STREAM_FINISH, code, time);
+    return code;
+}
+
+static OH_Crypto_ErrCode CryptoSymCipherStreamWait(OH_CryptoSymCipherStream *stream)
+{
+    if (stream == NULL) {
+        return CRYPTO_PARAMETER_CHECK_FAILED;
+    }
+    HcfResult ret = stream->stream->wait(stream->stream);
+    return GetCipherStreamErrCode(ret);
+}
+
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Wait(OH_CryptoSymCipherStream *stream)
+{
+    int64_t start = GetTimeMilliseconds();
+    OH_Crypto_ErrCode code = CryptoSymCipherStreamWait(stream);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_STREAM_WAIT, code, time);
+    return code;
+}
+
+static void CryptoSymCipherStreamDestroy(OH_CryptoSymCipherStream *stream)
+{
+    if (stream == NULL) {
+        return;
+    }
+    HcfObjDestroy(stream->stream);
+    HcfFree(stream);
+}
+
+void OH_CryptoSymCipherStream_Destroy(OH_CryptoSymCipherStream *stream)
+{
+    int64_t start = GetTimeMilliseconds();
+    CryptoSymCipherStreamDestroy(stream);
+    int64_t time = GetTimeMilliseconds() - start;
+    HistogramApiReport(API_CRYPTO_SYM_CIPHER_STREAM_DESTROY, true, time);
+}
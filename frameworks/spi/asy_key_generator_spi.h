@@ -53,6 +53,9 @@ struct HcfAsyKeyGeneratorSpi {
 
     HcfResult (*engineGeneratePriKeyBySpec)(const HcfAsyKeyGeneratorSpi *self, const HcfAsyKeyParamsSpec *paramsSpec,
         HcfPriKey **returnPriKey);
+
+    HcfResult (*engineGenerateKeyPairs)(HcfAsyKeyGeneratorSpi *self, uint32_t count, uint32_t workerNum,
+        HcfKeyPair **returnKeyPairs);
 };
 
 #endif
@@ -41,6 +41,16 @@ struct HcfCipherGeneratorSpi {
     HcfResult (*getCipherSpecString)(HcfCipherGeneratorSpi *self, CipherSpecItem item, char **returnString);
 
     HcfResult (*getCipherSpecUint8Array)(HcfCipherGeneratorSpi *self, CipherSpecItem item, HcfBlob *returnUint8Array);
+
+    HcfResult (*setCipherSpecInt)(HcfCipherGeneratorSpi *self, CipherSpecItem item, int32_t value);
+
+    HcfResult (*getCipherSpecInt)(HcfCipherGeneratorSpi *self, CipherSpecItem item, int32_t *returnInt);
+
+    HcfResult (*processDataUnits)(HcfCipherGeneratorSpi *self, uint64_t startDataUnit, uint32_t dataUnitLen,
+        HcfBlob *input, HcfBlob *output);
+
+    HcfResult (*doFinalBatch)(HcfCipherGeneratorSpi *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnOutputs);
 };
 
 #endif
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_ENVELOPE_SPI_H
+#define HCF_ENVELOPE_SPI_H
+
+#include "blob.h"
+#include "pri_key.h"
+#include "pub_key.h"
+#include "result.h"
+
+typedef struct HcfEnvelopeSpi HcfEnvelopeSpi;
+
+struct HcfEnvelopeSpi {
+    HcfObjectBase base;
+
+    HcfResult (*engineSeal)(HcfEnvelopeSpi *self, HcfPubKey *pubKey, const HcfBlob *aad, const HcfBlob *input,
+        HcfBlob *returnEnvelope);
+
+    HcfResult (*engineOpen)(HcfEnvelopeSpi *self, HcfPriKey *priKey, const HcfBlob *aad, const HcfBlob *envelope,
+        HcfBlob *returnOutput);
+};
+
+#endif
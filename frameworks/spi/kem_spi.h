@@ -31,6 +31,14 @@ struct HcfKemSpi {
 
     HcfResult (*engineDecapsulate)(HcfKemSpi *self, HcfPriKey *priKey, const HcfBlob *wrappedKey,
         HcfBlob *returnSharedSecret);
+
+    HcfResult (*engineGetOutputLen)(HcfKemSpi *self, uint32_t *sharedSecretLen, uint32_t *wrappedKeyLen);
+
+    HcfResult (*engineEncapsulateBatch)(HcfKemSpi *self, HcfPubKey **pubKeys, uint32_t count, uint32_t workerNum,
+        HcfBlob *sharedSecrets, HcfBlob *wrappedKeys);
+
+    HcfResult (*engineDecapsulateBatch)(HcfKemSpi *self, HcfPriKey *priKey, const HcfBlob *wrappedKeys,
+        uint32_t count, uint32_t workerNum, HcfBlob *sharedSecrets);
 };
 
 #endif
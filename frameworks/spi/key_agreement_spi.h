@@ -17,6 +17,7 @@
 #define HCF_KEY_AGREEMENT_SPI_H
 
 #include "blob.h"
+#include "key_agreement.h"
 #include "pri_key.h"
 #include "pub_key.h"
 #include "result.h"
@@ -28,6 +29,9 @@ struct HcfKeyAgreementSpi {
 
     HcfResult (*engineGenerateSecret)(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
         HcfPubKey *pubKey, HcfBlob *returnSecret);
+
+    HcfResult (*engineDeriveKey)(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+        const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey);
 };
 
 #endif
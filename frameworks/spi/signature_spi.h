@@ -47,6 +47,11 @@ struct HcfSignSpi {
     HcfResult (*engineSetSignSpecUint8Array)(HcfSignSpi *self, SignSpecItem item, HcfBlob blob);
 
     HcfResult (*engineSetSignSpecBool)(HcfSignSpi *self, SignSpecItem item, bool flag);
+
+    HcfResult (*engineReset)(HcfSignSpi *self);
+
+    HcfResult (*engineSignBatch)(HcfSignSpi *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnSignatures);
 };
 
 typedef struct HcfVerifySpi HcfVerifySpi;
@@ -71,6 +76,8 @@ struct HcfVerifySpi {
     HcfResult (*engineSetVerifySpecUint8Array)(HcfVerifySpi *self, SignSpecItem item, HcfBlob blob);
 
     HcfResult (*engineSetVerifySpecBool)(HcfVerifySpi *self, SignSpecItem item, bool flag);
+
+    HcfResult (*engineReset)(HcfVerifySpi *self);
 };
 
 #endif
@@ -27,6 +27,8 @@ struct HcfPBKDF2ParamsSpec {
     HcfBlob salt;
     int iterations;
     HcfBlob output;
+    /* 0 and 1 derive on the calling thread, more threads compute output blocks concurrently */
+    uint32_t threadNum;
 };
 
 #endif // HCF_DETAILED_PBKDF2_PARAMS_H
@@ -30,6 +30,8 @@ struct HcfScryptParamsSpec {
     uint64_t p;
     uint64_t maxMem;
     HcfBlob output;
+    /* 0 and 1 derive on the calling thread, more threads mix the p lanes concurrently */
+    uint32_t threadNum;
 };
 
 #endif // HCF_DETAILED_SCRYPT_PARAMS_H
@@ -24,6 +24,11 @@ extern "C" {
 
 char *HcfGetOperationErrorMessage(char *buff, uint32_t len);
 
+#ifdef CRYPTO_MBEDTLS
+/* The openssl plugin provides this, the mbedtls build has no plugin error message to clear. */
+void HcfClearPluginErrorMessage(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,9 +41,39 @@ typedef enum {
     OAEP_MGF_NAME_STR = 101,
     OAEP_MGF1_MD_STR = 102,
     OAEP_MGF1_PSRC_UINT8ARR = 103,
-    SM2_MD_NAME_STR = 104
+    SM2_MD_NAME_STR = 104,
+    CIPHER_PARALLEL_WORKER_NUM_INT = 105,
+    CIPHER_PARALLEL_THRESHOLD_INT = 106,
+    CIPHER_AEAD_NONCE_MODE_INT = 107,
+    CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR = 108
 } CipherSpecItem;
 
+/* Inputs of at least this many bytes are split across workers once CIPHER_PARALLEL_WORKER_NUM_INT is above 1. */
+#define HCF_CIPHER_PARALLEL_DEFAULT_THRESHOLD (1024 * 1024)
+
+/**
+ * Values of CIPHER_AEAD_NONCE_MODE_INT, supported by AES GCM, AES CCM and ChaCha20-Poly1305.
+ *
+ * In the generated modes an encrypt init takes no nonce, the cipher draws a HCF_AEAD_NONCE_LEN byte nonce and puts it
+ * in front of the first output of the operation, so a sealed message is nonce || ciphertext || tag. Decryption takes
+ * the nonce in the params as before. The nonces of a key object never repeat, and a key object sticks to the mode
+ * that generated its first nonce.
+ */
+typedef enum {
+    /* the caller supplies the nonce in the params, the default */
+    HCF_AEAD_NONCE_EXTERNAL = 0,
+    /* deterministic construction of NIST SP 800-38D 8.2.1, a 4 byte fixed field then a 64-bit invocation counter */
+    HCF_AEAD_NONCE_COUNTER = 1,
+    /* random construction of NIST SP 800-38D 8.2.2, at most 2^32 nonces per key object */
+    HCF_AEAD_NONCE_RANDOM = 2,
+} HcfAeadNonceMode;
+
+#define HCF_CIPHER_MAX_BATCH_WORKER_NUM 64
+
+#define HCF_AEAD_NONCE_LEN 12
+/* Set CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR to tell apart devices sharing a key, random per key object if unset. */
+#define HCF_AEAD_NONCE_FIXED_FIELD_LEN 4
+
 typedef struct HcfCipher HcfCipher;
 /**
  * @brief this class provides cipher algorithms for cryptographic operations,
@@ -69,6 +99,32 @@ struct HcfCipher {
     HcfResult (*getCipherSpecString)(HcfCipher *self, CipherSpecItem item, char **returnString);
 
     HcfResult (*getCipherSpecUint8Array)(HcfCipher *self, CipherSpecItem item, HcfBlob *returnUint8Array);
+
+    HcfResult (*setCipherSpecInt)(HcfCipher *self, CipherSpecItem item, int32_t value);
+
+    HcfResult (*getCipherSpecInt)(HcfCipher *self, CipherSpecItem item, int32_t *returnInt);
+
+    /**
+     * @brief Encrypts or decrypts consecutive XTS data units of dataUnitLen bytes each with one context.
+     *
+     * The tweak of each unit is its sequence number as a 128-bit little-endian value, counting from startDataUnit.
+     * The IV given to init is not used, and the cipher stays initialized for further batches.
+     */
+    HcfResult (*processDataUnits)(HcfCipher *self, uint64_t startDataUnit, uint32_t dataUnitLen,
+        HcfBlob *input, HcfBlob *output);
+
+    /**
+     * @brief Encrypts or decrypts count independent messages with the key of the last init, each as one doFinal
+     * call would, supported by RSA.
+     *
+     * The outputs are written to one arena allocated by the callee, which the caller frees with HcfBlobDataFree, and
+     * returnOutputs is a caller-provided array of count blobs that receive views into the arena. With workerNum above
+     * 1 the messages are split into contiguous ranges processed by up to workerNum threads, each with its own copy of
+     * the context, 0 or 1 runs in the calling thread. If any message fails no arena is returned and returnOutputs is
+     * cleared.
+     */
+    HcfResult (*doFinalBatch)(HcfCipher *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnOutputs);
 };
 
 #ifdef __cplusplus
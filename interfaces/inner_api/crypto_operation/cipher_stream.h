@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_CIPHER_STREAM_H
+#define HCF_CIPHER_STREAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "blob.h"
+#include "cipher.h"
+#include "object_base.h"
+#include "result.h"
+
+#define HCF_CIPHER_STREAM_DEFAULT_QUEUE_DEPTH 8
+#define HCF_CIPHER_STREAM_MAX_QUEUE_DEPTH 64
+
+/**
+ * @brief Called on the stream worker thread once per processed chunk, in write order.
+ *
+ * The output blob belongs to the stream and is freed after the callback returns. The callback may take over
+ * the buffer by setting output->data to NULL. isFinal is true for the doFinal output and for the error that
+ * stops the stream. The callback must not destroy the stream.
+ */
+typedef void (*HcfCipherStreamOutputFunc)(void *userData, HcfResult result, HcfBlob *output, bool isFinal);
+
+typedef struct HcfCipherStream HcfCipherStream;
+
+/**
+ * @brief Feeds an initialized cipher from a bounded queue on a dedicated worker thread.
+ *
+ * Chunks are copied on write and processed strictly in order, so the caller can read the next chunk while
+ * the previous one is being encrypted. The cipher must not be used by anyone else while the stream is alive.
+ */
+struct HcfCipherStream {
+    HcfObjectBase base;
+
+    /** Queues a chunk for update, blocking while the queue is full. */
+    HcfResult (*write)(HcfCipherStream *self, const HcfBlob *input);
+
+    /** Queues a chunk for update without blocking, accepted is false when the queue is full. */
+    HcfResult (*tryWrite)(HcfCipherStream *self, const HcfBlob *input, bool *accepted);
+
+    /** Queues the doFinal call, input may be NULL. No chunk is accepted afterwards. */
+    HcfResult (*finish)(HcfCipherStream *self, const HcfBlob *input);
+
+    /** Blocks until the queued work has been processed and returns the first error, if any. */
+    HcfResult (*wait)(HcfCipherStream *self);
+
+    uint32_t (*getPendingCount)(HcfCipherStream *self);
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates a cipher stream over an initialized cipher, the cipher is not owned by the stream.
+ *
+ * @param queueDepth Maximum number of queued chunks, 0 selects HCF_CIPHER_STREAM_DEFAULT_QUEUE_DEPTH.
+ */
+HcfResult HcfCipherStreamCreate(HcfCipher *cipher, uint32_t queueDepth, HcfCipherStreamOutputFunc outputFunc,
+    void *userData, HcfCipherStream **returnObj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_ENVELOPE_H
+#define HCF_ENVELOPE_H
+
+#include "blob.h"
+#include "pri_key.h"
+#include "pub_key.h"
+#include "result.h"
+
+/*
+ * An envelope is the version byte, the suite id byte, the big endian two byte length of the encapsulation, the
+ * encapsulation, the ciphertext and the 16 byte tag. The encapsulation is the ephemeral public key, or the RSA
+ * ciphertext of the shared secret for RSA-KEM.
+ */
+#define HCF_ENVELOPE_VERSION 1
+#define HCF_ENVELOPE_HEADER_LEN 4
+#define HCF_ENVELOPE_TAG_LEN 16
+
+typedef struct HcfEnvelope HcfEnvelope;
+
+struct HcfEnvelope {
+    HcfObjectBase base;
+
+    /**
+     * @brief Encrypts input to the holder of the private key of pubKey in one envelope.
+     *
+     * A fresh shared secret is agreed with pubKey, HKDF derives the content key and nonce from it bound to the
+     * envelope header, and the AEAD protects input together with aad, which may be NULL.
+     */
+    HcfResult (*seal)(HcfEnvelope *self, HcfPubKey *pubKey, const HcfBlob *aad, const HcfBlob *input,
+        HcfBlob *returnEnvelope);
+
+    /**
+     * @brief Recovers the input of an envelope sealed to the public key of priKey with the same aad.
+     */
+    HcfResult (*open)(HcfEnvelope *self, HcfPriKey *priKey, const HcfBlob *aad, const HcfBlob *envelope,
+        HcfBlob *returnOutput);
+
+    const char *(*getAlgoName)(HcfEnvelope *self);
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates an envelope object of one suite.
+ *
+ * The suites are "X25519-AES256-GCM", "ECC-AES256-GCM" for NIST and Brainpool curve keys, "SM2-SM4-GCM" and
+ * "RSA-KEM-AES256-GCM". HKDF uses SM3 for the SM2 suite and SHA256 otherwise.
+ */
+HcfResult HcfEnvelopeCreate(const char *algoName, HcfEnvelope **returnObj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
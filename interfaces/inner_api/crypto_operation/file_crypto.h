@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_FILE_CRYPTO_H
+#define HCF_FILE_CRYPTO_H
+
+#include <stdint.h>
+#include "cipher.h"
+#include "mac.h"
+#include "md.h"
+#include "result.h"
+
+/*
+ * Feed length bytes of fd starting at offset into an initialised object, a length of 0 means up to the end of the
+ * file. Regular files are mapped in large windows with sequential readahead advice and fall back to large reads;
+ * pipes and other streams are read from the current position, offset must then be 0. The file must not be
+ * truncated while it is processed. The calls only update, the caller still finishes with doFinal.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+HcfResult HcfMdUpdateFd(HcfMd *md, int fd, uint64_t offset, uint64_t length);
+
+HcfResult HcfMacUpdateFd(HcfMac *mac, int fd, uint64_t offset, uint64_t length);
+
+/**
+ * @brief Encrypts or decrypts the range of inFd with update and appends the output to outFd.
+ */
+HcfResult HcfCipherUpdateFd(HcfCipher *cipher, int inFd, uint64_t offset, uint64_t length, int outFd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
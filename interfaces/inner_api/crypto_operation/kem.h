@@ -21,6 +21,8 @@
 #include "pub_key.h"
 #include "result.h"
 
+#define HCF_KEM_MAX_BATCH_WORKER_NUM 64
+
 typedef struct HcfKem HcfKem;
 
 typedef enum {
@@ -37,6 +39,31 @@ struct HcfKem {
 
     HcfResult (*decapsulate)(HcfKem *self, HcfPriKey *priKey, const HcfBlob *wrappedKey,
         HcfBlob *returnSharedSecret);
+
+    /**
+     * @brief Gets the fixed lengths of one shared secret and one wrapped key of the algorithm.
+     */
+    HcfResult (*getOutputLen)(HcfKem *self, uint32_t *sharedSecretLen, uint32_t *wrappedKeyLen);
+
+    /**
+     * @brief Encapsulates to count public keys in one call.
+     *
+     * The caller provides sharedSecrets of count * sharedSecretLen bytes and wrappedKeys of count * wrappedKeyLen
+     * bytes, result i is written at offset i times the respective length. Consecutive entries of the same key share
+     * one context. With workerNum above 1 the keys are split into contiguous ranges handled by up to workerNum
+     * threads, 0 or 1 runs in the calling thread. On failure both buffers are cleared.
+     */
+    HcfResult (*encapsulateBatch)(HcfKem *self, HcfPubKey **pubKeys, uint32_t count, uint32_t workerNum,
+        HcfBlob *sharedSecrets, HcfBlob *wrappedKeys);
+
+    /**
+     * @brief Decapsulates count wrapped keys stored back to back in wrappedKeys under one private key.
+     *
+     * sharedSecrets is provided by the caller with count * sharedSecretLen bytes, workerNum works as in
+     * encapsulateBatch and every worker initializes its context once. On failure sharedSecrets is cleared.
+     */
+    HcfResult (*decapsulateBatch)(HcfKem *self, HcfPriKey *priKey, const HcfBlob *wrappedKeys, uint32_t count,
+        uint32_t workerNum, HcfBlob *sharedSecrets);
 };
 
 #ifdef __cplusplus
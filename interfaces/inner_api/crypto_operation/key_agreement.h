@@ -21,6 +21,23 @@
 #include "result.h"
 #include "key_pair.h"
 
+#define HCF_KEY_AGREEMENT_MAX_DERIVED_KEY_LEN 8192
+
+/**
+ * @brief The KDF applied to the shared secret by deriveKey.
+ *
+ * algName is "HKDF" or "X963KDF" and mdName is one of "SHA1", "SHA224", "SHA256", "SHA384", "SHA512", or "SM3" for
+ * HKDF only. The salt is used by HKDF only and may be empty, info may be empty, and keyLen is the length of the
+ * derived key in bytes.
+ */
+typedef struct {
+    const char *algName;
+    const char *mdName;
+    HcfBlob salt;
+    HcfBlob info;
+    uint32_t keyLen;
+} HcfKeyAgreementKdfSpec;
+
 typedef struct HcfKeyAgreement HcfKeyAgreement;
 
 struct HcfKeyAgreement {
@@ -30,6 +47,14 @@ struct HcfKeyAgreement {
         HcfPubKey *pubKey, HcfBlob *returnSecret);
 
     const char *(*getAlgoName)(HcfKeyAgreement *self);
+
+    /**
+     * @brief Agrees the shared secret of priKey and pubKey and returns only the key the KDF of spec derives from it.
+     *
+     * The shared secret never leaves the plugin and is cleansed before returning.
+     */
+    HcfResult (*deriveKey)(HcfKeyAgreement *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+        const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey);
 };
 
 #ifdef __cplusplus
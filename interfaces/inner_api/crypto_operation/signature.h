@@ -22,6 +22,8 @@
 #include "result.h"
 #include "key_pair.h"
 
+#define HCF_SIGN_MAX_BATCH_WORKER_NUM 64
+
 typedef enum {
     PSS_MD_NAME_STR = 100,
     PSS_MGF_NAME_STR = 101,
@@ -31,7 +33,12 @@ typedef enum {
     SM2_USER_ID_UINT8ARR = 105,
     ML_DSA_DETERMINISTIC_BOOL = 106,
     ML_DSA_MU_BOOL = 107,
-    ML_DSA_CONTEXT_UINT8ARR = 108
+    ML_DSA_CONTEXT_UINT8ARR = 108,
+    /*
+     * Set before init. sign and verify then take the digest of the message computed with the md of the object instead
+     * of the message, and update is rejected. For SM2 the digest is SM3 over Z || M, Z covering the user id.
+     */
+    SIGN_PREHASH_BOOL = 109
 } SignSpecItem;
 
 typedef struct HcfSign HcfSign;
@@ -56,6 +63,20 @@ struct HcfSign {
     HcfResult (*setSignSpecUint8Array)(HcfSign *self, SignSpecItem item, HcfBlob blob);
 
     HcfResult (*setSignSpecBool)(HcfSign *self, SignSpecItem item, bool flag);
+
+    HcfResult (*reset)(HcfSign *self);
+
+    /**
+     * @brief Signs count independent messages with the key of the last init, each as one sign call would.
+     *
+     * Data passed to update before is neither used nor discarded. The signatures are written to one arena allocated
+     * by the callee, which the caller frees with HcfBlobDataFree, and returnSignatures is a caller-provided array of
+     * count blobs that receive views into the arena. With workerNum above 1 the messages are split into contiguous
+     * ranges signed by up to workerNum threads, each with its own copy of the context, 0 or 1 runs in the calling
+     * thread. On failure no arena is returned and returnSignatures is cleared.
+     */
+    HcfResult (*signBatch)(HcfSign *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+        HcfBlob *returnArena, HcfBlob *returnSignatures);
 };
 
 typedef struct HcfVerify HcfVerify;
@@ -82,6 +103,8 @@ struct HcfVerify {
     HcfResult (*setVerifySpecUint8Array)(HcfVerify *self, SignSpecItem item, HcfBlob blob);
 
     HcfResult (*setVerifySpecBool)(HcfVerify *self, SignSpecItem item, bool flag);
+
+    HcfResult (*reset)(HcfVerify *self);
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_SM2_ASN1_CODEC_H
+#define HCF_SM2_ASN1_CODEC_H
+
+#include <stdint.h>
+#include "blob.h"
+#include "result.h"
+
+/*
+ * Converts SM2 ciphertexts and signatures between the raw form of GM/T 0003 and the DER form of GM/T 0009 in one
+ * pass, without OpenSSL objects or intermediate copies.
+ *
+ * The raw ciphertext is C1 || C3 || C2 for mode "C1C3C2" (the default when mode is NULL or empty) or
+ * C1 || C2 || C3 for mode "C1C2C3", where C1 is 0x04 || x || y with 32 byte coordinates and C3 is the 32 byte SM3
+ * hash. The raw signature is r || s with 32 byte values.
+ *
+ * Every output is written into the buffer of the caller: output->data is the buffer and output->len its capacity,
+ * and on success output->len is the length written. When output->data is NULL only the exact output length is
+ * returned in output->len.
+ */
+#define HCF_SM2_COORDINATE_LEN 32
+#define HCF_SM2_C3_DATA_LEN 32
+#define HCF_SM2_RAW_SIGNATURE_LEN 64
+
+/* Spans into the DER input, x and y are big endian without the sign byte of the INTEGER. */
+typedef struct {
+    HcfBlob xCoordinate;
+    HcfBlob yCoordinate;
+    HcfBlob hashData;
+    HcfBlob cipherTextData;
+} Sm2CipherTextView;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Parses a DER SM2 ciphertext into spans of the input, nothing is allocated or copied.
+ */
+HcfResult HcfSm2CipherTextParseAsn1(const HcfBlob *input, Sm2CipherTextView *view);
+
+HcfResult HcfSm2CipherTextAsn1ToRaw(const HcfBlob *input, const char *mode, HcfBlob *output);
+
+HcfResult HcfSm2CipherTextRawToAsn1(const HcfBlob *input, const char *mode, HcfBlob *output);
+
+HcfResult HcfSm2SignatureDerToRaw(const HcfBlob *input, HcfBlob *output);
+
+HcfResult HcfSm2SignatureRawToDer(const HcfBlob *input, HcfBlob *output);
+
+/**
+ * @brief Converts count ciphertexts into one arena of the caller.
+ *
+ * arena follows the output rules above for the sum of all outputs. outputs[i] is set to the span of the arena
+ * holding the conversion of inputs[i]. On failure nothing in the arena is valid.
+ */
+HcfResult HcfSm2CipherTextAsn1ToRawBatch(const HcfBlob *inputs, uint32_t count, const char *mode, HcfBlob *arena,
+    HcfBlob *outputs);
+
+HcfResult HcfSm2CipherTextRawToAsn1Batch(const HcfBlob *inputs, uint32_t count, const char *mode, HcfBlob *arena,
+    HcfBlob *outputs);
+
+HcfResult HcfSm2SignatureDerToRawBatch(const HcfBlob *inputs, uint32_t count, HcfBlob *arena, HcfBlob *outputs);
+
+HcfResult HcfSm2SignatureRawToDerBatch(const HcfBlob *inputs, uint32_t count, HcfBlob *arena, HcfBlob *outputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
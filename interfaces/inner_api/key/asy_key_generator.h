@@ -22,6 +22,8 @@
 #include "result.h"
 #include "key_pair.h"
 
+#define HCF_ASY_KEY_GEN_MAX_BATCH_WORKER_NUM 64
+
 enum HcfRsaKeySize {
     HCF_RSA_KEY_SIZE_512 = 512,
     HCF_RSA_KEY_SIZE_768 = 768,
@@ -74,6 +76,16 @@ struct HcfAsyKeyGenerator {
         const char *priKeyStr, HcfKeyPair **returnKeyPair);
 
     const char *(*getAlgoName)(HcfAsyKeyGenerator *self);
+
+    /**
+     * @brief Generates count key pairs, each as one generateKeyPair call would.
+     *
+     * returnKeyPairs is a caller-provided array of count pointers, every key pair is destroyed on its own with
+     * HcfObjDestroy. With workerNum above 1 the key pairs are split into contiguous ranges generated by up to workerNum
+     * threads, 0 or 1 runs in the calling thread. On failure returnKeyPairs is cleared.
+     */
+    HcfResult (*generateKeyPairs)(HcfAsyKeyGenerator *self, uint32_t count, uint32_t workerNum,
+        HcfKeyPair **returnKeyPairs);
 };
 
 typedef struct HcfAsyKeyGeneratorBySpec HcfAsyKeyGeneratorBySpec;
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_PUB_KEY_CACHE_H
+#define HCF_PUB_KEY_CACHE_H
+
+#include <stdint.h>
+#include "result.h"
+
+#define HCF_PUB_KEY_CACHE_MAX_CAPACITY 65536
+
+typedef struct {
+    uint32_t capacity;
+    uint32_t count;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+} HcfPubKeyCacheStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sets how many imported public keys are kept, 0 disables the cache and drops every entry.
+ *
+ * The cache is disabled by default. When enabled, convertKey of RSA, ECC, SM2, X25519 and Ed25519 public keys looks
+ * up the SHA-256 of the encoded bytes together with the algorithm before decoding, and the least recently used entry
+ * is evicted once the capacity is reached. Every returned key is still a separate object owned by the caller, only
+ * the decoded key material behind it is shared. Private keys are never cached.
+ */
+HcfResult HcfPubKeyCacheSetCapacity(uint32_t capacity);
+
+/**
+ * @brief Reads the current capacity, number of entries and the hit, miss and eviction counters.
+ */
+HcfResult HcfPubKeyCacheGetStats(HcfPubKeyCacheStats *stats);
+
+/**
+ * @brief Drops every cached key, the capacity and the counters are kept.
+ */
+void HcfPubKeyCachePurge(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
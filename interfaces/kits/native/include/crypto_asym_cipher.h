@@ -109,6 +109,30 @@ OH_Crypto_ErrCode OH_CryptoAsymCipher_Init(OH_CryptoAsymCipher *ctx, Crypto_Ciph
  */
 OH_Crypto_ErrCode OH_CryptoAsymCipher_Final(OH_CryptoAsymCipher *ctx, const Crypto_DataBlob *in, Crypto_DataBlob *out);
 
+/**
+ * @brief Encrypts or decrypts a batch of inputs with the key of the last init, spreading them over a bounded set of
+ *     workers. Only RSA is supported. If any input fails, the whole batch fails and no output is returned.
+ * @param ctx [in] Asymmetric cipher context. Cannot be NULL.
+ * @param in [in] Array of count inputs to be encrypted or decrypted.
+ * @param count [in] Number of inputs, must be greater than 0.
+ * @param workerNum [in] Number of workers, 0 or 1 runs in the calling thread. Cannot be greater than 64.
+ * @param arena [out] One buffer holding all outputs.
+ * @param out [out] Array of count entries that receive the outputs. They point into the arena and must not be
+ *     freed on their own.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is invalid or ctx has not been
+ *            initialized.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the algorithm does not support batch operation.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if any input fails to be encrypted or decrypted.</li>
+ *         </ul>
+ * @release crypto_common/OH_Crypto_FreeDataBlob {arena}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsymCipher_FinalBatch(OH_CryptoAsymCipher *ctx, const Crypto_DataBlob *in, uint32_t count,
+    uint32_t workerNum, Crypto_DataBlob *arena, Crypto_DataBlob *out);
+
 /**
  * @brief Destroys the asymmetric cipher context.
  * @param ctx [in] Asymmetric cipher context.
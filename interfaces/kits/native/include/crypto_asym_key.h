@@ -289,6 +289,26 @@ OH_Crypto_ErrCode OH_CryptoAsymKeyGenerator_Create(const char *algoName, OH_Cryp
  */
 OH_Crypto_ErrCode OH_CryptoAsymKeyGenerator_Generate(OH_CryptoAsymKeyGenerator *ctx, OH_CryptoKeyPair **keyCtx);
 
+/**
+ * @brief Generates a batch of asymmetric key pairs, spreading them over a bounded set of workers.
+ *     Supported for "Ed25519", "X25519" and the ECC series, including BrainPool and "ECC_Secp256k1".
+ * @param ctx [in] Asymmetric key generator. Cannot be NULL.
+ * @param count [in] Number of key pairs, must be greater than 0.
+ * @param workerNum [in] Number of workers, 0 or 1 generates in the calling thread. Cannot be greater than 64.
+ * @param keyCtxs [out] Array of count entries that receive the key pairs. Each key pair is released on its own.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory operation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the algorithm does not support batch generation or
+ *            crypto operation fails.</li>
+ *         </ul>
+ * @release crypto_asym_key/OH_CryptoKeyPair_Destroy {keyCtxs}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsymKeyGenerator_GenerateKeyPairs(OH_CryptoAsymKeyGenerator *ctx, uint32_t count,
+    uint32_t workerNum, OH_CryptoKeyPair **keyCtxs);
+
 /**
  * @brief Converts asymmetric key data to a key pair.
  * @param ctx [in] Asymmetric key generator. Cannot be NULL.
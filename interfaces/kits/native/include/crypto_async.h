@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup CryptoAsyncApi
+ * @{
+ * @brief Describes the asynchronous crypto interfaces provided by OpenHarmony for applications.
+ *     The operations run on a worker pool owned by the library, and the result is reported to a completion callback.
+ * @since 26.0.0
+ */
+
+/**
+ * @file crypto_async.h
+ * @brief Defines the asynchronous crypto interfaces.
+ *
+ * Ownership: once a submission succeeds, the context and every buffer passed to it belong to the task until the
+ * callback is invoked or the task is cancelled. The caller must not use them in that window, and only one task may
+ * be outstanding per context. The callback runs on a worker thread of the pool and may submit new tasks, including
+ * on the same context.
+ *
+ * @syscap SystemCapability.Security.CryptoFramework
+ * @library libohcrypto.so
+ * @kit CryptoArchitectureKit
+ * @since 26.0.0
+ */
+
+#ifndef CRYPTO_ASYNC_H
+#define CRYPTO_ASYNC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "crypto_common.h"
+#include "crypto_asym_cipher.h"
+#include "crypto_asym_key.h"
+#include "crypto_digest.h"
+#include "crypto_kdf.h"
+#include "crypto_signature.h"
+#include "crypto_sym_cipher.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Completion callback of an asynchronous task.
+ * @param taskId [in] Id returned when the task was submitted.
+ * @param result [in] Error code the synchronous counterpart of the operation would have returned.
+ * @param userData [in] User data passed when the task was submitted.
+ * @since 26.0.0
+ */
+typedef void (*OH_CryptoAsync_Callback)(uint64_t taskId, OH_Crypto_ErrCode result, void *userData);
+
+/**
+ * @brief Configures the worker pool used by the asynchronous interfaces.
+ *     The pool is created on the first submission, with 4 workers and a queue of 64 waiting tasks by default.
+ * @param workerNum [in] Number of worker threads, in the range [1, 64].
+ * @param queueDepth [in] Maximum number of tasks waiting for a worker, in the range [1, 4096].
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is out of range.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_INVALID_CALL} if tasks are queued or running.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_SetPoolConfig(uint32_t workerNum, uint32_t queueDepth);
+
+/**
+ * @brief Cancels a task that has not started yet. The callback of a cancelled task is not invoked and the
+ *     ownership of its context and buffers returns to the caller.
+ * @param taskId [in] Id returned when the task was submitted.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the task was cancelled.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_INVALID_CALL} if the task is running, finished or unknown,
+ *            in which case its callback is or has been invoked.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_Cancel(uint64_t taskId);
+
+/**
+ * @brief Generates a key pair asynchronously, see {@link OH_CryptoAsymKeyGenerator_Generate}.
+ * @param ctx [in] Asymmetric key generator context. Cannot be NULL.
+ * @param keyCtx [out] Pointer to the key pair, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the task is queued.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if ctx, keyCtx or callback is NULL.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_INVALID_CALL} if the queue is full or ctx has a task outstanding.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the worker pool cannot be started.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_GenerateKeyPair(OH_CryptoAsymKeyGenerator *ctx, OH_CryptoKeyPair **keyCtx,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+/**
+ * @brief Finishes a symmetric cipher operation asynchronously, see {@link OH_CryptoSymCipher_Final}.
+ * @param ctx [in] Initialized symmetric cipher context. Cannot be NULL.
+ * @param in [in] Data to be processed, may be NULL.
+ * @param out [out] Result, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return Same as {@link OH_CryptoAsync_GenerateKeyPair}.
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_SymCipherFinal(OH_CryptoSymCipher *ctx, Crypto_DataBlob *in, Crypto_DataBlob *out,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+/**
+ * @brief Finishes an asymmetric cipher operation asynchronously, see {@link OH_CryptoAsymCipher_Final}.
+ * @param ctx [in] Initialized asymmetric cipher context. Cannot be NULL.
+ * @param in [in] Data to be processed. Cannot be NULL.
+ * @param out [out] Result, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return Same as {@link OH_CryptoAsync_GenerateKeyPair}.
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_AsymCipherFinal(OH_CryptoAsymCipher *ctx, const Crypto_DataBlob *in,
+    Crypto_DataBlob *out, OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+/**
+ * @brief Appends in to the digest and finishes it asynchronously, see {@link OH_CryptoDigest_Update} and
+ *     {@link OH_CryptoDigest_Final}.
+ * @param ctx [in] Digest context. Cannot be NULL.
+ * @param in [in] Data to be appended before finishing, may be NULL.
+ * @param out [out] Digest, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return Same as {@link OH_CryptoAsync_GenerateKeyPair}.
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_DigestFinal(OH_CryptoDigest *ctx, Crypto_DataBlob *in, Crypto_DataBlob *out,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+/**
+ * @brief Signs asynchronously, see {@link OH_CryptoSign_Final}.
+ * @param ctx [in] Initialized signing context. Cannot be NULL.
+ * @param in [in] Data to be signed, may be NULL.
+ * @param out [out] Signature, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return Same as {@link OH_CryptoAsync_GenerateKeyPair}.
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_SignFinal(OH_CryptoSign *ctx, const Crypto_DataBlob *in, Crypto_DataBlob *out,
+    OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+/**
+ * @brief Verifies asynchronously, see {@link OH_CryptoVerify_Final}.
+ * @param ctx [in] Initialized verification context. Cannot be NULL.
+ * @param in [in] Data to be verified, may be NULL.
+ * @param signData [in] Signature. Cannot be NULL.
+ * @param result [out] Verification result, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return Same as {@link OH_CryptoAsync_GenerateKeyPair}.
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_VerifyFinal(OH_CryptoVerify *ctx, Crypto_DataBlob *in, Crypto_DataBlob *signData,
+    bool *result, OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+/**
+ * @brief Derives a key asynchronously, see {@link OH_CryptoKdf_Derive}.
+ * @param ctx [in] KDF context. Cannot be NULL.
+ * @param params [in] KDF parameters. Cannot be NULL.
+ * @param keyLen [in] Length of the derived key.
+ * @param key [out] Derived key, valid when the callback reports success. Cannot be NULL.
+ * @param callback [in] Completion callback. Cannot be NULL.
+ * @param userData [in] User data passed to the callback, may be NULL.
+ * @param taskId [out] Id of the task, may be NULL.
+ * @return Same as {@link OH_CryptoAsync_GenerateKeyPair}.
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoAsync_KdfDerive(OH_CryptoKdf *ctx, const OH_CryptoKdfParams *params, int keyLen,
+    Crypto_DataBlob *key, OH_CryptoAsync_Callback callback, void *userData, uint64_t *taskId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_ASYNC_H */
+/** @} */
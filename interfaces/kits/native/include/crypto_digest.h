@@ -80,6 +80,26 @@ OH_Crypto_ErrCode OH_CryptoDigest_Create(const char *algoName, OH_CryptoDigest *
  */
 OH_Crypto_ErrCode OH_CryptoDigest_Update(OH_CryptoDigest *ctx, Crypto_DataBlob *in);
 
+/**
+ * @brief Updates digest data with a range of a file, without copying it through the caller.
+ *     Regular files are mapped in large windows and read with sequential readahead. The file must not be
+ *     truncated during the call.
+ * @param ctx [in] Digest context. Cannot be NULL.
+ * @param fd [in] Readable file descriptor.
+ * @param offset [in] Offset of the first byte to process. Must be 0 for pipes and sockets.
+ * @param length [in] Number of bytes to process, 0 processes up to the end of the file.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if ctx is NULL, fd is invalid or the range
+ *             exceeds the file.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if reading the file or the digest update fails.</li>
+ *         </ul>
+ * @since 26.0.0
+ * @see {@link OH_CryptoDigest_Final} Finishes the digest operation and outputs the result.
+ */
+OH_Crypto_ErrCode OH_CryptoDigest_UpdateFd(OH_CryptoDigest *ctx, int32_t fd, uint64_t offset, uint64_t length);
+
 /**
  * @brief Finishes the digest operation and outputs the result.
  * @param ctx [in] Digest context. Cannot be NULL.
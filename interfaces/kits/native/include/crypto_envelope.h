@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup CryptoEnvelopeApi
+ * @{
+ * @brief Describes the hybrid envelope encryption interfaces provided by OpenHarmony for applications.
+ * @since 26.0.0
+ */
+
+/**
+ * @file crypto_envelope.h
+ * @brief Defines the hybrid envelope encryption interfaces.
+ * @syscap SystemCapability.Security.CryptoFramework
+ * @library libohcrypto.so
+ * @kit CryptoArchitectureKit
+ * @since 26.0.0
+ */
+
+#ifndef CRYPTO_ENVELOPE_H
+#define CRYPTO_ENVELOPE_H
+
+#include "crypto_common.h"
+#include "crypto_asym_key.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Envelope structure, representing a hybrid envelope encryption context.
+ * @since 26.0.0
+ */
+typedef struct OH_CryptoEnvelope OH_CryptoEnvelope;
+
+/**
+ * @brief Creates an envelope context based on the given suite name.
+ * @param algoName [in] Envelope suite name. Cannot be NULL. Values: "X25519-AES256-GCM", "ECC-AES256-GCM",
+ *     "SM2-SM4-GCM", "RSA-KEM-AES256-GCM".
+ * @param ctx [out] Pointer to the envelope context pointer. ctx cannot be NULL, *ctx must be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if algoName or ctx is NULL.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the suite is not supported.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         </ul>
+ * @release crypto_envelope/OH_CryptoEnvelope_Destroy {ctx}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoEnvelope_Create(const char *algoName, OH_CryptoEnvelope **ctx);
+
+/**
+ * @brief Encrypts the input to the holder of the private key of pubkey in one call.
+ *     A fresh shared secret is agreed with pubkey, HKDF derives the content key from it and the AEAD protects the
+ *     input together with aad. The envelope carries everything the recipient needs besides the private key.
+ * @param ctx [in] Envelope context. Cannot be NULL.
+ * @param pubkey [in] Public key of the recipient, whose type must match the suite. Cannot be NULL.
+ * @param aad [in] Additional authenticated data, may be NULL.
+ * @param in [in] Data to be encrypted. Cannot be NULL or empty.
+ * @param out [out] Pointer to the Crypto_DataBlob structure for storing the envelope. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is invalid or the key does not
+ *            match the suite.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the encryption fails.</li>
+ *         </ul>
+ * @release crypto_common/OH_Crypto_FreeDataBlob {out}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoEnvelope_Seal(OH_CryptoEnvelope *ctx, OH_CryptoPubKey *pubkey, const Crypto_DataBlob *aad,
+    const Crypto_DataBlob *in, Crypto_DataBlob *out);
+
+/**
+ * @brief Decrypts an envelope sealed to the public key of privkey with the same aad.
+ * @param ctx [in] Envelope context. Cannot be NULL.
+ * @param privkey [in] Private key of the recipient, whose type must match the suite. Cannot be NULL.
+ * @param aad [in] Additional authenticated data used when sealing, may be NULL.
+ * @param in [in] Envelope to be decrypted. Cannot be NULL or empty.
+ * @param out [out] Pointer to the Crypto_DataBlob structure for storing the plaintext. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is invalid, the key does not
+ *            match the suite or the envelope header is malformed.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the decryption fails. Possible causes: wrong key,
+ *            wrong aad, or the envelope has been modified.</li>
+ *         </ul>
+ * @release crypto_common/OH_Crypto_FreeDataBlob {out}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoEnvelope_Open(OH_CryptoEnvelope *ctx, OH_CryptoPrivKey *privkey,
+    const Crypto_DataBlob *aad, const Crypto_DataBlob *in, Crypto_DataBlob *out);
+
+/**
+ * @brief Destroys the envelope context.
+ * @param ctx [in] Envelope context.
+ * @since 26.0.0
+ */
+void OH_CryptoEnvelope_Destroy(OH_CryptoEnvelope *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_ENVELOPE_H */
+/** @} */
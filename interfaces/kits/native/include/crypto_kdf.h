@@ -102,6 +102,14 @@ typedef enum {
      * @since 20
      */
     CRYPTO_KDF_SCRYPT_MAX_MEM_UINT64 = 7,
+
+    /**
+     * @brief Number of threads for PBKDF2 and SCRYPT, as uint32_t. 0 and 1 derive on the calling thread,
+     *     the maximum is 64. PBKDF2 computes output blocks concurrently, SCRYPT mixes the p lanes concurrently
+     *     within the maximum memory. The derived key is the same for any number of threads.
+     * @since 26.0.0
+     */
+    CRYPTO_KDF_THREAD_NUM_UINT32 = 8,
 } CryptoKdf_ParamType;
 
 /**
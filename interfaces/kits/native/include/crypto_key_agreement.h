@@ -34,6 +34,7 @@
 
 #include "crypto_common.h"
 #include "crypto_asym_key.h"
+#include "crypto_kdf.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -96,6 +97,34 @@ OH_Crypto_ErrCode OH_CryptoKeyAgreement_Create(const char *algoName, OH_CryptoKe
 OH_Crypto_ErrCode OH_CryptoKeyAgreement_GenerateSecret(OH_CryptoKeyAgreement *ctx, OH_CryptoPrivKey *privkey,
     OH_CryptoPubKey *pubkey, Crypto_DataBlob *secret);
 
+/**
+ * @brief Generates a shared secret and derives a key from it with a KDF in one call.
+ *
+ * Only the derived key is returned, the shared secret itself is never handed out.
+ * @param ctx [in] Key agreement context. Cannot be NULL.
+ * @param privkey [in] Private key. Cannot be NULL.
+ * @param pubkey [in] Public key. Cannot be NULL.
+ * @param kdfAlgoName [in] KDF algorithm name, "HKDF|<md>" or "X963KDF|<md>", where md is "SHA1", "SHA224",
+ *     "SHA256", "SHA384", "SHA512", or "SM3" for HKDF only. Cannot be NULL.
+ * @param params [in] HKDF or X963KDF params created with the same KDF, of which only the salt and the info are used.
+ *     The key param is ignored. Can be NULL for no salt and no info.
+ * @param keyLen [in] Length of the derived key in bytes, from 1 to 8192.
+ * @param key [out] Pointer to the Crypto_DataBlob structure for storing the derived key. Cannot be NULL.
+ *     Initialize key to {0} before calling. Do not pre-allocate key->data.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the algorithm is not supported.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the key agreement or the KDF fails.</li>
+ *         </ul>
+ * @release crypto_common/OH_Crypto_FreeDataBlob {key}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoKeyAgreement_DeriveKey(OH_CryptoKeyAgreement *ctx, OH_CryptoPrivKey *privkey,
+    OH_CryptoPubKey *pubkey, const char *kdfAlgoName, const OH_CryptoKdfParams *params, uint32_t keyLen,
+    Crypto_DataBlob *key);
+
 /**
  * @brief Destroys the key agreement context.
  * @param ctx [in] Key agreement context.
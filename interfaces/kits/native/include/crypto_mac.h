@@ -139,6 +139,24 @@ OH_Crypto_ErrCode OH_CryptoMac_Init(OH_CryptoMac *ctx, const OH_CryptoSymKey *ke
  */
 OH_Crypto_ErrCode OH_CryptoMac_Update(OH_CryptoMac *ctx, const Crypto_DataBlob *in);
 
+/**
+ * @brief Updates MAC data with a range of a file, like {@link OH_CryptoDigest_UpdateFd}.
+ * @param ctx [in] Initialized MAC context. Cannot be NULL.
+ * @param fd [in] Readable file descriptor.
+ * @param offset [in] Offset of the first byte to process. Must be 0 for pipes and sockets.
+ * @param length [in] Number of bytes to process, 0 processes up to the end of the file.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if ctx is NULL, fd is invalid or the range
+ *             exceeds the file.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if reading the file or the MAC update fails.</li>
+ *         </ul>
+ * @since 26.0.0
+ * @see {@link OH_CryptoMac_Final} Finishes the MAC operation.
+ */
+OH_Crypto_ErrCode OH_CryptoMac_UpdateFd(OH_CryptoMac *ctx, int32_t fd, uint64_t offset, uint64_t length);
+
 /**
  * @brief Finishes the MAC operation.
  * @param ctx [in] MAC context. Cannot be NULL.
@@ -75,6 +75,14 @@ typedef enum {
      * @since 12
      */
     CRYPTO_SM2_USER_ID_DATABLOB = 105,
+    /**
+     * @brief Whether sign and verify take the digest of the message instead of the message, as a bool value.
+     *
+     * Set before init. The digest is computed with the digest algorithm of the context, for SM2 it is SM3 over
+     * Z || M. Update is rejected in this mode.
+     * @since 26.0.0
+     */
+    CRYPTO_SIGN_PREHASH_BOOL = 109,
 } CryptoSignature_ParamType;
 
 /**
@@ -239,6 +247,21 @@ OH_Crypto_ErrCode OH_CryptoVerify_SetParam(OH_CryptoVerify *ctx, CryptoSignature
 OH_Crypto_ErrCode OH_CryptoVerify_GetParam(OH_CryptoVerify *ctx, CryptoSignature_ParamType type,
     Crypto_DataBlob *value);
 
+/**
+ * @brief Resets the verification context to the state right after init. Data passed to update is discarded,
+ *     while the key and the parameters that have been set are kept.
+ * @param ctx [in] Verification context. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if ctx is NULL or has not been
+ *            initialized.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if crypto operation fails.</li>
+ *         </ul>
+ * @since 26.0.0
+ * @see {@link OH_CryptoVerify_Init} Initializing with a new key also reuses the context.
+ */
+OH_Crypto_ErrCode OH_CryptoVerify_Reset(OH_CryptoVerify *ctx);
+
 /**
  * @brief Destroys the verification context.
  * @param ctx [in] Verification context.
@@ -373,6 +396,45 @@ OH_Crypto_ErrCode OH_CryptoSign_SetParam(OH_CryptoSign *ctx, CryptoSignature_Par
  */
 OH_Crypto_ErrCode OH_CryptoSign_GetParam(OH_CryptoSign *ctx, CryptoSignature_ParamType type, Crypto_DataBlob *value);
 
+/**
+ * @brief Resets the signing context to the state right after init. Data passed to update is discarded,
+ *     while the key and the parameters that have been set are kept.
+ * @param ctx [in] Signing context. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if ctx is NULL or has not been
+ *            initialized.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if crypto operation fails.</li>
+ *         </ul>
+ * @since 26.0.0
+ * @see {@link OH_CryptoSign_Init} Initializing with a new key also reuses the context.
+ */
+OH_Crypto_ErrCode OH_CryptoSign_Reset(OH_CryptoSign *ctx);
+
+/**
+ * @brief Signs a batch of messages with the key of the last init, spreading them over a bounded set of workers.
+ *     Data passed to update is neither used nor discarded.
+ * @param ctx [in] Signing context. Cannot be NULL.
+ * @param in [in] Array of count messages to sign.
+ * @param count [in] Number of messages, must be greater than 0.
+ * @param workerNum [in] Number of workers, 0 or 1 signs in the calling thread. Cannot be greater than 64.
+ * @param arena [out] One buffer holding all signatures.
+ * @param out [out] Array of count entries that receive the signatures. They point into the arena and must not be
+ *     freed on their own.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if a parameter is invalid or ctx has not been
+ *            initialized.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory operation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the algorithm does not support batch signing or
+ *            crypto operation fails.</li>
+ *         </ul>
+ * @release crypto_common/OH_Crypto_FreeDataBlob {arena}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSign_SignBatch(OH_CryptoSign *ctx, const Crypto_DataBlob *in, uint32_t count,
+    uint32_t workerNum, Crypto_DataBlob *arena, Crypto_DataBlob *out);
+
 /**
  * @brief Destroys the signing context.
  * @param ctx [in] Signing context.
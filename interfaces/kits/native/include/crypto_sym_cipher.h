@@ -32,6 +32,7 @@
 #ifndef CRYPTO_SYM_CIPHER_H
 #define CRYPTO_SYM_CIPHER_H
 
+#include <stdbool.h>
 #include "crypto_common.h"
 #include "crypto_sym_key.h"
 
@@ -61,6 +62,28 @@ typedef enum {
     CRYPTO_TAG_DATABLOB = 102,
 } CryptoSymCipher_ParamsType;
 
+/**
+ * @brief Defines how the nonce of an AEAD cipher is obtained when encrypting.
+ * @since 26.0.0
+ */
+typedef enum {
+    /**
+     * @brief The caller passes the nonce as {@link CryptoSymCipher_ParamsType#CRYPTO_IV_DATABLOB}, the default.
+     * @since 26.0.0
+     */
+    CRYPTO_AEAD_NONCE_EXTERNAL = 0,
+    /**
+     * @brief 12-byte nonce made of a 4-byte fixed field and a 64-bit big-endian invocation counter of the key.
+     * @since 26.0.0
+     */
+    CRYPTO_AEAD_NONCE_COUNTER = 1,
+    /**
+     * @brief 12-byte random nonce, at most 2^32 encryptions per key.
+     * @since 26.0.0
+     */
+    CRYPTO_AEAD_NONCE_RANDOM = 2,
+} Crypto_AeadNonceMode;
+
 /**
  * @brief Symmetric cipher structure, representing a symmetric cipher context.
  * @since 12
@@ -208,6 +231,27 @@ OH_Crypto_ErrCode OH_CryptoSymCipher_Init(OH_CryptoSymCipher *ctx, Crypto_Cipher
  */
 OH_Crypto_ErrCode OH_CryptoSymCipher_Update(OH_CryptoSymCipher *ctx, Crypto_DataBlob *in, Crypto_DataBlob *out);
 
+/**
+ * @brief Encrypts or decrypts a range of a file with update calls and appends the output to another file.
+ *     The input is read like in {@link OH_CryptoDigest_UpdateFd}. The context stays open, finish it with
+ *     {@link OH_CryptoSymCipher_Final} and write that output as well.
+ * @param ctx [in] Initialized symmetric cipher context. Cannot be NULL.
+ * @param inFd [in] Readable file descriptor of the input.
+ * @param offset [in] Offset of the first byte to process. Must be 0 for pipes and sockets.
+ * @param length [in] Number of bytes to process, 0 processes up to the end of the file.
+ * @param outFd [in] Writable file descriptor, written at its current position.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if ctx is NULL, a fd is invalid or the range
+ *             exceeds the file.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if file I/O or the cipher update fails.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipher_UpdateFd(OH_CryptoSymCipher *ctx, int32_t inFd, uint64_t offset,
+    uint64_t length, int32_t outFd);
+
 /**
  * @brief Finishes the cipher operation, outputting the final result.
  * @param ctx [in] Symmetric cipher context. Cannot be NULL.
@@ -248,6 +292,182 @@ const char *OH_CryptoSymCipher_GetAlgoName(OH_CryptoSymCipher *ctx);
  */
 void OH_CryptoSymCipher_Destroy(OH_CryptoSymCipher *ctx);
 
+/**
+ * @brief Sets the number of worker threads used for large inputs, supported by AES CTR, AES XTS and ChaCha20.
+ *     Inputs of at least 1 MiB are split into segments that are processed concurrently, the output is the same as
+ *     with a single thread. The setting is kept across {@link OH_CryptoSymCipher_Init} calls.
+ * @param ctx [in] Symmetric cipher context. Cannot be NULL.
+ * @param workerNum [in] Number of worker threads including the calling thread, 0 and 1 disable it, the maximum is 64.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the algorithm does not support it.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipher_SetParallelWorkerNum(OH_CryptoSymCipher *ctx, uint32_t workerNum);
+
+/**
+ * @brief Encrypts or decrypts consecutive AES-XTS data units, such as disk sectors, in one call.
+ *     The tweak of each unit is its sequence number encoded as a 128-bit little-endian value, counting from
+ *     startDataUnit. The IV passed to {@link OH_CryptoSymCipher_Init} is not used, and the context stays
+ *     initialized, so it can process further batches with the same key and mode.
+ * @param ctx [in] Symmetric cipher context initialized in "AES128|XTS" or "AES256|XTS". Cannot be NULL.
+ * @param startDataUnit [in] Sequence number of the first data unit in the input.
+ * @param dataUnitSize [in] Size of each data unit in bytes, at least 16, for example 4096.
+ * @param in [in] Data to be encrypted or decrypted, its length must be a multiple of dataUnitSize. Cannot be NULL.
+ * @param out [out] Output with the same length as in. Cannot be NULL. Initialize out to {0} before calling.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid or the context is
+ *            not initialized.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the context is not in XTS mode.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the cipher operation fails.</li>
+ *         </ul>
+ * @release crypto_common/OH_Crypto_FreeDataBlob {out}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipher_ProcessDataUnits(OH_CryptoSymCipher *ctx, uint64_t startDataUnit,
+    uint32_t dataUnitSize, const Crypto_DataBlob *in, Crypto_DataBlob *out);
+
+/**
+ * @brief Sets how the nonce is obtained when encrypting with AES GCM, AES CCM or ChaCha20-Poly1305.
+ *     In the generated modes the cipher draws a nonce that is never repeated for the key object on every
+ *     {@link OH_CryptoSymCipher_Init} in encrypt mode, and puts it in front of the first output, so the record is
+ *     nonce || ciphertext || tag. The params passed to init must not contain an IV. Decryption takes the nonce as
+ *     {@link CryptoSymCipher_ParamsType#CRYPTO_IV_DATABLOB}. A key object can only be used with one generated mode.
+ * @param ctx [in] Symmetric cipher context. Cannot be NULL.
+ * @param mode [in] Nonce mode.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the algorithm does not support it.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipher_SetAeadNonceMode(OH_CryptoSymCipher *ctx, Crypto_AeadNonceMode mode);
+
+/**
+ * @brief Sets the 4-byte fixed field of {@link Crypto_AeadNonceMode#CRYPTO_AEAD_NONCE_COUNTER} nonces, for example
+ *     a device or sender identifier. Without it a random fixed field is generated once per key object.
+ * @param ctx [in] Symmetric cipher context. Cannot be NULL.
+ * @param fixedField [in] Fixed field of 4 bytes. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_NOT_SUPPORTED} if the algorithm does not support it.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipher_SetAeadNonceFixedField(OH_CryptoSymCipher *ctx,
+    const Crypto_DataBlob *fixedField);
+
+/**
+ * @brief Defines the symmetric cipher stream structure.
+ * @since 26.0.0
+ */
+typedef struct OH_CryptoSymCipherStream OH_CryptoSymCipherStream;
+
+/**
+ * @brief Defines the callback that receives the output of a cipher stream.
+ * @param userData [in] User data passed to {@link OH_CryptoSymCipherStream_Create}.
+ * @param result [in] Result of the chunk. If it is not CRYPTO_SUCCESS, the stream stops and isFinal is true.
+ * @param out [in] Output of the chunk, valid only during the callback. out->len can be 0.
+ * @param isFinal [in] True for the output of the final chunk or for the error that stops the stream.
+ * @since 26.0.0
+ */
+typedef void (*OH_CryptoSymCipherStream_OnData)(void *userData, OH_Crypto_ErrCode result,
+    const Crypto_DataBlob *out, bool isFinal);
+
+/**
+ * @brief Creates a stream that feeds an initialized cipher from a bounded queue on a dedicated worker thread.
+ *     Chunks are copied on write and processed in write order. The cipher must stay alive and must not be used
+ *     directly until the stream is destroyed.
+ * @param cipher [in] Symmetric cipher context initialized by {@link OH_CryptoSymCipher_Init}. Cannot be NULL.
+ * @param queueDepth [in] Maximum number of queued chunks, 0 means the default depth 8, the maximum is 64.
+ * @param onData [in] Output callback, called on the worker thread. Cannot be NULL.
+ * @param userData [in] User data passed to onData.
+ * @param stream [out] Pointer to the cipher stream. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if the worker thread fails to start.</li>
+ *         </ul>
+ * @release crypto_sym_cipher/OH_CryptoSymCipherStream_Destroy {stream}
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Create(OH_CryptoSymCipher *cipher, uint32_t queueDepth,
+    OH_CryptoSymCipherStream_OnData onData, void *userData, OH_CryptoSymCipherStream **stream);
+
+/**
+ * @brief Queues a chunk for update, blocks while the queue is full.
+ * @param stream [in] Cipher stream. Cannot be NULL.
+ * @param in [in] Chunk to be encrypted or decrypted. Cannot be NULL or empty.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_INVALID_CALL} if the stream is already finished.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if an earlier chunk failed.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Write(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in);
+
+/**
+ * @brief Queues a chunk for update without blocking.
+ * @param stream [in] Cipher stream. Cannot be NULL.
+ * @param in [in] Chunk to be encrypted or decrypted. Cannot be NULL or empty.
+ * @param accepted [out] Set to false if the queue is full and the chunk was not queued. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_INVALID_CALL} if the stream is already finished.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if an earlier chunk failed.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_TryWrite(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in,
+    bool *accepted);
+
+/**
+ * @brief Queues the final chunk, no chunk can be written afterwards.
+ * @param stream [in] Cipher stream. Cannot be NULL.
+ * @param in [in] Final chunk. Can be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if the operation succeeds.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if parameters are invalid.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_MEMORY_ERROR} if memory allocation fails.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_INVALID_CALL} if the stream is already finished.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if an earlier chunk failed.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Finish(OH_CryptoSymCipherStream *stream, const Crypto_DataBlob *in);
+
+/**
+ * @brief Waits until all queued chunks have been processed.
+ * @param stream [in] Cipher stream. Cannot be NULL.
+ * @return <ul>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_SUCCESS} if all chunks succeed.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_PARAMETER_CHECK_FAILED} if stream is NULL.</li>
+ *         <li>{@link OH_Crypto_ErrCode#CRYPTO_OPERTION_ERROR} if a chunk failed, for example the tag
+ *            verification of the final chunk.</li>
+ *         </ul>
+ * @since 26.0.0
+ */
+OH_Crypto_ErrCode OH_CryptoSymCipherStream_Wait(OH_CryptoSymCipherStream *stream);
+
+/**
+ * @brief Destroys the cipher stream. Chunks that have not been processed are discarded.
+ * @param stream [in] Cipher stream.
+ * @since 26.0.0
+ */
+void OH_CryptoSymCipherStream_Destroy(OH_CryptoSymCipherStream *stream);
+
 #ifdef __cplusplus
 }
 #endif
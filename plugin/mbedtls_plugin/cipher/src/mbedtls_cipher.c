@@ -0,0 +1,404 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbedtls_cipher.h"
+
+#include "mbedtls_common.h"
+#include "mbedtls_ctx_pool.h"
+#include "mbedtls_sym_key.h"
+#include "mbedtls/cipher.h"
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "utils.h"
+#include "detailed_gcm_params.h"
+#include "detailed_iv_params.h"
+
+#define AES_BLOCK_SIZE 16
+#define AES_IV_LEN 16
+#define GCM_IV_MIN_LEN 1
+#define GCM_IV_MAX_LEN 16
+#define GCM_TAG_MIN_LEN 4
+#define GCM_TAG_MAX_LEN 16
+#define AES_KEY_BITS_128 128
+#define AES_KEY_BITS_192 192
+#define AES_KEY_BITS_256 256
+
+typedef struct {
+    HcfCipherGeneratorSpi base;
+    CipherAttr attr;
+    /* set up for info, kept over inits with the same key size so the mbedtls key context is allocated once */
+    mbedtls_cipher_context_t ctx;
+    const mbedtls_cipher_info_t *info;
+    enum HcfCryptoMode opMode;
+    bool isInited;
+    uint32_t tagLen;
+    uint8_t tag[GCM_TAG_MAX_LEN];
+} MbedtlsAesCipherSpiImpl;
+
+static const char *GetMbedtlsAesCipherClass(void)
+{
+    return "MbedtlsAesCipher";
+}
+
+static MbedtlsAesCipherSpiImpl *GetMbedtlsAesCipherImpl(HcfCipherGeneratorSpi *self)
+{
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, GetMbedtlsAesCipherClass())) {
+        LOGE("Class is not match.");
+        return NULL;
+    }
+    return (MbedtlsAesCipherSpiImpl *)self;
+}
+
+static mbedtls_cipher_mode_t GetMbedtlsCipherMode(HcfAlgParaValue mode)
+{
+    switch (mode) {
+        case HCF_ALG_MODE_CBC:
+            return MBEDTLS_MODE_CBC;
+        case HCF_ALG_MODE_CTR:
+            return MBEDTLS_MODE_CTR;
+        case HCF_ALG_MODE_GCM:
+            return MBEDTLS_MODE_GCM;
+        default:
+            return MBEDTLS_MODE_NONE;
+    }
+}
+
+static uint32_t GetAttrKeyBits(HcfAlgParaValue keySize)
+{
+    switch (keySize) {
+        case HCF_ALG_AES_128:
+            return AES_KEY_BITS_128;
+        case HCF_ALG_AES_192:
+            return AES_KEY_BITS_192;
+        case HCF_ALG_AES_256:
+            return AES_KEY_BITS_256;
+        default:
+            return 0;
+    }
+}
+
+static bool IsKeyLenValid(const MbedtlsAesCipherSpiImpl *impl, const HcfBlob *keyMaterial)
+{
+    uint32_t keyBits = (uint32_t)keyMaterial->len * HCF_BITS_PER_BYTE;
+    if ((keyBits != AES_KEY_BITS_128) && (keyBits != AES_KEY_BITS_192) && (keyBits != AES_KEY_BITS_256)) {
+        return false;
+    }
+    uint32_t attrKeyBits = GetAttrKeyBits(impl->attr.keySize);
+    return (attrKeyBits == 0) || (attrKeyBits == keyBits);
+}
+
+static HcfResult CheckParams(const MbedtlsAesCipherSpiImpl *impl, HcfParamsSpec *params)
+{
+    if (params == NULL) {
+        LOGE("Params spec is required!");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->attr.mode != HCF_ALG_MODE_GCM) {
+        HcfIvParamsSpec *ivParams = (HcfIvParamsSpec *)params;
+        if ((ivParams->iv.data == NULL) || (ivParams->iv.len != AES_IV_LEN)) {
+            LOGE("iv is invalid!");
+            return HCF_INVALID_PARAMS;
+        }
+        return HCF_SUCCESS;
+    }
+    HcfGcmParamsSpec *gcmParams = (HcfGcmParamsSpec *)params;
+    if ((gcmParams->iv.data == NULL) || (gcmParams->iv.len < GCM_IV_MIN_LEN) ||
+        (gcmParams->iv.len > GCM_IV_MAX_LEN)) {
+        LOGE("iv is invalid!");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((gcmParams->tag.data == NULL) || (gcmParams->tag.len < GCM_TAG_MIN_LEN) ||
+        (gcmParams->tag.len > GCM_TAG_MAX_LEN)) {
+        LOGE("tag is invalid!");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((gcmParams->aad.data == NULL) && (gcmParams->aad.len != 0)) {
+        LOGE("aad is invalid!");
+        return HCF_INVALID_PARAMS;
+    }
+    return HCF_SUCCESS;
+}
+
+static int32_t SetupCipherCtx(MbedtlsAesCipherSpiImpl *impl, uint32_t keyBits)
+{
+    const mbedtls_cipher_info_t *info = mbedtls_cipher_info_from_values(MBEDTLS_CIPHER_ID_AES, (int)keyBits,
+        GetMbedtlsCipherMode(impl->attr.mode));
+    if (info == NULL) {
+        LOGE("Cipher is not compiled into mbedtls.");
+        return HCF_MBEDTLS_FAILURE;
+    }
+    if (info == impl->info) {
+        return HCF_MBEDTLS_SUCCESS;
+    }
+    mbedtls_cipher_free(&impl->ctx);
+    mbedtls_cipher_init(&impl->ctx);
+    impl->info = NULL;
+    int32_t ret = mbedtls_cipher_setup(&impl->ctx, info);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        return ret;
+    }
+    impl->info = info;
+    return HCF_MBEDTLS_SUCCESS;
+}
+
+static int32_t StartCipher(MbedtlsAesCipherSpiImpl *impl, enum HcfCryptoMode opMode, const HcfBlob *keyMaterial,
+    HcfParamsSpec *params)
+{
+    uint32_t keyBits = (uint32_t)keyMaterial->len * HCF_BITS_PER_BYTE;
+    int32_t ret = SetupCipherCtx(impl, keyBits);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        return ret;
+    }
+    ret = mbedtls_cipher_setkey(&impl->ctx, keyMaterial->data, (int)keyBits,
+        (opMode == ENCRYPT_MODE) ? MBEDTLS_ENCRYPT : MBEDTLS_DECRYPT);
+    if ((ret == HCF_MBEDTLS_SUCCESS) && (impl->attr.mode == HCF_ALG_MODE_CBC)) {
+        ret = mbedtls_cipher_set_padding_mode(&impl->ctx,
+            (impl->attr.paddingMode == HCF_ALG_NOPADDING) ? MBEDTLS_PADDING_NONE : MBEDTLS_PADDING_PKCS7);
+    }
+    // the iv is the first member of both iv and gcm params spec
+    const HcfBlob *iv = &((HcfIvParamsSpec *)params)->iv;
+    // with AEAD modes mbedtls wants the iv set after the reset
+    if (ret == HCF_MBEDTLS_SUCCESS) {
+        ret = mbedtls_cipher_reset(&impl->ctx);
+    }
+    if (ret == HCF_MBEDTLS_SUCCESS) {
+        ret = mbedtls_cipher_set_iv(&impl->ctx, iv->data, iv->len);
+    }
+    if ((ret != HCF_MBEDTLS_SUCCESS) || (impl->attr.mode != HCF_ALG_MODE_GCM)) {
+        return ret;
+    }
+    HcfGcmParamsSpec *gcmParams = (HcfGcmParamsSpec *)params;
+    if (gcmParams->aad.len != 0) {
+        ret = mbedtls_cipher_update_ad(&impl->ctx, gcmParams->aad.data, gcmParams->aad.len);
+    }
+    impl->tagLen = (uint32_t)gcmParams->tag.len;
+    if ((ret == HCF_MBEDTLS_SUCCESS) && (opMode == DECRYPT_MODE)) {
+        (void)memcpy_s(impl->tag, GCM_TAG_MAX_LEN, gcmParams->tag.data, gcmParams->tag.len);
+    }
+    return ret;
+}
+
+static HcfResult EngineCipherInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMode opMode,
+    HcfKey *key, HcfParamsSpec *params)
+{
+    if ((self == NULL) || (key == NULL)) {
+        LOGE("Invalid input parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsAesCipherSpiImpl *impl = GetMbedtlsAesCipherImpl(self);
+    if ((impl == NULL) || !HcfIsClassMatch((const HcfObjectBase *)key, MBEDTLS_SYM_KEY_CLASS)) {
+        return HCF_INVALID_PARAMS;
+    }
+    if ((opMode != ENCRYPT_MODE) && (opMode != DECRYPT_MODE)) {
+        LOGE("Invalid opMode %{public}d", opMode);
+        return HCF_INVALID_PARAMS;
+    }
+    const HcfBlob *keyMaterial = &((MbedtlsSymKeyImpl *)key)->keyMaterial;
+    if (!HcfIsBlobValid(keyMaterial) || !IsKeyLenValid(impl, keyMaterial)) {
+        LOGE("Invalid key length!");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfResult res = CheckParams(impl, params);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    impl->isInited = false;
+    int32_t ret = StartCipher(impl, opMode, keyMaterial, params);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Failed to init cipher, ret is %d!", ret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->opMode = opMode;
+    impl->isInited = true;
+    return HCF_SUCCESS;
+}
+
+static HcfResult AllocateOutput(uint32_t outLen, HcfBlob *output)
+{
+    output->data = (uint8_t *)HcfMalloc(outLen, 0);
+    if (output->data == NULL) {
+        LOGE("malloc output failed!");
+        return HCF_ERR_MALLOC;
+    }
+    output->len = outLen;
+    return HCF_SUCCESS;
+}
+
+// an empty result is returned as a null blob, as the openssl plugin does
+static void FreeRedundantOutput(HcfBlob *output)
+{
+    if ((output->len == 0) && (output->data != NULL)) {
+        HcfFree(output->data);
+        output->data = NULL;
+    }
+}
+
+static HcfResult EngineUpdate(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfBlob *output)
+{
+    if ((self == NULL) || (input == NULL) || (output == NULL)) {
+        LOGE("Invalid input parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsAesCipherSpiImpl *impl = GetMbedtlsAesCipherImpl(self);
+    if ((impl == NULL) || !impl->isInited) {
+        LOGE("The cipher is not initialized!");
+        return HCF_INVALID_PARAMS;
+    }
+    uint32_t inLen = HcfIsBlobValid(input) ? (uint32_t)input->len : 0;
+    HcfResult res = AllocateOutput(inLen + AES_BLOCK_SIZE, output);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    size_t outLen = 0;
+    int32_t ret = (inLen == 0) ? HCF_MBEDTLS_SUCCESS :
+        mbedtls_cipher_update(&impl->ctx, input->data, inLen, output->data, &outLen);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("cipher update failed, ret is %d!", ret);
+        HcfBlobDataClearAndFree(output);
+        impl->isInited = false;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    output->len = outLen;
+    FreeRedundantOutput(output);
+    return HCF_SUCCESS;
+}
+
+static int32_t FinishCipher(MbedtlsAesCipherSpiImpl *impl, HcfBlob *output, size_t *len)
+{
+    size_t finishLen = 0;
+    int32_t ret = mbedtls_cipher_finish(&impl->ctx, output->data + *len, &finishLen);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        return ret;
+    }
+    *len += finishLen;
+    if (impl->attr.mode != HCF_ALG_MODE_GCM) {
+        return HCF_MBEDTLS_SUCCESS;
+    }
+    if (impl->opMode == DECRYPT_MODE) {
+        return mbedtls_cipher_check_tag(&impl->ctx, impl->tag, impl->tagLen);
+    }
+    ret = mbedtls_cipher_write_tag(&impl->ctx, output->data + *len, impl->tagLen);
+    if (ret == HCF_MBEDTLS_SUCCESS) {
+        *len += impl->tagLen;
+    }
+    return ret;
+}
+
+static HcfResult EngineDoFinal(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfBlob *output)
+{
+    if ((self == NULL) || (output == NULL)) {
+        LOGE("Invalid input parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsAesCipherSpiImpl *impl = GetMbedtlsAesCipherImpl(self);
+    if ((impl == NULL) || !impl->isInited) {
+        LOGE("The cipher is not initialized!");
+        return HCF_INVALID_PARAMS;
+    }
+    // the cipher has to be initialized again after the final block, whatever the result
+    impl->isInited = false;
+    uint32_t inLen = HcfIsBlobValid(input) ? (uint32_t)input->len : 0;
+    uint32_t tagLen = ((impl->attr.mode == HCF_ALG_MODE_GCM) && (impl->opMode == ENCRYPT_MODE)) ? impl->tagLen : 0;
+    HcfResult res = AllocateOutput(inLen + AES_BLOCK_SIZE + tagLen, output);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    size_t len = 0;
+    int32_t ret = (inLen == 0) ? HCF_MBEDTLS_SUCCESS :
+        mbedtls_cipher_update(&impl->ctx, input->data, inLen, output->data, &len);
+    if (ret == HCF_MBEDTLS_SUCCESS) {
+        ret = FinishCipher(impl, output, &len);
+    }
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("cipher final failed, ret is %d!", ret);
+        HcfBlobDataClearAndFree(output);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    output->len = len;
+    FreeRedundantOutput(output);
+    return HCF_SUCCESS;
+}
+
+static HcfResult SetCipherSpecUint8Array(HcfCipherGeneratorSpi *self, CipherSpecItem item, HcfBlob pSource)
+{
+    (void)self;
+    (void)item;
+    (void)pSource;
+    LOGE("AES cipher has no uint8 array spec.");
+    return HCF_NOT_SUPPORT;
+}
+
+static HcfResult GetCipherSpecString(HcfCipherGeneratorSpi *self, CipherSpecItem item, char **returnString)
+{
+    (void)self;
+    (void)item;
+    (void)returnString;
+    LOGE("AES cipher has no string spec.");
+    return HCF_NOT_SUPPORT;
+}
+
+static HcfResult GetCipherSpecUint8Array(HcfCipherGeneratorSpi *self, CipherSpecItem item, HcfBlob *returnUint8Array)
+{
+    (void)self;
+    (void)item;
+    (void)returnUint8Array;
+    LOGE("AES cipher has no uint8 array spec.");
+    return HCF_NOT_SUPPORT;
+}
+
+static void EngineAesGeneratorDestroy(HcfObjectBase *self)
+{
+    if (self == NULL) {
+        return;
+    }
+    if (!HcfIsClassMatch(self, GetMbedtlsAesCipherClass())) {
+        LOGE("Class is not match.");
+        return;
+    }
+    MbedtlsAesCipherSpiImpl *impl = (MbedtlsAesCipherSpiImpl *)self;
+    mbedtls_cipher_free(&impl->ctx);
+    MbedtlsCtxPoolFree(impl, sizeof(MbedtlsAesCipherSpiImpl));
+}
+
+HcfResult MbedtlsAesCipherSpiCreate(CipherAttr *attr, HcfCipherGeneratorSpi **generator)
+{
+    if ((attr == NULL) || (generator == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((attr->algo != HCF_ALG_AES) || (GetMbedtlsCipherMode(attr->mode) == MBEDTLS_MODE_NONE)) {
+        LOGE("Unsupported AES mode %{public}d", attr->mode);
+        return HCF_NOT_SUPPORT;
+    }
+    MbedtlsAesCipherSpiImpl *returnImpl = (MbedtlsAesCipherSpiImpl *)MbedtlsCtxPoolAlloc(
+        sizeof(MbedtlsAesCipherSpiImpl));
+    if (returnImpl == NULL) {
+        LOGE("Failed to allocate returnImpl memory!");
+        return HCF_ERR_MALLOC;
+    }
+    returnImpl->attr = *attr;
+    mbedtls_cipher_init(&returnImpl->ctx);
+    returnImpl->base.init = EngineCipherInit;
+    returnImpl->base.update = EngineUpdate;
+    returnImpl->base.doFinal = EngineDoFinal;
+    returnImpl->base.setCipherSpecUint8Array = SetCipherSpecUint8Array;
+    returnImpl->base.getCipherSpecString = GetCipherSpecString;
+    returnImpl->base.getCipherSpecUint8Array = GetCipherSpecUint8Array;
+    returnImpl->base.base.destroy = EngineAesGeneratorDestroy;
+    returnImpl->base.base.getClass = GetMbedtlsAesCipherClass;
+    *generator = (HcfCipherGeneratorSpi *)returnImpl;
+    return HCF_SUCCESS;
+}
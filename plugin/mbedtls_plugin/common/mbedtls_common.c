@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbedtls_common.h"
+
+#include <string.h>
+#include "log.h"
+
+typedef struct {
+    const char *mdName;
+    HcfAlgParaValue digest;
+    mbedtls_md_type_t mdType;
+} MbedtlsMdTypeMap;
+
+static const MbedtlsMdTypeMap MD_TYPE_MAP[] = {
+    { "MD5", HCF_OPENSSL_DIGEST_MD5, MBEDTLS_MD_MD5 },
+    { "SHA1", HCF_OPENSSL_DIGEST_SHA1, MBEDTLS_MD_SHA1 },
+    { "SHA224", HCF_OPENSSL_DIGEST_SHA224, MBEDTLS_MD_SHA224 },
+    { "SHA256", HCF_OPENSSL_DIGEST_SHA256, MBEDTLS_MD_SHA256 },
+    { "SHA384", HCF_OPENSSL_DIGEST_SHA384, MBEDTLS_MD_SHA384 },
+    { "SHA512", HCF_OPENSSL_DIGEST_SHA512, MBEDTLS_MD_SHA512 },
+};
+
+HcfResult MbedtlsGetMdTypeByName(const char *mdName, mbedtls_md_type_t *mdType)
+{
+    if ((mdName == NULL) || (mdType == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    for (uint32_t i = 0; i < sizeof(MD_TYPE_MAP) / sizeof(MD_TYPE_MAP[0]); i++) {
+        if (strcmp(MD_TYPE_MAP[i].mdName, mdName) == 0) {
+            *mdType = MD_TYPE_MAP[i].mdType;
+            return HCF_SUCCESS;
+        }
+    }
+    LOGE("Unsupported md name: %{public}s", mdName);
+    return HCF_NOT_SUPPORT;
+}
+
+HcfResult MbedtlsGetMdTypeByDigest(HcfAlgParaValue digest, mbedtls_md_type_t *mdType)
+{
+    if (mdType == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    for (uint32_t i = 0; i < sizeof(MD_TYPE_MAP) / sizeof(MD_TYPE_MAP[0]); i++) {
+        if (MD_TYPE_MAP[i].digest == digest) {
+            *mdType = MD_TYPE_MAP[i].mdType;
+            return HCF_SUCCESS;
+        }
+    }
+    LOGE("Unsupported digest: %{public}d", digest);
+    return HCF_NOT_SUPPORT;
+}
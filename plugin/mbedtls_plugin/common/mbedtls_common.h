@@ -19,6 +19,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "mbedtls/md.h"
+#include "params_parser.h"
 #include "result.h"
 #include "utils.h"
 
@@ -27,4 +29,16 @@
 #define HCF_BITS_PER_BYTE 8
 #define HCF_EVP_MAX_MD_SIZE 64
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+HcfResult MbedtlsGetMdTypeByName(const char *mdName, mbedtls_md_type_t *mdType);
+
+HcfResult MbedtlsGetMdTypeByDigest(HcfAlgParaValue digest, mbedtls_md_type_t *mdType);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
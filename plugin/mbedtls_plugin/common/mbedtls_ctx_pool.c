@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbedtls_ctx_pool.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+
+typedef union {
+    uint8_t data[HCF_MBEDTLS_CTX_POOL_SLOT_SIZE];
+    uint64_t alignment;
+    void *ptrAlignment;
+} MbedtlsCtxPoolSlot;
+
+static MbedtlsCtxPoolSlot g_ctxPoolSlots[HCF_MBEDTLS_CTX_POOL_SLOT_NUM];
+static bool g_ctxPoolSlotUsed[HCF_MBEDTLS_CTX_POOL_SLOT_NUM];
+static HcfMbedtlsCtxPoolStat g_ctxPoolStat = {
+    .slotSize = HCF_MBEDTLS_CTX_POOL_SLOT_SIZE,
+    .slotNum = HCF_MBEDTLS_CTX_POOL_SLOT_NUM,
+};
+static pthread_mutex_t g_ctxPoolLock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool GetPoolSlotIndex(const void *ctx, uint32_t *index)
+{
+    uintptr_t addr = (uintptr_t)ctx;
+    uintptr_t begin = (uintptr_t)g_ctxPoolSlots;
+    if ((addr < begin) || (addr >= begin + sizeof(g_ctxPoolSlots))) {
+        return false;
+    }
+    *index = (uint32_t)((addr - begin) / sizeof(MbedtlsCtxPoolSlot));
+    return true;
+}
+
+static void *TakePoolSlot(void)
+{
+    for (uint32_t i = 0; i < HCF_MBEDTLS_CTX_POOL_SLOT_NUM; i++) {
+        if (!g_ctxPoolSlotUsed[i]) {
+            g_ctxPoolSlotUsed[i] = true;
+            g_ctxPoolStat.slotInUse++;
+            if (g_ctxPoolStat.slotInUse > g_ctxPoolStat.slotPeak) {
+                g_ctxPoolStat.slotPeak = g_ctxPoolStat.slotInUse;
+            }
+            return g_ctxPoolSlots[i].data;
+        }
+    }
+    return NULL;
+}
+
+void *MbedtlsCtxPoolAlloc(uint32_t size)
+{
+    if (size == 0) {
+        LOGE("Invalid ctx size.");
+        return NULL;
+    }
+    void *ctx = NULL;
+    (void)pthread_mutex_lock(&g_ctxPoolLock);
+    if (size > g_ctxPoolStat.maxRequestSize) {
+        g_ctxPoolStat.maxRequestSize = size;
+    }
+    if (size <= HCF_MBEDTLS_CTX_POOL_SLOT_SIZE) {
+        ctx = TakePoolSlot();
+    }
+    (void)pthread_mutex_unlock(&g_ctxPoolLock);
+    if (ctx != NULL) {
+        return ctx;
+    }
+    // free slots are wiped already, only the heap fallback needs zeroing
+    ctx = HcfMalloc(size, 0);
+    if (ctx == NULL) {
+        LOGE("Failed to allocate ctx memory!");
+        return NULL;
+    }
+    (void)pthread_mutex_lock(&g_ctxPoolLock);
+    g_ctxPoolStat.heapInUse++;
+    if (g_ctxPoolStat.heapInUse > g_ctxPoolStat.heapPeak) {
+        g_ctxPoolStat.heapPeak = g_ctxPoolStat.heapInUse;
+    }
+    (void)pthread_mutex_unlock(&g_ctxPoolLock);
+    return ctx;
+}
+
+void MbedtlsCtxPoolFree(void *ctx, uint32_t size)
+{
+    if (ctx == NULL) {
+        return;
+    }
+    uint32_t index = 0;
+    if (GetPoolSlotIndex(ctx, &index)) {
+        (void)memset_s(g_ctxPoolSlots[index].data, HCF_MBEDTLS_CTX_POOL_SLOT_SIZE, 0, HCF_MBEDTLS_CTX_POOL_SLOT_SIZE);
+        (void)pthread_mutex_lock(&g_ctxPoolLock);
+        g_ctxPoolSlotUsed[index] = false;
+        g_ctxPoolStat.slotInUse--;
+        (void)pthread_mutex_unlock(&g_ctxPoolLock);
+        return;
+    }
+    (void)memset_s(ctx, size, 0, size);
+    HcfFree(ctx);
+    (void)pthread_mutex_lock(&g_ctxPoolLock);
+    g_ctxPoolStat.heapInUse--;
+    (void)pthread_mutex_unlock(&g_ctxPoolLock);
+}
+
+void MbedtlsCtxPoolGetStat(HcfMbedtlsCtxPoolStat *stat)
+{
+    if (stat == NULL) {
+        LOGE("Invalid input parameter.");
+        return;
+    }
+    (void)pthread_mutex_lock(&g_ctxPoolLock);
+    *stat = g_ctxPoolStat;
+    (void)pthread_mutex_unlock(&g_ctxPoolLock);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_MBEDTLS_CTX_POOL_H
+#define HCF_MBEDTLS_CTX_POOL_H
+
+#include <stdint.h>
+
+/*
+ * Digest, MAC and cipher objects of the plugin are carved from one static arena of equal slots, so the RAM they take
+ * is bounded and reused instead of fragmenting the heap of a small device. A request larger than a slot, or made while
+ * every slot is taken, falls back to HcfMalloc. Products may tune both numbers, the footprint counters below tell how
+ * far a workload gets.
+ */
+#ifndef HCF_MBEDTLS_CTX_POOL_SLOT_NUM
+#define HCF_MBEDTLS_CTX_POOL_SLOT_NUM 8
+#endif
+
+#ifndef HCF_MBEDTLS_CTX_POOL_SLOT_SIZE
+#define HCF_MBEDTLS_CTX_POOL_SLOT_SIZE 320
+#endif
+
+typedef struct {
+    uint32_t slotSize;
+    uint32_t slotNum;
+    uint32_t slotInUse;
+    uint32_t slotPeak;
+    uint32_t heapInUse;
+    uint32_t heapPeak;
+    uint32_t maxRequestSize;
+} HcfMbedtlsCtxPoolStat;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void *MbedtlsCtxPoolAlloc(uint32_t size);
+
+/* The memory is wiped before it is reused, size is the one passed to MbedtlsCtxPoolAlloc. */
+void MbedtlsCtxPoolFree(void *ctx, uint32_t size);
+
+void MbedtlsCtxPoolGetStat(HcfMbedtlsCtxPoolStat *stat);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbedtls_kdf.h"
+
+#include <limits.h>
+#include "mbedtls_common.h"
+#include "mbedtls/hkdf.h"
+#include "mbedtls/md.h"
+#include "mbedtls/pkcs5.h"
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "utils.h"
+#include "detailed_hkdf_params.h"
+#include "detailed_pbkdf2_params.h"
+
+#define PBKDF2_ALG_NAME "PBKDF2"
+#define HKDF_ALG_NAME "HKDF"
+
+typedef struct {
+    HcfKdfSpi base;
+    mbedtls_md_type_t mdType;
+    HcfAlgParaValue mode;
+} MbedtlsKdfSpiImpl;
+
+static const char *GetMbedtlsPbkdf2Class(void)
+{
+    return "MbedtlsPbkdf2";
+}
+
+static const char *GetMbedtlsHkdfClass(void)
+{
+    return "MbedtlsHkdf";
+}
+
+static bool IsOptionalBlobValid(const HcfBlob *blob)
+{
+    return (blob->data != NULL) || (blob->len == 0);
+}
+
+static bool CheckPbkdf2Params(const HcfPBKDF2ParamsSpec *params)
+{
+    if (params->iterations < 1) {
+        LOGE("invalid kdf iter");
+        return false;
+    }
+    if ((params->output.data == NULL) || (params->output.len == 0) || (params->output.len > UINT32_MAX)) {
+        LOGE("invalid output");
+        return false;
+    }
+    if (!IsOptionalBlobValid(&params->salt) || !IsOptionalBlobValid(&params->password)) {
+        LOGE("Invalid salt or password params");
+        return false;
+    }
+    return true;
+}
+
+// mbedtls derives straight into the caller's output, there is no copy of password, salt or key on the heap
+static HcfResult EngineGeneratePbkdf2Secret(HcfKdfSpi *self, HcfKdfParamsSpec *paramsSpec)
+{
+    if ((self == NULL) || (paramsSpec == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetMbedtlsPbkdf2Class())) {
+        return HCF_INVALID_PARAMS;
+    }
+    if ((paramsSpec->algName == NULL) || (strcmp(paramsSpec->algName, PBKDF2_ALG_NAME) != 0)) {
+        LOGE("Not pbkdf2 paramsSpec");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfPBKDF2ParamsSpec *params = (HcfPBKDF2ParamsSpec *)paramsSpec;
+    if (!CheckPbkdf2Params(params)) {
+        LOGE("params error");
+        return HCF_INVALID_PARAMS;
+    }
+    int32_t ret = mbedtls_pkcs5_pbkdf2_hmac_ext(((MbedtlsKdfSpiImpl *)self)->mdType, params->password.data,
+        params->password.len, params->salt.data, params->salt.len, (unsigned int)params->iterations,
+        (uint32_t)params->output.len, params->output.data);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Pbkdf2 mbedtls failed, ret is %d!", ret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static bool CheckHkdfParams(const HcfHkdfParamsSpec *params)
+{
+    if ((params->key.data == NULL) || (params->key.len == 0)) {
+        LOGE("check params failed, key is NULL");
+        return false;
+    }
+    if ((params->output.data == NULL) || (params->output.len == 0)) {
+        LOGE("check params failed, output data is NULL");
+        return false;
+    }
+    if (!IsOptionalBlobValid(&params->salt) || !IsOptionalBlobValid(&params->info)) {
+        LOGE("Invalid salt or info params");
+        return false;
+    }
+    return true;
+}
+
+static int32_t MbedtlsHkdfExtractOnly(const mbedtls_md_info_t *md, const HcfHkdfParamsSpec *params)
+{
+    // the prk is exactly one digest long, as with the openssl plugin
+    if (params->output.len != mbedtls_md_get_size(md)) {
+        LOGE("Extract only output must be %{public}u bytes", mbedtls_md_get_size(md));
+        return HCF_MBEDTLS_FAILURE;
+    }
+    return mbedtls_hkdf_extract(md, params->salt.data, params->salt.len, params->key.data, params->key.len,
+        params->output.data);
+}
+
+static HcfResult EngineGenerateHkdfSecret(HcfKdfSpi *self, HcfKdfParamsSpec *paramsSpec)
+{
+    if ((self == NULL) || (paramsSpec == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetMbedtlsHkdfClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    if ((paramsSpec->algName == NULL) || (strcmp(paramsSpec->algName, HKDF_ALG_NAME) != 0)) {
+        LOGE("Not hkdf paramsSpec");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfHkdfParamsSpec *params = (HcfHkdfParamsSpec *)paramsSpec;
+    if (!CheckHkdfParams(params)) {
+        LOGE("params error");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsKdfSpiImpl *impl = (MbedtlsKdfSpiImpl *)self;
+    const mbedtls_md_info_t *md = mbedtls_md_info_from_type(impl->mdType);
+    int32_t ret;
+    switch (impl->mode) {
+        case HCF_ALG_MODE_EXTRACT_ONLY:
+            ret = MbedtlsHkdfExtractOnly(md, params);
+            break;
+        case HCF_ALG_MODE_EXPAND_ONLY:
+            ret = mbedtls_hkdf_expand(md, params->key.data, params->key.len, params->info.data, params->info.len,
+                params->output.data, params->output.len);
+            break;
+        default:
+            ret = mbedtls_hkdf(md, params->salt.data, params->salt.len, params->key.data, params->key.len,
+                params->info.data, params->info.len, params->output.data, params->output.len);
+            break;
+    }
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Hkdf mbedtls failed, ret is %d!", ret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static void EngineDestroyKdf(HcfObjectBase *self)
+{
+    if (self == NULL) {
+        LOGE("Self ptr is NULL!");
+        return;
+    }
+    if (!HcfIsClassMatch(self, GetMbedtlsPbkdf2Class()) && !HcfIsClassMatch(self, GetMbedtlsHkdfClass())) {
+        LOGE("Class is not match.");
+        return;
+    }
+    HcfFree(self);
+}
+
+static HcfResult MbedtlsKdfSpiCreate(HcfKdfDeriveParams *params, bool isHkdf, HcfKdfSpi **spiObj)
+{
+    if ((params == NULL) || (spiObj == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    mbedtls_md_type_t mdType = MBEDTLS_MD_NONE;
+    if ((MbedtlsGetMdTypeByDigest(params->md, &mdType) != HCF_SUCCESS) ||
+        (mbedtls_md_info_from_type(mdType) == NULL)) {
+        LOGE("get md failed");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsKdfSpiImpl *returnSpiImpl = (MbedtlsKdfSpiImpl *)HcfMalloc(sizeof(MbedtlsKdfSpiImpl), 0);
+    if (returnSpiImpl == NULL) {
+        LOGE("Failed to allocate returnImpl memory!");
+        return HCF_ERR_MALLOC;
+    }
+    returnSpiImpl->base.base.getClass = isHkdf ? GetMbedtlsHkdfClass : GetMbedtlsPbkdf2Class;
+    returnSpiImpl->base.base.destroy = EngineDestroyKdf;
+    returnSpiImpl->base.generateSecret = isHkdf ? EngineGenerateHkdfSecret : EngineGeneratePbkdf2Secret;
+    returnSpiImpl->mdType = mdType;
+    returnSpiImpl->mode = params->mode;
+    *spiObj = (HcfKdfSpi *)returnSpiImpl;
+    return HCF_SUCCESS;
+}
+
+HcfResult MbedtlsPbkdf2SpiCreate(HcfKdfDeriveParams *params, HcfKdfSpi **spiObj)
+{
+    return MbedtlsKdfSpiCreate(params, false, spiObj);
+}
+
+HcfResult MbedtlsHkdfSpiCreate(HcfKdfDeriveParams *params, HcfKdfSpi **spiObj)
+{
+    return MbedtlsKdfSpiCreate(params, true, spiObj);
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbedtls_sym_key.h"
+
+#include <limits.h>
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "result.h"
+#include "utils.h"
+#include "mbedtls_rand.h"
+
+#define MAX_KEY_STR_SIZE 12
+#define MAX_KEY_LEN 4096
+#define KEY_BIT 8
+#define AES_ALG_NAME "AES"
+#define HMAC_ALG_NAME "HMAC"
+
+typedef struct {
+    HcfSymKeyGeneratorSpi base;
+    SymKeyAttr attr;
+} MbedtlsSymKeyGeneratorSpiImpl;
+
+static const char *GetSymKeyGeneratorClass(void)
+{
+    return MBEDTLS_SYM_GENERATOR_CLASS;
+}
+
+static const char *GetSymKeyClass(void)
+{
+    return MBEDTLS_SYM_KEY_CLASS;
+}
+
+static HcfResult GetEncoded(HcfKey *self, HcfBlob *key)
+{
+    if ((self == NULL) || (key == NULL)) {
+        LOGE("Invalid input parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsSymKeyImpl *impl = (MbedtlsSymKeyImpl *)self;
+    if ((impl->keyMaterial.data == NULL) || (impl->keyMaterial.len == 0)) {
+        LOGE("Invalid SymKeyImpl parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    key->data = (uint8_t *)HcfMalloc(impl->keyMaterial.len, 0);
+    if (key->data == NULL) {
+        LOGE("malloc keyMaterial failed!");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(key->data, impl->keyMaterial.len, impl->keyMaterial.data, impl->keyMaterial.len);
+    key->len = impl->keyMaterial.len;
+    return HCF_SUCCESS;
+}
+
+static void ClearMem(HcfSymKey *self)
+{
+    if (self == NULL) {
+        LOGE("symKey is NULL.");
+        return;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return;
+    }
+    MbedtlsSymKeyImpl *impl = (MbedtlsSymKeyImpl *)self;
+    if ((impl->keyMaterial.data != NULL) && (impl->keyMaterial.len > 0)) {
+        (void)memset_s(impl->keyMaterial.data, impl->keyMaterial.len, 0, impl->keyMaterial.len);
+    }
+}
+
+static const char *GetFormat(HcfKey *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter!");
+        return NULL;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return NULL;
+    }
+
+    return "PKCS#8";
+}
+
+static const char *GetAlgorithm(HcfKey *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter!");
+        return NULL;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return NULL;
+    }
+    return (const char *)((MbedtlsSymKeyImpl *)self)->algoName;
+}
+
+static HcfResult GetSymKeySize(HcfKey *self, int *keySize)
+{
+    if (self == NULL || keySize == NULL) {
+        LOGE("Invalid input parameter!");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    MbedtlsSymKeyImpl *impl = (MbedtlsSymKeyImpl *)self;
+    if (impl->keyMaterial.len > (size_t)(INT_MAX / KEY_BIT)) {
+        LOGE("Key material length overflow.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    *keySize = (int)(impl->keyMaterial.len * KEY_BIT);
+    return HCF_SUCCESS;
+}
+
+static void DestroySymKeyGeneratorSpi(HcfObjectBase *base)
+{
+    if (base == NULL) {
+        LOGE("Invalid input parameter!");
+        return;
+    }
+    if (!HcfIsClassMatch(base, GetSymKeyGeneratorClass())) {
+        LOGE("Class is not match!");
+        return;
+    }
+    HcfFree(base);
+}
+
+static void DestroySymKeySpi(HcfObjectBase *base)
+{
+    if (base == NULL) {
+        LOGE("Invalid input parameter!");
+        return;
+    }
+    if (!HcfIsClassMatch(base, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return;
+    }
+    MbedtlsSymKeyImpl *impl = (MbedtlsSymKeyImpl *)base;
+    HcfFree(impl->algoName);
+    impl->algoName = NULL;
+    if (impl->keyMaterial.data != NULL) {
+        (void)memset_s(impl->keyMaterial.data, impl->keyMaterial.len, 0, impl->keyMaterial.len);
+        HcfFree(impl->keyMaterial.data);
+        impl->keyMaterial.data = NULL;
+        impl->keyMaterial.len = 0;
+    }
+    HcfFree(impl);
+}
+
+static char *GetAlgoName(HcfAlgValue algo, int keySize)
+{
+    const char *nameType = (algo == HCF_ALG_AES) ? AES_ALG_NAME : HMAC_ALG_NAME;
+    char *algoName = (char *)HcfMalloc(MAX_KEY_STR_SIZE, 0);
+    if (algoName == NULL) {
+        LOGE("algoName malloc failed!");
+        return NULL;
+    }
+    if (sprintf_s(algoName, MAX_KEY_STR_SIZE, "%s%d", nameType, keySize) < 0) {
+        LOGE("algoName sprintf_s failed!");
+        HcfFree(algoName);
+        return NULL;
+    }
+    return algoName;
+}
+
+// the rand objects are dropped right after use, they hold the entropy pool which is too large to keep per key
+static HcfResult RandomSymmKey(uint32_t keyLen, HcfBlob *symmKey)
+{
+    HcfRandSpi *rand = NULL;
+    HcfResult res = MbedtlsRandSpiCreate(&rand);
+    if (res != HCF_SUCCESS) {
+        LOGE("Failed to create rand spi.");
+        return res;
+    }
+    res = rand->engineGenerateRandom(rand, (int32_t)keyLen, symmKey);
+    HcfObjDestroy(rand);
+    if (res != HCF_SUCCESS) {
+        LOGE("Failed to generate key material.");
+    }
+    return res;
+}
+
+static HcfResult CopySymmKey(const HcfBlob *srcKey, HcfBlob *dstKey)
+{
+    uint8_t *keyMaterial = (uint8_t *)HcfMalloc(srcKey->len, 0);
+    if (keyMaterial == NULL) {
+        LOGE("keyMaterial malloc failed!");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(keyMaterial, srcKey->len, srcKey->data, srcKey->len);
+    dstKey->data = keyMaterial;
+    dstKey->len = srcKey->len;
+    return HCF_SUCCESS;
+}
+
+static HcfResult CreateSymKey(const SymKeyAttr *attr, const HcfBlob *key, HcfSymKey **symmKey)
+{
+    MbedtlsSymKeyImpl *returnSymmKey = (MbedtlsSymKeyImpl *)HcfMalloc(sizeof(MbedtlsSymKeyImpl), 0);
+    if (returnSymmKey == NULL) {
+        LOGE("Failed to allocate returnSymmKey memory!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult res = (key == NULL) ? RandomSymmKey((uint32_t)attr->keySize / KEY_BIT, &returnSymmKey->keyMaterial) :
+        CopySymmKey(key, &returnSymmKey->keyMaterial);
+    if (res != HCF_SUCCESS) {
+        HcfFree(returnSymmKey);
+        return res;
+    }
+    returnSymmKey->algoName = GetAlgoName(attr->algo, (int)(returnSymmKey->keyMaterial.len * KEY_BIT));
+    returnSymmKey->key.clearMem = ClearMem;
+    returnSymmKey->key.key.getEncoded = GetEncoded;
+    returnSymmKey->key.key.getFormat = GetFormat;
+    returnSymmKey->key.key.getAlgorithm = GetAlgorithm;
+    returnSymmKey->key.key.getKeySize = GetSymKeySize;
+    returnSymmKey->key.key.base.destroy = DestroySymKeySpi;
+    returnSymmKey->key.key.base.getClass = GetSymKeyClass;
+    *symmKey = (HcfSymKey *)returnSymmKey;
+    return HCF_SUCCESS;
+}
+
+static HcfResult GenerateSymmKey(HcfSymKeyGeneratorSpi *self, HcfSymKey **symmKey)
+{
+    if ((self == NULL) || (symmKey == NULL)) {
+        LOGE("Invalid input parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, GetSymKeyGeneratorClass())) {
+        LOGE("Class is not match!");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsSymKeyGeneratorSpiImpl *impl = (MbedtlsSymKeyGeneratorSpiImpl *)self;
+    if (impl->attr.keySize <= 0) {
+        LOGE("Key size is unknown, use convertSymKey.");
+        return HCF_INVALID_PARAMS;
+    }
+    return CreateSymKey(&impl->attr, NULL, symmKey);
+}
+
+static HcfResult ConvertSymmKey(HcfSymKeyGeneratorSpi *self, const HcfBlob *key, HcfSymKey **symmKey)
+{
+    if ((self == NULL) || (symmKey == NULL) || !HcfIsBlobValid(key)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, GetSymKeyGeneratorClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    MbedtlsSymKeyGeneratorSpiImpl *impl = (MbedtlsSymKeyGeneratorSpiImpl *)self;
+    // an HMAC generator without digest takes a key of any length
+    bool isLenValid = (impl->attr.algo == HCF_ALG_HMAC && impl->attr.keySize == 0) ?
+        (key->len <= MAX_KEY_LEN) : ((size_t)impl->attr.keySize / KEY_BIT == key->len);
+    if (!isLenValid) {
+        LOGE("Invalid param: input key length is invalid!");
+        return HCF_INVALID_PARAMS;
+    }
+    return CreateSymKey(&impl->attr, key, symmKey);
+}
+
+HcfResult MbedtlsSymKeyGeneratorSpiCreate(SymKeyAttr *attr, HcfSymKeyGeneratorSpi **generator)
+{
+    if ((attr == NULL) || (generator == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((attr->algo != HCF_ALG_AES) && (attr->algo != HCF_ALG_HMAC)) {
+        LOGE("Unsupported sym key algo: %{public}d", attr->algo);
+        return HCF_NOT_SUPPORT;
+    }
+    MbedtlsSymKeyGeneratorSpiImpl *returnGenerator = (MbedtlsSymKeyGeneratorSpiImpl *)HcfMalloc(
+        sizeof(MbedtlsSymKeyGeneratorSpiImpl), 0);
+    if (returnGenerator == NULL) {
+        LOGE("Failed to allocate returnGenerator memory!");
+        return HCF_ERR_MALLOC;
+    }
+    returnGenerator->attr = *attr;
+    returnGenerator->base.engineGenerateSymmKey = GenerateSymmKey;
+    returnGenerator->base.engineConvertSymmKey = ConvertSymmKey;
+    returnGenerator->base.base.destroy = DestroySymKeyGeneratorSpi;
+    returnGenerator->base.base.getClass = GetSymKeyGeneratorClass;
+    *generator = (HcfSymKeyGeneratorSpi *)returnGenerator;
+    return HCF_SUCCESS;
+}
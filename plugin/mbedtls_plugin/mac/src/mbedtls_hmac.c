@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mbedtls_hmac.h"
+
+#include "mbedtls_common.h"
+#include "mbedtls_ctx_pool.h"
+#include "mbedtls_sym_key.h"
+#include "mbedtls/md.h"
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "config.h"
+#include "utils.h"
+#include "detailed_hmac_params.h"
+
+typedef struct {
+    HcfMacSpi base;
+    mbedtls_md_context_t ctx;
+    bool isKeySet;
+} MbedtlsHmacSpiImpl;
+
+static const char *MbedtlsGetHmacClass(void)
+{
+    return "MbedtlsHmac";
+}
+
+static MbedtlsHmacSpiImpl *MbedtlsGetHmacImpl(HcfMacSpi *self)
+{
+    if (!HcfIsClassMatch((HcfObjectBase *)self, MbedtlsGetHmacClass())) {
+        LOGE("Class is not match.");
+        return NULL;
+    }
+    return (MbedtlsHmacSpiImpl *)self;
+}
+
+static HcfResult MbedtlsEngineInitHmac(HcfMacSpi *self, const HcfSymKey *key)
+{
+    MbedtlsHmacSpiImpl *impl = MbedtlsGetHmacImpl(self);
+    if (impl == NULL) {
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)key, MBEDTLS_SYM_KEY_CLASS)) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfBlob keyBlob = ((MbedtlsSymKeyImpl *)key)->keyMaterial;
+    if (!HcfIsBlobValid(&keyBlob)) {
+        LOGE("Invalid keyMaterial");
+        return HCF_INVALID_PARAMS;
+    }
+    int32_t ret = mbedtls_md_hmac_starts(&impl->ctx, keyBlob.data, keyBlob.len);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Failed to start hmac, ret is %d!", ret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->isKeySet = true;
+    return HCF_SUCCESS;
+}
+
+static HcfResult MbedtlsEngineUpdateHmac(HcfMacSpi *self, HcfBlob *input)
+{
+    MbedtlsHmacSpiImpl *impl = MbedtlsGetHmacImpl(self);
+    if ((impl == NULL) || !impl->isKeySet) {
+        LOGE("The hmac is not initialized!");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    int32_t ret = mbedtls_md_hmac_update(&impl->ctx, input->data, input->len);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Failed to update hmac, ret is %d!", ret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult MbedtlsEngineDoFinalHmac(HcfMacSpi *self, HcfBlob *output)
+{
+    MbedtlsHmacSpiImpl *impl = MbedtlsGetHmacImpl(self);
+    if ((impl == NULL) || !impl->isKeySet) {
+        LOGE("The hmac is not initialized!");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    unsigned char outputBuf[HCF_EVP_MAX_MD_SIZE] = { 0 };
+    uint32_t outputLen = mbedtls_md_get_size(mbedtls_md_info_from_ctx(&impl->ctx));
+    int32_t ret = mbedtls_md_hmac_finish(&impl->ctx, outputBuf);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Failed to finish hmac, ret is %d!", ret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    // rearmed with the same key, the next message needs no init
+    (void)mbedtls_md_hmac_reset(&impl->ctx);
+    output->data = (uint8_t *)HcfMalloc(outputLen, 0);
+    if (output->data == NULL) {
+        LOGE("Failed to allocate output->data memory!");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(output->data, outputLen, outputBuf, outputLen);
+    output->len = outputLen;
+    return HCF_SUCCESS;
+}
+
+static uint32_t MbedtlsEngineGetHmacLength(HcfMacSpi *self)
+{
+    MbedtlsHmacSpiImpl *impl = MbedtlsGetHmacImpl(self);
+    if (impl == NULL) {
+        return HCF_MBEDTLS_INVALID_MAC_LEN;
+    }
+    return mbedtls_md_get_size(mbedtls_md_info_from_ctx(&impl->ctx));
+}
+
+static void MbedtlsDestroyHmac(HcfObjectBase *self)
+{
+    if (self == NULL) {
+        LOGE("Self ptr is NULL");
+        return;
+    }
+    if (!HcfIsClassMatch(self, MbedtlsGetHmacClass())) {
+        LOGE("Class is not match.");
+        return;
+    }
+    mbedtls_md_free(&((MbedtlsHmacSpiImpl *)self)->ctx);
+    MbedtlsCtxPoolFree(self, sizeof(MbedtlsHmacSpiImpl));
+}
+
+HcfResult MbedtlsHmacSpiCreate(HcfMacParamsSpec *paramsSpec, HcfMacSpi **spiObj)
+{
+    if (paramsSpec == NULL || spiObj == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    mbedtls_md_type_t mdType = MBEDTLS_MD_NONE;
+    HcfResult res = MbedtlsGetMdTypeByName(((HcfHmacParamsSpec *)paramsSpec)->mdName, &mdType);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    MbedtlsHmacSpiImpl *returnSpiImpl = (MbedtlsHmacSpiImpl *)MbedtlsCtxPoolAlloc(sizeof(MbedtlsHmacSpiImpl));
+    if (returnSpiImpl == NULL) {
+        LOGE("Failed to allocate returnImpl memory!");
+        return HCF_ERR_MALLOC;
+    }
+    mbedtls_md_init(&returnSpiImpl->ctx);
+    // the pads are set up once here, init with a new key only reruns the key schedule
+    int32_t ret = mbedtls_md_setup(&returnSpiImpl->ctx, mbedtls_md_info_from_type(mdType), 1);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        LOGE("Failed to setup hmac, ret is %d!", ret);
+        mbedtls_md_free(&returnSpiImpl->ctx);
+        MbedtlsCtxPoolFree(returnSpiImpl, sizeof(MbedtlsHmacSpiImpl));
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    returnSpiImpl->base.base.getClass = MbedtlsGetHmacClass;
+    returnSpiImpl->base.base.destroy = MbedtlsDestroyHmac;
+    returnSpiImpl->base.engineInitMac = MbedtlsEngineInitHmac;
+    returnSpiImpl->base.engineUpdateMac = MbedtlsEngineUpdateHmac;
+    returnSpiImpl->base.engineDoFinalMac = MbedtlsEngineDoFinalHmac;
+    returnSpiImpl->base.engineGetMacLength = MbedtlsEngineGetHmacLength;
+    *spiObj = (HcfMacSpi *)returnSpiImpl;
+    return HCF_SUCCESS;
+}
@@ -16,6 +16,7 @@
 #include "mbedtls_md.h"
 
 #include "mbedtls_common.h"
+#include "mbedtls_ctx_pool.h"
 #include "mbedtls/md.h"
 #include "securec.h"
 #include "log.h"
@@ -25,20 +26,9 @@
 
 typedef struct {
     HcfMdSpi base;
-    mbedtls_md_context_t *ctx;
-    char mbedtlsAlgoName[HCF_MAX_ALGO_NAME_LEN];
+    mbedtls_md_context_t ctx;
 } MbedtlsMdSpiImpl;
 
-mbedtls_md_context_t *MbedtlsEvpMdCtxNew(void)
-{
-    return (mbedtls_md_context_t *)HcfMalloc(sizeof(mbedtls_md_context_t), 0);
-}
-
-void MbedtlsEvpMdCtxFree(mbedtls_md_context_t *ctx)
-{
-    HcfFree(ctx);
-}
-
 static const char *MbedtlsGetMdClass(void)
 {
     return "MbedtlsMd";
@@ -51,7 +41,7 @@ static mbedtls_md_context_t *MbedtlsGetMdCtx(HcfMdSpi *self)
         return NULL;
     }
 
-    return ((MbedtlsMdSpiImpl *)self)->ctx;
+    return &((MbedtlsMdSpiImpl *)self)->ctx;
 }
 
 static HcfResult MbedtlsEngineUpdateMd(HcfMdSpi *self, HcfBlob *input)
@@ -129,37 +119,29 @@ static void MbedtlsDestroyMd(HcfObjectBase *self)
         LOGE("Class is not match.");
         return;
     }
-    if (MbedtlsGetMdCtx((HcfMdSpi *)self) != NULL) {
-        mbedtls_md_free(MbedtlsGetMdCtx((HcfMdSpi *)self));
-        MbedtlsEvpMdCtxFree(MbedtlsGetMdCtx((HcfMdSpi *)self));
-    }
-    HcfFree(self);
+    mbedtls_md_free(MbedtlsGetMdCtx((HcfMdSpi *)self));
+    MbedtlsCtxPoolFree(self, sizeof(MbedtlsMdSpiImpl));
 }
 
-typedef struct {
-    char *mdAlg;
-    mbedtls_md_type_t mdType;
-} MdAlgTypeMap;
-
-static MdAlgTypeMap g_mdAlgMap[] = {
-    { "MD5",    MBEDTLS_MD_MD5    },
-    { "SHA1",   MBEDTLS_MD_SHA1   },
-    { "SHA256", MBEDTLS_MD_SHA256 },
-    { "SHA512", MBEDTLS_MD_SHA512 },
-};
-
-int MbedtlsEvpDigestInitEx(mbedtls_md_context_t *ctx, const char *mbedtlsAlgoName)
+static int32_t MbedtlsEvpDigestInitEx(mbedtls_md_context_t *ctx, const char *mbedtlsAlgoName)
 {
-    for (uint32_t index = 0; index < sizeof(g_mdAlgMap) / sizeof(g_mdAlgMap[0]); index++) {
-        if (strcmp(g_mdAlgMap[index].mdAlg, mbedtlsAlgoName) == 0) {
-            mbedtls_md_init(ctx);
-            mbedtls_md_setup(ctx, mbedtls_md_info_from_type(g_mdAlgMap[index].mdType), 0);
-            mbedtls_md_starts(ctx);
-            return HCF_MBEDTLS_SUCCESS;
-        }
+    mbedtls_md_type_t mdType = MBEDTLS_MD_NONE;
+    if (MbedtlsGetMdTypeByName(mbedtlsAlgoName, &mdType) != HCF_SUCCESS) {
+        return HCF_MBEDTLS_FAILURE;
+    }
+    mbedtls_md_init(ctx);
+    int32_t ret = mbedtls_md_setup(ctx, mbedtls_md_info_from_type(mdType), 0);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        mbedtls_md_free(ctx);
+        return ret;
+    }
+    ret = mbedtls_md_starts(ctx);
+    if (ret != HCF_MBEDTLS_SUCCESS) {
+        mbedtls_md_free(ctx);
+        return ret;
     }
 
-    return HCF_MBEDTLS_FAILURE;
+    return HCF_MBEDTLS_SUCCESS;
 }
 
 HcfResult MbedtlsMdSpiCreate(const char *mbedtlsAlgoName, HcfMdSpi **spiObj)
@@ -168,24 +150,15 @@ HcfResult MbedtlsMdSpiCreate(const char *mbedtlsAlgoName, HcfMdSpi **spiObj)
         LOGE("Invalid input parameter.");
         return HCF_INVALID_PARAMS;
     }
-    MbedtlsMdSpiImpl *returnSpiImpl = (MbedtlsMdSpiImpl *)HcfMalloc(sizeof(MbedtlsMdSpiImpl), 0);
+    MbedtlsMdSpiImpl *returnSpiImpl = (MbedtlsMdSpiImpl *)MbedtlsCtxPoolAlloc(sizeof(MbedtlsMdSpiImpl));
     if (returnSpiImpl == NULL) {
         LOGE("Failed to allocate returnImpl memory!");
         return HCF_ERR_MALLOC;
     }
-    returnSpiImpl->ctx = MbedtlsEvpMdCtxNew();
-    if (returnSpiImpl->ctx == NULL) {
-        LOGE("Failed to create ctx!");
-        HcfFree(returnSpiImpl);
-        returnSpiImpl = NULL;
-        return HCF_ERR_MALLOC;
-    }
-    int32_t ret = MbedtlsEvpDigestInitEx(returnSpiImpl->ctx, mbedtlsAlgoName);
+    int32_t ret = MbedtlsEvpDigestInitEx(&returnSpiImpl->ctx, mbedtlsAlgoName);
     if (ret != HCF_MBEDTLS_SUCCESS) {
         LOGE("Failed to init MD ret is %d!", ret);
-        MbedtlsEvpMdCtxFree(returnSpiImpl->ctx);
-        returnSpiImpl->ctx = NULL;
-        HcfFree(returnSpiImpl);
+        MbedtlsCtxPoolFree(returnSpiImpl, sizeof(MbedtlsMdSpiImpl));
         returnSpiImpl = NULL;
         return HCF_ERR_CRYPTO_OPERATION;
     }
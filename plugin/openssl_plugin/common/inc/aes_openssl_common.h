@@ -24,6 +24,16 @@
 #include "detailed_gcm_params.h"
 #include "detailed_aead_params.h"
 
+#define CIPHER_COUNTER_BLOCK_LEN 16
+
+typedef enum {
+    CIPHER_COUNTER_NONE = 0,
+    /* AES-CTR, 128-bit big-endian counter over 16-byte blocks */
+    CIPHER_COUNTER_BE128 = 1,
+    /* ChaCha20, 32-bit little-endian counter in the first word over 64-byte blocks */
+    CIPHER_COUNTER_LE32 = 2,
+} CipherCounterType;
+
 typedef struct {
     EVP_CIPHER_CTX *ctx;
     enum HcfCryptoMode enc;
@@ -38,6 +48,13 @@ typedef struct {
     uint32_t aadLen;
     unsigned char *tag;
     uint32_t tagLen;
+    /* CTR and ChaCha20 only, lets the parallel path seek the key stream */
+    CipherCounterType ctrType;
+    unsigned char ctrIv[CIPHER_COUNTER_BLOCK_LEN];
+    uint64_t ctrOffset;
+    /* GCM, CCM and Poly1305 with a generated nonce, which leads the first output of the operation */
+    bool isNoncePending;
+    unsigned char nonce[HCF_AEAD_NONCE_LEN];
 } CipherData;
 
 #ifdef __cplusplus
@@ -22,12 +22,53 @@
 #include "result.h"
 #include "utils.h"
 
+typedef struct {
+    const char *nidName;
+    int32_t pBits;
+    /* twice the security strength, OpenSSL refuses shorter private keys for the group */
+    int32_t minPrivLen;
+    /* domain parameters only, used as the template of every key generated in the group */
+    EVP_PKEY *paramsPkey;
+    /* p, q and g of paramsPkey, the BIGNUMs below are owned by dh */
+    DH *dh;
+    const BIGNUM *p;
+    const BIGNUM *q;
+    const BIGNUM *g;
+    BIGNUM *pMinusOne;
+    BN_MONT_CTX *mont;
+} HcfDhNamedGroup;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 EVP_PKEY *NewEvpPkeyByDh(DH *dh, bool withDuplicate);
 char *GetNidNameByDhId(int32_t pLen);
 char *GetNidNameByDhPLen(int32_t pLen);
+
+/**
+ * @brief Returns the prepared parameters of a modp or ffdhe group, NULL for any other name.
+ *
+ * Groups are built on first use and then shared read-only by every thread until the process exits.
+ */
+const HcfDhNamedGroup *GetDhNamedGroup(const char *nidName);
+
+/**
+ * @brief Returns the named group whose p and g are the given ones, NULL when the parameters are not a named group.
+ */
+const HcfDhNamedGroup *FindDhNamedGroupByParams(const BIGNUM *p, const BIGNUM *g);
+
+/**
+ * @brief Full validation of a public key of the group, 1 < pk < p - 1 and pk in the subgroup of order q.
+ *
+ * Every supported group has a safe prime p = 2q + 1, so subgroup membership is decided by the Legendre symbol
+ * instead of the pk^q mod p exponentiation OpenSSL performs.
+ */
+HcfResult CheckDhNamedGroupPubKey(const HcfDhNamedGroup *group, const BIGNUM *pk);
+
+/**
+ * @brief The checks EVP_PKEY_check does on a key pair of the group: public key, 0 < sk < q and g^sk mod p == pk.
+ */
+HcfResult CheckDhNamedGroupKeyPair(const HcfDhNamedGroup *group, const BIGNUM *pk, const BIGNUM *sk);
 #ifdef __cplusplus
 }
 #endif
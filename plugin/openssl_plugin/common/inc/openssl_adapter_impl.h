@@ -0,0 +1,2017 @@
+/*
+ * Copyright (C) 2023-2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_OPENSSL_ADAPTER_IMPL_H
+#define HCF_OPENSSL_ADAPTER_IMPL_H
+
+#include "openssl_adapter.h"
+#include <openssl/param_build.h>
+
+/*
+ * Definitions of the Openssl* wrappers. openssl_adapter.c compiles them out of line so that unit tests can
+ * replace the whole adapter with openssl_adapter_mock.c. With HCF_OPENSSL_ADAPTER_INLINE they are included
+ * by openssl_adapter.h as static inline functions instead, and the compiler folds them into the callers.
+ */
+
+HCF_OPENSSL_ADAPTER_FUNC BIGNUM *OpensslBnDup(const BIGNUM *a)
+{
+    return BN_dup(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslBnClear(BIGNUM *a)
+{
+    BN_clear(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslBnClearFree(BIGNUM *a)
+{
+    BN_clear_free(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC BIGNUM *OpensslBnNew(void)
+{
+    return BN_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslBnFree(BIGNUM *a)
+{
+    BN_free(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC BIGNUM *OpensslBin2Bn(const unsigned char *s, int len, BIGNUM *ret)
+{
+    return BN_bin2bn(s, len, ret);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC BIGNUM *OpensslLeBin2Bn(const unsigned char *s, int len, BIGNUM *ret)
+{
+    return BN_lebin2bn(s, len, ret);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBn2BinPad(const BIGNUM *a, unsigned char *to, int toLen)
+{
+    return BN_bn2binpad(a, to, toLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBn2LeBinPad(const BIGNUM *a, unsigned char *to, int toLen)
+{
+    return BN_bn2lebinpad(a, to, toLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnModExp(BIGNUM *r, const BIGNUM *a, const BIGNUM *b, const BIGNUM *p, BN_CTX *ctx)
+{
+    return BN_mod_exp(r, a, b, p, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC BN_CTX *OpensslBnCtxNew(void)
+{
+    return BN_CTX_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslBnCtxFree(BN_CTX *ctx)
+{
+    BN_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnNumBytes(const BIGNUM *a)
+{
+    return BN_num_bytes(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnSetWord(BIGNUM *a, unsigned int w)
+{
+    return BN_set_word(a, w);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC unsigned int OpensslBnGetWord(const BIGNUM *a)
+{
+    return BN_get_word(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnNumBits(const BIGNUM *a)
+{
+    return BN_num_bits(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslHex2Bn(BIGNUM **a, const char *str)
+{
+    return BN_hex2bn(a, str);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnCmp(const BIGNUM *a, const BIGNUM *b)
+{
+    return BN_cmp(a, b);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnSubWord(BIGNUM *a, BN_ULONG w)
+{
+    return BN_sub_word(a, w);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnKronecker(const BIGNUM *a, const BIGNUM *b, BN_CTX *ctx)
+{
+    return BN_kronecker(a, b, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC BN_MONT_CTX *OpensslBnMontCtxNew(void)
+{
+    return BN_MONT_CTX_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnMontCtxSet(BN_MONT_CTX *mont, const BIGNUM *mod, BN_CTX *ctx)
+{
+    return BN_MONT_CTX_set(mont, mod, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslBnMontCtxFree(BN_MONT_CTX *mont)
+{
+    BN_MONT_CTX_free(mont);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBnModExpMontConsttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p, const BIGNUM *m,
+    BN_CTX *ctx, BN_MONT_CTX *inMont)
+{
+    return BN_mod_exp_mont_consttime(rr, a, p, m, ctx, inMont);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslEcKeyNewByCurveName(int nid)
+{
+    return EC_KEY_new_by_curve_name(nid);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_POINT *OpensslEcPointDup(const EC_POINT *src, const EC_GROUP *group)
+{
+    return EC_POINT_dup(src, group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcKeyGenerateKey(EC_KEY *ecKey)
+{
+    return EC_KEY_generate_key(ecKey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcKeySetPublicKey(EC_KEY *key, const EC_POINT *pub)
+{
+    return EC_KEY_set_public_key(key, pub);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcKeySetPrivateKey(EC_KEY *key, const BIGNUM *privKey)
+{
+    return EC_KEY_set_private_key(key, privKey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcKeyCheckKey(const EC_KEY *key)
+{
+    return EC_KEY_check_key(key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EC_POINT *OpensslEcKeyGet0PublicKey(const EC_KEY *key)
+{
+    return EC_KEY_get0_public_key(key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslEcKeyGet0PrivateKey(const EC_KEY *key)
+{
+    return EC_KEY_get0_private_key(key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EC_GROUP *OpensslEcKeyGet0Group(const EC_KEY *key)
+{
+    return EC_KEY_get0_group(key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dEcPubKey(EC_KEY *a, unsigned char **pp)
+{
+    return i2d_EC_PUBKEY(a, pp);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dEcPrivateKey(EC_KEY *key, unsigned char **out)
+{
+    return i2d_ECPrivateKey(key, out);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslD2iEcPubKey(EC_KEY **a, const unsigned char **pp, long length)
+{
+    return d2i_EC_PUBKEY(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslD2iEcPrivateKey(EC_KEY **key, const unsigned char **in, long len)
+{
+    return d2i_ECPrivateKey(key, in, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcKeySetAsn1Flag(EC_KEY *key, int flag)
+{
+    EC_KEY_set_asn1_flag(key, flag);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcKeySetEncFlags(EC_KEY *ecKey, unsigned int flags)
+{
+    EC_KEY_set_enc_flags(ecKey, flags);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcKeyFree(EC_KEY *key)
+{
+    EC_KEY_free(key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcPointFree(EC_POINT *point)
+{
+    EC_POINT_free(point);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_GROUP *OpensslEcGroupNewCurveGfp(const BIGNUM *p, const BIGNUM *a, const BIGNUM *b,
+    BN_CTX *ctx)
+{
+    return EC_GROUP_new_curve_GFp(p, a, b, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcGroupFree(EC_GROUP *group)
+{
+    EC_GROUP_free(group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_POINT *OpensslEcPointNew(const EC_GROUP *group)
+{
+    return EC_POINT_new(group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcPointCopy(EC_POINT *dst, const EC_POINT *src)
+{
+    return EC_POINT_copy(dst, src);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcPointSetAffineCoordinatesGfp(const EC_GROUP *group, EC_POINT *point,
+    const BIGNUM *x, const BIGNUM *y, BN_CTX *ctx)
+{
+    return EC_POINT_set_affine_coordinates_GFp(group, point, x, y, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcGroupSetGenerator(EC_GROUP *group, const EC_POINT *generator, const BIGNUM *order,
+    const BIGNUM *cofactor)
+{
+    return EC_GROUP_set_generator(group, generator, order, cofactor);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslEcKeyNew(void)
+{
+    return EC_KEY_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslEcKeyDup(const EC_KEY *ecKey)
+{
+    return EC_KEY_dup(ecKey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcKeyUpRef(EC_KEY *ecKey)
+{
+    return EC_KEY_up_ref(ecKey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcKeySetGroup(EC_KEY *key, const EC_GROUP *group)
+{
+    return EC_KEY_set_group(key, group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcGroupGetCurveGfp(const EC_GROUP *group, BIGNUM *p, BIGNUM *a, BIGNUM *b,
+    BN_CTX *ctx)
+{
+    return EC_GROUP_get_curve_GFp(group, p, a, b, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EC_POINT *OpensslEcGroupGet0Generator(const EC_GROUP *group)
+{
+    return EC_GROUP_get0_generator(group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcPointGetAffineCoordinatesGfp(const EC_GROUP *group, const EC_POINT *point,
+    BIGNUM *x, BIGNUM *y, BN_CTX *ctx)
+{
+    return EC_POINT_get_affine_coordinates_GFp(group, point, x, y, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcGroupGetOrder(const EC_GROUP *group, BIGNUM *order, BN_CTX *ctx)
+{
+    return EC_GROUP_get_order(group, order, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcGroupGetCofactor(const EC_GROUP *group, BIGNUM *cofactor, BN_CTX *ctx)
+{
+    return EC_GROUP_get_cofactor(group, cofactor, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcGroupGetDegree(const EC_GROUP *group)
+{
+    return EC_GROUP_get_degree(group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_GROUP *OpensslEcGroupDup(const EC_GROUP *a)
+{
+    return EC_GROUP_dup(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcGroupSetCurveName(EC_GROUP *group, int nid)
+{
+    EC_GROUP_set_curve_name(group, nid);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcGroupGetCurveName(const EC_GROUP *group)
+{
+    return EC_GROUP_get_curve_name(group);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcPointMul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *gScalar,
+    const EC_POINT *point, const BIGNUM *pScalar, BN_CTX *ctx)
+{
+    return EC_POINT_mul(group, r, gScalar, point, pScalar, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_MD_CTX *OpensslEvpMdCtxNew(void)
+{
+    return EVP_MD_CTX_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpMdCtxFree(EVP_MD_CTX *ctx)
+{
+    EVP_MD_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpMdCtxReset(EVP_MD_CTX *ctx)
+{
+    return EVP_MD_CTX_reset(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpMdCtxCopyEx(EVP_MD_CTX *out, const EVP_MD_CTX *in)
+{
+    return EVP_MD_CTX_copy_ex(out, in);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpMdCtxSetFlags(EVP_MD_CTX *ctx, int flags)
+{
+    EVP_MD_CTX_set_flags(ctx, flags);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpMdCtxSetPkeyCtx(EVP_MD_CTX *ctx, EVP_PKEY_CTX *pctx)
+{
+    EVP_MD_CTX_set_pkey_ctx(ctx, pctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY_CTX *OpensslEvpMdCtxGetPkeyCtx(EVP_MD_CTX *ctx)
+{
+    return EVP_MD_CTX_get_pkey_ctx(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestSignInit(EVP_MD_CTX *ctx, EVP_PKEY_CTX **pctx, const EVP_MD *type,
+    ENGINE *e, EVP_PKEY *pkey)
+{
+    return EVP_DigestSignInit(ctx, pctx, type, e, pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestSignUpdate(EVP_MD_CTX *ctx, const void *data, size_t count)
+{
+    return EVP_DigestSignUpdate(ctx, data, count);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestSignFinal(EVP_MD_CTX *ctx, unsigned char *sigret, size_t *siglen)
+{
+    return EVP_DigestSignFinal(ctx, sigret, siglen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestSign(EVP_MD_CTX *ctx, unsigned char *sig, size_t *siglen,
+    const unsigned char *tbs, size_t tbslen)
+{
+    return EVP_DigestSign(ctx, sig, siglen, tbs, tbslen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestVerifyInit(EVP_MD_CTX *ctx, EVP_PKEY_CTX **pctx, const EVP_MD *type,
+    ENGINE *e, EVP_PKEY *pkey)
+{
+    return EVP_DigestVerifyInit(ctx, pctx, type, e, pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestVerifyUpdate(EVP_MD_CTX *ctx, const void *data, size_t count)
+{
+    return EVP_DigestVerifyUpdate(ctx, data, count);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestVerifyFinal(EVP_MD_CTX *ctx, const unsigned char *sig, size_t siglen)
+{
+    return EVP_DigestVerifyFinal(ctx, sig, siglen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestVerify(EVP_MD_CTX *ctx, unsigned char *sig, size_t siglen,
+    const unsigned char *tbs, size_t tbslen)
+{
+    return EVP_DigestVerify(ctx, sig, siglen, tbs, tbslen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeySignInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_sign_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeySign(EVP_PKEY_CTX *ctx, unsigned char *sig, size_t *siglen,
+    const unsigned char *tbs, size_t tbslen)
+{
+    return EVP_PKEY_sign(ctx, sig, siglen, tbs, tbslen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyVerifyInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_verify_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyVerify(EVP_PKEY_CTX *ctx, const unsigned char *sig, size_t siglen,
+    const unsigned char *tbs, size_t tbslen)
+{
+    return EVP_PKEY_verify(ctx, sig, siglen, tbs, tbslen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY_CTX *OpensslEvpPkeyCtxNewFromPkey(OSSL_LIB_CTX *libctx,
+    EVP_PKEY *pkey, const char *propquery)
+{
+    return EVP_PKEY_CTX_new_from_pkey(libctx, pkey, propquery);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslEvpPkeyNew(void)
+{
+    return EVP_PKEY_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslEvpPkeyNewRawPublicKey(int type, ENGINE *e, const unsigned char *pub,
+    size_t len)
+{
+    return EVP_PKEY_new_raw_public_key(type, e, pub, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslEvpPkeyNewRawPrivateKey(int type, ENGINE *e, const unsigned char *pub,
+    size_t len)
+{
+    return EVP_PKEY_new_raw_private_key(type, e, pub, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyGetRawPublicKey(const EVP_PKEY *pkey, unsigned char *pub, size_t *len)
+{
+    return EVP_PKEY_get_raw_public_key(pkey, pub, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyGetRawPrivateKey(const EVP_PKEY *pkey, unsigned char *priv, size_t *len)
+{
+    return EVP_PKEY_get_raw_private_key(pkey, priv, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyAssignEcKey(EVP_PKEY *pkey, EC_KEY *key)
+{
+    return EVP_PKEY_assign_EC_KEY(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeySet1EcKey(EVP_PKEY *pkey, EC_KEY *key)
+{
+    return EVP_PKEY_set1_EC_KEY(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpPkeyFree(EVP_PKEY *pkey)
+{
+    EVP_PKEY_free(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyUpRef(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_up_ref(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY_CTX *OpensslEvpPkeyCtxNew(EVP_PKEY *pkey, ENGINE *e)
+{
+    return EVP_PKEY_CTX_new(pkey, e);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyDeriveInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_derive_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyDeriveSetPeer(EVP_PKEY_CTX *ctx, EVP_PKEY *peer)
+{
+    return EVP_PKEY_derive_set_peer(ctx, peer);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyDeriveSetPeerEx(EVP_PKEY_CTX *ctx, EVP_PKEY *peer, int validatePeer)
+{
+    return EVP_PKEY_derive_set_peer_ex(ctx, peer, validatePeer);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyDerive(EVP_PKEY_CTX *ctx, unsigned char *key, size_t *keylen)
+{
+    return EVP_PKEY_derive(ctx, key, keylen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpPkeyCtxFree(EVP_PKEY_CTX *ctx)
+{
+    EVP_PKEY_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY_CTX *OpensslEvpPkeyCtxDup(const EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_CTX_dup(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslEvpPkeyCtxGet0Pkey(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_CTX_get0_pkey(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyEncrypt(EVP_PKEY_CTX *ctx, unsigned char *out, size_t *outlen,
+    const unsigned char *in, size_t inlen)
+{
+    return EVP_PKEY_encrypt(ctx, out, outlen, in, inlen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyDecrypt(EVP_PKEY_CTX *ctx, unsigned char *out, size_t *outlen,
+    const unsigned char *in, size_t inlen)
+{
+    return EVP_PKEY_decrypt(ctx, out, outlen, in, inlen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyEncryptInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_encrypt_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyDecryptInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_decrypt_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY_CTX *OpensslEvpPkeyCtxNewId(int id, ENGINE *e)
+{
+    return EVP_PKEY_CTX_new_id(id, e);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyBaseId(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_base_id(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyGetSize(const EVP_PKEY *pkey)
+{
+    return EVP_PKEY_get_size(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY_CTX *OpensslEvpPkeyCtxNewFromName(OSSL_LIB_CTX *libctx, const char *name,
+    const char *propquery)
+{
+    return EVP_PKEY_CTX_new_from_name(libctx, name, propquery);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyVerifyRecoverInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_verify_recover_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyVerifyRecover(EVP_PKEY_CTX *ctx, unsigned char *rout, size_t *routlen,
+    const unsigned char *sig, size_t siglen)
+{
+    return EVP_PKEY_verify_recover(ctx, rout, routlen, sig, siglen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM OpensslOsslParamConstructUtf8String(const char *key, char *buf, size_t bsize)
+{
+    return OSSL_PARAM_construct_utf8_string(key, buf, bsize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM OpensslOsslParamConstructOctetString(const char *key, void *buf, size_t bsize)
+{
+    return OSSL_PARAM_construct_octet_string(key, buf, bsize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM OpensslOsslParamConstructEnd(void)
+{
+    return OSSL_PARAM_construct_end();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyGenerate(EVP_PKEY_CTX *ctx, EVP_PKEY **ppkey)
+{
+    return EVP_PKEY_generate(ctx, ppkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM OpensslOsslParamConstructUint(const char *key, unsigned int *buf)
+{
+    return OSSL_PARAM_construct_uint(key, buf);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM OpensslOsslParamConstructUint64(const char *key, uint64_t *buf)
+{
+    return OSSL_PARAM_construct_uint64(key, buf);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM OpensslOsslParamConstructInt(const char *key, int *buf)
+{
+    return OSSL_PARAM_construct_int(key, buf);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSet1Id(EVP_PKEY_CTX *ctx, const void *id, int idLen)
+{
+    return EVP_PKEY_CTX_set1_id(ctx, id, idLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyParamGenInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_paramgen_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetDsaParamgenBits(EVP_PKEY_CTX *ctx, int nbits)
+{
+    return EVP_PKEY_CTX_set_dsa_paramgen_bits(ctx, nbits);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetParams(EVP_PKEY_CTX *ctx, const OSSL_PARAM *params)
+{
+    return EVP_PKEY_CTX_set_params(ctx, params);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyParamGen(EVP_PKEY_CTX *ctx, EVP_PKEY **ppkey)
+{
+    return EVP_PKEY_paramgen(ctx, ppkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyKeyGenInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_keygen_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyKeyGen(EVP_PKEY_CTX *ctx, EVP_PKEY **ppkey)
+{
+    return EVP_PKEY_keygen(ctx, ppkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeySet1Dsa(EVP_PKEY *pkey, DSA *key)
+{
+    return EVP_PKEY_set1_DSA(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC DSA *OpensslEvpPkeyGet1Dsa(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_get1_DSA(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC DSA *OpensslDsaNew(void)
+{
+    return DSA_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslDsaFree(DSA *dsa)
+{
+    DSA_free(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDsaUpRef(DSA *dsa)
+{
+    return DSA_up_ref(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDsaSet0Pqg(DSA *dsa, BIGNUM *p, BIGNUM *q, BIGNUM *g)
+{
+    return DSA_set0_pqg(dsa, p, q, g);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDsaSet0Key(DSA *dsa, BIGNUM *pubKey, BIGNUM *priKey)
+{
+    return DSA_set0_key(dsa, pubKey, priKey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDsaGet0P(const DSA *dsa)
+{
+    return DSA_get0_p(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDsaGet0Q(const DSA *dsa)
+{
+    return DSA_get0_q(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDsaGet0G(const DSA *dsa)
+{
+    return DSA_get0_g(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslDsaGet0Pqg(const DSA *dsa, const BIGNUM **p, const BIGNUM **q, const BIGNUM **g)
+{
+    return DSA_get0_pqg(dsa, p, q, g);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDsaGet0PubKey(const DSA *dsa)
+{
+    return DSA_get0_pub_key(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDsaGet0PrivKey(const DSA *dsa)
+{
+    return DSA_get0_priv_key(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDsaBits(const DSA *dsa)
+{
+    return DSA_bits(dsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDsaGenerateKey(DSA *a)
+{
+    return DSA_generate_key(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC DSA *OpensslD2iDsaPubKey(DSA **dsa, const unsigned char **ppin, long length)
+{
+    return d2i_DSA_PUBKEY(dsa, ppin, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC DSA *OpensslD2iDsaPrivateKey(DSA **dsa, const unsigned char **ppin, long length)
+{
+    return d2i_DSAPrivateKey(dsa, ppin, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dDsaPubkey(DSA *dsa, unsigned char **ppout)
+{
+    return i2d_DSA_PUBKEY(dsa, ppout);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dDsaPrivateKey(DSA *dsa, unsigned char **ppout)
+{
+    return i2d_DSAPrivateKey(dsa, ppout);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCheck(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_check(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslEvpPkeyDup(EVP_PKEY *a)
+{
+    return EVP_PKEY_dup(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslD2iPubKey(EVP_PKEY **a, const unsigned char **pp, long length)
+{
+    return d2i_PUBKEY(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslD2iPrivateKey(int type, EVP_PKEY **a, const unsigned char **pp, long length)
+{
+    return d2i_PrivateKey(type, a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dPubKey(EVP_PKEY *pkey, unsigned char **ppout)
+{
+    return i2d_PUBKEY(pkey, ppout);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dPrivateKey(EVP_PKEY *pkey, unsigned char **ppout)
+{
+    return i2d_PrivateKey(pkey, ppout);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC RSA *OpensslRsaNew(void)
+{
+    return RSA_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslRsaFree(RSA *rsa)
+{
+    RSA_free(rsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRsaUpRef(RSA *rsa)
+{
+    return RSA_up_ref(rsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRsaGenerateMultiPrimeKey(RSA *rsa, int bits, int primes,
+    BIGNUM *e, BN_GENCB *cb)
+{
+    return RSA_generate_multi_prime_key(rsa, bits, primes, e, cb);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRsaGenerateKeyEx(RSA *rsa, int bits, BIGNUM *e, BN_GENCB *cb)
+{
+    return RSA_generate_key_ex(rsa, bits, e, cb);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRsaBits(const RSA *rsa)
+{
+    return RSA_bits(rsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRsaSet0Key(RSA *r, BIGNUM *n, BIGNUM *e, BIGNUM *d)
+{
+    return RSA_set0_key(r, n, e, d);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslRsaGet0Key(const RSA *r, const BIGNUM **n, const BIGNUM **e, const BIGNUM **d)
+{
+    RSA_get0_key(r, n, e, d);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslRsaGet0N(const RSA *d)
+{
+    return RSA_get0_n(d);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslRsaGet0E(const RSA *d)
+{
+    return RSA_get0_e(d);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslRsaGet0D(const RSA *d)
+{
+    return RSA_get0_d(d);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslRsaGet0Factors(const RSA *r, const BIGNUM **p, const BIGNUM **q)
+{
+    RSA_get0_factors(r, p, q);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC RSA *OpensslRsaPublicKeyDup(RSA *rsa)
+{
+    return RSAPublicKey_dup(rsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC RSA *OpensslRsaPrivateKeyDup(RSA *rsa)
+{
+    return RSAPrivateKey_dup(rsa);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC RSA *OpensslD2iRsaPubKey(RSA **a, const unsigned char **pp, long length)
+{
+    return d2i_RSA_PUBKEY(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dRsaPubKey(RSA *a, unsigned char **pp)
+{
+    return i2d_RSA_PUBKEY(a, pp);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC RSA *OpensslD2iRsaPublicKey(RSA **a, const unsigned char **pp, long length)
+{
+    return d2i_RSAPublicKey(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dRsaPublicKey(RSA *a, unsigned char **pp)
+{
+    return i2d_RSAPublicKey(a, pp);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC RSA *OpensslD2iRsaPrivateKey(RSA **a, const unsigned char **pp, long length)
+{
+    return d2i_RSAPrivateKey(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dRsaPrivateKey(RSA *a, unsigned char **pp)
+{
+    return i2d_RSAPrivateKey(a, pp);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetRsaPssSaltLen(EVP_PKEY_CTX *ctx, int saltlen)
+{
+    return EVP_PKEY_CTX_set_rsa_pss_saltlen(ctx, saltlen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxGetRsaPssSaltLen(EVP_PKEY_CTX *ctx, int *saltlen)
+{
+    return EVP_PKEY_CTX_get_rsa_pss_saltlen(ctx, saltlen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetRsaPadding(EVP_PKEY_CTX *ctx, int pad)
+{
+    return EVP_PKEY_CTX_set_rsa_padding(ctx, pad);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetRsaMgf1Md(EVP_PKEY_CTX *ctx, const EVP_MD *md)
+{
+    return EVP_PKEY_CTX_set_rsa_mgf1_md(ctx, md);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetRsaOaepMd(EVP_PKEY_CTX *ctx, const EVP_MD *md)
+{
+    return EVP_PKEY_CTX_set_rsa_oaep_md(ctx, md);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSet0RsaOaepLabel(EVP_PKEY_CTX *ctx, void *label, int len)
+{
+    return EVP_PKEY_CTX_set0_rsa_oaep_label(ctx, label, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxGet0RsaOaepLabel(EVP_PKEY_CTX *ctx, unsigned char **label)
+{
+    return EVP_PKEY_CTX_get0_rsa_oaep_label(ctx, label);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslD2iAutoPrivateKey(EVP_PKEY **a, const unsigned char **pp, long length)
+{
+    return d2i_AutoPrivateKey(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC PKCS8_PRIV_KEY_INFO *OpensslD2iPkcs8PrivKeyInfo(PKCS8_PRIV_KEY_INFO **a,
+    const unsigned char **pp, long length)
+{
+    return d2i_PKCS8_PRIV_KEY_INFO(a, pp, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslPkcs8PrivKeyInfoFree(PKCS8_PRIV_KEY_INFO *p8inf)
+{
+    PKCS8_PRIV_KEY_INFO_free(p8inf);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslPkcs8PkeyGet0(const ASN1_OBJECT **ppkalg, const unsigned char **pk, int *ppklen,
+    const X509_ALGOR **pa, const PKCS8_PRIV_KEY_INFO *p8)
+{
+    return PKCS8_pkey_get0(ppkalg, pk, ppklen, pa, p8);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslObjObj2Nid(const ASN1_OBJECT *o)
+{
+    return OBJ_obj2nid(o);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC struct rsa_st *OpensslEvpPkeyGet1Rsa(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_get1_RSA(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeySet1Rsa(EVP_PKEY *pkey, struct rsa_st *key)
+{
+    return EVP_PKEY_set1_RSA(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyAssignRsa(EVP_PKEY *pkey, struct rsa_st *key)
+{
+    return EVP_PKEY_assign_RSA(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslPemWriteBioRsaPublicKey(BIO *bp, RSA *x)
+{
+    return PEM_write_bio_RSAPublicKey(bp, x);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslPemWriteBioRsaPubKey(BIO *bp, RSA *x)
+{
+    return PEM_write_bio_RSA_PUBKEY(bp, x);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_PKEY *OpensslPemReadBioPrivateKey(BIO *bp, EVP_PKEY **x, pem_password_cb *cb, void *u)
+{
+    return PEM_read_bio_PrivateKey(bp, x, cb, u);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC BIO *OpensslBioNew(const BIO_METHOD *type)
+{
+    return BIO_new(type);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIO_METHOD *OpensslBioSMem(void)
+{
+    return BIO_s_mem();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBioRead(BIO *b, void *data, int dlen)
+{
+    return BIO_read(b, data, dlen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslBioWrite(BIO *b, const void *data, int dlen)
+{
+    return BIO_write(b, data, dlen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslBioFreeAll(BIO *a)
+{
+    BIO_free_all(a);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRandPrivBytesEx(OSSL_LIB_CTX *libCtx, unsigned char *buf, size_t num)
+{
+    return RAND_priv_bytes_ex(libCtx, buf, num, 0);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslRandSetSeedSourceType(OSSL_LIB_CTX *libCtx, const char *name, const char *proPq)
+{
+    return RAND_set_seed_source_type(libCtx, name, proPq);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslRandSeed(const void *buf, int num)
+{
+    RAND_seed(buf, num);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha1(void)
+{
+    return EVP_sha1();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha3256(void)
+{
+    return EVP_sha3_256();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha3384(void)
+{
+    return EVP_sha3_384();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha3512(void)
+{
+    return EVP_sha3_512();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha224(void)
+{
+    return EVP_sha224();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha256(void)
+{
+    return EVP_sha256();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha384(void)
+{
+    return EVP_sha384();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSha512(void)
+{
+    return EVP_sha512();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpMd2(void)
+{
+    return EVP_md2();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpMd4(void)
+{
+    return EVP_md4();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpRipemd160(void)
+{
+    return EVP_ripemd160();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpMd5(void)
+{
+    return EVP_md5();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_MD *OpensslEvpSm3(void)
+{
+    return EVP_sm3();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestFinalEx(EVP_MD_CTX *ctx, unsigned char *md, unsigned int *size)
+{
+    return EVP_DigestFinal_ex(ctx, md, size);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigest(const void *data, size_t count, unsigned char *md, unsigned int *size,
+    const EVP_MD *type)
+{
+    return EVP_Digest(data, count, md, size, type, NULL);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpMdCtxSize(const EVP_MD_CTX *ctx)
+{
+    return EVP_MD_CTX_size(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpDigestInitEx(EVP_MD_CTX *ctx, const EVP_MD *type, ENGINE *impl)
+{
+    return EVP_DigestInit_ex(ctx, type, impl);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslHmacInitEx(HMAC_CTX *ctx, const void *key, int len, const EVP_MD *md, ENGINE *impl)
+{
+    return HMAC_Init_ex(ctx, key, len, md, impl);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslHmacFinal(HMAC_CTX *ctx, unsigned char *md, unsigned int *len)
+{
+    return HMAC_Final(ctx, md, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC size_t OpensslHmacSize(const HMAC_CTX *ctx)
+{
+    return HMAC_size(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslHmacCtxFree(HMAC_CTX *ctx)
+{
+    HMAC_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC HMAC_CTX *OpensslHmacCtxNew(void)
+{
+    return HMAC_CTX_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslHmacUpdate(HMAC_CTX *ctx, const unsigned char *data, size_t len)
+{
+    return HMAC_Update(ctx, data, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslHmacCtxCopy(HMAC_CTX *dctx, HMAC_CTX *sctx)
+{
+    return HMAC_CTX_copy(dctx, sctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCmacInit(EVP_MAC_CTX *ctx, const unsigned char *key, size_t keylen,
+    const OSSL_PARAM params[])
+{
+    return EVP_MAC_init(ctx, key, keylen, params);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCmacUpdate(EVP_MAC_CTX *ctx, const unsigned char *data, size_t datalen)
+{
+    return EVP_MAC_update(ctx, data, datalen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCmacFinal(EVP_MAC_CTX *ctx, unsigned char *out, size_t *outl, size_t outsize)
+{
+    return EVP_MAC_final(ctx, out, outl, outsize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC size_t OpensslCmacSize(EVP_MAC_CTX *ctx)
+{
+    return EVP_MAC_CTX_get_mac_size(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslCmacCtxFree(EVP_MAC_CTX *ctx)
+{
+    EVP_MAC_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslMacFree(EVP_MAC *mac)
+{
+    EVP_MAC_free(mac);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_MAC_CTX *OpensslCmacCtxNew(EVP_MAC *mac)
+{
+    return EVP_MAC_CTX_new(mac);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpCipherCtxFree(EVP_CIPHER_CTX *ctx)
+{
+    EVP_CIPHER_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Ecb(void)
+{
+    return EVP_aes_128_ecb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Ecb(void)
+{
+    return EVP_aes_192_ecb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Ecb(void)
+{
+    return EVP_aes_256_ecb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Cbc(void)
+{
+    return EVP_aes_128_cbc();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Cbc(void)
+{
+    return EVP_aes_192_cbc();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Cbc(void)
+{
+    return EVP_aes_256_cbc();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Ctr(void)
+{
+    return EVP_aes_128_ctr();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Ctr(void)
+{
+    return EVP_aes_192_ctr();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Ctr(void)
+{
+    return EVP_aes_256_ctr();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Ofb(void)
+{
+    return EVP_aes_128_ofb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Ofb(void)
+{
+    return EVP_aes_192_ofb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Ofb(void)
+{
+    return EVP_aes_256_ofb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Cfb(void)
+{
+    return EVP_aes_128_cfb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Cfb(void)
+{
+    return EVP_aes_192_cfb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Cfb(void)
+{
+    return EVP_aes_256_cfb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Cfb1(void)
+{
+    return EVP_aes_128_cfb1();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Cfb1(void)
+{
+    return EVP_aes_192_cfb1();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Cfb1(void)
+{
+    return EVP_aes_256_cfb1();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Cfb128(void)
+{
+    return EVP_aes_128_cfb128();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Cfb128(void)
+{
+    return EVP_aes_192_cfb128();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Cfb128(void)
+{
+    return EVP_aes_256_cfb128();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Cfb8(void)
+{
+    return EVP_aes_128_cfb8();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Cfb8(void)
+{
+    return EVP_aes_192_cfb8();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Cfb8(void)
+{
+    return EVP_aes_256_cfb8();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Ccm(void)
+{
+    return EVP_aes_128_ccm();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Ccm(void)
+{
+    return EVP_aes_192_ccm();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Ccm(void)
+{
+    return EVP_aes_256_ccm();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Gcm(void)
+{
+    return EVP_aes_128_gcm();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Gcm(void)
+{
+    return EVP_aes_192_gcm();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Gcm(void)
+{
+    return EVP_aes_256_gcm();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Wrap(void)
+{
+    return EVP_aes_128_wrap();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes192Wrap(void)
+{
+    return EVP_aes_192_wrap();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Wrap(void)
+{
+    return EVP_aes_256_wrap();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes128Xts(void)
+{
+    return EVP_aes_128_xts();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpAes256Xts(void)
+{
+    return EVP_aes_256_xts();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpSm4Ecb(void)
+{
+    return EVP_sm4_ecb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpSm4Cbc(void)
+{
+    return EVP_sm4_cbc();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpSm4Cfb(void)
+{
+    return EVP_sm4_cfb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpSm4Cfb128(void)
+{
+    return EVP_sm4_cfb128();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpSm4Ctr(void)
+{
+    return EVP_sm4_ctr();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpSm4Ofb(void)
+{
+    return EVP_sm4_ofb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_CIPHER *OpensslEvpCipherFetch(OSSL_LIB_CTX *ctx, const char *algorithm,
+    const char *properties)
+{
+    return EVP_CIPHER_fetch(ctx, algorithm, properties);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpCipherFree(EVP_CIPHER *cipher)
+{
+    EVP_CIPHER_free(cipher);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_CIPHER *OpensslEvpCipherMethNew(int cipherType, int blockSize, int keyLen)
+{
+    return EVP_CIPHER_meth_new(cipherType, blockSize, keyLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpCipherMethFree(EVP_CIPHER *cipher)
+{
+    EVP_CIPHER_meth_free(cipher);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetIvLength(EVP_CIPHER *cipher, int ivLen)
+{
+    return EVP_CIPHER_meth_set_iv_length(cipher, ivLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetFlags(EVP_CIPHER *cipher, unsigned long flags)
+{
+    return EVP_CIPHER_meth_set_flags(cipher, flags);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetImplCtxSize(EVP_CIPHER *cipher, int size)
+{
+    return EVP_CIPHER_meth_set_impl_ctx_size(cipher, size);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetInit(EVP_CIPHER *cipher,
+    int (*init)(EVP_CIPHER_CTX *ctx, const unsigned char *key, const unsigned char *iv, int enc))
+{
+    return EVP_CIPHER_meth_set_init(cipher, init);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetDoCipher(EVP_CIPHER *cipher,
+    int (*doCipher)(EVP_CIPHER_CTX *ctx, unsigned char *out, const unsigned char *in, size_t inl))
+{
+    return EVP_CIPHER_meth_set_do_cipher(cipher, doCipher);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetCtrl(EVP_CIPHER *cipher, int (*ctrl)(EVP_CIPHER_CTX *ctx, int type,
+    int arg, void *ptr))
+{
+    return EVP_CIPHER_meth_set_ctrl(cipher, ctrl);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherMethSetCleanup(EVP_CIPHER *cipher, int (*cleanup)(EVP_CIPHER_CTX *ctx))
+{
+    return EVP_CIPHER_meth_set_cleanup(cipher, cleanup);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void *OpensslEvpCipherCtxGetCipherData(const EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_get_cipher_data(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC unsigned char *OpensslEvpCipherCtxIvNoconst(EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_iv_noconst(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC unsigned char *OpensslEvpCipherCtxBufNoconst(EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_buf_noconst(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherCtxGetNum(const EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_get_num(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherCtxSetNum(EVP_CIPHER_CTX *ctx, int num)
+{
+    return EVP_CIPHER_CTX_set_num(ctx, num);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslCryptoCtr128EncryptCtr32(const unsigned char *in, unsigned char *out, size_t len,
+    const void *key, unsigned char ivec[16], unsigned char ecountBuf[16], unsigned int *num, ctr128_f func)
+{
+    CRYPTO_ctr128_encrypt_ctr32(in, out, len, key, ivec, ecountBuf, num, func);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC GCM128_CONTEXT *OpensslCryptoGcm128New(void *key, block128_f block)
+{
+    return CRYPTO_gcm128_new(key, block);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslCryptoGcm128Release(GCM128_CONTEXT *ctx)
+{
+    CRYPTO_gcm128_release(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslCryptoGcm128Setiv(GCM128_CONTEXT *ctx, const unsigned char *iv, size_t len)
+{
+    CRYPTO_gcm128_setiv(ctx, iv, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCryptoGcm128Aad(GCM128_CONTEXT *ctx, const unsigned char *aad, size_t len)
+{
+    return CRYPTO_gcm128_aad(ctx, aad, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCryptoGcm128EncryptCtr32(GCM128_CONTEXT *ctx, const unsigned char *in,
+    unsigned char *out, size_t len, ctr128_f stream)
+{
+    return CRYPTO_gcm128_encrypt_ctr32(ctx, in, out, len, stream);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCryptoGcm128DecryptCtr32(GCM128_CONTEXT *ctx, const unsigned char *in,
+    unsigned char *out, size_t len, ctr128_f stream)
+{
+    return CRYPTO_gcm128_decrypt_ctr32(ctx, in, out, len, stream);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslCryptoGcm128Finish(GCM128_CONTEXT *ctx, const unsigned char *tag, size_t len)
+{
+    return CRYPTO_gcm128_finish(ctx, tag, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslCryptoGcm128Tag(GCM128_CONTEXT *ctx, unsigned char *tag, size_t len)
+{
+    CRYPTO_gcm128_tag(ctx, tag, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_CIPHER_CTX *OpensslEvpCipherCtxNew(void)
+{
+    return EVP_CIPHER_CTX_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherCtxCopy(EVP_CIPHER_CTX *out, const EVP_CIPHER_CTX *in)
+{
+    return EVP_CIPHER_CTX_copy(out, in);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherInit(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
+    const unsigned char *key, const unsigned char *iv, int enc)
+{
+    return EVP_CipherInit(ctx, cipher, key, iv, enc);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherCtxSetPadding(EVP_CIPHER_CTX *ctx, int pad)
+{
+    return EVP_CIPHER_CTX_set_padding(ctx, pad);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherCtxSetKeyLength(EVP_CIPHER_CTX *ctx, int keylen)
+{
+    return EVP_CIPHER_CTX_set_key_length(ctx, keylen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherFinalEx(EVP_CIPHER_CTX *ctx, unsigned char *out, int *outl)
+{
+    return EVP_CipherFinal_ex(ctx, out, outl);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherUpdate(EVP_CIPHER_CTX *ctx, unsigned char *out, int *outl,
+    const unsigned char *in, int inl)
+{
+    return EVP_CipherUpdate(ctx, out, outl, in, inl);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEde3Ecb(void)
+{
+    return EVP_des_ede3_ecb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEde3Cbc(void)
+{
+    return EVP_des_ede3_cbc();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEde3Ofb(void)
+{
+    return EVP_des_ede3_ofb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEde3Cfb64(void)
+{
+    return EVP_des_ede3_cfb64();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEde3Cfb1(void)
+{
+    return EVP_des_ede3_cfb1();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEde3Cfb8(void)
+{
+    return EVP_des_ede3_cfb8();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesEcb(void)
+{
+    return EVP_des_ecb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesCbc(void)
+{
+    return EVP_des_cbc();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesOfb(void)
+{
+    return EVP_des_ofb();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesCfb64(void)
+{
+    return EVP_des_cfb64();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesCfb1(void)
+{
+    return EVP_des_cfb1();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpDesCfb8(void)
+{
+    return EVP_des_cfb8();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpChaCha20(void)
+{
+    return EVP_chacha20();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const EVP_CIPHER *OpensslEvpChaCha20Poly1305(void)
+{
+    return EVP_chacha20_poly1305();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslSm2CipherTextSize(const EC_KEY *key, const EVP_MD *digest, size_t msgLen,
+    size_t *cipherTextSize)
+{
+    return ossl_sm2_ciphertext_size(key, digest, msgLen, cipherTextSize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslSm2PlainTextSize(const unsigned char *cipherText, size_t cipherTextSize,
+    size_t *plainTextSize)
+{
+    return ossl_sm2_plaintext_size(cipherText, cipherTextSize, plainTextSize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslSm2Encrypt(const EC_KEY *key, const EVP_MD *digest, const uint8_t *msg,
+    size_t msgLen, uint8_t *cipherTextBuf, size_t *cipherTextLen)
+{
+    return ossl_sm2_encrypt(key, digest, msg, msgLen, cipherTextBuf, cipherTextLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslSm2Decrypt(const EC_KEY *key, const EVP_MD *digest, const uint8_t *cipherText,
+    size_t cipherTextLen, uint8_t *plainTextBuf, size_t *plainTextLen)
+{
+    return ossl_sm2_decrypt(key, digest, cipherText, cipherTextLen, plainTextBuf, plainTextLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslPkcs5Pbkdf2Hmac(const char *pass, int passlen, const unsigned char *salt,
+    int saltlen, int iter, const EVP_MD *digest, int keylen, unsigned char *out)
+{
+    return PKCS5_PBKDF2_HMAC(pass, passlen, salt, saltlen, iter, digest, keylen, out);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_GROUP *OpensslEcGroupNewByCurveName(int nid)
+{
+    return EC_GROUP_new_by_curve_name(nid);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpEncryptInit(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
+    const unsigned char *key, const unsigned char *iv)
+{
+    return EVP_EncryptInit(ctx, cipher, key, iv);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpCipherCtxCtrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+    return EVP_CIPHER_CTX_ctrl(ctx, type, arg, ptr);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC DH *OpensslDhNew(void)
+{
+    return DH_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhComputeKeyPadded(unsigned char *key, const BIGNUM *pubKey, DH *dh)
+{
+    return DH_compute_key_padded(key, pubKey, dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslDhFree(DH *dh)
+{
+    DH_free(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhGenerateKey(DH *dh)
+{
+    return DH_generate_key(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDhGet0P(const DH *dh)
+{
+    return DH_get0_p(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDhGet0Q(const DH *dh)
+{
+    return DH_get0_q(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDhGet0G(const DH *dh)
+{
+    return DH_get0_g(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslDhGet0Pqg(const DH *dh, const BIGNUM **p, const BIGNUM **q, const BIGNUM **g)
+{
+    return DH_get0_pqg(dh, p, q, g);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC long OpensslDhGetLength(const DH *dh)
+{
+    return DH_get_length(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhSetLength(DH *dh, long length)
+{
+    return DH_set_length(dh, length);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhBits(const DH *dh)
+{
+    return DH_bits(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDhGet0PubKey(const DH *dh)
+{
+    return DH_get0_pub_key(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslDhGet0PrivKey(const DH *dh)
+{
+    return DH_get0_priv_key(dh);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeySet1Dh(EVP_PKEY *pkey, DH *key)
+{
+    return EVP_PKEY_set1_DH(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC DH *OpensslEvpPkeyGet1Dh(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_get1_DH(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyIsA(const EVP_PKEY *pkey, const char *name)
+{
+    return EVP_PKEY_is_a(pkey, name);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyAssignDh(EVP_PKEY *pkey, DH *key)
+{
+    return EVP_PKEY_assign_DH(pkey, key);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetDhParamgenPrimeLen(EVP_PKEY_CTX *ctx, int pbits)
+{
+    return EVP_PKEY_CTX_set_dh_paramgen_prime_len(ctx, pbits);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetSignatureMd(EVP_PKEY_CTX *ctx, const EVP_MD *md)
+{
+    return EVP_PKEY_CTX_set_signature_md(ctx, md);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhUpRef(DH *r)
+{
+    return DH_up_ref(r);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhSet0Pqg(DH *dh, BIGNUM *p, BIGNUM *q, BIGNUM *g)
+{
+    return DH_set0_pqg(dh, p, q, g);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslDhSet0Key(DH *dh, BIGNUM *pubKey, BIGNUM *privKey)
+{
+    return DH_set0_key(dh, pubKey, privKey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC struct Sm2CipherTextSt *OpensslD2iSm2CipherText(const uint8_t *ciphertext,
+    size_t ciphertextLen)
+{
+    return d2i_Sm2CipherText(NULL, &ciphertext, ciphertextLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslSm2CipherTextFree(struct Sm2CipherTextSt *sm2Text)
+{
+    Sm2CipherText_free(sm2Text);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslAsn1OctetStringFree(ASN1_OCTET_STRING *field)
+{
+    ASN1_OCTET_STRING_free(field);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC ASN1_OCTET_STRING *OpensslAsn1OctetStringNew(void)
+{
+    return ASN1_OCTET_STRING_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslAsn1OctetStringSet(ASN1_OCTET_STRING *x, const unsigned char *d, int len)
+{
+    return ASN1_STRING_set(x, d, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC struct Sm2CipherTextSt *OpensslSm2CipherTextNew(void)
+{
+    return Sm2CipherText_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dSm2CipherText(struct Sm2CipherTextSt *sm2Text, unsigned char **returnData)
+{
+    return i2d_Sm2CipherText(sm2Text, returnData);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslAsn1StringLength(ASN1_OCTET_STRING *p)
+{
+    return ASN1_STRING_length(p);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const unsigned char *OpensslAsn1StringGet0Data(ASN1_OCTET_STRING *p)
+{
+    return ASN1_STRING_get0_data(p);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC ECDSA_SIG *OpensslEcdsaSigNew()
+{
+    return ECDSA_SIG_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC ECDSA_SIG *OpensslD2iSm2EcdsaSig(const unsigned char **inputData, int dataLen)
+{
+    return d2i_ECDSA_SIG(NULL, inputData, dataLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslI2dSm2EcdsaSig(ECDSA_SIG *sm2Text, unsigned char **returnData)
+{
+    return i2d_ECDSA_SIG(sm2Text, returnData);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslSm2EcdsaSigFree(ECDSA_SIG *sm2Text)
+{
+    return ECDSA_SIG_free(sm2Text);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslEcdsaSigGet0r(const ECDSA_SIG *sig)
+{
+    return ECDSA_SIG_get0_r(sig);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC const BIGNUM *OpensslEcdsaSigGet0s(const ECDSA_SIG *sig)
+{
+    return ECDSA_SIG_get0_s(sig);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcdsaSigSet0(ECDSA_SIG *sig, BIGNUM *r, BIGNUM *s)
+{
+    return ECDSA_SIG_set0(sig, r, s);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM_BLD *OpensslOsslParamBldNew(void)
+{
+    return OSSL_PARAM_BLD_new();
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslOsslParamBldFree(OSSL_PARAM_BLD *bld)
+{
+    OSSL_PARAM_BLD_free(bld);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_PARAM *OpensslOsslParamBldToParam(OSSL_PARAM_BLD *bld)
+{
+    return OSSL_PARAM_BLD_to_param(bld);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslParamBldPushUtf8String(OSSL_PARAM_BLD *bld, const char *key, const char *buf,
+    size_t bsize)
+{
+    return OSSL_PARAM_BLD_push_utf8_string(bld, key, buf, bsize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslParamBldPushOctetString(OSSL_PARAM_BLD *bld, const char *key, const void *buf,
+    size_t bsize)
+{
+    return OSSL_PARAM_BLD_push_octet_string(bld, key, buf, bsize);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyCtxSetEcParamgenCurveNid(EVP_PKEY_CTX *ctx, int nid)
+{
+    return EVP_PKEY_CTX_set_ec_paramgen_curve_nid(ctx, nid);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyFromDataInit(EVP_PKEY_CTX *ctx)
+{
+    return EVP_PKEY_fromdata_init(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyFromData(EVP_PKEY_CTX *ctx, EVP_PKEY **ppkey, int selection,
+    OSSL_PARAM params[])
+{
+    return EVP_PKEY_fromdata(ctx, ppkey, selection, params);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslEvpPkeyGet1EcKey(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_get1_EC_KEY(pkey);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslOsslParamFree(OSSL_PARAM *params)
+{
+    OSSL_PARAM_free(params);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcOct2Point(const EC_GROUP *group, EC_POINT *p, const unsigned char *buf,
+    size_t len, BN_CTX *ctx)
+{
+    return EC_POINT_oct2point(group, p, buf, len, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcPointSetAffineCoordinates(const EC_GROUP *group, EC_POINT *p,
+    const BIGNUM *x, const BIGNUM *y, BN_CTX *ctx)
+{
+    return EC_POINT_set_affine_coordinates(group, p, x, y, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEcPointGetAffineCoordinates(const EC_GROUP *group, const EC_POINT *p,
+    BIGNUM *x, BIGNUM *y, BN_CTX *ctx)
+{
+    return EC_POINT_get_affine_coordinates(group, p, x, y, ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_KDF *OpensslEvpKdfFetch(OSSL_LIB_CTX *libctx, const char *algorithm,
+    const char *properties)
+{
+    return EVP_KDF_fetch(libctx, algorithm, properties);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EVP_KDF_CTX *OpensslEvpKdfCtxNew(EVP_KDF *kdf)
+{
+    return EVP_KDF_CTX_new(kdf);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpKdfFree(EVP_KDF *kdf)
+{
+    EVP_KDF_free(kdf);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEvpKdfCtxFree(EVP_KDF_CTX *ctx)
+{
+    EVP_KDF_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpKdfDerive(EVP_KDF_CTX *ctx, unsigned char *key, size_t keylen,
+    const OSSL_PARAM params[])
+{
+    return EVP_KDF_derive(ctx, key, keylen, params);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_ENCODER_CTX *OpensslOsslEncoderCtxNewForPkey(const EVP_PKEY *pkey, int selection,
+    const char *outputType, const char *outputStruct, const char *propquery)
+{
+    return OSSL_ENCODER_CTX_new_for_pkey(pkey, selection, outputType, outputStruct, propquery);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslEncoderToData(OSSL_ENCODER_CTX *ctx, unsigned char **pdata, size_t *len)
+{
+    return OSSL_ENCODER_to_data(ctx, pdata, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslDecoderCtxSetPassPhrase(OSSL_DECODER_CTX *ctx, const unsigned char *kstr,
+    size_t klen)
+{
+    return OSSL_DECODER_CTX_set_passphrase(ctx, kstr, klen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslOsslEncoderCtxFree(OSSL_ENCODER_CTX *ctx)
+{
+    OSSL_ENCODER_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC OSSL_DECODER_CTX *OpensslOsslDecoderCtxNewForPkey(EVP_PKEY **pkey, const char *inputType,
+    const char *inputStructure, const char *keytype, int selection, OSSL_LIB_CTX *libctx, const char *propquery)
+{
+    return OSSL_DECODER_CTX_new_for_pkey(pkey, inputType, inputStructure, keytype, selection, libctx, propquery);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslOsslDecoderFromData(OSSL_DECODER_CTX *ctx, const unsigned char **pdata,
+    size_t *len)
+{
+    return OSSL_DECODER_from_data(ctx, pdata, len);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslOsslDecoderCtxFree(OSSL_DECODER_CTX *ctx)
+{
+    OSSL_DECODER_CTX_free(ctx);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC EC_KEY *OpensslEcKeyNewbyCurveNameEx(OSSL_LIB_CTX *ctx, const char *propq, int nid)
+{
+    return EC_KEY_new_by_curve_name_ex(ctx, propq, nid);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyGetOctetStringParam(const EVP_PKEY *pkey, const char *keyName,
+    unsigned char *buf, size_t maxBufSz, size_t *outLen)
+{
+    return EVP_PKEY_get_octet_string_param(pkey, keyName, buf, maxBufSz, outLen);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC void OpensslEcKeySetFlags(EC_KEY *key, int flags)
+{
+    EC_KEY_set_flags(key, flags);
+}
+
+HCF_OPENSSL_ADAPTER_FUNC int OpensslEvpPkeyGetBnParam(const EVP_PKEY *pkey, const char *keyName, BIGNUM **bn)
+{
+    return EVP_PKEY_get_bn_param(pkey, keyName, bn);
+}
+
+#endif
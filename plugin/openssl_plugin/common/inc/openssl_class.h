@@ -19,6 +19,7 @@
 #include "pub_key.h"
 #include "pri_key.h"
 #include "key_pair.h"
+#include "hcf_obj_block.h"
 
 #include <openssl/bn.h>
 #include <openssl/dsa.h>
@@ -34,6 +35,8 @@ typedef struct {
     EC_KEY *ecKey;
 
     char *fieldType;
+
+    HcfObjBlock *block;
 } HcfOpensslEccPubKey;
 #define HCF_OPENSSL_ECC_PUB_KEY_CLASS "OPENSSL.ECC.PUB_KEY"
 
@@ -45,11 +48,15 @@ typedef struct {
     EC_KEY *ecKey;
 
     char *fieldType;
+
+    HcfObjBlock *block;
 } HcfOpensslEccPriKey;
 #define HCF_OPENSSL_ECC_PRI_KEY_CLASS "OPENSSL.ECC.PRI_KEY"
 
 typedef struct {
     HcfKeyPair base;
+
+    HcfObjBlock *block;
 } HcfOpensslEccKeyPair;
 #define HCF_OPENSSL_ECC_KEY_PAIR_CLASS "OPENSSL.ECC.KEY_PAIR"
 
@@ -101,6 +108,8 @@ typedef struct {
     int type;
 
     EVP_PKEY *pkey;
+
+    HcfObjBlock *block;
 } HcfOpensslAlg25519PubKey;
 #define OPENSSL_ALG25519_PUBKEY_CLASS "OPENSSL.ALG25519.PUB_KEY"
 
@@ -110,11 +119,15 @@ typedef struct {
     int type;
 
     EVP_PKEY *pkey;
+
+    HcfObjBlock *block;
 } HcfOpensslAlg25519PriKey;
 #define OPENSSL_ALG25519_PRIKEY_CLASS "OPENSSL.ALG25519.PRI_KEY"
 
 typedef struct {
     HcfKeyPair base;
+
+    HcfObjBlock *block;
 } HcfOpensslAlg25519KeyPair;
 #define OPENSSL_ALG25519_KEYPAIR_CLASS "OPENSSL.ALG25519.KEY_PAIR"
 
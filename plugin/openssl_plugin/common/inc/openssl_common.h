@@ -69,6 +69,17 @@ HcfResult GetSm2SpecStringSm3(char **returnString);
 
 HcfResult KeyDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret);
 
+/**
+ * @brief Same as KeyDerive but skips the public key validation of the peer, the caller must have validated it.
+ */
+HcfResult KeyDeriveWithCheckedPeer(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret);
+
+/**
+ * @brief Derives the shared secret into the caller buffer of *secretLen bytes and sets *secretLen to its length.
+ */
+HcfResult KeyDeriveToBuffer(EVP_PKEY *priKey, EVP_PKEY *pubKey, bool validatePeer, uint8_t *secret,
+    size_t *secretLen);
+
 HcfResult GetKeyEncoded(EVP_PKEY *pkey, const char *outPutStruct, const char *format, int selection,
     HcfBlob *returnBlob);
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_OPENSSL_KEY_DECODER_H
+#define HCF_OPENSSL_KEY_DECODER_H
+
+#include <stddef.h>
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+
+#include "result.h"
+
+typedef struct {
+    const char *inputType;      /* "PEM" or "DER" */
+    const char *inputStructure; /* NULL accepts every structure the decoders know */
+    const char *keyType;
+    int selection;
+} HcfKeyDecoderParams;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Decodes a key with an OSSL_DECODER_CTX prepared once per (inputType, inputStructure, keyType, selection).
+ *
+ * Building a decoder context walks the provider decoder graph and costs far more than the decoding itself, so the
+ * contexts are kept in a process wide pool and handed to one caller at a time. Keys that need a passphrase are not
+ * supported here. On failure the OpenSSL error queue is left as it was and *pkey is untouched, so callers can fall
+ * back to the generic path and report its errors.
+ */
+HcfResult DecodeKeyByCachedDecoder(const HcfKeyDecoderParams *params, const unsigned char *data, size_t len,
+    EVP_PKEY **pkey);
+
+/**
+ * @brief Decodes an unencrypted PKCS#8 rsaEncryption private key straight into an RSA, NULL for any other input.
+ */
+RSA *DecodeRsaPkcs8PriKeyDirect(const unsigned char *data, size_t len);
+
+/**
+ * @brief Decodes the RFC 8410 SubjectPublicKeyInfo of an X25519 or Ed25519 key, NULL for any other input.
+ */
+EVP_PKEY *DecodeEcxPubKeyDirect(const unsigned char *data, size_t len);
+
+/**
+ * @brief Decodes the RFC 8410 PKCS#8 v1 private key of the given X25519 or Ed25519 type, NULL for any other input.
+ */
+EVP_PKEY *DecodeEcxPriKeyDirect(int type, const unsigned char *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_PUB_KEY_CACHE_OPENSSL_H
+#define HCF_PUB_KEY_CACHE_OPENSSL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <openssl/sha.h>
+
+#include "blob.h"
+#include "pub_key_cache.h"
+#include "result.h"
+
+typedef enum {
+    PUB_KEY_CACHE_OBJ_RSA = 0,
+    PUB_KEY_CACHE_OBJ_EC_KEY,
+    PUB_KEY_CACHE_OBJ_EVP_PKEY,
+} PubKeyCacheObjType;
+
+typedef struct {
+    bool valid;
+    PubKeyCacheObjType objType;
+    int32_t alg;
+    /* anything else the decoded key depends on, such as the curve id */
+    int32_t param;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+} PubKeyCacheQuery;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Prepares the lookup key of an encoded public key, query->valid stays false while the cache is disabled.
+ */
+void PubKeyCacheInitQuery(PubKeyCacheObjType objType, int32_t alg, int32_t param, const HcfBlob *encoded,
+    PubKeyCacheQuery *query);
+
+/**
+ * @brief Returns an RSA, EC_KEY or EVP_PKEY the caller owns, or NULL on a miss.
+ *
+ * RSA and EVP_PKEY are returned as a new reference of the cached object. EC_KEY is returned as a copy because the
+ * encoders set the ASN.1 flags and conversion form of the EC_KEY they are given.
+ */
+void *PubKeyCacheGet(const PubKeyCacheQuery *query);
+
+/**
+ * @brief Caches a reference or copy of key, the caller keeps ownership of key itself.
+ */
+void PubKeyCachePut(const PubKeyCacheQuery *query, void *key);
+
+HcfResult OpensslPubKeyCacheSetCapacity(uint32_t capacity);
+
+void OpensslPubKeyCacheGetStats(HcfPubKeyCacheStats *stats);
+
+void OpensslPubKeyCachePurge(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "dh_openssl_common.h"
+#include <pthread.h>
 #include <string.h>
 
 #include "securec.h"
@@ -24,6 +25,10 @@
 #include "openssl_class.h"
 #include "openssl_common.h"
 
+#define DH_GROUP_PARAMS_NUM 2
+/* 1 < pk, that is pk has at least two significant bits */
+#define DH_PUB_KEY_MIN_BITS 2
+
 enum HcfDhNamedGroupId {
     HCF_DH_MODP_SIZE_1536 = 0,
     HCF_DH_MODP_SIZE_2048,
@@ -70,6 +75,22 @@ typedef struct {
     char *nidName;
 } NidNameByPLen;
 
+static HcfDhNamedGroup g_dhNamedGroups[] = {
+    { "modp_1536", 1536, 192, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "modp_2048", 2048, 224, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "modp_3072", 3072, 256, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "modp_4096", 4096, 304, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "modp_6144", 6144, 352, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "modp_8192", 8192, 400, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "ffdhe2048", 2048, 224, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "ffdhe3072", 3072, 256, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "ffdhe4096", 4096, 304, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "ffdhe6144", 6144, 352, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    { "ffdhe8192", 8192, 400, NULL, NULL, NULL, NULL, NULL, NULL, NULL }
+};
+
+static pthread_mutex_t g_dhNamedGroupLock = PTHREAD_MUTEX_INITIALIZER;
+
 static const NidNameByPLen NID_NAME_PLEN_MAP[] = {
     { HCF_DH_PLEN_2048, "ffdhe2048" },
     { HCF_DH_PLEN_3072, "ffdhe3072" },
@@ -137,3 +158,166 @@ char *GetNidNameByDhPLen(int32_t pLen)
     LOGE("Invalid prime len:%{public}d", pLen);
     return NULL;
 }
+
+static EVP_PKEY *GenerateDhNamedGroupParams(const char *nidName)
+{
+    EVP_PKEY_CTX *paramsCtx = OpensslEvpPkeyCtxNewFromName(NULL, "DH", NULL);
+    if (paramsCtx == NULL) {
+        LOGE("New paramsCtx from name failed.");
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    EVP_PKEY *paramsPkey = NULL;
+    OSSL_PARAM params[DH_GROUP_PARAMS_NUM];
+    params[0] = OpensslOsslParamConstructUtf8String("group", (char *)nidName, 0);
+    params[1] = OpensslOsslParamConstructEnd();
+    if ((OpensslEvpPkeyParamGenInit(paramsCtx) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpPkeyCtxSetParams(paramsCtx, params) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpPkeyParamGen(paramsCtx, &paramsPkey) != HCF_OPENSSL_SUCCESS)) {
+        LOGE("Generate dh named group params failed.");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyFree(paramsPkey);
+        paramsPkey = NULL;
+    }
+    OpensslEvpPkeyCtxFree(paramsCtx);
+    return paramsPkey;
+}
+
+static BIGNUM *NewBnMinusOne(const BIGNUM *a)
+{
+    BIGNUM *result = OpensslBnDup(a);
+    if ((result != NULL) && (OpensslBnSubWord(result, 1) != HCF_OPENSSL_SUCCESS)) {
+        OpensslBnFree(result);
+        return NULL;
+    }
+    return result;
+}
+
+/* Called with g_dhNamedGroupLock held, the group is only filled in once everything is ready. */
+static HcfResult BuildDhNamedGroup(HcfDhNamedGroup *group)
+{
+    EVP_PKEY *paramsPkey = GenerateDhNamedGroupParams(group->nidName);
+    DH *dh = (paramsPkey == NULL) ? NULL : OpensslEvpPkeyGet1Dh(paramsPkey);
+    BIGNUM *pMinusOne = NULL;
+    BN_MONT_CTX *mont = NULL;
+    const BIGNUM *p = (dh == NULL) ? NULL : OpensslDhGet0P(dh);
+    const BIGNUM *q = (dh == NULL) ? NULL : OpensslDhGet0Q(dh);
+    const BIGNUM *g = (dh == NULL) ? NULL : OpensslDhGet0G(dh);
+    BN_CTX *ctx = OpensslBnCtxNew();
+    bool isOk = (p != NULL) && (q != NULL) && (g != NULL) && (ctx != NULL);
+    if (isOk) {
+        pMinusOne = NewBnMinusOne(p);
+        mont = OpensslBnMontCtxNew();
+        isOk = (pMinusOne != NULL) && (mont != NULL) && (OpensslBnMontCtxSet(mont, p, ctx) == HCF_OPENSSL_SUCCESS);
+    }
+    OpensslBnCtxFree(ctx);
+    if (!isOk) {
+        LOGE("Build dh named group %{public}s failed.", group->nidName);
+        HcfPrintOpensslError();
+        OpensslBnMontCtxFree(mont);
+        OpensslBnFree(pMinusOne);
+        OpensslDhFree(dh);
+        OpensslEvpPkeyFree(paramsPkey);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    group->dh = dh;
+    group->p = p;
+    group->q = q;
+    group->g = g;
+    group->pMinusOne = pMinusOne;
+    group->mont = mont;
+    group->paramsPkey = paramsPkey;
+    return HCF_SUCCESS;
+}
+
+static const HcfDhNamedGroup *GetBuiltDhNamedGroup(HcfDhNamedGroup *group)
+{
+    (void)pthread_mutex_lock(&g_dhNamedGroupLock);
+    if ((group->paramsPkey == NULL) && (BuildDhNamedGroup(group) != HCF_SUCCESS)) {
+        group = NULL;
+    }
+    (void)pthread_mutex_unlock(&g_dhNamedGroupLock);
+    return group;
+}
+
+const HcfDhNamedGroup *GetDhNamedGroup(const char *nidName)
+{
+    if (nidName == NULL) {
+        LOGE("Invalid nid name.");
+        return NULL;
+    }
+    for (uint32_t i = 0; i < sizeof(g_dhNamedGroups) / sizeof(g_dhNamedGroups[0]); i++) {
+        if (strcmp(g_dhNamedGroups[i].nidName, nidName) == 0) {
+            return GetBuiltDhNamedGroup(&g_dhNamedGroups[i]);
+        }
+    }
+    LOGE("Unsupported dh named group.");
+    return NULL;
+}
+
+const HcfDhNamedGroup *FindDhNamedGroupByParams(const BIGNUM *p, const BIGNUM *g)
+{
+    if ((p == NULL) || (g == NULL)) {
+        return NULL;
+    }
+    int32_t pBits = OpensslBnNumBits(p);
+    for (uint32_t i = 0; i < sizeof(g_dhNamedGroups) / sizeof(g_dhNamedGroups[0]); i++) {
+        if (g_dhNamedGroups[i].pBits != pBits) {
+            continue;
+        }
+        const HcfDhNamedGroup *group = GetBuiltDhNamedGroup(&g_dhNamedGroups[i]);
+        if ((group != NULL) && (OpensslBnCmp(group->p, p) == 0) && (OpensslBnCmp(group->g, g) == 0)) {
+            return group;
+        }
+    }
+    return NULL;
+}
+
+HcfResult CheckDhNamedGroupPubKey(const HcfDhNamedGroup *group, const BIGNUM *pk)
+{
+    if ((group == NULL) || (pk == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((OpensslBnNumBits(pk) < DH_PUB_KEY_MIN_BITS) || (OpensslBnCmp(pk, group->pMinusOne) >= 0)) {
+        LOGE("Dh public key is out of range.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    BN_CTX *ctx = OpensslBnCtxNew();
+    if (ctx == NULL) {
+        LOGE("Failed to allocate BN_CTX.");
+        return HCF_ERR_MALLOC;
+    }
+    int symbol = OpensslBnKronecker(pk, group->p, ctx);
+    OpensslBnCtxFree(ctx);
+    if (symbol != 1) {
+        LOGE("Dh public key is not in the prime order subgroup.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+HcfResult CheckDhNamedGroupKeyPair(const HcfDhNamedGroup *group, const BIGNUM *pk, const BIGNUM *sk)
+{
+    HcfResult ret = CheckDhNamedGroupPubKey(group, pk);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if ((sk == NULL) || (OpensslBnNumBits(sk) == 0) || (OpensslBnCmp(sk, group->q) >= 0)) {
+        LOGE("Dh private key is out of range.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    BN_CTX *ctx = OpensslBnCtxNew();
+    BIGNUM *derived = OpensslBnNew();
+    ret = HCF_ERR_CRYPTO_OPERATION;
+    if ((ctx != NULL) && (derived != NULL) && (OpensslBnModExpMontConsttime(derived, group->g, sk, group->p,
+        ctx, group->mont) == HCF_OPENSSL_SUCCESS) && (OpensslBnCmp(derived, pk) == 0)) {
+        ret = HCF_SUCCESS;
+    } else {
+        LOGE("Dh key pair check failed.");
+        HcfPrintOpensslError();
+    }
+    OpensslBnFree(derived);
+    OpensslBnCtxFree(ctx);
+    return ret;
+}
@@ -23,6 +23,7 @@
 #include "log.h"
 #include "memory.h"
 #include "openssl_adapter.h"
+#include "openssl_key_decoder.h"
 #include "result.h"
 #include "params_parser.h"
 #include "utils.h"
@@ -527,26 +528,39 @@ HcfResult BigNumToBigInteger(const BIGNUM *src, HcfBigInteger *dest)
     return HCF_SUCCESS;
 }
 
-HcfResult KeyDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret)
+static EVP_PKEY_CTX *NewKeyDeriveCtx(EVP_PKEY *priKey, EVP_PKEY *pubKey, bool validatePeer)
 {
     EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxNew(priKey, NULL);
     if (ctx == NULL) {
         LOGE("EVP_PKEY_CTX_new failed!");
         HcfPrintOpensslError();
+        return NULL;
+    }
+    if (OpensslEvpPkeyDeriveInit(ctx) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Evp key derive init failed!");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(ctx);
+        return NULL;
+    }
+    int setPeerRet = validatePeer ? OpensslEvpPkeyDeriveSetPeer(ctx, pubKey) :
+        OpensslEvpPkeyDeriveSetPeerEx(ctx, pubKey, 0);
+    if (setPeerRet != HCF_OPENSSL_SUCCESS) {
+        LOGE("Evp key derive set peer failed!");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static HcfResult KeyDeriveInner(EVP_PKEY *priKey, EVP_PKEY *pubKey, bool validatePeer, HcfBlob *returnSecret)
+{
+    EVP_PKEY_CTX *ctx = NewKeyDeriveCtx(priKey, pubKey, validatePeer);
+    if (ctx == NULL) {
         return HCF_ERR_CRYPTO_OPERATION;
     }
     HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
     do {
-        if (OpensslEvpPkeyDeriveInit(ctx) != HCF_OPENSSL_SUCCESS) {
-            LOGE("Evp key derive init failed!");
-            HcfPrintOpensslError();
-            break;
-        }
-        if (OpensslEvpPkeyDeriveSetPeer(ctx, pubKey) != HCF_OPENSSL_SUCCESS) {
-            LOGE("Evp key derive set peer failed!");
-            HcfPrintOpensslError();
-            break;
-        }
         size_t maxLen;
         if (OpensslEvpPkeyDerive(ctx, NULL, &maxLen) != HCF_OPENSSL_SUCCESS) {
             LOGE("Evp key derive failed!");
@@ -560,7 +574,8 @@ HcfResult KeyDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret)
             break;
         }
 
-        if (OpensslEvpPkeyDerive(ctx, secretData, &maxLen) != HCF_OPENSSL_SUCCESS) {
+        size_t secretLen = maxLen;
+        if ((OpensslEvpPkeyDerive(ctx, secretData, &secretLen) != HCF_OPENSSL_SUCCESS) || (secretLen > maxLen)) {
             LOGE("Evp key derive failed!");
             HcfPrintOpensslError();
             (void)memset_s(secretData, maxLen, 0, maxLen);
@@ -570,13 +585,43 @@ HcfResult KeyDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret)
         }
 
         returnSecret->data = secretData;
-        returnSecret->len = maxLen;
+        returnSecret->len = secretLen;
         ret = HCF_SUCCESS;
     } while (0);
     OpensslEvpPkeyCtxFree(ctx);
     return ret;
 }
 
+HcfResult KeyDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret)
+{
+    return KeyDeriveInner(priKey, pubKey, true, returnSecret);
+}
+
+HcfResult KeyDeriveWithCheckedPeer(EVP_PKEY *priKey, EVP_PKEY *pubKey, HcfBlob *returnSecret)
+{
+    return KeyDeriveInner(priKey, pubKey, false, returnSecret);
+}
+
+HcfResult KeyDeriveToBuffer(EVP_PKEY *priKey, EVP_PKEY *pubKey, bool validatePeer, uint8_t *secret,
+    size_t *secretLen)
+{
+    EVP_PKEY_CTX *ctx = NewKeyDeriveCtx(priKey, pubKey, validatePeer);
+    if (ctx == NULL) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    size_t bufferLen = *secretLen;
+    HcfResult ret = HCF_SUCCESS;
+    if ((OpensslEvpPkeyDerive(ctx, secret, secretLen) != HCF_OPENSSL_SUCCESS) || (*secretLen > bufferLen)) {
+        LOGE("Evp key derive failed!");
+        HcfPrintOpensslError();
+        (void)memset_s(secret, bufferLen, 0, bufferLen);
+        *secretLen = 0;
+        ret = HCF_ERR_CRYPTO_OPERATION;
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
 HcfResult GetKeyEncoded(EVP_PKEY *pkey, const char *outPutStruct, const char *format, int selection,
     HcfBlob *returnBlob)
 {
@@ -603,6 +648,10 @@ HcfResult GetKeyEncoded(EVP_PKEY *pkey, const char *outPutStruct, const char *fo
 
 HcfResult ConvertPubPemStrToKey(EVP_PKEY **pkey, const char *keyType, int selection, const char *keyStr)
 {
+    HcfKeyDecoderParams decoderParams = { "PEM", NULL, keyType, selection };
+    if (DecodeKeyByCachedDecoder(&decoderParams, (const unsigned char *)keyStr, strlen(keyStr), pkey) == HCF_SUCCESS) {
+        return HCF_SUCCESS;
+    }
     OSSL_DECODER_CTX *ctx = OpensslOsslDecoderCtxNewForPkey(pkey, "PEM", NULL, keyType, selection, NULL, NULL);
     if (ctx == NULL) {
         LOGE("Failed to init pem public key decoder ctx.");
@@ -633,6 +682,16 @@ int PrivateKeyReadNullCb(char *buf, int size, int rwflag, void *userdata)
 
 HcfResult ConvertPriPemStrToKey(const char *keyStr, EVP_PKEY **pkey, const char *keyType)
 {
+    // The pooled decoder only accepts keys of keyType, anything else takes the path below for its error code.
+    HcfKeyDecoderParams decoderParams = { "PEM", NULL, keyType, EVP_PKEY_KEYPAIR };
+    if (DecodeKeyByCachedDecoder(&decoderParams, (const unsigned char *)keyStr, strlen(keyStr), pkey) == HCF_SUCCESS) {
+        if (OpensslEvpPkeyIsA(*pkey, keyType) == HCF_OPENSSL_SUCCESS) {
+            return HCF_SUCCESS;
+        }
+        OpensslEvpPkeyFree(*pkey);
+        *pkey = NULL;
+    }
+
     BIO *bio = OpensslBioNew(OpensslBioSMem());
     if (bio == NULL) {
         LOGE("Failed to init bio.");
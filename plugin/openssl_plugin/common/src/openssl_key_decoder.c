@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "openssl_key_decoder.h"
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+#include <openssl/err.h>
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+
+#define KEY_DECODER_CACHE_SIZE 32
+#define KEY_DECODER_IDLE_MAX 4
+#define KEY_DECODER_NAME_LEN 32
+
+#define ECX_KEY_LEN 32
+#define ECX_OID_LAST_BYTE_OFFSET 8
+#define ECX_PKCS8_OID_LAST_BYTE_OFFSET 11
+#define ECX_OID_X25519 0x6e
+#define ECX_OID_ED25519 0x70
+
+typedef struct KeyDecoderSlot {
+    OSSL_DECODER_CTX *ctx;
+    /* the decoder context writes every key it decodes here */
+    EVP_PKEY *pkey;
+    struct KeyDecoderSlot *next;
+} KeyDecoderSlot;
+
+typedef struct {
+    bool used;
+    char inputType[KEY_DECODER_NAME_LEN];
+    char inputStructure[KEY_DECODER_NAME_LEN];
+    char keyType[KEY_DECODER_NAME_LEN];
+    int selection;
+    uint32_t idleNum;
+    KeyDecoderSlot *idle;
+} KeyDecoderEntry;
+
+/* SubjectPublicKeyInfo of RFC 8410, the byte at ECX_OID_LAST_BYTE_OFFSET selects X25519 or Ed25519 */
+static const uint8_t g_ecxSpkiPrefix[] = {
+    0x30, 0x2a, 0x30, 0x05, 0x06, 0x03, 0x2b, 0x65, 0x00, 0x03, 0x21, 0x00
+};
+
+/* OneAsymmetricKey v1 without attributes or public key, as written by every OpenSSL version */
+static const uint8_t g_ecxPkcs8Prefix[] = {
+    0x30, 0x2e, 0x02, 0x01, 0x00, 0x30, 0x05, 0x06, 0x03, 0x2b, 0x65, 0x00, 0x04, 0x22, 0x04, 0x20
+};
+
+static pthread_mutex_t g_keyDecoderLock = PTHREAD_MUTEX_INITIALIZER;
+static KeyDecoderEntry g_keyDecoderCache[KEY_DECODER_CACHE_SIZE];
+
+static bool IsNameFit(const char *name)
+{
+    return (name == NULL) || (strlen(name) < KEY_DECODER_NAME_LEN);
+}
+
+static bool IsSameName(const char *cached, const char *name)
+{
+    return strcmp(cached, (name == NULL) ? "" : name) == 0;
+}
+
+static bool IsEntryMatch(const KeyDecoderEntry *entry, const HcfKeyDecoderParams *params)
+{
+    return entry->used && (entry->selection == params->selection) &&
+        IsSameName(entry->inputType, params->inputType) && IsSameName(entry->inputStructure, params->inputStructure) &&
+        IsSameName(entry->keyType, params->keyType);
+}
+
+static bool FillEntry(KeyDecoderEntry *entry, const HcfKeyDecoderParams *params)
+{
+    if ((strcpy_s(entry->inputType, KEY_DECODER_NAME_LEN, params->inputType) != EOK) ||
+        (strcpy_s(entry->inputStructure, KEY_DECODER_NAME_LEN,
+            (params->inputStructure == NULL) ? "" : params->inputStructure) != EOK) ||
+        (strcpy_s(entry->keyType, KEY_DECODER_NAME_LEN, params->keyType) != EOK)) {
+        return false;
+    }
+    entry->selection = params->selection;
+    entry->used = true;
+    return true;
+}
+
+/* Called with g_keyDecoderLock held, entries are never released so the result stays valid after unlocking. */
+static KeyDecoderEntry *FindOrAddEntry(const HcfKeyDecoderParams *params)
+{
+    if (!IsNameFit(params->inputType) || !IsNameFit(params->inputStructure) || !IsNameFit(params->keyType)) {
+        return NULL;
+    }
+    for (uint32_t i = 0; i < KEY_DECODER_CACHE_SIZE; i++) {
+        if (IsEntryMatch(&g_keyDecoderCache[i], params)) {
+            return &g_keyDecoderCache[i];
+        }
+        if (!g_keyDecoderCache[i].used) {
+            return FillEntry(&g_keyDecoderCache[i], params) ? &g_keyDecoderCache[i] : NULL;
+        }
+    }
+    return NULL;
+}
+
+static void FreeSlot(KeyDecoderSlot *slot)
+{
+    OpensslOsslDecoderCtxFree(slot->ctx);
+    OpensslEvpPkeyFree(slot->pkey);
+    HcfFree(slot);
+}
+
+static KeyDecoderSlot *AcquireSlot(const HcfKeyDecoderParams *params, KeyDecoderEntry **entry)
+{
+    KeyDecoderSlot *slot = NULL;
+    (void)pthread_mutex_lock(&g_keyDecoderLock);
+    *entry = FindOrAddEntry(params);
+    if ((*entry != NULL) && ((*entry)->idle != NULL)) {
+        slot = (*entry)->idle;
+        (*entry)->idle = slot->next;
+        (*entry)->idleNum--;
+    }
+    (void)pthread_mutex_unlock(&g_keyDecoderLock);
+    if (slot != NULL) {
+        slot->next = NULL;
+        return slot;
+    }
+
+    slot = (KeyDecoderSlot *)HcfMalloc(sizeof(KeyDecoderSlot), 0);
+    if (slot == NULL) {
+        LOGE("Failed to allocate key decoder slot.");
+        return NULL;
+    }
+    slot->ctx = OpensslOsslDecoderCtxNewForPkey(&slot->pkey, params->inputType, params->inputStructure,
+        params->keyType, params->selection, NULL, NULL);
+    if (slot->ctx == NULL) {
+        HcfFree(slot);
+        return NULL;
+    }
+    return slot;
+}
+
+static void ReleaseSlot(KeyDecoderEntry *entry, KeyDecoderSlot *slot)
+{
+    if (entry != NULL) {
+        (void)pthread_mutex_lock(&g_keyDecoderLock);
+        if (entry->idleNum < KEY_DECODER_IDLE_MAX) {
+            slot->next = entry->idle;
+            entry->idle = slot;
+            entry->idleNum++;
+            slot = NULL;
+        }
+        (void)pthread_mutex_unlock(&g_keyDecoderLock);
+    }
+    if (slot != NULL) {
+        FreeSlot(slot);
+    }
+}
+
+HcfResult DecodeKeyByCachedDecoder(const HcfKeyDecoderParams *params, const unsigned char *data, size_t len,
+    EVP_PKEY **pkey)
+{
+    if ((params == NULL) || (params->inputType == NULL) || (params->keyType == NULL) || (data == NULL) ||
+        (len == 0) || (pkey == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    (void)ERR_set_mark();
+    KeyDecoderEntry *entry = NULL;
+    KeyDecoderSlot *slot = AcquireSlot(params, &entry);
+    if (slot == NULL) {
+        (void)ERR_pop_to_mark();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    const unsigned char *pdata = data;
+    size_t pdataLen = len;
+    int ret = OpensslOsslDecoderFromData(slot->ctx, &pdata, &pdataLen);
+    EVP_PKEY *decoded = slot->pkey;
+    slot->pkey = NULL;
+    ReleaseSlot(entry, slot);
+    if ((ret != HCF_OPENSSL_SUCCESS) || (decoded == NULL)) {
+        OpensslEvpPkeyFree(decoded);
+        (void)ERR_pop_to_mark();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    (void)ERR_clear_last_mark();
+    *pkey = decoded;
+    return HCF_SUCCESS;
+}
+
+RSA *DecodeRsaPkcs8PriKeyDirect(const unsigned char *data, size_t len)
+{
+    if ((data == NULL) || (len == 0) || (len > LONG_MAX)) {
+        return NULL;
+    }
+    (void)ERR_set_mark();
+    const unsigned char *pdata = data;
+    PKCS8_PRIV_KEY_INFO *p8 = OpensslD2iPkcs8PrivKeyInfo(NULL, &pdata, (long)len);
+    const ASN1_OBJECT *alg = NULL;
+    const unsigned char *inner = NULL;
+    int innerLen = 0;
+    RSA *rsa = NULL;
+    if ((p8 != NULL) && (OpensslPkcs8PkeyGet0(&alg, &inner, &innerLen, NULL, p8) == HCF_OPENSSL_SUCCESS) &&
+        (OpensslObjObj2Nid(alg) == NID_rsaEncryption)) {
+        const unsigned char *innerEnd = inner + innerLen;
+        rsa = OpensslD2iRsaPrivateKey(NULL, &inner, innerLen);
+        if ((rsa != NULL) && (inner != innerEnd)) {
+            OpensslRsaFree(rsa);
+            rsa = NULL;
+        }
+    }
+    OpensslPkcs8PrivKeyInfoFree(p8);
+    (void)ERR_pop_to_mark();
+    return rsa;
+}
+
+static int GetEcxType(uint8_t oidLastByte)
+{
+    if (oidLastByte == ECX_OID_X25519) {
+        return EVP_PKEY_X25519;
+    }
+    if (oidLastByte == ECX_OID_ED25519) {
+        return EVP_PKEY_ED25519;
+    }
+    return EVP_PKEY_NONE;
+}
+
+static bool IsPrefixMatch(const uint8_t *data, const uint8_t *prefix, size_t prefixLen, size_t oidOffset)
+{
+    for (size_t i = 0; i < prefixLen; i++) {
+        if ((i != oidOffset) && (data[i] != prefix[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+EVP_PKEY *DecodeEcxPubKeyDirect(const unsigned char *data, size_t len)
+{
+    if ((data == NULL) || (len != sizeof(g_ecxSpkiPrefix) + ECX_KEY_LEN) ||
+        !IsPrefixMatch(data, g_ecxSpkiPrefix, sizeof(g_ecxSpkiPrefix), ECX_OID_LAST_BYTE_OFFSET)) {
+        return NULL;
+    }
+    int type = GetEcxType(data[ECX_OID_LAST_BYTE_OFFSET]);
+    if (type == EVP_PKEY_NONE) {
+        return NULL;
+    }
+    return OpensslEvpPkeyNewRawPublicKey(type, NULL, data + sizeof(g_ecxSpkiPrefix), ECX_KEY_LEN);
+}
+
+EVP_PKEY *DecodeEcxPriKeyDirect(int type, const unsigned char *data, size_t len)
+{
+    if ((data == NULL) || (len != sizeof(g_ecxPkcs8Prefix) + ECX_KEY_LEN) ||
+        !IsPrefixMatch(data, g_ecxPkcs8Prefix, sizeof(g_ecxPkcs8Prefix), ECX_PKCS8_OID_LAST_BYTE_OFFSET) ||
+        (GetEcxType(data[ECX_PKCS8_OID_LAST_BYTE_OFFSET]) != type)) {
+        return NULL;
+    }
+    return OpensslEvpPkeyNewRawPrivateKey(type, NULL, data + sizeof(g_ecxPkcs8Prefix), ECX_KEY_LEN);
+}
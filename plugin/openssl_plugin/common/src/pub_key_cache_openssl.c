@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pub_key_cache_openssl.h"
+
+#include <pthread.h>
+#include <string.h>
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+
+#define PUB_KEY_CACHE_MIN_BUCKET_NUM 16
+
+typedef struct PubKeyCacheEntry {
+    PubKeyCacheObjType objType;
+    int32_t alg;
+    int32_t param;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    void *key;
+    struct PubKeyCacheEntry *hashNext;
+    /* prev points towards the most recently used entry */
+    struct PubKeyCacheEntry *prev;
+    struct PubKeyCacheEntry *next;
+} PubKeyCacheEntry;
+
+typedef struct {
+    uint32_t capacity;
+    uint32_t count;
+    uint32_t bucketNum;
+    PubKeyCacheEntry **buckets;
+    PubKeyCacheEntry *head;
+    PubKeyCacheEntry *tail;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+} PubKeyCache;
+
+static pthread_mutex_t g_pubKeyCacheLock = PTHREAD_MUTEX_INITIALIZER;
+static PubKeyCache g_pubKeyCache;
+
+static void FreeCachedKey(PubKeyCacheObjType objType, void *key)
+{
+    switch (objType) {
+        case PUB_KEY_CACHE_OBJ_RSA:
+            OpensslRsaFree((RSA *)key);
+            break;
+        case PUB_KEY_CACHE_OBJ_EC_KEY:
+            OpensslEcKeyFree((EC_KEY *)key);
+            break;
+        case PUB_KEY_CACHE_OBJ_EVP_PKEY:
+            OpensslEvpPkeyFree((EVP_PKEY *)key);
+            break;
+        default:
+            break;
+    }
+}
+
+static bool UpRefCachedKey(PubKeyCacheObjType objType, void *key)
+{
+    switch (objType) {
+        case PUB_KEY_CACHE_OBJ_RSA:
+            return OpensslRsaUpRef((RSA *)key) == HCF_OPENSSL_SUCCESS;
+        case PUB_KEY_CACHE_OBJ_EC_KEY:
+            return OpensslEcKeyUpRef((EC_KEY *)key) == HCF_OPENSSL_SUCCESS;
+        case PUB_KEY_CACHE_OBJ_EVP_PKEY:
+            return OpensslEvpPkeyUpRef((EVP_PKEY *)key) == HCF_OPENSSL_SUCCESS;
+        default:
+            return false;
+    }
+}
+
+/* EC_KEY is copied in both directions, the cached one is never handed out and so never modified. */
+static void *PrivateCopyOfKey(PubKeyCacheObjType objType, void *key)
+{
+    if (objType == PUB_KEY_CACHE_OBJ_EC_KEY) {
+        return OpensslEcKeyDup((const EC_KEY *)key);
+    }
+    return UpRefCachedKey(objType, key) ? key : NULL;
+}
+
+static void FreeEntryList(PubKeyCacheEntry *entry)
+{
+    while (entry != NULL) {
+        PubKeyCacheEntry *next = entry->next;
+        FreeCachedKey(entry->objType, entry->key);
+        HcfFree(entry);
+        entry = next;
+    }
+}
+
+static uint32_t GetBucketIndex(const PubKeyCacheQuery *query, uint32_t bucketNum)
+{
+    uint32_t hash = ((uint32_t)query->digest[0] << 24) | ((uint32_t)query->digest[1] << 16) |
+        ((uint32_t)query->digest[2] << 8) | (uint32_t)query->digest[3];
+    hash ^= (uint32_t)query->alg ^ ((uint32_t)query->param << 8);
+    return hash & (bucketNum - 1);
+}
+
+static bool IsEntryMatch(const PubKeyCacheEntry *entry, const PubKeyCacheQuery *query)
+{
+    return (entry->objType == query->objType) && (entry->alg == query->alg) && (entry->param == query->param) &&
+        (memcmp(entry->digest, query->digest, SHA256_DIGEST_LENGTH) == 0);
+}
+
+static void EntryToQuery(const PubKeyCacheEntry *entry, PubKeyCacheQuery *query)
+{
+    query->valid = true;
+    query->objType = entry->objType;
+    query->alg = entry->alg;
+    query->param = entry->param;
+    (void)memcpy_s(query->digest, SHA256_DIGEST_LENGTH, entry->digest, SHA256_DIGEST_LENGTH);
+}
+
+/* The functions below are called with g_pubKeyCacheLock held. */
+static PubKeyCacheEntry *FindEntry(const PubKeyCacheQuery *query)
+{
+    if (g_pubKeyCache.buckets == NULL) {
+        return NULL;
+    }
+    PubKeyCacheEntry *entry = g_pubKeyCache.buckets[GetBucketIndex(query, g_pubKeyCache.bucketNum)];
+    while ((entry != NULL) && !IsEntryMatch(entry, query)) {
+        entry = entry->hashNext;
+    }
+    return entry;
+}
+
+static void UnlinkLru(PubKeyCacheEntry *entry)
+{
+    if (entry->prev != NULL) {
+        entry->prev->next = entry->next;
+    } else {
+        g_pubKeyCache.head = entry->next;
+    }
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    } else {
+        g_pubKeyCache.tail = entry->prev;
+    }
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void PushLruHead(PubKeyCacheEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = g_pubKeyCache.head;
+    if (g_pubKeyCache.head != NULL) {
+        g_pubKeyCache.head->prev = entry;
+    } else {
+        g_pubKeyCache.tail = entry;
+    }
+    g_pubKeyCache.head = entry;
+}
+
+static void InsertBucket(PubKeyCacheEntry **buckets, uint32_t bucketNum, PubKeyCacheEntry *entry)
+{
+    PubKeyCacheQuery query;
+    EntryToQuery(entry, &query);
+    uint32_t index = GetBucketIndex(&query, bucketNum);
+    entry->hashNext = buckets[index];
+    buckets[index] = entry;
+}
+
+static void RemoveBucket(PubKeyCacheEntry *entry)
+{
+    PubKeyCacheQuery query;
+    EntryToQuery(entry, &query);
+    PubKeyCacheEntry **link = &g_pubKeyCache.buckets[GetBucketIndex(&query, g_pubKeyCache.bucketNum)];
+    while ((*link != NULL) && (*link != entry)) {
+        link = &(*link)->hashNext;
+    }
+    if (*link != NULL) {
+        *link = entry->hashNext;
+    }
+    entry->hashNext = NULL;
+}
+
+/* Evicted entries are chained through next and released by the caller once the lock is dropped. */
+static PubKeyCacheEntry *EvictOverCapacity(void)
+{
+    PubKeyCacheEntry *evicted = NULL;
+    while ((g_pubKeyCache.count > g_pubKeyCache.capacity) && (g_pubKeyCache.tail != NULL)) {
+        PubKeyCacheEntry *victim = g_pubKeyCache.tail;
+        RemoveBucket(victim);
+        UnlinkLru(victim);
+        victim->next = evicted;
+        evicted = victim;
+        g_pubKeyCache.count--;
+        g_pubKeyCache.evictions++;
+    }
+    return evicted;
+}
+
+static PubKeyCacheEntry *DetachAllEntries(void)
+{
+    PubKeyCacheEntry *all = g_pubKeyCache.head;
+    g_pubKeyCache.head = NULL;
+    g_pubKeyCache.tail = NULL;
+    g_pubKeyCache.count = 0;
+    if (g_pubKeyCache.buckets != NULL) {
+        (void)memset_s(g_pubKeyCache.buckets, sizeof(PubKeyCacheEntry *) * g_pubKeyCache.bucketNum, 0,
+            sizeof(PubKeyCacheEntry *) * g_pubKeyCache.bucketNum);
+    }
+    return all;
+}
+
+void PubKeyCacheInitQuery(PubKeyCacheObjType objType, int32_t alg, int32_t param, const HcfBlob *encoded,
+    PubKeyCacheQuery *query)
+{
+    if (query == NULL) {
+        return;
+    }
+    query->valid = false;
+    if ((encoded == NULL) || (encoded->data == NULL) || (encoded->len == 0)) {
+        return;
+    }
+    (void)pthread_mutex_lock(&g_pubKeyCacheLock);
+    bool enabled = (g_pubKeyCache.capacity > 0);
+    (void)pthread_mutex_unlock(&g_pubKeyCacheLock);
+    if (!enabled) {
+        return;
+    }
+    unsigned int digestLen = 0;
+    if ((OpensslEvpDigest(encoded->data, encoded->len, query->digest, &digestLen, OpensslEvpSha256()) !=
+        HCF_OPENSSL_SUCCESS) || (digestLen != SHA256_DIGEST_LENGTH)) {
+        LOGD("[error] Failed to digest the encoded public key.");
+        return;
+    }
+    query->objType = objType;
+    query->alg = alg;
+    query->param = param;
+    query->valid = true;
+}
+
+void *PubKeyCacheGet(const PubKeyCacheQuery *query)
+{
+    if ((query == NULL) || !query->valid) {
+        return NULL;
+    }
+    void *key = NULL;
+    (void)pthread_mutex_lock(&g_pubKeyCacheLock);
+    PubKeyCacheEntry *entry = FindEntry(query);
+    if ((entry != NULL) && UpRefCachedKey(entry->objType, entry->key)) {
+        UnlinkLru(entry);
+        PushLruHead(entry);
+        key = entry->key;
+        g_pubKeyCache.hits++;
+    } else {
+        g_pubKeyCache.misses++;
+    }
+    (void)pthread_mutex_unlock(&g_pubKeyCacheLock);
+    if ((key != NULL) && (query->objType == PUB_KEY_CACHE_OBJ_EC_KEY)) {
+        EC_KEY *copy = OpensslEcKeyDup((const EC_KEY *)key);
+        OpensslEcKeyFree((EC_KEY *)key);
+        key = copy;
+    }
+    return key;
+}
+
+void PubKeyCachePut(const PubKeyCacheQuery *query, void *key)
+{
+    if ((query == NULL) || !query->valid || (key == NULL)) {
+        return;
+    }
+    PubKeyCacheEntry *entry = (PubKeyCacheEntry *)HcfMalloc(sizeof(PubKeyCacheEntry), 0);
+    if (entry == NULL) {
+        LOGE("Failed to allocate public key cache entry.");
+        return;
+    }
+    entry->key = PrivateCopyOfKey(query->objType, key);
+    if (entry->key == NULL) {
+        HcfFree(entry);
+        return;
+    }
+    entry->objType = query->objType;
+    entry->alg = query->alg;
+    entry->param = query->param;
+    (void)memcpy_s(entry->digest, SHA256_DIGEST_LENGTH, query->digest, SHA256_DIGEST_LENGTH);
+
+    PubKeyCacheEntry *evicted = NULL;
+    (void)pthread_mutex_lock(&g_pubKeyCacheLock);
+    if ((g_pubKeyCache.capacity == 0) || (FindEntry(query) != NULL)) {
+        /* disabled meanwhile, or another thread imported the same key first */
+        evicted = entry;
+    } else {
+        InsertBucket(g_pubKeyCache.buckets, g_pubKeyCache.bucketNum, entry);
+        PushLruHead(entry);
+        g_pubKeyCache.count++;
+        evicted = EvictOverCapacity();
+    }
+    (void)pthread_mutex_unlock(&g_pubKeyCacheLock);
+    FreeEntryList(evicted);
+}
+
+static uint32_t GetBucketNum(uint32_t capacity)
+{
+    uint32_t bucketNum = PUB_KEY_CACHE_MIN_BUCKET_NUM;
+    while (bucketNum < capacity) {
+        bucketNum <<= 1;
+    }
+    return bucketNum;
+}
+
+HcfResult OpensslPubKeyCacheSetCapacity(uint32_t capacity)
+{
+    if (capacity > HCF_PUB_KEY_CACHE_MAX_CAPACITY) {
+        LOGE("Public key cache capacity is too large.");
+        return HCF_INVALID_PARAMS;
+    }
+    uint32_t bucketNum = (capacity == 0) ? 0 : GetBucketNum(capacity);
+    PubKeyCacheEntry **buckets = NULL;
+    if (bucketNum > 0) {
+        buckets = (PubKeyCacheEntry **)HcfMalloc(sizeof(PubKeyCacheEntry *) * bucketNum, 0);
+        if (buckets == NULL) {
+            LOGE("Failed to allocate public key cache buckets.");
+            return HCF_ERR_MALLOC;
+        }
+    }
+    PubKeyCacheEntry *evicted = NULL;
+    (void)pthread_mutex_lock(&g_pubKeyCacheLock);
+    PubKeyCacheEntry **oldBuckets = g_pubKeyCache.buckets;
+    if (capacity == 0) {
+        evicted = DetachAllEntries();
+    } else {
+        for (PubKeyCacheEntry *entry = g_pubKeyCache.head; entry != NULL; entry = entry->next) {
+            InsertBucket(buckets, bucketNum, entry);
+        }
+    }
+    g_pubKeyCache.buckets = buckets;
+    g_pubKeyCache.bucketNum = bucketNum;
+    g_pubKeyCache.capacity = capacity;
+    if (capacity > 0) {
+        evicted = EvictOverCapacity();
+    }
+    (void)pthread_mutex_unlock(&g_pubKeyCacheLock);
+    HcfFree(oldBuckets);
+    FreeEntryList(evicted);
+    return HCF_SUCCESS;
+}
+
+void OpensslPubKeyCacheGetStats(HcfPubKeyCacheStats *stats)
+{
+    (void)pthread_mutex_lock(&g_pubKeyCacheLock);
+    stats->capacity = g_pubKeyCache.capacity;
+    stats->count = g_pubKeyCache.count;
+    stats->hits = g_pubKeyCache.hits;
+    stats->misses = g_pubKeyCache.misses;
+    stats->evictions = g_pubKeyCache.evictions;
+    (void)pthread_mutex_unlock(&g_pubKeyCacheLock);
+}
+
+void OpensslPubKeyCachePurge(void)
+{
+    (void)pthread_mutex_lock(&g_pubKeyCacheLock);
+    PubKeyCacheEntry *all = DetachAllEntries();
+    (void)pthread_mutex_unlock(&g_pubKeyCacheLock);
+    FreeEntryList(all);
+}
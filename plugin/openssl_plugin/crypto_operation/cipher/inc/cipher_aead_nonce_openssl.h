@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_CIPHER_AEAD_NONCE_OPENSSL_H
+#define HCF_CIPHER_AEAD_NONCE_OPENSSL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "aes_openssl_common.h"
+#include "blob.h"
+#include "cipher.h"
+#include "result.h"
+#include "sym_common_defines.h"
+
+typedef struct {
+    /* HcfAeadNonceMode */
+    int32_t mode;
+    bool isFixedFieldSet;
+    uint8_t fixedField[HCF_AEAD_NONCE_FIXED_FIELD_LEN];
+} CipherAeadNonceConfig;
+
+/* Params an encrypt init runs on when the cipher generates the nonce. */
+typedef struct {
+    HcfAeadParamsSpec spec;
+    uint8_t nonce[HCF_AEAD_NONCE_LEN];
+} CipherAeadNonceParams;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+HcfResult SetCipherAeadNonceMode(CipherAeadNonceConfig *config, int32_t value);
+
+HcfResult SetCipherAeadNonceFixedField(CipherAeadNonceConfig *config, HcfBlob blob);
+
+/**
+ * @brief For an encrypt init in a generated mode, draws the next nonce of key into nonceParams and points *params
+ * at them. Other inits are left alone.
+ *
+ * The aad and tag length of the caller params are kept, a nonce in them is rejected.
+ */
+HcfResult PrepareCipherAeadNonce(const CipherAeadNonceConfig *config, enum HcfCryptoMode opMode, SymKeyImpl *key,
+    HcfParamsSpec **params, CipherAeadNonceParams *nonceParams);
+
+/**
+ * @brief Marks data so that the nonce in params, if PrepareCipherAeadNonce generated it, leads its first output.
+ */
+void SetCipherAeadNoncePending(CipherData *data, const HcfParamsSpec *params, const CipherAeadNonceParams *nonceParams);
+
+/**
+ * @brief Puts the pending nonce of data in front of output, called once an update or doFinal has succeeded.
+ */
+HcfResult PrependCipherAeadNonce(CipherData *data, HcfBlob *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_CIPHER_PARALLEL_OPENSSL_H
+#define HCF_CIPHER_PARALLEL_OPENSSL_H
+
+#include <stdint.h>
+#include "aes_openssl_common.h"
+#include "blob.h"
+#include "cipher.h"
+#include "result.h"
+
+/* Every worker gets at least this much data, smaller inputs are not worth a thread. */
+#define CIPHER_PARALLEL_MIN_SEGMENT_LEN (64 * 1024)
+
+typedef struct {
+    /* 0 and 1 keep the serial path */
+    uint32_t workerNum;
+    /* 0 selects HCF_CIPHER_PARALLEL_DEFAULT_THRESHOLD */
+    uint32_t threshold;
+} CipherParallelConfig;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+HcfResult SetCipherParallelConfig(CipherParallelConfig *config, CipherSpecItem item, int32_t value);
+
+HcfResult GetCipherParallelConfig(const CipherParallelConfig *config, CipherSpecItem item, int32_t *returnInt);
+
+/**
+ * @brief Records the initial counter block after init so that later updates can seek the key stream.
+ */
+void InitCipherCounter(CipherData *data, CipherCounterType type, const unsigned char *iv);
+
+/**
+ * @brief Same contract as OpensslEvpCipherUpdate on data->ctx.
+ *
+ * Large inputs of a counter mode are split into counter-aligned segments, each encrypted on its own copy of the
+ * context. The output is identical to the serial update and the context continues from the end of the input.
+ */
+HcfResult CipherParallelUpdate(CipherData *data, const CipherParallelConfig *config, const HcfBlob *input,
+    uint8_t *out, int *outLen);
+
+/**
+ * @brief Runs every XTS data unit of the input through data->ctx with its own tweak, output must hold input->len.
+ *
+ * Above the configured threshold the units are spread over workers, each on its own copy of the context.
+ */
+HcfResult CipherXtsDataUnitUpdate(CipherData *data, const CipherParallelConfig *config, uint64_t startDataUnit,
+    uint32_t dataUnitLen, const HcfBlob *input, uint8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
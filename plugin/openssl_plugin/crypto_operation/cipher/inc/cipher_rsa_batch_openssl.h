@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_CIPHER_RSA_BATCH_OPENSSL_H
+#define HCF_CIPHER_RSA_BATCH_OPENSSL_H
+
+#include <stdint.h>
+#include <openssl/evp.h>
+
+#include "blob.h"
+#include "cipher.h"
+#include "result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Encrypts or decrypts a batch on copies of an initialized EVP_PKEY_encrypt or EVP_PKEY_decrypt context.
+ *
+ * ctx already carries the padding and OAEP digests and is copied once per worker. A copy shares the OAEP label of
+ * ctx, so a labelled ctx must not be given; label, if not NULL, is set on every copy instead. The arguments follow
+ * doFinalBatch of HcfCipher, each output gets a slot of slotLen bytes in the arena.
+ */
+HcfResult HcfRsaCipherBatchOpenssl(const EVP_PKEY_CTX *ctx, enum HcfCryptoMode opMode, const HcfBlob *label,
+    size_t slotLen, const HcfBlob *inputs, uint32_t count, uint32_t workerNum, HcfBlob *returnArena,
+    HcfBlob *returnOutputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_SM4_SIMD_H
+#define HCF_SM4_SIMD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HCF_SM4_SIMD_X86
+#endif
+
+#define SM4_SIMD_BLOCK_SIZE 16
+#define SM4_SIMD_KEY_SIZE 16
+#define SM4_SIMD_ROUND_NUM 32
+
+typedef struct {
+    uint32_t rk[SM4_SIMD_ROUND_NUM];
+} Sm4SimdKey;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Whether the CPU runs the multi-block kernels, checked once and cached.
+ */
+bool Sm4SimdIsSupported(void);
+
+/**
+ * @brief Expands a 16 byte key, the decrypt schedule is the encrypt schedule in reverse order.
+ */
+void Sm4SimdSetKey(const uint8_t *key, bool decrypt, Sm4SimdKey *ks);
+
+/**
+ * @brief Runs blocks independent blocks through the cipher, in and out may be the same buffer.
+ *
+ * Without CPU support the blocks are processed one at a time by the portable implementation.
+ */
+void Sm4SimdCryptBlocks(const uint8_t *in, uint8_t *out, size_t blocks, const Sm4SimdKey *ks);
+
+/**
+ * @brief Single block callback in the shape of OpenSSL block128_f, key is a Sm4SimdKey.
+ */
+void Sm4SimdEncryptBlock(const unsigned char in[SM4_SIMD_BLOCK_SIZE], unsigned char out[SM4_SIMD_BLOCK_SIZE],
+    const void *key);
+
+/**
+ * @brief Counter mode callback in the shape of OpenSSL ctr128_f, key is a Sm4SimdKey.
+ *
+ * Only the low 32 bits of ivec are incremented, carrying into the upper bits is left to the caller.
+ */
+void Sm4SimdCtr32EncryptBlocks(const unsigned char *in, unsigned char *out, size_t blocks, const void *key,
+    const unsigned char ivec[SM4_SIMD_BLOCK_SIZE]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_SM4_SIMD_OPENSSL_H
+#define HCF_SM4_SIMD_OPENSSL_H
+
+#include <openssl/evp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * SM4 ciphers backed by the multi-block kernels of sm4_simd.h. They behave like EVP_sm4_ecb(), EVP_sm4_ctr() and
+ * the fetched "SM4-GCM" for every EVP call the SM4 engine makes, and are NULL when the CPU has no support, in which
+ * case the caller keeps the OpenSSL implementation. The returned ciphers live until the process exits and passing
+ * them to OpensslEvpCipherFree is a no-op.
+ */
+const EVP_CIPHER *Sm4SimdEcbCipher(void);
+
+const EVP_CIPHER *Sm4SimdCtrCipher(void);
+
+const EVP_CIPHER *Sm4SimdGcmCipher(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cipher_aead_nonce_openssl.h"
+
+#include <pthread.h>
+#include <string.h>
+#include "securec.h"
+#include "log.h"
+#include "memory.h"
+#include "rand_buffer_openssl.h"
+
+#define AEAD_PARAMS_SPEC_TYPE "AeadParamsSpec"
+#define NONCE_INVOCATION_LEN (HCF_AEAD_NONCE_LEN - HCF_AEAD_NONCE_FIXED_FIELD_LEN)
+#define BITS_PER_BYTE 8
+/* NIST SP 800-38D 8.3, the random construction is limited to 2^32 invocations of one key. */
+#define RANDOM_NONCE_MAX_INVOCATION_NUM (1ULL << 32)
+
+/*
+ * One process wide lock guards the nonce state of all keys, so that ciphers sharing a key on different threads draw
+ * distinct nonces. Nonce draws of different keys are serialised as well; the section only advances a counter.
+ */
+static pthread_mutex_t g_aeadNonceLock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *GetCipherAeadNonceParamsType(void)
+{
+    return AEAD_PARAMS_SPEC_TYPE;
+}
+
+HcfResult SetCipherAeadNonceMode(CipherAeadNonceConfig *config, int32_t value)
+{
+    if ((value != HCF_AEAD_NONCE_EXTERNAL) && (value != HCF_AEAD_NONCE_COUNTER) && (value != HCF_AEAD_NONCE_RANDOM)) {
+        LOGE("Invalid nonce mode %{public}d.", value);
+        return HCF_INVALID_PARAMS;
+    }
+    config->mode = value;
+    return HCF_SUCCESS;
+}
+
+HcfResult SetCipherAeadNonceFixedField(CipherAeadNonceConfig *config, HcfBlob blob)
+{
+    if ((blob.data == NULL) || (blob.len != HCF_AEAD_NONCE_FIXED_FIELD_LEN)) {
+        LOGE("The fixed field must be %{public}d bytes.", HCF_AEAD_NONCE_FIXED_FIELD_LEN);
+        return HCF_INVALID_PARAMS;
+    }
+    (void)memcpy_s(config->fixedField, HCF_AEAD_NONCE_FIXED_FIELD_LEN, blob.data, blob.len);
+    config->isFixedFieldSet = true;
+    return HCF_SUCCESS;
+}
+
+/* Takes the aad and tag length of params, which must not carry a nonce of their own. */
+static HcfResult CopyCipherAeadParams(const HcfParamsSpec *params, HcfAeadParamsSpec *spec)
+{
+    if (params == NULL) {
+        return HCF_SUCCESS;
+    }
+    const char *typeName = (params->getType != NULL) ? params->getType() : NULL;
+    if ((typeName != NULL) && (strcmp(typeName, AEAD_PARAMS_SPEC_TYPE) == 0)) {
+        const HcfAeadParamsSpec *aeadParams = (const HcfAeadParamsSpec *)params;
+        if (aeadParams->nonce.data != NULL) {
+            LOGE("The nonce is generated by the cipher, params must not carry one.");
+            return HCF_ERR_PARAMETER_CHECK_FAILED;
+        }
+        spec->aad = aeadParams->aad;
+        spec->tagLen = aeadParams->tagLen;
+        return HCF_SUCCESS;
+    }
+    // GCM, CCM and ChaCha20 params share this layout.
+    const HcfGcmParamsSpec *gcmParams = (const HcfGcmParamsSpec *)params;
+    if (gcmParams->iv.data != NULL) {
+        LOGE("The nonce is generated by the cipher, params must not carry one.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    spec->aad = gcmParams->aad;
+    spec->tagLen = (int32_t)gcmParams->tag.len;
+    return HCF_SUCCESS;
+}
+
+static HcfResult DrawNonceInvocation(const CipherAeadNonceConfig *config, SymKeyNonceState *state,
+    uint64_t *invocation, uint8_t *fixedField)
+{
+    HcfResult ret = HCF_SUCCESS;
+    (void)pthread_mutex_lock(&g_aeadNonceLock);
+    uint64_t maxNum = (config->mode == HCF_AEAD_NONCE_RANDOM) ? RANDOM_NONCE_MAX_INVOCATION_NUM : UINT64_MAX;
+    if ((state->invocationNum != 0) && (state->mode != config->mode)) {
+        LOGE("The key already generates nonces in mode %{public}d.", state->mode);
+        ret = HCF_ERR_INVALID_CALL;
+    } else if (state->invocationNum >= maxNum) {
+        LOGE("The nonces of the key are used up, switch to a new key.");
+        ret = HCF_ERR_INVALID_CALL;
+    } else if ((state->invocationNum == 0) && (config->mode == HCF_AEAD_NONCE_COUNTER)) {
+        ret = HcfRandBufferGenerate(state->fixedField, SYM_KEY_NONCE_FIXED_FIELD_LEN);
+    }
+    if (ret == HCF_SUCCESS) {
+        state->mode = config->mode;
+        *invocation = state->invocationNum++;
+        (void)memcpy_s(fixedField, HCF_AEAD_NONCE_FIXED_FIELD_LEN, state->fixedField, SYM_KEY_NONCE_FIXED_FIELD_LEN);
+    }
+    (void)pthread_mutex_unlock(&g_aeadNonceLock);
+    return ret;
+}
+
+static HcfResult GenerateNonce(const CipherAeadNonceConfig *config, SymKeyImpl *key, uint8_t *nonce)
+{
+    uint64_t invocation = 0;
+    uint8_t fixedField[HCF_AEAD_NONCE_FIXED_FIELD_LEN] = { 0 };
+    HcfResult ret = DrawNonceInvocation(config, &key->nonceState, &invocation, fixedField);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (config->mode == HCF_AEAD_NONCE_RANDOM) {
+        return HcfRandBufferGenerate(nonce, HCF_AEAD_NONCE_LEN);
+    }
+    const uint8_t *fixed = config->isFixedFieldSet ? config->fixedField : fixedField;
+    (void)memcpy_s(nonce, HCF_AEAD_NONCE_LEN, fixed, HCF_AEAD_NONCE_FIXED_FIELD_LEN);
+    for (uint32_t i = 0; i < NONCE_INVOCATION_LEN; i++) {
+        nonce[HCF_AEAD_NONCE_LEN - 1 - i] = (uint8_t)(invocation >> (i * BITS_PER_BYTE));
+    }
+    return HCF_SUCCESS;
+}
+
+HcfResult PrepareCipherAeadNonce(const CipherAeadNonceConfig *config, enum HcfCryptoMode opMode, SymKeyImpl *key,
+    HcfParamsSpec **params, CipherAeadNonceParams *nonceParams)
+{
+    if ((config->mode == HCF_AEAD_NONCE_EXTERNAL) || (opMode != ENCRYPT_MODE)) {
+        return HCF_SUCCESS;
+    }
+    (void)memset_s(nonceParams, sizeof(CipherAeadNonceParams), 0, sizeof(CipherAeadNonceParams));
+    HcfResult ret = CopyCipherAeadParams(*params, &nonceParams->spec);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = GenerateNonce(config, key, nonceParams->nonce);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to generate the nonce.");
+        return ret;
+    }
+    nonceParams->spec.base.getType = GetCipherAeadNonceParamsType;
+    nonceParams->spec.nonce.data = nonceParams->nonce;
+    nonceParams->spec.nonce.len = HCF_AEAD_NONCE_LEN;
+    *params = (HcfParamsSpec *)&nonceParams->spec;
+    return HCF_SUCCESS;
+}
+
+void SetCipherAeadNoncePending(CipherData *data, const HcfParamsSpec *params, const CipherAeadNonceParams *nonceParams)
+{
+    if (params != (const HcfParamsSpec *)&nonceParams->spec) {
+        return;
+    }
+    (void)memcpy_s(data->nonce, HCF_AEAD_NONCE_LEN, nonceParams->nonce, HCF_AEAD_NONCE_LEN);
+    data->isNoncePending = true;
+}
+
+HcfResult PrependCipherAeadNonce(CipherData *data, HcfBlob *output)
+{
+    if ((data == NULL) || !data->isNoncePending) {
+        return HCF_SUCCESS;
+    }
+    uint32_t outLen = (output->data == NULL) ? 0 : output->len;
+    uint8_t *out = (uint8_t *)HcfMalloc(HCF_AEAD_NONCE_LEN + outLen, 0);
+    if (out == NULL) {
+        LOGE("malloc output failed!");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(out, HCF_AEAD_NONCE_LEN, data->nonce, HCF_AEAD_NONCE_LEN);
+    if (outLen != 0) {
+        (void)memcpy_s(out + HCF_AEAD_NONCE_LEN, outLen, output->data, outLen);
+    }
+    HcfFree(output->data);
+    output->data = out;
+    output->len = HCF_AEAD_NONCE_LEN + outLen;
+    data->isNoncePending = false;
+    return HCF_SUCCESS;
+}
@@ -20,6 +20,8 @@
 #include "result.h"
 #include "utils.h"
 #include "aes_openssl_common.h"
+#include "cipher_aead_nonce_openssl.h"
+#include "cipher_parallel_openssl.h"
 #include "sym_common_defines.h"
 #include "openssl_adapter.h"
 #include "openssl_common.h"
@@ -52,6 +54,8 @@ typedef struct {
     HcfCipherGeneratorSpi base;
     CipherAttr attr;
     CipherData *cipherData;
+    CipherParallelConfig parallelConfig;
+    CipherAeadNonceConfig nonceConfig;
 } HcfCipherAesGeneratorSpiOpensslImpl;
 
 static const char *GetAesGeneratorClass(void)
@@ -643,13 +647,26 @@ static HcfResult EngineCipherInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMod
     if (ret != HCF_SUCCESS) {
         return ret;
     }
+    CipherAeadNonceParams nonceParams;
+    ret = PrepareCipherAeadNonce(&cipherImpl->nonceConfig, opMode, keyImpl, &params, &nonceParams);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
 
     if (InitCipherData(self, opMode, params, &(cipherImpl->cipherData)) != HCF_SUCCESS) {
         LOGE("Failed to initialize cipher data.");
         return HCF_INVALID_PARAMS;
     }
 
-    return ConfigureCipherCtx(cipherImpl, keyImpl, enc, opMode, params);
+    ret = ConfigureCipherCtx(cipherImpl, keyImpl, enc, opMode, params);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (cipherImpl->attr.mode == HCF_ALG_MODE_CTR) {
+        InitCipherCounter(cipherImpl->cipherData, CIPHER_COUNTER_BE128, GetIv(params));
+    }
+    SetCipherAeadNoncePending(cipherImpl->cipherData, params, &nonceParams);
+    return HCF_SUCCESS;
 }
 
 static HcfResult CommonUpdate(CipherData *data, HcfBlob *input, HcfBlob *output)
@@ -803,7 +820,7 @@ static HcfResult EngineUpdate(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfBl
     }
 
     if (!data->aead) {
-        ret = CommonUpdate(data, input, output);
+        ret = CipherParallelUpdate(data, &cipherImpl->parallelConfig, input, output->data, (int *)&output->len);
     } else {
         ret = EngineUpdateAead(cipherImpl, data, input, output);
     }
@@ -816,11 +833,18 @@ static HcfResult EngineUpdate(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfBl
         data->updateLen = input->len;
     }
     data->aead = false;
+    ret = PrependCipherAeadNonce(data, output);
+    if (ret != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(output);
+        FreeCipherData(&(cipherImpl->cipherData));
+        return ret;
+    }
     FreeRedundantOutput(output);
     return ret;
 }
 
-static HcfResult CommonDoFinal(CipherData *data, HcfBlob *input, HcfBlob *output)
+static HcfResult CommonDoFinal(HcfCipherAesGeneratorSpiOpensslImpl *cipherImpl, CipherData *data, HcfBlob *input,
+    HcfBlob *output)
 {
     int32_t ret;
     uint32_t len = 0;
@@ -831,11 +855,10 @@ static HcfResult CommonDoFinal(CipherData *data, HcfBlob *input, HcfBlob *output
         return res;
     }
     if (isUpdateInput) {
-        ret = OpensslEvpCipherUpdate(data->ctx, output->data, (int32_t *)&len, input->data, input->len);
-        if (ret != HCF_OPENSSL_SUCCESS) {
-            HcfPrintOpensslError();
+        res = CipherParallelUpdate(data, &cipherImpl->parallelConfig, input, output->data, (int32_t *)&len);
+        if (res != HCF_SUCCESS) {
             LOGE("EVP_CipherUpdate failed!");
-            return HCF_ERR_CRYPTO_OPERATION;
+            return res;
         }
     }
     ret = OpensslEvpCipherFinalEx(data->ctx, output->data + len, (int *)&output->len);
@@ -1190,7 +1213,10 @@ static HcfResult EngineDoFinal(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfB
     } else if (mode == HCF_ALG_MODE_GCM) {
         ret = GcmDoFinal(data, input, output);
     } else { /* only ECB CBC CTR CFB OFB support */
-        ret = CommonDoFinal(data, input, output);
+        ret = CommonDoFinal(cipherImpl, data, input, output);
+    }
+    if (ret == HCF_SUCCESS) {
+        ret = PrependCipherAeadNonce(data, output);
     }
 
     FreeCipherData(&(cipherImpl->cipherData));
@@ -1232,12 +1258,103 @@ static HcfResult GetAesCipherSpecUint8Array(HcfCipherGeneratorSpi *self, CipherS
     return HCF_NOT_SUPPORT;
 }
 
+static bool IsAesAeadNonceSupported(const HcfCipherAesGeneratorSpiOpensslImpl *cipherImpl)
+{
+    if ((cipherImpl->attr.mode != HCF_ALG_MODE_GCM) && (cipherImpl->attr.mode != HCF_ALG_MODE_CCM)) {
+        LOGE("Nonce generation only support GCM and CCM mode.");
+        return false;
+    }
+    return true;
+}
+
 static HcfResult SetAesCipherSpecUint8Array(HcfCipherGeneratorSpi *self, CipherSpecItem item, HcfBlob blob)
 {
-    (void)self;
-    (void)item;
-    (void)blob;
-    return HCF_NOT_SUPPORT;
+    if ((self == NULL) || (!HcfIsClassMatch((const HcfObjectBase *)self, GetAesGeneratorClass()))) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherAesGeneratorSpiOpensslImpl *cipherImpl = (HcfCipherAesGeneratorSpiOpensslImpl *)self;
+    if ((item != CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR) || !IsAesAeadNonceSupported(cipherImpl)) {
+        return HCF_NOT_SUPPORT;
+    }
+    return SetCipherAeadNonceFixedField(&cipherImpl->nonceConfig, blob);
+}
+
+static HcfResult SetAesCipherSpecInt(HcfCipherGeneratorSpi *self, CipherSpecItem item, int32_t value)
+{
+    if ((self == NULL) || (!HcfIsClassMatch((const HcfObjectBase *)self, GetAesGeneratorClass()))) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherAesGeneratorSpiOpensslImpl *cipherImpl = (HcfCipherAesGeneratorSpiOpensslImpl *)self;
+    if (item == CIPHER_AEAD_NONCE_MODE_INT) {
+        return IsAesAeadNonceSupported(cipherImpl) ? SetCipherAeadNonceMode(&cipherImpl->nonceConfig, value) :
+            HCF_NOT_SUPPORT;
+    }
+    if ((cipherImpl->attr.mode != HCF_ALG_MODE_CTR) && (cipherImpl->attr.mode != HCF_ALG_MODE_XTS)) {
+        LOGE("Parallel update only support CTR and XTS mode.");
+        return HCF_NOT_SUPPORT;
+    }
+    return SetCipherParallelConfig(&cipherImpl->parallelConfig, item, value);
+}
+
+static HcfResult GetAesCipherSpecInt(HcfCipherGeneratorSpi *self, CipherSpecItem item, int32_t *returnInt)
+{
+    if ((self == NULL) || (!HcfIsClassMatch((const HcfObjectBase *)self, GetAesGeneratorClass()))) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherAesGeneratorSpiOpensslImpl *cipherImpl = (HcfCipherAesGeneratorSpiOpensslImpl *)self;
+    if (item == CIPHER_AEAD_NONCE_MODE_INT) {
+        if (!IsAesAeadNonceSupported(cipherImpl)) {
+            return HCF_NOT_SUPPORT;
+        }
+        *returnInt = cipherImpl->nonceConfig.mode;
+        return HCF_SUCCESS;
+    }
+    if ((cipherImpl->attr.mode != HCF_ALG_MODE_CTR) && (cipherImpl->attr.mode != HCF_ALG_MODE_XTS)) {
+        LOGE("Parallel update only support CTR and XTS mode.");
+        return HCF_NOT_SUPPORT;
+    }
+    return GetCipherParallelConfig(&cipherImpl->parallelConfig, item, returnInt);
+}
+
+static HcfResult EngineProcessDataUnits(HcfCipherGeneratorSpi *self, uint64_t startDataUnit, uint32_t dataUnitLen,
+    HcfBlob *input, HcfBlob *output)
+{
+    if ((self == NULL) || (!HcfIsBlobValid(input)) || (output == NULL)) {
+        LOGE("Invalid input parameter!");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((const HcfObjectBase *)self, GetAesGeneratorClass())) {
+        LOGE("Class is not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherAesGeneratorSpiOpensslImpl *cipherImpl = (HcfCipherAesGeneratorSpiOpensslImpl *)self;
+    if (cipherImpl->attr.mode != HCF_ALG_MODE_XTS) {
+        LOGE("Data unit processing only support XTS mode.");
+        return HCF_NOT_SUPPORT;
+    }
+    if (cipherImpl->cipherData == NULL) {
+        LOGE("cipherData is null!");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((dataUnitLen < AES_BLOCK_SIZE) || (input->len % dataUnitLen != 0)) {
+        LOGE("Invalid data unit len %{public}u for input len %{public}u.", dataUnitLen, input->len);
+        return HCF_INVALID_PARAMS;
+    }
+    output->data = (uint8_t *)HcfMalloc(input->len, 0);
+    if (output->data == NULL) {
+        LOGE("malloc output failed!");
+        return HCF_ERR_MALLOC;
+    }
+    output->len = input->len;
+    HcfResult ret = CipherXtsDataUnitUpdate(cipherImpl->cipherData, &cipherImpl->parallelConfig, startDataUnit,
+        dataUnitLen, input, output->data);
+    if (ret != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(output);
+    }
+    return ret;
 }
 
 HcfResult HcfCipherAesGeneratorSpiCreate(CipherAttr *attr, HcfCipherGeneratorSpi **generator)
@@ -1259,6 +1376,9 @@ HcfResult HcfCipherAesGeneratorSpiCreate(CipherAttr *attr, HcfCipherGeneratorSpi
     returnImpl->base.getCipherSpecString = GetAesCipherSpecString;
     returnImpl->base.getCipherSpecUint8Array = GetAesCipherSpecUint8Array;
     returnImpl->base.setCipherSpecUint8Array = SetAesCipherSpecUint8Array;
+    returnImpl->base.setCipherSpecInt = SetAesCipherSpecInt;
+    returnImpl->base.getCipherSpecInt = GetAesCipherSpecInt;
+    returnImpl->base.processDataUnits = EngineProcessDataUnits;
     returnImpl->base.base.destroy = EngineAesGeneratorDestroy;
     returnImpl->base.base.getClass = GetAesGeneratorClass;
 
@@ -26,12 +26,16 @@
 #include "openssl_common.h"
 #include "openssl_class.h"
 #include "aes_openssl_common.h"
+#include "cipher_aead_nonce_openssl.h"
+#include "cipher_parallel_openssl.h"
 #include "detailed_chacha20_params.h"
 
 typedef struct {
     HcfCipherGeneratorSpi base;
     CipherAttr attr;
     CipherData *cipherData;
+    CipherParallelConfig parallelConfig;
+    CipherAeadNonceConfig nonceConfig;
 } HcfCipherChaCha20GeneratorSpiOpensslImpl;
 
 #define CHACHA20_KEY_LEN 32
@@ -278,6 +282,11 @@ static HcfResult EngineCipherInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMod
         return HCF_ERR_PARAMETER_CHECK_FAILED;
     }
     int32_t enc = (opMode == ENCRYPT_MODE) ? 1 : 0;
+    CipherAeadNonceParams nonceParams;
+    ret = PrepareCipherAeadNonce(&cipherImpl->nonceConfig, opMode, keyImpl, &params, &nonceParams);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
     HcfResult res = InitCipherData(self, opMode, params, &(cipherImpl->cipherData));
     if (res != HCF_SUCCESS) {
         LOGE("Failed to initialize cipher data.");
@@ -288,6 +297,10 @@ static HcfResult EngineCipherInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMod
         LOGE("Set cipher attribute failed!");
         goto clearup;
     }
+    if (cipherImpl->attr.mode != HCF_ALG_MODE_POLY1305) {
+        InitCipherCounter(cipherImpl->cipherData, CIPHER_COUNTER_LE32, GetIv(params));
+    }
+    SetCipherAeadNoncePending(cipherImpl->cipherData, params, &nonceParams);
     return HCF_SUCCESS;
 clearup:
     FreeCipherData(&(cipherImpl->cipherData));
@@ -371,7 +384,9 @@ static HcfResult EngineUpdate(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfBl
         LOGE("Failed to allocate output buffer.");
         return ret;
     }
-    if (!data->aead) {
+    if (cipherImpl->attr.mode != HCF_ALG_MODE_POLY1305) {
+        ret = CipherParallelUpdate(data, &cipherImpl->parallelConfig, input, output->data, (int *)&output->len);
+    } else if (!data->aead) {
         ret = CommonUpdate(data, input, output);
     } else {
         ret = AeadUpdate(data, cipherImpl->attr.mode, input, output);
@@ -385,11 +400,18 @@ static HcfResult EngineUpdate(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfBl
         data->updateLen = input->len;
     }
     data->aead = false;
+    ret = PrependCipherAeadNonce(data, output);
+    if (ret != HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(output);
+        FreeCipherData(&(cipherImpl->cipherData));
+        return ret;
+    }
     FreeRedundantOutput(output);
     return ret;
 }
 
-static HcfResult CommonDoFinal(CipherData *data, HcfBlob *input, HcfBlob *output)
+static HcfResult CommonDoFinal(CipherData *data, const CipherParallelConfig *config, HcfBlob *input,
+    HcfBlob *output)
 {
     int32_t ret;
     uint32_t len = 0;
@@ -400,11 +422,10 @@ static HcfResult CommonDoFinal(CipherData *data, HcfBlob *input, HcfBlob *output
         return res;
     }
     if (isUpdateInput) {
-        ret = OpensslEvpCipherUpdate(data->ctx, output->data, (int *)&output->len, input->data, input->len);
-        if (ret != HCF_OPENSSL_SUCCESS) {
-            HcfPrintOpensslError();
+        res = CipherParallelUpdate(data, config, input, output->data, (int *)&output->len);
+        if (res != HCF_SUCCESS) {
             LOGE("EVP_CipherUpdate failed!");
-            return HCF_ERR_CRYPTO_OPERATION;
+            return res;
         }
         len = output->len;
     }
@@ -599,7 +620,10 @@ static HcfResult EngineDoFinal(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfB
     if (cipherImpl->attr.mode == HCF_ALG_MODE_POLY1305) {
         ret = Poly1305DoFinal(data, input, output);
     } else {
-        ret = CommonDoFinal(data, input, output);
+        ret = CommonDoFinal(data, &cipherImpl->parallelConfig, input, output);
+    }
+    if (ret == HCF_SUCCESS) {
+        ret = PrependCipherAeadNonce(data, output);
     }
     FreeCipherData(&(cipherImpl->cipherData));
     if (ret != HCF_SUCCESS) {
@@ -645,11 +669,63 @@ static HcfResult GetChaCha20CipherSpecUint8Array(HcfCipherGeneratorSpi *self, Ci
 
 static HcfResult SetChaCha20CipherSpecUint8Array(HcfCipherGeneratorSpi *self, CipherSpecItem item, HcfBlob blob)
 {
-    (void)self;
-    (void)item;
-    (void)blob;
-    LOGE("unsupported cipher spec!");
-    return HCF_ERR_PARAMETER_CHECK_FAILED;
+    if ((self == NULL) || (!HcfIsClassMatch((HcfObjectBase *)self, GetChaCha20GeneratorClass()))) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    HcfCipherChaCha20GeneratorSpiOpensslImpl *cipherImpl = (HcfCipherChaCha20GeneratorSpiOpensslImpl *)self;
+    if (item != CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR) {
+        LOGE("unsupported cipher spec!");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (cipherImpl->attr.mode != HCF_ALG_MODE_POLY1305) {
+        LOGE("Nonce generation only support poly1305.");
+        return HCF_NOT_SUPPORT;
+    }
+    return SetCipherAeadNonceFixedField(&cipherImpl->nonceConfig, blob);
+}
+
+static HcfResult SetChaCha20CipherSpecInt(HcfCipherGeneratorSpi *self, CipherSpecItem item, int32_t value)
+{
+    if ((self == NULL) || (!HcfIsClassMatch((HcfObjectBase *)self, GetChaCha20GeneratorClass()))) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    HcfCipherChaCha20GeneratorSpiOpensslImpl *cipherImpl = (HcfCipherChaCha20GeneratorSpiOpensslImpl *)self;
+    if (item == CIPHER_AEAD_NONCE_MODE_INT) {
+        if (cipherImpl->attr.mode != HCF_ALG_MODE_POLY1305) {
+            LOGE("Nonce generation only support poly1305.");
+            return HCF_NOT_SUPPORT;
+        }
+        return SetCipherAeadNonceMode(&cipherImpl->nonceConfig, value);
+    }
+    if (cipherImpl->attr.mode == HCF_ALG_MODE_POLY1305) {
+        LOGE("Parallel update not support poly1305.");
+        return HCF_NOT_SUPPORT;
+    }
+    return SetCipherParallelConfig(&cipherImpl->parallelConfig, item, value);
+}
+
+static HcfResult GetChaCha20CipherSpecInt(HcfCipherGeneratorSpi *self, CipherSpecItem item, int32_t *returnInt)
+{
+    if ((self == NULL) || (!HcfIsClassMatch((HcfObjectBase *)self, GetChaCha20GeneratorClass()))) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    HcfCipherChaCha20GeneratorSpiOpensslImpl *cipherImpl = (HcfCipherChaCha20GeneratorSpiOpensslImpl *)self;
+    if (item == CIPHER_AEAD_NONCE_MODE_INT) {
+        if (cipherImpl->attr.mode != HCF_ALG_MODE_POLY1305) {
+            LOGE("Nonce generation only support poly1305.");
+            return HCF_NOT_SUPPORT;
+        }
+        *returnInt = cipherImpl->nonceConfig.mode;
+        return HCF_SUCCESS;
+    }
+    if (cipherImpl->attr.mode == HCF_ALG_MODE_POLY1305) {
+        LOGE("Parallel update not support poly1305.");
+        return HCF_NOT_SUPPORT;
+    }
+    return GetCipherParallelConfig(&cipherImpl->parallelConfig, item, returnInt);
 }
 
 HcfResult HcfCipherChaCha20GeneratorSpiCreate(CipherAttr *attr, HcfCipherGeneratorSpi **generator)
@@ -671,6 +747,8 @@ HcfResult HcfCipherChaCha20GeneratorSpiCreate(CipherAttr *attr, HcfCipherGenerat
     returnImpl->base.getCipherSpecString = GetChaCha20CipherSpecString;
     returnImpl->base.getCipherSpecUint8Array = GetChaCha20CipherSpecUint8Array;
     returnImpl->base.setCipherSpecUint8Array = SetChaCha20CipherSpecUint8Array;
+    returnImpl->base.setCipherSpecInt = SetChaCha20CipherSpecInt;
+    returnImpl->base.getCipherSpecInt = GetChaCha20CipherSpecInt;
     returnImpl->base.base.destroy = EngineChaCha20GeneratorDestroy;
     returnImpl->base.base.getClass = GetChaCha20GeneratorClass;
 
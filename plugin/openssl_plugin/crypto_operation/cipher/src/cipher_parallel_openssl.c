@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cipher_parallel_openssl.h"
+
+#include "securec.h"
+#include "hcf_parallel.h"
+#include "log.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+
+#define AES_CTR_BLOCK_SIZE 16
+#define CHACHA20_KEY_STREAM_BLOCK_SIZE 64
+#define COUNTER_LE32_LEN 4
+#define BITS_PER_BYTE 8
+#define BYTE_MASK 0xff
+
+typedef struct {
+    CipherData *data;
+    const uint8_t *in;
+    uint8_t *out;
+    /* counter block index of in[0] relative to the initial counter */
+    uint64_t firstBlock;
+    uint32_t blockSize;
+    uint32_t blockNum;
+    uint32_t taskNum;
+} CipherParallelCtrJob;
+
+typedef struct {
+    CipherData *data;
+    const uint8_t *in;
+    uint8_t *out;
+    uint64_t startDataUnit;
+    uint32_t dataUnitLen;
+    uint32_t unitNum;
+    uint32_t taskNum;
+} CipherParallelXtsJob;
+
+HcfResult SetCipherParallelConfig(CipherParallelConfig *config, CipherSpecItem item, int32_t value)
+{
+    if (config == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    switch (item) {
+        case CIPHER_PARALLEL_WORKER_NUM_INT:
+            if ((value < 0) || (value > HCF_PARALLEL_MAX_WORKER_NUM)) {
+                LOGE("Invalid parallel worker num %{public}d.", value);
+                return HCF_INVALID_PARAMS;
+            }
+            config->workerNum = (uint32_t)value;
+            return HCF_SUCCESS;
+        case CIPHER_PARALLEL_THRESHOLD_INT:
+            if (value <= 0) {
+                LOGE("Invalid parallel threshold %{public}d.", value);
+                return HCF_INVALID_PARAMS;
+            }
+            config->threshold = (uint32_t)value;
+            return HCF_SUCCESS;
+        default:
+            LOGE("Spec item not support.");
+            return HCF_INVALID_PARAMS;
+    }
+}
+
+HcfResult GetCipherParallelConfig(const CipherParallelConfig *config, CipherSpecItem item, int32_t *returnInt)
+{
+    if ((config == NULL) || (returnInt == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    switch (item) {
+        case CIPHER_PARALLEL_WORKER_NUM_INT:
+            *returnInt = (int32_t)config->workerNum;
+            return HCF_SUCCESS;
+        case CIPHER_PARALLEL_THRESHOLD_INT:
+            *returnInt = (config->threshold == 0) ? HCF_CIPHER_PARALLEL_DEFAULT_THRESHOLD : (int32_t)config->threshold;
+            return HCF_SUCCESS;
+        default:
+            LOGE("Spec item not support.");
+            return HCF_INVALID_PARAMS;
+    }
+}
+
+void InitCipherCounter(CipherData *data, CipherCounterType type, const unsigned char *iv)
+{
+    if ((data == NULL) || (iv == NULL)) {
+        return;
+    }
+    (void)memcpy_s(data->ctrIv, CIPHER_COUNTER_BLOCK_LEN, iv, CIPHER_COUNTER_BLOCK_LEN);
+    data->ctrType = type;
+    data->ctrOffset = 0;
+}
+
+static uint32_t GetCounterBlockSize(CipherCounterType type)
+{
+    return (type == CIPHER_COUNTER_LE32) ? CHACHA20_KEY_STREAM_BLOCK_SIZE : AES_CTR_BLOCK_SIZE;
+}
+
+/* Writes the counter block that encrypts block number blockIndex, false if the counter would wrap. */
+static bool SeekCounter(const CipherData *data, uint64_t blockIndex, unsigned char *iv)
+{
+    (void)memcpy_s(iv, CIPHER_COUNTER_BLOCK_LEN, data->ctrIv, CIPHER_COUNTER_BLOCK_LEN);
+    if (data->ctrType == CIPHER_COUNTER_BE128) {
+        uint64_t carry = blockIndex;
+        for (int32_t i = CIPHER_COUNTER_BLOCK_LEN - 1; (i >= 0) && (carry != 0); i--) {
+            carry += iv[i];
+            iv[i] = (unsigned char)(carry & BYTE_MASK);
+            carry >>= BITS_PER_BYTE;
+        }
+        return true;
+    }
+    uint64_t counter = 0;
+    for (int32_t i = COUNTER_LE32_LEN - 1; i >= 0; i--) {
+        counter = (counter << BITS_PER_BYTE) | iv[i];
+    }
+    if (blockIndex > UINT32_MAX - counter) {
+        return false;
+    }
+    counter += blockIndex;
+    for (int32_t i = 0; i < COUNTER_LE32_LEN; i++) {
+        iv[i] = (unsigned char)((counter >> (BITS_PER_BYTE * i)) & BYTE_MASK);
+    }
+    return true;
+}
+
+static HcfResult SerialUpdate(CipherData *data, const uint8_t *in, uint32_t inLen, uint8_t *out, int *outLen)
+{
+    if (OpensslEvpCipherUpdate(data->ctx, out, outLen, in, inLen) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("cipher update failed!");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (data->ctrType != CIPHER_COUNTER_NONE) {
+        data->ctrOffset += inLen;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult UpdateRemainder(CipherData *data, const uint8_t *in, uint32_t inLen, uint8_t *out)
+{
+    if (inLen == 0) {
+        return HCF_SUCCESS;
+    }
+    int len = 0;
+    return SerialUpdate(data, in, inLen, out, &len);
+}
+
+static void GetTaskRange(const CipherParallelCtrJob *job, uint32_t taskIndex, uint32_t *startBlock,
+    uint32_t *blockNum)
+{
+    uint32_t start = (uint32_t)(((uint64_t)job->blockNum * taskIndex) / job->taskNum);
+    uint32_t end = (uint32_t)(((uint64_t)job->blockNum * (taskIndex + 1)) / job->taskNum);
+    *startBlock = start;
+    *blockNum = end - start;
+}
+
+static HcfResult CtrSegmentTask(void *ctx, uint32_t taskIndex)
+{
+    CipherParallelCtrJob *job = (CipherParallelCtrJob *)ctx;
+    uint32_t startBlock = 0;
+    uint32_t blockNum = 0;
+    GetTaskRange(job, taskIndex, &startBlock, &blockNum);
+    unsigned char iv[CIPHER_COUNTER_BLOCK_LEN] = { 0 };
+    if (!SeekCounter(job->data, job->firstBlock + startBlock, iv)) {
+        LOGE("counter overflow!");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    EVP_CIPHER_CTX *segmentCtx = OpensslEvpCipherCtxNew();
+    if (segmentCtx == NULL) {
+        HcfPrintOpensslError();
+        LOGE("Failed to allocate segment ctx!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    size_t offset = (size_t)startBlock * job->blockSize;
+    int segmentLen = (int)(blockNum * job->blockSize);
+    int outLen = 0;
+    if ((OpensslEvpCipherCtxCopy(segmentCtx, job->data->ctx) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpCipherInit(segmentCtx, NULL, NULL, iv, -1) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpCipherUpdate(segmentCtx, job->out + offset, &outLen, job->in + offset,
+        segmentLen) != HCF_OPENSSL_SUCCESS) || (outLen != segmentLen)) {
+        HcfPrintOpensslError();
+        LOGE("segment update failed!");
+    } else {
+        ret = HCF_SUCCESS;
+    }
+    OpensslEvpCipherCtxFree(segmentCtx);
+    return ret;
+}
+
+static uint32_t GetTaskNum(const CipherData *data, const CipherParallelConfig *config, uint32_t inLen)
+{
+    uint32_t threshold = (config->threshold == 0) ? HCF_CIPHER_PARALLEL_DEFAULT_THRESHOLD : config->threshold;
+    if ((data->ctrType == CIPHER_COUNTER_NONE) || (config->workerNum <= 1) || (inLen < threshold)) {
+        return 0;
+    }
+    uint32_t taskNum = inLen / CIPHER_PARALLEL_MIN_SEGMENT_LEN;
+    return (taskNum < config->workerNum) ? taskNum : config->workerNum;
+}
+
+static HcfResult ParallelCtrUpdate(CipherData *data, uint32_t taskNum, uint32_t workerNum, const HcfBlob *input,
+    uint8_t *out)
+{
+    uint32_t blockSize = GetCounterBlockSize(data->ctrType);
+    uint32_t headLen = (uint32_t)((blockSize - data->ctrOffset % blockSize) % blockSize);
+    HcfResult ret = UpdateRemainder(data, input->data, headLen, out);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    CipherParallelCtrJob job = {
+        .data = data,
+        .in = input->data + headLen,
+        .out = out + headLen,
+        .firstBlock = data->ctrOffset / blockSize,
+        .blockSize = blockSize,
+        .blockNum = (input->len - headLen) / blockSize,
+        .taskNum = taskNum,
+    };
+    unsigned char nextIv[CIPHER_COUNTER_BLOCK_LEN] = { 0 };
+    if (!SeekCounter(data, job.firstBlock + job.blockNum, nextIv)) {
+        LOGD("counter would wrap, use the serial path.");
+        return UpdateRemainder(data, job.in, input->len - headLen, job.out);
+    }
+    ret = HcfParallelRun(taskNum, workerNum, CtrSegmentTask, &job);
+    if (ret != HCF_SUCCESS) {
+        LOGE("parallel update failed!");
+        return ret;
+    }
+    if (OpensslEvpCipherInit(data->ctx, NULL, NULL, nextIv, -1) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("Failed to move the counter!");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    uint32_t bodyLen = job.blockNum * blockSize;
+    data->ctrOffset += bodyLen;
+    return UpdateRemainder(data, job.in + bodyLen, input->len - headLen - bodyLen, job.out + bodyLen);
+}
+
+HcfResult CipherParallelUpdate(CipherData *data, const CipherParallelConfig *config, const HcfBlob *input,
+    uint8_t *out, int *outLen)
+{
+    if ((data == NULL) || (config == NULL) || (input == NULL) || (outLen == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    uint32_t taskNum = GetTaskNum(data, config, input->len);
+    if (taskNum <= 1) {
+        return SerialUpdate(data, input->data, input->len, out, outLen);
+    }
+    HcfResult ret = ParallelCtrUpdate(data, taskNum, config->workerNum, input, out);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    *outLen = (int)input->len;
+    return HCF_SUCCESS;
+}
+
+static void SetXtsTweak(uint64_t dataUnit, unsigned char *tweak)
+{
+    (void)memset_s(tweak, CIPHER_COUNTER_BLOCK_LEN, 0, CIPHER_COUNTER_BLOCK_LEN);
+    for (uint32_t i = 0; i < sizeof(dataUnit); i++) {
+        tweak[i] = (unsigned char)((dataUnit >> (BITS_PER_BYTE * i)) & BYTE_MASK);
+    }
+}
+
+static HcfResult XtsUpdateUnits(EVP_CIPHER_CTX *ctx, const CipherParallelXtsJob *job, uint32_t firstUnit,
+    uint32_t unitNum)
+{
+    unsigned char tweak[CIPHER_COUNTER_BLOCK_LEN] = { 0 };
+    for (uint32_t i = firstUnit; i < firstUnit + unitNum; i++) {
+        size_t offset = (size_t)i * job->dataUnitLen;
+        int outLen = 0;
+        SetXtsTweak(job->startDataUnit + i, tweak);
+        if ((OpensslEvpCipherInit(ctx, NULL, NULL, tweak, -1) != HCF_OPENSSL_SUCCESS) ||
+            (OpensslEvpCipherUpdate(ctx, job->out + offset, &outLen, job->in + offset,
+            (int)job->dataUnitLen) != HCF_OPENSSL_SUCCESS) || (outLen != (int)job->dataUnitLen)) {
+            HcfPrintOpensslError();
+            LOGE("xts data unit update failed!");
+            return HCF_ERR_CRYPTO_OPERATION;
+        }
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult XtsSegmentTask(void *ctx, uint32_t taskIndex)
+{
+    CipherParallelXtsJob *job = (CipherParallelXtsJob *)ctx;
+    uint32_t firstUnit = (uint32_t)(((uint64_t)job->unitNum * taskIndex) / job->taskNum);
+    uint32_t endUnit = (uint32_t)(((uint64_t)job->unitNum * (taskIndex + 1)) / job->taskNum);
+    EVP_CIPHER_CTX *segmentCtx = OpensslEvpCipherCtxNew();
+    if (segmentCtx == NULL) {
+        HcfPrintOpensslError();
+        LOGE("Failed to allocate segment ctx!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    if (OpensslEvpCipherCtxCopy(segmentCtx, job->data->ctx) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("Failed to copy cipher ctx!");
+    } else {
+        ret = XtsUpdateUnits(segmentCtx, job, firstUnit, endUnit - firstUnit);
+    }
+    OpensslEvpCipherCtxFree(segmentCtx);
+    return ret;
+}
+
+HcfResult CipherXtsDataUnitUpdate(CipherData *data, const CipherParallelConfig *config, uint64_t startDataUnit,
+    uint32_t dataUnitLen, const HcfBlob *input, uint8_t *out)
+{
+    if ((data == NULL) || (config == NULL) || (input == NULL) || (out == NULL) || (dataUnitLen == 0)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    CipherParallelXtsJob job = {
+        .data = data,
+        .in = input->data,
+        .out = out,
+        .startDataUnit = startDataUnit,
+        .dataUnitLen = dataUnitLen,
+        .unitNum = input->len / dataUnitLen,
+        .taskNum = 1,
+    };
+    uint32_t threshold = (config->threshold == 0) ? HCF_CIPHER_PARALLEL_DEFAULT_THRESHOLD : config->threshold;
+    if ((config->workerNum > 1) && (input->len >= threshold)) {
+        uint32_t segmentNum = input->len / CIPHER_PARALLEL_MIN_SEGMENT_LEN;
+        job.taskNum = (segmentNum < config->workerNum) ? segmentNum : config->workerNum;
+        job.taskNum = (job.unitNum < job.taskNum) ? job.unitNum : job.taskNum;
+    }
+    if (job.taskNum <= 1) {
+        return XtsUpdateUnits(data->ctx, &job, 0, job.unitNum);
+    }
+    return HcfParallelRun(job.taskNum, config->workerNum, XtsSegmentTask, &job);
+}
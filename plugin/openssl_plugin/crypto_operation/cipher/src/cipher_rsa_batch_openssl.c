@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cipher_rsa_batch_openssl.h"
+
+#include <securec.h>
+
+#include "hcf_parallel.h"
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+#include "utils.h"
+
+typedef struct {
+    const EVP_PKEY_CTX *ctx;
+    enum HcfCryptoMode opMode;
+    const HcfBlob *label;
+    const HcfBlob *inputs;
+    HcfBlob *outputs;
+    uint8_t *arena;
+    size_t slotLen;
+    uint32_t count;
+    uint32_t rangeNum;
+} RsaCipherBatchCtx;
+
+/* Range taskIndex of the batch, the ranges differ in size by at most one entry. */
+static void GetRsaCipherBatchRange(const RsaCipherBatchCtx *batch, uint32_t taskIndex, uint32_t *start,
+    uint32_t *end)
+{
+    *start = (uint32_t)((uint64_t)batch->count * taskIndex / batch->rangeNum);
+    *end = (uint32_t)((uint64_t)batch->count * (taskIndex + 1) / batch->rangeNum);
+}
+
+static HcfResult SetRsaCipherBatchLabel(EVP_PKEY_CTX *ctx, const HcfBlob *label)
+{
+    // OpenSSL takes over the label and frees it with the context.
+    uint8_t *labelCopy = (uint8_t *)HcfMalloc(label->len, 0);
+    if (labelCopy == NULL) {
+        LOGE("Failed to allocate label memory!");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(labelCopy, label->len, label->data, label->len);
+    if (OpensslEvpPkeyCtxSet0RsaOaepLabel(ctx, labelCopy, (int)label->len) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("Failed to set OAEP label.");
+        HcfFree(labelCopy);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult RsaCipherBatchRange(void *arg, uint32_t taskIndex)
+{
+    const RsaCipherBatchCtx *batch = (const RsaCipherBatchCtx *)arg;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    GetRsaCipherBatchRange(batch, taskIndex, &start, &end);
+    // The padding and digests are copied with the context, so the key is not prepared again per worker.
+    EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxDup(batch->ctx);
+    if (ctx == NULL) {
+        HcfPrintOpensslError();
+        LOGE("EVP_PKEY_CTX_dup failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = (batch->label != NULL) ? SetRsaCipherBatchLabel(ctx, batch->label) : HCF_SUCCESS;
+    for (uint32_t i = start; (ret == HCF_SUCCESS) && (i < end); i++) {
+        uint8_t *out = batch->arena + (size_t)i * batch->slotLen;
+        size_t outLen = batch->slotLen;
+        int32_t sslRet = (batch->opMode == ENCRYPT_MODE) ?
+            OpensslEvpPkeyEncrypt(ctx, out, &outLen, batch->inputs[i].data, batch->inputs[i].len) :
+            OpensslEvpPkeyDecrypt(ctx, out, &outLen, batch->inputs[i].data, batch->inputs[i].len);
+        if (sslRet != HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("RSA batch failed at input %{public}u.", i);
+            ret = HCF_ERR_CRYPTO_OPERATION;
+            break;
+        }
+        batch->outputs[i].data = out;
+        batch->outputs[i].len = outLen;
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult RunRsaCipherBatch(RsaCipherBatchCtx *batch, uint32_t workerNum)
+{
+    if (workerNum <= 1) {
+        batch->rangeNum = 1;
+        return RsaCipherBatchRange(batch, 0);
+    }
+    batch->rangeNum = (workerNum < batch->count) ? workerNum : batch->count;
+    return HcfParallelRun(batch->rangeNum, batch->rangeNum, RsaCipherBatchRange, batch);
+}
+
+HcfResult HcfRsaCipherBatchOpenssl(const EVP_PKEY_CTX *ctx, enum HcfCryptoMode opMode, const HcfBlob *label,
+    size_t slotLen, const HcfBlob *inputs, uint32_t count, uint32_t workerNum, HcfBlob *returnArena,
+    HcfBlob *returnOutputs)
+{
+    if ((ctx == NULL) || ((opMode != ENCRYPT_MODE) && (opMode != DECRYPT_MODE)) || (slotLen == 0) ||
+        ((label != NULL) && !HcfIsBlobValid(label)) || (inputs == NULL) || (count == 0) || (returnArena == NULL) ||
+        (returnOutputs == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (slotLen > UINT32_MAX / count) {
+        LOGE("Batch is too large.");
+        return HCF_INVALID_PARAMS;
+    }
+    RsaCipherBatchCtx batch = {
+        .ctx = ctx,
+        .opMode = opMode,
+        .label = label,
+        .inputs = inputs,
+        .outputs = returnOutputs,
+        .slotLen = slotLen,
+        .count = count,
+    };
+    uint32_t arenaLen = (uint32_t)slotLen * count;
+    batch.arena = (uint8_t *)HcfMalloc(arenaLen, 0);
+    if (batch.arena == NULL) {
+        LOGE("Failed to allocate arena memory!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = RunRsaCipherBatch(&batch, workerNum);
+    if (ret != HCF_SUCCESS) {
+        // Decrypted slots may hold unwrapped keys.
+        (void)memset_s(batch.arena, arenaLen, 0, arenaLen);
+        HcfFree(batch.arena);
+        (void)memset_s(returnOutputs, sizeof(HcfBlob) * count, 0, sizeof(HcfBlob) * count);
+        return ret;
+    }
+    returnArena->data = batch.arena;
+    returnArena->len = arenaLen;
+    return HCF_SUCCESS;
+}
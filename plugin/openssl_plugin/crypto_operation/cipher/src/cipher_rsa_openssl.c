@@ -15,6 +15,7 @@
 
 #include "cipher_rsa_openssl.h"
 #include "securec.h"
+#include "cipher_rsa_batch_openssl.h"
 #include "openssl/rsa.h"
 #include "rsa_openssl_common.h"
 #include "log.h"
@@ -37,6 +38,9 @@ typedef struct {
 
     EVP_PKEY_CTX *ctx;
 
+    /* RSA of the key ctx was prepared for, referenced so that it stays a valid identity for re-init */
+    RSA *ctxRsa;
+
     HcfBlob pSource;
 } HcfCipherRsaGeneratorSpiImpl;
 
@@ -63,6 +67,11 @@ static HcfResult CheckCipherInitParams(enum HcfCryptoMode opMode, HcfKey *key)
     return HCF_SUCCESS;
 }
 
+static RSA *GetRsaFromKey(HcfKey *key, enum HcfCryptoMode opMode)
+{
+    return (opMode == ENCRYPT_MODE) ? ((HcfOpensslRsaPubKey *)key)->pk : ((HcfOpensslRsaPriKey *)key)->sk;
+}
+
 static HcfResult DuplicateRsaFromKey(HcfKey *key, enum HcfCryptoMode opMode, RSA **dupRsa)
 {
     HcfResult ret = HCF_SUCCESS;
@@ -155,32 +164,40 @@ static HcfResult SetPsourceFromBlob(HcfBlob pSource, EVP_PKEY_CTX *ctx)
     return HCF_SUCCESS;
 }
 
-// all parmas have been checked in CheckRsaCipherParams, this function does not need check.
-static HcfResult SetDetailParams(HcfCipherRsaGeneratorSpiImpl *impl)
+static HcfResult SetPaddingParams(EVP_PKEY_CTX *ctx, const CipherAttr *attr)
 {
-    CipherAttr attr = impl->attr;
     int32_t opensslPadding = 0;
-    (void)GetOpensslPadding(attr.paddingMode, &opensslPadding);
-    if (OpensslEvpPkeyCtxSetRsaPadding(impl->ctx, opensslPadding) != HCF_OPENSSL_SUCCESS) {
+    (void)GetOpensslPadding(attr->paddingMode, &opensslPadding);
+    if (OpensslEvpPkeyCtxSetRsaPadding(ctx, opensslPadding) != HCF_OPENSSL_SUCCESS) {
         LOGE("Cipher set padding fail.");
         HcfPrintOpensslError();
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    if (attr.paddingMode != HCF_OPENSSL_RSA_PKCS1_OAEP_PADDING) {
+    if (attr->paddingMode != HCF_OPENSSL_RSA_PKCS1_OAEP_PADDING) {
         return HCF_SUCCESS;
     }
     // pkcs oaep
     EVP_MD *md = NULL;
     EVP_MD *mgf1md = NULL;
-    (void)GetOpensslDigestAlg(attr.md, &md);
-    (void)GetOpensslDigestAlg(attr.mgf1md, &mgf1md);
+    (void)GetOpensslDigestAlg(attr->md, &md);
+    (void)GetOpensslDigestAlg(attr->mgf1md, &mgf1md);
     // set md and mgf1md
-    if (OpensslEvpPkeyCtxSetRsaOaepMd(impl->ctx, md) != HCF_OPENSSL_SUCCESS ||
-        OpensslEvpPkeyCtxSetRsaMgf1Md(impl->ctx, mgf1md) != HCF_OPENSSL_SUCCESS) {
+    if (OpensslEvpPkeyCtxSetRsaOaepMd(ctx, md) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpPkeyCtxSetRsaMgf1Md(ctx, mgf1md) != HCF_OPENSSL_SUCCESS) {
         LOGE("Set md or mgf1md fail");
         HcfPrintOpensslError();
         return HCF_ERR_CRYPTO_OPERATION;
     }
+    return HCF_SUCCESS;
+}
+
+// all parmas have been checked in CheckRsaCipherParams, this function does not need check.
+static HcfResult SetDetailParams(HcfCipherRsaGeneratorSpiImpl *impl)
+{
+    HcfResult ret = SetPaddingParams(impl->ctx, &impl->attr);
+    if ((ret != HCF_SUCCESS) || (impl->attr.paddingMode != HCF_OPENSSL_RSA_PKCS1_OAEP_PADDING)) {
+        return ret;
+    }
     // default EVP pSource is NULL, need not set.
     if (impl->pSource.data != NULL && impl->pSource.len > 0) {
         HcfResult ret = SetPsourceFromBlob(impl->pSource, impl->ctx);
@@ -324,6 +341,15 @@ static HcfResult GetRsaCipherSpecString(HcfCipherGeneratorSpi *self, CipherSpecI
     return ret;
 }
 
+static void ClearRsaCipherCtx(HcfCipherRsaGeneratorSpiImpl *impl)
+{
+    impl->initFlag = UNINITIALIZED;
+    OpensslEvpPkeyCtxFree(impl->ctx);
+    impl->ctx = NULL;
+    OpensslRsaFree(impl->ctxRsa);
+    impl->ctxRsa = NULL;
+}
+
 static HcfResult EngineInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMode opMode,
     HcfKey *key, HcfParamsSpec *params)
 {
@@ -337,16 +363,19 @@ static HcfResult EngineInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMode opMo
         return HCF_INVALID_PARAMS;
     }
     HcfCipherRsaGeneratorSpiImpl *impl = (HcfCipherRsaGeneratorSpiImpl *)self;
-    if (impl->initFlag != UNINITIALIZED) {
-        LOGE("The cipher has been initialize, don't init again.");
-        return HCF_INVALID_PARAMS;
-    }
 
     // check opMode is matched with Key
     if (CheckCipherInitParams(opMode, key) != HCF_SUCCESS) {
         LOGE("OpMode dismatch with keyType.");
         return HCF_INVALID_PARAMS;
     }
+    // The prepared context of the same key and mode already carries the padding and label, keep it.
+    RSA *keyRsa = GetRsaFromKey(key, opMode);
+    if ((impl->initFlag == INITIALIZED) && (impl->ctxRsa == keyRsa) &&
+        ((int32_t)impl->attr.mode == (int32_t)opMode)) {
+        return HCF_SUCCESS;
+    }
+    ClearRsaCipherCtx(impl);
     impl->attr.mode = (int32_t)opMode;
     if (InitEvpPkeyCtx(impl, key, opMode) != HCF_SUCCESS) {
         LOGE("Failed to initialize EVP_PKEY context.");
@@ -359,6 +388,9 @@ static HcfResult EngineInit(HcfCipherGeneratorSpi *self, enum HcfCryptoMode opMo
         LOGE("Failed to set detailed RSA cipher parameters.");
         return HCF_ERR_CRYPTO_OPERATION;
     }
+    if (OpensslRsaUpRef(keyRsa) == HCF_OPENSSL_SUCCESS) {
+        impl->ctxRsa = keyRsa;
+    }
     impl->initFlag = INITIALIZED;
     return HCF_SUCCESS;
 }
@@ -431,6 +463,75 @@ static HcfResult EngineDoFinal(HcfCipherGeneratorSpi *self, HcfBlob *input, HcfB
     return HCF_SUCCESS;
 }
 
+static bool HasOaepLabel(const HcfCipherRsaGeneratorSpiImpl *impl)
+{
+    return (impl->attr.paddingMode == HCF_OPENSSL_RSA_PKCS1_OAEP_PADDING) && (impl->pSource.data != NULL) &&
+        (impl->pSource.len > 0);
+}
+
+/* Copies of a context share its OAEP label, so a labelled batch starts from a context without one on the same key. */
+static HcfResult NewUnlabelledCtx(HcfCipherRsaGeneratorSpiImpl *impl, EVP_PKEY_CTX **returnCtx)
+{
+    EVP_PKEY *pkey = OpensslEvpPkeyCtxGet0Pkey(impl->ctx);
+    EVP_PKEY_CTX *ctx = (pkey == NULL) ? NULL : OpensslEvpPkeyCtxNew(pkey, NULL);
+    if (ctx == NULL) {
+        LOGE("Failed to create EVP_PKEY context.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    int32_t sslRet = ((int32_t)impl->attr.mode == (int32_t)ENCRYPT_MODE) ? OpensslEvpPkeyEncryptInit(ctx) :
+        OpensslEvpPkeyDecryptInit(ctx);
+    if (sslRet != HCF_OPENSSL_SUCCESS) {
+        LOGE("Init EVP_PKEY fail");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (SetPaddingParams(ctx, &impl->attr) != HCF_SUCCESS) {
+        OpensslEvpPkeyCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnCtx = ctx;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineDoFinalBatch(HcfCipherGeneratorSpi *self, const HcfBlob *inputs, uint32_t count,
+    uint32_t workerNum, HcfBlob *returnArena, HcfBlob *returnOutputs)
+{
+    if ((self == NULL) || (inputs == NULL) || (count == 0) || (returnArena == NULL) || (returnOutputs == NULL)) {
+        LOGE("Param is invalid.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, EngineGetClass())) {
+        LOGE("Class not match");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipherRsaGeneratorSpiImpl *impl = (HcfCipherRsaGeneratorSpiImpl *)self;
+    if (impl->initFlag != INITIALIZED) {
+        LOGE("RSACipher has not been init");
+        return HCF_INVALID_PARAMS;
+    }
+    // The output never exceeds the modulus size, which the length query returns for any input.
+    HcfBlob slot = { .data = NULL, .len = 0 };
+    if (DoRsaCrypt(impl->ctx, (HcfBlob *)&inputs[0], &slot, impl->attr.mode) != HCF_SUCCESS) {
+        LOGE("Failed to get output length.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (!HasOaepLabel(impl)) {
+        return HcfRsaCipherBatchOpenssl(impl->ctx, (enum HcfCryptoMode)impl->attr.mode, NULL, slot.len, inputs,
+            count, workerNum, returnArena, returnOutputs);
+    }
+    EVP_PKEY_CTX *ctx = NULL;
+    HcfResult ret = NewUnlabelledCtx(impl, &ctx);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = HcfRsaCipherBatchOpenssl(ctx, (enum HcfCryptoMode)impl->attr.mode, &impl->pSource, slot.len, inputs,
+        count, workerNum, returnArena, returnOutputs);
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
 static void EngineDestroySpiImpl(HcfObjectBase *generator)
 {
     if (generator == NULL) {
@@ -441,8 +542,7 @@ static void EngineDestroySpiImpl(HcfObjectBase *generator)
         return;
     }
     HcfCipherRsaGeneratorSpiImpl *impl = (HcfCipherRsaGeneratorSpiImpl *)generator;
-    OpensslEvpPkeyCtxFree(impl->ctx);
-    impl->ctx = NULL;
+    ClearRsaCipherCtx(impl);
     HcfFree(impl->pSource.data);
     impl->pSource.data = NULL;
     HcfFree(impl);
@@ -511,6 +611,7 @@ HcfResult HcfCipherRsaCipherSpiCreate(CipherAttr *params, HcfCipherGeneratorSpi
     returnImpl->super.init = EngineInit;
     returnImpl->super.update = EngineUpdate;
     returnImpl->super.doFinal = EngineDoFinal;
+    returnImpl->super.doFinalBatch = EngineDoFinalBatch;
     returnImpl->super.setCipherSpecUint8Array = SetRsaCipherSpecUint8Array;
     returnImpl->super.getCipherSpecString = GetRsaCipherSpecString;
     returnImpl->super.getCipherSpecUint8Array = GetRsaCipherSpecUint8Array;
@@ -25,6 +25,7 @@
 #include "openssl_adapter.h"
 #include "openssl_common.h"
 #include "openssl_class.h"
+#include "sm4_simd_openssl.h"
 
 #define MAX_AAD_LEN 2048
 #define SM4_BLOCK_SIZE 16
@@ -53,7 +54,7 @@ static const EVP_CIPHER *CipherEcbType(SymKeyImpl *symKey)
 {
     switch (symKey->keyMaterial.len) {
         case SM4_SIZE_128:
-            return OpensslEvpSm4Ecb();
+            return (Sm4SimdEcbCipher() != NULL) ? Sm4SimdEcbCipher() : OpensslEvpSm4Ecb();
         default:
             break;
     }
@@ -77,7 +78,7 @@ static const EVP_CIPHER *CipherCtrType(SymKeyImpl *symKey)
 {
     switch (symKey->keyMaterial.len) {
         case SM4_SIZE_128:
-            return OpensslEvpSm4Ctr();
+            return (Sm4SimdCtrCipher() != NULL) ? Sm4SimdCtrCipher() : OpensslEvpSm4Ctr();
         default:
             break;
     }
@@ -123,7 +124,10 @@ static const EVP_CIPHER *CipherCfb128Type(SymKeyImpl *symKey)
 
 static const EVP_CIPHER *CipherGcmType(SymKeyImpl *symKey)
 {
-    (void)symKey;
+    /* the fast cipher is a static method table, the OpensslEvpCipherFree after init leaves it alone */
+    if ((symKey->keyMaterial.len == SM4_SIZE_128) && (Sm4SimdGcmCipher() != NULL)) {
+        return Sm4SimdGcmCipher();
+    }
     return (const EVP_CIPHER *)OpensslEvpCipherFetch(NULL, "SM4-GCM", NULL);
 }
 
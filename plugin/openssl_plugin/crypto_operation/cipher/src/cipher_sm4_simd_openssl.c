@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sm4_simd_openssl.h"
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include "securec.h"
+#include "log.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+#include "sm4_simd.h"
+
+#define SM4_SIMD_GCM_IV_LEN 12
+#define SM4_SIMD_GCM_IV_MAX_LEN 128
+#define SM4_SIMD_GCM_TAG_LEN 16
+#define SM4_SIMD_STREAM_BLOCK_SIZE 1
+
+typedef struct {
+    Sm4SimdKey key;
+    GCM128_CONTEXT *gcm;
+    uint8_t iv[SM4_SIMD_GCM_IV_MAX_LEN];
+    int ivLen;
+    uint8_t tag[SM4_SIMD_GCM_TAG_LEN];
+    /* -1 until a tag is computed or set */
+    int tagLen;
+    bool keySet;
+    bool ivSet;
+    bool enc;
+} Sm4SimdGcmCtx;
+
+static EVP_CIPHER *g_sm4SimdEcb = NULL;
+static EVP_CIPHER *g_sm4SimdCtr = NULL;
+static EVP_CIPHER *g_sm4SimdGcm = NULL;
+static pthread_once_t g_sm4SimdCipherOnce = PTHREAD_ONCE_INIT;
+
+static int Sm4SimdEcbInit(EVP_CIPHER_CTX *ctx, const unsigned char *key, const unsigned char *iv, int enc)
+{
+    (void)iv;
+    Sm4SimdSetKey(key, enc == 0, (Sm4SimdKey *)OpensslEvpCipherCtxGetCipherData(ctx));
+    return HCF_OPENSSL_SUCCESS;
+}
+
+static int Sm4SimdEcbDoCipher(EVP_CIPHER_CTX *ctx, unsigned char *out, const unsigned char *in, size_t inl)
+{
+    /* EVP only hands whole blocks to ECB ciphers and keeps the padding to itself */
+    Sm4SimdCryptBlocks(in, out, inl / SM4_SIMD_BLOCK_SIZE, (const Sm4SimdKey *)OpensslEvpCipherCtxGetCipherData(ctx));
+    return HCF_OPENSSL_SUCCESS;
+}
+
+static int Sm4SimdCtrInit(EVP_CIPHER_CTX *ctx, const unsigned char *key, const unsigned char *iv, int enc)
+{
+    (void)iv;
+    (void)enc;
+    Sm4SimdSetKey(key, false, (Sm4SimdKey *)OpensslEvpCipherCtxGetCipherData(ctx));
+    return HCF_OPENSSL_SUCCESS;
+}
+
+static int Sm4SimdCtrDoCipher(EVP_CIPHER_CTX *ctx, unsigned char *out, const unsigned char *in, size_t inl)
+{
+    int num = OpensslEvpCipherCtxGetNum(ctx);
+    if (num < 0) {
+        return 0;
+    }
+    /* ctx->num and ctx->buf keep the unused key stream of a partial block between updates */
+    unsigned int used = (unsigned int)num;
+    OpensslCryptoCtr128EncryptCtr32(in, out, inl, OpensslEvpCipherCtxGetCipherData(ctx),
+        OpensslEvpCipherCtxIvNoconst(ctx), OpensslEvpCipherCtxBufNoconst(ctx), &used, Sm4SimdCtr32EncryptBlocks);
+    return OpensslEvpCipherCtxSetNum(ctx, (int)used);
+}
+
+static int Sm4SimdGcmInit(EVP_CIPHER_CTX *ctx, const unsigned char *key, const unsigned char *iv, int enc)
+{
+    Sm4SimdGcmCtx *gctx = (Sm4SimdGcmCtx *)OpensslEvpCipherCtxGetCipherData(ctx);
+    gctx->enc = (enc != 0);
+    if (key != NULL) {
+        Sm4SimdSetKey(key, false, &gctx->key);
+        /* the hash key is derived when the gcm context is created, so a new key needs a new context */
+        OpensslCryptoGcm128Release(gctx->gcm);
+        gctx->gcm = OpensslCryptoGcm128New(&gctx->key, Sm4SimdEncryptBlock);
+        if (gctx->gcm == NULL) {
+            LOGE("Failed to create gcm context.");
+            gctx->keySet = false;
+            return 0;
+        }
+        gctx->keySet = true;
+        if (iv == NULL && gctx->ivSet) {
+            iv = gctx->iv;
+        }
+    }
+    if (iv != NULL) {
+        if (iv != gctx->iv) {
+            (void)memcpy_s(gctx->iv, sizeof(gctx->iv), iv, gctx->ivLen);
+        }
+        gctx->ivSet = true;
+    }
+    if (gctx->keySet && gctx->ivSet) {
+        OpensslCryptoGcm128Setiv(gctx->gcm, gctx->iv, gctx->ivLen);
+    }
+    return HCF_OPENSSL_SUCCESS;
+}
+
+static int Sm4SimdGcmFinal(Sm4SimdGcmCtx *gctx)
+{
+    gctx->ivSet = false;
+    if (gctx->enc) {
+        OpensslCryptoGcm128Tag(gctx->gcm, gctx->tag, SM4_SIMD_GCM_TAG_LEN);
+        gctx->tagLen = SM4_SIMD_GCM_TAG_LEN;
+        return 0;
+    }
+    if (gctx->tagLen < 0 || OpensslCryptoGcm128Finish(gctx->gcm, gctx->tag, gctx->tagLen) != 0) {
+        LOGE("Gcm tag check failed.");
+        return -1;
+    }
+    return 0;
+}
+
+/* Custom cipher contract: out == NULL feeds AAD, in == NULL finishes, the return value is the output length. */
+static int Sm4SimdGcmDoCipher(EVP_CIPHER_CTX *ctx, unsigned char *out, const unsigned char *in, size_t inl)
+{
+    Sm4SimdGcmCtx *gctx = (Sm4SimdGcmCtx *)OpensslEvpCipherCtxGetCipherData(ctx);
+    if (!gctx->keySet || !gctx->ivSet || inl > INT_MAX) {
+        return -1;
+    }
+    if (in == NULL) {
+        /* an absent AAD is passed with both buffers NULL and is not a final call */
+        return (out == NULL) ? 0 : Sm4SimdGcmFinal(gctx);
+    }
+    int ret;
+    if (out == NULL) {
+        ret = OpensslCryptoGcm128Aad(gctx->gcm, in, inl);
+    } else if (gctx->enc) {
+        ret = OpensslCryptoGcm128EncryptCtr32(gctx->gcm, in, out, inl, Sm4SimdCtr32EncryptBlocks);
+    } else {
+        ret = OpensslCryptoGcm128DecryptCtr32(gctx->gcm, in, out, inl, Sm4SimdCtr32EncryptBlocks);
+    }
+    return (ret == 0) ? (int)inl : -1;
+}
+
+static int Sm4SimdGcmCtrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+    Sm4SimdGcmCtx *gctx = (Sm4SimdGcmCtx *)OpensslEvpCipherCtxGetCipherData(ctx);
+    switch (type) {
+        case EVP_CTRL_INIT:
+            gctx->ivLen = SM4_SIMD_GCM_IV_LEN;
+            gctx->tagLen = -1;
+            return HCF_OPENSSL_SUCCESS;
+        case EVP_CTRL_AEAD_SET_IVLEN:
+            if (arg <= 0 || arg > SM4_SIMD_GCM_IV_MAX_LEN) {
+                return 0;
+            }
+            gctx->ivLen = arg;
+            return HCF_OPENSSL_SUCCESS;
+        case EVP_CTRL_AEAD_SET_TAG:
+            if (arg <= 0 || arg > SM4_SIMD_GCM_TAG_LEN || gctx->enc || ptr == NULL) {
+                return 0;
+            }
+            (void)memcpy_s(gctx->tag, sizeof(gctx->tag), ptr, arg);
+            gctx->tagLen = arg;
+            return HCF_OPENSSL_SUCCESS;
+        case EVP_CTRL_AEAD_GET_TAG:
+            if (arg <= 0 || arg > gctx->tagLen || !gctx->enc || ptr == NULL) {
+                return 0;
+            }
+            (void)memcpy_s(ptr, arg, gctx->tag, arg);
+            return HCF_OPENSSL_SUCCESS;
+        case EVP_CTRL_COPY:
+            /* the GHASH state cannot be duplicated, keep the copy from sharing it */
+            ((Sm4SimdGcmCtx *)OpensslEvpCipherCtxGetCipherData((EVP_CIPHER_CTX *)ptr))->gcm = NULL;
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+static int Sm4SimdGcmCleanup(EVP_CIPHER_CTX *ctx)
+{
+    Sm4SimdGcmCtx *gctx = (Sm4SimdGcmCtx *)OpensslEvpCipherCtxGetCipherData(ctx);
+    if (gctx != NULL) {
+        OpensslCryptoGcm128Release(gctx->gcm);
+        gctx->gcm = NULL;
+    }
+    return HCF_OPENSSL_SUCCESS;
+}
+
+static EVP_CIPHER *NewSm4SimdCipher(int blockSize, int ivLen, unsigned long flags, int ctxSize)
+{
+    EVP_CIPHER *cipher = OpensslEvpCipherMethNew(NID_undef, blockSize, SM4_SIMD_KEY_SIZE);
+    if (cipher == NULL) {
+        return NULL;
+    }
+    if (OpensslEvpCipherMethSetIvLength(cipher, ivLen) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetFlags(cipher, flags) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetImplCtxSize(cipher, ctxSize) != HCF_OPENSSL_SUCCESS) {
+        OpensslEvpCipherMethFree(cipher);
+        return NULL;
+    }
+    return cipher;
+}
+
+static EVP_CIPHER *CreateSm4SimdEcb(void)
+{
+    EVP_CIPHER *cipher = NewSm4SimdCipher(SM4_SIMD_BLOCK_SIZE, 0, EVP_CIPH_ECB_MODE, sizeof(Sm4SimdKey));
+    if (cipher == NULL) {
+        return NULL;
+    }
+    if (OpensslEvpCipherMethSetInit(cipher, Sm4SimdEcbInit) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetDoCipher(cipher, Sm4SimdEcbDoCipher) != HCF_OPENSSL_SUCCESS) {
+        OpensslEvpCipherMethFree(cipher);
+        return NULL;
+    }
+    return cipher;
+}
+
+static EVP_CIPHER *CreateSm4SimdCtr(void)
+{
+    EVP_CIPHER *cipher = NewSm4SimdCipher(SM4_SIMD_STREAM_BLOCK_SIZE, SM4_SIMD_BLOCK_SIZE, EVP_CIPH_CTR_MODE,
+        sizeof(Sm4SimdKey));
+    if (cipher == NULL) {
+        return NULL;
+    }
+    if (OpensslEvpCipherMethSetInit(cipher, Sm4SimdCtrInit) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetDoCipher(cipher, Sm4SimdCtrDoCipher) != HCF_OPENSSL_SUCCESS) {
+        OpensslEvpCipherMethFree(cipher);
+        return NULL;
+    }
+    return cipher;
+}
+
+static EVP_CIPHER *CreateSm4SimdGcm(void)
+{
+    unsigned long flags = EVP_CIPH_GCM_MODE | EVP_CIPH_FLAG_CUSTOM_CIPHER | EVP_CIPH_FLAG_AEAD_CIPHER |
+        EVP_CIPH_CUSTOM_IV | EVP_CIPH_ALWAYS_CALL_INIT | EVP_CIPH_CTRL_INIT | EVP_CIPH_CUSTOM_COPY;
+    EVP_CIPHER *cipher = NewSm4SimdCipher(SM4_SIMD_STREAM_BLOCK_SIZE, SM4_SIMD_GCM_IV_LEN, flags,
+        sizeof(Sm4SimdGcmCtx));
+    if (cipher == NULL) {
+        return NULL;
+    }
+    if (OpensslEvpCipherMethSetInit(cipher, Sm4SimdGcmInit) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetDoCipher(cipher, Sm4SimdGcmDoCipher) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetCtrl(cipher, Sm4SimdGcmCtrl) != HCF_OPENSSL_SUCCESS ||
+        OpensslEvpCipherMethSetCleanup(cipher, Sm4SimdGcmCleanup) != HCF_OPENSSL_SUCCESS) {
+        OpensslEvpCipherMethFree(cipher);
+        return NULL;
+    }
+    return cipher;
+}
+
+static void CreateSm4SimdCiphers(void)
+{
+    if (!Sm4SimdIsSupported()) {
+        return;
+    }
+    g_sm4SimdEcb = CreateSm4SimdEcb();
+    g_sm4SimdCtr = CreateSm4SimdCtr();
+    g_sm4SimdGcm = CreateSm4SimdGcm();
+    if (g_sm4SimdEcb == NULL || g_sm4SimdCtr == NULL || g_sm4SimdGcm == NULL) {
+        LOGW("Some sm4 simd ciphers are unavailable, the openssl ones are used instead.");
+    }
+}
+
+const EVP_CIPHER *Sm4SimdEcbCipher(void)
+{
+    (void)pthread_once(&g_sm4SimdCipherOnce, CreateSm4SimdCiphers);
+    return g_sm4SimdEcb;
+}
+
+const EVP_CIPHER *Sm4SimdCtrCipher(void)
+{
+    (void)pthread_once(&g_sm4SimdCipherOnce, CreateSm4SimdCiphers);
+    return g_sm4SimdCtr;
+}
+
+const EVP_CIPHER *Sm4SimdGcmCipher(void)
+{
+    (void)pthread_once(&g_sm4SimdCipherOnce, CreateSm4SimdCiphers);
+    return g_sm4SimdGcm;
+}
@@ -0,0 +1,422 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sm4_simd.h"
+
+#include <pthread.h>
+#include "securec.h"
+
+#ifdef HCF_SM4_SIMD_X86
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define SM4_SIMD_TARGET __attribute__((target("sse2,ssse3,aes")))
+#endif
+
+#define SM4_WORD_NUM 4
+#define SM4_WORD_SIZE 4
+#define SM4_LANE_NUM 4
+#define SM4_WIDE_BLOCK_NUM 8
+#define SM4_NIBBLE_SHIFT 4
+#define SM4_WORD_BITS 32
+#define SM4_BYTE_MASK 0xff
+
+static const uint8_t g_sm4Sbox[] = {
+    0xd6, 0x90, 0xe9, 0xfe, 0xcc, 0xe1, 0x3d, 0xb7, 0x16, 0xb6, 0x14, 0xc2, 0x28, 0xfb, 0x2c, 0x05,
+    0x2b, 0x67, 0x9a, 0x76, 0x2a, 0xbe, 0x04, 0xc3, 0xaa, 0x44, 0x13, 0x26, 0x49, 0x86, 0x06, 0x99,
+    0x9c, 0x42, 0x50, 0xf4, 0x91, 0xef, 0x98, 0x7a, 0x33, 0x54, 0x0b, 0x43, 0xed, 0xcf, 0xac, 0x62,
+    0xe4, 0xb3, 0x1c, 0xa9, 0xc9, 0x08, 0xe8, 0x95, 0x80, 0xdf, 0x94, 0xfa, 0x75, 0x8f, 0x3f, 0xa6,
+    0x47, 0x07, 0xa7, 0xfc, 0xf3, 0x73, 0x17, 0xba, 0x83, 0x59, 0x3c, 0x19, 0xe6, 0x85, 0x4f, 0xa8,
+    0x68, 0x6b, 0x81, 0xb2, 0x71, 0x64, 0xda, 0x8b, 0xf8, 0xeb, 0x0f, 0x4b, 0x70, 0x56, 0x9d, 0x35,
+    0x1e, 0x24, 0x0e, 0x5e, 0x63, 0x58, 0xd1, 0xa2, 0x25, 0x22, 0x7c, 0x3b, 0x01, 0x21, 0x78, 0x87,
+    0xd4, 0x00, 0x46, 0x57, 0x9f, 0xd3, 0x27, 0x52, 0x4c, 0x36, 0x02, 0xe7, 0xa0, 0xc4, 0xc8, 0x9e,
+    0xea, 0xbf, 0x8a, 0xd2, 0x40, 0xc7, 0x38, 0xb5, 0xa3, 0xf7, 0xf2, 0xce, 0xf9, 0x61, 0x15, 0xa1,
+    0xe0, 0xae, 0x5d, 0xa4, 0x9b, 0x34, 0x1a, 0x55, 0xad, 0x93, 0x32, 0x30, 0xf5, 0x8c, 0xb1, 0xe3,
+    0x1d, 0xf6, 0xe2, 0x2e, 0x82, 0x66, 0xca, 0x60, 0xc0, 0x29, 0x23, 0xab, 0x0d, 0x53, 0x4e, 0x6f,
+    0xd5, 0xdb, 0x37, 0x45, 0xde, 0xfd, 0x8e, 0x2f, 0x03, 0xff, 0x6a, 0x72, 0x6d, 0x6c, 0x5b, 0x51,
+    0x8d, 0x1b, 0xaf, 0x92, 0xbb, 0xdd, 0xbc, 0x7f, 0x11, 0xd9, 0x5c, 0x41, 0x1f, 0x10, 0x5a, 0xd8,
+    0x0a, 0xc1, 0x31, 0x88, 0xa5, 0xcd, 0x7b, 0xbd, 0x2d, 0x74, 0xd0, 0x12, 0xb8, 0xe5, 0xb4, 0xb0,
+    0x89, 0x69, 0x97, 0x4a, 0x0c, 0x96, 0x77, 0x7e, 0x65, 0xb9, 0xf1, 0x09, 0xc5, 0x6e, 0xc6, 0x84,
+    0x18, 0xf0, 0x7d, 0xec, 0x3a, 0xdc, 0x4d, 0x20, 0x79, 0xee, 0x5f, 0x3e, 0xd7, 0xcb, 0x39, 0x48,
+};
+
+static const uint32_t g_sm4Fk[SM4_WORD_NUM] = { 0xa3b1bac6, 0x56aa3350, 0x677d9197, 0xb27022dc };
+
+static const uint32_t g_sm4Ck[SM4_SIMD_ROUND_NUM] = {
+    0x00070e15, 0x1c232a31, 0x383f464d, 0x545b6269, 0x70777e85, 0x8c939aa1, 0xa8afb6bd, 0xc4cbd2d9,
+    0xe0e7eef5, 0xfc030a11, 0x181f262d, 0x343b4249, 0x50575e65, 0x6c737a81, 0x888f969d, 0xa4abb2b9,
+    0xc0c7ced5, 0xdce3eaf1, 0xf8ff060d, 0x141b2229, 0x30373e45, 0x4c535a61, 0x686f767d, 0x848b9299,
+    0xa0a7aeb5, 0xbcc3cad1, 0xd8dfe6ed, 0xf4fb0209, 0x10171e25, 0x2c333a41, 0x484f565d, 0x646b7279,
+};
+
+static inline uint32_t Rotl32(uint32_t x, uint32_t n)
+{
+    return (x << n) | (x >> (SM4_WORD_BITS - n));
+}
+
+static inline uint32_t LoadBe32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void StoreBe32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint32_t Sm4Tau(uint32_t x)
+{
+    return ((uint32_t)g_sm4Sbox[(x >> 24) & SM4_BYTE_MASK] << 24) |
+        ((uint32_t)g_sm4Sbox[(x >> 16) & SM4_BYTE_MASK] << 16) |
+        ((uint32_t)g_sm4Sbox[(x >> 8) & SM4_BYTE_MASK] << 8) |
+        (uint32_t)g_sm4Sbox[x & SM4_BYTE_MASK];
+}
+
+static inline uint32_t Sm4KeyT(uint32_t x)
+{
+    uint32_t b = Sm4Tau(x);
+    return b ^ Rotl32(b, 13) ^ Rotl32(b, 23);
+}
+
+static inline uint32_t Sm4RoundT(uint32_t x)
+{
+    uint32_t b = Sm4Tau(x);
+    return b ^ Rotl32(b, 2) ^ Rotl32(b, 10) ^ Rotl32(b, 18) ^ Rotl32(b, 24);
+}
+
+void Sm4SimdSetKey(const uint8_t *key, bool decrypt, Sm4SimdKey *ks)
+{
+    uint32_t k[SM4_WORD_NUM];
+    for (uint32_t i = 0; i < SM4_WORD_NUM; i++) {
+        k[i] = LoadBe32(key + i * SM4_WORD_SIZE) ^ g_sm4Fk[i];
+    }
+    for (uint32_t i = 0; i < SM4_SIMD_ROUND_NUM; i++) {
+        k[i % SM4_WORD_NUM] ^= Sm4KeyT(k[(i + 1) % SM4_WORD_NUM] ^ k[(i + 2) % SM4_WORD_NUM] ^
+            k[(i + 3) % SM4_WORD_NUM] ^ g_sm4Ck[i]);
+        ks->rk[decrypt ? (SM4_SIMD_ROUND_NUM - 1 - i) : i] = k[i % SM4_WORD_NUM];
+    }
+    (void)memset_s(k, sizeof(k), 0, sizeof(k));
+}
+
+static void Sm4CryptBlock(const uint8_t *in, uint8_t *out, const Sm4SimdKey *ks)
+{
+    uint32_t x[SM4_WORD_NUM];
+    for (uint32_t i = 0; i < SM4_WORD_NUM; i++) {
+        x[i] = LoadBe32(in + i * SM4_WORD_SIZE);
+    }
+    for (uint32_t i = 0; i < SM4_SIMD_ROUND_NUM; i++) {
+        x[i % SM4_WORD_NUM] ^= Sm4RoundT(x[(i + 1) % SM4_WORD_NUM] ^ x[(i + 2) % SM4_WORD_NUM] ^
+            x[(i + 3) % SM4_WORD_NUM] ^ ks->rk[i]);
+    }
+    /* the output is the last four state words in reverse order */
+    for (uint32_t i = 0; i < SM4_WORD_NUM; i++) {
+        StoreBe32(out + i * SM4_WORD_SIZE, x[SM4_WORD_NUM - 1 - i]);
+    }
+}
+
+#ifdef HCF_SM4_SIMD_X86
+/*
+ * The SM4 and AES S-boxes are both inversions in GF(2^8) wrapped in affine maps, so the SM4 S-box is computed
+ * with AESENCLAST: an affine map into the AES field, the AES S-box, and an affine map back. Each map is done with
+ * two nibble table lookups. The tables below are derived for the SM4 polynomial 0x1f5 and the AES polynomial 0x11b.
+ */
+static const uint8_t g_sm4PreLo[] = {
+    0x3e, 0xb2, 0x0e, 0x82, 0xbb, 0x37, 0x8b, 0x07, 0xa1, 0x2d, 0x91, 0x1d, 0x24, 0xa8, 0x14, 0x98,
+};
+static const uint8_t g_sm4PreHi[] = {
+    0x00, 0xdc, 0x2e, 0xf2, 0xc5, 0x19, 0xeb, 0x37, 0x08, 0xd4, 0x26, 0xfa, 0xcd, 0x11, 0xe3, 0x3f,
+};
+static const uint8_t g_sm4PostLo[] = {
+    0x6c, 0xd4, 0xa6, 0x1e, 0x52, 0xea, 0x98, 0x20, 0x0b, 0xb3, 0xc1, 0x79, 0x35, 0x8d, 0xff, 0x47,
+};
+static const uint8_t g_sm4PostHi[] = {
+    0x00, 0xe0, 0x50, 0xb0, 0x9d, 0x7d, 0xcd, 0x2d, 0xc0, 0x20, 0x90, 0x70, 0x5d, 0xbd, 0x0d, 0xed,
+};
+/* undoes the ShiftRows step of AESENCLAST so that the S-box stays byte for byte */
+static const uint8_t g_invShiftRows[] = { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 };
+static const uint8_t g_bswap32[] = { 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 };
+static const uint8_t g_rotl8[] = { 3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14 };
+static const uint8_t g_rotl16[] = { 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 };
+static const uint8_t g_rotl24[] = { 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 };
+
+static bool g_sm4SimdSupported = false;
+static pthread_once_t g_sm4SimdOnce = PTHREAD_ONCE_INIT;
+
+static void DetectSm4Simd(void)
+{
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return;
+    }
+    g_sm4SimdSupported = ((ecx & bit_SSSE3) != 0) && ((ecx & bit_AES) != 0);
+}
+
+bool Sm4SimdIsSupported(void)
+{
+    (void)pthread_once(&g_sm4SimdOnce, DetectSm4Simd);
+    return g_sm4SimdSupported;
+}
+
+static inline SM4_SIMD_TARGET __m128i LoadConst(const uint8_t *table)
+{
+    return _mm_loadu_si128((const __m128i *)table);
+}
+
+static inline SM4_SIMD_TARGET __m128i Sm4AffineX4(__m128i x, const uint8_t *lo, const uint8_t *hi)
+{
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+    __m128i l = _mm_and_si128(x, nibbleMask);
+    __m128i h = _mm_and_si128(_mm_srli_epi16(x, SM4_NIBBLE_SHIFT), nibbleMask);
+    return _mm_xor_si128(_mm_shuffle_epi8(LoadConst(lo), l), _mm_shuffle_epi8(LoadConst(hi), h));
+}
+
+/* T = L(tau(x)) on four words, L(b) = b ^ rotl24(b) ^ rotl2(b ^ rotl8(b) ^ rotl16(b)) */
+static inline SM4_SIMD_TARGET __m128i Sm4TX4(__m128i x)
+{
+    x = Sm4AffineX4(x, g_sm4PreLo, g_sm4PreHi);
+    x = _mm_shuffle_epi8(x, LoadConst(g_invShiftRows));
+    x = _mm_aesenclast_si128(x, _mm_setzero_si128());
+    __m128i b = Sm4AffineX4(x, g_sm4PostLo, g_sm4PostHi);
+    __m128i t = _mm_xor_si128(_mm_xor_si128(b, _mm_shuffle_epi8(b, LoadConst(g_rotl8))),
+        _mm_shuffle_epi8(b, LoadConst(g_rotl16)));
+    t = _mm_or_si128(_mm_slli_epi32(t, 2), _mm_srli_epi32(t, SM4_WORD_BITS - 2));
+    return _mm_xor_si128(_mm_xor_si128(b, _mm_shuffle_epi8(b, LoadConst(g_rotl24))), t);
+}
+
+static inline SM4_SIMD_TARGET __m128i Sm4RoundX4(__m128i x0, __m128i x1, __m128i x2, __m128i x3, __m128i rk)
+{
+    return _mm_xor_si128(x0, Sm4TX4(_mm_xor_si128(_mm_xor_si128(x1, x2), _mm_xor_si128(x3, rk))));
+}
+
+/* lane j of x[i] holds word i of block j, the round keys are broadcast to all lanes */
+static inline SM4_SIMD_TARGET void Sm4CryptLanesX4(__m128i *x, const Sm4SimdKey *ks)
+{
+    for (uint32_t i = 0; i < SM4_SIMD_ROUND_NUM; i += SM4_WORD_NUM) {
+        x[0] = Sm4RoundX4(x[0], x[1], x[2], x[3], _mm_set1_epi32((int)ks->rk[i]));
+        x[1] = Sm4RoundX4(x[1], x[2], x[3], x[0], _mm_set1_epi32((int)ks->rk[i + 1]));
+        x[2] = Sm4RoundX4(x[2], x[3], x[0], x[1], _mm_set1_epi32((int)ks->rk[i + 2]));
+        x[3] = Sm4RoundX4(x[3], x[0], x[1], x[2], _mm_set1_epi32((int)ks->rk[i + 3]));
+    }
+}
+
+/* two independent groups per round keep the AES unit busy while the other group does the linear layer */
+static inline SM4_SIMD_TARGET void Sm4CryptLanesX8(__m128i *x, __m128i *y, const Sm4SimdKey *ks)
+{
+    for (uint32_t i = 0; i < SM4_SIMD_ROUND_NUM; i += SM4_WORD_NUM) {
+        __m128i rk = _mm_set1_epi32((int)ks->rk[i]);
+        x[0] = Sm4RoundX4(x[0], x[1], x[2], x[3], rk);
+        y[0] = Sm4RoundX4(y[0], y[1], y[2], y[3], rk);
+        rk = _mm_set1_epi32((int)ks->rk[i + 1]);
+        x[1] = Sm4RoundX4(x[1], x[2], x[3], x[0], rk);
+        y[1] = Sm4RoundX4(y[1], y[2], y[3], y[0], rk);
+        rk = _mm_set1_epi32((int)ks->rk[i + 2]);
+        x[2] = Sm4RoundX4(x[2], x[3], x[0], x[1], rk);
+        y[2] = Sm4RoundX4(y[2], y[3], y[0], y[1], rk);
+        rk = _mm_set1_epi32((int)ks->rk[i + 3]);
+        x[3] = Sm4RoundX4(x[3], x[0], x[1], x[2], rk);
+        y[3] = Sm4RoundX4(y[3], y[0], y[1], y[2], rk);
+    }
+}
+
+static inline SM4_SIMD_TARGET void Transpose4(__m128i *r0, __m128i *r1, __m128i *r2, __m128i *r3)
+{
+    __m128i t0 = _mm_unpacklo_epi32(*r0, *r1);
+    __m128i t1 = _mm_unpacklo_epi32(*r2, *r3);
+    __m128i t2 = _mm_unpackhi_epi32(*r0, *r1);
+    __m128i t3 = _mm_unpackhi_epi32(*r2, *r3);
+    *r0 = _mm_unpacklo_epi64(t0, t1);
+    *r1 = _mm_unpackhi_epi64(t0, t1);
+    *r2 = _mm_unpacklo_epi64(t2, t3);
+    *r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+static inline SM4_SIMD_TARGET void LoadLanes(const uint8_t *in, __m128i *x)
+{
+    const __m128i bswap = LoadConst(g_bswap32);
+    for (uint32_t i = 0; i < SM4_LANE_NUM; i++) {
+        x[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + i * SM4_SIMD_BLOCK_SIZE)), bswap);
+    }
+    Transpose4(&x[0], &x[1], &x[2], &x[3]);
+}
+
+/* turns the state back into four big endian blocks, the output words are x[3], x[2], x[1], x[0] */
+static inline SM4_SIMD_TARGET void LanesToBlocks(const __m128i *x, __m128i *blocks)
+{
+    const __m128i bswap = LoadConst(g_bswap32);
+    blocks[0] = x[3];
+    blocks[1] = x[2];
+    blocks[2] = x[1];
+    blocks[3] = x[0];
+    Transpose4(&blocks[0], &blocks[1], &blocks[2], &blocks[3]);
+    for (uint32_t i = 0; i < SM4_LANE_NUM; i++) {
+        blocks[i] = _mm_shuffle_epi8(blocks[i], bswap);
+    }
+}
+
+static inline SM4_SIMD_TARGET void StoreLanes(const __m128i *x, uint8_t *out)
+{
+    __m128i blocks[SM4_LANE_NUM];
+    LanesToBlocks(x, blocks);
+    for (uint32_t i = 0; i < SM4_LANE_NUM; i++) {
+        _mm_storeu_si128((__m128i *)(out + i * SM4_SIMD_BLOCK_SIZE), blocks[i]);
+    }
+}
+
+static SM4_SIMD_TARGET void Sm4CryptBlocksX86(const uint8_t *in, uint8_t *out, size_t blocks, const Sm4SimdKey *ks)
+{
+    __m128i x[SM4_LANE_NUM];
+    __m128i y[SM4_LANE_NUM];
+    for (; blocks >= SM4_WIDE_BLOCK_NUM; blocks -= SM4_WIDE_BLOCK_NUM) {
+        LoadLanes(in, x);
+        LoadLanes(in + SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE, y);
+        Sm4CryptLanesX8(x, y, ks);
+        StoreLanes(x, out);
+        StoreLanes(y, out + SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE);
+        in += SM4_WIDE_BLOCK_NUM * SM4_SIMD_BLOCK_SIZE;
+        out += SM4_WIDE_BLOCK_NUM * SM4_SIMD_BLOCK_SIZE;
+    }
+    for (; blocks >= SM4_LANE_NUM; blocks -= SM4_LANE_NUM) {
+        LoadLanes(in, x);
+        Sm4CryptLanesX4(x, ks);
+        StoreLanes(x, out);
+        in += SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE;
+        out += SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE;
+    }
+    if (blocks == 0) {
+        return;
+    }
+    uint8_t buf[SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE] = { 0 };
+    size_t tailLen = blocks * SM4_SIMD_BLOCK_SIZE;
+    (void)memcpy_s(buf, sizeof(buf), in, tailLen);
+    LoadLanes(buf, x);
+    Sm4CryptLanesX4(x, ks);
+    StoreLanes(x, buf);
+    (void)memcpy_s(out, tailLen, buf, tailLen);
+    (void)memset_s(buf, sizeof(buf), 0, sizeof(buf));
+}
+
+/* counter lanes of one group: words 0 to 2 are fixed, word 3 counts up by one per lane */
+static inline SM4_SIMD_TARGET void SetCounterLanes(const uint32_t *iv, uint32_t ctr, __m128i *x)
+{
+    x[0] = _mm_set1_epi32((int)iv[0]);
+    x[1] = _mm_set1_epi32((int)iv[1]);
+    x[2] = _mm_set1_epi32((int)iv[2]);
+    x[3] = _mm_add_epi32(_mm_set1_epi32((int)ctr), _mm_setr_epi32(0, 1, 2, 3));
+}
+
+static inline SM4_SIMD_TARGET void XorLanes(const __m128i *x, const uint8_t *in, uint8_t *out)
+{
+    __m128i blocks[SM4_LANE_NUM];
+    LanesToBlocks(x, blocks);
+    for (uint32_t i = 0; i < SM4_LANE_NUM; i++) {
+        __m128i data = _mm_loadu_si128((const __m128i *)(in + i * SM4_SIMD_BLOCK_SIZE));
+        _mm_storeu_si128((__m128i *)(out + i * SM4_SIMD_BLOCK_SIZE), _mm_xor_si128(data, blocks[i]));
+    }
+}
+
+static SM4_SIMD_TARGET void Sm4Ctr32X86(const uint8_t *in, uint8_t *out, size_t blocks, const Sm4SimdKey *ks,
+    const uint8_t *ivec)
+{
+    uint32_t iv[SM4_WORD_NUM - 1] = { LoadBe32(ivec), LoadBe32(ivec + SM4_WORD_SIZE),
+        LoadBe32(ivec + 2 * SM4_WORD_SIZE) };
+    uint32_t ctr = LoadBe32(ivec + 3 * SM4_WORD_SIZE);
+    __m128i x[SM4_LANE_NUM];
+    __m128i y[SM4_LANE_NUM];
+    for (; blocks >= SM4_WIDE_BLOCK_NUM; blocks -= SM4_WIDE_BLOCK_NUM) {
+        SetCounterLanes(iv, ctr, x);
+        SetCounterLanes(iv, ctr + SM4_LANE_NUM, y);
+        Sm4CryptLanesX8(x, y, ks);
+        XorLanes(x, in, out);
+        XorLanes(y, in + SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE, out + SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE);
+        ctr += SM4_WIDE_BLOCK_NUM;
+        in += SM4_WIDE_BLOCK_NUM * SM4_SIMD_BLOCK_SIZE;
+        out += SM4_WIDE_BLOCK_NUM * SM4_SIMD_BLOCK_SIZE;
+    }
+    for (; blocks >= SM4_LANE_NUM; blocks -= SM4_LANE_NUM) {
+        SetCounterLanes(iv, ctr, x);
+        Sm4CryptLanesX4(x, ks);
+        XorLanes(x, in, out);
+        ctr += SM4_LANE_NUM;
+        in += SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE;
+        out += SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE;
+    }
+    if (blocks == 0) {
+        return;
+    }
+    uint8_t buf[SM4_LANE_NUM * SM4_SIMD_BLOCK_SIZE] = { 0 };
+    size_t tailLen = blocks * SM4_SIMD_BLOCK_SIZE;
+    (void)memcpy_s(buf, sizeof(buf), in, tailLen);
+    SetCounterLanes(iv, ctr, x);
+    Sm4CryptLanesX4(x, ks);
+    XorLanes(x, buf, buf);
+    (void)memcpy_s(out, tailLen, buf, tailLen);
+    (void)memset_s(buf, sizeof(buf), 0, sizeof(buf));
+}
+#else
+bool Sm4SimdIsSupported(void)
+{
+    return false;
+}
+#endif
+
+void Sm4SimdCryptBlocks(const uint8_t *in, uint8_t *out, size_t blocks, const Sm4SimdKey *ks)
+{
+#ifdef HCF_SM4_SIMD_X86
+    if (Sm4SimdIsSupported()) {
+        Sm4CryptBlocksX86(in, out, blocks, ks);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < blocks; i++) {
+        Sm4CryptBlock(in + i * SM4_SIMD_BLOCK_SIZE, out + i * SM4_SIMD_BLOCK_SIZE, ks);
+    }
+}
+
+void Sm4SimdEncryptBlock(const unsigned char in[SM4_SIMD_BLOCK_SIZE], unsigned char out[SM4_SIMD_BLOCK_SIZE],
+    const void *key)
+{
+    Sm4CryptBlock(in, out, (const Sm4SimdKey *)key);
+}
+
+void Sm4SimdCtr32EncryptBlocks(const unsigned char *in, unsigned char *out, size_t blocks, const void *key,
+    const unsigned char ivec[SM4_SIMD_BLOCK_SIZE])
+{
+#ifdef HCF_SM4_SIMD_X86
+    if (Sm4SimdIsSupported()) {
+        Sm4Ctr32X86(in, out, blocks, (const Sm4SimdKey *)key, ivec);
+        return;
+    }
+#endif
+    uint8_t counter[SM4_SIMD_BLOCK_SIZE];
+    uint8_t stream[SM4_SIMD_BLOCK_SIZE];
+    (void)memcpy_s(counter, sizeof(counter), ivec, SM4_SIMD_BLOCK_SIZE);
+    uint32_t ctr = LoadBe32(counter + 3 * SM4_WORD_SIZE);
+    for (size_t i = 0; i < blocks; i++) {
+        StoreBe32(counter + 3 * SM4_WORD_SIZE, ctr++);
+        Sm4CryptBlock(counter, stream, (const Sm4SimdKey *)key);
+        for (uint32_t j = 0; j < SM4_SIMD_BLOCK_SIZE; j++) {
+            out[j] = in[j] ^ stream[j];
+        }
+        in += SM4_SIMD_BLOCK_SIZE;
+        out += SM4_SIMD_BLOCK_SIZE;
+    }
+    (void)memset_s(stream, sizeof(stream), 0, sizeof(stream));
+}
@@ -0,0 +1,803 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "envelope_openssl.h"
+
+#include <limits.h>
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+#include <securec.h>
+
+#include "envelope.h"
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_class.h"
+#include "openssl_common.h"
+#include "rsa_openssl_common.h"
+#include "utils.h"
+
+#define ENVELOPE_NONCE_LEN 12
+#define ENVELOPE_MAX_KEY_LEN 32
+#define ENVELOPE_MAX_POINT_LEN 133
+#define ENVELOPE_MAX_ENC_LEN 0xFFFF
+#define ENVELOPE_BITS_PER_BYTE 8
+#define ENVELOPE_BYTE_MASK 0xFF
+#define ENVELOPE_SUITE_ID_INDEX 1
+#define ENVELOPE_ENC_LEN_INDEX 2
+
+typedef enum {
+    ENVELOPE_KEM_X25519,
+    ENVELOPE_KEM_EC,
+    ENVELOPE_KEM_SM2,
+    ENVELOPE_KEM_RSA,
+} EnvelopeKemType;
+
+typedef struct {
+    const char *algoName;
+    uint8_t suiteId;
+    EnvelopeKemType kemType;
+    const char *mdName;
+    const char *cipherName;
+    uint32_t keyLen;
+} EnvelopeSuite;
+
+typedef struct {
+    HcfEnvelopeSpi base;
+    const EnvelopeSuite *suite;
+    EVP_CIPHER *cipher;
+    EVP_KDF *kdf;
+} HcfEnvelopeOpensslSpiImpl;
+
+static const EnvelopeSuite ENVELOPE_SUITES[] = {
+    { "X25519-AES256-GCM", 1, ENVELOPE_KEM_X25519, "SHA256", "AES-256-GCM", 32 },
+    { "ECC-AES256-GCM", 2, ENVELOPE_KEM_EC, "SHA256", "AES-256-GCM", 32 },
+    { "SM2-SM4-GCM", 3, ENVELOPE_KEM_SM2, "SM3", "SM4-GCM", 16 },
+    { "RSA-KEM-AES256-GCM", 4, ENVELOPE_KEM_RSA, "SHA256", "AES-256-GCM", 32 },
+};
+
+static const char *GetEnvelopeSpiClass(void)
+{
+    return "HcfEnvelopeOpensslSpi";
+}
+
+static const EnvelopeSuite *FindEnvelopeSuite(const char *algoName)
+{
+    for (uint32_t i = 0; i < sizeof(ENVELOPE_SUITES) / sizeof(ENVELOPE_SUITES[0]); i++) {
+        if (strcmp(ENVELOPE_SUITES[i].algoName, algoName) == 0) {
+            return &ENVELOPE_SUITES[i];
+        }
+    }
+    LOGE("Unsupported envelope suite: %{public}s", algoName);
+    return NULL;
+}
+
+static EVP_PKEY *AssignEcKeyToPkey(EC_KEY *ecKey)
+{
+    EVP_PKEY *pkey = OpensslEvpPkeyNew();
+    if (pkey == NULL) {
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    if (OpensslEvpPkeyAssignEcKey(pkey, ecKey) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        OpensslEvpPkeyFree(pkey);
+        return NULL;
+    }
+    return pkey;
+}
+
+/* The key objects are shared by reference, the envelope never copies the recipient key. */
+static EVP_PKEY *NewPkeyByEcKey(EC_KEY *ecKey)
+{
+    if (OpensslEcKeyUpRef(ecKey) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    EVP_PKEY *pkey = AssignEcKeyToPkey(ecKey);
+    if (pkey == NULL) {
+        OpensslEcKeyFree(ecKey);
+    }
+    return pkey;
+}
+
+static EVP_PKEY *NewPkeyByX25519Pkey(EVP_PKEY *pkey)
+{
+    if ((pkey == NULL) || (OpensslEvpPkeyIsA(pkey, "X25519") != HCF_OPENSSL_SUCCESS)) {
+        LOGE("Key is not a X25519 key.");
+        return NULL;
+    }
+    if (OpensslEvpPkeyUpRef(pkey) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    return pkey;
+}
+
+static const char *GetPubKeyClass(EnvelopeKemType kemType)
+{
+    switch (kemType) {
+        case ENVELOPE_KEM_X25519:
+            return OPENSSL_ALG25519_PUBKEY_CLASS;
+        case ENVELOPE_KEM_EC:
+            return HCF_OPENSSL_ECC_PUB_KEY_CLASS;
+        case ENVELOPE_KEM_SM2:
+            return HCF_OPENSSL_SM2_PUB_KEY_CLASS;
+        default:
+            return OPENSSL_RSA_PUBKEY_CLASS;
+    }
+}
+
+static const char *GetPriKeyClass(EnvelopeKemType kemType)
+{
+    switch (kemType) {
+        case ENVELOPE_KEM_X25519:
+            return OPENSSL_ALG25519_PRIKEY_CLASS;
+        case ENVELOPE_KEM_EC:
+            return HCF_OPENSSL_ECC_PRI_KEY_CLASS;
+        case ENVELOPE_KEM_SM2:
+            return HCF_OPENSSL_SM2_PRI_KEY_CLASS;
+        default:
+            return OPENSSL_RSA_PRIKEY_CLASS;
+    }
+}
+
+static HcfResult NewRecipientPubPkey(EnvelopeKemType kemType, HcfPubKey *pubKey, EVP_PKEY **returnPkey)
+{
+    if (!HcfIsClassMatch((HcfObjectBase *)pubKey, GetPubKeyClass(kemType))) {
+        LOGE("Public key does not match the envelope suite.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *pkey = NULL;
+    switch (kemType) {
+        case ENVELOPE_KEM_X25519:
+            pkey = NewPkeyByX25519Pkey(((HcfOpensslAlg25519PubKey *)pubKey)->pkey);
+            break;
+        case ENVELOPE_KEM_EC:
+            pkey = NewPkeyByEcKey(((HcfOpensslEccPubKey *)pubKey)->ecKey);
+            break;
+        case ENVELOPE_KEM_SM2:
+            pkey = NewPkeyByEcKey(((HcfOpensslSm2PubKey *)pubKey)->ecKey);
+            break;
+        default:
+            pkey = NewEvpPkeyByRsa(((HcfOpensslRsaPubKey *)pubKey)->pk, true);
+            break;
+    }
+    if (pkey == NULL) {
+        LOGE("Failed to get the recipient public key.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnPkey = pkey;
+    return HCF_SUCCESS;
+}
+
+static EVP_PKEY *NewRecipientPriPkey(EnvelopeKemType kemType, HcfPriKey *priKey)
+{
+    switch (kemType) {
+        case ENVELOPE_KEM_X25519:
+            return NewPkeyByX25519Pkey(((HcfOpensslAlg25519PriKey *)priKey)->pkey);
+        case ENVELOPE_KEM_EC:
+            return NewPkeyByEcKey(((HcfOpensslEccPriKey *)priKey)->ecKey);
+        default:
+            return NewEvpPkeyByRsa(((HcfOpensslRsaPriKey *)priKey)->sk, true);
+    }
+}
+
+static HcfResult CopyToBlob(const uint8_t *data, size_t len, HcfBlob *returnBlob)
+{
+    returnBlob->data = (uint8_t *)HcfMalloc(len, 0);
+    if (returnBlob->data == NULL) {
+        LOGE("Failed to allocate blob memory.");
+        return HCF_ERR_MALLOC;
+    }
+    (void)memcpy_s(returnBlob->data, len, data, len);
+    returnBlob->len = len;
+    return HCF_SUCCESS;
+}
+
+static HcfResult GenerateEphemeralKey(EVP_PKEY *peer, EVP_PKEY **returnEphKey, HcfBlob *returnEnc)
+{
+    EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxNew(peer, NULL);
+    if (ctx == NULL) {
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    EVP_PKEY *ephKey = NULL;
+    if ((OpensslEvpPkeyKeyGenInit(ctx) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpPkeyKeyGen(ctx, &ephKey) != HCF_OPENSSL_SUCCESS)) {
+        LOGE("Failed to generate the ephemeral key.");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    uint8_t point[ENVELOPE_MAX_POINT_LEN] = { 0 };
+    size_t pointLen = 0;
+    if (OpensslEvpPkeyGetOctetStringParam(ephKey, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, point, sizeof(point),
+        &pointLen) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to encode the ephemeral public key.");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyFree(ephKey);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = CopyToBlob(point, pointLen, returnEnc);
+    if (ret != HCF_SUCCESS) {
+        OpensslEvpPkeyFree(ephKey);
+        return ret;
+    }
+    *returnEphKey = ephKey;
+    return HCF_SUCCESS;
+}
+
+/*
+ * SM2 keys have no ECDH key exchange in openssl, so the SM2 shared secret is the x coordinate of the scalar
+ * multiplication, which is what ECDH computes for the other curves.
+ */
+static HcfResult Sm2Agree(const EC_GROUP *group, const BIGNUM *priv, const EC_POINT *peerPoint,
+    HcfBlob *returnSecret)
+{
+    if ((group == NULL) || (priv == NULL) || (peerPoint == NULL)) {
+        LOGE("Invalid SM2 key.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    int fieldLen = (OpensslEcGroupGetDegree(group) + ENVELOPE_BITS_PER_BYTE - 1) / ENVELOPE_BITS_PER_BYTE;
+    if (fieldLen <= 0) {
+        LOGE("Invalid SM2 group.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfBlob secret = { .data = (uint8_t *)HcfMalloc(fieldLen, 0), .len = fieldLen };
+    if (secret.data == NULL) {
+        LOGE("Failed to allocate SM2 secret memory.");
+        return HCF_ERR_MALLOC;
+    }
+    EC_POINT *shared = OpensslEcPointNew(group);
+    BIGNUM *x = OpensslBnNew();
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    if ((shared != NULL) && (x != NULL) &&
+        (OpensslEcPointMul(group, shared, NULL, peerPoint, priv, NULL) == HCF_OPENSSL_SUCCESS) &&
+        (OpensslEcPointGetAffineCoordinates(group, shared, x, NULL, NULL) == HCF_OPENSSL_SUCCESS) &&
+        (OpensslBn2BinPad(x, secret.data, fieldLen) == fieldLen)) {
+        ret = HCF_SUCCESS;
+    }
+    OpensslBnClearFree(x);
+    OpensslEcPointFree(shared);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to agree the SM2 shared secret.");
+        HcfPrintOpensslError();
+        HcfBlobDataClearAndFree(&secret);
+        return ret;
+    }
+    *returnSecret = secret;
+    return HCF_SUCCESS;
+}
+
+static HcfResult Sm2EphemeralAgree(EVP_PKEY *ephKey, const EC_KEY *recipient, HcfBlob *returnSecret)
+{
+    BIGNUM *priv = NULL;
+    if (OpensslEvpPkeyGetBnParam(ephKey, OSSL_PKEY_PARAM_PRIV_KEY, &priv) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to get the ephemeral private key.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = Sm2Agree(OpensslEcKeyGet0Group(recipient), priv, OpensslEcKeyGet0PublicKey(recipient),
+        returnSecret);
+    OpensslBnClearFree(priv);
+    return ret;
+}
+
+static HcfResult DhEncapsulate(EnvelopeKemType kemType, HcfPubKey *pubKey, EVP_PKEY *peer, HcfBlob *returnEnc,
+    HcfBlob *returnSecret)
+{
+    EVP_PKEY *ephKey = NULL;
+    HcfResult ret = GenerateEphemeralKey(peer, &ephKey, returnEnc);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (kemType == ENVELOPE_KEM_SM2) {
+        ret = Sm2EphemeralAgree(ephKey, ((HcfOpensslSm2PubKey *)pubKey)->ecKey, returnSecret);
+    } else {
+        ret = KeyDerive(ephKey, peer, returnSecret);
+    }
+    OpensslEvpPkeyFree(ephKey);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to agree the shared secret.");
+        HcfBlobDataFree(returnEnc);
+    }
+    return ret;
+}
+
+static EVP_PKEY_CTX *NewRsaKemCtx(EVP_PKEY *pkey, bool isEncrypt)
+{
+    EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxNew(pkey, NULL);
+    if (ctx == NULL) {
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    int ret = isEncrypt ? OpensslEvpPkeyEncryptInit(ctx) : OpensslEvpPkeyDecryptInit(ctx);
+    if ((ret != HCF_OPENSSL_SUCCESS) || (OpensslEvpPkeyCtxSetRsaPadding(ctx, RSA_NO_PADDING) != HCF_OPENSSL_SUCCESS)) {
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+/* RSA-KEM encrypts a random integer below the modulus without padding, the integer itself is the secret. */
+static HcfResult RsaEncapsulateWithCtx(EVP_PKEY_CTX *ctx, HcfBlob *returnEnc, HcfBlob *returnSecret)
+{
+    size_t modLen = 0;
+    if (OpensslEvpPkeyEncrypt(ctx, NULL, &modLen, NULL, 0) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if ((modLen == 0) || (modLen > ENVELOPE_MAX_ENC_LEN)) {
+        LOGE("Invalid RSA modulus length.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfBlob secret = { .data = (uint8_t *)HcfMalloc(modLen, 0), .len = modLen };
+    HcfBlob enc = { .data = (uint8_t *)HcfMalloc(modLen, 0), .len = modLen };
+    if ((secret.data == NULL) || (enc.data == NULL)) {
+        LOGE("Failed to allocate RSA-KEM memory.");
+        HcfFree(secret.data);
+        HcfFree(enc.data);
+        return HCF_ERR_MALLOC;
+    }
+    int ret = OpensslRandPrivBytesEx(NULL, secret.data, secret.len);
+    /* A zero leading byte keeps the integer below the modulus. */
+    secret.data[0] = 0;
+    size_t encLen = modLen;
+    if ((ret != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpPkeyEncrypt(ctx, enc.data, &encLen, secret.data, secret.len) != HCF_OPENSSL_SUCCESS) ||
+        (encLen != modLen)) {
+        LOGE("Failed to encapsulate the RSA-KEM secret.");
+        HcfPrintOpensslError();
+        HcfBlobDataClearAndFree(&secret);
+        HcfFree(enc.data);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnEnc = enc;
+    *returnSecret = secret;
+    return HCF_SUCCESS;
+}
+
+static HcfResult RsaEncapsulate(EVP_PKEY *peer, HcfBlob *returnEnc, HcfBlob *returnSecret)
+{
+    EVP_PKEY_CTX *ctx = NewRsaKemCtx(peer, true);
+    if (ctx == NULL) {
+        LOGE("Failed to init the RSA-KEM encrypt ctx.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = RsaEncapsulateWithCtx(ctx, returnEnc, returnSecret);
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult RsaDecapsulate(EVP_PKEY *priPkey, const uint8_t *enc, size_t encLen, HcfBlob *returnSecret)
+{
+    EVP_PKEY_CTX *ctx = NewRsaKemCtx(priPkey, false);
+    if (ctx == NULL) {
+        LOGE("Failed to init the RSA-KEM decrypt ctx.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    size_t modLen = 0;
+    if ((OpensslEvpPkeyDecrypt(ctx, NULL, &modLen, enc, encLen) != HCF_OPENSSL_SUCCESS) || (modLen != encLen)) {
+        LOGE("The RSA-KEM encapsulation length does not match the key.");
+        OpensslEvpPkeyCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfBlob secret = { .data = (uint8_t *)HcfMalloc(modLen, 0), .len = modLen };
+    if (secret.data == NULL) {
+        LOGE("Failed to allocate RSA-KEM memory.");
+        OpensslEvpPkeyCtxFree(ctx);
+        return HCF_ERR_MALLOC;
+    }
+    size_t secretLen = modLen;
+    int ret = OpensslEvpPkeyDecrypt(ctx, secret.data, &secretLen, enc, encLen);
+    OpensslEvpPkeyCtxFree(ctx);
+    if ((ret != HCF_OPENSSL_SUCCESS) || (secretLen != modLen)) {
+        LOGE("Failed to decapsulate the RSA-KEM secret.");
+        HcfPrintOpensslError();
+        HcfBlobDataClearAndFree(&secret);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnSecret = secret;
+    return HCF_SUCCESS;
+}
+
+static EC_POINT *NewEcPeerPoint(const EC_GROUP *group, const uint8_t *enc, size_t encLen)
+{
+    if (group == NULL) {
+        LOGE("Invalid EC group.");
+        return NULL;
+    }
+    EC_POINT *point = OpensslEcPointNew(group);
+    if (point == NULL) {
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    if (OpensslEcOct2Point(group, point, enc, encLen, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        OpensslEcPointFree(point);
+        return NULL;
+    }
+    return point;
+}
+
+static EVP_PKEY *NewEcPeerPkey(const EC_KEY *recipient, const uint8_t *enc, size_t encLen)
+{
+    const EC_GROUP *group = OpensslEcKeyGet0Group(recipient);
+    EC_POINT *point = NewEcPeerPoint(group, enc, encLen);
+    if (point == NULL) {
+        return NULL;
+    }
+    EC_KEY *ecKey = OpensslEcKeyNew();
+    if ((ecKey == NULL) || (OpensslEcKeySetGroup(ecKey, group) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEcKeySetPublicKey(ecKey, point) != HCF_OPENSSL_SUCCESS)) {
+        HcfPrintOpensslError();
+        OpensslEcPointFree(point);
+        OpensslEcKeyFree(ecKey);
+        return NULL;
+    }
+    OpensslEcPointFree(point);
+    EVP_PKEY *pkey = AssignEcKeyToPkey(ecKey);
+    if (pkey == NULL) {
+        OpensslEcKeyFree(ecKey);
+    }
+    return pkey;
+}
+
+static HcfResult Sm2Decapsulate(const EC_KEY *recipient, const uint8_t *enc, size_t encLen, HcfBlob *returnSecret)
+{
+    const EC_GROUP *group = OpensslEcKeyGet0Group(recipient);
+    EC_POINT *point = NewEcPeerPoint(group, enc, encLen);
+    if (point == NULL) {
+        LOGE("Failed to decode the ephemeral public key.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = Sm2Agree(group, OpensslEcKeyGet0PrivateKey(recipient), point, returnSecret);
+    OpensslEcPointFree(point);
+    return ret;
+}
+
+static HcfResult DecapsulateWithPkey(EnvelopeKemType kemType, HcfPriKey *priKey, EVP_PKEY *priPkey,
+    const uint8_t *enc, size_t encLen, HcfBlob *returnSecret)
+{
+    if (kemType == ENVELOPE_KEM_RSA) {
+        return RsaDecapsulate(priPkey, enc, encLen, returnSecret);
+    }
+    EVP_PKEY *peer = (kemType == ENVELOPE_KEM_X25519) ?
+        OpensslEvpPkeyNewRawPublicKey(EVP_PKEY_X25519, NULL, enc, encLen) :
+        NewEcPeerPkey(((HcfOpensslEccPriKey *)priKey)->ecKey, enc, encLen);
+    if (peer == NULL) {
+        LOGE("Failed to decode the ephemeral public key.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = KeyDerive(priPkey, peer, returnSecret);
+    OpensslEvpPkeyFree(peer);
+    return ret;
+}
+
+static HcfResult Decapsulate(EnvelopeKemType kemType, HcfPriKey *priKey, const uint8_t *enc, size_t encLen,
+    HcfBlob *returnSecret)
+{
+    if (!HcfIsClassMatch((HcfObjectBase *)priKey, GetPriKeyClass(kemType))) {
+        LOGE("Private key does not match the envelope suite.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (kemType == ENVELOPE_KEM_SM2) {
+        return Sm2Decapsulate(((HcfOpensslSm2PriKey *)priKey)->ecKey, enc, encLen, returnSecret);
+    }
+    EVP_PKEY *priPkey = NewRecipientPriPkey(kemType, priKey);
+    if (priPkey == NULL) {
+        LOGE("Failed to get the recipient private key.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = DecapsulateWithPkey(kemType, priKey, priPkey, enc, encLen, returnSecret);
+    OpensslEvpPkeyFree(priPkey);
+    return ret;
+}
+
+/*
+ * The header and the encapsulation are the HKDF info, so the content key is bound to the whole envelope prefix.
+ * The fetched HKDF is kept in the spi, hkdf_openssl.c would fetch it and copy every input on each derive.
+ */
+static HcfResult DeriveContentKey(const HcfEnvelopeOpensslSpiImpl *impl, const HcfBlob *secret, const uint8_t *info,
+    size_t infoLen, uint8_t *okm)
+{
+    EVP_KDF_CTX *kctx = OpensslEvpKdfCtxNew(impl->kdf);
+    if (kctx == NULL) {
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    OSSL_PARAM params[4] = { 0 };
+    OSSL_PARAM *p = params;
+    *p++ = OpensslOsslParamConstructUtf8String(OSSL_KDF_PARAM_DIGEST, (char *)impl->suite->mdName, 0);
+    *p++ = OpensslOsslParamConstructOctetString(OSSL_KDF_PARAM_KEY, secret->data, secret->len);
+    *p++ = OpensslOsslParamConstructOctetString(OSSL_KDF_PARAM_INFO, (void *)info, infoLen);
+    *p = OpensslOsslParamConstructEnd();
+    int ret = OpensslEvpKdfDerive(kctx, okm, impl->suite->keyLen + ENVELOPE_NONCE_LEN, params);
+    OpensslEvpKdfCtxFree(kctx);
+    if (ret != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to derive the content key.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static EVP_CIPHER_CTX *NewAeadCtx(const HcfEnvelopeOpensslSpiImpl *impl, const uint8_t *okm, int enc,
+    const HcfBlob *aad)
+{
+    EVP_CIPHER_CTX *ctx = OpensslEvpCipherCtxNew();
+    if (ctx == NULL) {
+        HcfPrintOpensslError();
+        return NULL;
+    }
+    int outLen = 0;
+    if ((OpensslEvpCipherInit(ctx, impl->cipher, okm, okm + impl->suite->keyLen, enc) != HCF_OPENSSL_SUCCESS) ||
+        ((aad != NULL) && (aad->len != 0) &&
+        (OpensslEvpCipherUpdate(ctx, NULL, &outLen, aad->data, (int)aad->len) != HCF_OPENSSL_SUCCESS))) {
+        HcfPrintOpensslError();
+        OpensslEvpCipherCtxFree(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static HcfResult AeadSeal(const HcfEnvelopeOpensslSpiImpl *impl, const uint8_t *okm, const HcfBlob *aad,
+    const HcfBlob *input, uint8_t *out)
+{
+    EVP_CIPHER_CTX *ctx = NewAeadCtx(impl, okm, 1, aad);
+    if (ctx == NULL) {
+        LOGE("Failed to init the AEAD ctx.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    int updateLen = 0;
+    int finalLen = 0;
+    if ((OpensslEvpCipherUpdate(ctx, out, &updateLen, input->data, (int)input->len) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpCipherFinalEx(ctx, out + updateLen, &finalLen) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpCipherCtxCtrl(ctx, EVP_CTRL_AEAD_GET_TAG, HCF_ENVELOPE_TAG_LEN, out + input->len) !=
+        HCF_OPENSSL_SUCCESS)) {
+        LOGE("Failed to seal the content.");
+        HcfPrintOpensslError();
+        OpensslEvpCipherCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    OpensslEvpCipherCtxFree(ctx);
+    return HCF_SUCCESS;
+}
+
+static HcfResult AeadOpen(const HcfEnvelopeOpensslSpiImpl *impl, const uint8_t *okm, const HcfBlob *aad,
+    const HcfBlob *sealed, uint8_t *out)
+{
+    EVP_CIPHER_CTX *ctx = NewAeadCtx(impl, okm, 0, aad);
+    if (ctx == NULL) {
+        LOGE("Failed to init the AEAD ctx.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    size_t ctLen = sealed->len - HCF_ENVELOPE_TAG_LEN;
+    int updateLen = 0;
+    int finalLen = 0;
+    if ((OpensslEvpCipherUpdate(ctx, out, &updateLen, sealed->data, (int)ctLen) != HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpCipherCtxCtrl(ctx, EVP_CTRL_AEAD_SET_TAG, HCF_ENVELOPE_TAG_LEN, sealed->data + ctLen) !=
+        HCF_OPENSSL_SUCCESS) ||
+        (OpensslEvpCipherFinalEx(ctx, out + updateLen, &finalLen) != HCF_OPENSSL_SUCCESS)) {
+        LOGE("Failed to open the content, the envelope or aad is not authentic.");
+        HcfPrintOpensslError();
+        OpensslEvpCipherCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    OpensslEvpCipherCtxFree(ctx);
+    return HCF_SUCCESS;
+}
+
+static bool IsEnvelopeSpiValid(HcfEnvelopeSpi *self, const HcfBlob *aad, const HcfBlob *data)
+{
+    if ((self == NULL) || !HcfIsClassMatch((HcfObjectBase *)self, GetEnvelopeSpiClass())) {
+        LOGE("Class is not match.");
+        return false;
+    }
+    if ((data->len > INT_MAX) || ((aad != NULL) && (aad->len > INT_MAX))) {
+        LOGE("The data or aad is too long.");
+        return false;
+    }
+    return true;
+}
+
+static HcfResult Encapsulate(const HcfEnvelopeOpensslSpiImpl *impl, HcfPubKey *pubKey, HcfBlob *returnEnc,
+    HcfBlob *returnSecret)
+{
+    EVP_PKEY *peer = NULL;
+    HcfResult ret = NewRecipientPubPkey(impl->suite->kemType, pubKey, &peer);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (impl->suite->kemType == ENVELOPE_KEM_RSA) {
+        ret = RsaEncapsulate(peer, returnEnc, returnSecret);
+    } else {
+        ret = DhEncapsulate(impl->suite->kemType, pubKey, peer, returnEnc, returnSecret);
+    }
+    OpensslEvpPkeyFree(peer);
+    return ret;
+}
+
+static HcfResult SealWithSecret(const HcfEnvelopeOpensslSpiImpl *impl, const HcfBlob *enc, const HcfBlob *secret,
+    const HcfBlob *aad, const HcfBlob *input, HcfBlob *returnEnvelope)
+{
+    size_t prefixLen = HCF_ENVELOPE_HEADER_LEN + enc->len;
+    size_t envelopeLen = prefixLen + input->len + HCF_ENVELOPE_TAG_LEN;
+    uint8_t *envelope = (uint8_t *)HcfMalloc(envelopeLen, 0);
+    if (envelope == NULL) {
+        LOGE("Failed to allocate envelope memory.");
+        return HCF_ERR_MALLOC;
+    }
+    envelope[0] = HCF_ENVELOPE_VERSION;
+    envelope[ENVELOPE_SUITE_ID_INDEX] = impl->suite->suiteId;
+    envelope[ENVELOPE_ENC_LEN_INDEX] = (uint8_t)(enc->len >> ENVELOPE_BITS_PER_BYTE);
+    envelope[ENVELOPE_ENC_LEN_INDEX + 1] = (uint8_t)(enc->len & ENVELOPE_BYTE_MASK);
+    (void)memcpy_s(envelope + HCF_ENVELOPE_HEADER_LEN, enc->len, enc->data, enc->len);
+
+    uint8_t okm[ENVELOPE_MAX_KEY_LEN + ENVELOPE_NONCE_LEN] = { 0 };
+    HcfResult ret = DeriveContentKey(impl, secret, envelope, prefixLen, okm);
+    if (ret == HCF_SUCCESS) {
+        ret = AeadSeal(impl, okm, aad, input, envelope + prefixLen);
+    }
+    (void)memset_s(okm, sizeof(okm), 0, sizeof(okm));
+    if (ret != HCF_SUCCESS) {
+        HcfFree(envelope);
+        return ret;
+    }
+    returnEnvelope->data = envelope;
+    returnEnvelope->len = envelopeLen;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSeal(HcfEnvelopeSpi *self, HcfPubKey *pubKey, const HcfBlob *aad, const HcfBlob *input,
+    HcfBlob *returnEnvelope)
+{
+    if (!IsEnvelopeSpiValid(self, aad, input)) {
+        return HCF_INVALID_PARAMS;
+    }
+    HcfEnvelopeOpensslSpiImpl *impl = (HcfEnvelopeOpensslSpiImpl *)self;
+    HcfBlob enc = { .data = NULL, .len = 0 };
+    HcfBlob secret = { .data = NULL, .len = 0 };
+    HcfResult ret = Encapsulate(impl, pubKey, &enc, &secret);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to encapsulate the shared secret.");
+        return ret;
+    }
+    ret = SealWithSecret(impl, &enc, &secret, aad, input, returnEnvelope);
+    HcfBlobDataClearAndFree(&secret);
+    HcfBlobDataFree(&enc);
+    return ret;
+}
+
+static HcfResult OpenWithSecret(const HcfEnvelopeOpensslSpiImpl *impl, const HcfBlob *secret, size_t prefixLen,
+    const HcfBlob *aad, const HcfBlob *envelope, HcfBlob *returnOutput)
+{
+    HcfBlob sealed = { .data = envelope->data + prefixLen, .len = envelope->len - prefixLen };
+    size_t outputLen = sealed.len - HCF_ENVELOPE_TAG_LEN;
+    uint8_t *output = (uint8_t *)HcfMalloc(outputLen, 0);
+    if (output == NULL) {
+        LOGE("Failed to allocate output memory.");
+        return HCF_ERR_MALLOC;
+    }
+    uint8_t okm[ENVELOPE_MAX_KEY_LEN + ENVELOPE_NONCE_LEN] = { 0 };
+    HcfResult ret = DeriveContentKey(impl, secret, envelope->data, prefixLen, okm);
+    if (ret == HCF_SUCCESS) {
+        ret = AeadOpen(impl, okm, aad, &sealed, output);
+    }
+    (void)memset_s(okm, sizeof(okm), 0, sizeof(okm));
+    if (ret != HCF_SUCCESS) {
+        (void)memset_s(output, outputLen, 0, outputLen);
+        HcfFree(output);
+        return ret;
+    }
+    returnOutput->data = output;
+    returnOutput->len = outputLen;
+    return HCF_SUCCESS;
+}
+
+static HcfResult ParseEnvelopeHeader(const EnvelopeSuite *suite, const HcfBlob *envelope, size_t *encLen)
+{
+    if (envelope->len <= HCF_ENVELOPE_HEADER_LEN + HCF_ENVELOPE_TAG_LEN) {
+        LOGE("The envelope is too short.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((envelope->data[0] != HCF_ENVELOPE_VERSION) || (envelope->data[ENVELOPE_SUITE_ID_INDEX] != suite->suiteId)) {
+        LOGE("The envelope version or suite does not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    size_t len = ((size_t)envelope->data[ENVELOPE_ENC_LEN_INDEX] << ENVELOPE_BITS_PER_BYTE) |
+        envelope->data[ENVELOPE_ENC_LEN_INDEX + 1];
+    if ((len == 0) || (envelope->len - HCF_ENVELOPE_HEADER_LEN - HCF_ENVELOPE_TAG_LEN <= len)) {
+        LOGE("The envelope encapsulation length is invalid.");
+        return HCF_INVALID_PARAMS;
+    }
+    *encLen = len;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineOpen(HcfEnvelopeSpi *self, HcfPriKey *priKey, const HcfBlob *aad, const HcfBlob *envelope,
+    HcfBlob *returnOutput)
+{
+    if (!IsEnvelopeSpiValid(self, aad, envelope)) {
+        return HCF_INVALID_PARAMS;
+    }
+    HcfEnvelopeOpensslSpiImpl *impl = (HcfEnvelopeOpensslSpiImpl *)self;
+    size_t encLen = 0;
+    HcfResult ret = ParseEnvelopeHeader(impl->suite, envelope, &encLen);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    HcfBlob secret = { .data = NULL, .len = 0 };
+    ret = Decapsulate(impl->suite->kemType, priKey, envelope->data + HCF_ENVELOPE_HEADER_LEN, encLen, &secret);
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to decapsulate the shared secret.");
+        return ret;
+    }
+    ret = OpenWithSecret(impl, &secret, HCF_ENVELOPE_HEADER_LEN + encLen, aad, envelope, returnOutput);
+    HcfBlobDataClearAndFree(&secret);
+    return ret;
+}
+
+static void DestroyEnvelopeSpi(HcfObjectBase *self)
+{
+    if (self == NULL) {
+        return;
+    }
+    if (!HcfIsClassMatch(self, GetEnvelopeSpiClass())) {
+        return;
+    }
+    HcfEnvelopeOpensslSpiImpl *impl = (HcfEnvelopeOpensslSpiImpl *)self;
+    OpensslEvpCipherFree(impl->cipher);
+    OpensslEvpKdfFree(impl->kdf);
+    HcfFree(impl);
+}
+
+HcfResult HcfEnvelopeSpiCreateOpenssl(const char *algoName, HcfEnvelopeSpi **returnObj)
+{
+    if ((algoName == NULL) || (returnObj == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    const EnvelopeSuite *suite = FindEnvelopeSuite(algoName);
+    if (suite == NULL) {
+        return HCF_NOT_SUPPORT;
+    }
+    HcfEnvelopeOpensslSpiImpl *impl = (HcfEnvelopeOpensslSpiImpl *)HcfMalloc(sizeof(HcfEnvelopeOpensslSpiImpl), 0);
+    if (impl == NULL) {
+        LOGE("Failed to allocate envelope spi memory.");
+        return HCF_ERR_MALLOC;
+    }
+    impl->suite = suite;
+    impl->cipher = OpensslEvpCipherFetch(NULL, suite->cipherName, NULL);
+    impl->kdf = OpensslEvpKdfFetch(NULL, "HKDF", NULL);
+    if ((impl->cipher == NULL) || (impl->kdf == NULL)) {
+        LOGE("Failed to fetch the envelope algorithms of %{public}s.", algoName);
+        HcfPrintOpensslError();
+        OpensslEvpCipherFree(impl->cipher);
+        OpensslEvpKdfFree(impl->kdf);
+        HcfFree(impl);
+        return HCF_NOT_SUPPORT;
+    }
+    impl->base.base.getClass = GetEnvelopeSpiClass;
+    impl->base.base.destroy = DestroyEnvelopeSpi;
+    impl->base.engineSeal = EngineSeal;
+    impl->base.engineOpen = EngineOpen;
+    *returnObj = (HcfEnvelopeSpi *)impl;
+    return HCF_SUCCESS;
+}
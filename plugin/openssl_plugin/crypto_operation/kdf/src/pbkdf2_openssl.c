@@ -23,8 +23,10 @@
 #include "openssl_adapter.h"
 #include "openssl_common.h"
 #include "detailed_pbkdf2_params.h"
+#include "hcf_parallel.h"
 
 #define PBKDF2_ALG_NAME "PBKDF2"
+#define PBKDF2_BLOCK_INDEX_LEN 4
 
 typedef struct {
     unsigned char *password;
@@ -34,8 +36,15 @@ typedef struct {
     int saltLen;
     unsigned char *out;
     int outLen;
+    uint32_t threadNum;
 } HcfKdfData;
 
+typedef struct {
+    HcfKdfData *data;
+    HMAC_CTX *keyedCtx;
+    uint32_t blockLen;
+} Pbkdf2ParallelJob;
+
 typedef struct {
     HcfKdfSpi base;
     const EVP_MD *digestAlg;
@@ -104,6 +113,10 @@ static bool CheckPBKDF2Params(HcfPBKDF2ParamsSpec *params)
         LOGE("invalid kdf iter");
         return false;
     }
+    if (params->threadNum > HCF_PARALLEL_MAX_WORKER_NUM) {
+        LOGE("invalid kdf thread num");
+        return false;
+    }
     // openssl only support INT and blob attribute is size_t, it should samller than INT_MAX.
     if (params->output.len > INT_MAX || params->salt.len > INT_MAX || params->password.len > INT_MAX) {
         LOGE("beyond the length");
@@ -183,6 +196,7 @@ static HcfResult InitPBKDF2Data(OpensslKdfSpiImpl *self, HcfPBKDF2ParamsSpec *pa
         }
         data->outLen = params->output.len;
         data->iter = params->iterations;
+        data->threadNum = params->threadNum;
         self->kdfData = data;
         return HCF_SUCCESS;
     } while (0);
@@ -190,11 +204,103 @@ static HcfResult InitPBKDF2Data(OpensslKdfSpiImpl *self, HcfPBKDF2ParamsSpec *pa
     return HCF_ERR_MALLOC;
 }
 
+// U1 = HMAC(P, S || INT(i)), Uj = HMAC(P, Uj-1), T = U1 ^ U2 ^ ... ^ Uc, see RFC 8018 section 5.2
+static HcfResult Pbkdf2Block(HMAC_CTX *ctx, const Pbkdf2ParallelJob *job, uint32_t blockIndex, unsigned char *t)
+{
+    unsigned char u[EVP_MAX_MD_SIZE] = { 0 };
+    unsigned char index[PBKDF2_BLOCK_INDEX_LEN] = {
+        (unsigned char)(blockIndex >> 24), (unsigned char)(blockIndex >> 16),
+        (unsigned char)(blockIndex >> 8), (unsigned char)blockIndex
+    };
+    unsigned int uLen = 0;
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    do {
+        if (OpensslHmacCtxCopy(ctx, job->keyedCtx) != HCF_OPENSSL_SUCCESS ||
+            OpensslHmacUpdate(ctx, job->data->salt, job->data->saltLen) != HCF_OPENSSL_SUCCESS ||
+            OpensslHmacUpdate(ctx, index, sizeof(index)) != HCF_OPENSSL_SUCCESS ||
+            OpensslHmacFinal(ctx, u, &uLen) != HCF_OPENSSL_SUCCESS) {
+            break;
+        }
+        (void)memcpy_s(t, job->blockLen, u, job->blockLen);
+        int i = 1;
+        for (; i < job->data->iter; i++) {
+            if (OpensslHmacCtxCopy(ctx, job->keyedCtx) != HCF_OPENSSL_SUCCESS ||
+                OpensslHmacUpdate(ctx, u, job->blockLen) != HCF_OPENSSL_SUCCESS ||
+                OpensslHmacFinal(ctx, u, &uLen) != HCF_OPENSSL_SUCCESS) {
+                break;
+            }
+            for (uint32_t k = 0; k < job->blockLen; k++) {
+                t[k] ^= u[k];
+            }
+        }
+        ret = (i == job->data->iter) ? HCF_SUCCESS : HCF_ERR_CRYPTO_OPERATION;
+    } while (0);
+    (void)memset_s(u, sizeof(u), 0, sizeof(u));
+    return ret;
+}
+
+static HcfResult Pbkdf2BlockTask(void *ctx, uint32_t taskIndex)
+{
+    Pbkdf2ParallelJob *job = (Pbkdf2ParallelJob *)ctx;
+    unsigned char t[EVP_MAX_MD_SIZE] = { 0 };
+    HMAC_CTX *hmacCtx = OpensslHmacCtxNew();
+    if (hmacCtx == NULL) {
+        LOGE("Failed to create hmac ctx.");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = Pbkdf2Block(hmacCtx, job, taskIndex + 1, t);
+    OpensslHmacCtxFree(hmacCtx);
+    if (ret == HCF_SUCCESS) {
+        uint32_t offset = taskIndex * job->blockLen;
+        uint32_t len = ((uint32_t)job->data->outLen - offset < job->blockLen) ?
+            (uint32_t)job->data->outLen - offset : job->blockLen;
+        (void)memcpy_s(job->data->out + offset, len, t, len);
+    }
+    (void)memset_s(t, sizeof(t), 0, sizeof(t));
+    return ret;
+}
+
+static HcfResult ParallelPBKDF2(OpensslKdfSpiImpl *self, uint32_t *blockNum)
+{
+    HcfKdfData *data = self->kdfData;
+    // PKCS5_PBKDF2_HMAC takes an empty password for a NULL one as well, HMAC needs a key pointer to accept the md
+    static const unsigned char emptyPassword[] = "";
+    const unsigned char *password = (data->password == NULL) ? emptyPassword : data->password;
+    Pbkdf2ParallelJob job = { .data = data, .keyedCtx = OpensslHmacCtxNew(), .blockLen = 0 };
+    if (job.keyedCtx == NULL) {
+        LOGE("Failed to create hmac ctx.");
+        return HCF_ERR_MALLOC;
+    }
+    if (OpensslHmacInitEx(job.keyedCtx, password, data->passwordLen, self->digestAlg, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("Failed to init hmac ctx.");
+        OpensslHmacCtxFree(job.keyedCtx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    job.blockLen = (uint32_t)OpensslHmacSize(job.keyedCtx);
+    *blockNum = ((uint32_t)data->outLen + job.blockLen - 1) / job.blockLen;
+    HcfResult ret = HCF_SUCCESS;
+    if (*blockNum > 1) {
+        ret = HcfParallelRun(*blockNum, data->threadNum, Pbkdf2BlockTask, &job);
+    }
+    OpensslHmacCtxFree(job.keyedCtx);
+    return ret;
+}
+
 static HcfResult OpensslPBKDF2(OpensslKdfSpiImpl *self, HcfPBKDF2ParamsSpec *params)
 {
     HcfKdfData *data = self->kdfData;
-    if (OpensslPkcs5Pbkdf2Hmac((char *)(data->password), data->passwordLen,
-        data->salt, data->saltLen, data->iter, self->digestAlg, data->outLen, data->out) != HCF_OPENSSL_SUCCESS) {
+    uint32_t blockNum = 0;
+    if (data->threadNum > 1) {
+        HcfResult ret = ParallelPBKDF2(self, &blockNum);
+        if (ret != HCF_SUCCESS) {
+            LOGE("Parallel pbkdf2 failed!");
+            return ret;
+        }
+    }
+    // a single block gains nothing from threads and runs the plain openssl derivation
+    if ((blockNum <= 1) && (OpensslPkcs5Pbkdf2Hmac((char *)(data->password), data->passwordLen,
+        data->salt, data->saltLen, data->iter, self->digestAlg, data->outLen, data->out) != HCF_OPENSSL_SUCCESS)) {
         HcfPrintOpensslError();
         LOGE("Pbkdf2 openssl failed!");
         return HCF_ERR_CRYPTO_OPERATION;
@@ -255,4 +361,4 @@ HcfResult HcfKdfPBKDF2SpiCreate(HcfKdfDeriveParams *params, HcfKdfSpi **spiObj)
     returnSpiImpl->digestAlg = md;
     *spiObj = (HcfKdfSpi *)returnSpiImpl;
     return HCF_SUCCESS;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -24,8 +24,15 @@
 #include "openssl_common.h"
 #include "openssl/kdf.h"
 #include "detailed_scrypt_params.h"
+#include "hcf_parallel.h"
 
 #define SCRYPT_ALG_NAME "SCRYPT"
+// same limits as the openssl scrypt implementation, so both paths accept the same parameters
+#define SCRYPT_PR_MAX ((1 << 30) - 1)
+#define SCRYPT_LOG2_UINT64_MAX 63
+#define SCRYPT_BLOCK_WORDS 16
+#define SCRYPT_LANE_WORDS_PER_R 32
+#define SCRYPT_LANE_BYTES_PER_R 128
 
 typedef struct {
     unsigned char *salt;
@@ -38,8 +45,15 @@ typedef struct {
     uint64_t maxBytes;
     unsigned char *out;
     int outLen;
+    uint32_t threadNum;
 } HcfScryptData;
 
+typedef struct {
+    const HcfScryptData *data;
+    unsigned char *lanes;
+    uint32_t taskNum;
+} ScryptParallelJob;
+
 typedef struct {
     HcfKdfSpi base;
     HcfScryptData *kdfData;
@@ -101,6 +115,10 @@ static bool CheckScryptParams(HcfScryptParamsSpec *params)
             LOGE("beyond the length");
             return false;
     }
+    if (params->threadNum > HCF_PARALLEL_MAX_WORKER_NUM) {
+        LOGE("check params failed, invalid thread num");
+        return false;
+    }
     if (params->passPhrase.data == NULL && params->passPhrase.len == 0) {
         LOGE("check params failed, passPhrase is NULL");
         return false;
@@ -176,6 +194,7 @@ static HcfResult InitScryptData(OpensslScryptSpiImpl *self, HcfScryptParamsSpec
         data->r = params->r;
         data->maxBytes = params->maxMem;
         data->outLen = (int)params->output.len;
+        data->threadNum = params->threadNum;
         self->kdfData = data;
         return HCF_SUCCESS;
     } while (0);
@@ -222,6 +241,173 @@ static HcfResult OpensslScrypt(OpensslScryptSpiImpl *self, HcfBlob *output)
     return HCF_SUCCESS;
 }
 
+static inline uint32_t ScryptRotl(uint32_t a, uint32_t b)
+{
+    return (a << b) | (a >> (32 - b));
+}
+
+static inline void ScryptQuarterRound(uint32_t *x, int a, int b, int c, int d)
+{
+    x[b] ^= ScryptRotl(x[a] + x[d], 7);
+    x[c] ^= ScryptRotl(x[b] + x[a], 9);
+    x[d] ^= ScryptRotl(x[c] + x[b], 13);
+    x[a] ^= ScryptRotl(x[d] + x[c], 18);
+}
+
+static void Salsa208(uint32_t *block)
+{
+    uint32_t x[SCRYPT_BLOCK_WORDS];
+    for (int i = 0; i < SCRYPT_BLOCK_WORDS; i++) {
+        x[i] = block[i];
+    }
+    for (int i = 0; i < 4; i++) {
+        ScryptQuarterRound(x, 0, 4, 8, 12);
+        ScryptQuarterRound(x, 5, 9, 13, 1);
+        ScryptQuarterRound(x, 10, 14, 2, 6);
+        ScryptQuarterRound(x, 15, 3, 7, 11);
+        ScryptQuarterRound(x, 0, 1, 2, 3);
+        ScryptQuarterRound(x, 5, 6, 7, 4);
+        ScryptQuarterRound(x, 10, 11, 8, 9);
+        ScryptQuarterRound(x, 15, 12, 13, 14);
+    }
+    for (int i = 0; i < SCRYPT_BLOCK_WORDS; i++) {
+        block[i] += x[i];
+    }
+    (void)memset_s(x, sizeof(x), 0, sizeof(x));
+}
+
+static void ScryptBlockMix(uint32_t *out, const uint32_t *in, uint64_t r)
+{
+    uint32_t x[SCRYPT_BLOCK_WORDS];
+    const uint32_t *last = in + (2 * r - 1) * SCRYPT_BLOCK_WORDS;
+    for (int j = 0; j < SCRYPT_BLOCK_WORDS; j++) {
+        x[j] = last[j];
+    }
+    for (uint64_t i = 0; i < 2 * r; i++) {
+        for (int j = 0; j < SCRYPT_BLOCK_WORDS; j++) {
+            x[j] ^= in[i * SCRYPT_BLOCK_WORDS + j];
+        }
+        Salsa208(x);
+        // even blocks go to the first half of the output, odd blocks to the second half
+        uint32_t *dst = out + (i / 2 + (i & 1) * r) * SCRYPT_BLOCK_WORDS;
+        for (int j = 0; j < SCRYPT_BLOCK_WORDS; j++) {
+            dst[j] = x[j];
+        }
+    }
+    (void)memset_s(x, sizeof(x), 0, sizeof(x));
+}
+
+// scrypt ROMix of RFC 7914 section 5, x and t hold 32 * r words and v holds 32 * r * n words
+static void ScryptRoMix(unsigned char *lane, uint64_t r, uint64_t n, uint32_t *x, uint32_t *t, uint32_t *v)
+{
+    uint64_t laneWords = SCRYPT_LANE_WORDS_PER_R * r;
+    for (uint64_t i = 0; i < laneWords; i++) {
+        const unsigned char *in = lane + i * sizeof(uint32_t);
+        v[i] = (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+    }
+    for (uint64_t i = 1; i < n; i++) {
+        ScryptBlockMix(v + i * laneWords, v + (i - 1) * laneWords, r);
+    }
+    ScryptBlockMix(x, v + (n - 1) * laneWords, r);
+    for (uint64_t i = 0; i < n; i++) {
+        uint64_t j = x[SCRYPT_BLOCK_WORDS * (2 * r - 1)] % n;
+        for (uint64_t k = 0; k < laneWords; k++) {
+            t[k] = x[k] ^ v[j * laneWords + k];
+        }
+        ScryptBlockMix(x, t, r);
+    }
+    for (uint64_t i = 0; i < laneWords; i++) {
+        unsigned char *out = lane + i * sizeof(uint32_t);
+        out[0] = (unsigned char)x[i];
+        out[1] = (unsigned char)(x[i] >> 8);
+        out[2] = (unsigned char)(x[i] >> 16);
+        out[3] = (unsigned char)(x[i] >> 24);
+    }
+}
+
+static HcfResult ScryptLaneTask(void *ctx, uint32_t taskIndex)
+{
+    ScryptParallelJob *job = (ScryptParallelJob *)ctx;
+    uint64_t r = job->data->r;
+    uint64_t n = job->data->n;
+    uint32_t scratchLen = (uint32_t)(SCRYPT_LANE_BYTES_PER_R * r * (n + 2));
+    uint32_t *v = (uint32_t *)HcfMalloc(scratchLen, 0);
+    if (v == NULL) {
+        LOGE("Failed to allocate scrypt scratch memory.");
+        return HCF_ERR_MALLOC;
+    }
+    uint32_t *x = v + SCRYPT_LANE_WORDS_PER_R * r * n;
+    uint32_t *t = x + SCRYPT_LANE_WORDS_PER_R * r;
+    for (uint64_t lane = taskIndex; lane < job->data->p; lane += job->taskNum) {
+        ScryptRoMix(job->lanes + lane * SCRYPT_LANE_BYTES_PER_R * r, r, n, x, t, v);
+    }
+    (void)memset_s(v, scratchLen, 0, scratchLen);
+    HcfFree(v);
+    return HCF_SUCCESS;
+}
+
+// Returns how many lanes can be mixed at once within maxmem, 0 if the parameters are left to openssl.
+static uint32_t GetScryptTaskNum(const HcfScryptData *data)
+{
+    uint64_t n = data->n;
+    uint64_t r = data->r;
+    uint64_t p = data->p;
+    if ((data->threadNum < 2) || (p < 2) || (r == 0) || (n < 2) || ((n & (n - 1)) != 0) ||
+        (p > SCRYPT_PR_MAX / r) || (data->maxBytes == 0)) {
+        return 0;
+    }
+    if ((SCRYPT_BLOCK_WORDS * r <= SCRYPT_LOG2_UINT64_MAX) && (n >= ((uint64_t)1 << (SCRYPT_BLOCK_WORDS * r)))) {
+        return 0;
+    }
+    uint64_t laneLen = SCRYPT_LANE_BYTES_PER_R * r;
+    if (n + 2 > INT_MAX / laneLen) {
+        return 0;
+    }
+    uint64_t lanesLen = laneLen * p;
+    uint64_t scratchLen = laneLen * (n + 2);
+    if ((lanesLen > INT_MAX) || (lanesLen + scratchLen > data->maxBytes)) {
+        return 0;
+    }
+    uint64_t taskNum = (data->maxBytes - lanesLen) / scratchLen;
+    taskNum = (taskNum < data->threadNum) ? taskNum : data->threadNum;
+    taskNum = (taskNum < p) ? taskNum : p;
+    return (taskNum < 2) ? 0 : (uint32_t)taskNum;
+}
+
+// B = PBKDF2-SHA256(P, S, 1, p * 128 * r), ROMix on every lane of B, DK = PBKDF2-SHA256(P, B, 1, dkLen)
+static HcfResult ParallelScrypt(const HcfScryptData *data, uint32_t taskNum, HcfBlob *output)
+{
+    int lanesLen = (int)(SCRYPT_LANE_BYTES_PER_R * data->r * data->p);
+    ScryptParallelJob job = { .data = data, .lanes = (unsigned char *)HcfMalloc(lanesLen, 0), .taskNum = taskNum };
+    if (job.lanes == NULL) {
+        LOGE("Failed to allocate scrypt lanes.");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    do {
+        if (OpensslPkcs5Pbkdf2Hmac((const char *)data->password, data->passwordLen, data->salt, data->saltLen, 1,
+            OpensslEvpSha256(), lanesLen, job.lanes) != HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("Failed to expand scrypt lanes.");
+            break;
+        }
+        ret = HcfParallelRun(taskNum, taskNum, ScryptLaneTask, &job);
+        if (ret != HCF_SUCCESS) {
+            LOGE("Failed to mix scrypt lanes.");
+            break;
+        }
+        if (OpensslPkcs5Pbkdf2Hmac((const char *)data->password, data->passwordLen, job.lanes, lanesLen, 1,
+            OpensslEvpSha256(), (int)output->len, output->data) != HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("Failed to compress scrypt lanes.");
+            ret = HCF_ERR_CRYPTO_OPERATION;
+        }
+    } while (0);
+    (void)memset_s(job.lanes, lanesLen, 0, lanesLen);
+    HcfFree(job.lanes);
+    return ret;
+}
+
 static HcfResult EngineGenerateSecret(HcfKdfSpi *self, HcfKdfParamsSpec *paramsSpec)
 {
     if (self == NULL || paramsSpec == NULL) {
@@ -246,7 +432,12 @@ static HcfResult EngineGenerateSecret(HcfKdfSpi *self, HcfKdfParamsSpec *paramsS
         LOGE("Failed to initialize scrypt data.");
         return res;
     }
-    res = OpensslScrypt(scryptImpl, &params->output);
+    uint32_t taskNum = GetScryptTaskNum(scryptImpl->kdfData);
+    if (taskNum > 0) {
+        res = ParallelScrypt(scryptImpl->kdfData, taskNum, &params->output);
+    } else {
+        res = OpensslScrypt(scryptImpl, &params->output);
+    }
     FreeScryptData(&(scryptImpl->kdfData));
     return res;
 }
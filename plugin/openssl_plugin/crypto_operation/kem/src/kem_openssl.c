@@ -20,6 +20,7 @@
 #include <securec.h>
 
 #include "config.h"
+#include "hcf_parallel.h"
 #include "log.h"
 #include "memory.h"
 #include "openssl_adapter.h"
@@ -27,11 +28,29 @@
 #include "openssl_common.h"
 #include "utils.h"
 
+#define ML_KEM_SHARED_SECRET_LEN 32
+#define ML_KEM_512_WRAPPED_KEY_LEN 768
+#define ML_KEM_768_WRAPPED_KEY_LEN 1088
+#define ML_KEM_1024_WRAPPED_KEY_LEN 1568
+
 typedef struct {
     HcfKemSpi base;
     char algoName[HCF_MAX_ALGO_NAME_LEN];
 } HcfKemOpensslSpiImpl;
 
+typedef struct {
+    HcfPubKey **pubKeys;
+    EVP_PKEY *priPkey;
+    const char *opensslAlgoName;
+    const uint8_t *wrappedKeyInput;
+    uint8_t *sharedSecrets;
+    uint8_t *wrappedKeys;
+    uint32_t count;
+    uint32_t rangeNum;
+    uint32_t sharedSecretLen;
+    uint32_t wrappedKeyLen;
+} KemBatchCtx;
+
 static const char *GetKemSpiClass(void)
 {
     return "HcfKemOpensslSpi";
@@ -56,6 +75,20 @@ static const char *GetOpensslKemAlgoName(const char *hcfAlgoName)
     return NULL;
 }
 
+static uint32_t GetMlKemWrappedKeyLen(const char *hcfAlgoName)
+{
+    if (strcmp(hcfAlgoName, "ML-KEM512") == 0) {
+        return ML_KEM_512_WRAPPED_KEY_LEN;
+    }
+    if (strcmp(hcfAlgoName, "ML-KEM768") == 0) {
+        return ML_KEM_768_WRAPPED_KEY_LEN;
+    }
+    if (strcmp(hcfAlgoName, "ML-KEM1024") == 0) {
+        return ML_KEM_1024_WRAPPED_KEY_LEN;
+    }
+    return 0;
+}
+
 static HcfResult CheckKemAlgoMatch(EVP_PKEY *pkey, const char *opensslAlgoName)
 {
     if (pkey == NULL || opensslAlgoName == NULL) {
@@ -253,6 +286,216 @@ static HcfResult EngineDecapsulate(HcfKemSpi *self, HcfPriKey *priKey, const Hcf
     return ret;
 }
 
+static HcfResult EngineGetOutputLen(HcfKemSpi *self, uint32_t *sharedSecretLen, uint32_t *wrappedKeyLen)
+{
+    if (self == NULL || sharedSecretLen == NULL || wrappedKeyLen == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetKemSpiClass())) {
+        LOGE("Class is not match.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    uint32_t len = GetMlKemWrappedKeyLen(((HcfKemOpensslSpiImpl *)self)->algoName);
+    if (len == 0) {
+        LOGE("Unsupported KEM algorithm.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    *sharedSecretLen = ML_KEM_SHARED_SECRET_LEN;
+    *wrappedKeyLen = len;
+    return HCF_SUCCESS;
+}
+
+static HcfResult NewKemBatchCtx(EVP_PKEY *pkey, const char *opensslAlgoName, bool isEncapsulate,
+    EVP_PKEY_CTX **returnCtx)
+{
+    HcfResult ret = CheckKemAlgoMatch(pkey, opensslAlgoName);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxNewFromPkey(NULL, pkey, NULL);
+    if (ctx == NULL) {
+        LOGE("Failed to create EVP_PKEY_CTX.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (isEncapsulate) {
+        ret = KemEncapsulateInit(ctx, NULL);
+    } else if (EVP_PKEY_decapsulate_init(ctx, NULL) != HCF_OPENSSL_SUCCESS) {
+        LOGE("EVP_PKEY_decapsulate_init failed.");
+        HcfPrintOpensslError();
+        ret = HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (ret != HCF_SUCCESS) {
+        OpensslEvpPkeyCtxFree(ctx);
+        return ret;
+    }
+    *returnCtx = ctx;
+    return HCF_SUCCESS;
+}
+
+/* Range taskIndex of the batch, the ranges differ in size by at most one entry. */
+static void GetKemBatchRange(const KemBatchCtx *batch, uint32_t taskIndex, uint32_t *start, uint32_t *end)
+{
+    *start = (uint32_t)((uint64_t)batch->count * taskIndex / batch->rangeNum);
+    *end = (uint32_t)((uint64_t)batch->count * (taskIndex + 1) / batch->rangeNum);
+}
+
+static HcfResult KemEncapsulateOne(EVP_PKEY_CTX *ctx, const KemBatchCtx *batch, uint32_t index)
+{
+    size_t wrappedKeyLen = batch->wrappedKeyLen;
+    size_t sharedSecretLen = batch->sharedSecretLen;
+    if (EVP_PKEY_encapsulate(ctx, batch->wrappedKeys + (size_t)index * batch->wrappedKeyLen, &wrappedKeyLen,
+        batch->sharedSecrets + (size_t)index * batch->sharedSecretLen, &sharedSecretLen) != HCF_OPENSSL_SUCCESS) {
+        LOGE("ML-KEM encapsulate failed.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (wrappedKeyLen != batch->wrappedKeyLen || sharedSecretLen != batch->sharedSecretLen) {
+        LOGE("Unexpected encapsulate output length.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult KemEncapsulateRange(void *arg, uint32_t taskIndex)
+{
+    const KemBatchCtx *batch = (const KemBatchCtx *)arg;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    GetKemBatchRange(batch, taskIndex, &start, &end);
+    EVP_PKEY_CTX *ctx = NULL;
+    EVP_PKEY *ctxPkey = NULL;
+    HcfResult ret = HCF_SUCCESS;
+    for (uint32_t i = start; (i < end) && (ret == HCF_SUCCESS); i++) {
+        EVP_PKEY *pkey = ((HcfOpensslMlKemPubKey *)batch->pubKeys[i])->pkey;
+        if (pkey != ctxPkey) {
+            OpensslEvpPkeyCtxFree(ctx);
+            ctx = NULL;
+            ctxPkey = NULL;
+            ret = NewKemBatchCtx(pkey, batch->opensslAlgoName, true, &ctx);
+            if (ret != HCF_SUCCESS) {
+                break;
+            }
+            ctxPkey = pkey;
+        }
+        ret = KemEncapsulateOne(ctx, batch, i);
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult KemDecapsulateRange(void *arg, uint32_t taskIndex)
+{
+    const KemBatchCtx *batch = (const KemBatchCtx *)arg;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    GetKemBatchRange(batch, taskIndex, &start, &end);
+    EVP_PKEY_CTX *ctx = NULL;
+    HcfResult ret = NewKemBatchCtx(batch->priPkey, batch->opensslAlgoName, false, &ctx);
+    for (uint32_t i = start; (i < end) && (ret == HCF_SUCCESS); i++) {
+        size_t sharedSecretLen = batch->sharedSecretLen;
+        if (EVP_PKEY_decapsulate(ctx, batch->sharedSecrets + (size_t)i * batch->sharedSecretLen, &sharedSecretLen,
+            batch->wrappedKeyInput + (size_t)i * batch->wrappedKeyLen, batch->wrappedKeyLen) != HCF_OPENSSL_SUCCESS ||
+            sharedSecretLen != batch->sharedSecretLen) {
+            LOGE("ML-KEM decapsulate failed.");
+            HcfPrintOpensslError();
+            ret = HCF_ERR_CRYPTO_OPERATION;
+        }
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult RunKemBatch(KemBatchCtx *batch, uint32_t workerNum, HcfParallelTaskFunc func)
+{
+    if (workerNum <= 1) {
+        batch->rangeNum = 1;
+        return func(batch, 0);
+    }
+    batch->rangeNum = (workerNum < batch->count) ? workerNum : batch->count;
+    return HcfParallelRun(batch->rangeNum, batch->rangeNum, func, batch);
+}
+
+static HcfResult InitKemBatchCtx(HcfKemSpi *self, uint32_t count, KemBatchCtx *batch)
+{
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetKemSpiClass())) {
+        LOGE("Class is not match.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    batch->opensslAlgoName = GetOpensslKemAlgoName(((HcfKemOpensslSpiImpl *)self)->algoName);
+    if (batch->opensslAlgoName == NULL) {
+        LOGE("Failed to get OpenSSL KEM algorithm name.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    batch->count = count;
+    return EngineGetOutputLen(self, &batch->sharedSecretLen, &batch->wrappedKeyLen);
+}
+
+static HcfResult EngineEncapsulateBatch(HcfKemSpi *self, HcfPubKey **pubKeys, uint32_t count, uint32_t workerNum,
+    HcfBlob *sharedSecrets, HcfBlob *wrappedKeys)
+{
+    if (self == NULL || pubKeys == NULL || count == 0 || sharedSecrets == NULL || wrappedKeys == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    KemBatchCtx batch = { 0 };
+    HcfResult ret = InitKemBatchCtx(self, count, &batch);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (sharedSecrets->len != (size_t)count * batch.sharedSecretLen ||
+        wrappedKeys->len != (size_t)count * batch.wrappedKeyLen) {
+        LOGE("Invalid batch output length.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!HcfIsClassMatch((HcfObjectBase *)pubKeys[i], OPENSSL_ML_KEM_PUBKEY_CLASS)) {
+            LOGE("Class of pubKey %{public}u is not match.", i);
+            return HCF_ERR_PARAMETER_CHECK_FAILED;
+        }
+    }
+    batch.pubKeys = pubKeys;
+    batch.sharedSecrets = sharedSecrets->data;
+    batch.wrappedKeys = wrappedKeys->data;
+    ret = RunKemBatch(&batch, workerNum, KemEncapsulateRange);
+    if (ret != HCF_SUCCESS) {
+        (void)memset_s(sharedSecrets->data, sharedSecrets->len, 0, sharedSecrets->len);
+        (void)memset_s(wrappedKeys->data, wrappedKeys->len, 0, wrappedKeys->len);
+    }
+    return ret;
+}
+
+static HcfResult EngineDecapsulateBatch(HcfKemSpi *self, HcfPriKey *priKey, const HcfBlob *wrappedKeys,
+    uint32_t count, uint32_t workerNum, HcfBlob *sharedSecrets)
+{
+    if (self == NULL || priKey == NULL || wrappedKeys == NULL || count == 0 || sharedSecrets == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)priKey, OPENSSL_ML_KEM_PRIKEY_CLASS)) {
+        LOGE("Class is not match.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    KemBatchCtx batch = { 0 };
+    HcfResult ret = InitKemBatchCtx(self, count, &batch);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (wrappedKeys->len != (size_t)count * batch.wrappedKeyLen ||
+        sharedSecrets->len != (size_t)count * batch.sharedSecretLen) {
+        LOGE("Invalid batch buffer length.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    batch.priPkey = ((HcfOpensslMlKemPriKey *)priKey)->pkey;
+    batch.wrappedKeyInput = wrappedKeys->data;
+    batch.sharedSecrets = sharedSecrets->data;
+    ret = RunKemBatch(&batch, workerNum, KemDecapsulateRange);
+    if (ret != HCF_SUCCESS) {
+        (void)memset_s(sharedSecrets->data, sharedSecrets->len, 0, sharedSecrets->len);
+    }
+    return ret;
+}
+
 static void DestroyKemSpi(HcfObjectBase *self)
 {
     if (self == NULL) {
@@ -286,6 +529,9 @@ HcfResult HcfKemSpiCreateOpenssl(const char *algoName, HcfKemSpi **returnObj)
     impl->base.base.destroy = DestroyKemSpi;
     impl->base.engineEncapsulate = EngineEncapsulate;
     impl->base.engineDecapsulate = EngineDecapsulate;
+    impl->base.engineGetOutputLen = EngineGetOutputLen;
+    impl->base.engineEncapsulateBatch = EngineEncapsulateBatch;
+    impl->base.engineDecapsulateBatch = EngineDecapsulateBatch;
     *returnObj = (HcfKemSpi *)impl;
     return HCF_SUCCESS;
 }
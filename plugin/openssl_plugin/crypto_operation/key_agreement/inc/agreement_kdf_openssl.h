@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_AGREEMENT_KDF_OPENSSL_H
+#define HCF_AGREEMENT_KDF_OPENSSL_H
+
+#include <stdbool.h>
+#include <openssl/evp.h>
+
+#include "blob.h"
+#include "key_agreement.h"
+#include "result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Agrees the shared secret of priKey and pubKey on the stack and derives the key of spec from it.
+ *
+ * validatePeer has the meaning of KeyDerive and KeyDeriveWithCheckedPeer. The EVP_KDF is fetched once per process.
+ */
+HcfResult HcfAgreementKdfDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, bool validatePeer,
+    const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "agreement_kdf_openssl.h"
+
+#include <pthread.h>
+#include <string.h>
+#include <openssl/core_names.h>
+#include <securec.h>
+
+#include "config.h"
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+#include "utils.h"
+
+/* Holds the shared secret of the groups up to 8192 bits, the larger DH keys take a buffer of EVP_PKEY_get_size. */
+#define AGREEMENT_STACK_SECRET_LEN 1024
+#define AGREEMENT_KDF_MAX_PARAMS_NUM 5
+
+typedef struct {
+    const char *mdName;
+    bool x963Supported;
+} AgreementKdfMd;
+
+static const AgreementKdfMd AGREEMENT_KDF_MD_SET[] = {
+    { "SHA1", true },
+    { "SHA224", true },
+    { "SHA256", true },
+    { "SHA384", true },
+    { "SHA512", true },
+    { "SM3", false },
+};
+
+static pthread_once_t g_agreementKdfOnce = PTHREAD_ONCE_INIT;
+static EVP_KDF *g_hkdf = NULL;
+static EVP_KDF *g_x963kdf = NULL;
+
+static void FetchAgreementKdfs(void)
+{
+    g_hkdf = OpensslEvpKdfFetch(NULL, "HKDF", NULL);
+    g_x963kdf = OpensslEvpKdfFetch(NULL, "X963KDF", NULL);
+}
+
+static bool IsOptionalBlobValid(const HcfBlob *blob)
+{
+    return (blob->len == 0) || (blob->data != NULL);
+}
+
+static bool IsKdfMdSupported(const char *mdName, bool isX963)
+{
+    for (uint32_t i = 0; i < sizeof(AGREEMENT_KDF_MD_SET) / sizeof(AGREEMENT_KDF_MD_SET[0]); i++) {
+        if (strcmp(AGREEMENT_KDF_MD_SET[i].mdName, mdName) == 0) {
+            return !isX963 || AGREEMENT_KDF_MD_SET[i].x963Supported;
+        }
+    }
+    return false;
+}
+
+static HcfResult CheckKdfSpec(const HcfKeyAgreementKdfSpec *spec, bool *isX963)
+{
+    if (!HcfIsStrValid(spec->algName, HCF_MAX_ALGO_NAME_LEN) || !HcfIsStrValid(spec->mdName, HCF_MAX_ALGO_NAME_LEN) ||
+        !IsOptionalBlobValid(&spec->salt) || !IsOptionalBlobValid(&spec->info)) {
+        LOGE("Invalid kdf spec.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((spec->keyLen == 0) || (spec->keyLen > HCF_KEY_AGREEMENT_MAX_DERIVED_KEY_LEN)) {
+        LOGE("Invalid derived key len %{public}u.", spec->keyLen);
+        return HCF_INVALID_PARAMS;
+    }
+    if (strcmp(spec->algName, "HKDF") == 0) {
+        *isX963 = false;
+    } else if (strcmp(spec->algName, "X963KDF") == 0) {
+        *isX963 = true;
+    } else {
+        LOGE("Not support kdf %{public}s.", spec->algName);
+        return HCF_INVALID_PARAMS;
+    }
+    if (*isX963 && (spec->salt.len != 0)) {
+        LOGE("X963KDF does not take a salt.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!IsKdfMdSupported(spec->mdName, *isX963)) {
+        LOGE("Not support kdf digest %{public}s.", spec->mdName);
+        return HCF_INVALID_PARAMS;
+    }
+    return HCF_SUCCESS;
+}
+
+static EVP_KDF_CTX *NewKdfCtx(bool isX963)
+{
+    (void)pthread_once(&g_agreementKdfOnce, FetchAgreementKdfs);
+    EVP_KDF *kdf = isX963 ? g_x963kdf : g_hkdf;
+    if (kdf != NULL) {
+        return OpensslEvpKdfCtxNew(kdf);
+    }
+    /* The process wide fetch failed, fall back to a fetch of this call only. */
+    kdf = OpensslEvpKdfFetch(NULL, isX963 ? "X963KDF" : "HKDF", NULL);
+    if (kdf == NULL) {
+        LOGE("kdf fetch failed");
+        return NULL;
+    }
+    EVP_KDF_CTX *kctx = OpensslEvpKdfCtxNew(kdf);
+    OpensslEvpKdfFree(kdf);
+    return kctx;
+}
+
+static HcfResult KdfDerive(const HcfKeyAgreementKdfSpec *spec, bool isX963, uint8_t *secret, size_t secretLen,
+    uint8_t *out)
+{
+    EVP_KDF_CTX *kctx = NewKdfCtx(isX963);
+    if (kctx == NULL) {
+        LOGE("kdf ctx new failed");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    OSSL_PARAM params[AGREEMENT_KDF_MAX_PARAMS_NUM] = { 0 };
+    OSSL_PARAM *p = params;
+    *p++ = OpensslOsslParamConstructUtf8String(OSSL_KDF_PARAM_DIGEST, (char *)spec->mdName, 0);
+    *p++ = OpensslOsslParamConstructOctetString(OSSL_KDF_PARAM_KEY, secret, secretLen);
+    if (spec->salt.len != 0) {
+        *p++ = OpensslOsslParamConstructOctetString(OSSL_KDF_PARAM_SALT, spec->salt.data, spec->salt.len);
+    }
+    if (spec->info.len != 0) {
+        *p++ = OpensslOsslParamConstructOctetString(OSSL_KDF_PARAM_INFO, spec->info.data, spec->info.len);
+    }
+    *p = OpensslOsslParamConstructEnd();
+    HcfResult ret = HCF_SUCCESS;
+    if (OpensslEvpKdfDerive(kctx, out, spec->keyLen, params) <= 0) {
+        HcfPrintOpensslError();
+        LOGE("EVP_KDF_derive failed");
+        ret = HCF_ERR_CRYPTO_OPERATION;
+    }
+    OpensslEvpKdfCtxFree(kctx);
+    return ret;
+}
+
+HcfResult HcfAgreementKdfDerive(EVP_PKEY *priKey, EVP_PKEY *pubKey, bool validatePeer,
+    const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey)
+{
+    bool isX963 = false;
+    HcfResult ret = CheckKdfSpec(spec, &isX963);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    uint8_t *out = (uint8_t *)HcfMalloc(spec->keyLen, 0);
+    if (out == NULL) {
+        LOGE("Failed to allocate derived key memory!");
+        return HCF_ERR_MALLOC;
+    }
+    uint8_t stackSecret[AGREEMENT_STACK_SECRET_LEN];
+    uint8_t *secret = stackSecret;
+    size_t bufferLen = sizeof(stackSecret);
+    int keySize = OpensslEvpPkeyGetSize(priKey);
+    if ((keySize > 0) && ((size_t)keySize > bufferLen)) {
+        bufferLen = (size_t)keySize;
+        secret = (uint8_t *)HcfMalloc(bufferLen, 0);
+    }
+    if (secret == NULL) {
+        LOGE("Failed to allocate secret memory!");
+        ret = HCF_ERR_MALLOC;
+    } else {
+        size_t secretLen = bufferLen;
+        ret = KeyDeriveToBuffer(priKey, pubKey, validatePeer, secret, &secretLen);
+        if (ret == HCF_SUCCESS) {
+            ret = KdfDerive(spec, isX963, secret, secretLen, out);
+        }
+        (void)memset_s(secret, bufferLen, 0, bufferLen);
+        if (secret != stackSecret) {
+            HcfFree(secret);
+        }
+    }
+    if (ret != HCF_SUCCESS) {
+        (void)memset_s(out, spec->keyLen, 0, spec->keyLen);
+        HcfFree(out);
+        return ret;
+    }
+    returnKey->data = out;
+    returnKey->len = spec->keyLen;
+    return HCF_SUCCESS;
+}
@@ -19,6 +19,7 @@
 #include <openssl/bio.h>
 #include <openssl/err.h>
 
+#include "agreement_kdf_openssl.h"
 #include "algorithm_parameter.h"
 #include "openssl_adapter.h"
 #include "openssl_class.h"
@@ -49,31 +50,75 @@ static void DestroyDh(HcfObjectBase *self)
     HcfFree(self);
 }
 
-static HcfResult EngineGenerateSecret(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
-    HcfPubKey *pubKey, HcfBlob *returnSecret)
+/* Peers of a cached named group are validated with the cheaper group check instead of the generic one. */
+static bool IsDhPeerInNamedGroup(const DH *pk)
 {
-    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (returnSecret == NULL)) {
-        LOGE("Invalid input parameter.");
-        return HCF_INVALID_PARAMS;
+    const HcfDhNamedGroup *group = FindDhNamedGroupByParams(OpensslDhGet0P(pk), OpensslDhGet0G(pk));
+    if (group == NULL) {
+        return false;
     }
+    return CheckDhNamedGroupPubKey(group, OpensslDhGet0PubKey(pk)) == HCF_SUCCESS;
+}
+
+static HcfResult NewDhPKeys(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    EVP_PKEY **priPKey, EVP_PKEY **pubPKey)
+{
     if ((!HcfIsClassMatch((HcfObjectBase *)self, GetDhClass())) ||
         (!HcfIsClassMatch((HcfObjectBase *)priKey, OPENSSL_DH_PRIKEY_CLASS)) ||
         (!HcfIsClassMatch((HcfObjectBase *)pubKey, OPENSSL_DH_PUBKEY_CLASS))) {
         LOGE("Invalid class of self.");
         return HCF_INVALID_PARAMS;
     }
-    EVP_PKEY *pubPKey = NewEvpPkeyByDh(((HcfOpensslDhPubKey *)pubKey)->pk, true);
-    if (pubPKey == NULL) {
+    *pubPKey = NewEvpPkeyByDh(((HcfOpensslDhPubKey *)pubKey)->pk, true);
+    if (*pubPKey == NULL) {
         LOGE("Failed to get public pkey.");
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    EVP_PKEY *priPKey = NewEvpPkeyByDh(((HcfOpensslDhPriKey *)priKey)->sk, true);
-    if (priPKey == NULL) {
+    *priPKey = NewEvpPkeyByDh(((HcfOpensslDhPriKey *)priKey)->sk, true);
+    if (*priPKey == NULL) {
         LOGE("Failed to get private pkey.");
-        OpensslEvpPkeyFree(pubPKey);
+        OpensslEvpPkeyFree(*pubPKey);
+        *pubPKey = NULL;
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    HcfResult res = KeyDerive(priPKey, pubPKey, returnSecret);
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineGenerateSecret(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
+    HcfPubKey *pubKey, HcfBlob *returnSecret)
+{
+    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (returnSecret == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *priPKey = NULL;
+    EVP_PKEY *pubPKey = NULL;
+    HcfResult res = NewDhPKeys(self, priKey, pubKey, &priPKey, &pubPKey);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    res = IsDhPeerInNamedGroup(((HcfOpensslDhPubKey *)pubKey)->pk) ?
+        KeyDeriveWithCheckedPeer(priPKey, pubPKey, returnSecret) : KeyDerive(priPKey, pubPKey, returnSecret);
+    OpensslEvpPkeyFree(priPKey);
+    OpensslEvpPkeyFree(pubPKey);
+    return res;
+}
+
+static HcfResult EngineDeriveKey(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey)
+{
+    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (spec == NULL) || (returnKey == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *priPKey = NULL;
+    EVP_PKEY *pubPKey = NULL;
+    HcfResult res = NewDhPKeys(self, priKey, pubKey, &priPKey, &pubPKey);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    bool validatePeer = !IsDhPeerInNamedGroup(((HcfOpensslDhPubKey *)pubKey)->pk);
+    res = HcfAgreementKdfDerive(priPKey, pubPKey, validatePeer, spec, returnKey);
     OpensslEvpPkeyFree(priPKey);
     OpensslEvpPkeyFree(pubPKey);
     return res;
@@ -96,6 +141,7 @@ HcfResult HcfKeyAgreementSpiDhCreate(HcfKeyAgreementParams *params, HcfKeyAgreem
     returnImpl->base.base.getClass = GetDhClass;
     returnImpl->base.base.destroy = DestroyDh;
     returnImpl->base.engineGenerateSecret = EngineGenerateSecret;
+    returnImpl->base.engineDeriveKey = EngineDeriveKey;
 
     *returnObj = (HcfKeyAgreementSpi *)returnImpl;
     return HCF_SUCCESS;
@@ -18,6 +18,7 @@
 #include <openssl/bio.h>
 #include <openssl/err.h>
 
+#include "agreement_kdf_openssl.h"
 #include "algorithm_parameter.h"
 #include "openssl_adapter.h"
 #include "openssl_class.h"
@@ -90,32 +91,65 @@ static void DestroyEcdh(HcfObjectBase *self)
     HcfFree(self);
 }
 
-static HcfResult EngineGenerateSecret(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
-    HcfPubKey *pubKey, HcfBlob *returnSecret)
+static HcfResult NewEcdhPKeys(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    EVP_PKEY **priPKey, EVP_PKEY **pubPKey)
 {
-    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (returnSecret == NULL)) {
-        LOGE("Invalid input parameter.");
-        return HCF_INVALID_PARAMS;
-    }
     if ((!HcfIsClassMatch((HcfObjectBase *)self, GetEcdhClass())) ||
         (!HcfIsClassMatch((HcfObjectBase *)priKey, HCF_OPENSSL_ECC_PRI_KEY_CLASS)) ||
         (!HcfIsClassMatch((HcfObjectBase *)pubKey, HCF_OPENSSL_ECC_PUB_KEY_CLASS))) {
         return HCF_INVALID_PARAMS;
     }
 
-    EVP_PKEY *priPKey = NewPKeyByEccPriKey((HcfOpensslEccPriKey *)priKey);
-    if (priPKey == NULL) {
+    *priPKey = NewPKeyByEccPriKey((HcfOpensslEccPriKey *)priKey);
+    if (*priPKey == NULL) {
         LOGE("Gen EVP_PKEY priKey failed");
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    EVP_PKEY *pubPKey = NewPKeyByEccPubKey((HcfOpensslEccPubKey *)pubKey);
-    if (pubPKey == NULL) {
+    *pubPKey = NewPKeyByEccPubKey((HcfOpensslEccPubKey *)pubKey);
+    if (*pubPKey == NULL) {
         LOGE("Gen EVP_PKEY pubKey failed");
-        EVP_PKEY_free(priPKey);
+        EVP_PKEY_free(*priPKey);
+        *priPKey = NULL;
         return HCF_ERR_CRYPTO_OPERATION;
     }
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineGenerateSecret(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
+    HcfPubKey *pubKey, HcfBlob *returnSecret)
+{
+    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (returnSecret == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *priPKey = NULL;
+    EVP_PKEY *pubPKey = NULL;
+    HcfResult res = NewEcdhPKeys(self, priKey, pubKey, &priPKey, &pubPKey);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+
+    res = KeyDerive(priPKey, pubPKey, returnSecret);
+    OpensslEvpPkeyFree(priPKey);
+    OpensslEvpPkeyFree(pubPKey);
+    return res;
+}
+
+static HcfResult EngineDeriveKey(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey)
+{
+    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (spec == NULL) || (returnKey == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *priPKey = NULL;
+    EVP_PKEY *pubPKey = NULL;
+    HcfResult res = NewEcdhPKeys(self, priKey, pubKey, &priPKey, &pubPKey);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
 
-    HcfResult res = KeyDerive(priPKey, pubPKey, returnSecret);
+    res = HcfAgreementKdfDerive(priPKey, pubPKey, true, spec, returnKey);
     OpensslEvpPkeyFree(priPKey);
     OpensslEvpPkeyFree(pubPKey);
     return res;
@@ -138,6 +172,7 @@ HcfResult HcfKeyAgreementSpiEcdhCreate(HcfKeyAgreementParams *params, HcfKeyAgre
     returnImpl->base.base.getClass = GetEcdhClass;
     returnImpl->base.base.destroy = DestroyEcdh;
     returnImpl->base.engineGenerateSecret = EngineGenerateSecret;
+    returnImpl->base.engineDeriveKey = EngineDeriveKey;
 
     *returnObj = (HcfKeyAgreementSpi *)returnImpl;
     return HCF_SUCCESS;
@@ -18,6 +18,7 @@
 #include <openssl/bio.h>
 #include <openssl/err.h>
 
+#include "agreement_kdf_openssl.h"
 #include "algorithm_parameter.h"
 #include "openssl_adapter.h"
 #include "openssl_class.h"
@@ -48,31 +49,63 @@ static void DestroyX25519(HcfObjectBase *self)
     HcfFree(self);
 }
 
-static HcfResult EngineGenerateSecret(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
-    HcfPubKey *pubKey, HcfBlob *returnSecret)
+static HcfResult NewX25519PKeys(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    EVP_PKEY **priPKey, EVP_PKEY **pubPKey)
 {
-    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (returnSecret == NULL)) {
-        LOGE("Invalid input parameter.");
-        return HCF_INVALID_PARAMS;
-    }
     if ((!HcfIsClassMatch((HcfObjectBase *)self, GetX25519Class())) ||
         (!HcfIsClassMatch((HcfObjectBase *)priKey, OPENSSL_ALG25519_PRIKEY_CLASS)) ||
         (!HcfIsClassMatch((HcfObjectBase *)pubKey, OPENSSL_ALG25519_PUBKEY_CLASS))) {
         LOGE("Invalid class of self.");
         return HCF_INVALID_PARAMS;
     }
-    EVP_PKEY *pubPKey = OpensslEvpPkeyDup(((HcfOpensslAlg25519PubKey *)pubKey)->pkey);
-    if (pubPKey == NULL) {
+    *pubPKey = OpensslEvpPkeyDup(((HcfOpensslAlg25519PubKey *)pubKey)->pkey);
+    if (*pubPKey == NULL) {
         LOGE("Failed to dup public pkey.");
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    EVP_PKEY *priPKey = OpensslEvpPkeyDup(((HcfOpensslAlg25519PriKey *)priKey)->pkey);
-    if (priPKey == NULL) {
+    *priPKey = OpensslEvpPkeyDup(((HcfOpensslAlg25519PriKey *)priKey)->pkey);
+    if (*priPKey == NULL) {
         LOGE("Failed to dup private pkey.");
-        OpensslEvpPkeyFree(pubPKey);
+        OpensslEvpPkeyFree(*pubPKey);
+        *pubPKey = NULL;
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    HcfResult res = KeyDerive(priPKey, pubPKey, returnSecret);
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineGenerateSecret(HcfKeyAgreementSpi *self, HcfPriKey *priKey,
+    HcfPubKey *pubKey, HcfBlob *returnSecret)
+{
+    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (returnSecret == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *priPKey = NULL;
+    EVP_PKEY *pubPKey = NULL;
+    HcfResult res = NewX25519PKeys(self, priKey, pubKey, &priPKey, &pubPKey);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    res = KeyDerive(priPKey, pubPKey, returnSecret);
+    OpensslEvpPkeyFree(priPKey);
+    OpensslEvpPkeyFree(pubPKey);
+    return res;
+}
+
+static HcfResult EngineDeriveKey(HcfKeyAgreementSpi *self, HcfPriKey *priKey, HcfPubKey *pubKey,
+    const HcfKeyAgreementKdfSpec *spec, HcfBlob *returnKey)
+{
+    if ((self == NULL) || (priKey == NULL) || (pubKey == NULL) || (spec == NULL) || (returnKey == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_PKEY *priPKey = NULL;
+    EVP_PKEY *pubPKey = NULL;
+    HcfResult res = NewX25519PKeys(self, priKey, pubKey, &priPKey, &pubPKey);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    res = HcfAgreementKdfDerive(priPKey, pubPKey, true, spec, returnKey);
     OpensslEvpPkeyFree(priPKey);
     OpensslEvpPkeyFree(pubPKey);
     return res;
@@ -95,6 +128,7 @@ HcfResult HcfKeyAgreementSpiX25519Create(HcfKeyAgreementParams *params, HcfKeyAg
     returnImpl->base.base.getClass = GetX25519Class;
     returnImpl->base.base.destroy = DestroyX25519;
     returnImpl->base.engineGenerateSecret = EngineGenerateSecret;
+    returnImpl->base.engineDeriveKey = EngineDeriveKey;
 
     *returnObj = (HcfKeyAgreementSpi *)returnImpl;
     return HCF_SUCCESS;
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_RAND_BUFFER_OPENSSL_H
+#define HCF_RAND_BUFFER_OPENSSL_H
+
+#include <stdint.h>
+
+#include "result.h"
+
+/* Bytes each thread keeps ahead, requests up to HCF_RAND_BUFFER_MAX_REQUEST_LEN are served from them. */
+#define HCF_RAND_BUFFER_LEN 512
+#define HCF_RAND_BUFFER_MAX_REQUEST_LEN 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fills data with len bytes from the private DRBG of the default library context.
+ *
+ * OpenSSL gives every thread its own private DRBG seeded from the primary one. Small requests are copied out of a
+ * per-thread buffer refilled from that DRBG, so they take neither a lock nor a call into OpenSSL. Bytes are wiped from
+ * the buffer once handed out, and the buffer is dropped after HcfRandBufferInvalidate and in the child of a fork.
+ */
+HcfResult HcfRandBufferGenerate(uint8_t *data, uint32_t len);
+
+/**
+ * @brief Drops the bytes buffered by every thread, so later requests see a reseed of the DRBGs.
+ */
+void HcfRandBufferInvalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rand_buffer_openssl.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <securec.h>
+
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+
+typedef struct {
+    uint32_t generation;
+    uint32_t offset; /* first unused byte of data, HCF_RAND_BUFFER_LEN when empty */
+    uint8_t data[HCF_RAND_BUFFER_LEN];
+} HcfRandBuffer;
+
+static pthread_once_t g_randBufferOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t g_randBufferKey;
+static bool g_isRandBufferKeyCreated = false;
+static atomic_uint g_randBufferGeneration = 0;
+
+static void DestroyRandBuffer(void *arg)
+{
+    HcfRandBuffer *buffer = (HcfRandBuffer *)arg;
+    if (buffer == NULL) {
+        return;
+    }
+    (void)memset_s(buffer, sizeof(HcfRandBuffer), 0, sizeof(HcfRandBuffer));
+    HcfFree(buffer);
+}
+
+/* The child would otherwise hand out the same bytes as the thread of the parent that forked it. */
+static void InvalidateRandBufferInChild(void)
+{
+    HcfRandBufferInvalidate();
+}
+
+static void InitRandBufferKey(void)
+{
+    if (pthread_key_create(&g_randBufferKey, DestroyRandBuffer) != 0) {
+        LOGE("Failed to create the rand buffer key.");
+        return;
+    }
+    if (pthread_atfork(NULL, NULL, InvalidateRandBufferInChild) != 0) {
+        LOGE("Failed to register the rand buffer fork handler.");
+        (void)pthread_key_delete(g_randBufferKey);
+        return;
+    }
+    g_isRandBufferKeyCreated = true;
+}
+
+static HcfRandBuffer *GetRandBuffer(void)
+{
+    (void)pthread_once(&g_randBufferOnce, InitRandBufferKey);
+    if (!g_isRandBufferKeyCreated) {
+        return NULL;
+    }
+    HcfRandBuffer *buffer = (HcfRandBuffer *)pthread_getspecific(g_randBufferKey);
+    if (buffer != NULL) {
+        return buffer;
+    }
+    buffer = (HcfRandBuffer *)HcfMalloc(sizeof(HcfRandBuffer), 0);
+    if (buffer == NULL) {
+        LOGE("Failed to allocate rand buffer memory!");
+        return NULL;
+    }
+    buffer->offset = HCF_RAND_BUFFER_LEN;
+    if (pthread_setspecific(g_randBufferKey, buffer) != 0) {
+        LOGE("Failed to set the rand buffer of the thread.");
+        HcfFree(buffer);
+        return NULL;
+    }
+    return buffer;
+}
+
+static HcfResult RefillRandBuffer(HcfRandBuffer *buffer, uint32_t generation)
+{
+    // The remaining bytes are never handed out, they are overwritten or wiped here.
+    if (OpensslRandPrivBytesEx(NULL, buffer->data, HCF_RAND_BUFFER_LEN) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("Failed to refill the rand buffer.");
+        (void)memset_s(buffer->data, HCF_RAND_BUFFER_LEN, 0, HCF_RAND_BUFFER_LEN);
+        buffer->offset = HCF_RAND_BUFFER_LEN;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    buffer->generation = generation;
+    buffer->offset = 0;
+    return HCF_SUCCESS;
+}
+
+HcfResult HcfRandBufferGenerate(uint8_t *data, uint32_t len)
+{
+    if ((data == NULL) || (len == 0)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfRandBuffer *buffer = (len <= HCF_RAND_BUFFER_MAX_REQUEST_LEN) ? GetRandBuffer() : NULL;
+    if (buffer == NULL) {
+        if (OpensslRandPrivBytesEx(NULL, data, len) != HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("RAND_priv_bytes_ex failed.");
+            return HCF_ERR_CRYPTO_OPERATION;
+        }
+        return HCF_SUCCESS;
+    }
+    // Read before a refill, so an invalidation racing with it drops the refilled bytes as well.
+    uint32_t generation = atomic_load_explicit(&g_randBufferGeneration, memory_order_acquire);
+    if ((buffer->generation != generation) || (HCF_RAND_BUFFER_LEN - buffer->offset < len)) {
+        HcfResult ret = RefillRandBuffer(buffer, generation);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+    }
+    uint8_t *src = buffer->data + buffer->offset;
+    (void)memcpy_s(data, len, src, len);
+    (void)memset_s(src, len, 0, len);
+    buffer->offset += len;
+    return HCF_SUCCESS;
+}
+
+void HcfRandBufferInvalidate(void)
+{
+    (void)atomic_fetch_add_explicit(&g_randBufferGeneration, 1, memory_order_release);
+}
@@ -21,6 +21,7 @@
 #include "log.h"
 #include "memory.h"
 #include "utils.h"
+#include "rand_buffer_openssl.h"
 #include "rand_hks_provider.h"
 
 typedef struct {
@@ -73,6 +74,23 @@ static HcfResult CreateRandCtx(bool isHardwareEntropyEnabled, OSSL_LIB_CTX **lib
     return HCF_SUCCESS;
 }
 
+static HcfResult GenerateSoftwareRandom(int32_t numBytes, HcfBlob *random)
+{
+    random->data = (uint8_t *)HcfMalloc(numBytes, 0);
+    if (random->data == NULL) {
+        LOGE("Failed to allocate random->data memory!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult res = HcfRandBufferGenerate(random->data, (uint32_t)numBytes);
+    if (res != HCF_SUCCESS) {
+        LOGE("Failed to generate random bytes with software entropy");
+        HcfBlobDataFree(random);
+        return res;
+    }
+    random->len = numBytes;
+    return HCF_SUCCESS;
+}
+
 static HcfResult OpensslGenerateRandom(HcfRandSpi *self, int32_t numBytes, HcfBlob *random)
 {
     if ((self == NULL) || (random == NULL) || (numBytes <= 0)) {
@@ -80,9 +98,13 @@ static HcfResult OpensslGenerateRandom(HcfRandSpi *self, int32_t numBytes, HcfBl
         return HCF_INVALID_PARAMS;
     }
 
+    bool isHardwareEntropyEnabled = ((HcfRandSpiImpl *)self)->isHardwareEntropyEnabled;
+    if (!isHardwareEntropyEnabled) {
+        return GenerateSoftwareRandom(numBytes, random);
+    }
+
     OSSL_LIB_CTX *libCtx = NULL;
     OSSL_PROVIDER *seedProvider = NULL;
-    bool isHardwareEntropyEnabled = ((HcfRandSpiImpl *)self)->isHardwareEntropyEnabled;
     HcfResult res = CreateRandCtx(isHardwareEntropyEnabled, &libCtx, &seedProvider);
     if (res != HCF_SUCCESS) {
         LOGE("Create random context failed!");
@@ -99,16 +121,11 @@ static HcfResult OpensslGenerateRandom(HcfRandSpi *self, int32_t numBytes, HcfBl
     int32_t ret = OpensslRandPrivBytesEx(libCtx, random->data, numBytes);
     FreeRandCtx(isHardwareEntropyEnabled, &libCtx, &seedProvider);
     if (ret != HCF_OPENSSL_SUCCESS) {
-        LOGE("Failed to generate random bytes with %{public}s entropy", isHardwareEntropyEnabled ? "hardware" :
-            "software");
-        if (!isHardwareEntropyEnabled) {
-            HcfPrintOpensslError();
-        }
+        LOGE("Failed to generate random bytes with hardware entropy");
         HcfBlobDataFree(random);
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    LOGD("Successfully generated %{public}d random bytes with %{public}s entropy", numBytes,
-        isHardwareEntropyEnabled ? "hardware" : "software");
+    LOGD("Successfully generated %{public}d random bytes with hardware entropy", numBytes);
     random->len = numBytes;
     return HCF_SUCCESS;
 }
@@ -148,6 +165,8 @@ static void OpensslSetSeed(HcfRandSpi *self, HcfBlob *seed)
         return;
     }
     OpensslRandSeed(seed->data, seed->len);
+    // Bytes buffered before the seed was mixed in must not be handed out after it.
+    HcfRandBufferInvalidate();
 }
 
 static void DestroyRandOpenssl(HcfObjectBase *self)
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_SIGNATURE_BATCH_OPENSSL_H
+#define HCF_SIGNATURE_BATCH_OPENSSL_H
+
+#include <stdint.h>
+#include <openssl/evp.h>
+
+#include "blob.h"
+#include "result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Copies an initialized digest sign context into a new one and restarts the copy on the same key.
+ *
+ * Message data already fed to srcCtx is not carried over. returnPkeyCtx receives the signature context owned by the
+ * copy, on which provider parameters dropped by the restart, such as RSA padding, have to be set again.
+ */
+HcfResult HcfSignBatchDupRestartedCtx(const EVP_MD_CTX *srcCtx, const EVP_MD *digestAlg, EVP_MD_CTX **returnCtx,
+    EVP_PKEY_CTX **returnPkeyCtx);
+
+/**
+ * @brief Signs a batch on copies of an initialized context, which is only read.
+ *
+ * Exactly one of mdCtx and pkeyCtx is given: mdCtx is a digest sign context holding no message data and is copied for
+ * every message, pkeyCtx is an EVP_PKEY_sign context and is copied once per worker. The arguments follow signBatch of
+ * HcfSign, each signature gets a slot of the maximum signature length in the arena.
+ */
+HcfResult HcfSignBatchOpenssl(const EVP_MD_CTX *mdCtx, const EVP_PKEY_CTX *pkeyCtx, const HcfBlob *inputs,
+    uint32_t count, uint32_t workerNum, HcfBlob *returnArena, HcfBlob *returnSignatures);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
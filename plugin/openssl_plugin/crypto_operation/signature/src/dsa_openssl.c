@@ -37,6 +37,8 @@ typedef struct {
     EVP_PKEY_CTX *pkeyCtx;
 
     CryptoStatus status;
+
+    bool isPrehash;
 } HcfSignSpiDsaOpensslImpl;
 
 typedef struct {
@@ -49,6 +51,8 @@ typedef struct {
     EVP_PKEY_CTX *pkeyCtx;
 
     CryptoStatus status;
+
+    bool isPrehash;
 } HcfVerifySpiDsaOpensslImpl;
 
 static const char *GetDsaSignClass(void)
@@ -71,11 +75,6 @@ static bool IsSignInitInputValid(HcfSignSpi *self, HcfPriKey *privateKey)
         (!HcfIsClassMatch((HcfObjectBase *)privateKey, OPENSSL_DSA_PRIKEY_CLASS))) {
         return false;
     }
-    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return false;
-    }
     return true;
 }
 
@@ -89,11 +88,6 @@ static bool IsVerifyInitInputValid(HcfVerifySpi *self, HcfPubKey *publicKey)
         (!HcfIsClassMatch((HcfObjectBase *)publicKey, OPENSSL_DSA_PUBKEY_CLASS))) {
         return false;
     }
-    HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return false;
-    }
     return true;
 }
 
@@ -162,6 +156,22 @@ static void DestroyDsaVerify(HcfObjectBase *self)
     HcfFree(impl);
 }
 
+// Unbind the key of a previous init, keeping the allocated EVP_MD_CTX for the next one.
+static HcfResult ClearDsaKeyCtx(EVP_MD_CTX *mdCtx, EVP_PKEY_CTX **pkeyCtx, CryptoStatus *status)
+{
+    *status = UNINITIALIZED;
+    if (*pkeyCtx != NULL) {
+        OpensslEvpPkeyCtxFree(*pkeyCtx);
+        *pkeyCtx = NULL;
+    }
+    if ((mdCtx != NULL) && (OpensslEvpMdCtxReset(mdCtx) != HCF_OPENSSL_SUCCESS)) {
+        LOGE("Failed to reset md ctx.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static EVP_PKEY *CreateDsaEvpKeyByDsa(HcfKey *key, bool isSign)
 {
     EVP_PKEY *pKey = OpensslEvpPkeyNew();
@@ -185,18 +195,57 @@ static EVP_PKEY *CreateDsaEvpKeyByDsa(HcfKey *key, bool isSign)
     return pKey;
 }
 
+// Prehash mode signs or verifies a digest of digestAlg, whose length the signature md makes OpenSSL check.
+static HcfResult CreateDsaPrehashPkeyCtx(EVP_PKEY *pKey, const EVP_MD *digestAlg, bool isSign,
+    EVP_PKEY_CTX **returnPkeyCtx)
+{
+    EVP_PKEY_CTX *pkeyCtx = OpensslEvpPkeyCtxNew(pKey, NULL);
+    if (pkeyCtx == NULL) {
+        LOGE("Failed to allocate pkeyCtx.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    int32_t ret = isSign ? OpensslEvpPkeySignInit(pkeyCtx) : OpensslEvpPkeyVerifyInit(pkeyCtx);
+    if (ret != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to initialize DSA prehash operation.");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(pkeyCtx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (OpensslEvpPkeyCtxSetSignatureMd(pkeyCtx, digestAlg) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to set signature md.");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyCtxFree(pkeyCtx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnPkeyCtx = pkeyCtx;
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineDsaSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriKey *privateKey)
 {
     (void)params;
     if (!IsSignInitInputValid(self, privateKey)) {
         return HCF_INVALID_PARAMS;
     }
+    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (ClearDsaKeyCtx(impl->mdCtx, &impl->pkeyCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
     EVP_PKEY *pKey = CreateDsaEvpKeyByDsa((HcfKey *)privateKey, true);
     if (pKey == NULL) {
         LOGE("Create DSA evp key failed!");
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (impl->isPrehash) {
+        HcfResult ret = CreateDsaPrehashPkeyCtx(pKey, impl->digestAlg, true, &impl->pkeyCtx);
+        OpensslEvpPkeyFree(pKey);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+        impl->status = READY;
+        return HCF_SUCCESS;
+    }
     if (OpensslEvpDigestSignInit(impl->mdCtx, NULL, impl->digestAlg, NULL, pKey) != HCF_OPENSSL_SUCCESS) {
         LOGE("Failed to initialize digest signing.");
         HcfPrintOpensslError();
@@ -215,12 +264,15 @@ static HcfResult EngineDsaSignWithoutDigestInit(HcfSignSpi *self, HcfParamsSpec
     if (!IsSignInitInputValid(self, privateKey)) {
         return HCF_INVALID_PARAMS;
     }
+    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (ClearDsaKeyCtx(impl->mdCtx, &impl->pkeyCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
     EVP_PKEY *pKey = CreateDsaEvpKeyByDsa((HcfKey *)privateKey, true);
     if (pKey == NULL) {
         LOGE("Create DSA evp key failed!");
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
 
     impl->pkeyCtx = OpensslEvpPkeyCtxNew(pKey, NULL);
     if (impl->pkeyCtx == NULL) {
@@ -249,11 +301,23 @@ static HcfResult EngineDsaVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params,
         return HCF_INVALID_PARAMS;
     }
     HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
+    if (ClearDsaKeyCtx(impl->mdCtx, &impl->pkeyCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
     EVP_PKEY *pKey = CreateDsaEvpKeyByDsa((HcfKey *)publicKey, false);
     if (pKey == NULL) {
         LOGE("Create DSA evp key failed!");
         return HCF_ERR_CRYPTO_OPERATION;
     }
+    if (impl->isPrehash) {
+        HcfResult ret = CreateDsaPrehashPkeyCtx(pKey, impl->digestAlg, false, &impl->pkeyCtx);
+        OpensslEvpPkeyFree(pKey);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+        impl->status = READY;
+        return HCF_SUCCESS;
+    }
     if (OpensslEvpDigestVerifyInit(impl->mdCtx, NULL, impl->digestAlg, NULL, pKey) != HCF_OPENSSL_SUCCESS) {
         LOGE("Failed to initialize digest verification.");
         HcfPrintOpensslError();
@@ -273,6 +337,9 @@ static HcfResult EngineDsaVerifyWithoutDigestInit(HcfVerifySpi *self, HcfParamsS
         return HCF_INVALID_PARAMS;
     }
     HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
+    if (ClearDsaKeyCtx(impl->mdCtx, &impl->pkeyCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
     EVP_PKEY *pKey = CreateDsaEvpKeyByDsa((HcfKey *)publicKey, false);
     if (pKey == NULL) {
         LOGE("Create dsa evp key failed!");
@@ -312,6 +379,10 @@ static HcfResult EngineDsaSignUpdate(HcfSignSpi *self, HcfBlob *data)
         LOGE("Sign object has not been initialized.");
         return HCF_INVALID_PARAMS;
     }
+    if (impl->isPrehash) {
+        LOGE("Update is not supported in prehash mode.");
+        return HCF_ERR_INVALID_CALL;
+    }
     if (OpensslEvpDigestSignUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
         LOGE("Failed to update digest sign data.");
         HcfPrintOpensslError();
@@ -343,6 +414,10 @@ static HcfResult EngineDsaVerifyUpdate(HcfVerifySpi *self, HcfBlob *data)
         LOGE("Verify object has not been initialized.");
         return HCF_INVALID_PARAMS;
     }
+    if (impl->isPrehash) {
+        LOGE("Update is not supported in prehash mode.");
+        return HCF_ERR_INVALID_CALL;
+    }
 
     if (OpensslEvpDigestVerifyUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
         LOGE("Failed to update digest verify data.");
@@ -361,12 +436,62 @@ static HcfResult EngineDsaVerifyWithoutDigestUpdate(HcfVerifySpi *self, HcfBlob
     return HCF_ERR_CRYPTO_OPERATION;
 }
 
+static HcfResult EngineDsaSignWithoutDigestDoFinal(HcfSignSpi *self, HcfBlob *data, HcfBlob *returnSignatureData)
+{
+    if (!IsSignDoFinalInputValid(self, returnSignatureData)) {
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsBlobValid(data)) {
+        LOGE("Src data is invalid.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (impl->status != READY) {
+        LOGE("Not init yet.");
+        return HCF_INVALID_PARAMS;
+    }
+    size_t maxLen;
+    if (OpensslEvpPkeySign(impl->pkeyCtx, NULL, &maxLen,
+        (const unsigned char *)data->data, data->len) != HCF_OPENSSL_SUCCESS) {
+        LOGE("EvpPkeySign get maxLen failed.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    uint8_t *signatureData = (uint8_t *)HcfMalloc(maxLen, 0);
+    if (signatureData == NULL) {
+        LOGE("Failed to allocate signatureData memory!");
+        return HCF_ERR_MALLOC;
+    }
+    size_t actualLen = maxLen;
+    if (OpensslEvpPkeySign(impl->pkeyCtx, signatureData, &actualLen,
+        (const unsigned char *)data->data, data->len) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to sign data.");
+        HcfPrintOpensslError();
+        HcfFree(signatureData);
+        signatureData = NULL;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (actualLen > maxLen) {
+        LOGE("Signature data too long.");
+        HcfFree(signatureData);
+        signatureData = NULL;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+
+    returnSignatureData->data = signatureData;
+    returnSignatureData->len = (uint32_t)actualLen;
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineDsaSignDoFinal(HcfSignSpi *self, HcfBlob *data, HcfBlob *returnSignatureData)
 {
     if (!IsSignDoFinalInputValid(self, returnSignatureData)) {
         return HCF_INVALID_PARAMS;
     }
     HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (impl->isPrehash) {
+        return EngineDsaSignWithoutDigestDoFinal(self, data, returnSignatureData);
+    }
     if (HcfIsBlobValid(data)) {
         if (OpensslEvpDigestSignUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
             LOGE("Failed to update digest sign data.");
@@ -404,51 +529,28 @@ static HcfResult EngineDsaSignDoFinal(HcfSignSpi *self, HcfBlob *data, HcfBlob *
     return HCF_SUCCESS;
 }
 
-static HcfResult EngineDsaSignWithoutDigestDoFinal(HcfSignSpi *self, HcfBlob *data, HcfBlob *returnSignatureData)
+static bool EngineDsaVerifyWithoutDigestDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *signatureData)
 {
-    if (!IsSignDoFinalInputValid(self, returnSignatureData)) {
-        return HCF_INVALID_PARAMS;
+    if (!IsVerifyDoFinalInputValid(self, signatureData)) {
+        return false;
     }
     if (!HcfIsBlobValid(data)) {
         LOGE("Src data is invalid.");
-        return HCF_INVALID_PARAMS;
+        return false;
     }
-    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
     if (impl->status != READY) {
         LOGE("Not init yet.");
-        return HCF_INVALID_PARAMS;
-    }
-    size_t maxLen;
-    if (OpensslEvpPkeySign(impl->pkeyCtx, NULL, &maxLen,
-        (const unsigned char *)data->data, data->len) != HCF_OPENSSL_SUCCESS) {
-        LOGE("EvpPkeySign get maxLen failed.");
-        HcfPrintOpensslError();
-        return HCF_ERR_CRYPTO_OPERATION;
-    }
-    uint8_t *signatureData = (uint8_t *)HcfMalloc(maxLen, 0);
-    if (signatureData == NULL) {
-        LOGE("Failed to allocate signatureData memory!");
-        return HCF_ERR_MALLOC;
+        return false;
     }
-    size_t actualLen = maxLen;
-    if (OpensslEvpPkeySign(impl->pkeyCtx, signatureData, &actualLen,
-        (const unsigned char *)data->data, data->len) != HCF_OPENSSL_SUCCESS) {
-        LOGE("Failed to sign data.");
+
+    if (OpensslEvpPkeyVerify(impl->pkeyCtx, signatureData->data,
+        signatureData->len, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to verify signature.");
         HcfPrintOpensslError();
-        HcfFree(signatureData);
-        signatureData = NULL;
-        return HCF_ERR_CRYPTO_OPERATION;
-    }
-    if (actualLen > maxLen) {
-        LOGE("Signature data too long.");
-        HcfFree(signatureData);
-        signatureData = NULL;
-        return HCF_ERR_CRYPTO_OPERATION;
+        return false;
     }
-
-    returnSignatureData->data = signatureData;
-    returnSignatureData->len = (uint32_t)actualLen;
-    return HCF_SUCCESS;
+    return true;
 }
 
 static bool EngineDsaVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *signatureData)
@@ -458,6 +560,9 @@ static bool EngineDsaVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *s
     }
 
     HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
+    if (impl->isPrehash) {
+        return EngineDsaVerifyWithoutDigestDoFinal(self, data, signatureData);
+    }
     if (HcfIsBlobValid(data)) {
         if (OpensslEvpDigestVerifyUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
             LOGE("Openssl update failed.");
@@ -479,28 +584,60 @@ static bool EngineDsaVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *s
     return true;
 }
 
-static bool EngineDsaVerifyWithoutDigestDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *signatureData)
+static HcfResult EngineDsaSignReset(HcfSignSpi *self)
 {
-    if (!IsVerifyDoFinalInputValid(self, signatureData)) {
-        return false;
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
     }
-    if (!HcfIsBlobValid(data)) {
-        LOGE("Src data is invalid.");
-        return false;
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetDsaSignClass())) {
+        return HCF_INVALID_PARAMS;
     }
-    HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
-    if (impl->status != READY) {
-        LOGE("Not init yet.");
-        return false;
+    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Sign object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    // Without digest or in prehash mode the pkeyCtx keeps no message state.
+    if ((impl->mdCtx == NULL) || impl->isPrehash) {
+        return HCF_SUCCESS;
     }
+    // A NULL key restarts the digest on the key and signature context already set up.
+    if (OpensslEvpDigestSignInit(impl->mdCtx, NULL, impl->digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to reinitialize digest signing.");
+        HcfPrintOpensslError();
+        impl->status = UNINITIALIZED;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->status = INITIALIZED;
+    return HCF_SUCCESS;
+}
 
-    if (OpensslEvpPkeyVerify(impl->pkeyCtx, signatureData->data,
-        signatureData->len, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
-        LOGE("Failed to verify signature.");
+static HcfResult EngineDsaVerifyReset(HcfVerifySpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetDsaVerifyClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Verify object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((impl->mdCtx == NULL) || impl->isPrehash) {
+        return HCF_SUCCESS;
+    }
+    if (OpensslEvpDigestVerifyInit(impl->mdCtx, NULL, impl->digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to reinitialize digest verification.");
         HcfPrintOpensslError();
-        return false;
+        impl->status = UNINITIALIZED;
+        return HCF_ERR_CRYPTO_OPERATION;
     }
-    return true;
+    impl->status = INITIALIZED;
+    return HCF_SUCCESS;
 }
 
 static HcfResult EngineSetSignDsaSpecInt(HcfSignSpi *self, SignSpecItem item, int32_t saltLen)
@@ -575,6 +712,59 @@ static HcfResult EngineSetVerifyDsaSpecUint8Array(HcfVerifySpi *self, SignSpecIt
     return HCF_NOT_SUPPORT;
 }
 
+static HcfResult EngineSetSignDsaSpecBool(HcfSignSpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetDsaSignClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid sign spec item.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiDsaOpensslImpl *impl = (HcfSignSpiDsaOpensslImpl *)self;
+    if (impl->status != UNINITIALIZED) {
+        LOGE("Set sign spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    // Without digest the data is signed as it is already.
+    if (impl->digestAlg == NULL) {
+        LOGE("Prehash needs a digest.");
+        return HCF_INVALID_PARAMS;
+    }
+    impl->isPrehash = flag;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSetVerifyDsaSpecBool(HcfVerifySpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetDsaVerifyClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid verify spec item.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiDsaOpensslImpl *impl = (HcfVerifySpiDsaOpensslImpl *)self;
+    if (impl->status != UNINITIALIZED) {
+        LOGE("Set verify spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    if (impl->digestAlg == NULL) {
+        LOGE("Prehash needs a digest.");
+        return HCF_INVALID_PARAMS;
+    }
+    impl->isPrehash = flag;
+    return HCF_SUCCESS;
+}
+
 HcfResult HcfSignSpiDsaCreate(HcfSignatureParams *params, HcfSignSpi **returnObj)
 {
     if ((params == NULL) || (returnObj == NULL)) {
@@ -619,6 +809,8 @@ HcfResult HcfSignSpiDsaCreate(HcfSignatureParams *params, HcfSignSpi **returnObj
     impl->base.engineGetSignSpecInt = EngineGetSignDsaSpecInt;
     impl->base.engineGetSignSpecString = EngineGetSignDsaSpecString;
     impl->base.engineSetSignSpecUint8Array = EngineSetSignDsaSpecUint8Array;
+    impl->base.engineSetSignSpecBool = EngineSetSignDsaSpecBool;
+    impl->base.engineReset = EngineDsaSignReset;
     impl->status = UNINITIALIZED;
     impl->digestAlg = digestAlg;
     *returnObj = (HcfSignSpi *)impl;
@@ -668,6 +860,8 @@ HcfResult HcfVerifySpiDsaCreate(HcfSignatureParams *params, HcfVerifySpi **retur
     impl->base.engineGetVerifySpecInt = EngineGetVerifyDsaSpecInt;
     impl->base.engineGetVerifySpecString = EngineGetVerifyDsaSpecString;
     impl->base.engineSetVerifySpecUint8Array = EngineSetVerifyDsaSpecUint8Array;
+    impl->base.engineSetVerifySpecBool = EngineSetVerifyDsaSpecBool;
+    impl->base.engineReset = EngineDsaVerifyReset;
     impl->digestAlg = digestAlg;
     impl->status = UNINITIALIZED;
 
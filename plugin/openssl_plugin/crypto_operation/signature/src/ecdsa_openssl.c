@@ -22,6 +22,7 @@
 #include "openssl_adapter.h"
 #include "openssl_class.h"
 #include "openssl_common.h"
+#include "signature_batch_openssl.h"
 #include "log.h"
 #include "memory.h"
 #include "utils.h"
@@ -36,7 +37,7 @@ typedef struct {
 
     EVP_MD_CTX *ctx;
     
-    EVP_PKEY_CTX *pkeyCtx;  // For OnlySign mode
+    EVP_PKEY_CTX *pkeyCtx;  // For OnlySign and prehash mode
 
     CryptoStatus status;
 
@@ -50,7 +51,7 @@ typedef struct {
 
     EVP_MD_CTX *ctx;
 
-    EVP_PKEY_CTX *pkeyCtx;  // For OnlyVerify mode
+    EVP_PKEY_CTX *pkeyCtx;  // For OnlyVerify and prehash mode
 
     CryptoStatus status;
 
@@ -283,6 +284,37 @@ static HcfResult SetEcdsaSignParams(HcfSignSpiEcdsaOpensslImpl *impl, HcfPriKey
     return HCF_SUCCESS;
 }
 
+// Unbind the key of a previous init, keeping the allocated EVP_MD_CTX for the next one.
+static HcfResult ClearEcdsaSignKey(HcfSignSpiEcdsaOpensslImpl *impl)
+{
+    impl->status = UNINITIALIZED;
+    if (impl->pkeyCtx != NULL) {
+        OpensslEvpPkeyCtxFree(impl->pkeyCtx);
+        impl->pkeyCtx = NULL;
+    }
+    if (OpensslEvpMdCtxReset(impl->ctx) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_MD_CTX_reset failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult ClearEcdsaVerifyKey(HcfVerifySpiEcdsaOpensslImpl *impl)
+{
+    impl->status = UNINITIALIZED;
+    if (impl->pkeyCtx != NULL) {
+        OpensslEvpPkeyCtxFree(impl->pkeyCtx);
+        impl->pkeyCtx = NULL;
+    }
+    if (OpensslEvpMdCtxReset(impl->ctx) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_MD_CTX_reset failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriKey *privateKey)
 {
     (void)params;
@@ -297,12 +329,10 @@ static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriK
     }
 
     HcfSignSpiEcdsaOpensslImpl *impl = (HcfSignSpiEcdsaOpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return HCF_INVALID_PARAMS;
+    HcfResult ret = ClearEcdsaSignKey(impl);
+    if (ret != HCF_SUCCESS) {
+        return ret;
     }
-
-    HcfResult ret;
     if (impl->operation == HCF_OPERATION_ONLY_SIGN) {
         ret = SetEcdsaOnlySignParams(impl, privateKey);
         if (ret != HCF_SUCCESS) {
@@ -462,12 +492,10 @@ static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, Hcf
     }
 
     HcfVerifySpiEcdsaOpensslImpl *impl = (HcfVerifySpiEcdsaOpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return HCF_INVALID_PARAMS;
+    HcfResult ret = ClearEcdsaVerifyKey(impl);
+    if (ret != HCF_SUCCESS) {
+        return ret;
     }
-
-    HcfResult ret;
     if (impl->operation == HCF_OPERATION_ONLY_VERIFY) {
         ret = SetEcdsaOnlyVerifyParams(impl, publicKey);
         if (ret != HCF_SUCCESS) {
@@ -568,6 +596,93 @@ static bool EngineVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *sign
     return true;
 }
 
+static HcfResult EngineSignReset(HcfSignSpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEcdsaSignClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiEcdsaOpensslImpl *impl = (HcfSignSpiEcdsaOpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Sign object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    // The OnlySign pkeyCtx keeps no message state.
+    if (impl->operation == HCF_OPERATION_ONLY_SIGN) {
+        return HCF_SUCCESS;
+    }
+    // A NULL key restarts the digest on the key and signature context already set up.
+    if (OpensslEvpDigestSignInit(impl->ctx, NULL, impl->digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_DigestSignInit failed.");
+        impl->status = UNINITIALIZED;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->status = INITIALIZED;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSignBatch(HcfSignSpi *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob *returnSignatures)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEcdsaSignClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiEcdsaOpensslImpl *impl = (HcfSignSpiEcdsaOpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Sign object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->operation == HCF_OPERATION_ONLY_SIGN) {
+        return HcfSignBatchOpenssl(NULL, impl->pkeyCtx, inputs, count, workerNum, returnArena, returnSignatures);
+    }
+    EVP_MD_CTX *ctx = NULL;
+    HcfResult ret = HcfSignBatchDupRestartedCtx(impl->ctx, impl->digestAlg, &ctx, NULL);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = HcfSignBatchOpenssl(ctx, NULL, inputs, count, workerNum, returnArena, returnSignatures);
+    OpensslEvpMdCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult EngineVerifyReset(HcfVerifySpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEcdsaVerifyClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiEcdsaOpensslImpl *impl = (HcfVerifySpiEcdsaOpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Verify object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->operation == HCF_OPERATION_ONLY_VERIFY) {
+        return HCF_SUCCESS;
+    }
+    if (OpensslEvpDigestVerifyInit(impl->ctx, NULL, impl->digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_DigestVerifyInit failed.");
+        impl->status = UNINITIALIZED;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->status = INITIALIZED;
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSetSignEcdsaSpecInt(HcfSignSpi *self, SignSpecItem item, int32_t saltLen)
 {
     (void)self;
@@ -632,6 +747,53 @@ static HcfResult EngineSetVerifyEcdsaSpecUint8Array(HcfVerifySpi *self, SignSpec
     return HCF_NOT_SUPPORT;
 }
 
+static HcfResult EngineSetSignEcdsaSpecBool(HcfSignSpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEcdsaSignClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid sign spec item.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiEcdsaOpensslImpl *impl = (HcfSignSpiEcdsaOpensslImpl *)self;
+    if (impl->status != UNINITIALIZED) {
+        LOGE("Set sign spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    // The OnlySign path signs a digest of digestAlg on an EVP_PKEY_sign context, which is what prehash mode takes.
+    impl->operation = flag ? HCF_OPERATION_ONLY_SIGN : HCF_OPERATION_SIGN;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSetVerifyEcdsaSpecBool(HcfVerifySpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEcdsaVerifyClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid verify spec item.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiEcdsaOpensslImpl *impl = (HcfVerifySpiEcdsaOpensslImpl *)self;
+    if (impl->status != UNINITIALIZED) {
+        LOGE("Set verify spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    impl->operation = flag ? HCF_OPERATION_ONLY_VERIFY : HCF_OPERATION_VERIFY;
+    return HCF_SUCCESS;
+}
+
 static HcfResult InitEcdsaSignImpl(HcfSignatureParams *params, HcfSignSpiEcdsaOpensslImpl **returnImpl)
 {
     if (params->algo == HCF_ALG_ECC_BRAINPOOL) {
@@ -667,6 +829,9 @@ static HcfResult InitEcdsaSignImpl(HcfSignatureParams *params, HcfSignSpiEcdsaOp
     impl->base.engineGetSignSpecInt = EngineGetSignEcdsaSpecInt;
     impl->base.engineGetSignSpecString = EngineGetSignEcdsaSpecString;
     impl->base.engineSetSignSpecUint8Array = EngineSetSignEcdsaSpecUint8Array;
+    impl->base.engineSetSignSpecBool = EngineSetSignEcdsaSpecBool;
+    impl->base.engineReset = EngineSignReset;
+    impl->base.engineSignBatch = EngineSignBatch;
     impl->digestAlg = opensslAlg;
     impl->status = UNINITIALIZED;
     impl->ctx = OpensslEvpMdCtxNew();
@@ -731,6 +896,8 @@ static HcfResult InitEcdsaVerifyImpl(HcfSignatureParams *params, HcfVerifySpiEcd
     impl->base.engineGetVerifySpecInt = EngineGetVerifyEcdsaSpecInt;
     impl->base.engineGetVerifySpecString = EngineGetVerifyEcdsaSpecString;
     impl->base.engineSetVerifySpecUint8Array = EngineSetVerifyEcdsaSpecUint8Array;
+    impl->base.engineSetVerifySpecBool = EngineSetVerifyEcdsaSpecBool;
+    impl->base.engineReset = EngineVerifyReset;
     impl->digestAlg = opensslAlg;
     impl->status = UNINITIALIZED;
     impl->ctx = OpensslEvpMdCtxNew();
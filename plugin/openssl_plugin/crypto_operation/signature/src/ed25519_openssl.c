@@ -24,6 +24,7 @@
 #include "openssl_adapter.h"
 #include "openssl_class.h"
 #include "openssl_common.h"
+#include "signature_batch_openssl.h"
 #include "log.h"
 #include "memory.h"
 #include "utils.h"
@@ -93,6 +94,18 @@ static void DestroyEd25519Verify(HcfObjectBase *self)
     HcfFree(impl);
 }
 
+// Unbind the key of a previous init, keeping the allocated EVP_MD_CTX for the next one.
+static HcfResult ClearEd25519KeyCtx(EVP_MD_CTX *mdCtx, CryptoStatus *status)
+{
+    *status = UNINITIALIZED;
+    if (OpensslEvpMdCtxReset(mdCtx) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_MD_CTX_reset failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriKey *privateKey)
 {
     (void)params;
@@ -107,9 +120,8 @@ static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriK
     }
 
     HcfSignSpiEd25519OpensslImpl *impl = (HcfSignSpiEd25519OpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return HCF_INVALID_PARAMS;
+    if (ClearEd25519KeyCtx(impl->mdCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
     }
 
     if (OpensslEvpDigestSignInit(impl->mdCtx, NULL, NULL, NULL,
@@ -186,9 +198,8 @@ static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, Hcf
     }
 
     HcfVerifySpiEd25519OpensslImpl *impl = (HcfVerifySpiEd25519OpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return HCF_INVALID_PARAMS;
+    if (ClearEd25519KeyCtx(impl->mdCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
     }
     EVP_PKEY *pKey = OpensslEvpPkeyDup(((HcfOpensslAlg25519PubKey *)publicKey)->pkey);
     if (pKey == NULL) {
@@ -243,6 +254,61 @@ static bool EngineVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *sign
     return true;
 }
 
+// Ed25519 signs and verifies in one shot, so an initialized context holds no message state to discard.
+static HcfResult EngineSignReset(HcfSignSpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (((HcfSignSpiEd25519OpensslImpl *)self)->status != INITIALIZED) {
+        LOGE("The message has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSignBatch(HcfSignSpi *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob *returnSignatures)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiEd25519OpensslImpl *impl = (HcfSignSpiEd25519OpensslImpl *)self;
+    if (impl->status != INITIALIZED) {
+        LOGE("The message has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    // Without update there is no message data in the context, so it serves as the template as it is.
+    return HcfSignBatchOpenssl(impl->mdCtx, NULL, inputs, count, workerNum, returnArena, returnSignatures);
+}
+
+static HcfResult EngineVerifyReset(HcfVerifySpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (((HcfVerifySpiEd25519OpensslImpl *)self)->status != INITIALIZED) {
+        LOGE("The message has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineGetSignSpecString(HcfSignSpi *self, SignSpecItem item, char **returnString)
 {
     (void)self;
@@ -330,6 +396,8 @@ HcfResult HcfSignSpiEd25519Create(HcfSignatureParams *params, HcfSignSpi **retur
     returnImpl->base.engineSetSignSpecUint8Array = EngineSetSignSpecUint8Array;
     returnImpl->base.engineGetSignSpecInt = EngineGetSignSpecInt;
     returnImpl->base.engineSetSignSpecInt = EngineSetSignSpecInt;
+    returnImpl->base.engineReset = EngineSignReset;
+    returnImpl->base.engineSignBatch = EngineSignBatch;
     returnImpl->status = UNINITIALIZED;
     returnImpl->mdCtx = OpensslEvpMdCtxNew();
     if (returnImpl->mdCtx == NULL) {
@@ -366,6 +434,7 @@ HcfResult HcfVerifySpiEd25519Create(HcfSignatureParams *params, HcfVerifySpi **r
     returnImpl->base.engineSetVerifySpecUint8Array = EngineSetVerifySpecUint8Array;
     returnImpl->base.engineGetVerifySpecInt = EngineGetVerifySpecInt;
     returnImpl->base.engineSetVerifySpecInt = EngineSetVerifySpecInt;
+    returnImpl->base.engineReset = EngineVerifyReset;
     returnImpl->status = UNINITIALIZED;
     returnImpl->mdCtx = OpensslEvpMdCtxNew();
     if (returnImpl->mdCtx == NULL) {
@@ -148,6 +148,18 @@ static HcfResult SetMlDsaOsslParams(EVP_MD_CTX *ctx, bool deterministic, bool mu
     return HCF_SUCCESS;
 }
 
+// Unbind the key of a previous init, keeping the allocated EVP_MD_CTX for the next one.
+static HcfResult ClearMlDsaKeyCtx(EVP_MD_CTX *mdCtx, CryptoStatus *status)
+{
+    *status = UNINITIALIZED;
+    if (OpensslEvpMdCtxReset(mdCtx) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_MD_CTX_reset failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriKey *privateKey)
 {
     (void)params;
@@ -161,9 +173,8 @@ static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriK
         return HCF_ERR_PARAMETER_CHECK_FAILED;
     }
     HcfSignSpiMlDsaOpensslImpl *impl = (HcfSignSpiMlDsaOpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return HCF_ERR_INVALID_CALL;
+    if (ClearMlDsaKeyCtx(impl->mdCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
     }
     if (OpensslEvpDigestSignInit(impl->mdCtx, NULL, NULL, NULL,
         ((HcfOpensslMlDsaPriKey *)privateKey)->pkey) != HCF_OPENSSL_SUCCESS) {
@@ -241,9 +252,8 @@ static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, Hcf
         return HCF_ERR_PARAMETER_CHECK_FAILED;
     }
     HcfVerifySpiMlDsaOpensslImpl *impl = (HcfVerifySpiMlDsaOpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return HCF_ERR_INVALID_CALL;
+    if (ClearMlDsaKeyCtx(impl->mdCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
     }
     EVP_PKEY *pKey = OpensslEvpPkeyDup(((HcfOpensslMlDsaPubKey *)publicKey)->pkey);
     if (pKey == NULL) {
@@ -302,6 +312,41 @@ static bool EngineVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *sign
     return true;
 }
 
+// ML-DSA signs and verifies in one shot, so an initialized context holds no message state to discard.
+static HcfResult EngineSignReset(HcfSignSpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (((HcfSignSpiMlDsaOpensslImpl *)self)->status != INITIALIZED) {
+        LOGE("The message has not been initialized.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineVerifyReset(HcfVerifySpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_ERR_PARAMETER_CHECK_FAILED;
+    }
+    if (((HcfVerifySpiMlDsaOpensslImpl *)self)->status != INITIALIZED) {
+        LOGE("The message has not been initialized.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineRecover(HcfVerifySpi *self, HcfBlob *signatureData, HcfBlob *rawSignatureData)
 {
     (void)self;
@@ -510,6 +555,7 @@ HcfResult HcfSignSpiMlDsaCreate(HcfSignatureParams *params, HcfSignSpi **returnO
     returnImpl->base.engineGetSignSpecInt = EngineGetSignSpecInt;
     returnImpl->base.engineSetSignSpecInt = EngineSetSignSpecInt;
     returnImpl->base.engineSetSignSpecBool = EngineSetSignSpecBool;
+    returnImpl->base.engineReset = EngineSignReset;
     returnImpl->status = UNINITIALIZED;
     returnImpl->mdCtx = OpensslEvpMdCtxNew();
     if (returnImpl->mdCtx == NULL) {
@@ -545,6 +591,7 @@ HcfResult HcfVerifySpiMlDsaCreate(HcfSignatureParams *params, HcfVerifySpi **ret
     returnImpl->base.engineGetVerifySpecInt = EngineGetVerifySpecInt;
     returnImpl->base.engineSetVerifySpecInt = EngineSetVerifySpecInt;
     returnImpl->base.engineSetVerifySpecBool = EngineSetVerifySpecBool;
+    returnImpl->base.engineReset = EngineVerifyReset;
     returnImpl->status = UNINITIALIZED;
     returnImpl->mdCtx = OpensslEvpMdCtxNew();
     if (returnImpl->mdCtx == NULL) {
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "signature_batch_openssl.h"
+
+#include <securec.h>
+
+#include "hcf_parallel.h"
+#include "log.h"
+#include "memory.h"
+#include "openssl_adapter.h"
+#include "openssl_common.h"
+
+typedef struct {
+    const EVP_MD_CTX *mdCtx;
+    const EVP_PKEY_CTX *pkeyCtx;
+    const HcfBlob *inputs;
+    HcfBlob *signatures;
+    uint8_t *arena;
+    size_t slotLen;
+    uint32_t count;
+    uint32_t rangeNum;
+} SignBatchCtx;
+
+HcfResult HcfSignBatchDupRestartedCtx(const EVP_MD_CTX *srcCtx, const EVP_MD *digestAlg, EVP_MD_CTX **returnCtx,
+    EVP_PKEY_CTX **returnPkeyCtx)
+{
+    if ((srcCtx == NULL) || (returnCtx == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    EVP_MD_CTX *ctx = OpensslEvpMdCtxNew();
+    if (ctx == NULL) {
+        LOGE("Failed to allocate ctx memory!");
+        return HCF_ERR_MALLOC;
+    }
+    if (OpensslEvpMdCtxCopyEx(ctx, srcCtx) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_MD_CTX_copy_ex failed.");
+        OpensslEvpMdCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    // A NULL key restarts the digest on the key and signature context of the copy.
+    EVP_PKEY_CTX *pkeyCtx = NULL;
+    if (OpensslEvpDigestSignInit(ctx, &pkeyCtx, digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_DigestSignInit failed.");
+        OpensslEvpMdCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnCtx = ctx;
+    if (returnPkeyCtx != NULL) {
+        *returnPkeyCtx = pkeyCtx;
+    }
+    return HCF_SUCCESS;
+}
+
+/* Range taskIndex of the batch, the ranges differ in size by at most one entry. */
+static void GetSignBatchRange(const SignBatchCtx *batch, uint32_t taskIndex, uint32_t *start, uint32_t *end)
+{
+    *start = (uint32_t)((uint64_t)batch->count * taskIndex / batch->rangeNum);
+    *end = (uint32_t)((uint64_t)batch->count * (taskIndex + 1) / batch->rangeNum);
+}
+
+static HcfResult SignBatchDigestRange(void *arg, uint32_t taskIndex)
+{
+    const SignBatchCtx *batch = (const SignBatchCtx *)arg;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    GetSignBatchRange(batch, taskIndex, &start, &end);
+    EVP_MD_CTX *ctx = OpensslEvpMdCtxNew();
+    if (ctx == NULL) {
+        LOGE("Failed to allocate ctx memory!");
+        return HCF_ERR_MALLOC;
+    }
+    HcfResult ret = HCF_SUCCESS;
+    for (uint32_t i = start; i < end; i++) {
+        if (OpensslEvpMdCtxCopyEx(ctx, batch->mdCtx) != HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("EVP_MD_CTX_copy_ex failed.");
+            ret = HCF_ERR_CRYPTO_OPERATION;
+            break;
+        }
+        // The copy is discarded after one signature, so the final step need not duplicate its signature context.
+        OpensslEvpMdCtxSetFlags(ctx, EVP_MD_CTX_FLAG_FINALISE);
+        uint8_t *sig = batch->arena + (size_t)i * batch->slotLen;
+        size_t sigLen = batch->slotLen;
+        if (OpensslEvpDigestSign(ctx, sig, &sigLen, batch->inputs[i].data, batch->inputs[i].len) !=
+            HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("EVP_DigestSign failed.");
+            ret = HCF_ERR_CRYPTO_OPERATION;
+            break;
+        }
+        batch->signatures[i].data = sig;
+        batch->signatures[i].len = sigLen;
+    }
+    OpensslEvpMdCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult SignBatchPkeyRange(void *arg, uint32_t taskIndex)
+{
+    const SignBatchCtx *batch = (const SignBatchCtx *)arg;
+    uint32_t start = 0;
+    uint32_t end = 0;
+    GetSignBatchRange(batch, taskIndex, &start, &end);
+    EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxDup(batch->pkeyCtx);
+    if (ctx == NULL) {
+        HcfPrintOpensslError();
+        LOGE("EVP_PKEY_CTX_dup failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = HCF_SUCCESS;
+    for (uint32_t i = start; i < end; i++) {
+        uint8_t *sig = batch->arena + (size_t)i * batch->slotLen;
+        size_t sigLen = batch->slotLen;
+        if (OpensslEvpPkeySign(ctx, sig, &sigLen, batch->inputs[i].data, batch->inputs[i].len) !=
+            HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("EVP_PKEY_sign failed.");
+            ret = HCF_ERR_CRYPTO_OPERATION;
+            break;
+        }
+        batch->signatures[i].data = sig;
+        batch->signatures[i].len = sigLen;
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
+/* The maximum signature length depends on the key only, so one query on a scratch copy covers the whole batch. */
+static HcfResult GetSignBatchSlotLen(const SignBatchCtx *batch, size_t *slotLen)
+{
+    int ret = 0;
+    if (batch->mdCtx != NULL) {
+        EVP_MD_CTX *ctx = OpensslEvpMdCtxNew();
+        if (ctx == NULL) {
+            LOGE("Failed to allocate ctx memory!");
+            return HCF_ERR_MALLOC;
+        }
+        ret = OpensslEvpMdCtxCopyEx(ctx, batch->mdCtx);
+        if (ret == HCF_OPENSSL_SUCCESS) {
+            ret = OpensslEvpDigestSign(ctx, NULL, slotLen, batch->inputs[0].data, batch->inputs[0].len);
+        }
+        OpensslEvpMdCtxFree(ctx);
+    } else {
+        EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxDup(batch->pkeyCtx);
+        if (ctx != NULL) {
+            ret = OpensslEvpPkeySign(ctx, NULL, slotLen, batch->inputs[0].data, batch->inputs[0].len);
+        }
+        OpensslEvpPkeyCtxFree(ctx);
+    }
+    if ((ret != HCF_OPENSSL_SUCCESS) || (*slotLen == 0)) {
+        HcfPrintOpensslError();
+        LOGE("Failed to get the maximum signature length.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult RunSignBatch(SignBatchCtx *batch, uint32_t workerNum)
+{
+    HcfParallelTaskFunc func = (batch->mdCtx != NULL) ? SignBatchDigestRange : SignBatchPkeyRange;
+    if (workerNum <= 1) {
+        batch->rangeNum = 1;
+        return func(batch, 0);
+    }
+    batch->rangeNum = (workerNum < batch->count) ? workerNum : batch->count;
+    return HcfParallelRun(batch->rangeNum, batch->rangeNum, func, batch);
+}
+
+HcfResult HcfSignBatchOpenssl(const EVP_MD_CTX *mdCtx, const EVP_PKEY_CTX *pkeyCtx, const HcfBlob *inputs,
+    uint32_t count, uint32_t workerNum, HcfBlob *returnArena, HcfBlob *returnSignatures)
+{
+    if (((mdCtx == NULL) == (pkeyCtx == NULL)) || (inputs == NULL) || (count == 0) || (returnArena == NULL) ||
+        (returnSignatures == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    SignBatchCtx batch = {
+        .mdCtx = mdCtx,
+        .pkeyCtx = pkeyCtx,
+        .inputs = inputs,
+        .signatures = returnSignatures,
+        .count = count,
+    };
+    HcfResult ret = GetSignBatchSlotLen(&batch, &batch.slotLen);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    if (batch.slotLen > UINT32_MAX / count) {
+        LOGE("Batch is too large.");
+        return HCF_INVALID_PARAMS;
+    }
+    uint32_t arenaLen = (uint32_t)batch.slotLen * count;
+    batch.arena = (uint8_t *)HcfMalloc(arenaLen, 0);
+    if (batch.arena == NULL) {
+        LOGE("Failed to allocate arena memory!");
+        return HCF_ERR_MALLOC;
+    }
+    ret = RunSignBatch(&batch, workerNum);
+    if (ret != HCF_SUCCESS) {
+        HcfFree(batch.arena);
+        (void)memset_s(returnSignatures, sizeof(HcfBlob) * count, 0, sizeof(HcfBlob) * count);
+        return ret;
+    }
+    returnArena->data = batch.arena;
+    returnArena->len = arenaLen;
+    return HCF_SUCCESS;
+}
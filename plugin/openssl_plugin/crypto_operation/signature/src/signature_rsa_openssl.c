@@ -28,6 +28,7 @@
 #include "openssl_class.h"
 #include "openssl_common.h"
 #include "rsa_openssl_common.h"
+#include "signature_batch_openssl.h"
 #include "utils.h"
 
 #define PSS_TRAILER_FIELD_SUPPORTED_INT 1
@@ -197,6 +198,22 @@ static HcfResult SetPaddingAndDigest(EVP_PKEY_CTX *ctx, int32_t hcfPadding, int3
     return HCF_SUCCESS;
 }
 
+static HcfResult SetDigestCtxPaddingParams(EVP_PKEY_CTX *ctx, int32_t padding, int32_t md, int32_t mgf1md,
+    int32_t saltLen)
+{
+    if (SetPaddingAndDigest(ctx, padding, md, mgf1md) != HCF_SUCCESS) {
+        LOGE("set padding and digest fail");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (saltLen != PSS_SALTLEN_INVALID_INIT) {
+        if (OpensslEvpPkeyCtxSetRsaPssSaltLen(ctx, saltLen) != HCF_OPENSSL_SUCCESS) {
+            LOGE("get saltLen fail");
+            return HCF_ERR_CRYPTO_OPERATION;
+        }
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult SetOnlySignParams(HcfSignSpiRsaOpensslImpl *impl, HcfPriKey *privateKey)
 {
     EVP_PKEY *dupKey = InitRsaEvpKey((HcfKey *)privateKey, true);
@@ -267,20 +284,30 @@ static HcfResult SetSignParams(HcfSignSpiRsaOpensslImpl *impl, HcfPriKey *privat
         LOGE("Failed to initialize digest signing.");
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    if (SetPaddingAndDigest(ctx, impl->padding, impl->md, impl->mgf1md) != HCF_SUCCESS) {
-        LOGE("set padding and digest fail");
-        return HCF_ERR_CRYPTO_OPERATION;
-    }
-    if (impl->saltLen != PSS_SALTLEN_INVALID_INIT) {
-        if (OpensslEvpPkeyCtxSetRsaPssSaltLen(ctx, impl->saltLen) != HCF_OPENSSL_SUCCESS) {
-            LOGE("get saltLen fail");
-            return HCF_ERR_CRYPTO_OPERATION;
-        }
+    HcfResult res = SetDigestCtxPaddingParams(ctx, impl->padding, impl->md, impl->mgf1md, impl->saltLen);
+    if (res != HCF_SUCCESS) {
+        return res;
     }
     impl->ctx = ctx;
     return HCF_SUCCESS;
 }
 
+// Unbind the key of a previous init, keeping the allocated EVP_MD_CTX for the next one.
+static HcfResult ClearSignKeyCtx(HcfSignSpiRsaOpensslImpl *impl)
+{
+    impl->initFlag = UNINITIALIZED;
+    // ctx is owned by mdctx unless only sign
+    if (impl->operation == HCF_OPERATION_ONLY_SIGN) {
+        OpensslEvpPkeyCtxFree(impl->ctx);
+    }
+    impl->ctx = NULL;
+    if (OpensslEvpMdCtxReset(impl->mdctx) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Failed to reset md ctx.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriKey *privateKey)
 {
     (void)params;
@@ -293,16 +320,15 @@ static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriK
         return HCF_INVALID_PARAMS;
     }
     HcfSignSpiRsaOpensslImpl *impl = (HcfSignSpiRsaOpensslImpl *)self;
-    if (impl->initFlag != UNINITIALIZED) {
-        LOGE("Sign has been init");
-        return HCF_INVALID_PARAMS;
-    }
     if (CheckInitKeyType((HcfKey *)privateKey, true) != HCF_SUCCESS) {
         LOGE("KeyType dismatch.");
         return HCF_INVALID_PARAMS;
     }
 
-    HcfResult ret = SetSignParams(impl, privateKey);
+    HcfResult ret = ClearSignKeyCtx(impl);
+    if (ret == HCF_SUCCESS) {
+        ret = SetSignParams(impl, privateKey);
+    }
     if (ret == HCF_ERR_CRYPTO_OPERATION) {
         HcfPrintOpensslError();
     }
@@ -390,15 +416,9 @@ static HcfResult SetVerifyParams(HcfVerifySpiRsaOpensslImpl *impl, HcfPubKey *pu
         HcfPrintOpensslError();
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    if (SetPaddingAndDigest(ctx, impl->padding, impl->md, impl->mgf1md) != HCF_SUCCESS) {
-        LOGE("set padding and digest fail");
-        return HCF_ERR_CRYPTO_OPERATION;
-    }
-    if (impl->saltLen != PSS_SALTLEN_INVALID_INIT) {
-        if (OpensslEvpPkeyCtxSetRsaPssSaltLen(ctx, impl->saltLen) != HCF_OPENSSL_SUCCESS) {
-            LOGE("get saltLen fail");
-            return HCF_ERR_CRYPTO_OPERATION;
-        }
+    HcfResult res = SetDigestCtxPaddingParams(ctx, impl->padding, impl->md, impl->mgf1md, impl->saltLen);
+    if (res != HCF_SUCCESS) {
+        return res;
     }
     impl->ctx = ctx;
     return HCF_SUCCESS;
@@ -452,6 +472,21 @@ static HcfResult SetVerifyRecoverParams(HcfVerifySpiRsaOpensslImpl *impl, HcfPub
     return HCF_SUCCESS;
 }
 
+static HcfResult ClearVerifyKeyCtx(HcfVerifySpiRsaOpensslImpl *impl)
+{
+    impl->initFlag = UNINITIALIZED;
+    // ctx is owned by mdctx unless only verify or verify recover
+    if (impl->operation == RSA_VERIFY_RECOVER || impl->operation == RSA_DIGEST_ONLY_VERIFY) {
+        OpensslEvpPkeyCtxFree(impl->ctx);
+    }
+    impl->ctx = NULL;
+    if ((impl->mdctx != NULL) && (OpensslEvpMdCtxReset(impl->mdctx) != HCF_OPENSSL_SUCCESS)) {
+        LOGE("Failed to reset md ctx.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, HcfPubKey *publicKey)
 {
     (void)params;
@@ -464,14 +499,14 @@ static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, Hcf
         return HCF_INVALID_PARAMS;
     }
     HcfVerifySpiRsaOpensslImpl *impl = (HcfVerifySpiRsaOpensslImpl *)self;
-    if (impl->initFlag != UNINITIALIZED) {
-        LOGE("Verigy has been init.");
-        return HCF_INVALID_PARAMS;
-    }
     if (CheckInitKeyType((HcfKey *)publicKey, false) != HCF_SUCCESS) {
         LOGE("KeyType dismatch.");
         return HCF_INVALID_PARAMS;
     }
+    if (ClearVerifyKeyCtx(impl) != HCF_SUCCESS) {
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
 
     if (impl->operation == RSA_DIGEST_VERIFY || impl->operation == RSA_DIGEST_ONLY_VERIFY) {
         if (SetVerifyParams(impl, publicKey) != HCF_SUCCESS) {
@@ -754,6 +789,113 @@ static HcfResult EngineRecover(HcfVerifySpi *self, HcfBlob *signatureData, HcfBl
     return HCF_SUCCESS;
 }
 
+static HcfResult EngineSignReset(HcfSignSpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_RSA_SIGN_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiRsaOpensslImpl *impl = (HcfSignSpiRsaOpensslImpl *)self;
+    if (impl->initFlag != INITIALIZED) {
+        LOGE("The Sign has not been init");
+        return HCF_INVALID_PARAMS;
+    }
+    // The only sign pkey ctx keeps no message state.
+    if (impl->operation == HCF_OPERATION_ONLY_SIGN) {
+        return HCF_SUCCESS;
+    }
+    // A NULL key restarts the digest on the same key; the provider drops the padding settings, so set them again.
+    EVP_MD *opensslAlg = NULL;
+    (void)GetOpensslDigestAlg(impl->md, &opensslAlg);
+    EVP_PKEY_CTX *ctx = NULL;
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    if (OpensslEvpDigestSignInit(impl->mdctx, &ctx, opensslAlg, NULL, NULL) == HCF_OPENSSL_SUCCESS) {
+        ret = SetDigestCtxPaddingParams(ctx, impl->padding, impl->md, impl->mgf1md, impl->saltLen);
+    }
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to reset digest signing.");
+        HcfPrintOpensslError();
+        impl->initFlag = UNINITIALIZED;
+        return ret;
+    }
+    impl->ctx = ctx;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSignBatch(HcfSignSpi *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob *returnSignatures)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_RSA_SIGN_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiRsaOpensslImpl *impl = (HcfSignSpiRsaOpensslImpl *)self;
+    if (impl->initFlag != INITIALIZED) {
+        LOGE("The Sign has not been init");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->operation == HCF_OPERATION_ONLY_SIGN) {
+        return HcfSignBatchOpenssl(NULL, impl->ctx, inputs, count, workerNum, returnArena, returnSignatures);
+    }
+    EVP_MD *opensslAlg = NULL;
+    (void)GetOpensslDigestAlg(impl->md, &opensslAlg);
+    EVP_MD_CTX *mdCtx = NULL;
+    EVP_PKEY_CTX *ctx = NULL;
+    HcfResult ret = HcfSignBatchDupRestartedCtx(impl->mdctx, opensslAlg, &mdCtx, &ctx);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = SetDigestCtxPaddingParams(ctx, impl->padding, impl->md, impl->mgf1md, impl->saltLen);
+    if (ret == HCF_SUCCESS) {
+        ret = HcfSignBatchOpenssl(mdCtx, NULL, inputs, count, workerNum, returnArena, returnSignatures);
+    }
+    OpensslEvpMdCtxFree(mdCtx);
+    return ret;
+}
+
+static HcfResult EngineVerifyReset(HcfVerifySpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_RSA_VERIFY_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiRsaOpensslImpl *impl = (HcfVerifySpiRsaOpensslImpl *)self;
+    if (impl->initFlag != INITIALIZED) {
+        LOGE("The Verify has not been init");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->operation != RSA_DIGEST_VERIFY) {
+        return HCF_SUCCESS;
+    }
+    EVP_MD *opensslAlg = NULL;
+    (void)GetOpensslDigestAlg(impl->md, &opensslAlg);
+    EVP_PKEY_CTX *ctx = NULL;
+    HcfResult ret = HCF_ERR_CRYPTO_OPERATION;
+    if (OpensslEvpDigestVerifyInit(impl->mdctx, &ctx, opensslAlg, NULL, NULL) == HCF_OPENSSL_SUCCESS) {
+        ret = SetDigestCtxPaddingParams(ctx, impl->padding, impl->md, impl->mgf1md, impl->saltLen);
+    }
+    if (ret != HCF_SUCCESS) {
+        LOGE("Failed to reset digest verification.");
+        HcfPrintOpensslError();
+        impl->initFlag = UNINITIALIZED;
+        return ret;
+    }
+    impl->ctx = ctx;
+    return HCF_SUCCESS;
+}
+
 static HcfResult CheckOnlySignatureParams(HcfSignatureParams *params)
 {
     int32_t opensslPadding = 0;
@@ -1055,6 +1197,45 @@ static HcfResult EngineGetVerifySpecString(HcfVerifySpi *self, SignSpecItem item
     return ret;
 }
 
+// Prehash mode signs a digest of md on an EVP_PKEY_sign context, so it needs a digest and a DigestInfo or PSS encoding.
+static bool IsRsaPrehashSupported(int32_t padding, int32_t md)
+{
+    EVP_MD *opensslAlg = NULL;
+    (void)GetOpensslDigestAlg(md, &opensslAlg);
+    return (opensslAlg != NULL) && (padding == HCF_OPENSSL_RSA_PKCS1_PADDING || padding == HCF_OPENSSL_RSA_PSS_PADDING);
+}
+
+static HcfResult EngineSetSignSpecBool(HcfSignSpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter");
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid sign spec item");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_RSA_SIGN_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiRsaOpensslImpl *impl = (HcfSignSpiRsaOpensslImpl *)self;
+    if (impl->initFlag != UNINITIALIZED) {
+        LOGE("Set sign spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    if (!IsRsaPrehashSupported(impl->padding, impl->md)) {
+        LOGE("Prehash needs a digest and PKCS1 or PSS padding.");
+        return HCF_INVALID_PARAMS;
+    }
+    // The only sign path is the prehash one. A ctx left by a failed reset belongs to mdctx and must not be freed.
+    if (impl->operation == HCF_OPERATION_SIGN) {
+        impl->ctx = NULL;
+    }
+    impl->operation = flag ? HCF_OPERATION_ONLY_SIGN : HCF_OPERATION_SIGN;
+    return HCF_SUCCESS;
+}
+
 HcfResult HcfSignSpiRsaCreate(HcfSignatureParams *params, HcfSignSpi **returnObj)
 {
     if (params == NULL || returnObj == NULL) {
@@ -1080,6 +1261,9 @@ HcfResult HcfSignSpiRsaCreate(HcfSignatureParams *params, HcfSignSpi **returnObj
     returnImpl->base.engineGetSignSpecInt = EngineGetSignSpecInt;
     returnImpl->base.engineGetSignSpecString = EngineGetSignSpecString;
     returnImpl->base.engineSetSignSpecUint8Array = EngineSetSignSpecUint8Array;
+    returnImpl->base.engineSetSignSpecBool = EngineSetSignSpecBool;
+    returnImpl->base.engineReset = EngineSignReset;
+    returnImpl->base.engineSignBatch = EngineSignBatch;
     returnImpl->md = params->md;
     returnImpl->padding = params->padding;
     returnImpl->mgf1md = params->mgf1md;
@@ -1097,6 +1281,36 @@ HcfResult HcfSignSpiRsaCreate(HcfSignatureParams *params, HcfSignSpi **returnObj
     return HCF_SUCCESS;
 }
 
+static HcfResult EngineSetVerifySpecBool(HcfVerifySpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter");
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid verify spec item");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_RSA_VERIFY_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiRsaOpensslImpl *impl = (HcfVerifySpiRsaOpensslImpl *)self;
+    if (impl->initFlag != UNINITIALIZED) {
+        LOGE("Set verify spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    if ((impl->operation == RSA_VERIFY_RECOVER) || !IsRsaPrehashSupported(impl->padding, impl->md)) {
+        LOGE("Prehash needs a digest and PKCS1 or PSS padding.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->operation == RSA_DIGEST_VERIFY) {
+        impl->ctx = NULL;
+    }
+    impl->operation = flag ? RSA_DIGEST_ONLY_VERIFY : RSA_DIGEST_VERIFY;
+    return HCF_SUCCESS;
+}
+
 static HcfResult CheckVerifyRecoverParams(HcfSignatureParams *params)
 {
     int32_t opensslPadding = 0;
@@ -1129,6 +1343,8 @@ static HcfResult InitRsaVerifyImpl(HcfSignatureParams *params, HcfVerifySpiRsaOp
     impl->base.engineGetVerifySpecInt = EngineGetVerifySpecInt;
     impl->base.engineGetVerifySpecString = EngineGetVerifySpecString;
     impl->base.engineSetVerifySpecUint8Array = EngineSetVerifySpecUint8Array;
+    impl->base.engineSetVerifySpecBool = EngineSetVerifySpecBool;
+    impl->base.engineReset = EngineVerifyReset;
     impl->md = params->md;
     impl->padding = params->padding;
     if (params->operation != HCF_ALG_VERIFY_RECOVER) {
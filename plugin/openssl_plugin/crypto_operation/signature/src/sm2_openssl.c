@@ -25,6 +25,7 @@
 #include "openssl_adapter.h"
 #include "openssl_class.h"
 #include "openssl_common.h"
+#include "signature_batch_openssl.h"
 #include "log.h"
 #include "memory.h"
 #include "utils.h"
@@ -41,7 +42,11 @@ typedef struct {
 
     EVP_MD_CTX *mdCtx;
 
+    EVP_PKEY_CTX *pkeyCtx;  // For prehash mode
+
     CryptoStatus status;
+
+    bool isPrehash;
 } HcfSignSpiSm2OpensslImpl;
 
 typedef struct {
@@ -53,7 +58,11 @@ typedef struct {
 
     EVP_MD_CTX *mdCtx;
 
+    EVP_PKEY_CTX *pkeyCtx;  // For prehash mode
+
     CryptoStatus status;
+
+    bool isPrehash;
 } HcfVerifySpiSm2OpensslImpl;
 
 static bool IsDigestAlgValid(uint32_t alg)
@@ -94,6 +103,8 @@ static void DestroySm2Sign(HcfObjectBase *self)
         OpensslEvpMdCtxFree(impl->mdCtx);
         impl->mdCtx = NULL;
     }
+    OpensslEvpPkeyCtxFree(impl->pkeyCtx);
+    impl->pkeyCtx = NULL;
     HcfFree(impl->userId.data);
     impl->userId.data = NULL;
     HcfFree(impl);
@@ -116,6 +127,8 @@ static void DestroySm2Verify(HcfObjectBase *self)
         OpensslEvpMdCtxFree(impl->mdCtx);
         impl->mdCtx = NULL;
     }
+    OpensslEvpPkeyCtxFree(impl->pkeyCtx);
+    impl->pkeyCtx = NULL;
     HcfFree(impl->userId.data);
     impl->userId.data = NULL;
     HcfFree(impl);
@@ -167,6 +180,51 @@ static HcfResult SetSM2Id(EVP_MD_CTX *mdCtx, EVP_PKEY *pKey, HcfBlob userId)
     return HCF_SUCCESS;
 }
 
+// Unbind the key of a previous init, keeping the allocated EVP_MD_CTX for the next one.
+static HcfResult ClearSm2KeyCtx(EVP_MD_CTX *mdCtx, EVP_PKEY_CTX **prehashCtx, CryptoStatus *status)
+{
+    *status = UNINITIALIZED;
+    OpensslEvpPkeyCtxFree(*prehashCtx);
+    *prehashCtx = NULL;
+    // The pKeyCtx installed by SetSM2Id is not owned by mdCtx and survives the reset.
+    EVP_PKEY_CTX *pKeyCtx = OpensslEvpMdCtxGetPkeyCtx(mdCtx);
+    int ret = OpensslEvpMdCtxReset(mdCtx);
+    OpensslEvpPkeyCtxFree(pKeyCtx);
+    if (ret != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_MD_CTX_reset failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
+// The digest of prehash mode is e = SM3(Z || M), so the user id is not needed here.
+static HcfResult CreateSm2PrehashPkeyCtx(EVP_PKEY *pKey, const EVP_MD *digestAlg, bool isSign,
+    EVP_PKEY_CTX **returnPkeyCtx)
+{
+    EVP_PKEY_CTX *pkeyCtx = OpensslEvpPkeyCtxNew(pKey, NULL);
+    if (pkeyCtx == NULL) {
+        HcfPrintOpensslError();
+        LOGE("new EVP_PKEY_CTX fail");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    int32_t ret = isSign ? OpensslEvpPkeySignInit(pkeyCtx) : OpensslEvpPkeyVerifyInit(pkeyCtx);
+    if (ret != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_PKEY sign or verify init failed.");
+        OpensslEvpPkeyCtxFree(pkeyCtx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (OpensslEvpPkeyCtxSetSignatureMd(pkeyCtx, digestAlg) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_PKEY_CTX_set_signature_md failed.");
+        OpensslEvpPkeyCtxFree(pkeyCtx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnPkeyCtx = pkeyCtx;
+    return HCF_SUCCESS;
+}
+
 static bool IsSm2SignInitInputValid(HcfSignSpi *self, HcfPriKey *privateKey)
 {
     if ((self == NULL) || (privateKey == NULL)) {
@@ -178,11 +236,6 @@ static bool IsSm2SignInitInputValid(HcfSignSpi *self, HcfPriKey *privateKey)
         LOGE("Class not match.");
         return false;
     }
-    HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return false;
-    }
     return true;
 }
 
@@ -192,6 +245,10 @@ static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriK
     if (!IsSm2SignInitInputValid(self, privateKey)) {
         return HCF_INVALID_PARAMS;
     }
+    HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
+    if (ClearSm2KeyCtx(impl->mdCtx, &impl->pkeyCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
 
     EC_KEY *ecKey = OpensslEcKeyDup(((HcfOpensslSm2PriKey *)privateKey)->ecKey);
     if (ecKey == NULL) {
@@ -214,7 +271,15 @@ static HcfResult EngineSignInit(HcfSignSpi *self, HcfParamsSpec *params, HcfPriK
         return HCF_ERR_CRYPTO_OPERATION;
     }
 
-    HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
+    if (impl->isPrehash) {
+        HcfResult ret = CreateSm2PrehashPkeyCtx(pKey, impl->digestAlg, true, &impl->pkeyCtx);
+        OpensslEvpPkeyFree(pKey);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+        impl->status = READY;
+        return HCF_SUCCESS;
+    }
     if (SetSM2Id(impl->mdCtx, pKey, impl->userId) != HCF_SUCCESS) {
         OpensslEvpPkeyFree(pKey);
         LOGE("Set sm2 user id failed.");
@@ -246,6 +311,10 @@ static HcfResult EngineSignUpdate(HcfSignSpi *self, HcfBlob *data)
         LOGE("Sign object has not been initialized.");
         return HCF_INVALID_PARAMS;
     }
+    if (impl->isPrehash) {
+        LOGE("Update is not supported in prehash mode.");
+        return HCF_ERR_INVALID_CALL;
+    }
     if (OpensslEvpDigestSignUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
         HcfPrintOpensslError();
         LOGE("EVP_DigestSignUpdate failed.");
@@ -255,6 +324,38 @@ static HcfResult EngineSignUpdate(HcfSignSpi *self, HcfBlob *data)
     return HCF_SUCCESS;
 }
 
+static HcfResult EngineSignPrehash(HcfSignSpiSm2OpensslImpl *impl, HcfBlob *data, HcfBlob *returnSignatureData)
+{
+    if (!HcfIsBlobValid(data)) {
+        LOGE("Prehash mode requires valid digest data.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->status != READY) {
+        LOGE("Sign object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    size_t maxLen;
+    if (OpensslEvpPkeySign(impl->pkeyCtx, NULL, &maxLen, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_PKEY_sign get maxLen failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    uint8_t *outData = (uint8_t *)HcfMalloc(maxLen, 0);
+    if (outData == NULL) {
+        LOGE("Failed to allocate outData memory!");
+        return HCF_ERR_MALLOC;
+    }
+    if (OpensslEvpPkeySign(impl->pkeyCtx, outData, &maxLen, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_PKEY_sign failed.");
+        HcfFree(outData);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    returnSignatureData->data = outData;
+    returnSignatureData->len = (uint32_t)maxLen;
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSignDoFinal(HcfSignSpi *self, HcfBlob *data, HcfBlob *returnSignatureData)
 {
     if ((self == NULL) || (returnSignatureData == NULL)) {
@@ -267,6 +368,9 @@ static HcfResult EngineSignDoFinal(HcfSignSpi *self, HcfBlob *data, HcfBlob *ret
     }
 
     HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
+    if (impl->isPrehash) {
+        return EngineSignPrehash(impl, data, returnSignatureData);
+    }
     if (HcfIsBlobValid(data)) {
         if (OpensslEvpDigestSignUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
             HcfPrintOpensslError();
@@ -315,12 +419,6 @@ static bool IsSm2VerifyInitInputValid(HcfVerifySpi *self, HcfPubKey *publicKey)
         LOGE("Class not match.");
         return false;
     }
-
-    HcfVerifySpiSm2OpensslImpl *impl = (HcfVerifySpiSm2OpensslImpl *)self;
-    if (impl->status != UNINITIALIZED) {
-        LOGE("Repeated initialization is not allowed.");
-        return false;
-    }
     return true;
 }
 
@@ -330,6 +428,10 @@ static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, Hcf
     if (!IsSm2VerifyInitInputValid(self, publicKey)) {
         return HCF_INVALID_PARAMS;
     }
+    HcfVerifySpiSm2OpensslImpl *impl = (HcfVerifySpiSm2OpensslImpl *)self;
+    if (ClearSm2KeyCtx(impl->mdCtx, &impl->pkeyCtx, &impl->status) != HCF_SUCCESS) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
 
     EC_KEY *ecKey = OpensslEcKeyDup(((HcfOpensslSm2PubKey *)publicKey)->ecKey);
     if (ecKey == NULL) {
@@ -351,7 +453,15 @@ static HcfResult EngineVerifyInit(HcfVerifySpi *self, HcfParamsSpec *params, Hcf
         OpensslEvpPkeyFree(pKey);
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    HcfVerifySpiSm2OpensslImpl *impl = (HcfVerifySpiSm2OpensslImpl *)self;
+    if (impl->isPrehash) {
+        HcfResult ret = CreateSm2PrehashPkeyCtx(pKey, impl->digestAlg, false, &impl->pkeyCtx);
+        OpensslEvpPkeyFree(pKey);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+        impl->status = READY;
+        return HCF_SUCCESS;
+    }
     if (SetSM2Id(impl->mdCtx, pKey, impl->userId) != HCF_SUCCESS) {
         LOGE("Set sm2 user id failed.");
         OpensslEvpPkeyFree(pKey);
@@ -384,6 +494,10 @@ static HcfResult EngineVerifyUpdate(HcfVerifySpi *self, HcfBlob *data)
         LOGE("Verify object has not been initialized.");
         return HCF_INVALID_PARAMS;
     }
+    if (impl->isPrehash) {
+        LOGE("Update is not supported in prehash mode.");
+        return HCF_ERR_INVALID_CALL;
+    }
     if (OpensslEvpDigestVerifyUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
         HcfPrintOpensslError();
         LOGE("EVP_DigestVerifyUpdate failed.");
@@ -405,6 +519,19 @@ static bool EngineVerifyDoFinal(HcfVerifySpi *self, HcfBlob *data, HcfBlob *sign
     }
 
     HcfVerifySpiSm2OpensslImpl *impl = (HcfVerifySpiSm2OpensslImpl *)self;
+    if (impl->isPrehash) {
+        if (!HcfIsBlobValid(data) || (impl->status != READY)) {
+            LOGE("Prehash mode requires an initialized object and valid digest data.");
+            return false;
+        }
+        if (OpensslEvpPkeyVerify(impl->pkeyCtx, signatureData->data, signatureData->len, data->data,
+            data->len) != HCF_OPENSSL_SUCCESS) {
+            HcfPrintOpensslError();
+            LOGE("EVP_PKEY_verify failed.");
+            return false;
+        }
+        return true;
+    }
     if (HcfIsBlobValid(data)) {
         if (OpensslEvpDigestVerifyUpdate(impl->mdCtx, data->data, data->len) != HCF_OPENSSL_SUCCESS) {
             HcfPrintOpensslError();
@@ -434,6 +561,94 @@ static HcfResult EngineGetSignSpecString(HcfSignSpi *self, SignSpecItem item, ch
     return HCF_NOT_SUPPORT;
 }
 
+static HcfResult EngineSignReset(HcfSignSpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Sign object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    // The prehash pkeyCtx keeps no message state.
+    if (impl->isPrehash) {
+        return HCF_SUCCESS;
+    }
+    // A NULL key restarts the digest on the key, user id and signature context already set up.
+    if (OpensslEvpDigestSignInit(impl->mdCtx, NULL, impl->digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_DigestSignInit failed.");
+        impl->status = UNINITIALIZED;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->status = INITIALIZED;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSignBatch(HcfSignSpi *self, const HcfBlob *inputs, uint32_t count, uint32_t workerNum,
+    HcfBlob *returnArena, HcfBlob *returnSignatures)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Sign object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->isPrehash) {
+        return HcfSignBatchOpenssl(NULL, impl->pkeyCtx, inputs, count, workerNum, returnArena, returnSignatures);
+    }
+    // The user id lives in the signature context, which every copy takes over.
+    EVP_MD_CTX *ctx = NULL;
+    HcfResult ret = HcfSignBatchDupRestartedCtx(impl->mdCtx, impl->digestAlg, &ctx, NULL);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = HcfSignBatchOpenssl(ctx, NULL, inputs, count, workerNum, returnArena, returnSignatures);
+    OpensslEvpMdCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult EngineVerifyReset(HcfVerifySpi *self)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, self->base.getClass())) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiSm2OpensslImpl *impl = (HcfVerifySpiSm2OpensslImpl *)self;
+    if (impl->status == UNINITIALIZED) {
+        LOGE("Verify object has not been initialized.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (impl->isPrehash) {
+        return HCF_SUCCESS;
+    }
+    if (OpensslEvpDigestVerifyInit(impl->mdCtx, NULL, impl->digestAlg, NULL, NULL) != HCF_OPENSSL_SUCCESS) {
+        HcfPrintOpensslError();
+        LOGE("EVP_DigestVerifyInit failed.");
+        impl->status = UNINITIALIZED;
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    impl->status = INITIALIZED;
+    return HCF_SUCCESS;
+}
+
 static HcfResult EngineSetSignSpecUint8Array(HcfSignSpi *self, SignSpecItem item, HcfBlob userId)
 {
     if (self == NULL) {
@@ -589,6 +804,52 @@ static HcfResult EngineSetVerifySpecInt(HcfVerifySpi *self, SignSpecItem item, i
     return HCF_NOT_SUPPORT;
 }
 
+static HcfResult EngineSetSignSpecBool(HcfSignSpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_SM2_SIGN_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid input spec");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfSignSpiSm2OpensslImpl *impl = (HcfSignSpiSm2OpensslImpl *)self;
+    if (impl->status != UNINITIALIZED) {
+        LOGE("Set sign spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    impl->isPrehash = flag;
+    return HCF_SUCCESS;
+}
+
+static HcfResult EngineSetVerifySpecBool(HcfVerifySpi *self, SignSpecItem item, bool flag)
+{
+    if (self == NULL) {
+        LOGE("Invalid input parameter");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, OPENSSL_SM2_VERIFY_CLASS)) {
+        LOGE("Class not match.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (item != SIGN_PREHASH_BOOL) {
+        LOGE("Invalid input spec");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfVerifySpiSm2OpensslImpl *impl = (HcfVerifySpiSm2OpensslImpl *)self;
+    if (impl->status != UNINITIALIZED) {
+        LOGE("Set verify spec not allowed after init.");
+        return HCF_ERR_INVALID_CALL;
+    }
+    impl->isPrehash = flag;
+    return HCF_SUCCESS;
+}
+
 static HcfResult CheckSignInputParamsAndDigest(HcfSignatureParams *params, HcfSignSpi **returnObj)
 {
     if ((params == NULL) || (returnObj == NULL)) {
@@ -643,6 +904,9 @@ HcfResult HcfSignSpiSm2Create(HcfSignatureParams *params, HcfSignSpi **returnObj
     returnImpl->base.engineSetSignSpecUint8Array = EngineSetSignSpecUint8Array;
     returnImpl->base.engineGetSignSpecInt = EngineGetSignSpecInt;
     returnImpl->base.engineSetSignSpecInt = EngineSetSignSpecInt;
+    returnImpl->base.engineSetSignSpecBool = EngineSetSignSpecBool;
+    returnImpl->base.engineReset = EngineSignReset;
+    returnImpl->base.engineSignBatch = EngineSignBatch;
     returnImpl->digestAlg = opensslAlg;
     returnImpl->status = UNINITIALIZED;
     returnImpl->userId.data = (uint8_t *)HcfMalloc(strlen(SM2_DEFAULT_USERID) + 1, 0);
@@ -696,6 +960,8 @@ HcfResult HcfVerifySpiSm2Create(HcfSignatureParams *params, HcfVerifySpi **retur
     returnImpl->base.engineSetVerifySpecUint8Array = EngineSetVerifySpecUint8Array;
     returnImpl->base.engineGetVerifySpecInt = EngineGetVerifySpecInt;
     returnImpl->base.engineSetVerifySpecInt = EngineSetVerifySpecInt;
+    returnImpl->base.engineSetVerifySpecBool = EngineSetVerifySpecBool;
+    returnImpl->base.engineReset = EngineVerifyReset;
     returnImpl->digestAlg = opensslAlg;
     returnImpl->status = UNINITIALIZED;
     returnImpl->userId.data = (uint8_t *)HcfMalloc(strlen(SM2_DEFAULT_USERID) + 1, 0);
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HCF_KEY_PAIRS_BATCH_OPENSSL_H
+#define HCF_KEY_PAIRS_BATCH_OPENSSL_H
+
+#include <stdint.h>
+
+#include "hcf_obj_block.h"
+#include "key_pair.h"
+#include "result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct HcfKeyPairsBatch HcfKeyPairsBatch;
+
+/**
+ * @brief Generates the key pairs [start, end) into their slots and stores them in keyPairs.
+ *
+ * A key pair stored in keyPairs owns its slot, the objects of a slot each hold one of the slot references on block.
+ * Slots whose key pair is not stored are released by the caller on failure.
+ */
+typedef HcfResult (*HcfKeyPairsBatchRangeFunc)(const HcfKeyPairsBatch *batch, uint32_t start, uint32_t end);
+
+struct HcfKeyPairsBatch {
+    const void *param;
+    HcfKeyPairsBatchRangeFunc func;
+    HcfObjBlock *block;
+    uint8_t *slots;
+    uint32_t slotLen;
+    uint32_t slotRefNum;
+    HcfKeyPair **keyPairs;
+    uint32_t count;
+    uint32_t rangeNum;
+};
+
+static inline void *HcfKeyPairsBatchGetSlot(const HcfKeyPairsBatch *batch, uint32_t index)
+{
+    return batch->slots + (size_t)index * batch->slotLen;
+}
+
+/**
+ * @brief Runs func over count slots of slotLen bytes, all allocated in one block, on up to workerNum threads.
+ *
+ * Each slot holds the slotRefNum objects of one key pair. On failure every generated key pair is destroyed and
+ * returnKeyPairs is cleared.
+ */
+HcfResult HcfGenerateKeyPairsOpenssl(HcfKeyPairsBatchRangeFunc func, const void *param, uint32_t slotLen,
+    uint32_t slotRefNum, uint32_t count, uint32_t workerNum, HcfKeyPair **returnKeyPairs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,11 +21,14 @@
 #include <string.h>
 
 #include "detailed_alg_25519_key_params.h"
+#include "key_pairs_batch_openssl.h"
 #include "log.h"
 #include "memory.h"
 #include "openssl_adapter.h"
 #include "openssl_class.h"
 #include "openssl_common.h"
+#include "openssl_key_decoder.h"
+#include "pub_key_cache_openssl.h"
 #include "utils.h"
 
 #define OPENSSL_ED25519_GENERATOR_CLASS "OPENSSL.ED25519.KEYGENERATOR"
@@ -99,7 +102,7 @@ static void DestroyAlg25519PubKey(HcfObjectBase *self)
     HcfOpensslAlg25519PubKey *impl = (HcfOpensslAlg25519PubKey *)self;
     OpensslEvpPkeyFree(impl->pkey);
     impl->pkey = NULL;
-    HcfFree(impl);
+    HcfObjBlockFreeObj(impl->block, impl);
 }
 
 static void DestroyAlg25519PriKey(HcfObjectBase *self)
@@ -115,7 +118,7 @@ static void DestroyAlg25519PriKey(HcfObjectBase *self)
     HcfOpensslAlg25519PriKey *impl = (HcfOpensslAlg25519PriKey *)self;
     OpensslEvpPkeyFree(impl->pkey);
     impl->pkey = NULL;
-    HcfFree(impl);
+    HcfObjBlockFreeObj(impl->block, impl);
 }
 
 static void DestroyAlg25519KeyPair(HcfObjectBase *self)
@@ -133,7 +136,7 @@ static void DestroyAlg25519KeyPair(HcfObjectBase *self)
     impl->base.pubKey = NULL;
     DestroyAlg25519PriKey((HcfObjectBase *)impl->base.priKey);
     impl->base.priKey = NULL;
-    HcfFree(self);
+    HcfObjBlockFreeObj(impl->block, impl);
 }
 
 static const char *GetAlg25519PubKeyAlgorithm(HcfKey *self)
@@ -731,14 +734,25 @@ static HcfResult GenerateAlg25519PubAndPriKey(int type, HcfOpensslAlg25519PubKey
     return ret;
 }
 
-static HcfResult ConvertAlg25519PubKey(const HcfBlob *pubKeyBlob, HcfOpensslAlg25519PubKey **returnPubKey)
+static HcfResult ConvertAlg25519PubKey(int type, const HcfBlob *pubKeyBlob,
+    HcfOpensslAlg25519PubKey **returnPubKey)
 {
-    const unsigned char *tmpData = (const unsigned char *)(pubKeyBlob->data);
-    EVP_PKEY *pkey = OpensslD2iPubKey(NULL, &tmpData, pubKeyBlob->len);
+    PubKeyCacheQuery query;
+    PubKeyCacheInitQuery(PUB_KEY_CACHE_OBJ_EVP_PKEY, (type == EVP_PKEY_ED25519) ? HCF_ALG_ED25519 : HCF_ALG_X25519,
+        0, pubKeyBlob, &query);
+    EVP_PKEY *pkey = (EVP_PKEY *)PubKeyCacheGet(&query);
     if (pkey == NULL) {
-        LOGE("Call d2i_PUBKEY fail.");
-        HcfPrintOpensslError();
-        return HCF_ERR_CRYPTO_OPERATION;
+        pkey = DecodeEcxPubKeyDirect(pubKeyBlob->data, pubKeyBlob->len);
+        if (pkey == NULL) {
+            const unsigned char *tmpData = (const unsigned char *)(pubKeyBlob->data);
+            pkey = OpensslD2iPubKey(NULL, &tmpData, pubKeyBlob->len);
+        }
+        if (pkey == NULL) {
+            LOGE("Call d2i_PUBKEY fail.");
+            HcfPrintOpensslError();
+            return HCF_ERR_CRYPTO_OPERATION;
+        }
+        PubKeyCachePut(&query, pkey);
     }
     HcfResult ret = CreateAlg25519PubKey(pkey, returnPubKey);
     if (ret != HCF_SUCCESS) {
@@ -751,8 +765,11 @@ static HcfResult ConvertAlg25519PubKey(const HcfBlob *pubKeyBlob, HcfOpensslAlg2
 static HcfResult ConvertAlg25519PriKey(int type, const HcfBlob *priKeyBlob,
     HcfOpensslAlg25519PriKey **returnPriKey)
 {
-    const unsigned char *tmpData = (const unsigned char *)(priKeyBlob->data);
-    EVP_PKEY *pkey = OpensslD2iPrivateKey(type, NULL, &tmpData, priKeyBlob->len);
+    EVP_PKEY *pkey = DecodeEcxPriKeyDirect(type, priKeyBlob->data, priKeyBlob->len);
+    if (pkey == NULL) {
+        const unsigned char *tmpData = (const unsigned char *)(priKeyBlob->data);
+        pkey = OpensslD2iPrivateKey(type, NULL, &tmpData, priKeyBlob->len);
+    }
     if (pkey == NULL) {
         LOGE("Call d2i_PrivateKey fail.");
         HcfPrintOpensslError();
@@ -770,7 +787,7 @@ static HcfResult ConvertAlg25519PubAndPriKey(int type, const HcfBlob *pubKeyBlob
     HcfOpensslAlg25519PubKey **returnPubKey, HcfOpensslAlg25519PriKey **returnPriKey)
 {
     if (pubKeyBlob != NULL) {
-        if (ConvertAlg25519PubKey(pubKeyBlob, returnPubKey) != HCF_SUCCESS) {
+        if (ConvertAlg25519PubKey(type, pubKeyBlob, returnPubKey) != HCF_SUCCESS) {
             LOGE("Convert alg25519 public key failed.");
             return HCF_ERR_CRYPTO_OPERATION;
         }
@@ -839,6 +856,89 @@ static HcfResult EngineGenerateAlg25519KeyPair(HcfAsyKeyGeneratorSpi *self, HcfK
     return HCF_SUCCESS;
 }
 
+typedef struct {
+    HcfOpensslAlg25519KeyPair keyPair;
+    HcfOpensslAlg25519PubKey pubKey;
+    HcfOpensslAlg25519PriKey priKey;
+} Alg25519KeyPairSlot;
+
+#define ALG_25519_KEY_PAIR_SLOT_REF_NUM 3
+
+static HcfResult FillAlg25519KeyPairSlot(const HcfKeyPairsBatch *batch, uint32_t index, int type, EVP_PKEY *pkey)
+{
+    // The private key takes the generated key, the public key gets a copy of its own as generateKeyPair gives it.
+    EVP_PKEY *pubPkey = OpensslEvpPkeyDup(pkey);
+    if (pubPkey == NULL) {
+        LOGE("pkey dup failed");
+        HcfPrintOpensslError();
+        OpensslEvpPkeyFree(pkey);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    Alg25519KeyPairSlot *slot = (Alg25519KeyPairSlot *)HcfKeyPairsBatchGetSlot(batch, index);
+    FillOpensslAlg25519PubKeyFunc(&slot->pubKey);
+    slot->pubKey.type = type;
+    slot->pubKey.pkey = pubPkey;
+    slot->pubKey.block = batch->block;
+    FillOpensslAlg25519PriKeyFunc(&slot->priKey);
+    slot->priKey.type = type;
+    slot->priKey.pkey = pkey;
+    slot->priKey.block = batch->block;
+    slot->keyPair.base.base.getClass = GetAlg25519KeyPairClass;
+    slot->keyPair.base.base.destroy = DestroyAlg25519KeyPair;
+    slot->keyPair.base.pubKey = (HcfPubKey *)&slot->pubKey;
+    slot->keyPair.base.priKey = (HcfPriKey *)&slot->priKey;
+    slot->keyPair.block = batch->block;
+    batch->keyPairs[index] = (HcfKeyPair *)&slot->keyPair;
+    return HCF_SUCCESS;
+}
+
+static HcfResult GenerateAlg25519KeyPairsRange(const HcfKeyPairsBatch *batch, uint32_t start, uint32_t end)
+{
+    int type = *(const int *)batch->param;
+    // One keygen context serves the whole range instead of one context per key.
+    EVP_PKEY_CTX *ctx = OpensslEvpPkeyCtxNewId(type, NULL);
+    if (ctx == NULL) {
+        LOGE("Create params ctx failed.");
+        return HCF_ERR_MALLOC;
+    }
+    if (OpensslEvpPkeyKeyGenInit(ctx) != HCF_OPENSSL_SUCCESS) {
+        LOGE("Key ctx generate init failed.");
+        OpensslEvpPkeyCtxFree(ctx);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = HCF_SUCCESS;
+    for (uint32_t i = start; i < end; i++) {
+        EVP_PKEY *pkey = NULL;
+        if (OpensslEvpPkeyKeyGen(ctx, &pkey) != HCF_OPENSSL_SUCCESS) {
+            LOGE("Generate pkey failed.");
+            ret = HCF_ERR_CRYPTO_OPERATION;
+            break;
+        }
+        ret = FillAlg25519KeyPairSlot(batch, i, type, pkey);
+        if (ret != HCF_SUCCESS) {
+            break;
+        }
+    }
+    OpensslEvpPkeyCtxFree(ctx);
+    return ret;
+}
+
+static HcfResult EngineGenerateAlg25519KeyPairs(HcfAsyKeyGeneratorSpi *self, uint32_t count, uint32_t workerNum,
+    HcfKeyPair **returnKeyPairs)
+{
+    if (self == NULL || returnKeyPairs == NULL) {
+        LOGE("Invalid params.");
+        return HCF_INVALID_PARAMS;
+    }
+    int type = 0;
+    if (CheckClassMatch(self, &type) != HCF_SUCCESS) {
+        LOGE("Invalid class of self.");
+        return HCF_INVALID_PARAMS;
+    }
+    return HcfGenerateKeyPairsOpenssl(GenerateAlg25519KeyPairsRange, &type, sizeof(Alg25519KeyPairSlot),
+        ALG_25519_KEY_PAIR_SLOT_REF_NUM, count, workerNum, returnKeyPairs);
+}
+
 static HcfResult EngineConvertAlg25519Key(HcfAsyKeyGeneratorSpi *self, HcfParamsSpec *params, HcfBlob *pubKeyBlob,
     HcfBlob *priKeyBlob, HcfKeyPair **returnKeyPair)
 {
@@ -1294,6 +1394,7 @@ HcfResult HcfAsyKeyGeneratorSpiEd25519Create(HcfAsyKeyGenParams *params, HcfAsyK
     impl->base.base.getClass = GetEd25519KeyGeneratorSpiClass;
     impl->base.base.destroy = DestroyAlg25519KeyGeneratorSpiImpl;
     impl->base.engineGenerateKeyPair = EngineGenerateAlg25519KeyPair;
+    impl->base.engineGenerateKeyPairs = EngineGenerateAlg25519KeyPairs;
     impl->base.engineConvertKey = EngineConvertAlg25519Key;
     impl->base.engineConvertPemKey = EngineConvertEd25519PemKey;
     impl->base.engineGenerateKeyPairBySpec = EngineGenerateAlg25519KeyPairBySpec;
@@ -1320,6 +1421,7 @@ HcfResult HcfAsyKeyGeneratorSpiX25519Create(HcfAsyKeyGenParams *params, HcfAsyKe
     impl->base.base.getClass = GetX25519KeyGeneratorSpiClass;
     impl->base.base.destroy = DestroyAlg25519KeyGeneratorSpiImpl;
     impl->base.engineGenerateKeyPair = EngineGenerateAlg25519KeyPair;
+    impl->base.engineGenerateKeyPairs = EngineGenerateAlg25519KeyPairs;
     impl->base.engineConvertKey = EngineConvertAlg25519Key;
     impl->base.engineConvertPemKey = EngineConvertX25519PemKey;
     impl->base.engineGenerateKeyPairBySpec = EngineGenerateAlg25519KeyPairBySpec;
@@ -23,12 +23,12 @@
 #include "openssl_adapter.h"
 #include "openssl_class.h"
 #include "openssl_common.h"
+#include "openssl_key_decoder.h"
 
 #define OPENSSL_DH_GENERATOR_CLASS "OPENSSL.DH.KEYGENERATOR"
 #define OPENSSL_DH_PUBKEY_FORMAT "X.509"
 #define OPENSSL_DH_PRIKEY_FORMAT "PKCS#8"
 #define ALGORITHM_NAME_DH "DH"
-#define PARAMS_NUM_TWO 2
 #define BIT8 8
 
 typedef struct {
@@ -37,19 +37,6 @@ typedef struct {
     int32_t pBits;
 } HcfAsyKeyGeneratorSpiDhOpensslImpl;
 
-static void FreeCtx(EVP_PKEY_CTX *paramsCtx, EVP_PKEY *paramsPkey, EVP_PKEY_CTX *pkeyCtx)
-{
-    if (paramsCtx != NULL) {
-        OpensslEvpPkeyCtxFree(paramsCtx);
-    }
-    if (paramsPkey != NULL) {
-        OpensslEvpPkeyFree(paramsPkey);
-    }
-    if (pkeyCtx != NULL) {
-        OpensslEvpPkeyCtxFree(pkeyCtx);
-    }
-}
-
 static void FreeCommSpecBn(BIGNUM *p, BIGNUM *g)
 {
     if (p != NULL) {
@@ -462,58 +449,33 @@ static void ClearDhPriKeyMem(HcfPriKey *self)
     impl->sk = NULL;
 }
 
-static EVP_PKEY *ConstructDhOsslParamsAndGenPkey(int32_t dhId, EVP_PKEY_CTX *paramsCtx)
+static HcfResult CheckGeneratedDhKey(const HcfDhNamedGroup *group, EVP_PKEY *pkey)
 {
-    EVP_PKEY *paramsPkey = NULL;
-    OSSL_PARAM params[PARAMS_NUM_TWO];
-    char *nidName = GetNidNameByDhId(dhId);
-    if (nidName == NULL) {
-        LOGE("Get nid name failed.");
-        return NULL;
-    }
-    params[0] = OpensslOsslParamConstructUtf8String("group", nidName, 0);
-    params[1] = OpensslOsslParamConstructEnd();
-    if (OpensslEvpPkeyKeyGenInit(paramsCtx) != HCF_OPENSSL_SUCCESS) {
-        LOGE("ParamsCtx generate init failed.");
-        return NULL;
-    }
-    if (OpensslEvpPkeyCtxSetParams(paramsCtx, params) != HCF_OPENSSL_SUCCESS) {
-        LOGE("ParamsCtx set failed.");
-        return NULL;
-    }
-    if (OpensslEvpPkeyGenerate(paramsCtx, &paramsPkey) != HCF_OPENSSL_SUCCESS) {
-        LOGE("Create generate failed.");
-        return NULL;
+    DH *dh = OpensslEvpPkeyGet1Dh(pkey);
+    if (dh == NULL) {
+        LOGE("Get dh key from pkey failed.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
     }
-    return paramsPkey;
+    HcfResult ret = CheckDhNamedGroupKeyPair(group, OpensslDhGet0PubKey(dh), OpensslDhGet0PrivKey(dh));
+    OpensslDhFree(dh);
+    return ret;
 }
 
 static HcfResult GenerateDhEvpKey(int32_t dhId, EVP_PKEY **ppkey)
 {
+    const HcfDhNamedGroup *group = GetDhNamedGroup(GetNidNameByDhId(dhId));
+    if (group == NULL) {
+        LOGE("Get dh named group failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    EVP_PKEY_CTX *pkeyCtx = OpensslEvpPkeyCtxNew(group->paramsPkey, NULL);
+    if (pkeyCtx == NULL) {
+        LOGE("Create pkey ctx failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
     HcfResult ret = HCF_SUCCESS;
-    EVP_PKEY *paramsPkey = NULL;
-    EVP_PKEY_CTX *pkeyCtx = NULL;
-    EVP_PKEY_CTX *paramsCtx = NULL;
-
     do {
-        paramsCtx = OpensslEvpPkeyCtxNewFromName(NULL, "DH", NULL);
-        if (paramsCtx == NULL) {
-            LOGE("New paramsCtx from name failed.");
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
-        paramsPkey = ConstructDhOsslParamsAndGenPkey(dhId, paramsCtx);
-        if (paramsPkey == NULL) {
-            LOGE("Construct dh params and generate pkey failed.");
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
-        pkeyCtx = OpensslEvpPkeyCtxNew(paramsPkey, NULL);
-        if (pkeyCtx == NULL) {
-            LOGE("Create pkey ctx failed.");
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
         if (OpensslEvpPkeyKeyGenInit(pkeyCtx) != HCF_OPENSSL_SUCCESS) {
             LOGE("Key ctx generate init failed.");
             ret = HCF_ERR_CRYPTO_OPERATION;
@@ -524,7 +486,7 @@ static HcfResult GenerateDhEvpKey(int32_t dhId, EVP_PKEY **ppkey)
             ret = HCF_ERR_CRYPTO_OPERATION;
             break;
         }
-        if (OpensslEvpPkeyCheck(pkeyCtx) != HCF_OPENSSL_SUCCESS) {
+        if (CheckGeneratedDhKey(group, *ppkey) != HCF_SUCCESS) {
             LOGE("Check pkey fail.");
             OpensslEvpPkeyFree(*ppkey);
             *ppkey = NULL;
@@ -532,7 +494,7 @@ static HcfResult GenerateDhEvpKey(int32_t dhId, EVP_PKEY **ppkey)
             break;
         }
     } while (0);
-    FreeCtx(paramsCtx, paramsPkey, pkeyCtx);
+    OpensslEvpPkeyCtxFree(pkeyCtx);
     return ret;
 }
 
@@ -1076,8 +1038,12 @@ static HcfResult CreateDhPriKeyBySpec(const HcfDhPriKeyParamsSpec *paramsSpec, H
 
 static HcfResult ConvertDhPubKey(const HcfBlob *pubKeyBlob, HcfOpensslDhPubKey **returnPubKey)
 {
-    const unsigned char *temp = (const unsigned char *)pubKeyBlob->data;
-    EVP_PKEY *pKey = OpensslD2iPubKey(NULL, &temp, pubKeyBlob->len);
+    EVP_PKEY *pKey = NULL;
+    HcfKeyDecoderParams decoderParams = { "DER", "SubjectPublicKeyInfo", "DH", EVP_PKEY_PUBLIC_KEY };
+    if (DecodeKeyByCachedDecoder(&decoderParams, pubKeyBlob->data, pubKeyBlob->len, &pKey) != HCF_SUCCESS) {
+        const unsigned char *temp = (const unsigned char *)pubKeyBlob->data;
+        pKey = OpensslD2iPubKey(NULL, &temp, pubKeyBlob->len);
+    }
     if (pKey == NULL) {
         LOGE("Call d2i_PUBKEY failed.");
         HcfPrintOpensslError();
@@ -24,9 +24,6 @@
 #include "openssl_common.h"
 #include "utils.h"
 
-#define PARAMS_NUM_TWO 2
-#define PARAMS_NUM_THREE 3
-
 static HcfResult GenerateDhUnknownGroupEvpKey(int32_t pLen, EVP_PKEY **ppkey)
 {
     EVP_PKEY_CTX *paramsCtx = OpensslEvpPkeyCtxNewId(EVP_PKEY_DH, NULL);
@@ -60,75 +57,48 @@ static HcfResult GenerateDhUnknownGroupEvpKey(int32_t pLen, EVP_PKEY **ppkey)
     return ret;
 }
 
-static HcfResult GenerateDhKnownGroupEvpKey(int32_t skLen, char *nidName, EVP_PKEY **ppkey)
+/* The bounds OpenSSL applies to priv_len when generating a key of the group, 0 selects the group default. */
+static bool IsDhKnownGroupSkLenValid(const HcfDhNamedGroup *group, int32_t skLen)
 {
-    HcfResult ret = HCF_SUCCESS;
-    EVP_PKEY_CTX *paramsCtx = NULL;
-    OSSL_PARAM params[PARAMS_NUM_THREE];
-
-    params[0] = OpensslOsslParamConstructUtf8String("group", nidName, 0);
-    if (skLen != 0) {
-        params[1] = OpensslOsslParamConstructInt("priv_len", &skLen);
-        params[PARAMS_NUM_TWO] = OpensslOsslParamConstructEnd();
-    } else {
-        params[1] = OpensslOsslParamConstructEnd();
-    }
-    do {
-        paramsCtx = OpensslEvpPkeyCtxNewFromName(NULL, "DH", NULL);
-        if (paramsCtx == NULL) {
-            LOGE("New paramsCtx from name failed.");
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
-        if (OpensslEvpPkeyKeyGenInit(paramsCtx) != HCF_OPENSSL_SUCCESS) {
-            LOGE("Pkey keygen init failed.");
-            HcfPrintOpensslError();
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
-        if (OpensslEvpPkeyCtxSetParams(paramsCtx, params) != HCF_OPENSSL_SUCCESS) {
-            LOGE("Set paramsCtx failed.");
-            HcfPrintOpensslError();
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
-        if (OpensslEvpPkeyGenerate(paramsCtx, ppkey) != HCF_OPENSSL_SUCCESS) {
-            LOGE("Generate pKey failed.");
-            HcfPrintOpensslError();
-            ret = HCF_ERR_CRYPTO_OPERATION;
-            break;
-        }
-    } while (0);
-    if (paramsCtx != NULL) {
-        OpensslEvpPkeyCtxFree(paramsCtx);
+    if (skLen == 0) {
+        return true;
     }
-    return ret;
+    return (skLen >= group->minPrivLen) && (skLen <= OpensslBnNumBits(group->q));
 }
 
-static HcfResult BuildCommonParam(EVP_PKEY *dhKey, HcfDhCommParamsSpecSpi *returnCommonParamSpec)
+static HcfResult BuildCommonParamFromBn(const BIGNUM *p, const BIGNUM *g,
+    HcfDhCommParamsSpecSpi *returnCommonParamSpec)
 {
-    DH *sk = OpensslEvpPkeyGet1Dh(dhKey);
-    if (sk == NULL) {
-        LOGE("Get dh private key from pkey failed");
-        HcfPrintOpensslError();
-        return HCF_ERR_CRYPTO_OPERATION;
-    }
-    if (BigNumToBigInteger(OpensslDhGet0P(sk), &(returnCommonParamSpec->paramsSpec.p)) != HCF_SUCCESS) {
+    if (BigNumToBigInteger(p, &(returnCommonParamSpec->paramsSpec.p)) != HCF_SUCCESS) {
         LOGE("Failed to build DH common prime parameter.");
-        OpensslDhFree(sk);
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    if (BigNumToBigInteger(OpensslDhGet0G(sk), &(returnCommonParamSpec->paramsSpec.g)) != HCF_SUCCESS) {
+    if (BigNumToBigInteger(g, &(returnCommonParamSpec->paramsSpec.g)) != HCF_SUCCESS) {
         LOGE("Failed to build DH common generator parameter.");
-        OpensslDhFree(sk);
         HcfFree(returnCommonParamSpec->paramsSpec.p.data);
         returnCommonParamSpec->paramsSpec.p.data = NULL;
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    OpensslDhFree(sk);
     return HCF_SUCCESS;
 }
 
+static HcfResult BuildCommonParam(const HcfDhNamedGroup *group, EVP_PKEY *dhKey,
+    HcfDhCommParamsSpecSpi *returnCommonParamSpec)
+{
+    if (group != NULL) {
+        return BuildCommonParamFromBn(group->p, group->g, returnCommonParamSpec);
+    }
+    DH *sk = OpensslEvpPkeyGet1Dh(dhKey);
+    if (sk == NULL) {
+        LOGE("Get dh private key from pkey failed");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = BuildCommonParamFromBn(OpensslDhGet0P(sk), OpensslDhGet0G(sk), returnCommonParamSpec);
+    OpensslDhFree(sk);
+    return ret;
+}
+
 static HcfResult SetAlgName(const char *algName, char **returnAlgName)
 {
     size_t srcAlgNameLen = HcfStrlen(algName);
@@ -152,6 +122,7 @@ HcfResult HcfDhCommonParamSpecCreate(int32_t pLen, int32_t skLen, HcfDhCommParam
         return HCF_INVALID_PARAMS;
     }
     EVP_PKEY *dhKey = NULL;
+    const HcfDhNamedGroup *group = NULL;
     char *nidName = GetNidNameByDhPLen(pLen);
     if (nidName == NULL) {
         if (GenerateDhUnknownGroupEvpKey(pLen, &dhKey) != HCF_SUCCESS) {
@@ -159,8 +130,9 @@ HcfResult HcfDhCommonParamSpecCreate(int32_t pLen, int32_t skLen, HcfDhCommParam
             return HCF_ERR_CRYPTO_OPERATION;
         }
     } else {
-        if (GenerateDhKnownGroupEvpKey(skLen, nidName, &dhKey) != HCF_SUCCESS) {
-            LOGE("Generate dh known group evpKey failed.");
+        group = GetDhNamedGroup(nidName);
+        if ((group == NULL) || !IsDhKnownGroupSkLenValid(group, skLen)) {
+            LOGE("Get dh known group params failed.");
             return HCF_ERR_CRYPTO_OPERATION;
         }
     }
@@ -180,7 +152,7 @@ HcfResult HcfDhCommonParamSpecCreate(int32_t pLen, int32_t skLen, HcfDhCommParam
         OpensslEvpPkeyFree(dhKey);
         return HCF_INVALID_PARAMS;
     }
-    if (BuildCommonParam(dhKey, object)!= HCF_SUCCESS) {
+    if (BuildCommonParam(group, dhKey, object) != HCF_SUCCESS) {
         LOGE("Get common params failed.");
         HcfFree(object->paramsSpec.base.algName);
         object->paramsSpec.base.algName = NULL;
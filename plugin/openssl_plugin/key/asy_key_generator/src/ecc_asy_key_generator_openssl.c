@@ -20,6 +20,7 @@
 
 #include "ecc_openssl_common.h"
 #include "ecc_openssl_common_param_spec.h"
+#include "key_pairs_batch_openssl.h"
 #include "log.h"
 #include "memory.h"
 #include "openssl_adapter.h"
@@ -806,9 +807,12 @@ static void DestroyEccPubKey(HcfObjectBase *self)
     HcfOpensslEccPubKey *impl = (HcfOpensslEccPubKey *)self;
     OpensslEcKeyFree(impl->ecKey);
     impl->ecKey = NULL;
-    HcfFree(impl->fieldType);
+    // A key from generateKeyPairs keeps its field type in the block it was allocated in.
+    if (impl->block == NULL) {
+        HcfFree(impl->fieldType);
+    }
     impl->fieldType = NULL;
-    HcfFree(impl);
+    HcfObjBlockFreeObj(impl->block, impl);
 }
 
 static void DestroyEccPriKey(HcfObjectBase *self)
@@ -822,9 +826,12 @@ static void DestroyEccPriKey(HcfObjectBase *self)
     HcfOpensslEccPriKey *impl = (HcfOpensslEccPriKey *)self;
     OpensslEcKeyFree(impl->ecKey);
     impl->ecKey = NULL;
-    HcfFree(impl->fieldType);
+    // A key from generateKeyPairs keeps its field type in the block it was allocated in.
+    if (impl->block == NULL) {
+        HcfFree(impl->fieldType);
+    }
     impl->fieldType = NULL;
-    HcfFree(impl);
+    HcfObjBlockFreeObj(impl->block, impl);
 }
 
 static void DestroyEccKeyPair(HcfObjectBase *self)
@@ -844,7 +851,7 @@ static void DestroyEccKeyPair(HcfObjectBase *self)
         DestroyEccPriKey((HcfObjectBase *)impl->base.priKey);
         impl->base.priKey = NULL;
     }
-    HcfFree(impl);
+    HcfObjBlockFreeObj(impl->block, impl);
 }
 
 static const char *GetEccPubKeyAlgorithm(HcfKey *self)
@@ -1558,6 +1565,22 @@ static HcfResult GetECPriKeySpecInt(const HcfPriKey *self, const AsyKeySpecItem
     return GetEcKeySpecInt((HcfKey *)self, item, returnInt);
 }
 
+static void FillOpensslEccPubKeyFunc(HcfOpensslEccPubKey *pk)
+{
+    pk->base.base.base.destroy = DestroyEccPubKey;
+    pk->base.base.base.getClass = GetEccPubKeyClass;
+    pk->base.base.getAlgorithm = GetEccPubKeyAlgorithm;
+    pk->base.base.getEncoded = GetEccPubKeyEncoded;
+    pk->base.base.getEncodedPem = GetEccPubKeyEncodedPem;
+    pk->base.base.getFormat = GetEccPubKeyFormat;
+    pk->base.base.getKeySize = GetEccPubKeySize;
+    pk->base.getKeyData = GetEccPubKeyData;
+    pk->base.getAsyKeySpecBigInteger = GetECPubKeySpecBigInteger;
+    pk->base.getAsyKeySpecString = GetECPubKeySpecString;
+    pk->base.getAsyKeySpecInt = GetECPubKeySpecInt;
+    pk->base.getEncodedDer = GetEccPubKeyEncodedDer;
+}
+
 static HcfResult PackEccPubKey(int32_t curveId, EC_KEY *ecKey, const char *fieldType,
     HcfOpensslEccPubKey **returnObj)
 {
@@ -1585,18 +1608,7 @@ static HcfResult PackEccPubKey(int32_t curveId, EC_KEY *ecKey, const char *field
         (void)memcpy_s(tmpFieldType, len, fieldType, len);
     }
 
-    returnPubKey->base.base.base.destroy = DestroyEccPubKey;
-    returnPubKey->base.base.base.getClass = GetEccPubKeyClass;
-    returnPubKey->base.base.getAlgorithm = GetEccPubKeyAlgorithm;
-    returnPubKey->base.base.getEncoded = GetEccPubKeyEncoded;
-    returnPubKey->base.base.getEncodedPem = GetEccPubKeyEncodedPem;
-    returnPubKey->base.base.getFormat = GetEccPubKeyFormat;
-    returnPubKey->base.base.getKeySize = GetEccPubKeySize;
-    returnPubKey->base.getKeyData = GetEccPubKeyData;
-    returnPubKey->base.getAsyKeySpecBigInteger = GetECPubKeySpecBigInteger;
-    returnPubKey->base.getAsyKeySpecString = GetECPubKeySpecString;
-    returnPubKey->base.getAsyKeySpecInt = GetECPubKeySpecInt;
-    returnPubKey->base.getEncodedDer = GetEccPubKeyEncodedDer;
+    FillOpensslEccPubKeyFunc(returnPubKey);
     returnPubKey->curveId = curveId;
     returnPubKey->ecKey = ecKey;
     returnPubKey->fieldType = tmpFieldType;
@@ -1646,6 +1658,24 @@ static HcfResult GetEccPubKeyFromPriKey(const HcfPriKey *self, HcfPubKey **retur
     return HCF_SUCCESS;
 }
 
+static void FillOpensslEccPriKeyFunc(HcfOpensslEccPriKey *sk)
+{
+    sk->base.base.base.destroy = DestroyEccPriKey;
+    sk->base.base.base.getClass = GetEccPriKeyClass;
+    sk->base.base.getAlgorithm = GetEccPriKeyAlgorithm;
+    sk->base.base.getEncoded = GetEccPriKeyEncoded;
+    sk->base.getEncodedPem = GetEccPriKeyEncodedPem;
+    sk->base.base.getFormat = GetEccPriKeyFormat;
+    sk->base.base.getKeySize = GetEccPriKeySize;
+    sk->base.clearMem = EccPriKeyClearMem;
+    sk->base.getKeyData = GetEccPriKeyData;
+    sk->base.getAsyKeySpecBigInteger = GetECPriKeySpecBigInteger;
+    sk->base.getAsyKeySpecString = GetECPriKeySpecString;
+    sk->base.getAsyKeySpecInt = GetECPriKeySpecInt;
+    sk->base.getEncodedDer = GetECPriKeyEncodedDer;
+    sk->base.getPubKey = GetEccPubKeyFromPriKey;
+}
+
 static HcfResult PackEccPriKey(int32_t curveId, EC_KEY *ecKey, const char *fieldType,
     HcfOpensslEccPriKey **returnObj)
 {
@@ -1673,20 +1703,7 @@ static HcfResult PackEccPriKey(int32_t curveId, EC_KEY *ecKey, const char *field
         (void)memcpy_s(tmpFieldType, len, fieldType, len);
     }
 
-    returnPriKey->base.base.base.destroy = DestroyEccPriKey;
-    returnPriKey->base.base.base.getClass = GetEccPriKeyClass;
-    returnPriKey->base.base.getAlgorithm = GetEccPriKeyAlgorithm;
-    returnPriKey->base.base.getEncoded = GetEccPriKeyEncoded;
-    returnPriKey->base.getEncodedPem = GetEccPriKeyEncodedPem;
-    returnPriKey->base.base.getFormat = GetEccPriKeyFormat;
-    returnPriKey->base.base.getKeySize = GetEccPriKeySize;
-    returnPriKey->base.clearMem = EccPriKeyClearMem;
-    returnPriKey->base.getKeyData = GetEccPriKeyData;
-    returnPriKey->base.getAsyKeySpecBigInteger = GetECPriKeySpecBigInteger;
-    returnPriKey->base.getAsyKeySpecString = GetECPriKeySpecString;
-    returnPriKey->base.getAsyKeySpecInt = GetECPriKeySpecInt;
-    returnPriKey->base.getEncodedDer = GetECPriKeyEncodedDer;
-    returnPriKey->base.getPubKey = GetEccPubKeyFromPriKey;
+    FillOpensslEccPriKeyFunc(returnPriKey);
     returnPriKey->curveId = curveId;
     returnPriKey->ecKey = ecKey;
     returnPriKey->fieldType = tmpFieldType;
@@ -1971,6 +1988,108 @@ static HcfResult EngineGenerateKeyPair(HcfAsyKeyGeneratorSpi *self, HcfKeyPair *
     return HCF_SUCCESS;
 }
 
+#define ECC_KEY_PAIR_SLOT_REF_NUM 3
+#define ECC_KEY_PAIR_SLOT_FIELD_TYPE_LEN 4
+
+typedef struct {
+    HcfOpensslEccKeyPair keyPair;
+    HcfOpensslEccPubKey pubKey;
+    HcfOpensslEccPriKey priKey;
+    char pubFieldType[ECC_KEY_PAIR_SLOT_FIELD_TYPE_LEN];
+    char priFieldType[ECC_KEY_PAIR_SLOT_FIELD_TYPE_LEN];
+} EccKeyPairSlot;
+
+static void FillEccKeyPairSlot(const HcfKeyPairsBatch *batch, uint32_t index, EC_KEY *ecPubKey, EC_KEY *ecPriKey)
+{
+    int32_t curveId = *(const int32_t *)batch->param;
+    EccKeyPairSlot *slot = (EccKeyPairSlot *)HcfKeyPairsBatchGetSlot(batch, index);
+    (void)strcpy_s(slot->pubFieldType, ECC_KEY_PAIR_SLOT_FIELD_TYPE_LEN, g_eccGenerateFieldType);
+    (void)strcpy_s(slot->priFieldType, ECC_KEY_PAIR_SLOT_FIELD_TYPE_LEN, g_eccGenerateFieldType);
+    FillOpensslEccPubKeyFunc(&slot->pubKey);
+    slot->pubKey.curveId = curveId;
+    slot->pubKey.ecKey = ecPubKey;
+    slot->pubKey.fieldType = slot->pubFieldType;
+    slot->pubKey.block = batch->block;
+    FillOpensslEccPriKeyFunc(&slot->priKey);
+    slot->priKey.curveId = curveId;
+    slot->priKey.ecKey = ecPriKey;
+    slot->priKey.fieldType = slot->priFieldType;
+    slot->priKey.block = batch->block;
+    slot->keyPair.base.base.getClass = GetEccKeyPairClass;
+    slot->keyPair.base.base.destroy = DestroyEccKeyPair;
+    slot->keyPair.base.pubKey = (HcfPubKey *)&slot->pubKey;
+    slot->keyPair.base.priKey = (HcfPriKey *)&slot->priKey;
+    slot->keyPair.block = batch->block;
+    batch->keyPairs[index] = (HcfKeyPair *)&slot->keyPair;
+}
+
+static HcfResult GenerateEccKeyPairFromTemplate(const EC_KEY *templateKey, EC_KEY **returnPubKey,
+    EC_KEY **returnPriKey)
+{
+    EC_KEY *ecKey = OpensslEcKeyDup(templateKey);
+    if (ecKey == NULL) {
+        LOGE("copy ecKey fail.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (OpensslEcKeyGenerateKey(ecKey) <= 0) {
+        LOGE("generate ec key failed.");
+        OpensslEcKeyFree(ecKey);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    if (OpensslEcKeyCheckKey(ecKey) <= 0) {
+        LOGE("check key fail.");
+        OpensslEcKeyFree(ecKey);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    // Both keys set encoding flags on their EC_KEY, so each gets one of its own as generateKeyPair gives them.
+    EC_KEY *ecPubKey = OpensslEcKeyDup(ecKey);
+    if (ecPubKey == NULL) {
+        LOGE("copy ecKey fail.");
+        OpensslEcKeyFree(ecKey);
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    *returnPubKey = ecPubKey;
+    *returnPriKey = ecKey;
+    return HCF_SUCCESS;
+}
+
+static HcfResult GenerateEccKeyPairsRange(const HcfKeyPairsBatch *batch, uint32_t start, uint32_t end)
+{
+    // Copying a key that already holds the group skips the curve lookup each new EC_KEY would do.
+    EC_KEY *templateKey = OpensslEcKeyNewByCurveName(*(const int32_t *)batch->param);
+    if (templateKey == NULL) {
+        LOGE("new ec key failed.");
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    HcfResult ret = HCF_SUCCESS;
+    for (uint32_t i = start; i < end; i++) {
+        EC_KEY *ecPubKey = NULL;
+        EC_KEY *ecPriKey = NULL;
+        ret = GenerateEccKeyPairFromTemplate(templateKey, &ecPubKey, &ecPriKey);
+        if (ret != HCF_SUCCESS) {
+            break;
+        }
+        FillEccKeyPairSlot(batch, i, ecPubKey, ecPriKey);
+    }
+    OpensslEcKeyFree(templateKey);
+    return ret;
+}
+
+static HcfResult EngineGenerateKeyPairs(HcfAsyKeyGeneratorSpi *self, uint32_t count, uint32_t workerNum,
+    HcfKeyPair **returnKeyPairs)
+{
+    if ((self == NULL) || (returnKeyPairs == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if (!HcfIsClassMatch((HcfObjectBase *)self, GetEccKeyPairGeneratorClass())) {
+        return HCF_INVALID_PARAMS;
+    }
+    HcfAsyKeyGeneratorSpiOpensslEccImpl *impl = (HcfAsyKeyGeneratorSpiOpensslEccImpl *)self;
+    return HcfGenerateKeyPairsOpenssl(GenerateEccKeyPairsRange, &impl->curveId, sizeof(EccKeyPairSlot),
+        ECC_KEY_PAIR_SLOT_REF_NUM, count, workerNum, returnKeyPairs);
+}
+
 static HcfResult EngineGenerateKeyPairBySpec(const HcfAsyKeyGeneratorSpi *self, const HcfAsyKeyParamsSpec *params,
     HcfKeyPair **returnKeyPair)
 {
@@ -2111,6 +2230,7 @@ HcfResult HcfAsyKeyGeneratorSpiEccCreate(HcfAsyKeyGenParams *params, HcfAsyKeyGe
     returnImpl->base.engineConvertKey = EngineConvertEccKey;
     returnImpl->base.engineConvertPemKey = EngineConvertEccPemKey;
     returnImpl->base.engineGenerateKeyPair = EngineGenerateKeyPair;
+    returnImpl->base.engineGenerateKeyPairs = EngineGenerateKeyPairs;
     returnImpl->base.engineGenerateKeyPairBySpec = EngineGenerateKeyPairBySpec;
     returnImpl->base.engineGeneratePubKeyBySpec = EngineGeneratePubKeyBySpec;
     returnImpl->base.engineGeneratePriKeyBySpec = EngineGeneratePriKeyBySpec;
@@ -22,6 +22,8 @@
 #include "memory.h"
 #include "openssl_adapter.h"
 #include "openssl_common.h"
+#include "openssl_key_decoder.h"
+#include "pub_key_cache_openssl.h"
 
 #define BITS_PER_BYTE 8
 #define ECC_COORDINATE_COUNT 2
@@ -339,6 +341,16 @@ HcfResult ConvertEcPubKey(int32_t curveId, HcfBlob *pubKeyBlob, HcfOpensslEccPub
         LOGE("Invalid input parameter.");
         return HCF_ERR_PARAMETER_CHECK_FAILED;
     }
+    PubKeyCacheQuery query;
+    PubKeyCacheInitQuery(PUB_KEY_CACHE_OBJ_EC_KEY, HCF_ALG_ECC, curveId, pubKeyBlob, &query);
+    EC_KEY *cachedKey = (EC_KEY *)PubKeyCacheGet(&query);
+    if (cachedKey != NULL) {
+        HcfResult cachedRes = EccPackPubKeyForConvert(curveId, cachedKey, returnPubKey);
+        if (cachedRes != HCF_SUCCESS) {
+            OpensslEcKeyFree(cachedKey);
+        }
+        return cachedRes;
+    }
     size_t keyBytes = 0;
     HcfResult res = HCF_ERR_CRYPTO_OPERATION;
     if (EccCurveIdGetKeyByteSize(curveId, &keyBytes) == HCF_SUCCESS && keyBytes > 0) {
@@ -347,14 +359,19 @@ HcfResult ConvertEcPubKey(int32_t curveId, HcfBlob *pubKeyBlob, HcfOpensslEccPub
             LOGD("TryConvertEcPubKeyRaw success.");
             return res;
         }
+        PubKeyCachePut(&query, (*returnPubKey)->ecKey);
     }
     return res;
 }
 
 static HcfResult ConvertPriFromEncoded(EC_KEY **eckey, HcfBlob *priKeyBlob)
 {
-    const unsigned char *tmpData = (const unsigned char *)(priKeyBlob->data);
-    EVP_PKEY *pkey = OpensslD2iPrivateKey(EVP_PKEY_EC, NULL, &tmpData, priKeyBlob->len);
+    EVP_PKEY *pkey = NULL;
+    HcfKeyDecoderParams decoderParams = { "DER", NULL, "EC", EVP_PKEY_KEYPAIR };
+    if (DecodeKeyByCachedDecoder(&decoderParams, priKeyBlob->data, priKeyBlob->len, &pkey) != HCF_SUCCESS) {
+        const unsigned char *tmpData = (const unsigned char *)(priKeyBlob->data);
+        pkey = OpensslD2iPrivateKey(EVP_PKEY_EC, NULL, &tmpData, priKeyBlob->len);
+    }
     if (pkey == NULL) {
         HcfPrintOpensslError();
         LOGE("d2i pri key failed.");
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "key_pairs_batch_openssl.h"
+
+#include <securec.h>
+
+#include "hcf_parallel.h"
+#include "log.h"
+#include "object_base.h"
+
+/* Range taskIndex of the batch, the ranges differ in size by at most one entry. */
+static HcfResult GenerateKeyPairsRange(void *arg, uint32_t taskIndex)
+{
+    const HcfKeyPairsBatch *batch = (const HcfKeyPairsBatch *)arg;
+    uint32_t start = (uint32_t)((uint64_t)batch->count * taskIndex / batch->rangeNum);
+    uint32_t end = (uint32_t)((uint64_t)batch->count * (taskIndex + 1) / batch->rangeNum);
+    return batch->func(batch, start, end);
+}
+
+static void ReleaseKeyPairsBatch(HcfKeyPairsBatch *batch)
+{
+    for (uint32_t i = 0; i < batch->count; i++) {
+        if (batch->keyPairs[i] != NULL) {
+            HcfObjDestroy(batch->keyPairs[i]);
+            batch->keyPairs[i] = NULL;
+        } else {
+            HcfObjBlockRelease(batch->block, batch->slotRefNum);
+        }
+    }
+}
+
+HcfResult HcfGenerateKeyPairsOpenssl(HcfKeyPairsBatchRangeFunc func, const void *param, uint32_t slotLen,
+    uint32_t slotRefNum, uint32_t count, uint32_t workerNum, HcfKeyPair **returnKeyPairs)
+{
+    if ((func == NULL) || (slotLen == 0) || (slotRefNum == 0) || (count == 0) || (returnKeyPairs == NULL)) {
+        LOGE("Invalid input parameter.");
+        return HCF_INVALID_PARAMS;
+    }
+    if ((slotLen > UINT32_MAX / count) || (slotRefNum > UINT32_MAX / count)) {
+        LOGE("Batch is too large.");
+        return HCF_INVALID_PARAMS;
+    }
+    HcfKeyPairsBatch batch = {
+        .param = param,
+        .func = func,
+        .slotLen = slotLen,
+        .slotRefNum = slotRefNum,
+        .keyPairs = returnKeyPairs,
+        .count = count,
+    };
+    batch.block = HcfObjBlockCreate(slotLen * count, slotRefNum * count);
+    if (batch.block == NULL) {
+        LOGE("Failed to allocate key pairs block!");
+        return HCF_ERR_MALLOC;
+    }
+    batch.slots = (uint8_t *)HcfObjBlockGetData(batch.block);
+    (void)memset_s(returnKeyPairs, sizeof(HcfKeyPair *) * count, 0, sizeof(HcfKeyPair *) * count);
+    HcfResult ret = HCF_SUCCESS;
+    if (workerNum <= 1) {
+        batch.rangeNum = 1;
+        ret = GenerateKeyPairsRange(&batch, 0);
+    } else {
+        batch.rangeNum = (workerNum < count) ? workerNum : count;
+        ret = HcfParallelRun(batch.rangeNum, batch.rangeNum, GenerateKeyPairsRange, &batch);
+    }
+    if (ret != HCF_SUCCESS) {
+        LOGE("Generate key pairs failed.");
+        ReleaseKeyPairsBatch(&batch);
+    }
+    return ret;
+}
@@ -19,6 +19,8 @@
 #include "openssl_adapter.h"
 #include "openssl_class.h"
 #include "openssl_common.h"
+#include "openssl_key_decoder.h"
+#include "pub_key_cache_openssl.h"
 #include "openssl/pem.h"
 #include "openssl/x509.h"
 
@@ -456,8 +458,18 @@ static HcfResult ConvertPubKeyFromPkcs1(HcfBlob *pkcs1Blob, RSA **rsa)
 
 static HcfResult ConvertPriKeyFromDer(HcfBlob *blob, RSA **rsa)
 {
-    const unsigned char *temp = (const unsigned char *)blob->data;
-    EVP_PKEY *pKey = OpensslD2iAutoPrivateKey(NULL, &temp, blob->len);
+    // PKCS#8 as produced by getEncoded is read directly, other layouts go through the pooled decoder first.
+    RSA *directRsa = DecodeRsaPkcs8PriKeyDirect(blob->data, blob->len);
+    if (directRsa != NULL) {
+        *rsa = directRsa;
+        return HCF_SUCCESS;
+    }
+    EVP_PKEY *pKey = NULL;
+    HcfKeyDecoderParams decoderParams = { "DER", NULL, "RSA", EVP_PKEY_KEYPAIR };
+    if (DecodeKeyByCachedDecoder(&decoderParams, blob->data, blob->len, &pKey) != HCF_SUCCESS) {
+        const unsigned char *temp = (const unsigned char *)blob->data;
+        pKey = OpensslD2iAutoPrivateKey(NULL, &temp, blob->len);
+    }
     if (pKey == NULL) {
         LOGE("d2i_AutoPrivateKey fail.");
         HcfPrintOpensslError();
@@ -1301,13 +1313,18 @@ static void DestroyKeyGeneratorSpiImpl(HcfObjectBase *self)
 
 static HcfResult ConvertPubKey(HcfBlob *pubKeyBlob, HcfOpensslRsaPubKey **pubkeyRet)
 {
-    RSA *rsaPk = NULL;
-    // Try parse as X509 first, then fall back to PKCS1.
-    if (ConvertPubKeyFromX509(pubKeyBlob, &rsaPk) != HCF_SUCCESS) {
-        if (ConvertPubKeyFromPkcs1(pubKeyBlob, &rsaPk) != HCF_SUCCESS) {
-            LOGE("Convert pubKey from X509 or PKCS1 der fail.");
-            return HCF_ERR_CRYPTO_OPERATION;
+    PubKeyCacheQuery query;
+    PubKeyCacheInitQuery(PUB_KEY_CACHE_OBJ_RSA, HCF_ALG_RSA, 0, pubKeyBlob, &query);
+    RSA *rsaPk = (RSA *)PubKeyCacheGet(&query);
+    if (rsaPk == NULL) {
+        // Try parse as X509 first, then fall back to PKCS1.
+        if (ConvertPubKeyFromX509(pubKeyBlob, &rsaPk) != HCF_SUCCESS) {
+            if (ConvertPubKeyFromPkcs1(pubKeyBlob, &rsaPk) != HCF_SUCCESS) {
+                LOGE("Convert pubKey from X509 or PKCS1 der fail.");
+                return HCF_ERR_CRYPTO_OPERATION;
+            }
         }
+        PubKeyCachePut(&query, rsaPk);
     }
     HcfOpensslRsaPubKey *pubKey = NULL;
     HcfResult ret = PackPubKey(rsaPk, &pubKey);
@@ -1322,9 +1339,27 @@ ERR:
     return ret;
 }
 
+static HcfResult GetRsaFromDecodedKey(EVP_PKEY *pkey, RSA **rsa)
+{
+    *rsa = OpensslEvpPkeyGet1Rsa(pkey);
+    OpensslEvpPkeyFree(pkey);
+    if (*rsa == NULL) {
+        LOGE("Failed to extract RSA key from EVP_PKEY.");
+        HcfPrintOpensslError();
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return HCF_SUCCESS;
+}
+
 static HcfResult ConvertPemKeyToKey(const char *keyStr, HcfParamsSpec *params, int selection, RSA **rsa)
 {
     EVP_PKEY *pkey = NULL;
+    // Only keys without a password can use the pooled decoders, the passphrase would stay on a shared context.
+    HcfKeyDecoderParams decoderParams = { "PEM", NULL, "RSA", selection };
+    if ((params == NULL) && (DecodeKeyByCachedDecoder(&decoderParams, (const unsigned char *)keyStr, strlen(keyStr),
+        &pkey) == HCF_SUCCESS)) {
+        return GetRsaFromDecodedKey(pkey, rsa);
+    }
     OSSL_DECODER_CTX *ctx = OpensslOsslDecoderCtxNewForPkey(&pkey, "PEM", NULL, "RSA", selection, NULL, NULL);
     if (ctx == NULL) {
         LOGE("Failed to create OpenSSL decoder context for key.");
@@ -1352,14 +1387,7 @@ static HcfResult ConvertPemKeyToKey(const char *keyStr, HcfParamsSpec *params, i
         OpensslEvpPkeyFree(pkey);
         return HCF_ERR_CRYPTO_OPERATION;
     }
-    *rsa = OpensslEvpPkeyGet1Rsa(pkey);
-    OpensslEvpPkeyFree(pkey);
-    if (*rsa == NULL) {
-        LOGE("Failed to extract RSA key from EVP_PKEY.");
-        HcfPrintOpensslError();
-        return HCF_ERR_CRYPTO_OPERATION;
-    }
-    return HCF_SUCCESS;
+    return GetRsaFromDecodedKey(pkey, rsa);
 }
 
 static HcfResult ConvertPemPubKey(const char *pubKeyStr, int selection, HcfOpensslRsaPubKey **pubKeyRet)
@@ -20,6 +20,7 @@
 #include "log.h"
 #include "memory.h"
 #include "openssl_adapter.h"
+#include "pub_key_cache_openssl.h"
 #include "utils.h"
 
 #define OPENSSL_SM2_256_BITS 256
@@ -981,12 +982,18 @@ static HcfResult PackSm2KeyPair(HcfOpensslSm2PubKey *pubKey, HcfOpensslSm2PriKey
 
 static HcfResult ConvertEcPubKey(int32_t curveId, HcfBlob *pubKeyBlob, HcfOpensslSm2PubKey **returnPubKey)
 {
-    const unsigned char *tmpData = (const unsigned char *)(pubKeyBlob->data);
-    EC_KEY *ecKey = OpensslD2iEcPubKey(NULL, &tmpData, pubKeyBlob->len);
+    PubKeyCacheQuery query;
+    PubKeyCacheInitQuery(PUB_KEY_CACHE_OBJ_EC_KEY, HCF_ALG_SM2, curveId, pubKeyBlob, &query);
+    EC_KEY *ecKey = (EC_KEY *)PubKeyCacheGet(&query);
     if (ecKey == NULL) {
-        LOGE("Call d2i_EC_PUBKEY fail.");
-        HcfPrintOpensslError();
-        return HCF_ERR_CRYPTO_OPERATION;
+        const unsigned char *tmpData = (const unsigned char *)(pubKeyBlob->data);
+        ecKey = OpensslD2iEcPubKey(NULL, &tmpData, pubKeyBlob->len);
+        if (ecKey == NULL) {
+            LOGE("Call d2i_EC_PUBKEY fail.");
+            HcfPrintOpensslError();
+            return HCF_ERR_CRYPTO_OPERATION;
+        }
+        PubKeyCachePut(&query, ecKey);
     }
     HcfResult ret = PackSm2PubKey(curveId, ecKey, g_sm2GenerateFieldType, returnPubKey);
     if (ret != HCF_SUCCESS) {
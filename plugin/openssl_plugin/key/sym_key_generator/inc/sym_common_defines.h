@@ -25,10 +25,20 @@ typedef struct {
     int keySize;
 } SymKeyAttr;
 
+#define SYM_KEY_NONCE_FIXED_FIELD_LEN 4
+
+/* Nonces generated for the key by AEAD ciphers, see HcfAeadNonceMode. Only touched by the cipher plugin. */
+typedef struct {
+    uint64_t invocationNum;
+    int32_t mode;
+    uint8_t fixedField[SYM_KEY_NONCE_FIXED_FIELD_LEN];
+} SymKeyNonceState;
+
 typedef struct {
     HcfSymKey key;
     char *algoName;
     HcfBlob keyMaterial;
+    SymKeyNonceState nonceState;
 } SymKeyImpl;
 
 #ifdef __cplusplus
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Small message update throughput, where the per call cost of the OpenSSL adapter is visible. Build the plugin
+ * with crypto_framework_openssl_adapter_inline = false and true and compare the framework rows. The OpenSSL rows
+ * are the floor that neither build can go below.
+ */
+
+#include <benchmark/benchmark.h>
+#include <openssl/evp.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_hmac_params.h"
+#include "detailed_iv_params.h"
+#include "mac.h"
+#include "md.h"
+#include "object_base.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t BENCHMARK_AES_KEY_LEN = 16;
+constexpr uint32_t BENCHMARK_AES_IV_LEN = 16;
+constexpr uint32_t BENCHMARK_OUT_EXTRA_LEN = 32;
+constexpr uint8_t BENCHMARK_FILL_BYTE = 0x5a;
+const uint8_t g_benchmarkKey[BENCHMARK_AES_KEY_LEN] = { 0 };
+uint8_t g_benchmarkIv[BENCHMARK_AES_IV_LEN] = { 0 };
+
+HcfSymKey *ConvertAesKey(void)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate("AES128", &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfBlob keyBlob = { .data = const_cast<uint8_t *>(g_benchmarkKey), .len = BENCHMARK_AES_KEY_LEN };
+    if (generator->convertSymKey(generator, &keyBlob, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+/* range(0) is the size of each update. */
+void BenchmarkMdUpdate(benchmark::State &state, const char *mdName)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    HcfMd *md = nullptr;
+    if (HcfMdCreate(mdName, &md) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create md.");
+        return;
+    }
+    vector<uint8_t> data(dataLen, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = data.data(), .len = dataLen };
+    for (auto _ : state) {
+        if (md->update(md, &input) != HCF_SUCCESS) {
+            state.SkipWithError("Md update failed.");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    HcfObjDestroy(md);
+}
+
+void BenchmarkOpensslDigestUpdate(benchmark::State &state, const char *mdName)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    EVP_MD *evpMd = EVP_MD_fetch(nullptr, mdName, nullptr);
+    EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+    if ((evpMd == nullptr) || (ctx == nullptr) || (EVP_DigestInit_ex(ctx, evpMd, nullptr) != 1)) {
+        state.SkipWithError("Digest is not available in this OpenSSL.");
+        EVP_MD_CTX_free(ctx);
+        EVP_MD_free(evpMd);
+        return;
+    }
+    vector<uint8_t> data(dataLen, BENCHMARK_FILL_BYTE);
+    for (auto _ : state) {
+        if (EVP_DigestUpdate(ctx, data.data(), dataLen) != 1) {
+            state.SkipWithError("Digest update failed.");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    EVP_MD_CTX_free(ctx);
+    EVP_MD_free(evpMd);
+}
+
+void BenchmarkHmacUpdate(benchmark::State &state, const char *mdName)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    HcfHmacParamsSpec params = {};
+    params.base.algName = "HMAC";
+    params.mdName = mdName;
+    HcfSymKey *key = ConvertAesKey();
+    HcfMac *mac = nullptr;
+    if ((key == nullptr) || (HcfMacCreate(reinterpret_cast<HcfMacParamsSpec *>(&params), &mac) != HCF_SUCCESS) ||
+        (mac->init(mac, key) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to create mac.");
+        HcfObjDestroy(mac);
+        HcfObjDestroy(key);
+        return;
+    }
+    vector<uint8_t> data(dataLen, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = data.data(), .len = dataLen };
+    for (auto _ : state) {
+        if (mac->update(mac, &input) != HCF_SUCCESS) {
+            state.SkipWithError("Mac update failed.");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    HcfObjDestroy(mac);
+    HcfObjDestroy(key);
+}
+
+void BenchmarkCipherUpdate(benchmark::State &state, const char *cipherAlg)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    HcfSymKey *key = ConvertAesKey();
+    HcfCipher *cipher = nullptr;
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = g_benchmarkIv;
+    ivSpec.iv.len = BENCHMARK_AES_IV_LEN;
+    if ((key == nullptr) || (HcfCipherCreate(cipherAlg, &cipher) != HCF_SUCCESS) ||
+        (cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+        reinterpret_cast<HcfParamsSpec *>(&ivSpec)) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to create cipher.");
+        HcfObjDestroy(cipher);
+        HcfObjDestroy(key);
+        return;
+    }
+    vector<uint8_t> plain(dataLen, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = dataLen };
+    for (auto _ : state) {
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if (cipher->update(cipher, &input, &output) != HCF_SUCCESS) {
+            state.SkipWithError("Cipher update failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data);
+        HcfBlobDataFree(&output);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+void BenchmarkOpensslCipherUpdate(benchmark::State &state, const char *cipherName)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    EVP_CIPHER *evpCipher = EVP_CIPHER_fetch(nullptr, cipherName, nullptr);
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    if ((evpCipher == nullptr) || (ctx == nullptr) ||
+        (EVP_EncryptInit_ex(ctx, evpCipher, nullptr, g_benchmarkKey, g_benchmarkIv) != 1)) {
+        state.SkipWithError("Cipher is not available in this OpenSSL.");
+        EVP_CIPHER_CTX_free(ctx);
+        EVP_CIPHER_free(evpCipher);
+        return;
+    }
+    vector<uint8_t> plain(dataLen, BENCHMARK_FILL_BYTE);
+    vector<uint8_t> out(dataLen + BENCHMARK_OUT_EXTRA_LEN);
+    for (auto _ : state) {
+        int len = 0;
+        if (EVP_EncryptUpdate(ctx, out.data(), &len, plain.data(), dataLen) != 1) {
+            state.SkipWithError("Cipher update failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    EVP_CIPHER_CTX_free(ctx);
+    EVP_CIPHER_free(evpCipher);
+}
+
+void UpdateSizeArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgName("bytes")->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kNanosecond);
+}
+}
+
+BENCHMARK_CAPTURE(BenchmarkMdUpdate, SHA256, "SHA256")->Apply(UpdateSizeArgs);
+BENCHMARK_CAPTURE(BenchmarkOpensslDigestUpdate, SHA256, "SHA256")->Apply(UpdateSizeArgs);
+BENCHMARK_CAPTURE(BenchmarkMdUpdate, SM3, "SM3")->Apply(UpdateSizeArgs);
+BENCHMARK_CAPTURE(BenchmarkOpensslDigestUpdate, SM3, "SM3")->Apply(UpdateSizeArgs);
+BENCHMARK_CAPTURE(BenchmarkHmacUpdate, SHA256, "SHA256")->Apply(UpdateSizeArgs);
+BENCHMARK_CAPTURE(BenchmarkCipherUpdate, AES128_CTR, "AES128|CTR|NoPadding")->Apply(UpdateSizeArgs);
+BENCHMARK_CAPTURE(BenchmarkOpensslCipherUpdate, AES128_CTR, "AES-128-CTR")->Apply(UpdateSizeArgs);
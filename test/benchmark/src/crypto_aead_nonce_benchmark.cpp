@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Small record encryption, with the nonce drawn by the caller through HcfRand and passed in the params, against the
+ * nonce generated by the cipher. Both produce nonce || ciphertext || tag records of the same size.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_aead_params.h"
+#include "object_base.h"
+#include "rand.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr uint8_t BENCHMARK_FILL_BYTE = 0x5a;
+
+const char *GetAeadParamsSpecType(void)
+{
+    return "AeadParamsSpec";
+}
+
+struct AeadBenchmarkEnv {
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = nullptr;
+    HcfRand *rand = nullptr;
+};
+
+void ReleaseAeadBenchmarkEnv(AeadBenchmarkEnv &env)
+{
+    HcfObjDestroy(env.rand);
+    HcfObjDestroy(env.cipher);
+    HcfObjDestroy(env.key);
+    env = AeadBenchmarkEnv();
+}
+
+bool PrepareAeadBenchmarkEnv(const char *keyName, const char *cipherName, HcfAeadNonceMode mode,
+    AeadBenchmarkEnv &env)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    if (HcfSymKeyGeneratorCreate(keyName, &generator) != HCF_SUCCESS) {
+        return false;
+    }
+    HcfResult ret = generator->generateSymKey(generator, &env.key);
+    HcfObjDestroy(generator);
+    if ((ret != HCF_SUCCESS) || (HcfCipherCreate(cipherName, &env.cipher) != HCF_SUCCESS) ||
+        (env.cipher->setCipherSpecInt(env.cipher, CIPHER_AEAD_NONCE_MODE_INT, mode) != HCF_SUCCESS) ||
+        (HcfRandCreate(&env.rand) != HCF_SUCCESS)) {
+        ReleaseAeadBenchmarkEnv(env);
+        return false;
+    }
+    return true;
+}
+
+/* range(0) is the record size. */
+void BenchmarkAeadExternalNonce(benchmark::State &state, const char *keyName, const char *cipherName)
+{
+    AeadBenchmarkEnv env;
+    if (!PrepareAeadBenchmarkEnv(keyName, cipherName, HCF_AEAD_NONCE_EXTERNAL, env)) {
+        state.SkipWithError("Failed to prepare cipher.");
+        return;
+    }
+    vector<uint8_t> plain(state.range(0), BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = plain.size() };
+    for (auto _ : state) {
+        HcfBlob nonce = { .data = nullptr, .len = 0 };
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if (env.rand->generateRandom(env.rand, HCF_AEAD_NONCE_LEN, &nonce) != HCF_SUCCESS) {
+            state.SkipWithError("Failed to generate nonce.");
+            break;
+        }
+        HcfAeadParamsSpec spec = {};
+        spec.base.getType = GetAeadParamsSpecType;
+        spec.nonce = nonce;
+        if ((env.cipher->init(env.cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(env.key),
+            reinterpret_cast<HcfParamsSpec *>(&spec)) != HCF_SUCCESS) ||
+            (env.cipher->doFinal(env.cipher, &input, &output) != HCF_SUCCESS)) {
+            HcfBlobDataFree(&nonce);
+            state.SkipWithError("Failed to encrypt.");
+            break;
+        }
+        // The caller has to keep the nonce with the ciphertext.
+        vector<uint8_t> record(nonce.data, nonce.data + nonce.len);
+        record.insert(record.end(), output.data, output.data + output.len);
+        benchmark::DoNotOptimize(record.data());
+        HcfBlobDataFree(&nonce);
+        HcfBlobDataFree(&output);
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseAeadBenchmarkEnv(env);
+}
+
+void BenchmarkAeadGeneratedNonce(benchmark::State &state, const char *keyName, const char *cipherName,
+    HcfAeadNonceMode mode)
+{
+    AeadBenchmarkEnv env;
+    if (!PrepareAeadBenchmarkEnv(keyName, cipherName, mode, env)) {
+        state.SkipWithError("Failed to prepare cipher.");
+        return;
+    }
+    vector<uint8_t> plain(state.range(0), BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = plain.size() };
+    for (auto _ : state) {
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if ((env.cipher->init(env.cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(env.key), nullptr) !=
+            HCF_SUCCESS) || (env.cipher->doFinal(env.cipher, &input, &output) != HCF_SUCCESS)) {
+            state.SkipWithError("Failed to encrypt.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data);
+        HcfBlobDataFree(&output);
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseAeadBenchmarkEnv(env);
+}
+
+void RecordSizeArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgName("bytes")->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kNanosecond);
+}
+}
+
+#define AEAD_NONCE_BENCHMARKS(name, keyName, cipherName)                                                         \
+    BENCHMARK_CAPTURE(BenchmarkAeadExternalNonce, name, keyName, cipherName)->Apply(RecordSizeArgs);            \
+    BENCHMARK_CAPTURE(BenchmarkAeadGeneratedNonce, name##_Counter, keyName, cipherName, HCF_AEAD_NONCE_COUNTER) \
+        ->Apply(RecordSizeArgs);                                                                               \
+    BENCHMARK_CAPTURE(BenchmarkAeadGeneratedNonce, name##_Random, keyName, cipherName, HCF_AEAD_NONCE_RANDOM)   \
+        ->Apply(RecordSizeArgs)
+
+AEAD_NONCE_BENCHMARKS(Aes128Gcm, "AES128", "AES128|GCM|NoPadding");
+AEAD_NONCE_BENCHMARKS(ChaCha20Poly1305, "ChaCha20", "ChaCha20|Poly1305");
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Many submitter threads hashing large buffers, each on its own digest contexts. The sync variant blocks every
+ * submitter for its own work, the async variant hands a window of tasks to the shared pool and waits for them, so
+ * the time per iteration is the latency of a window and items per second the throughput of the pool.
+ */
+
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "crypto_async.h"
+#include "crypto_common.h"
+#include "crypto_digest.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t ASYNC_WINDOW = 8;
+constexpr uint32_t ASYNC_MESSAGE_LEN = 64 * 1024;
+constexpr uint8_t ASYNC_FILL_BYTE = 0x5a;
+
+struct AsyncWindow {
+    mutex lock;
+    condition_variable cond;
+    uint32_t doneNum = 0;
+    uint32_t failedNum = 0;
+};
+
+void AsyncWindowDone(uint64_t taskId, OH_Crypto_ErrCode result, void *userData)
+{
+    (void)taskId;
+    AsyncWindow *window = static_cast<AsyncWindow *>(userData);
+    lock_guard<mutex> guard(window->lock);
+    window->doneNum++;
+    if (result != CRYPTO_SUCCESS) {
+        window->failedNum++;
+    }
+    window->cond.notify_one();
+}
+
+bool CreateDigests(vector<OH_CryptoDigest *> &mds)
+{
+    for (auto &md : mds) {
+        if (OH_CryptoDigest_Create("SHA256", &md) != CRYPTO_SUCCESS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DestroyDigests(vector<OH_CryptoDigest *> &mds)
+{
+    for (auto &md : mds) {
+        OH_DigestCrypto_Destroy(md);
+        md = nullptr;
+    }
+}
+
+void BenchmarkSyncDigest(benchmark::State &state)
+{
+    vector<OH_CryptoDigest *> mds(ASYNC_WINDOW, nullptr);
+    if (!CreateDigests(mds)) {
+        DestroyDigests(mds);
+        state.SkipWithError("Failed to create digest.");
+        return;
+    }
+    vector<uint8_t> message(ASYNC_MESSAGE_LEN, ASYNC_FILL_BYTE);
+    Crypto_DataBlob in = { .data = message.data(), .len = message.size() };
+    for (auto _ : state) {
+        for (auto md : mds) {
+            Crypto_DataBlob out = { 0 };
+            if ((OH_CryptoDigest_Update(md, &in) != CRYPTO_SUCCESS) ||
+                (OH_CryptoDigest_Final(md, &out) != CRYPTO_SUCCESS)) {
+                state.SkipWithError("digest failed.");
+                break;
+            }
+            OH_Crypto_FreeDataBlob(&out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ASYNC_WINDOW);
+    DestroyDigests(mds);
+}
+
+bool RunAsyncWindow(vector<OH_CryptoDigest *> &mds, Crypto_DataBlob *in, vector<Crypto_DataBlob> &outs)
+{
+    AsyncWindow window;
+    for (uint32_t i = 0; i < mds.size(); i++) {
+        OH_Crypto_ErrCode ret = CRYPTO_INVALID_CALL;
+        while (ret == CRYPTO_INVALID_CALL) {
+            ret = OH_CryptoAsync_DigestFinal(mds[i], in, &outs[i], AsyncWindowDone, &window, nullptr);
+            if (ret == CRYPTO_INVALID_CALL) {
+                this_thread::yield();
+            }
+        }
+        if (ret != CRYPTO_SUCCESS) {
+            window.failedNum++;
+            window.doneNum++;
+        }
+    }
+    unique_lock<mutex> guard(window.lock);
+    window.cond.wait(guard, [&window, &mds] { return window.doneNum == mds.size(); });
+    for (auto &out : outs) {
+        OH_Crypto_FreeDataBlob(&out);
+    }
+    return window.failedNum == 0;
+}
+
+/* All benchmark threads share the default pool, a full queue makes a submitter retry. */
+void BenchmarkAsyncDigest(benchmark::State &state)
+{
+    vector<OH_CryptoDigest *> mds(ASYNC_WINDOW, nullptr);
+    vector<Crypto_DataBlob> outs(ASYNC_WINDOW, Crypto_DataBlob { 0 });
+    if (!CreateDigests(mds)) {
+        DestroyDigests(mds);
+        state.SkipWithError("Failed to create digest.");
+        return;
+    }
+    vector<uint8_t> message(ASYNC_MESSAGE_LEN, ASYNC_FILL_BYTE);
+    Crypto_DataBlob in = { .data = message.data(), .len = message.size() };
+    for (auto _ : state) {
+        if (!RunAsyncWindow(mds, &in, outs)) {
+            state.SkipWithError("async digest failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ASYNC_WINDOW);
+    DestroyDigests(mds);
+}
+}
+
+BENCHMARK(BenchmarkSyncDigest)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkAsyncDigest)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_iv_params.h"
+#include "object_base.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr int64_t BENCHMARK_MIB = 1024 * 1024;
+constexpr uint32_t BENCHMARK_IV_LEN = 16;
+constexpr uint8_t BENCHMARK_FILL_BYTE = 0x5a;
+
+HcfSymKey *GenerateKey(const char *keyAlg)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate(keyAlg, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    if (generator->generateSymKey(generator, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+/* range(0) is the input size in MiB, range(1) the worker count, 1 being the serial path. */
+void BenchmarkParallelCipher(benchmark::State &state, const char *keyAlg, const char *cipherAlg)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0) * BENCHMARK_MIB);
+    int32_t workerNum = static_cast<int32_t>(state.range(1));
+    HcfSymKey *key = GenerateKey(keyAlg);
+    HcfCipher *cipher = nullptr;
+    if ((key == nullptr) || (HcfCipherCreate(cipherAlg, &cipher) != HCF_SUCCESS) ||
+        (cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, workerNum) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to create cipher.");
+        HcfObjDestroy(cipher);
+        HcfObjDestroy(key);
+        return;
+    }
+    uint8_t iv[BENCHMARK_IV_LEN] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = BENCHMARK_IV_LEN;
+    vector<uint8_t> plain(dataLen, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = dataLen };
+    for (auto _ : state) {
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if ((cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+            reinterpret_cast<HcfParamsSpec *>(&ivSpec)) != HCF_SUCCESS) ||
+            (cipher->doFinal(cipher, &input, &output) != HCF_SUCCESS)) {
+            state.SkipWithError("Cipher operation failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data);
+        HcfBlobDataFree(&output);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+void ParallelCipherArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgNames({ "MiB", "workers" })
+        ->ArgsProduct({ { 64, 256, 1024 }, { 1, 2, 4, 8, 16 } })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+}
+}
+
+BENCHMARK_CAPTURE(BenchmarkParallelCipher, AES256_CTR, "AES256", "AES256|CTR|NoPadding")->Apply(ParallelCipherArgs);
+BENCHMARK_CAPTURE(BenchmarkParallelCipher, ChaCha20, "ChaCha20", "ChaCha20")->Apply(ParallelCipherArgs);
+
+BENCHMARK_MAIN();
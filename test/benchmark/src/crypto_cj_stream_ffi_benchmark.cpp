@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "crypto_handle_table.h"
+#include "crypto_stream_ffi.h"
+#include "detailed_iv_params.h"
+#include "md.h"
+#include "object_base.h"
+#include "securec.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace OHOS::CryptoFramework;
+
+namespace {
+constexpr uint32_t STREAM_CHUNKS = 256;
+constexpr uint8_t STREAM_FILL_BYTE = 0x5a;
+constexpr uint32_t AES_IV_LEN = 16;
+constexpr int64_t REGISTRY_ID = 1;
+
+/* Models the id map behind the generic FFI registry, a locked hash map handing out strong references. */
+template <typename T>
+class LockedRegistry {
+public:
+    explicit LockedRegistry(T *obj)
+    {
+        map_[REGISTRY_ID] = shared_ptr<T>(obj, [](T *) {});
+    }
+
+    shared_ptr<T> Get(int64_t id)
+    {
+        lock_guard<mutex> lock(mutex_);
+        auto it = map_.find(id);
+        return (it == map_.end()) ? nullptr : it->second;
+    }
+
+private:
+    mutex mutex_;
+    unordered_map<int64_t, shared_ptr<T>> map_;
+};
+
+HcfCipher *CreateCtrCipher(HcfSymKey **key)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfCipher *cipher = nullptr;
+    uint8_t iv[AES_IV_LEN] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = sizeof(iv);
+    if ((HcfSymKeyGeneratorCreate("AES128", &generator) != HCF_SUCCESS) ||
+        (generator->generateSymKey(generator, key) != HCF_SUCCESS) ||
+        (HcfCipherCreate("AES128|CTR|NoPadding", &cipher) != HCF_SUCCESS) ||
+        (cipher->init(cipher, ENCRYPT_MODE, &(*key)->key, &ivSpec.base) != HCF_SUCCESS)) {
+        HcfObjDestroy(cipher);
+        cipher = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return cipher;
+}
+
+/* range(0) is the chunk length, each iteration streams STREAM_CHUNKS chunks. */
+void BenchmarkMdRegistry(benchmark::State &state)
+{
+    HcfMd *md = nullptr;
+    if (HcfMdCreate("SHA256", &md) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create md.");
+        return;
+    }
+    LockedRegistry<HcfMd> registry(md);
+    vector<uint8_t> chunk(state.range(0), STREAM_FILL_BYTE);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < STREAM_CHUNKS; i++) {
+            auto instance = registry.Get(REGISTRY_ID);
+            HcfBlob input = { .data = chunk.data(), .len = chunk.size() };
+            benchmark::DoNotOptimize(instance->update(instance.get(), &input));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * STREAM_CHUNKS * chunk.size());
+    HcfObjDestroy(md);
+}
+
+void BenchmarkMdHandle(benchmark::State &state)
+{
+    HcfMd *md = nullptr;
+    if (HcfMdCreate("SHA256", &md) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create md.");
+        return;
+    }
+    uint64_t handle = CryptoHandleTable::GetInstance().Register(CRYPTO_HANDLE_MD, md);
+    vector<uint8_t> chunk(state.range(0), STREAM_FILL_BYTE);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < STREAM_CHUNKS; i++) {
+            benchmark::DoNotOptimize(FfiOHOSMdUpdateByHandle(handle, chunk.data(), chunk.size()));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * STREAM_CHUNKS * chunk.size());
+    CryptoHandleTable::GetInstance().Unregister(handle);
+    HcfObjDestroy(md);
+}
+
+/* The output blob is handed over and copied once more into the array of the caller, as the blob based FFI does. */
+void BenchmarkCipherRegistry(benchmark::State &state)
+{
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = CreateCtrCipher(&key);
+    if (cipher == nullptr) {
+        HcfObjDestroy(key);
+        state.SkipWithError("Failed to create cipher.");
+        return;
+    }
+    LockedRegistry<HcfCipher> registry(cipher);
+    vector<uint8_t> chunk(state.range(0), STREAM_FILL_BYTE);
+    vector<uint8_t> out(chunk.size() + CRYPTO_STREAM_CIPHER_OUTPUT_SLACK);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < STREAM_CHUNKS; i++) {
+            auto instance = registry.Get(REGISTRY_ID);
+            HcfBlob input = { .data = chunk.data(), .len = chunk.size() };
+            HcfBlob output = { .data = nullptr, .len = 0 };
+            if (instance->update(instance.get(), &input, &output) != HCF_SUCCESS) {
+                state.SkipWithError("update failed.");
+                break;
+            }
+            (void)memcpy_s(out.data(), out.size(), output.data, output.len);
+            HcfBlobDataClearAndFree(&output);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * STREAM_CHUNKS * chunk.size());
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+void BenchmarkCipherHandle(benchmark::State &state)
+{
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = CreateCtrCipher(&key);
+    if (cipher == nullptr) {
+        HcfObjDestroy(key);
+        state.SkipWithError("Failed to create cipher.");
+        return;
+    }
+    uint64_t handle = CryptoHandleTable::GetInstance().Register(CRYPTO_HANDLE_CIPHER, cipher);
+    vector<uint8_t> chunk(state.range(0), STREAM_FILL_BYTE);
+    vector<uint8_t> out(chunk.size() + CRYPTO_STREAM_CIPHER_OUTPUT_SLACK);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < STREAM_CHUNKS; i++) {
+            uint64_t outLen = 0;
+            if (FfiOHOSCipherUpdateInto(handle, chunk.data(), chunk.size(), out.data(), out.size(), &outLen) !=
+                HCF_SUCCESS) {
+                state.SkipWithError("update failed.");
+                break;
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * STREAM_CHUNKS * chunk.size());
+    CryptoHandleTable::GetInstance().Unregister(handle);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+void StreamArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Unit(benchmark::kMicrosecond)->Arg(16)->Arg(64)->Arg(256)->Arg(1024);
+}
+}
+
+BENCHMARK(BenchmarkMdRegistry)->Apply(StreamArgs);
+BENCHMARK(BenchmarkMdHandle)->Apply(StreamArgs);
+BENCHMARK(BenchmarkCipherRegistry)->Apply(StreamArgs);
+BENCHMARK(BenchmarkCipherHandle)->Apply(StreamArgs);
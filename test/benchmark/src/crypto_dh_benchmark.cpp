@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "key_agreement.h"
+#include "object_base.h"
+
+using namespace std;
+
+namespace {
+struct DhAgreementKeys {
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *keyPair1 = nullptr;
+    HcfKeyPair *keyPair2 = nullptr;
+};
+
+void ReleaseDhAgreementKeys(DhAgreementKeys &keys)
+{
+    HcfObjDestroy(keys.keyPair1);
+    HcfObjDestroy(keys.keyPair2);
+    HcfObjDestroy(keys.generator);
+    keys = DhAgreementKeys();
+}
+
+bool PrepareDhAgreementKeys(const char *algName, DhAgreementKeys &keys)
+{
+    if ((HcfAsyKeyGeneratorCreate(algName, &keys.generator) != HCF_SUCCESS) ||
+        (keys.generator->generateKeyPair(keys.generator, nullptr, &keys.keyPair1) != HCF_SUCCESS) ||
+        (keys.generator->generateKeyPair(keys.generator, nullptr, &keys.keyPair2) != HCF_SUCCESS)) {
+        ReleaseDhAgreementKeys(keys);
+        return false;
+    }
+    return true;
+}
+
+/* The per call sequence generateKeyPair used before: group parameters, key generation and EVP_PKEY_check. */
+EVP_PKEY *GenerateOpensslDhKey(const char *nidName)
+{
+    EVP_PKEY_CTX *paramsCtx = EVP_PKEY_CTX_new_from_name(nullptr, "DH", nullptr);
+    EVP_PKEY *paramsPkey = nullptr;
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, const_cast<char *>(nidName), 0),
+        OSSL_PARAM_construct_end()
+    };
+    if ((paramsCtx == nullptr) || (EVP_PKEY_keygen_init(paramsCtx) != 1) ||
+        (EVP_PKEY_CTX_set_params(paramsCtx, params) != 1) || (EVP_PKEY_generate(paramsCtx, &paramsPkey) != 1)) {
+        EVP_PKEY_CTX_free(paramsCtx);
+        return nullptr;
+    }
+    EVP_PKEY_CTX *keyCtx = EVP_PKEY_CTX_new(paramsPkey, nullptr);
+    EVP_PKEY *pkey = nullptr;
+    if ((keyCtx == nullptr) || (EVP_PKEY_keygen_init(keyCtx) != 1) || (EVP_PKEY_keygen(keyCtx, &pkey) != 1) ||
+        (EVP_PKEY_check(keyCtx) != 1)) {
+        EVP_PKEY_free(pkey);
+        pkey = nullptr;
+    }
+    EVP_PKEY_CTX_free(keyCtx);
+    EVP_PKEY_free(paramsPkey);
+    EVP_PKEY_CTX_free(paramsCtx);
+    return pkey;
+}
+
+/* A derive with full validation of the peer, as generateSecret did before for every group. */
+bool DeriveOpensslDhSecret(EVP_PKEY *priKey, EVP_PKEY *pubKey, vector<uint8_t> &secret)
+{
+    EVP_PKEY_CTX *ctx = EVP_PKEY_CTX_new(priKey, nullptr);
+    size_t len = 0;
+    bool ok = (ctx != nullptr) && (EVP_PKEY_derive_init(ctx) == 1) && (EVP_PKEY_derive_set_peer(ctx, pubKey) == 1) &&
+        (EVP_PKEY_derive(ctx, nullptr, &len) == 1);
+    if (ok) {
+        secret.resize(len);
+        ok = (EVP_PKEY_derive(ctx, secret.data(), &len) == 1);
+    }
+    EVP_PKEY_CTX_free(ctx);
+    return ok;
+}
+
+void BenchmarkDhGenerateKeyPair(benchmark::State &state, const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create generator.");
+        return;
+    }
+    for (auto _ : state) {
+        HcfKeyPair *keyPair = nullptr;
+        if (generator->generateKeyPair(generator, nullptr, &keyPair) != HCF_SUCCESS) {
+            state.SkipWithError("generateKeyPair failed.");
+            break;
+        }
+        HcfObjDestroy(keyPair);
+    }
+    state.SetItemsProcessed(state.iterations());
+    HcfObjDestroy(generator);
+}
+
+void BenchmarkOpensslDhKeyGen(benchmark::State &state, const char *nidName)
+{
+    for (auto _ : state) {
+        EVP_PKEY *pkey = GenerateOpensslDhKey(nidName);
+        if (pkey == nullptr) {
+            state.SkipWithError("OpenSSL key generation failed.");
+            break;
+        }
+        EVP_PKEY_free(pkey);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BenchmarkDhGenerateSecret(benchmark::State &state, const char *algName)
+{
+    DhAgreementKeys keys;
+    HcfKeyAgreement *keyAgreement = nullptr;
+    if (!PrepareDhAgreementKeys(algName, keys) || (HcfKeyAgreementCreate("DH", &keyAgreement) != HCF_SUCCESS)) {
+        ReleaseDhAgreementKeys(keys);
+        state.SkipWithError("Failed to prepare keys.");
+        return;
+    }
+    for (auto _ : state) {
+        HcfBlob secret = { .data = nullptr, .len = 0 };
+        if (keyAgreement->generateSecret(keyAgreement, keys.keyPair1->priKey, keys.keyPair2->pubKey, &secret) !=
+            HCF_SUCCESS) {
+            state.SkipWithError("generateSecret failed.");
+            break;
+        }
+        HcfBlobDataClearAndFree(&secret);
+    }
+    state.SetItemsProcessed(state.iterations());
+    HcfObjDestroy(keyAgreement);
+    ReleaseDhAgreementKeys(keys);
+}
+
+void BenchmarkOpensslDhDerive(benchmark::State &state, const char *nidName)
+{
+    EVP_PKEY *priKey = GenerateOpensslDhKey(nidName);
+    EVP_PKEY *pubKey = GenerateOpensslDhKey(nidName);
+    vector<uint8_t> secret;
+    for (auto _ : state) {
+        if ((priKey == nullptr) || (pubKey == nullptr) || !DeriveOpensslDhSecret(priKey, pubKey, secret)) {
+            state.SkipWithError("OpenSSL derive failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    EVP_PKEY_free(priKey);
+    EVP_PKEY_free(pubKey);
+}
+
+void DhArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Unit(benchmark::kMillisecond);
+}
+}
+
+#define DH_BENCHMARKS(name, algName, nidName)                                                      \
+    BENCHMARK_CAPTURE(BenchmarkDhGenerateKeyPair, name, algName)->Apply(DhArgs);                   \
+    BENCHMARK_CAPTURE(BenchmarkOpensslDhKeyGen, name, nidName)->Apply(DhArgs);                     \
+    BENCHMARK_CAPTURE(BenchmarkDhGenerateSecret, name, algName)->Apply(DhArgs);                    \
+    BENCHMARK_CAPTURE(BenchmarkOpensslDhDerive, name, nidName)->Apply(DhArgs)
+
+DH_BENCHMARKS(ffdhe2048, "DH_ffdhe2048", "ffdhe2048");
+DH_BENCHMARKS(ffdhe3072, "DH_ffdhe3072", "ffdhe3072");
+DH_BENCHMARKS(ffdhe4096, "DH_ffdhe4096", "ffdhe4096");
+DH_BENCHMARKS(modp2048, "DH_modp2048", "modp_2048");
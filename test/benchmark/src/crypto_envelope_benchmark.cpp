@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Hybrid encryption of one message to a recipient public key, assembled by the caller from an ephemeral key pair,
+ * key agreement, HKDF and AES-GCM, against the one-shot envelope seal of the same construction.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_gcm_params.h"
+#include "detailed_hkdf_params.h"
+#include "envelope.h"
+#include "kdf.h"
+#include "key_agreement.h"
+#include "object_base.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr uint8_t BENCHMARK_FILL_BYTE = 0x5a;
+constexpr uint32_t CONTENT_KEY_LEN = 32;
+constexpr uint32_t CONTENT_NONCE_LEN = 12;
+constexpr uint32_t CONTENT_TAG_LEN = 16;
+
+const char *GetGcmParamsSpecType(void)
+{
+    return "GcmParamsSpec";
+}
+
+struct EnvelopeBenchmarkEnv {
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *recipient = nullptr;
+    HcfKeyAgreement *keyAgreement = nullptr;
+    HcfKdf *kdf = nullptr;
+    HcfSymKeyGenerator *symKeyGenerator = nullptr;
+    HcfCipher *cipher = nullptr;
+    HcfEnvelope *envelope = nullptr;
+};
+
+void ReleaseEnvelopeBenchmarkEnv(EnvelopeBenchmarkEnv &env)
+{
+    HcfObjDestroy(env.envelope);
+    HcfObjDestroy(env.cipher);
+    HcfObjDestroy(env.symKeyGenerator);
+    HcfObjDestroy(env.kdf);
+    HcfObjDestroy(env.keyAgreement);
+    HcfObjDestroy(env.recipient);
+    HcfObjDestroy(env.generator);
+    env = EnvelopeBenchmarkEnv();
+}
+
+bool PrepareEnvelopeBenchmarkEnv(EnvelopeBenchmarkEnv &env)
+{
+    if ((HcfAsyKeyGeneratorCreate("X25519", &env.generator) != HCF_SUCCESS) ||
+        (env.generator->generateKeyPair(env.generator, nullptr, &env.recipient) != HCF_SUCCESS) ||
+        (HcfKeyAgreementCreate("X25519", &env.keyAgreement) != HCF_SUCCESS) ||
+        (HcfKdfCreate("HKDF|SHA256", &env.kdf) != HCF_SUCCESS) ||
+        (HcfSymKeyGeneratorCreate("AES256", &env.symKeyGenerator) != HCF_SUCCESS) ||
+        (HcfCipherCreate("AES256|GCM|NoPadding", &env.cipher) != HCF_SUCCESS) ||
+        (HcfEnvelopeCreate("X25519-AES256-GCM", &env.envelope) != HCF_SUCCESS)) {
+        ReleaseEnvelopeBenchmarkEnv(env);
+        return false;
+    }
+    return true;
+}
+
+/* One message through ephemeral key pair, agreement, HKDF and GCM, framed as ephemeral key || ciphertext || tag. */
+bool ManualSeal(EnvelopeBenchmarkEnv &env, HcfBlob *input, HcfBlob *aad, vector<uint8_t> &record)
+{
+    HcfKeyPair *ephemeral = nullptr;
+    if (env.generator->generateKeyPair(env.generator, nullptr, &ephemeral) != HCF_SUCCESS) {
+        return false;
+    }
+    HcfBlob secret = { .data = nullptr, .len = 0 };
+    HcfBlob enc = { .data = nullptr, .len = 0 };
+    uint8_t okm[CONTENT_KEY_LEN + CONTENT_NONCE_LEN] = { 0 };
+    // A hash length of zeros is the salt HKDF substitutes when none is given.
+    uint8_t salt[CONTENT_KEY_LEN] = { 0 };
+    HcfHkdfParamsSpec hkdfSpec = {};
+    hkdfSpec.base.algName = "HKDF";
+    hkdfSpec.salt = { .data = salt, .len = sizeof(salt) };
+    hkdfSpec.output = { .data = okm, .len = sizeof(okm) };
+    HcfSymKey *contentKey = nullptr;
+    HcfBlob keyBlob = { .data = okm, .len = CONTENT_KEY_LEN };
+    bool ok = (env.keyAgreement->generateSecret(env.keyAgreement, ephemeral->priKey, env.recipient->pubKey,
+        &secret) == HCF_SUCCESS) &&
+        (ephemeral->pubKey->base.getEncoded(&ephemeral->pubKey->base, &enc) == HCF_SUCCESS);
+    if (ok) {
+        hkdfSpec.key = secret;
+        hkdfSpec.info = enc;
+        ok = (env.kdf->generateSecret(env.kdf, &hkdfSpec.base) == HCF_SUCCESS) &&
+            (env.symKeyGenerator->convertSymKey(env.symKeyGenerator, &keyBlob, &contentKey) == HCF_SUCCESS);
+    }
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    if (ok) {
+        uint8_t tag[CONTENT_TAG_LEN] = { 0 };
+        HcfGcmParamsSpec gcmSpec = {};
+        gcmSpec.base.getType = GetGcmParamsSpecType;
+        gcmSpec.iv = { .data = okm + CONTENT_KEY_LEN, .len = CONTENT_NONCE_LEN };
+        gcmSpec.aad = *aad;
+        gcmSpec.tag = { .data = tag, .len = sizeof(tag) };
+        ok = (env.cipher->init(env.cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(contentKey),
+            reinterpret_cast<HcfParamsSpec *>(&gcmSpec)) == HCF_SUCCESS) &&
+            (env.cipher->doFinal(env.cipher, input, &output) == HCF_SUCCESS);
+    }
+    if (ok) {
+        record.assign(enc.data, enc.data + enc.len);
+        record.insert(record.end(), output.data, output.data + output.len);
+    }
+    HcfBlobDataFree(&output);
+    HcfObjDestroy(contentKey);
+    HcfBlobDataClearAndFree(&secret);
+    HcfBlobDataFree(&enc);
+    HcfObjDestroy(ephemeral);
+    return ok;
+}
+
+/* range(0) is the message size. */
+void BenchmarkManualSeal(benchmark::State &state)
+{
+    EnvelopeBenchmarkEnv env;
+    if (!PrepareEnvelopeBenchmarkEnv(env)) {
+        state.SkipWithError("Failed to prepare envelope.");
+        return;
+    }
+    vector<uint8_t> plain(state.range(0), BENCHMARK_FILL_BYTE);
+    vector<uint8_t> aadData(CONTENT_TAG_LEN, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = plain.size() };
+    HcfBlob aad = { .data = aadData.data(), .len = aadData.size() };
+    vector<uint8_t> record;
+    for (auto _ : state) {
+        if (!ManualSeal(env, &input, &aad, record)) {
+            state.SkipWithError("Failed to seal.");
+            break;
+        }
+        benchmark::DoNotOptimize(record.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseEnvelopeBenchmarkEnv(env);
+}
+
+void BenchmarkEnvelopeSeal(benchmark::State &state)
+{
+    EnvelopeBenchmarkEnv env;
+    if (!PrepareEnvelopeBenchmarkEnv(env)) {
+        state.SkipWithError("Failed to prepare envelope.");
+        return;
+    }
+    vector<uint8_t> plain(state.range(0), BENCHMARK_FILL_BYTE);
+    vector<uint8_t> aadData(CONTENT_TAG_LEN, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = plain.size() };
+    HcfBlob aad = { .data = aadData.data(), .len = aadData.size() };
+    for (auto _ : state) {
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if (env.envelope->seal(env.envelope, env.recipient->pubKey, &aad, &input, &output) != HCF_SUCCESS) {
+            state.SkipWithError("Failed to seal.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data);
+        HcfBlobDataFree(&output);
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseEnvelopeBenchmarkEnv(env);
+}
+
+void BenchmarkEnvelopeOpen(benchmark::State &state)
+{
+    EnvelopeBenchmarkEnv env;
+    if (!PrepareEnvelopeBenchmarkEnv(env)) {
+        state.SkipWithError("Failed to prepare envelope.");
+        return;
+    }
+    vector<uint8_t> plain(state.range(0), BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = plain.size() };
+    HcfBlob sealed = { .data = nullptr, .len = 0 };
+    if (env.envelope->seal(env.envelope, env.recipient->pubKey, nullptr, &input, &sealed) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to seal.");
+        ReleaseEnvelopeBenchmarkEnv(env);
+        return;
+    }
+    for (auto _ : state) {
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if (env.envelope->open(env.envelope, env.recipient->priKey, nullptr, &sealed, &output) != HCF_SUCCESS) {
+            state.SkipWithError("Failed to open.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data);
+        HcfBlobDataClearAndFree(&output);
+    }
+    state.SetItemsProcessed(state.iterations());
+    HcfBlobDataFree(&sealed);
+    ReleaseEnvelopeBenchmarkEnv(env);
+}
+
+void MessageSizeArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgName("bytes")->Arg(32)->Arg(1024)->Arg(16384)->Unit(benchmark::kMicrosecond);
+}
+}
+
+BENCHMARK(BenchmarkManualSeal)->Apply(MessageSizeArgs);
+BENCHMARK(BenchmarkEnvelopeSeal)->Apply(MessageSizeArgs);
+BENCHMARK(BenchmarkEnvelopeOpen)->Apply(MessageSizeArgs);
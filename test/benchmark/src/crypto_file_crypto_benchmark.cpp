@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_iv_params.h"
+#include "file_crypto.h"
+#include "md.h"
+#include "object_base.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr const char *BENCH_FILE = "/data/test_file_crypto_benchmark.txt";
+constexpr size_t BENCH_FILE_LEN = 64 * 1024 * 1024;
+/* The chunk size a caller typically uses when it reads the file itself. */
+constexpr size_t READ_CHUNK_LEN = 64 * 1024;
+constexpr uint8_t BENCH_FILL_BYTE = 0x5a;
+
+bool PrepareBenchFile()
+{
+    int fd = open(BENCH_FILE, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return false;
+    }
+    vector<uint8_t> chunk(READ_CHUNK_LEN, BENCH_FILL_BYTE);
+    bool ret = true;
+    for (size_t done = 0; (done < BENCH_FILE_LEN) && ret; done += chunk.size()) {
+        ret = (write(fd, chunk.data(), chunk.size()) == static_cast<ssize_t>(chunk.size()));
+    }
+    close(fd);
+    return ret;
+}
+
+HcfResult MdUpdateByRead(HcfMd *md, int fd, vector<uint8_t> &buf)
+{
+    ssize_t len;
+    while ((len = read(fd, buf.data(), buf.size())) > 0) {
+        HcfBlob input = { .data = buf.data(), .len = static_cast<size_t>(len) };
+        HcfResult res = md->update(md, &input);
+        if (res != HCF_SUCCESS) {
+            return res;
+        }
+    }
+    return (len == 0) ? HCF_SUCCESS : HCF_ERR_CRYPTO_OPERATION;
+}
+
+HcfResult CipherUpdateByRead(HcfCipher *cipher, int inFd, int outFd, vector<uint8_t> &buf)
+{
+    ssize_t len;
+    while ((len = read(inFd, buf.data(), buf.size())) > 0) {
+        HcfBlob input = { .data = buf.data(), .len = static_cast<size_t>(len) };
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        HcfResult res = cipher->update(cipher, &input, &output);
+        if ((res == HCF_SUCCESS) && (write(outFd, output.data, output.len) != static_cast<ssize_t>(output.len))) {
+            res = HCF_ERR_CRYPTO_OPERATION;
+        }
+        HcfBlobDataFree(&output);
+        if (res != HCF_SUCCESS) {
+            return res;
+        }
+    }
+    return (len == 0) ? HCF_SUCCESS : HCF_ERR_CRYPTO_OPERATION;
+}
+
+/* range(0) is 0 for the read and update loop and 1 for updateFd. */
+void BenchmarkFileMd(benchmark::State &state)
+{
+    if (!PrepareBenchFile()) {
+        state.SkipWithError("Failed to prepare file.");
+        return;
+    }
+    bool useFd = (state.range(0) != 0);
+    vector<uint8_t> buf(READ_CHUNK_LEN);
+    for (auto _ : state) {
+        HcfMd *md = nullptr;
+        int fd = open(BENCH_FILE, O_RDONLY);
+        if ((fd < 0) || (HcfMdCreate("SHA256", &md) != HCF_SUCCESS)) {
+            state.SkipWithError("Failed to create md.");
+            break;
+        }
+        HcfResult res = useFd ? HcfMdUpdateFd(md, fd, 0, 0) : MdUpdateByRead(md, fd, buf);
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        if ((res != HCF_SUCCESS) || (md->doFinal(md, &out) != HCF_SUCCESS)) {
+            state.SkipWithError("md failed.");
+        }
+        HcfBlobDataFree(&out);
+        HcfObjDestroy(md);
+        close(fd);
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_FILE_LEN);
+    (void)unlink(BENCH_FILE);
+}
+
+void BenchmarkFileCipher(benchmark::State &state)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (!PrepareBenchFile() || (HcfSymKeyGeneratorCreate("AES256", &generator) != HCF_SUCCESS) ||
+        (generator->generateSymKey(generator, &key) != HCF_SUCCESS)) {
+        HcfObjDestroy(generator);
+        state.SkipWithError("Failed to prepare cipher.");
+        return;
+    }
+    bool useFd = (state.range(0) != 0);
+    vector<uint8_t> buf(READ_CHUNK_LEN);
+    uint8_t iv[16] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = sizeof(iv);
+    for (auto _ : state) {
+        HcfCipher *cipher = nullptr;
+        if ((HcfCipherCreate("AES256|CTR|NoPadding", &cipher) != HCF_SUCCESS) ||
+            (cipher->init(cipher, ENCRYPT_MODE, &key->key, &ivSpec.base) != HCF_SUCCESS)) {
+            HcfObjDestroy(cipher);
+            state.SkipWithError("Failed to create cipher.");
+            break;
+        }
+        int inFd = open(BENCH_FILE, O_RDONLY);
+        int outFd = open("/dev/null", O_WRONLY);
+        HcfResult res = useFd ? HcfCipherUpdateFd(cipher, inFd, 0, 0, outFd) :
+            CipherUpdateByRead(cipher, inFd, outFd, buf);
+        if (res != HCF_SUCCESS) {
+            state.SkipWithError("cipher failed.");
+        }
+        close(inFd);
+        close(outFd);
+        HcfObjDestroy(cipher);
+    }
+    state.SetBytesProcessed(state.iterations() * BENCH_FILE_LEN);
+    HcfObjDestroy(key);
+    HcfObjDestroy(generator);
+    (void)unlink(BENCH_FILE);
+}
+}
+
+BENCHMARK(BenchmarkFileMd)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BenchmarkFileCipher)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
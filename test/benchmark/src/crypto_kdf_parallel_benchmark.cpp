@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <vector>
+
+#include "blob.h"
+#include "detailed_pbkdf2_params.h"
+#include "detailed_scrypt_params.h"
+#include "kdf.h"
+#include "object_base.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t BENCHMARK_SALT_LEN = 16;
+constexpr uint64_t BENCHMARK_SCRYPT_N = 16384;
+constexpr uint64_t BENCHMARK_SCRYPT_R = 8;
+constexpr uint64_t BENCHMARK_SCRYPT_MAX_MEM = 512 * 1024 * 1024;
+const char *g_benchmarkPassword = "benchmark password";
+uint8_t g_benchmarkSalt[BENCHMARK_SALT_LEN] = { 0 };
+
+HcfBlob PasswordBlob()
+{
+    return { .data = reinterpret_cast<uint8_t *>(const_cast<char *>(g_benchmarkPassword)),
+        .len = strlen(g_benchmarkPassword) };
+}
+
+/* range(0) is the output length in bytes, range(1) the thread count, 1 being the serial path. */
+void BenchmarkParallelPbkdf2(benchmark::State &state, const char *alg, int iterations)
+{
+    HcfKdf *kdf = nullptr;
+    if (HcfKdfCreate(alg, &kdf) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create kdf.");
+        return;
+    }
+    vector<uint8_t> out(static_cast<size_t>(state.range(0)));
+    HcfPBKDF2ParamsSpec params = {
+        .base = { .algName = "PBKDF2" },
+        .password = PasswordBlob(),
+        .salt = { .data = g_benchmarkSalt, .len = BENCHMARK_SALT_LEN },
+        .iterations = iterations,
+        .output = { .data = out.data(), .len = out.size() },
+        .threadNum = static_cast<uint32_t>(state.range(1)),
+    };
+    for (auto _ : state) {
+        if (kdf->generateSecret(kdf, &(params.base)) != HCF_SUCCESS) {
+            state.SkipWithError("Pbkdf2 failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    HcfObjDestroy(kdf);
+}
+
+/* range(0) is the scrypt p parameter, range(1) the thread count, 1 being the serial path. */
+void BenchmarkParallelScrypt(benchmark::State &state)
+{
+    HcfKdf *kdf = nullptr;
+    if (HcfKdfCreate("SCRYPT", &kdf) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create kdf.");
+        return;
+    }
+    vector<uint8_t> out(64);
+    HcfScryptParamsSpec params = {
+        .base = { .algName = "SCRYPT" },
+        .passPhrase = PasswordBlob(),
+        .salt = { .data = g_benchmarkSalt, .len = BENCHMARK_SALT_LEN },
+        .n = BENCHMARK_SCRYPT_N,
+        .r = BENCHMARK_SCRYPT_R,
+        .p = static_cast<uint64_t>(state.range(0)),
+        .maxMem = BENCHMARK_SCRYPT_MAX_MEM,
+        .output = { .data = out.data(), .len = out.size() },
+        .threadNum = static_cast<uint32_t>(state.range(1)),
+    };
+    for (auto _ : state) {
+        if (kdf->generateSecret(kdf, &(params.base)) != HCF_SUCCESS) {
+            state.SkipWithError("Scrypt failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    HcfObjDestroy(kdf);
+}
+
+void ParallelPbkdf2Args(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgNames({ "bytes", "threads" })
+        ->ArgsProduct({ { 32, 96, 256 }, { 1, 2, 4, 8 } })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+}
+
+void ParallelScryptArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgNames({ "p", "threads" })
+        ->ArgsProduct({ { 4, 16 }, { 1, 2, 4, 8 } })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+}
+}
+
+BENCHMARK_CAPTURE(BenchmarkParallelPbkdf2, SHA256, "PBKDF2|SHA256", 100000)->Apply(ParallelPbkdf2Args);
+BENCHMARK_CAPTURE(BenchmarkParallelPbkdf2, SHA512, "PBKDF2|SHA512", 100000)->Apply(ParallelPbkdf2Args);
+BENCHMARK(BenchmarkParallelScrypt)->Apply(ParallelScryptArgs);
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "kem.h"
+#include "object_base.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t KEM_BATCH_SIZE = 64;
+
+struct KemAlgName {
+    const char *keyGenName;
+    const char *kemName;
+};
+
+struct KemBenchmarkEnv {
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *keyPair = nullptr;
+    HcfKem *kem = nullptr;
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+};
+
+void ReleaseKemBenchmarkEnv(KemBenchmarkEnv &env)
+{
+    HcfObjDestroy(env.kem);
+    HcfObjDestroy(env.keyPair);
+    HcfObjDestroy(env.generator);
+    env = KemBenchmarkEnv();
+}
+
+bool PrepareKemBenchmarkEnv(const KemAlgName &algName, KemBenchmarkEnv &env)
+{
+    if ((HcfAsyKeyGeneratorCreate(algName.keyGenName, &env.generator) != HCF_SUCCESS) ||
+        (env.generator->generateKeyPair(env.generator, nullptr, &env.keyPair) != HCF_SUCCESS) ||
+        (HcfKemCreate(algName.kemName, &env.kem) != HCF_SUCCESS) ||
+        (env.kem->getOutputLen(env.kem, &env.sharedSecretLen, &env.wrappedKeyLen) != HCF_SUCCESS)) {
+        ReleaseKemBenchmarkEnv(env);
+        return false;
+    }
+    return true;
+}
+
+void BenchmarkKemEncapsulate(benchmark::State &state, KemAlgName algName)
+{
+    KemBenchmarkEnv env;
+    if (!PrepareKemBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare kem.");
+        return;
+    }
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < KEM_BATCH_SIZE; i++) {
+            HcfBlob sharedSecret = { .data = nullptr, .len = 0 };
+            HcfBlob wrappedKey = { .data = nullptr, .len = 0 };
+            if (env.kem->encapsulate(env.kem, env.keyPair->pubKey, nullptr, &sharedSecret, &wrappedKey) !=
+                HCF_SUCCESS) {
+                state.SkipWithError("encapsulate failed.");
+                break;
+            }
+            HcfBlobDataClearAndFree(&sharedSecret);
+            HcfBlobDataClearAndFree(&wrappedKey);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * KEM_BATCH_SIZE);
+    ReleaseKemBenchmarkEnv(env);
+}
+
+void BenchmarkKemEncapsulateBatch(benchmark::State &state, KemAlgName algName)
+{
+    KemBenchmarkEnv env;
+    if (!PrepareKemBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare kem.");
+        return;
+    }
+    uint32_t workerNum = static_cast<uint32_t>(state.range(0));
+    vector<HcfPubKey *> pubKeys(KEM_BATCH_SIZE, env.keyPair->pubKey);
+    vector<uint8_t> secretsData(KEM_BATCH_SIZE * env.sharedSecretLen);
+    vector<uint8_t> wrappedData(KEM_BATCH_SIZE * env.wrappedKeyLen);
+    HcfBlob sharedSecrets = { .data = secretsData.data(), .len = secretsData.size() };
+    HcfBlob wrappedKeys = { .data = wrappedData.data(), .len = wrappedData.size() };
+    for (auto _ : state) {
+        if (env.kem->encapsulateBatch(env.kem, pubKeys.data(), KEM_BATCH_SIZE, workerNum, &sharedSecrets,
+            &wrappedKeys) != HCF_SUCCESS) {
+            state.SkipWithError("encapsulateBatch failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * KEM_BATCH_SIZE);
+    ReleaseKemBenchmarkEnv(env);
+}
+
+void BenchmarkKemDecapsulate(benchmark::State &state, KemAlgName algName)
+{
+    KemBenchmarkEnv env;
+    HcfBlob sharedSecret = { .data = nullptr, .len = 0 };
+    HcfBlob wrappedKey = { .data = nullptr, .len = 0 };
+    if (!PrepareKemBenchmarkEnv(algName, env) ||
+        (env.kem->encapsulate(env.kem, env.keyPair->pubKey, nullptr, &sharedSecret, &wrappedKey) != HCF_SUCCESS)) {
+        ReleaseKemBenchmarkEnv(env);
+        state.SkipWithError("Failed to prepare kem.");
+        return;
+    }
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < KEM_BATCH_SIZE; i++) {
+            HcfBlob out = { .data = nullptr, .len = 0 };
+            if (env.kem->decapsulate(env.kem, env.keyPair->priKey, &wrappedKey, &out) != HCF_SUCCESS) {
+                state.SkipWithError("decapsulate failed.");
+                break;
+            }
+            HcfBlobDataClearAndFree(&out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * KEM_BATCH_SIZE);
+    HcfBlobDataClearAndFree(&sharedSecret);
+    HcfBlobDataClearAndFree(&wrappedKey);
+    ReleaseKemBenchmarkEnv(env);
+}
+
+void BenchmarkKemDecapsulateBatch(benchmark::State &state, KemAlgName algName)
+{
+    KemBenchmarkEnv env;
+    if (!PrepareKemBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare kem.");
+        return;
+    }
+    uint32_t workerNum = static_cast<uint32_t>(state.range(0));
+    vector<HcfPubKey *> pubKeys(KEM_BATCH_SIZE, env.keyPair->pubKey);
+    vector<uint8_t> secretsData(KEM_BATCH_SIZE * env.sharedSecretLen);
+    vector<uint8_t> wrappedData(KEM_BATCH_SIZE * env.wrappedKeyLen);
+    HcfBlob sharedSecrets = { .data = secretsData.data(), .len = secretsData.size() };
+    HcfBlob wrappedKeys = { .data = wrappedData.data(), .len = wrappedData.size() };
+    if (env.kem->encapsulateBatch(env.kem, pubKeys.data(), KEM_BATCH_SIZE, 0, &sharedSecrets, &wrappedKeys) !=
+        HCF_SUCCESS) {
+        ReleaseKemBenchmarkEnv(env);
+        state.SkipWithError("Failed to prepare wrapped keys.");
+        return;
+    }
+    for (auto _ : state) {
+        if (env.kem->decapsulateBatch(env.kem, env.keyPair->priKey, &wrappedKeys, KEM_BATCH_SIZE, workerNum,
+            &sharedSecrets) != HCF_SUCCESS) {
+            state.SkipWithError("decapsulateBatch failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * KEM_BATCH_SIZE);
+    ReleaseKemBenchmarkEnv(env);
+}
+
+void KemBatchArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Unit(benchmark::kMicrosecond)->Arg(0)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
+}
+
+#define KEM_BATCH_BENCHMARKS(name, algName)                                                        \
+    BENCHMARK_CAPTURE(BenchmarkKemEncapsulate, name, algName)->Unit(benchmark::kMicrosecond);      \
+    BENCHMARK_CAPTURE(BenchmarkKemEncapsulateBatch, name, algName)->Apply(KemBatchArgs);            \
+    BENCHMARK_CAPTURE(BenchmarkKemDecapsulate, name, algName)->Unit(benchmark::kMicrosecond);      \
+    BENCHMARK_CAPTURE(BenchmarkKemDecapsulateBatch, name, algName)->Apply(KemBatchArgs)
+
+KEM_BATCH_BENCHMARKS(MlKem512, (KemAlgName { "ML-KEM-512", "ML-KEM512" }));
+KEM_BATCH_BENCHMARKS(MlKem768, (KemAlgName { "ML-KEM-768", "ML-KEM768" }));
+KEM_BATCH_BENCHMARKS(MlKem1024, (KemAlgName { "ML-KEM-1024", "ML-KEM1024" }));
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "detailed_hkdf_params.h"
+#include "kdf.h"
+#include "key_agreement.h"
+#include "object_base.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t DERIVED_KEY_LEN = 32;
+uint8_t g_salt[] = "derive key benchmark salt";
+uint8_t g_info[] = "derive key benchmark info";
+
+struct DeriveKeyBenchmarkEnv {
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *keyPair = nullptr;
+    HcfKeyAgreement *keyAgreement = nullptr;
+};
+
+void ReleaseDeriveKeyBenchmarkEnv(DeriveKeyBenchmarkEnv &env)
+{
+    HcfObjDestroy(env.keyAgreement);
+    HcfObjDestroy(env.keyPair);
+    HcfObjDestroy(env.generator);
+    env = DeriveKeyBenchmarkEnv();
+}
+
+bool PrepareDeriveKeyBenchmarkEnv(const char *algName, DeriveKeyBenchmarkEnv &env)
+{
+    if ((HcfAsyKeyGeneratorCreate(algName, &env.generator) != HCF_SUCCESS) ||
+        (env.generator->generateKeyPair(env.generator, nullptr, &env.keyPair) != HCF_SUCCESS) ||
+        (HcfKeyAgreementCreate(algName, &env.keyAgreement) != HCF_SUCCESS)) {
+        ReleaseDeriveKeyBenchmarkEnv(env);
+        return false;
+    }
+    return true;
+}
+
+/* The two step session key setup, generateSecret then an HKDF object per session. */
+void BenchmarkGenerateSecretThenKdf(benchmark::State &state, const char *algName)
+{
+    DeriveKeyBenchmarkEnv env;
+    if (!PrepareDeriveKeyBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare key agreement.");
+        return;
+    }
+    vector<uint8_t> out(DERIVED_KEY_LEN);
+    for (auto _ : state) {
+        HcfBlob secret = { .data = nullptr, .len = 0 };
+        HcfKdf *kdf = nullptr;
+        if ((env.keyAgreement->generateSecret(env.keyAgreement, env.keyPair->priKey, env.keyPair->pubKey,
+            &secret) != HCF_SUCCESS) || (HcfKdfCreate("HKDF|SHA256", &kdf) != HCF_SUCCESS)) {
+            HcfBlobDataClearAndFree(&secret);
+            state.SkipWithError("generateSecret failed.");
+            break;
+        }
+        HcfHkdfParamsSpec params = {
+            .base = { .algName = "HKDF" },
+            .key = secret,
+            .salt = { .data = g_salt, .len = sizeof(g_salt) },
+            .info = { .data = g_info, .len = sizeof(g_info) },
+            .output = { .data = out.data(), .len = out.size() },
+        };
+        HcfResult res = kdf->generateSecret(kdf, &params.base);
+        HcfObjDestroy(kdf);
+        HcfBlobDataClearAndFree(&secret);
+        if (res != HCF_SUCCESS) {
+            state.SkipWithError("kdf failed.");
+            break;
+        }
+    }
+    ReleaseDeriveKeyBenchmarkEnv(env);
+}
+
+void BenchmarkDeriveKey(benchmark::State &state, const char *algName)
+{
+    DeriveKeyBenchmarkEnv env;
+    if (!PrepareDeriveKeyBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare key agreement.");
+        return;
+    }
+    HcfKeyAgreementKdfSpec spec = {
+        .algName = "HKDF",
+        .mdName = "SHA256",
+        .salt = { .data = g_salt, .len = sizeof(g_salt) },
+        .info = { .data = g_info, .len = sizeof(g_info) },
+        .keyLen = DERIVED_KEY_LEN,
+    };
+    for (auto _ : state) {
+        HcfBlob key = { .data = nullptr, .len = 0 };
+        if (env.keyAgreement->deriveKey(env.keyAgreement, env.keyPair->priKey, env.keyPair->pubKey, &spec,
+            &key) != HCF_SUCCESS) {
+            state.SkipWithError("deriveKey failed.");
+            break;
+        }
+        HcfBlobDataClearAndFree(&key);
+    }
+    ReleaseDeriveKeyBenchmarkEnv(env);
+}
+}
+
+#define DERIVE_KEY_BENCHMARKS(name, algName)                                                        \
+    BENCHMARK_CAPTURE(BenchmarkGenerateSecretThenKdf, name, algName)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_CAPTURE(BenchmarkDeriveKey, name, algName)->Unit(benchmark::kMicrosecond)
+
+DERIVE_KEY_BENCHMARKS(X25519, "X25519");
+DERIVE_KEY_BENCHMARKS(Ecc256, "ECC256");
+DERIVE_KEY_BENCHMARKS(DhFfdhe2048, "DH_ffdhe2048");
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <openssl/decoder.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include <string>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "object_base.h"
+#include "pub_key_cache.h"
+
+using namespace std;
+
+namespace {
+struct ImportKeys {
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfBlob pubDer = { .data = nullptr, .len = 0 };
+    HcfBlob priDer = { .data = nullptr, .len = 0 };
+    string pubPem;
+    string priPem;
+};
+
+string DerToPem(const HcfBlob &der, bool isPubKey)
+{
+    const unsigned char *data = der.data;
+    EVP_PKEY *pkey = isPubKey ? d2i_PUBKEY(nullptr, &data, der.len) : d2i_AutoPrivateKey(nullptr, &data, der.len);
+    BIO *bio = BIO_new(BIO_s_mem());
+    string pem;
+    if ((pkey != nullptr) && (bio != nullptr) && (isPubKey ? PEM_write_bio_PUBKEY(bio, pkey) :
+        PEM_write_bio_PrivateKey(bio, pkey, nullptr, nullptr, 0, nullptr, nullptr)) == 1) {
+        char *pemData = nullptr;
+        long pemLen = BIO_get_mem_data(bio, &pemData);
+        pem.assign(pemData, pemLen);
+    }
+    BIO_free(bio);
+    EVP_PKEY_free(pkey);
+    return pem;
+}
+
+void ReleaseImportKeys(ImportKeys &keys)
+{
+    HcfBlobDataFree(&keys.pubDer);
+    HcfBlobDataClearAndFree(&keys.priDer);
+    HcfObjDestroy(keys.generator);
+    keys.generator = nullptr;
+}
+
+bool PrepareImportKeys(const char *algName, ImportKeys &keys)
+{
+    HcfKeyPair *keyPair = nullptr;
+    if ((HcfAsyKeyGeneratorCreate(algName, &keys.generator) != HCF_SUCCESS) ||
+        (keys.generator->generateKeyPair(keys.generator, nullptr, &keyPair) != HCF_SUCCESS)) {
+        HcfObjDestroy(keys.generator);
+        keys.generator = nullptr;
+        return false;
+    }
+    bool ok = (keyPair->pubKey->base.getEncoded(&keyPair->pubKey->base, &keys.pubDer) == HCF_SUCCESS) &&
+        (keyPair->priKey->base.getEncoded(&keyPair->priKey->base, &keys.priDer) == HCF_SUCCESS);
+    HcfObjDestroy(keyPair);
+    if (ok) {
+        keys.pubPem = DerToPem(keys.pubDer, true);
+        keys.priPem = DerToPem(keys.priDer, false);
+        ok = !keys.pubPem.empty() && !keys.priPem.empty();
+    }
+    if (!ok) {
+        ReleaseImportKeys(keys);
+    }
+    return ok;
+}
+
+/* convertKey of a whole pair from its own getEncoded output, the rate is key pairs per second. */
+void BenchmarkConvertKey(benchmark::State &state, const char *algName)
+{
+    ImportKeys keys;
+    if (!PrepareImportKeys(algName, keys)) {
+        state.SkipWithError("Failed to prepare keys.");
+        return;
+    }
+    for (auto _ : state) {
+        HcfKeyPair *keyPair = nullptr;
+        if (keys.generator->convertKey(keys.generator, nullptr, &keys.pubDer, &keys.priDer, &keyPair) != HCF_SUCCESS) {
+            state.SkipWithError("convertKey failed.");
+            break;
+        }
+        HcfObjDestroy(keyPair);
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseImportKeys(keys);
+}
+
+void BenchmarkConvertPemKey(benchmark::State &state, const char *algName)
+{
+    ImportKeys keys;
+    if (!PrepareImportKeys(algName, keys)) {
+        state.SkipWithError("Failed to prepare keys.");
+        return;
+    }
+    for (auto _ : state) {
+        HcfKeyPair *keyPair = nullptr;
+        if (keys.generator->convertPemKey(keys.generator, nullptr, keys.pubPem.c_str(), keys.priPem.c_str(),
+            &keyPair) != HCF_SUCCESS) {
+            state.SkipWithError("convertPemKey failed.");
+            break;
+        }
+        HcfObjDestroy(keyPair);
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseImportKeys(keys);
+}
+
+/* Public key only, as a verifier importing the same peer keys does. range(0) is the cache capacity, 0 disables it. */
+void BenchmarkConvertPubKey(benchmark::State &state, const char *algName)
+{
+    ImportKeys keys;
+    if (!PrepareImportKeys(algName, keys) ||
+        (HcfPubKeyCacheSetCapacity(static_cast<uint32_t>(state.range(0))) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to prepare keys.");
+        ReleaseImportKeys(keys);
+        return;
+    }
+    for (auto _ : state) {
+        HcfKeyPair *keyPair = nullptr;
+        if (keys.generator->convertKey(keys.generator, nullptr, &keys.pubDer, nullptr, &keyPair) != HCF_SUCCESS) {
+            state.SkipWithError("convertKey failed.");
+            break;
+        }
+        HcfObjDestroy(keyPair);
+    }
+    state.SetItemsProcessed(state.iterations());
+    (void)HcfPubKeyCacheSetCapacity(0);
+    ReleaseImportKeys(keys);
+}
+
+/* The generic d2i calls the plugin used before, they build a decoder context internally on every call. */
+void BenchmarkOpensslGenericDer(benchmark::State &state, const char *algName)
+{
+    ImportKeys keys;
+    if (!PrepareImportKeys(algName, keys)) {
+        state.SkipWithError("Failed to prepare keys.");
+        return;
+    }
+    for (auto _ : state) {
+        const unsigned char *pubData = keys.pubDer.data;
+        const unsigned char *priData = keys.priDer.data;
+        EVP_PKEY *pubKey = d2i_PUBKEY(nullptr, &pubData, keys.pubDer.len);
+        EVP_PKEY *priKey = d2i_AutoPrivateKey(nullptr, &priData, keys.priDer.len);
+        bool ok = (pubKey != nullptr) && (priKey != nullptr);
+        EVP_PKEY_free(pubKey);
+        EVP_PKEY_free(priKey);
+        if (!ok) {
+            state.SkipWithError("d2i failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseImportKeys(keys);
+}
+
+EVP_PKEY *DecodePemWithNewDecoder(const string &pem, int selection)
+{
+    EVP_PKEY *pkey = nullptr;
+    OSSL_DECODER_CTX *ctx = OSSL_DECODER_CTX_new_for_pkey(&pkey, "PEM", nullptr, nullptr, selection, nullptr, nullptr);
+    const unsigned char *data = reinterpret_cast<const unsigned char *>(pem.c_str());
+    size_t len = pem.size();
+    if ((ctx == nullptr) || (OSSL_DECODER_from_data(ctx, &data, &len) != 1)) {
+        EVP_PKEY_free(pkey);
+        pkey = nullptr;
+    }
+    OSSL_DECODER_CTX_free(ctx);
+    return pkey;
+}
+
+/* A fresh OSSL_DECODER_CTX per key, as convertPemKey did before. */
+void BenchmarkOpensslNewDecoderPem(benchmark::State &state, const char *algName)
+{
+    ImportKeys keys;
+    if (!PrepareImportKeys(algName, keys)) {
+        state.SkipWithError("Failed to prepare keys.");
+        return;
+    }
+    for (auto _ : state) {
+        EVP_PKEY *pubKey = DecodePemWithNewDecoder(keys.pubPem, EVP_PKEY_PUBLIC_KEY);
+        EVP_PKEY *priKey = DecodePemWithNewDecoder(keys.priPem, EVP_PKEY_KEYPAIR);
+        bool ok = (pubKey != nullptr) && (priKey != nullptr);
+        EVP_PKEY_free(pubKey);
+        EVP_PKEY_free(priKey);
+        if (!ok) {
+            state.SkipWithError("Decoder failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    ReleaseImportKeys(keys);
+}
+
+void ImportArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Unit(benchmark::kMicrosecond);
+}
+
+void PubKeyCacheArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgName("cache")->Arg(0)->Arg(64)->Unit(benchmark::kMicrosecond);
+}
+}
+
+#define KEY_IMPORT_BENCHMARKS(name, algName)                                                       \
+    BENCHMARK_CAPTURE(BenchmarkConvertKey, name, algName)->Apply(ImportArgs);                      \
+    BENCHMARK_CAPTURE(BenchmarkConvertPubKey, name, algName)->Apply(PubKeyCacheArgs);              \
+    BENCHMARK_CAPTURE(BenchmarkOpensslGenericDer, name, algName)->Apply(ImportArgs);               \
+    BENCHMARK_CAPTURE(BenchmarkConvertPemKey, name, algName)->Apply(ImportArgs);                   \
+    BENCHMARK_CAPTURE(BenchmarkOpensslNewDecoderPem, name, algName)->Apply(ImportArgs)
+
+KEY_IMPORT_BENCHMARKS(RSA2048, "RSA2048");
+KEY_IMPORT_BENCHMARKS(ECC256, "ECC256");
+KEY_IMPORT_BENCHMARKS(SM2_256, "SM2_256");
+KEY_IMPORT_BENCHMARKS(X25519, "X25519");
+KEY_IMPORT_BENCHMARKS(Ed25519, "Ed25519");
+KEY_IMPORT_BENCHMARKS(DH_modp2048, "DH_modp2048");
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "object_base.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t KEY_PAIRS_BATCH_SIZE = 64;
+
+void DestroyKeyPairs(vector<HcfKeyPair *> &keyPairs)
+{
+    for (auto &keyPair : keyPairs) {
+        HcfObjDestroy(keyPair);
+        keyPair = nullptr;
+    }
+}
+
+void BenchmarkGenerateKeyPair(benchmark::State &state, const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create generator.");
+        return;
+    }
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_BATCH_SIZE, nullptr);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < KEY_PAIRS_BATCH_SIZE; i++) {
+            if (generator->generateKeyPair(generator, nullptr, &keyPairs[i]) != HCF_SUCCESS) {
+                state.SkipWithError("generateKeyPair failed.");
+                break;
+            }
+        }
+        DestroyKeyPairs(keyPairs);
+    }
+    state.SetItemsProcessed(state.iterations() * KEY_PAIRS_BATCH_SIZE);
+    HcfObjDestroy(generator);
+}
+
+/* range(0) is the worker num, compare items per second against BenchmarkGenerateKeyPair to see the gain. */
+void BenchmarkGenerateKeyPairs(benchmark::State &state, const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create generator.");
+        return;
+    }
+    uint32_t workerNum = static_cast<uint32_t>(state.range(0));
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_BATCH_SIZE, nullptr);
+    for (auto _ : state) {
+        if (generator->generateKeyPairs(generator, KEY_PAIRS_BATCH_SIZE, workerNum, keyPairs.data()) !=
+            HCF_SUCCESS) {
+            state.SkipWithError("generateKeyPairs failed.");
+            break;
+        }
+        DestroyKeyPairs(keyPairs);
+    }
+    state.SetItemsProcessed(state.iterations() * KEY_PAIRS_BATCH_SIZE);
+    HcfObjDestroy(generator);
+}
+
+void KeyPairsBatchArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Unit(benchmark::kMicrosecond)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
+}
+
+#define KEY_PAIRS_BATCH_BENCHMARKS(name, algName)                                                     \
+    BENCHMARK_CAPTURE(BenchmarkGenerateKeyPair, name, algName)->Unit(benchmark::kMicrosecond);        \
+    BENCHMARK_CAPTURE(BenchmarkGenerateKeyPairs, name, algName)->Apply(KeyPairsBatchArgs)
+
+KEY_PAIRS_BATCH_BENCHMARKS(Ed25519, "Ed25519");
+KEY_PAIRS_BATCH_BENCHMARKS(X25519, "X25519");
+KEY_PAIRS_BATCH_BENCHMARKS(Ecc256, "ECC256");
+KEY_PAIRS_BATCH_BENCHMARKS(BrainPoolP256r1, "ECC_BrainPoolP256r1");
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_gcm_params.h"
+#include "detailed_hmac_params.h"
+#include "mac.h"
+#include "mbedtls/build_info.h"
+#include "mbedtls_ctx_pool.h"
+#include "md.h"
+#include "object_base.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t MBEDTLS_DATA_LEN = 4096;
+constexpr uint32_t GCM_IV_LEN = 12;
+constexpr uint32_t GCM_TAG_LEN = 16;
+constexpr uint8_t MBEDTLS_FILL_BYTE = 0x5a;
+
+#ifdef MBEDTLS_AES_ALT
+constexpr bool AES_ALT_ENABLED = true;
+#else
+constexpr bool AES_ALT_ENABLED = false;
+#endif
+#ifdef MBEDTLS_GCM_ALT
+constexpr bool GCM_ALT_ENABLED = true;
+#else
+constexpr bool GCM_ALT_ENABLED = false;
+#endif
+#ifdef MBEDTLS_SHA256_ALT
+constexpr bool SHA256_ALT_ENABLED = true;
+#else
+constexpr bool SHA256_ALT_ENABLED = false;
+#endif
+#ifdef MBEDTLS_SHA512_ALT
+constexpr bool SHA512_ALT_ENABLED = true;
+#else
+constexpr bool SHA512_ALT_ENABLED = false;
+#endif
+
+/* Reports the static arena and how much of it, and of the heap fallback, the benchmark used. */
+void SetFootprintCounters(benchmark::State &state)
+{
+    HcfMbedtlsCtxPoolStat stat = {};
+    MbedtlsCtxPoolGetStat(&stat);
+    state.counters["poolBytes"] = static_cast<double>(stat.slotSize) * stat.slotNum;
+    state.counters["slotPeak"] = stat.slotPeak;
+    state.counters["heapPeak"] = stat.heapPeak;
+    state.counters["maxRequest"] = stat.maxRequestSize;
+    state.counters["aesAlt"] = AES_ALT_ENABLED;
+    state.counters["gcmAlt"] = GCM_ALT_ENABLED;
+    state.counters["sha256Alt"] = SHA256_ALT_ENABLED;
+    state.counters["sha512Alt"] = SHA512_ALT_ENABLED;
+}
+
+HcfSymKey *GenerateSymKey(const char *algName)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    if (generator->generateSymKey(generator, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+void BenchmarkMbedtlsMd(benchmark::State &state, const char *mdName)
+{
+    HcfMd *md = nullptr;
+    if (HcfMdCreate(mdName, &md) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create md.");
+        return;
+    }
+    vector<uint8_t> data(MBEDTLS_DATA_LEN, MBEDTLS_FILL_BYTE);
+    HcfBlob input = { .data = data.data(), .len = data.size() };
+    for (auto _ : state) {
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        if ((md->update(md, &input) != HCF_SUCCESS) || (md->doFinal(md, &out) != HCF_SUCCESS)) {
+            state.SkipWithError("digest failed.");
+            break;
+        }
+        HcfBlobDataFree(&out);
+    }
+    state.SetBytesProcessed(state.iterations() * MBEDTLS_DATA_LEN);
+    HcfObjDestroy(md);
+    SetFootprintCounters(state);
+}
+
+void BenchmarkMbedtlsHmac(benchmark::State &state, const char *mdName)
+{
+    HcfSymKey *key = GenerateSymKey("HMAC|SHA256");
+    HcfHmacParamsSpec params = {};
+    params.base.algName = "HMAC";
+    params.mdName = mdName;
+    HcfMac *mac = nullptr;
+    if ((key == nullptr) || (HcfMacCreate(reinterpret_cast<HcfMacParamsSpec *>(&params), &mac) != HCF_SUCCESS) ||
+        (mac->init(mac, key) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to prepare mac.");
+        HcfObjDestroy(mac);
+        HcfObjDestroy(key);
+        return;
+    }
+    vector<uint8_t> data(MBEDTLS_DATA_LEN, MBEDTLS_FILL_BYTE);
+    HcfBlob input = { .data = data.data(), .len = data.size() };
+    for (auto _ : state) {
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        if ((mac->update(mac, &input) != HCF_SUCCESS) || (mac->doFinal(mac, &out) != HCF_SUCCESS)) {
+            state.SkipWithError("mac failed.");
+            break;
+        }
+        HcfBlobDataFree(&out);
+    }
+    state.SetBytesProcessed(state.iterations() * MBEDTLS_DATA_LEN);
+    HcfObjDestroy(mac);
+    HcfObjDestroy(key);
+    SetFootprintCounters(state);
+}
+
+void BenchmarkMbedtlsAesGcm(benchmark::State &state)
+{
+    HcfSymKey *key = GenerateSymKey("AES256");
+    HcfCipher *cipher = nullptr;
+    if ((key == nullptr) || (HcfCipherCreate("AES256|GCM|NoPadding", &cipher) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to prepare cipher.");
+        HcfObjDestroy(key);
+        return;
+    }
+    uint8_t iv[GCM_IV_LEN] = { 0 };
+    uint8_t tag[GCM_TAG_LEN] = { 0 };
+    HcfGcmParamsSpec spec = {};
+    spec.iv = { .data = iv, .len = sizeof(iv) };
+    spec.aad = { .data = nullptr, .len = 0 };
+    spec.tag = { .data = tag, .len = sizeof(tag) };
+    vector<uint8_t> data(MBEDTLS_DATA_LEN, MBEDTLS_FILL_BYTE);
+    HcfBlob input = { .data = data.data(), .len = data.size() };
+    for (auto _ : state) {
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        if ((cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key), &spec.base) != HCF_SUCCESS) ||
+            (cipher->doFinal(cipher, &input, &out) != HCF_SUCCESS)) {
+            state.SkipWithError("encrypt failed.");
+            break;
+        }
+        HcfBlobDataFree(&out);
+    }
+    state.SetBytesProcessed(state.iterations() * MBEDTLS_DATA_LEN);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+    SetFootprintCounters(state);
+}
+
+/* Creating and destroying the object is where the context pool replaces the heap. */
+void BenchmarkMbedtlsMdCreate(benchmark::State &state)
+{
+    for (auto _ : state) {
+        HcfMd *md = nullptr;
+        if (HcfMdCreate("SHA256", &md) != HCF_SUCCESS) {
+            state.SkipWithError("Failed to create md.");
+            break;
+        }
+        HcfObjDestroy(md);
+    }
+    SetFootprintCounters(state);
+}
+}
+
+BENCHMARK_CAPTURE(BenchmarkMbedtlsMd, Sha256, "SHA256")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BenchmarkMbedtlsMd, Sha512, "SHA512")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BenchmarkMbedtlsHmac, Sha256, "SHA256")->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkMbedtlsAesGcm)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkMbedtlsMdCreate);
+
+BENCHMARK_MAIN();
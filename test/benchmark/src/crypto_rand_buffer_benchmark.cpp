@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Small request random throughput per thread count. Requests up to HCF_RAND_BUFFER_MAX_REQUEST_LEN are served from
+ * a per-thread buffer, the OpenSSL rows call RAND_priv_bytes for every request and show what the buffer saves.
+ */
+
+#include <benchmark/benchmark.h>
+#include <openssl/rand.h>
+#include <vector>
+
+#include "blob.h"
+#include "object_base.h"
+#include "rand.h"
+
+using namespace std;
+
+namespace {
+void BenchmarkGenerateRandom(benchmark::State &state)
+{
+    int32_t len = static_cast<int32_t>(state.range(0));
+    HcfRand *randObj = nullptr;
+    if (HcfRandCreate(&randObj) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to create rand.");
+        return;
+    }
+    for (auto _ : state) {
+        HcfBlob random = { .data = nullptr, .len = 0 };
+        if (randObj->generateRandom(randObj, len, &random) != HCF_SUCCESS) {
+            state.SkipWithError("generateRandom failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(random.data);
+        HcfBlobDataClearAndFree(&random);
+    }
+    state.SetItemsProcessed(state.iterations());
+    HcfObjDestroy(randObj);
+}
+
+void BenchmarkOpensslRandPrivBytes(benchmark::State &state)
+{
+    vector<uint8_t> out(state.range(0));
+    for (auto _ : state) {
+        if (RAND_priv_bytes(out.data(), static_cast<int>(out.size())) != 1) {
+            state.SkipWithError("RAND_priv_bytes failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/* range(0) is the request size, the last one is above the buffered limit. */
+void RandSizeArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgName("bytes")->Arg(4)->Arg(16)->Arg(32)->Arg(128)->Unit(benchmark::kNanosecond)->UseRealTime();
+    bench->Threads(1)->Threads(2)->Threads(4)->Threads(8);
+}
+}
+
+BENCHMARK(BenchmarkGenerateRandom)->Apply(RandSizeArgs);
+BENCHMARK(BenchmarkOpensslRandPrivBytes)->Apply(RandSizeArgs);
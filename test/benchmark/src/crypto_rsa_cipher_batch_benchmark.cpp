@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "cipher.h"
+#include "object_base.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t RSA_BATCH_SIZE = 64;
+constexpr uint32_t RSA_KEY_LEN = 32;
+constexpr uint8_t RSA_FILL_BYTE = 0x5a;
+constexpr const char *RSA_KEY_ALG_NAME = "RSA2048|PRIMES_2";
+constexpr const char *RSA_OAEP_ALG_NAME = "RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256";
+
+struct RsaBenchmarkEnv {
+    HcfKeyPair *keyPair = nullptr;
+    HcfCipher *cipher = nullptr;
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    vector<HcfBlob> ciphertexts;
+};
+
+void ReleaseRsaBenchmarkEnv(RsaBenchmarkEnv &env)
+{
+    HcfBlobDataFree(&env.arena);
+    HcfObjDestroy(env.cipher);
+    HcfObjDestroy(env.keyPair);
+    env = RsaBenchmarkEnv();
+}
+
+// Wraps RSA_BATCH_SIZE keys and leaves the cipher initialized for unwrapping them.
+bool PrepareRsaBenchmarkEnv(RsaBenchmarkEnv &env)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(RSA_KEY_ALG_NAME, &generator) != HCF_SUCCESS) {
+        return false;
+    }
+    HcfResult res = generator->generateKeyPair(generator, nullptr, &env.keyPair);
+    HcfObjDestroy(generator);
+    vector<uint8_t> key(RSA_KEY_LEN, RSA_FILL_BYTE);
+    vector<HcfBlob> keys(RSA_BATCH_SIZE, HcfBlob { .data = key.data(), .len = key.size() });
+    env.ciphertexts.resize(RSA_BATCH_SIZE);
+    if ((res != HCF_SUCCESS) || (HcfCipherCreate(RSA_OAEP_ALG_NAME, &env.cipher) != HCF_SUCCESS) ||
+        (env.cipher->init(env.cipher, ENCRYPT_MODE, (HcfKey *)env.keyPair->pubKey, nullptr) != HCF_SUCCESS) ||
+        (env.cipher->doFinalBatch(env.cipher, keys.data(), RSA_BATCH_SIZE, 0, &env.arena,
+            env.ciphertexts.data()) != HCF_SUCCESS) ||
+        (env.cipher->init(env.cipher, DECRYPT_MODE, (HcfKey *)env.keyPair->priKey, nullptr) != HCF_SUCCESS)) {
+        ReleaseRsaBenchmarkEnv(env);
+        return false;
+    }
+    return true;
+}
+
+/* range(0) tells whether init is called before every doFinal, which used to prepare the key again each time. */
+void BenchmarkRsaDecrypt(benchmark::State &state)
+{
+    RsaBenchmarkEnv env;
+    if (!PrepareRsaBenchmarkEnv(env)) {
+        state.SkipWithError("Failed to prepare cipher.");
+        return;
+    }
+    bool initPerMessage = (state.range(0) != 0);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < RSA_BATCH_SIZE; i++) {
+            if (initPerMessage &&
+                (env.cipher->init(env.cipher, DECRYPT_MODE, (HcfKey *)env.keyPair->priKey, nullptr) != HCF_SUCCESS)) {
+                state.SkipWithError("init failed.");
+                break;
+            }
+            HcfBlob out = { .data = nullptr, .len = 0 };
+            if (env.cipher->doFinal(env.cipher, &env.ciphertexts[i], &out) != HCF_SUCCESS) {
+                state.SkipWithError("doFinal failed.");
+                break;
+            }
+            HcfBlobDataFree(&out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * RSA_BATCH_SIZE);
+    ReleaseRsaBenchmarkEnv(env);
+}
+
+/* range(0) is the worker num, compare items per second against BenchmarkRsaDecrypt to see the scaling. */
+void BenchmarkRsaDecryptBatch(benchmark::State &state)
+{
+    RsaBenchmarkEnv env;
+    if (!PrepareRsaBenchmarkEnv(env)) {
+        state.SkipWithError("Failed to prepare cipher.");
+        return;
+    }
+    uint32_t workerNum = static_cast<uint32_t>(state.range(0));
+    vector<HcfBlob> plaintexts(RSA_BATCH_SIZE);
+    for (auto _ : state) {
+        HcfBlob arena = { .data = nullptr, .len = 0 };
+        if (env.cipher->doFinalBatch(env.cipher, env.ciphertexts.data(), RSA_BATCH_SIZE, workerNum, &arena,
+            plaintexts.data()) != HCF_SUCCESS) {
+            state.SkipWithError("doFinalBatch failed.");
+            break;
+        }
+        HcfBlobDataFree(&arena);
+    }
+    state.SetItemsProcessed(state.iterations() * RSA_BATCH_SIZE);
+    ReleaseRsaBenchmarkEnv(env);
+}
+}
+
+BENCHMARK(BenchmarkRsaDecrypt)->Unit(benchmark::kMicrosecond)->Arg(0)->Arg(1);
+BENCHMARK(BenchmarkRsaDecryptBatch)->Unit(benchmark::kMicrosecond)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
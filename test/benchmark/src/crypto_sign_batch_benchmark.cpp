@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "object_base.h"
+#include "signature.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t SIGN_BATCH_SIZE = 64;
+constexpr uint32_t SIGN_MESSAGE_LEN = 256;
+constexpr uint8_t SIGN_FILL_BYTE = 0x5a;
+
+struct SignAlgName {
+    const char *keyGenName;
+    const char *signName;
+};
+
+struct SignBenchmarkEnv {
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *keyPair = nullptr;
+    HcfSign *sign = nullptr;
+};
+
+void ReleaseSignBenchmarkEnv(SignBenchmarkEnv &env)
+{
+    HcfObjDestroy(env.sign);
+    HcfObjDestroy(env.keyPair);
+    HcfObjDestroy(env.generator);
+    env = SignBenchmarkEnv();
+}
+
+bool PrepareSignBenchmarkEnv(const SignAlgName &algName, SignBenchmarkEnv &env)
+{
+    if ((HcfAsyKeyGeneratorCreate(algName.keyGenName, &env.generator) != HCF_SUCCESS) ||
+        (env.generator->generateKeyPair(env.generator, nullptr, &env.keyPair) != HCF_SUCCESS) ||
+        (HcfSignCreate(algName.signName, &env.sign) != HCF_SUCCESS) ||
+        (env.sign->init(env.sign, nullptr, env.keyPair->priKey) != HCF_SUCCESS)) {
+        ReleaseSignBenchmarkEnv(env);
+        return false;
+    }
+    return true;
+}
+
+void BenchmarkSign(benchmark::State &state, SignAlgName algName)
+{
+    SignBenchmarkEnv env;
+    if (!PrepareSignBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare sign.");
+        return;
+    }
+    vector<uint8_t> message(SIGN_MESSAGE_LEN, SIGN_FILL_BYTE);
+    HcfBlob input = { .data = message.data(), .len = message.size() };
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < SIGN_BATCH_SIZE; i++) {
+            HcfBlob signature = { .data = nullptr, .len = 0 };
+            if (env.sign->sign(env.sign, &input, &signature) != HCF_SUCCESS) {
+                state.SkipWithError("sign failed.");
+                break;
+            }
+            HcfBlobDataFree(&signature);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SIGN_BATCH_SIZE);
+    ReleaseSignBenchmarkEnv(env);
+}
+
+/* range(0) is the worker num, compare items per second against BenchmarkSign to see the scaling. */
+void BenchmarkSignBatch(benchmark::State &state, SignAlgName algName)
+{
+    SignBenchmarkEnv env;
+    if (!PrepareSignBenchmarkEnv(algName, env)) {
+        state.SkipWithError("Failed to prepare sign.");
+        return;
+    }
+    uint32_t workerNum = static_cast<uint32_t>(state.range(0));
+    vector<uint8_t> message(SIGN_MESSAGE_LEN, SIGN_FILL_BYTE);
+    vector<HcfBlob> inputs(SIGN_BATCH_SIZE, HcfBlob { .data = message.data(), .len = message.size() });
+    vector<HcfBlob> signatures(SIGN_BATCH_SIZE);
+    for (auto _ : state) {
+        HcfBlob arena = { .data = nullptr, .len = 0 };
+        if (env.sign->signBatch(env.sign, inputs.data(), SIGN_BATCH_SIZE, workerNum, &arena, signatures.data()) !=
+            HCF_SUCCESS) {
+            state.SkipWithError("signBatch failed.");
+            break;
+        }
+        HcfBlobDataFree(&arena);
+    }
+    state.SetItemsProcessed(state.iterations() * SIGN_BATCH_SIZE);
+    ReleaseSignBenchmarkEnv(env);
+}
+
+void SignBatchArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->Unit(benchmark::kMicrosecond)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+}
+}
+
+#define SIGN_BATCH_BENCHMARKS(name, algName)                                               \
+    BENCHMARK_CAPTURE(BenchmarkSign, name, algName)->Unit(benchmark::kMicrosecond);        \
+    BENCHMARK_CAPTURE(BenchmarkSignBatch, name, algName)->Apply(SignBatchArgs)
+
+SIGN_BATCH_BENCHMARKS(Ecc256, (SignAlgName { "ECC256", "ECC256|SHA256" }));
+SIGN_BATCH_BENCHMARKS(Sm2, (SignAlgName { "SM2_256", "SM2_256|SM3" }));
+SIGN_BATCH_BENCHMARKS(Ed25519, (SignAlgName { "Ed25519", "Ed25519" }));
+SIGN_BATCH_BENCHMARKS(Rsa2048Pss, (SignAlgName { "RSA2048", "RSA2048|PSS|SHA256|MGF1_SHA256" }));
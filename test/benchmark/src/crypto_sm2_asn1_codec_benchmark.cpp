@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "blob.h"
+#include "sm2_asn1_codec.h"
+#include "sm2_crypto_params.h"
+#include "sm2_crypto_util.h"
+#include "sm2_ec_signature_data.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t SM2_BATCH_SIZE = 64;
+constexpr size_t SM2_RAW_C1_LEN = 1 + 2 * HCF_SM2_COORDINATE_LEN;
+constexpr uint8_t SM2_FILL_BYTE = 0x5a;
+
+vector<uint8_t> MakeRawCipherText(size_t plainLen)
+{
+    vector<uint8_t> raw(SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + plainLen, SM2_FILL_BYTE);
+    raw[0] = 0x04;
+    return raw;
+}
+
+bool MakeDerCipherText(size_t plainLen, vector<uint8_t> &der)
+{
+    vector<uint8_t> raw = MakeRawCipherText(plainLen);
+    HcfBlob input = { .data = raw.data(), .len = raw.size() };
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    if (HcfSm2CipherTextRawToAsn1(&input, nullptr, &output) != HCF_SUCCESS) {
+        return false;
+    }
+    der.resize(output.len);
+    output.data = der.data();
+    return HcfSm2CipherTextRawToAsn1(&input, nullptr, &output) == HCF_SUCCESS;
+}
+
+/* The decode and re-encode through Sm2CipherTextSpec the gateways use today. */
+void BenchmarkCipherTextSpecRoundTrip(benchmark::State &state)
+{
+    vector<uint8_t> der;
+    if (!MakeDerCipherText(static_cast<size_t>(state.range(0)), der)) {
+        state.SkipWithError("Failed to prepare ciphertext.");
+        return;
+    }
+    HcfBlob input = { .data = der.data(), .len = der.size() };
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < SM2_BATCH_SIZE; i++) {
+            Sm2CipherTextSpec *spec = nullptr;
+            HcfBlob output = { .data = nullptr, .len = 0 };
+            if ((HcfGetCipherTextSpec(&input, "C1C3C2", &spec) != HCF_SUCCESS) ||
+                (HcfGenCipherTextBySpec(spec, "C1C3C2", &output) != HCF_SUCCESS)) {
+                DestroySm2CipherTextSpec(spec);
+                state.SkipWithError("Spec round trip failed.");
+                break;
+            }
+            DestroySm2CipherTextSpec(spec);
+            HcfBlobDataFree(&output);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SM2_BATCH_SIZE);
+}
+
+void BenchmarkCipherTextCodecRoundTrip(benchmark::State &state)
+{
+    vector<uint8_t> der;
+    if (!MakeDerCipherText(static_cast<size_t>(state.range(0)), der)) {
+        state.SkipWithError("Failed to prepare ciphertext.");
+        return;
+    }
+    vector<HcfBlob> inputs(SM2_BATCH_SIZE, HcfBlob { .data = der.data(), .len = der.size() });
+    vector<HcfBlob> raws(SM2_BATCH_SIZE);
+    vector<HcfBlob> ders(SM2_BATCH_SIZE);
+    vector<uint8_t> rawArena(SM2_BATCH_SIZE * (SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + state.range(0)));
+    vector<uint8_t> derArena(SM2_BATCH_SIZE * der.size());
+    for (auto _ : state) {
+        HcfBlob rawBlob = { .data = rawArena.data(), .len = rawArena.size() };
+        HcfBlob derBlob = { .data = derArena.data(), .len = derArena.size() };
+        if ((HcfSm2CipherTextAsn1ToRawBatch(inputs.data(), SM2_BATCH_SIZE, nullptr, &rawBlob, raws.data()) !=
+            HCF_SUCCESS) ||
+            (HcfSm2CipherTextRawToAsn1Batch(raws.data(), SM2_BATCH_SIZE, nullptr, &derBlob, ders.data()) !=
+            HCF_SUCCESS)) {
+            state.SkipWithError("Codec round trip failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(derArena.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SM2_BATCH_SIZE);
+}
+
+void BenchmarkSignatureSpecRoundTrip(benchmark::State &state)
+{
+    vector<uint8_t> raw(HCF_SM2_RAW_SIGNATURE_LEN, SM2_FILL_BYTE);
+    vector<uint8_t> der(HCF_SM2_RAW_SIGNATURE_LEN + 8);
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    HcfBlob derBlob = { .data = der.data(), .len = der.size() };
+    if (HcfSm2SignatureRawToDer(&rawBlob, &derBlob) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to prepare signature.");
+        return;
+    }
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < SM2_BATCH_SIZE; i++) {
+            Sm2EcSignatureDataSpec *spec = nullptr;
+            HcfBlob output = { .data = nullptr, .len = 0 };
+            if ((HcfGenEcSignatureSpecByData(&derBlob, &spec) != HCF_SUCCESS) ||
+                (HcfGenEcSignatureDataBySpec(spec, &output) != HCF_SUCCESS)) {
+                DestroySm2EcSignatureSpec(spec);
+                state.SkipWithError("Spec round trip failed.");
+                break;
+            }
+            DestroySm2EcSignatureSpec(spec);
+            HcfBlobDataFree(&output);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SM2_BATCH_SIZE);
+}
+
+void BenchmarkSignatureCodecRoundTrip(benchmark::State &state)
+{
+    vector<uint8_t> raw(HCF_SM2_RAW_SIGNATURE_LEN, SM2_FILL_BYTE);
+    vector<uint8_t> der(HCF_SM2_RAW_SIGNATURE_LEN + 8);
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    HcfBlob derBlob = { .data = der.data(), .len = der.size() };
+    if (HcfSm2SignatureRawToDer(&rawBlob, &derBlob) != HCF_SUCCESS) {
+        state.SkipWithError("Failed to prepare signature.");
+        return;
+    }
+    vector<HcfBlob> inputs(SM2_BATCH_SIZE, derBlob);
+    vector<HcfBlob> raws(SM2_BATCH_SIZE);
+    vector<HcfBlob> ders(SM2_BATCH_SIZE);
+    vector<uint8_t> rawArena(SM2_BATCH_SIZE * HCF_SM2_RAW_SIGNATURE_LEN);
+    vector<uint8_t> derArena(SM2_BATCH_SIZE * derBlob.len);
+    for (auto _ : state) {
+        HcfBlob rawOut = { .data = rawArena.data(), .len = rawArena.size() };
+        HcfBlob derOut = { .data = derArena.data(), .len = derArena.size() };
+        if ((HcfSm2SignatureDerToRawBatch(inputs.data(), SM2_BATCH_SIZE, &rawOut, raws.data()) != HCF_SUCCESS) ||
+            (HcfSm2SignatureRawToDerBatch(raws.data(), SM2_BATCH_SIZE, &derOut, ders.data()) != HCF_SUCCESS)) {
+            state.SkipWithError("Codec round trip failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(derArena.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SM2_BATCH_SIZE);
+}
+}
+
+BENCHMARK(BenchmarkCipherTextSpecRoundTrip)->Unit(benchmark::kMicrosecond)->Arg(32)->Arg(1024);
+BENCHMARK(BenchmarkCipherTextCodecRoundTrip)->Unit(benchmark::kMicrosecond)->Arg(32)->Arg(1024);
+BENCHMARK(BenchmarkSignatureSpecRoundTrip)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BenchmarkSignatureCodecRoundTrip)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <openssl/evp.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_gcm_params.h"
+#include "detailed_iv_params.h"
+#include "object_base.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+
+namespace {
+constexpr uint32_t BENCHMARK_SM4_KEY_LEN = 16;
+constexpr uint32_t BENCHMARK_SM4_IV_LEN = 16;
+constexpr uint32_t BENCHMARK_GCM_IV_LEN = 12;
+constexpr uint32_t BENCHMARK_GCM_TAG_LEN = 16;
+constexpr uint32_t BENCHMARK_GCM_AAD_LEN = 16;
+constexpr uint32_t BENCHMARK_OUT_EXTRA_LEN = 32;
+constexpr uint8_t BENCHMARK_FILL_BYTE = 0x5a;
+const uint8_t g_benchmarkKey[BENCHMARK_SM4_KEY_LEN] = { 0 };
+uint8_t g_benchmarkIv[BENCHMARK_SM4_IV_LEN] = { 0 };
+uint8_t g_benchmarkAad[BENCHMARK_GCM_AAD_LEN] = { 0 };
+uint8_t g_benchmarkTag[BENCHMARK_GCM_TAG_LEN] = { 0 };
+
+HcfSymKey *ConvertKey(void)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate("SM4_128", &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfBlob keyBlob = { .data = const_cast<uint8_t *>(g_benchmarkKey), .len = BENCHMARK_SM4_KEY_LEN };
+    if (generator->convertSymKey(generator, &keyBlob, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+/* range(0) is the message size in bytes. The framework picks the SIMD engine whenever the CPU has one. */
+void BenchmarkSm4Framework(benchmark::State &state, const char *cipherAlg)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    HcfSymKey *key = ConvertKey();
+    HcfCipher *cipher = nullptr;
+    if ((key == nullptr) || (HcfCipherCreate(cipherAlg, &cipher) != HCF_SUCCESS)) {
+        state.SkipWithError("Failed to create cipher.");
+        HcfObjDestroy(key);
+        return;
+    }
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = g_benchmarkIv;
+    ivSpec.iv.len = BENCHMARK_SM4_IV_LEN;
+    HcfGcmParamsSpec gcmSpec = {};
+    gcmSpec.iv.data = g_benchmarkIv;
+    gcmSpec.iv.len = BENCHMARK_GCM_IV_LEN;
+    gcmSpec.aad.data = g_benchmarkAad;
+    gcmSpec.aad.len = BENCHMARK_GCM_AAD_LEN;
+    gcmSpec.tag.data = g_benchmarkTag;
+    gcmSpec.tag.len = BENCHMARK_GCM_TAG_LEN;
+    HcfParamsSpec *params = (strstr(cipherAlg, "GCM") != nullptr) ? reinterpret_cast<HcfParamsSpec *>(&gcmSpec) :
+        reinterpret_cast<HcfParamsSpec *>(&ivSpec);
+    vector<uint8_t> plain(dataLen, BENCHMARK_FILL_BYTE);
+    HcfBlob input = { .data = plain.data(), .len = dataLen };
+    for (auto _ : state) {
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        if ((cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key), params) != HCF_SUCCESS) ||
+            (cipher->doFinal(cipher, &input, &output) != HCF_SUCCESS)) {
+            state.SkipWithError("Cipher operation failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.data);
+        HcfBlobDataFree(&output);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+/* The engine the framework used before, OpenSSL's SM4 driven directly with the same message layout. */
+void BenchmarkSm4Openssl(benchmark::State &state, const char *cipherName)
+{
+    uint32_t dataLen = static_cast<uint32_t>(state.range(0));
+    EVP_CIPHER *evpCipher = EVP_CIPHER_fetch(nullptr, cipherName, nullptr);
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    if ((evpCipher == nullptr) || (ctx == nullptr)) {
+        state.SkipWithError("Cipher is not available in this OpenSSL.");
+        EVP_CIPHER_CTX_free(ctx);
+        EVP_CIPHER_free(evpCipher);
+        return;
+    }
+    bool isGcm = (EVP_CIPHER_get_mode(evpCipher) == EVP_CIPH_GCM_MODE);
+    vector<uint8_t> plain(dataLen, BENCHMARK_FILL_BYTE);
+    vector<uint8_t> out(dataLen + BENCHMARK_OUT_EXTRA_LEN);
+    for (auto _ : state) {
+        int len = 0;
+        int finalLen = 0;
+        bool ok = (EVP_EncryptInit_ex(ctx, evpCipher, nullptr, g_benchmarkKey, g_benchmarkIv) == 1);
+        if (ok && isGcm) {
+            ok = (EVP_EncryptUpdate(ctx, nullptr, &len, g_benchmarkAad, BENCHMARK_GCM_AAD_LEN) == 1);
+        }
+        ok = ok && (EVP_EncryptUpdate(ctx, out.data(), &len, plain.data(), dataLen) == 1) &&
+            (EVP_EncryptFinal_ex(ctx, out.data() + len, &finalLen) == 1);
+        if (ok && isGcm) {
+            ok = (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, BENCHMARK_GCM_TAG_LEN, g_benchmarkTag) == 1);
+        }
+        if (!ok) {
+            state.SkipWithError("Cipher operation failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(dataLen));
+    EVP_CIPHER_CTX_free(ctx);
+    EVP_CIPHER_free(evpCipher);
+}
+
+void Sm4SizeArgs(benchmark::internal::Benchmark *bench)
+{
+    bench->ArgName("bytes")->Arg(64)->Arg(1024)->Arg(16 * 1024)->Arg(1024 * 1024)->Unit(benchmark::kMicrosecond);
+}
+}
+
+BENCHMARK_CAPTURE(BenchmarkSm4Framework, ECB, "SM4_128|ECB|NoPadding")->Apply(Sm4SizeArgs);
+BENCHMARK_CAPTURE(BenchmarkSm4Openssl, ECB, "SM4-ECB")->Apply(Sm4SizeArgs);
+BENCHMARK_CAPTURE(BenchmarkSm4Framework, CTR, "SM4_128|CTR|NoPadding")->Apply(Sm4SizeArgs);
+BENCHMARK_CAPTURE(BenchmarkSm4Openssl, CTR, "SM4-CTR")->Apply(Sm4SizeArgs);
+BENCHMARK_CAPTURE(BenchmarkSm4Framework, GCM, "SM4_128|GCM|NoPadding")->Apply(Sm4SizeArgs);
+BENCHMARK_CAPTURE(BenchmarkSm4Openssl, GCM, "SM4-GCM")->Apply(Sm4SizeArgs);
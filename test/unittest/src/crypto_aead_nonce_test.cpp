@@ -0,0 +1,389 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_aead_params.h"
+#include "detailed_gcm_params.h"
+#include "memory.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoAeadNonceTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+constexpr uint32_t NONCE_LEN = HCF_AEAD_NONCE_LEN;
+constexpr uint32_t FIXED_FIELD_LEN = HCF_AEAD_NONCE_FIXED_FIELD_LEN;
+constexpr uint32_t TAG_LEN = 16;
+constexpr uint32_t CCM_TAG_LEN = 12;
+constexpr uint32_t RECORD_NUM = 4;
+const uint8_t g_plainText[] = "aead nonce test plain text";
+const uint32_t g_plainLen = sizeof(g_plainText) - 1;
+
+static const char *GetAeadParamsSpecType(void)
+{
+    return "AeadParamsSpec";
+}
+
+static HcfSymKey *GenerateSymKey(const char *algName)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    if (generator->generateSymKey(generator, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+static HcfCipher *CreateNonceCipher(const char *cipherName, HcfAeadNonceMode mode)
+{
+    HcfCipher *cipher = nullptr;
+    if (HcfCipherCreate(cipherName, &cipher) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    if (cipher->setCipherSpecInt(cipher, CIPHER_AEAD_NONCE_MODE_INT, mode) != HCF_SUCCESS) {
+        HcfObjDestroy(cipher);
+        return nullptr;
+    }
+    return cipher;
+}
+
+/* Encrypts one record, which is nonce || ciphertext || tag. */
+static HcfResult EncryptRecord(HcfCipher *cipher, HcfSymKey *key, HcfParamsSpec *params, vector<uint8_t> &record)
+{
+    HcfResult ret = cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key), params);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    HcfBlob input = { .data = const_cast<uint8_t *>(g_plainText), .len = g_plainLen };
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    ret = cipher->doFinal(cipher, &input, &output);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    record.assign(output.data, output.data + output.len);
+    HcfBlobDataFree(&output);
+    return HCF_SUCCESS;
+}
+
+/* Decrypts a record with the nonce passed in AeadParamsSpec, as a receiver does. */
+static HcfResult DecryptRecord(const char *cipherName, HcfSymKey *key, const vector<uint8_t> &record,
+    vector<uint8_t> &plain, uint32_t tagLen = TAG_LEN)
+{
+    if (record.size() < NONCE_LEN + tagLen) {
+        return HCF_INVALID_PARAMS;
+    }
+    HcfCipher *cipher = nullptr;
+    HcfResult ret = HcfCipherCreate(cipherName, &cipher);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    HcfAeadParamsSpec spec = {};
+    spec.base.getType = GetAeadParamsSpecType;
+    spec.nonce.data = const_cast<uint8_t *>(record.data());
+    spec.nonce.len = NONCE_LEN;
+    spec.tagLen = static_cast<int32_t>(tagLen);
+    ret = cipher->init(cipher, DECRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+        reinterpret_cast<HcfParamsSpec *>(&spec));
+    if (ret == HCF_SUCCESS) {
+        HcfBlob input = { .data = const_cast<uint8_t *>(record.data()) + NONCE_LEN,
+            .len = record.size() - NONCE_LEN };
+        HcfBlob output = { .data = nullptr, .len = 0 };
+        ret = cipher->doFinal(cipher, &input, &output);
+        if (ret == HCF_SUCCESS) {
+            plain.assign(output.data, output.data + output.len);
+        }
+        HcfBlobDataFree(&output);
+    }
+    HcfObjDestroy(cipher);
+    return ret;
+}
+
+static uint64_t GetInvocation(const vector<uint8_t> &record)
+{
+    uint64_t invocation = 0;
+    for (uint32_t i = FIXED_FIELD_LEN; i < NONCE_LEN; i++) {
+        invocation = (invocation << 8) | record[i];
+    }
+    return invocation;
+}
+
+static void CheckCounterRecords(const char *keyName, const char *cipherName, uint32_t tagLen)
+{
+    HcfSymKey *key = GenerateSymKey(keyName);
+    ASSERT_NE(key, nullptr);
+    HcfCipher *cipher = CreateNonceCipher(cipherName, HCF_AEAD_NONCE_COUNTER);
+    ASSERT_NE(cipher, nullptr);
+    vector<uint8_t> records[RECORD_NUM];
+    for (uint32_t i = 0; i < RECORD_NUM; i++) {
+        ASSERT_EQ(EncryptRecord(cipher, key, nullptr, records[i]), HCF_SUCCESS);
+        ASSERT_EQ(records[i].size(), NONCE_LEN + g_plainLen + tagLen);
+        // The fixed field is drawn once per key, the invocation field counts up from zero.
+        EXPECT_EQ(memcmp(records[i].data(), records[0].data(), FIXED_FIELD_LEN), 0);
+        EXPECT_EQ(GetInvocation(records[i]), i);
+        vector<uint8_t> plain;
+        ASSERT_EQ(DecryptRecord(cipherName, key, records[i], plain, tagLen), HCF_SUCCESS);
+        EXPECT_EQ(plain, vector<uint8_t>(g_plainText, g_plainText + g_plainLen));
+    }
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest001, TestSize.Level0)
+{
+    CheckCounterRecords("AES128", "AES128|GCM|NoPadding", TAG_LEN);
+    CheckCounterRecords("AES256", "AES256|CCM|NoPadding", CCM_TAG_LEN);
+    CheckCounterRecords("ChaCha20", "ChaCha20|Poly1305", TAG_LEN);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest002, TestSize.Level0)
+{
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *cipher = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_RANDOM);
+    ASSERT_NE(cipher, nullptr);
+    int32_t mode = HCF_AEAD_NONCE_EXTERNAL;
+    EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_AEAD_NONCE_MODE_INT, &mode), HCF_SUCCESS);
+    EXPECT_EQ(mode, HCF_AEAD_NONCE_RANDOM);
+
+    vector<uint8_t> first;
+    vector<uint8_t> second;
+    ASSERT_EQ(EncryptRecord(cipher, key, nullptr, first), HCF_SUCCESS);
+    ASSERT_EQ(EncryptRecord(cipher, key, nullptr, second), HCF_SUCCESS);
+    EXPECT_NE(memcmp(first.data(), second.data(), NONCE_LEN), 0);
+    vector<uint8_t> plain;
+    ASSERT_EQ(DecryptRecord("AES128|GCM|NoPadding", key, second, plain), HCF_SUCCESS);
+    EXPECT_EQ(plain, vector<uint8_t>(g_plainText, g_plainText + g_plainLen));
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest003, TestSize.Level0)
+{
+    // The counter belongs to the key, two ciphers sharing it never draw the same nonce.
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *first = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_COUNTER);
+    HcfCipher *second = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_COUNTER);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    vector<uint8_t> records[RECORD_NUM];
+    for (uint32_t i = 0; i < RECORD_NUM; i++) {
+        HcfCipher *cipher = (i % 2 == 0) ? first : second;
+        ASSERT_EQ(EncryptRecord(cipher, key, nullptr, records[i]), HCF_SUCCESS);
+        EXPECT_EQ(GetInvocation(records[i]), i);
+    }
+
+    // A new key object starts its own counter.
+    HcfSymKey *otherKey = GenerateSymKey("AES128");
+    ASSERT_NE(otherKey, nullptr);
+    vector<uint8_t> record;
+    ASSERT_EQ(EncryptRecord(first, otherKey, nullptr, record), HCF_SUCCESS);
+    EXPECT_EQ(GetInvocation(record), 0);
+    HcfObjDestroy(first);
+    HcfObjDestroy(second);
+    HcfObjDestroy(otherKey);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest004, TestSize.Level0)
+{
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *cipher = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_COUNTER);
+    ASSERT_NE(cipher, nullptr);
+    uint8_t fixedField[FIXED_FIELD_LEN] = { 0xde, 0xad, 0xbe, 0xef };
+    HcfBlob fixedBlob = { .data = fixedField, .len = FIXED_FIELD_LEN };
+    HcfBlob shortBlob = { .data = fixedField, .len = FIXED_FIELD_LEN - 1 };
+    EXPECT_NE(cipher->setCipherSpecUint8Array(cipher, CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR, shortBlob), HCF_SUCCESS);
+    ASSERT_EQ(cipher->setCipherSpecUint8Array(cipher, CIPHER_AEAD_NONCE_FIXED_FIELD_UINT8ARR, fixedBlob), HCF_SUCCESS);
+
+    // The aad of the params is kept, they only must not carry a nonce.
+    uint8_t aad[] = { 0x01, 0x02, 0x03 };
+    HcfAeadParamsSpec spec = {};
+    spec.base.getType = GetAeadParamsSpecType;
+    spec.aad.data = aad;
+    spec.aad.len = sizeof(aad);
+    vector<uint8_t> record;
+    ASSERT_EQ(EncryptRecord(cipher, key, reinterpret_cast<HcfParamsSpec *>(&spec), record), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(record.data(), fixedField, FIXED_FIELD_LEN), 0);
+    EXPECT_EQ(GetInvocation(record), 0);
+
+    vector<uint8_t> plain;
+    EXPECT_NE(DecryptRecord("AES128|GCM|NoPadding", key, record, plain), HCF_SUCCESS);
+    HcfCipher *decipher = nullptr;
+    ASSERT_EQ(HcfCipherCreate("AES128|GCM|NoPadding", &decipher), HCF_SUCCESS);
+    spec.nonce.data = record.data();
+    spec.nonce.len = NONCE_LEN;
+    ASSERT_EQ(decipher->init(decipher, DECRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+        reinterpret_cast<HcfParamsSpec *>(&spec)), HCF_SUCCESS);
+    HcfBlob input = { .data = record.data() + NONCE_LEN, .len = record.size() - NONCE_LEN };
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(decipher->doFinal(decipher, &input, &output), HCF_SUCCESS);
+    ASSERT_EQ(output.len, g_plainLen);
+    EXPECT_EQ(memcmp(output.data, g_plainText, g_plainLen), 0);
+    HcfBlobDataFree(&output);
+    HcfObjDestroy(decipher);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest005, TestSize.Level0)
+{
+    // The nonce is only prepended to the first output of an operation.
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *cipher = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_COUNTER);
+    ASSERT_NE(cipher, nullptr);
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key), nullptr), HCF_SUCCESS);
+    HcfBlob input = { .data = const_cast<uint8_t *>(g_plainText), .len = g_plainLen };
+    HcfBlob updateOut = { .data = nullptr, .len = 0 };
+    HcfBlob finalOut = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(cipher->update(cipher, &input, &updateOut), HCF_SUCCESS);
+    ASSERT_EQ(cipher->doFinal(cipher, nullptr, &finalOut), HCF_SUCCESS);
+    EXPECT_EQ(updateOut.len, NONCE_LEN + g_plainLen);
+    EXPECT_EQ(finalOut.len, TAG_LEN);
+
+    vector<uint8_t> record(updateOut.data, updateOut.data + updateOut.len);
+    record.insert(record.end(), finalOut.data, finalOut.data + finalOut.len);
+    vector<uint8_t> plain;
+    ASSERT_EQ(DecryptRecord("AES128|GCM|NoPadding", key, record, plain), HCF_SUCCESS);
+    EXPECT_EQ(plain, vector<uint8_t>(g_plainText, g_plainText + g_plainLen));
+    HcfBlobDataFree(&updateOut);
+    HcfBlobDataFree(&finalOut);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest006, TestSize.Level0)
+{
+    // A nonce of the caller would defeat the uniqueness of the generated ones.
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *cipher = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_COUNTER);
+    ASSERT_NE(cipher, nullptr);
+    uint8_t nonce[NONCE_LEN] = { 0 };
+    uint8_t tag[TAG_LEN] = { 0 };
+    HcfAeadParamsSpec aeadSpec = {};
+    aeadSpec.base.getType = GetAeadParamsSpecType;
+    aeadSpec.nonce.data = nonce;
+    aeadSpec.nonce.len = NONCE_LEN;
+    HcfGcmParamsSpec gcmSpec = {};
+    gcmSpec.iv.data = nonce;
+    gcmSpec.iv.len = NONCE_LEN;
+    gcmSpec.tag.data = tag;
+    gcmSpec.tag.len = TAG_LEN;
+    EXPECT_EQ(cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+        reinterpret_cast<HcfParamsSpec *>(&aeadSpec)), HCF_ERR_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(cipher->init(cipher, ENCRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+        reinterpret_cast<HcfParamsSpec *>(&gcmSpec)), HCF_ERR_PARAMETER_CHECK_FAILED);
+
+    // Legacy GCM params without an iv still supply the tag length.
+    gcmSpec.iv.data = nullptr;
+    gcmSpec.iv.len = 0;
+    vector<uint8_t> record;
+    ASSERT_EQ(EncryptRecord(cipher, key, reinterpret_cast<HcfParamsSpec *>(&gcmSpec), record), HCF_SUCCESS);
+    EXPECT_EQ(record.size(), NONCE_LEN + g_plainLen + TAG_LEN);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest007, TestSize.Level0)
+{
+    // A key sticks to the first generated mode it is used with, external nonces stay allowed.
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *counter = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_COUNTER);
+    HcfCipher *random = CreateNonceCipher("AES128|GCM|NoPadding", HCF_AEAD_NONCE_RANDOM);
+    ASSERT_NE(counter, nullptr);
+    ASSERT_NE(random, nullptr);
+    vector<uint8_t> record;
+    ASSERT_EQ(EncryptRecord(counter, key, nullptr, record), HCF_SUCCESS);
+    EXPECT_EQ(EncryptRecord(random, key, nullptr, record), HCF_ERR_INVALID_CALL);
+    ASSERT_EQ(EncryptRecord(counter, key, nullptr, record), HCF_SUCCESS);
+    EXPECT_EQ(GetInvocation(record), 1);
+
+    uint8_t nonce[NONCE_LEN] = { 0 };
+    HcfAeadParamsSpec spec = {};
+    spec.base.getType = GetAeadParamsSpecType;
+    spec.nonce.data = nonce;
+    spec.nonce.len = NONCE_LEN;
+    ASSERT_EQ(counter->setCipherSpecInt(counter, CIPHER_AEAD_NONCE_MODE_INT, HCF_AEAD_NONCE_EXTERNAL), HCF_SUCCESS);
+    ASSERT_EQ(EncryptRecord(counter, key, reinterpret_cast<HcfParamsSpec *>(&spec), record), HCF_SUCCESS);
+    EXPECT_EQ(record.size(), g_plainLen + TAG_LEN);
+    HcfObjDestroy(counter);
+    HcfObjDestroy(random);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest008, TestSize.Level0)
+{
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(HcfCipherCreate("AES128|CBC|PKCS7", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_AEAD_NONCE_MODE_INT, HCF_AEAD_NONCE_COUNTER), HCF_NOT_SUPPORT);
+    HcfObjDestroy(cipher);
+    cipher = nullptr;
+    ASSERT_EQ(HcfCipherCreate("ChaCha20", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_AEAD_NONCE_MODE_INT, HCF_AEAD_NONCE_COUNTER), HCF_NOT_SUPPORT);
+    HcfObjDestroy(cipher);
+    cipher = nullptr;
+    ASSERT_EQ(HcfCipherCreate("AES128|CCM|NoPadding", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_AEAD_NONCE_MODE_INT, 3), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_AEAD_NONCE_MODE_INT, -1), HCF_INVALID_PARAMS);
+    HcfObjDestroy(cipher);
+}
+
+HWTEST_F(CryptoAeadNonceTest, CryptoAeadNonceTest009, TestSize.Level0)
+{
+    // Decryption takes the nonce from the params as before, a generated mode has no effect on it.
+    HcfSymKey *key = GenerateSymKey("ChaCha20");
+    ASSERT_NE(key, nullptr);
+    HcfCipher *cipher = CreateNonceCipher("ChaCha20|Poly1305", HCF_AEAD_NONCE_RANDOM);
+    ASSERT_NE(cipher, nullptr);
+    vector<uint8_t> record;
+    ASSERT_EQ(EncryptRecord(cipher, key, nullptr, record), HCF_SUCCESS);
+
+    HcfAeadParamsSpec spec = {};
+    spec.base.getType = GetAeadParamsSpecType;
+    spec.nonce.data = record.data();
+    spec.nonce.len = NONCE_LEN;
+    ASSERT_EQ(cipher->init(cipher, DECRYPT_MODE, reinterpret_cast<HcfKey *>(key),
+        reinterpret_cast<HcfParamsSpec *>(&spec)), HCF_SUCCESS);
+    HcfBlob input = { .data = record.data() + NONCE_LEN, .len = record.size() - NONCE_LEN };
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(cipher->doFinal(cipher, &input, &output), HCF_SUCCESS);
+    ASSERT_EQ(output.len, g_plainLen);
+    EXPECT_EQ(memcmp(output.data, g_plainText, g_plainLen), 0);
+    HcfBlobDataFree(&output);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+}
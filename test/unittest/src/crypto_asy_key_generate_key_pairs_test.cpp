@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "key_agreement.h"
+#include "memory.h"
+#include "memory_mock.h"
+#include "openssl_adapter_mock.h"
+#include "signature.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoAsyKeyGenerateKeyPairsTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+constexpr uint32_t KEY_PAIRS_TEST_COUNT = 37;
+constexpr uint32_t KEY_PAIRS_TEST_WORKER_NUM = 4;
+constexpr uint32_t KEY_PAIRS_MOCK_COUNT = 3;
+
+static const char *g_message = "generate key pairs message";
+static HcfBlob g_messageInput = {
+    .data = (uint8_t *)g_message,
+    .len = 26
+};
+
+static HcfAsyKeyGenerator *CreateGenerator(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    return generator;
+}
+
+static void DestroyKeyPairs(vector<HcfKeyPair *> &keyPairs)
+{
+    for (auto &keyPair : keyPairs) {
+        HcfObjDestroy(keyPair);
+        keyPair = nullptr;
+    }
+}
+
+static void ExpectSignAndVerify(const char *signAlgName, HcfKeyPair *keyPair)
+{
+    HcfSign *sign = nullptr;
+    ASSERT_EQ(HcfSignCreate(signAlgName, &sign), HCF_SUCCESS);
+    ASSERT_EQ(sign->init(sign, nullptr, keyPair->priKey), HCF_SUCCESS);
+    HcfBlob signature = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(sign->sign(sign, &g_messageInput, &signature), HCF_SUCCESS);
+    HcfVerify *verify = nullptr;
+    ASSERT_EQ(HcfVerifyCreate(signAlgName, &verify), HCF_SUCCESS);
+    ASSERT_EQ(verify->init(verify, nullptr, keyPair->pubKey), HCF_SUCCESS);
+    EXPECT_TRUE(verify->verify(verify, &g_messageInput, &signature));
+    HcfBlobDataFree(&signature);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+}
+
+static void ExpectDistinctPubKeys(HcfKeyPair *first, HcfKeyPair *second)
+{
+    HcfBlob firstBlob = { .data = nullptr, .len = 0 };
+    HcfBlob secondBlob = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(first->pubKey->base.getEncoded(&first->pubKey->base, &firstBlob), HCF_SUCCESS);
+    ASSERT_EQ(second->pubKey->base.getEncoded(&second->pubKey->base, &secondBlob), HCF_SUCCESS);
+    EXPECT_EQ(firstBlob.len, secondBlob.len);
+    EXPECT_NE(memcmp(firstBlob.data, secondBlob.data, firstBlob.len), 0);
+    HcfBlobDataFree(&firstBlob);
+    HcfBlobDataFree(&secondBlob);
+}
+
+static void GenerateKeyPairsSignTest(const char *keyAlgName, const char *signAlgName, uint32_t workerNum)
+{
+    HcfAsyKeyGenerator *generator = CreateGenerator(keyAlgName);
+    ASSERT_NE(generator, nullptr);
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_TEST_COUNT, nullptr);
+    HcfResult res = generator->generateKeyPairs(generator, KEY_PAIRS_TEST_COUNT, workerNum, keyPairs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    for (auto keyPair : keyPairs) {
+        ASSERT_NE(keyPair, nullptr);
+        ASSERT_NE(keyPair->pubKey, nullptr);
+        ASSERT_NE(keyPair->priKey, nullptr);
+    }
+    ExpectSignAndVerify(signAlgName, keyPairs[0]);
+    ExpectSignAndVerify(signAlgName, keyPairs[KEY_PAIRS_TEST_COUNT - 1]);
+    ExpectDistinctPubKeys(keyPairs[0], keyPairs[KEY_PAIRS_TEST_COUNT - 1]);
+
+    DestroyKeyPairs(keyPairs);
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest001, TestSize.Level0)
+{
+    GenerateKeyPairsSignTest("Ed25519", "Ed25519", 0);
+    GenerateKeyPairsSignTest("Ed25519", "Ed25519", KEY_PAIRS_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest002, TestSize.Level0)
+{
+    GenerateKeyPairsSignTest("ECC256", "ECC256|SHA256", 1);
+    GenerateKeyPairsSignTest("ECC256", "ECC256|SHA256", KEY_PAIRS_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest003, TestSize.Level0)
+{
+    GenerateKeyPairsSignTest("ECC_BrainPoolP256r1", "ECC_BrainPoolP256r1|SHA256", KEY_PAIRS_TEST_WORKER_NUM);
+}
+
+// Both sides of an X25519 exchange between two key pairs of one batch agree on the secret.
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest004, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = CreateGenerator("X25519");
+    ASSERT_NE(generator, nullptr);
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_TEST_COUNT, nullptr);
+    HcfResult res = generator->generateKeyPairs(generator, KEY_PAIRS_TEST_COUNT, KEY_PAIRS_TEST_WORKER_NUM,
+        keyPairs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfKeyAgreement *keyAgreement = nullptr;
+    ASSERT_EQ(HcfKeyAgreementCreate("X25519", &keyAgreement), HCF_SUCCESS);
+    HcfBlob secret1 = { .data = nullptr, .len = 0 };
+    HcfBlob secret2 = { .data = nullptr, .len = 0 };
+    HcfKeyPair *first = keyPairs[0];
+    HcfKeyPair *last = keyPairs[KEY_PAIRS_TEST_COUNT - 1];
+    EXPECT_EQ(keyAgreement->generateSecret(keyAgreement, first->priKey, last->pubKey, &secret1), HCF_SUCCESS);
+    EXPECT_EQ(keyAgreement->generateSecret(keyAgreement, last->priKey, first->pubKey, &secret2), HCF_SUCCESS);
+    ASSERT_EQ(secret1.len, secret2.len);
+    EXPECT_EQ(memcmp(secret1.data, secret2.data, secret1.len), 0);
+    ExpectDistinctPubKeys(first, last);
+
+    HcfBlobDataFree(&secret1);
+    HcfBlobDataFree(&secret2);
+    HcfObjDestroy(keyAgreement);
+    DestroyKeyPairs(keyPairs);
+    HcfObjDestroy(generator);
+}
+
+// Keys taken out of their key pairs outlive the pair and are destroyed on their own, in any order.
+static void DetachedKeysTest(const char *keyAlgName)
+{
+    HcfAsyKeyGenerator *generator = CreateGenerator(keyAlgName);
+    ASSERT_NE(generator, nullptr);
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_TEST_COUNT, nullptr);
+    HcfResult res = generator->generateKeyPairs(generator, KEY_PAIRS_TEST_COUNT, KEY_PAIRS_TEST_WORKER_NUM,
+        keyPairs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfObjDestroy(generator);
+    vector<HcfPubKey *> pubKeys;
+    vector<HcfPriKey *> priKeys;
+    for (auto keyPair : keyPairs) {
+        pubKeys.push_back(keyPair->pubKey);
+        priKeys.push_back(keyPair->priKey);
+        keyPair->pubKey = nullptr;
+        keyPair->priKey = nullptr;
+    }
+    DestroyKeyPairs(keyPairs);
+    for (uint32_t i = 0; i < KEY_PAIRS_TEST_COUNT; i++) {
+        HcfBlob blob = { .data = nullptr, .len = 0 };
+        EXPECT_EQ(pubKeys[i]->base.getEncoded(&pubKeys[i]->base, &blob), HCF_SUCCESS);
+        HcfBlobDataFree(&blob);
+        HcfObjDestroy(pubKeys[i]);
+    }
+    for (uint32_t i = KEY_PAIRS_TEST_COUNT; i > 0; i--) {
+        HcfPriKey *priKey = priKeys[i - 1];
+        HcfBlob blob = { .data = nullptr, .len = 0 };
+        EXPECT_EQ(priKey->base.getEncoded(&priKey->base, &blob), HCF_SUCCESS);
+        HcfBlobDataClearAndFree(&blob);
+        priKey->clearMem(priKey);
+        HcfObjDestroy(priKey);
+    }
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest005, TestSize.Level0)
+{
+    DetachedKeysTest("Ed25519");
+    DetachedKeysTest("X25519");
+    DetachedKeysTest("ECC384");
+}
+
+// A public key of the batch keeps its field type and derives like one from generateKeyPair.
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest006, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = CreateGenerator("ECC224");
+    ASSERT_NE(generator, nullptr);
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_MOCK_COUNT, nullptr);
+    HcfResult res = generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, 0, keyPairs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    char *fieldType = nullptr;
+    res = keyPairs[0]->pubKey->getAsyKeySpecString(keyPairs[0]->pubKey, ECC_FIELD_TYPE_STR, &fieldType);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_STREQ(fieldType, "Fp");
+    HcfFree(fieldType);
+    HcfPubKey *pubKey = nullptr;
+    res = keyPairs[0]->priKey->getPubKey(keyPairs[0]->priKey, &pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob derived = { .data = nullptr, .len = 0 };
+    HcfBlob generated = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(pubKey->base.getEncoded(&pubKey->base, &derived), HCF_SUCCESS);
+    EXPECT_EQ(keyPairs[0]->pubKey->base.getEncoded(&keyPairs[0]->pubKey->base, &generated), HCF_SUCCESS);
+    ASSERT_EQ(derived.len, generated.len);
+    EXPECT_EQ(memcmp(derived.data, generated.data, derived.len), 0);
+
+    HcfBlobDataFree(&derived);
+    HcfBlobDataFree(&generated);
+    HcfObjDestroy(pubKey);
+    DestroyKeyPairs(keyPairs);
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest007, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = CreateGenerator("Ed25519");
+    ASSERT_NE(generator, nullptr);
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_MOCK_COUNT, nullptr);
+    EXPECT_EQ(generator->generateKeyPairs(nullptr, KEY_PAIRS_MOCK_COUNT, 0, keyPairs.data()), HCF_INVALID_PARAMS);
+    EXPECT_EQ(generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, 0, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(generator->generateKeyPairs(generator, 0, 0, keyPairs.data()), HCF_INVALID_PARAMS);
+    EXPECT_EQ(generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, HCF_ASY_KEY_GEN_MAX_BATCH_WORKER_NUM + 1,
+        keyPairs.data()), HCF_INVALID_PARAMS);
+    EXPECT_EQ(keyPairs[0], nullptr);
+
+    // More workers than key pairs leaves no worker without a range.
+    EXPECT_EQ(generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, HCF_ASY_KEY_GEN_MAX_BATCH_WORKER_NUM,
+        keyPairs.data()), HCF_SUCCESS);
+    DestroyKeyPairs(keyPairs);
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest008, TestSize.Level0)
+{
+    const char *algNames[] = { "RSA1024", "SM2_256", "DSA1024", "DH_modp1536" };
+    for (const char *algName : algNames) {
+        HcfAsyKeyGenerator *generator = CreateGenerator(algName);
+        ASSERT_NE(generator, nullptr);
+        vector<HcfKeyPair *> keyPairs(KEY_PAIRS_MOCK_COUNT, nullptr);
+        EXPECT_EQ(generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, 0, keyPairs.data()),
+            HCF_ERR_INVALID_CALL);
+        EXPECT_EQ(keyPairs[0], nullptr);
+        HcfObjDestroy(generator);
+    }
+}
+
+// Every OpenSSL call and every allocation of the batch failing in turn must fail cleanly without key pairs.
+static void GenerateKeyPairsMockTest(const char *keyAlgName, uint32_t workerNum)
+{
+    HcfAsyKeyGenerator *generator = CreateGenerator(keyAlgName);
+    ASSERT_NE(generator, nullptr);
+    vector<HcfKeyPair *> keyPairs(KEY_PAIRS_MOCK_COUNT, nullptr);
+
+    StartRecordOpensslCallNum();
+    HcfResult res = generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, workerNum, keyPairs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    DestroyKeyPairs(keyPairs);
+    uint32_t callNum = GetOpensslCallNum();
+    for (uint32_t i = 0; i < callNum; i++) {
+        ResetOpensslCallNum();
+        SetOpensslCallMockIndex(i);
+        res = generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, workerNum, keyPairs.data());
+        if (res != HCF_SUCCESS) {
+            EXPECT_EQ(keyPairs[0], nullptr);
+            EXPECT_EQ(keyPairs[KEY_PAIRS_MOCK_COUNT - 1], nullptr);
+        }
+        DestroyKeyPairs(keyPairs);
+    }
+    EndRecordOpensslCallNum();
+
+    StartRecordMallocNum();
+    res = generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, workerNum, keyPairs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    DestroyKeyPairs(keyPairs);
+    uint32_t mallocNum = GetMallocNum();
+    for (uint32_t i = 0; i < mallocNum; i++) {
+        ResetRecordMallocNum();
+        SetMockMallocIndex(i);
+        res = generator->generateKeyPairs(generator, KEY_PAIRS_MOCK_COUNT, workerNum, keyPairs.data());
+        if (res != HCF_SUCCESS) {
+            EXPECT_EQ(keyPairs[0], nullptr);
+        }
+        DestroyKeyPairs(keyPairs);
+    }
+    EndRecordMallocNum();
+
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest009, TestSize.Level0)
+{
+    GenerateKeyPairsMockTest("Ed25519", 0);
+    GenerateKeyPairsMockTest("X25519", 0);
+}
+
+HWTEST_F(CryptoAsyKeyGenerateKeyPairsTest, CryptoAsyKeyGenerateKeyPairsTest010, TestSize.Level0)
+{
+    GenerateKeyPairsMockTest("ECC256", 0);
+    GenerateKeyPairsMockTest("ECC256", KEY_PAIRS_MOCK_COUNT);
+}
+}
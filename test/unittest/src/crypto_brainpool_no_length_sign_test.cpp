@@ -265,7 +265,7 @@ HWTEST_F(CryptoBrainPoolNoLengthSignTest, CryptoBrainPoolNoLengthSignTest012, Te
     ASSERT_EQ(res, HCF_SUCCESS);
 
     res = sign->init(sign, nullptr, keyPair->priKey);
-    ASSERT_NE(res, HCF_SUCCESS);
+    ASSERT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(sign);
     HcfObjDestroy(keyPair);
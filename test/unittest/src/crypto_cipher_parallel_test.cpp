@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "securec.h"
+
+#include "aes_common.h"
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_iv_params.h"
+#include "memory.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t TEST_IV_LEN = 16;
+constexpr uint32_t TEST_DATA_LEN = 1024 * 1024 + 4099;
+constexpr uint32_t TEST_HEAD_LEN = 5;
+constexpr uint32_t TEST_UPDATE_LEN = 700 * 1024 + 7;
+constexpr int32_t TEST_WORKER_NUM = 4;
+constexpr int32_t TEST_THRESHOLD = 128 * 1024;
+constexpr uint32_t TEST_XTS_UNIT_LEN = 4096;
+constexpr uint32_t TEST_XTS_UNIT_NUM = 96;
+constexpr uint64_t TEST_XTS_START_UNIT = 0xfffffffffffffff0;
+
+class CryptoCipherParallelTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+static vector<uint8_t> MakeData(uint32_t len)
+{
+    vector<uint8_t> data(len);
+    for (uint32_t i = 0; i < len; i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    return data;
+}
+
+static void Append(vector<uint8_t> &result, HcfBlob *out)
+{
+    if (out->data != nullptr) {
+        result.insert(result.end(), out->data, out->data + out->len);
+    }
+    HcfBlobDataClearAndFree(out);
+}
+
+/* Splits the input into a misaligned head, a large update and a large doFinal. */
+static HcfResult RunCipher(HcfCipher *cipher, enum HcfCryptoMode mode, HcfKey *key, uint8_t *iv,
+    const vector<uint8_t> &input, vector<uint8_t> &result)
+{
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = TEST_IV_LEN;
+    HcfResult ret = cipher->init(cipher, mode, key, (HcfParamsSpec *)&ivSpec);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    result.clear();
+    uint8_t *data = const_cast<uint8_t *>(input.data());
+    uint32_t lens[] = { TEST_HEAD_LEN, TEST_UPDATE_LEN };
+    uint32_t offset = 0;
+    for (uint32_t len : lens) {
+        HcfBlob in = { .data = data + offset, .len = len };
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        ret = cipher->update(cipher, &in, &out);
+        Append(result, &out);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+        offset += len;
+    }
+    HcfBlob in = { .data = data + offset, .len = input.size() - offset };
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    ret = cipher->doFinal(cipher, &in, &out);
+    Append(result, &out);
+    return ret;
+}
+
+/* Reference XTS: one init per data unit with the unit number as 128-bit little endian tweak. */
+static HcfResult RunXtsPerUnit(HcfCipher *cipher, enum HcfCryptoMode mode, HcfKey *key, uint64_t startUnit,
+    const vector<uint8_t> &input, vector<uint8_t> &result)
+{
+    result.clear();
+    for (uint32_t offset = 0; offset < input.size(); offset += TEST_XTS_UNIT_LEN) {
+        uint8_t tweak[TEST_IV_LEN] = { 0 };
+        uint64_t unit = startUnit + offset / TEST_XTS_UNIT_LEN;
+        for (uint32_t i = 0; i < sizeof(unit); i++) {
+            tweak[i] = static_cast<uint8_t>(unit >> (i * 8));
+        }
+        HcfIvParamsSpec spec = {};
+        spec.iv.data = tweak;
+        spec.iv.len = sizeof(tweak);
+        HcfResult ret = cipher->init(cipher, mode, key, (HcfParamsSpec *)&spec);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+        HcfBlob in = { .data = const_cast<uint8_t *>(input.data()) + offset, .len = TEST_XTS_UNIT_LEN };
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        ret = cipher->doFinal(cipher, &in, &out);
+        Append(result, &out);
+        if (ret != HCF_SUCCESS) {
+            return ret;
+        }
+    }
+    return HCF_SUCCESS;
+}
+
+static HcfResult RunXtsDataUnits(HcfCipher *cipher, enum HcfCryptoMode mode, HcfKey *key,
+    const vector<uint8_t> &input, vector<uint8_t> &result)
+{
+    uint8_t tweak[TEST_IV_LEN] = { 0 };
+    HcfIvParamsSpec spec = {};
+    spec.iv.data = tweak;
+    spec.iv.len = sizeof(tweak);
+    HcfResult ret = cipher->init(cipher, mode, key, (HcfParamsSpec *)&spec);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    result.clear();
+    HcfBlob in = { .data = const_cast<uint8_t *>(input.data()), .len = input.size() };
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    ret = cipher->processDataUnits(cipher, TEST_XTS_START_UNIT, TEST_XTS_UNIT_LEN, &in, &out);
+    Append(result, &out);
+    return ret;
+}
+
+static void CheckParallelMatchesSerial(const char *keyAlg, const char *cipherAlg, uint8_t *iv)
+{
+    vector<uint8_t> plain = MakeData(TEST_DATA_LEN);
+    HcfSymKey *key = nullptr;
+    HcfCipher *serial = nullptr;
+    HcfCipher *parallel = nullptr;
+    ASSERT_EQ(GenerateSymKey(keyAlg, &key), 0);
+    ASSERT_EQ(HcfCipherCreate(cipherAlg, &serial), HCF_SUCCESS);
+    ASSERT_EQ(HcfCipherCreate(cipherAlg, &parallel), HCF_SUCCESS);
+    ASSERT_EQ(parallel->setCipherSpecInt(parallel, CIPHER_PARALLEL_WORKER_NUM_INT, TEST_WORKER_NUM), HCF_SUCCESS);
+    ASSERT_EQ(parallel->setCipherSpecInt(parallel, CIPHER_PARALLEL_THRESHOLD_INT, TEST_THRESHOLD), HCF_SUCCESS);
+
+    vector<uint8_t> expect;
+    vector<uint8_t> actual;
+    EXPECT_EQ(RunCipher(serial, ENCRYPT_MODE, (HcfKey *)key, iv, plain, expect), HCF_SUCCESS);
+    EXPECT_EQ(RunCipher(parallel, ENCRYPT_MODE, (HcfKey *)key, iv, plain, actual), HCF_SUCCESS);
+    EXPECT_EQ(expect.size(), plain.size());
+    EXPECT_EQ(actual, expect);
+
+    vector<uint8_t> decrypted;
+    EXPECT_EQ(RunCipher(parallel, DECRYPT_MODE, (HcfKey *)key, iv, expect, decrypted), HCF_SUCCESS);
+    EXPECT_EQ(decrypted, plain);
+
+    HcfObjDestroy(parallel);
+    HcfObjDestroy(serial);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest001, TestSize.Level0)
+{
+    uint8_t iv[TEST_IV_LEN] = { 0 };
+    CheckParallelMatchesSerial("AES256", "AES256|CTR|NoPadding", iv);
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest002, TestSize.Level0)
+{
+    // the low 64 bits wrap inside the input, the carry has to reach the upper half of the counter
+    uint8_t iv[TEST_IV_LEN] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00 };
+    CheckParallelMatchesSerial("AES128", "AES128|CTR|NoPadding", iv);
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest003, TestSize.Level0)
+{
+    uint8_t iv[TEST_IV_LEN] = { 0x10, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c };
+    CheckParallelMatchesSerial("ChaCha20", "ChaCha20", iv);
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest004, TestSize.Level0)
+{
+    // the 32-bit block counter wraps inside the input, the parallel path falls back to serial
+    uint8_t iv[TEST_IV_LEN] = { 0xf0, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c };
+    CheckParallelMatchesSerial("ChaCha20", "ChaCha20", iv);
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest005, TestSize.Level0)
+{
+    HcfCipher *cipher = nullptr;
+    int32_t value = -1;
+    ASSERT_EQ(HcfCipherCreate("AES128|CTR|NoPadding", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, &value), HCF_SUCCESS);
+    EXPECT_EQ(value, 0);
+    EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_PARALLEL_THRESHOLD_INT, &value), HCF_SUCCESS);
+    EXPECT_EQ(value, HCF_CIPHER_PARALLEL_DEFAULT_THRESHOLD);
+
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, -1), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, 65), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_THRESHOLD_INT, 0), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, OAEP_MD_NAME_STR, 1), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->setCipherSpecInt(nullptr, CIPHER_PARALLEL_WORKER_NUM_INT, 1), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, nullptr), HCF_INVALID_PARAMS);
+
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, 8), HCF_SUCCESS);
+    EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_THRESHOLD_INT, TEST_THRESHOLD), HCF_SUCCESS);
+    EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, &value), HCF_SUCCESS);
+    EXPECT_EQ(value, 8);
+    EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_PARALLEL_THRESHOLD_INT, &value), HCF_SUCCESS);
+    EXPECT_EQ(value, TEST_THRESHOLD);
+    HcfObjDestroy(cipher);
+
+    const char *unsupported[] = {
+        "AES128|CBC|PKCS5", "AES128|GCM|NoPadding", "ChaCha20|Poly1305", "SM4_128|CTR|NoPadding"
+    };
+    for (const char *alg : unsupported) {
+        ASSERT_EQ(HcfCipherCreate(alg, &cipher), HCF_SUCCESS);
+        EXPECT_EQ(cipher->setCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, 2), HCF_NOT_SUPPORT);
+        EXPECT_EQ(cipher->getCipherSpecInt(cipher, CIPHER_PARALLEL_WORKER_NUM_INT, &value), HCF_NOT_SUPPORT);
+        HcfObjDestroy(cipher);
+    }
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest006, TestSize.Level0)
+{
+    // the unit number crosses 2^64 - 1 inside the input, the tweak stays within its low 64 bits
+    vector<uint8_t> plain = MakeData(TEST_XTS_UNIT_LEN * TEST_XTS_UNIT_NUM);
+    HcfSymKey *key = nullptr;
+    HcfCipher *serial = nullptr;
+    HcfCipher *parallel = nullptr;
+    ASSERT_EQ(GenerateSymKey("AES256", &key), 0);
+    ASSERT_EQ(HcfCipherCreate("AES128|XTS|NoPadding", &serial), HCF_SUCCESS);
+    ASSERT_EQ(HcfCipherCreate("AES128|XTS|NoPadding", &parallel), HCF_SUCCESS);
+    ASSERT_EQ(parallel->setCipherSpecInt(parallel, CIPHER_PARALLEL_WORKER_NUM_INT, TEST_WORKER_NUM), HCF_SUCCESS);
+    ASSERT_EQ(parallel->setCipherSpecInt(parallel, CIPHER_PARALLEL_THRESHOLD_INT, TEST_THRESHOLD), HCF_SUCCESS);
+
+    vector<uint8_t> expect;
+    vector<uint8_t> actual;
+    EXPECT_EQ(RunXtsPerUnit(serial, ENCRYPT_MODE, (HcfKey *)key, TEST_XTS_START_UNIT, plain, expect), HCF_SUCCESS);
+    EXPECT_EQ(expect.size(), plain.size());
+    EXPECT_EQ(RunXtsDataUnits(serial, ENCRYPT_MODE, (HcfKey *)key, plain, actual), HCF_SUCCESS);
+    EXPECT_EQ(actual, expect);
+    EXPECT_EQ(RunXtsDataUnits(parallel, ENCRYPT_MODE, (HcfKey *)key, plain, actual), HCF_SUCCESS);
+    EXPECT_EQ(actual, expect);
+
+    vector<uint8_t> decrypted;
+    EXPECT_EQ(RunXtsDataUnits(parallel, DECRYPT_MODE, (HcfKey *)key, expect, decrypted), HCF_SUCCESS);
+    EXPECT_EQ(decrypted, plain);
+
+    HcfObjDestroy(parallel);
+    HcfObjDestroy(serial);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoCipherParallelTest, CryptoCipherParallelTest007, TestSize.Level0)
+{
+    vector<uint8_t> plain = MakeData(TEST_XTS_UNIT_LEN);
+    HcfBlob in = { .data = plain.data(), .len = plain.size() };
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(GenerateSymKey("AES256", &key), 0);
+    ASSERT_EQ(HcfCipherCreate("AES128|XTS|NoPadding", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, TEST_XTS_UNIT_LEN, &in, &out), HCF_INVALID_PARAMS);
+
+    vector<uint8_t> result;
+    EXPECT_EQ(RunXtsDataUnits(cipher, ENCRYPT_MODE, (HcfKey *)key, plain, result), HCF_SUCCESS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, 8, &in, &out), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, TEST_XTS_UNIT_LEN + 16, &in, &out), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, TEST_XTS_UNIT_LEN, nullptr, &out), HCF_INVALID_PARAMS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, TEST_XTS_UNIT_LEN, &in, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(out.data, nullptr);
+    HcfObjDestroy(cipher);
+
+    ASSERT_EQ(HcfCipherCreate("AES128|CTR|NoPadding", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, TEST_XTS_UNIT_LEN, &in, &out), HCF_NOT_SUPPORT);
+    HcfObjDestroy(cipher);
+    ASSERT_EQ(HcfCipherCreate("SM4_128|ECB|NoPadding", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->processDataUnits(cipher, 0, TEST_XTS_UNIT_LEN, &in, &out), HCF_NOT_SUPPORT);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+}
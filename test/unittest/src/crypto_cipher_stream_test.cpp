@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "securec.h"
+
+#include "aes_common.h"
+#include "blob.h"
+#include "cipher.h"
+#include "cipher_stream.h"
+#include "detailed_iv_params.h"
+#include "detailed_gcm_params.h"
+#include "memory.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t TEST_DATA_LEN = 4099;
+constexpr uint32_t TEST_CHUNK_LEN = 333;
+
+struct StreamSink {
+    vector<uint8_t> output;
+    HcfResult result = HCF_SUCCESS;
+    uint32_t callCount = 0;
+    uint32_t finalCount = 0;
+    atomic<bool> hold { false };
+};
+
+void CollectOutput(void *userData, HcfResult result, HcfBlob *output, bool isFinal)
+{
+    StreamSink *sink = static_cast<StreamSink *>(userData);
+    while (sink->hold.load()) {
+        this_thread::yield();
+    }
+    sink->callCount++;
+    if (result != HCF_SUCCESS) {
+        sink->result = result;
+    }
+    if (isFinal) {
+        sink->finalCount++;
+    }
+    if (output->data != nullptr) {
+        sink->output.insert(sink->output.end(), output->data, output->data + output->len);
+    }
+}
+
+class CryptoCipherStreamTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+static vector<uint8_t> OneShot(HcfCipher *cipher, const vector<uint8_t> &input)
+{
+    HcfBlob in = { .data = const_cast<uint8_t *>(input.data()), .len = input.size() };
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    vector<uint8_t> result;
+    if (cipher->doFinal(cipher, &in, &out) == HCF_SUCCESS) {
+        result.assign(out.data, out.data + out.len);
+    }
+    HcfBlobDataClearAndFree(&out);
+    return result;
+}
+
+static HcfResult StreamAll(HcfCipher *cipher, const vector<uint8_t> &input, uint32_t queueDepth, StreamSink *sink)
+{
+    HcfCipherStream *stream = nullptr;
+    HcfResult ret = HcfCipherStreamCreate(cipher, queueDepth, CollectOutput, sink, &stream);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    size_t offset = 0;
+    while (ret == HCF_SUCCESS && offset < input.size()) {
+        size_t len = min(static_cast<size_t>(TEST_CHUNK_LEN), input.size() - offset);
+        HcfBlob chunk = { .data = const_cast<uint8_t *>(input.data()) + offset, .len = len };
+        ret = stream->write(stream, &chunk);
+        offset += len;
+    }
+    if (ret == HCF_SUCCESS) {
+        ret = stream->finish(stream, nullptr);
+    }
+    HcfResult waitRet = stream->wait(stream);
+    HcfObjDestroy(stream);
+    return (ret != HCF_SUCCESS) ? ret : waitRet;
+}
+
+HWTEST_F(CryptoCipherStreamTest, CryptoCipherStreamTest001, TestSize.Level0)
+{
+    uint8_t iv[AES_IV_LEN] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = AES_IV_LEN;
+    vector<uint8_t> plain(TEST_DATA_LEN);
+    for (uint32_t i = 0; i < TEST_DATA_LEN; i++) {
+        plain[i] = static_cast<uint8_t>(i);
+    }
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(GenerateSymKey("AES128", &key), 0);
+    ASSERT_EQ(HcfCipherCreate("AES128|CBC|PKCS5", &cipher), HCF_SUCCESS);
+
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&ivSpec), HCF_SUCCESS);
+    vector<uint8_t> expect = OneShot(cipher, plain);
+    ASSERT_FALSE(expect.empty());
+
+    StreamSink encSink;
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&ivSpec), HCF_SUCCESS);
+    EXPECT_EQ(StreamAll(cipher, plain, 2, &encSink), HCF_SUCCESS);
+    EXPECT_EQ(encSink.output, expect);
+    EXPECT_EQ(encSink.finalCount, 1);
+
+    StreamSink decSink;
+    ASSERT_EQ(cipher->init(cipher, DECRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&ivSpec), HCF_SUCCESS);
+    EXPECT_EQ(StreamAll(cipher, expect, 0, &decSink), HCF_SUCCESS);
+    EXPECT_EQ(decSink.output, plain);
+
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoCipherStreamTest, CryptoCipherStreamTest002, TestSize.Level0)
+{
+    uint8_t aad[GCM_AAD_LEN] = { 0 };
+    uint8_t tag[GCM_TAG_LEN] = { 0 };
+    uint8_t iv[GCM_IV_LEN] = { 0 };
+    HcfGcmParamsSpec spec = {};
+    spec.aad.data = aad;
+    spec.aad.len = sizeof(aad);
+    spec.tag.data = tag;
+    spec.tag.len = sizeof(tag);
+    spec.iv.data = iv;
+    spec.iv.len = sizeof(iv);
+    vector<uint8_t> plain(TEST_DATA_LEN, 0x5a);
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(GenerateSymKey("AES256", &key), 0);
+    ASSERT_EQ(HcfCipherCreate("AES256|GCM|NoPadding", &cipher), HCF_SUCCESS);
+
+    StreamSink encSink;
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&spec), HCF_SUCCESS);
+    ASSERT_EQ(StreamAll(cipher, plain, 1, &encSink), HCF_SUCCESS);
+    ASSERT_EQ(encSink.output.size(), plain.size() + GCM_TAG_LEN);
+    (void)memcpy_s(tag, sizeof(tag), encSink.output.data() + plain.size(), GCM_TAG_LEN);
+    encSink.output.resize(plain.size());
+
+    StreamSink decSink;
+    ASSERT_EQ(cipher->init(cipher, DECRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&spec), HCF_SUCCESS);
+    EXPECT_EQ(StreamAll(cipher, encSink.output, 0, &decSink), HCF_SUCCESS);
+    EXPECT_EQ(decSink.output, plain);
+
+    // a wrong tag fails the final chunk and is reported both by the callback and by wait
+    tag[0] ^= 0x01;
+    StreamSink badSink;
+    ASSERT_EQ(cipher->init(cipher, DECRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&spec), HCF_SUCCESS);
+    EXPECT_NE(StreamAll(cipher, encSink.output, 0, &badSink), HCF_SUCCESS);
+    EXPECT_NE(badSink.result, HCF_SUCCESS);
+    EXPECT_EQ(badSink.finalCount, 1);
+
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoCipherStreamTest, CryptoCipherStreamTest003, TestSize.Level0)
+{
+    uint8_t iv[AES_IV_LEN] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = AES_IV_LEN;
+    uint8_t data[TEST_CHUNK_LEN] = { 0 };
+    HcfBlob chunk = { .data = data, .len = sizeof(data) };
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(GenerateSymKey("AES128", &key), 0);
+    ASSERT_EQ(HcfCipherCreate("AES128|CTR|NoPadding", &cipher), HCF_SUCCESS);
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&ivSpec), HCF_SUCCESS);
+
+    StreamSink sink;
+    sink.hold = true;
+    HcfCipherStream *stream = nullptr;
+    ASSERT_EQ(HcfCipherStreamCreate(cipher, 2, CollectOutput, &sink, &stream), HCF_SUCCESS);
+    // the worker is parked in the callback, so at most one chunk in flight plus two queued are accepted
+    bool accepted = true;
+    uint32_t acceptedCount = 0;
+    while (accepted && acceptedCount < TEST_CHUNK_LEN) {
+        EXPECT_EQ(stream->tryWrite(stream, &chunk, &accepted), HCF_SUCCESS);
+        acceptedCount += accepted ? 1 : 0;
+    }
+    EXPECT_FALSE(accepted);
+    EXPECT_LE(acceptedCount, 3);
+    EXPECT_GE(stream->getPendingCount(stream), 2);
+    sink.hold = false;
+
+    EXPECT_EQ(stream->write(stream, &chunk), HCF_SUCCESS);
+    EXPECT_EQ(stream->finish(stream, &chunk), HCF_SUCCESS);
+    EXPECT_EQ(stream->wait(stream), HCF_SUCCESS);
+    EXPECT_EQ(sink.output.size(), (acceptedCount + 2) * sizeof(data));
+    EXPECT_EQ(stream->getPendingCount(stream), 0);
+
+    // no chunk is accepted once the stream is finished
+    EXPECT_EQ(stream->write(stream, &chunk), HCF_ERR_INVALID_CALL);
+    EXPECT_EQ(stream->finish(stream, nullptr), HCF_ERR_INVALID_CALL);
+
+    HcfObjDestroy(stream);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoCipherStreamTest, CryptoCipherStreamTest004, TestSize.Level0)
+{
+    StreamSink sink;
+    HcfCipherStream *stream = nullptr;
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(HcfCipherCreate("AES128|ECB|PKCS5", &cipher), HCF_SUCCESS);
+
+    EXPECT_EQ(HcfCipherStreamCreate(nullptr, 0, CollectOutput, &sink, &stream), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfCipherStreamCreate(cipher, 0, nullptr, &sink, &stream), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfCipherStreamCreate(cipher, HCF_CIPHER_STREAM_MAX_QUEUE_DEPTH + 1, CollectOutput, &sink, &stream),
+        HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfCipherStreamCreate(cipher, 0, CollectOutput, &sink, nullptr), HCF_INVALID_PARAMS);
+
+    ASSERT_EQ(HcfCipherStreamCreate(cipher, 0, CollectOutput, &sink, &stream), HCF_SUCCESS);
+    HcfBlob empty = { .data = nullptr, .len = 0 };
+    bool accepted = false;
+    EXPECT_EQ(stream->write(stream, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(stream->write(stream, &empty), HCF_INVALID_PARAMS);
+    EXPECT_EQ(stream->tryWrite(stream, &empty, &accepted), HCF_INVALID_PARAMS);
+    EXPECT_EQ(stream->write(nullptr, &empty), HCF_INVALID_PARAMS);
+    EXPECT_EQ(stream->wait(nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(stream->wait(stream), HCF_SUCCESS);
+
+    // the cipher was never initialized, so the first chunk fails and stops the stream
+    uint8_t data[AES_IV_LEN] = { 0 };
+    HcfBlob chunk = { .data = data, .len = sizeof(data) };
+    EXPECT_EQ(stream->write(stream, &chunk), HCF_SUCCESS);
+    EXPECT_NE(stream->wait(stream), HCF_SUCCESS);
+    EXPECT_NE(stream->write(stream, &chunk), HCF_SUCCESS);
+    EXPECT_EQ(sink.finalCount, 1);
+
+    HcfObjDestroy(stream);
+    HcfObjDestroy(cipher);
+}
+
+HWTEST_F(CryptoCipherStreamTest, CryptoCipherStreamTest005, TestSize.Level0)
+{
+    uint8_t iv[AES_IV_LEN] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = AES_IV_LEN;
+    uint8_t data[TEST_CHUNK_LEN] = { 0 };
+    HcfBlob chunk = { .data = data, .len = sizeof(data) };
+    HcfSymKey *key = nullptr;
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(GenerateSymKey("AES128", &key), 0);
+    ASSERT_EQ(HcfCipherCreate("AES128|CTR|NoPadding", &cipher), HCF_SUCCESS);
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)key, (HcfParamsSpec *)&ivSpec), HCF_SUCCESS);
+
+    // destroying a stream that is never finished drops the queued chunks
+    StreamSink sink;
+    HcfCipherStream *stream = nullptr;
+    ASSERT_EQ(HcfCipherStreamCreate(cipher, HCF_CIPHER_STREAM_MAX_QUEUE_DEPTH, CollectOutput, &sink, &stream),
+        HCF_SUCCESS);
+    for (uint32_t i = 0; i < HCF_CIPHER_STREAM_MAX_QUEUE_DEPTH; i++) {
+        EXPECT_EQ(stream->write(stream, &chunk), HCF_SUCCESS);
+    }
+    HcfObjDestroy(stream);
+    EXPECT_EQ(sink.finalCount, 0);
+    EXPECT_LE(sink.output.size(), HCF_CIPHER_STREAM_MAX_QUEUE_DEPTH * sizeof(data));
+
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+}
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <openssl/bn.h>
+#include "securec.h"
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "detailed_dh_key_params.h"
+#include "dh_key_util.h"
+#include "dh_openssl_common.h"
+#include "key_agreement.h"
+#include "memory.h"
+#include "openssl_common.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t TEST_THREAD_NUM = 8;
+constexpr uint32_t TEST_THREAD_REPEAT_NUM = 3;
+constexpr int32_t PLEN_DH2048 = 2048;
+constexpr int32_t PLEN_DH3072 = 3072;
+constexpr int32_t SKLEN_DH2048_MIN = 224;
+constexpr int32_t SKLEN_DH2048_MAX = 2047;
+
+struct DhNamedGroupName {
+    const char *algName;
+    const char *nidName;
+};
+
+const DhNamedGroupName g_dhNamedGroupNames[] = {
+    { "DH_modp1536", "modp_1536" }, { "DH_modp2048", "modp_2048" }, { "DH_modp3072", "modp_3072" },
+    { "DH_modp4096", "modp_4096" }, { "DH_modp6144", "modp_6144" }, { "DH_modp8192", "modp_8192" },
+    { "DH_ffdhe2048", "ffdhe2048" }, { "DH_ffdhe3072", "ffdhe3072" }, { "DH_ffdhe4096", "ffdhe4096" },
+    { "DH_ffdhe6144", "ffdhe6144" }, { "DH_ffdhe8192", "ffdhe8192" }
+};
+
+class CryptoDhNamedGroupTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+HcfKeyPair *GenerateDhKeyPair(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfKeyPair *keyPair = nullptr;
+    (void)generator->generateKeyPair(generator, nullptr, &keyPair);
+    HcfObjDestroy(generator);
+    return keyPair;
+}
+
+HcfResult GenerateDhSecret(HcfPriKey *priKey, HcfPubKey *pubKey, HcfBlob *secret)
+{
+    HcfKeyAgreement *keyAgreement = nullptr;
+    HcfResult res = HcfKeyAgreementCreate("DH", &keyAgreement);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    res = keyAgreement->generateSecret(keyAgreement, priKey, pubKey, secret);
+    HcfObjDestroy(keyAgreement);
+    return res;
+}
+
+bool IsAgreementSymmetric(const char *algName)
+{
+    HcfKeyPair *keyPair1 = GenerateDhKeyPair(algName);
+    HcfKeyPair *keyPair2 = GenerateDhKeyPair(algName);
+    HcfBlob secret1 = { .data = nullptr, .len = 0 };
+    HcfBlob secret2 = { .data = nullptr, .len = 0 };
+    bool isSame = (keyPair1 != nullptr) && (keyPair2 != nullptr) &&
+        (GenerateDhSecret(keyPair1->priKey, keyPair2->pubKey, &secret1) == HCF_SUCCESS) &&
+        (GenerateDhSecret(keyPair2->priKey, keyPair1->pubKey, &secret2) == HCF_SUCCESS) &&
+        (secret1.len == secret2.len) && (memcmp(secret1.data, secret2.data, secret1.len) == 0);
+    HcfBlobDataClearAndFree(&secret1);
+    HcfBlobDataClearAndFree(&secret2);
+    HcfObjDestroy(keyPair1);
+    HcfObjDestroy(keyPair2);
+    return isSame;
+}
+
+BIGNUM *BigIntegerToBn(const HcfBigInteger &bigInt)
+{
+    if (IsBigEndian()) {
+        return BN_bin2bn(bigInt.data, bigInt.len, nullptr);
+    }
+    return BN_lebin2bn(bigInt.data, bigInt.len, nullptr);
+}
+
+HcfResult BnToBigInteger(const BIGNUM *bn, HcfBigInteger *bigInt)
+{
+    int len = BN_num_bytes(bn);
+    bigInt->data = static_cast<unsigned char *>(HcfMalloc(len, 0));
+    if (bigInt->data == nullptr) {
+        return HCF_ERR_MALLOC;
+    }
+    bigInt->len = static_cast<uint32_t>(len);
+    int resLen = IsBigEndian() ? BN_bn2binpad(bn, bigInt->data, len) : BN_bn2lebinpad(bn, bigInt->data, len);
+    return (resLen == len) ? HCF_SUCCESS : HCF_ERR_CRYPTO_OPERATION;
+}
+
+/* pk = p - delta when fromP is set, otherwise pk = delta */
+HcfPubKey *CreateDhPeerPubKey(const HcfDhCommParamsSpec *commSpec, BN_ULONG delta, bool fromP)
+{
+    HcfDhPubKeyParamsSpec pubKeySpec = {};
+    pubKeySpec.base = *commSpec;
+    pubKeySpec.base.base.specType = HCF_PUBLIC_KEY_SPEC;
+    BIGNUM *pk = fromP ? BigIntegerToBn(commSpec->p) : BN_new();
+    if ((pk == nullptr) || (fromP ? BN_sub_word(pk, delta) : BN_set_word(pk, delta)) != 1 ||
+        (BnToBigInteger(pk, &pubKeySpec.pk) != HCF_SUCCESS)) {
+        BN_free(pk);
+        HcfFree(pubKeySpec.pk.data);
+        return nullptr;
+    }
+    BN_free(pk);
+    HcfAsyKeyGeneratorBySpec *generator = nullptr;
+    HcfPubKey *pubKey = nullptr;
+    if (HcfAsyKeyGeneratorBySpecCreate(reinterpret_cast<HcfAsyKeyParamsSpec *>(&pubKeySpec), &generator) ==
+        HCF_SUCCESS) {
+        (void)generator->generatePubKey(generator, &pubKey);
+    }
+    HcfObjDestroy(generator);
+    HcfFree(pubKeySpec.pk.data);
+    return pubKey;
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest001, TestSize.Level0)
+{
+    /* the first use of the group races with every other thread */
+    vector<thread> threads;
+    vector<int> results(TEST_THREAD_NUM, 0);
+    for (uint32_t i = 0; i < TEST_THREAD_NUM; i++) {
+        threads.emplace_back([&results, i]() {
+            for (uint32_t j = 0; j < TEST_THREAD_REPEAT_NUM; j++) {
+                results[i] += IsAgreementSymmetric("DH_ffdhe3072") ? 1 : 0;
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    for (uint32_t i = 0; i < TEST_THREAD_NUM; i++) {
+        EXPECT_EQ(results[i], static_cast<int>(TEST_THREAD_REPEAT_NUM));
+    }
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest002, TestSize.Level0)
+{
+    for (const auto &name : g_dhNamedGroupNames) {
+        EXPECT_TRUE(IsAgreementSymmetric(name.algName)) << name.algName;
+    }
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest003, TestSize.Level0)
+{
+    for (const auto &name : g_dhNamedGroupNames) {
+        const HcfDhNamedGroup *group = GetDhNamedGroup(name.nidName);
+        ASSERT_NE(group, nullptr) << name.nidName;
+        EXPECT_EQ(BN_num_bits(group->p), group->pBits);
+        EXPECT_EQ(BN_num_bits(group->q), group->pBits - 1);
+        EXPECT_EQ(GetDhNamedGroup(name.nidName), group);
+        EXPECT_EQ(FindDhNamedGroupByParams(group->p, group->g), group);
+    }
+    EXPECT_EQ(GetDhNamedGroup("ffdhe1024"), nullptr);
+    EXPECT_EQ(GetDhNamedGroup(nullptr), nullptr);
+    const HcfDhNamedGroup *group = GetDhNamedGroup("ffdhe2048");
+    ASSERT_NE(group, nullptr);
+    EXPECT_EQ(FindDhNamedGroupByParams(group->pMinusOne, group->g), nullptr);
+    EXPECT_EQ(FindDhNamedGroupByParams(nullptr, group->g), nullptr);
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest004, TestSize.Level0)
+{
+    HcfDhCommParamsSpec *commSpec = nullptr;
+    ASSERT_EQ(HcfDhKeyUtilCreate(PLEN_DH3072, 0, &commSpec), HCF_SUCCESS);
+    const HcfDhNamedGroup *group = GetDhNamedGroup("ffdhe3072");
+    ASSERT_NE(group, nullptr);
+    BIGNUM *p = BigIntegerToBn(commSpec->p);
+    BIGNUM *g = BigIntegerToBn(commSpec->g);
+    EXPECT_EQ(BN_cmp(p, group->p), 0);
+    EXPECT_EQ(BN_cmp(g, group->g), 0);
+    BN_free(p);
+    BN_free(g);
+    FreeDhCommParamsSpec(commSpec);
+    HcfFree(commSpec);
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest005, TestSize.Level0)
+{
+    const int32_t validSkLens[] = { 0, SKLEN_DH2048_MIN, SKLEN_DH2048_MAX };
+    for (int32_t skLen : validSkLens) {
+        HcfDhCommParamsSpec *commSpec = nullptr;
+        EXPECT_EQ(HcfDhKeyUtilCreate(PLEN_DH2048, skLen, &commSpec), HCF_SUCCESS) << skLen;
+        EXPECT_NE(commSpec, nullptr);
+        if (commSpec != nullptr) {
+            EXPECT_EQ(commSpec->length, skLen);
+            FreeDhCommParamsSpec(commSpec);
+            HcfFree(commSpec);
+        }
+    }
+    const int32_t invalidSkLens[] = { SKLEN_DH2048_MIN - 1, SKLEN_DH2048_MAX + 1 };
+    for (int32_t skLen : invalidSkLens) {
+        HcfDhCommParamsSpec *commSpec = nullptr;
+        EXPECT_NE(HcfDhKeyUtilCreate(PLEN_DH2048, skLen, &commSpec), HCF_SUCCESS) << skLen;
+        EXPECT_EQ(commSpec, nullptr);
+    }
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest006, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateDhKeyPair("DH_ffdhe2048");
+    ASSERT_NE(keyPair, nullptr);
+    HcfDhCommParamsSpec *commSpec = nullptr;
+    ASSERT_EQ(HcfDhKeyUtilCreate(PLEN_DH2048, 0, &commSpec), HCF_SUCCESS);
+
+    /* 1, p - 1 and p - 2, the last one is in range but a quadratic non-residue since p = 7 mod 8 */
+    HcfPubKey *invalidPeers[] = {
+        CreateDhPeerPubKey(commSpec, 1, false), CreateDhPeerPubKey(commSpec, 1, true),
+        CreateDhPeerPubKey(commSpec, 2, true)
+    };
+    for (HcfPubKey *peer : invalidPeers) {
+        ASSERT_NE(peer, nullptr);
+        HcfBlob secret = { .data = nullptr, .len = 0 };
+        EXPECT_NE(GenerateDhSecret(keyPair->priKey, peer, &secret), HCF_SUCCESS);
+        EXPECT_EQ(secret.data, nullptr);
+        HcfObjDestroy(peer);
+    }
+    const HcfDhNamedGroup *group = GetDhNamedGroup("ffdhe2048");
+    ASSERT_NE(group, nullptr);
+    BIGNUM *pk = BN_dup(group->pMinusOne);
+    ASSERT_NE(pk, nullptr);
+    EXPECT_NE(CheckDhNamedGroupPubKey(group, pk), HCF_SUCCESS);
+    ASSERT_EQ(BN_sub_word(pk, 1), 1);
+    EXPECT_NE(CheckDhNamedGroupPubKey(group, pk), HCF_SUCCESS);
+    EXPECT_EQ(CheckDhNamedGroupPubKey(group, group->g), HCF_SUCCESS);
+    EXPECT_NE(CheckDhNamedGroupKeyPair(group, group->g, group->q), HCF_SUCCESS);
+    ASSERT_EQ(BN_one(pk), 1);
+    EXPECT_EQ(CheckDhNamedGroupKeyPair(group, group->g, pk), HCF_SUCCESS);
+    BN_free(pk);
+
+    FreeDhCommParamsSpec(commSpec);
+    HcfFree(commSpec);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoDhNamedGroupTest, CryptoDhNamedGroupTest007, TestSize.Level0)
+{
+    /* keys of two different groups must not agree even though both are named groups */
+    HcfKeyPair *keyPair1 = GenerateDhKeyPair("DH_ffdhe2048");
+    HcfKeyPair *keyPair2 = GenerateDhKeyPair("DH_modp2048");
+    ASSERT_NE(keyPair1, nullptr);
+    ASSERT_NE(keyPair2, nullptr);
+    HcfBlob secret = { .data = nullptr, .len = 0 };
+    EXPECT_NE(GenerateDhSecret(keyPair1->priKey, keyPair2->pubKey, &secret), HCF_SUCCESS);
+    EXPECT_EQ(secret.data, nullptr);
+    HcfObjDestroy(keyPair1);
+    HcfObjDestroy(keyPair2);
+}
+}
@@ -570,7 +570,7 @@ HWTEST_F(CryptoEd25519SignTest, CryptoEd25519SignTest021, TestSize.Level0)
 
     ret = sign->init(sign, nullptr, ed25519KeyPair_->priKey);
     ret = sign->init(sign, nullptr, ed25519KeyPair_->priKey);
-    ASSERT_NE(ret, HCF_SUCCESS);
+    ASSERT_EQ(ret, HCF_SUCCESS);
 
     HcfObjDestroy(sign);
 }
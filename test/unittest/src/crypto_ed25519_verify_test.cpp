@@ -473,7 +473,7 @@ HWTEST_F(CryptoEd25519VerifyTest, CryptoEd25519VerifyTest020, TestSize.Level0)
 
     ret = verify->init(verify, nullptr, ed25519KeyPair_->pubKey);
     ret = verify->init(verify, nullptr, ed25519KeyPair_->pubKey);
-    ASSERT_NE(ret, HCF_SUCCESS);
+    ASSERT_EQ(ret, HCF_SUCCESS);
 
     HcfObjDestroy(verify);
 }
@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "envelope.h"
+#include "memory.h"
+#include "openssl_adapter_mock.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoEnvelopeTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+struct EnvelopeTestSuite {
+    const char *envelopeName;
+    const char *keyGenName;
+};
+
+const EnvelopeTestSuite g_envelopeSuites[] = {
+    { "X25519-AES256-GCM", "X25519" },
+    { "ECC-AES256-GCM", "ECC256" },
+    { "ECC-AES256-GCM", "ECC_BrainPoolP384r1" },
+    { "RSA-KEM-AES256-GCM", "RSA2048" },
+};
+
+uint8_t g_plainText[] = "envelope test plain text";
+uint8_t g_aadText[] = "envelope test aad";
+HcfBlob g_input = { .data = g_plainText, .len = sizeof(g_plainText) - 1 };
+HcfBlob g_aad = { .data = g_aadText, .len = sizeof(g_aadText) - 1 };
+
+static HcfKeyPair *GenerateKeyPair(const char *keyGenName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *keyPair = nullptr;
+    if (HcfAsyKeyGeneratorCreate(keyGenName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    if (generator->generateKeyPair(generator, nullptr, &keyPair) != HCF_SUCCESS) {
+        keyPair = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return keyPair;
+}
+
+static void EnvelopeRoundTripTest(const EnvelopeTestSuite &suite, const HcfBlob *aad)
+{
+    HcfKeyPair *keyPair = GenerateKeyPair(suite.keyGenName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfEnvelope *envelope = nullptr;
+    ASSERT_EQ(HcfEnvelopeCreate(suite.envelopeName, &envelope), HCF_SUCCESS);
+    EXPECT_STREQ(envelope->getAlgoName(envelope), suite.envelopeName);
+
+    HcfBlob sealed = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(envelope->seal(envelope, keyPair->pubKey, aad, &g_input, &sealed), HCF_SUCCESS);
+    ASSERT_GT(sealed.len, HCF_ENVELOPE_HEADER_LEN + g_input.len + HCF_ENVELOPE_TAG_LEN);
+    EXPECT_EQ(sealed.data[0], HCF_ENVELOPE_VERSION);
+    size_t encLen = (static_cast<size_t>(sealed.data[2]) << 8) | sealed.data[3];
+    EXPECT_EQ(sealed.len, HCF_ENVELOPE_HEADER_LEN + encLen + g_input.len + HCF_ENVELOPE_TAG_LEN);
+
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(envelope->open(envelope, keyPair->priKey, aad, &sealed, &output), HCF_SUCCESS);
+    ASSERT_EQ(output.len, g_input.len);
+    EXPECT_EQ(memcmp(output.data, g_input.data, output.len), 0);
+
+    HcfBlobDataFree(&output);
+    HcfBlobDataFree(&sealed);
+    HcfObjDestroy(envelope);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest001, TestSize.Level0)
+{
+    for (const auto &suite : g_envelopeSuites) {
+        EnvelopeRoundTripTest(suite, &g_aad);
+        EnvelopeRoundTripTest(suite, nullptr);
+    }
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest002, TestSize.Level0)
+{
+    HcfEnvelope *envelope = nullptr;
+    HcfResult res = HcfEnvelopeCreate("SM2-SM4-GCM", &envelope);
+    if (res == HCF_NOT_SUPPORT) {
+        /* SM4-GCM depends on the openssl build. */
+        return;
+    }
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfObjDestroy(envelope);
+    EnvelopeRoundTripTest({ "SM2-SM4-GCM", "SM2_256" }, &g_aad);
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest003, TestSize.Level0)
+{
+    HcfEnvelope *envelope = nullptr;
+    EXPECT_EQ(HcfEnvelopeCreate(nullptr, &envelope), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfEnvelopeCreate("X25519-AES256-GCM", nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfEnvelopeCreate("X25519-AES128-GCM", &envelope), HCF_NOT_SUPPORT);
+    EXPECT_EQ(envelope, nullptr);
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest004, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateKeyPair("X25519");
+    ASSERT_NE(keyPair, nullptr);
+    HcfKeyPair *eccKeyPair = GenerateKeyPair("ECC256");
+    ASSERT_NE(eccKeyPair, nullptr);
+    HcfEnvelope *envelope = nullptr;
+    ASSERT_EQ(HcfEnvelopeCreate("X25519-AES256-GCM", &envelope), HCF_SUCCESS);
+
+    HcfBlob sealed = { .data = nullptr, .len = 0 };
+    HcfBlob emptyInput = { .data = nullptr, .len = 0 };
+    HcfBlob badAad = { .data = nullptr, .len = 1 };
+    EXPECT_EQ(envelope->seal(nullptr, keyPair->pubKey, nullptr, &g_input, &sealed), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal(envelope, nullptr, nullptr, &g_input, &sealed), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal(envelope, keyPair->pubKey, nullptr, nullptr, &sealed), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal(envelope, keyPair->pubKey, nullptr, &emptyInput, &sealed), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal(envelope, keyPair->pubKey, &badAad, &g_input, &sealed), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal(envelope, keyPair->pubKey, nullptr, &g_input, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal(envelope, eccKeyPair->pubKey, nullptr, &g_input, &sealed), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->seal((HcfEnvelope *)keyPair, keyPair->pubKey, nullptr, &g_input, &sealed),
+        HCF_INVALID_PARAMS);
+    EXPECT_EQ(sealed.data, nullptr);
+
+    ASSERT_EQ(envelope->seal(envelope, keyPair->pubKey, nullptr, &g_input, &sealed), HCF_SUCCESS);
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(envelope->open(envelope, nullptr, nullptr, &sealed, &output), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->open(envelope, keyPair->priKey, nullptr, nullptr, &output), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->open(envelope, keyPair->priKey, nullptr, &sealed, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(envelope->open(envelope, eccKeyPair->priKey, nullptr, &sealed, &output), HCF_INVALID_PARAMS);
+    EXPECT_EQ(output.data, nullptr);
+    EXPECT_EQ(envelope->getAlgoName(nullptr), nullptr);
+
+    HcfBlobDataFree(&sealed);
+    HcfObjDestroy(envelope);
+    HcfObjDestroy(eccKeyPair);
+    HcfObjDestroy(keyPair);
+}
+
+static void EnvelopeTamperTest(const EnvelopeTestSuite &suite)
+{
+    HcfKeyPair *keyPair = GenerateKeyPair(suite.keyGenName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfKeyPair *otherKeyPair = GenerateKeyPair(suite.keyGenName);
+    ASSERT_NE(otherKeyPair, nullptr);
+    HcfEnvelope *envelope = nullptr;
+    ASSERT_EQ(HcfEnvelopeCreate(suite.envelopeName, &envelope), HCF_SUCCESS);
+    HcfBlob sealed = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(envelope->seal(envelope, keyPair->pubKey, &g_aad, &g_input, &sealed), HCF_SUCCESS);
+
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    EXPECT_NE(envelope->open(envelope, keyPair->priKey, nullptr, &sealed, &output), HCF_SUCCESS);
+    EXPECT_NE(envelope->open(envelope, otherKeyPair->priKey, &g_aad, &sealed, &output), HCF_SUCCESS);
+    for (size_t i = 0; i < sealed.len; i++) {
+        sealed.data[i] ^= 0x01;
+        EXPECT_NE(envelope->open(envelope, keyPair->priKey, &g_aad, &sealed, &output), HCF_SUCCESS);
+        sealed.data[i] ^= 0x01;
+    }
+    HcfBlob truncated = { .data = sealed.data, .len = sealed.len - 1 };
+    EXPECT_NE(envelope->open(envelope, keyPair->priKey, &g_aad, &truncated, &output), HCF_SUCCESS);
+    truncated.len = HCF_ENVELOPE_HEADER_LEN + HCF_ENVELOPE_TAG_LEN;
+    EXPECT_EQ(envelope->open(envelope, keyPair->priKey, &g_aad, &truncated, &output), HCF_INVALID_PARAMS);
+    EXPECT_EQ(output.data, nullptr);
+    ASSERT_EQ(envelope->open(envelope, keyPair->priKey, &g_aad, &sealed, &output), HCF_SUCCESS);
+
+    HcfBlobDataFree(&output);
+    HcfBlobDataFree(&sealed);
+    HcfObjDestroy(envelope);
+    HcfObjDestroy(otherKeyPair);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest005, TestSize.Level0)
+{
+    for (const auto &suite : g_envelopeSuites) {
+        EnvelopeTamperTest(suite);
+    }
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest006, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateKeyPair("ECC256");
+    ASSERT_NE(keyPair, nullptr);
+    HcfEnvelope *x25519Envelope = nullptr;
+    HcfEnvelope *eccEnvelope = nullptr;
+    ASSERT_EQ(HcfEnvelopeCreate("X25519-AES256-GCM", &x25519Envelope), HCF_SUCCESS);
+    ASSERT_EQ(HcfEnvelopeCreate("ECC-AES256-GCM", &eccEnvelope), HCF_SUCCESS);
+    HcfBlob sealed = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(eccEnvelope->seal(eccEnvelope, keyPair->pubKey, nullptr, &g_input, &sealed), HCF_SUCCESS);
+
+    /* Every seal uses a fresh ephemeral key. */
+    HcfBlob otherSealed = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(eccEnvelope->seal(eccEnvelope, keyPair->pubKey, nullptr, &g_input, &otherSealed), HCF_SUCCESS);
+    ASSERT_EQ(otherSealed.len, sealed.len);
+    EXPECT_NE(memcmp(otherSealed.data, sealed.data, sealed.len), 0);
+
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    sealed.data[1] = 1;
+    EXPECT_EQ(eccEnvelope->open(eccEnvelope, keyPair->priKey, nullptr, &sealed, &output), HCF_INVALID_PARAMS);
+    sealed.data[1] = 2;
+    sealed.data[0] = HCF_ENVELOPE_VERSION + 1;
+    EXPECT_EQ(eccEnvelope->open(eccEnvelope, keyPair->priKey, nullptr, &sealed, &output), HCF_INVALID_PARAMS);
+    sealed.data[0] = HCF_ENVELOPE_VERSION;
+    EXPECT_EQ(x25519Envelope->open(x25519Envelope, keyPair->priKey, nullptr, &sealed, &output), HCF_INVALID_PARAMS);
+    EXPECT_EQ(eccEnvelope->open(eccEnvelope, keyPair->priKey, nullptr, &sealed, &output), HCF_SUCCESS);
+
+    HcfBlobDataFree(&output);
+    HcfBlobDataFree(&otherSealed);
+    HcfBlobDataFree(&sealed);
+    HcfObjDestroy(eccEnvelope);
+    HcfObjDestroy(x25519Envelope);
+    HcfObjDestroy(keyPair);
+}
+
+static void EnvelopeOpensslMockTest(const EnvelopeTestSuite &suite)
+{
+    HcfKeyPair *keyPair = GenerateKeyPair(suite.keyGenName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfEnvelope *envelope = nullptr;
+    ASSERT_EQ(HcfEnvelopeCreate(suite.envelopeName, &envelope), HCF_SUCCESS);
+    HcfBlob sealed = { .data = nullptr, .len = 0 };
+    HcfBlob output = { .data = nullptr, .len = 0 };
+
+    StartRecordOpensslCallNum();
+    ASSERT_EQ(envelope->seal(envelope, keyPair->pubKey, &g_aad, &g_input, &sealed), HCF_SUCCESS);
+    uint32_t callNum = GetOpensslCallNum();
+    for (uint32_t i = 0; i < callNum; i++) {
+        ResetOpensslCallNum();
+        SetOpensslCallMockIndex(i);
+        HcfBlob mockSealed = { .data = nullptr, .len = 0 };
+        if (envelope->seal(envelope, keyPair->pubKey, &g_aad, &g_input, &mockSealed) == HCF_SUCCESS) {
+            HcfBlobDataFree(&mockSealed);
+            continue;
+        }
+        EXPECT_EQ(mockSealed.data, nullptr);
+    }
+    EndRecordOpensslCallNum();
+
+    StartRecordOpensslCallNum();
+    ASSERT_EQ(envelope->open(envelope, keyPair->priKey, &g_aad, &sealed, &output), HCF_SUCCESS);
+    HcfBlobDataFree(&output);
+    callNum = GetOpensslCallNum();
+    for (uint32_t i = 0; i < callNum; i++) {
+        ResetOpensslCallNum();
+        SetOpensslCallMockIndex(i);
+        if (envelope->open(envelope, keyPair->priKey, &g_aad, &sealed, &output) == HCF_SUCCESS) {
+            HcfBlobDataFree(&output);
+            continue;
+        }
+        EXPECT_EQ(output.data, nullptr);
+    }
+    EndRecordOpensslCallNum();
+
+    HcfBlobDataFree(&sealed);
+    HcfObjDestroy(envelope);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoEnvelopeTest, CryptoEnvelopeTest007, TestSize.Level0)
+{
+    for (const auto &suite : g_envelopeSuites) {
+        EnvelopeOpensslMockTest(suite);
+    }
+}
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_hmac_params.h"
+#include "detailed_iv_params.h"
+#include "file_crypto.h"
+#include "mac.h"
+#include "md.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoFileCryptoTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void CryptoFileCryptoTest::SetUp() {}
+void CryptoFileCryptoTest::TearDown() {}
+void CryptoFileCryptoTest::SetUpTestCase() {}
+void CryptoFileCryptoTest::TearDownTestCase() {}
+
+constexpr const char *PLAIN_FILE = "/data/test_file_crypto.txt";
+constexpr const char *ENC_FILE = "/data/test_file_crypto_enc.txt";
+constexpr const char *DEC_FILE = "/data/test_file_crypto_dec.txt";
+/* Larger than the 4 MiB cipher chunk and not a multiple of the page size. */
+constexpr size_t LARGE_FILE_LEN = 5 * 1024 * 1024 + 123;
+constexpr size_t SMALL_FILE_LEN = 10000;
+constexpr uint64_t RANGE_OFFSET = 4097;
+constexpr uint64_t RANGE_LEN = 3000;
+
+static vector<uint8_t> MakeContent(size_t len)
+{
+    vector<uint8_t> content(len);
+    for (size_t i = 0; i < len; i++) {
+        content[i] = static_cast<uint8_t>((i * 31) ^ (i >> 8));
+    }
+    return content;
+}
+
+static bool WriteFile(const char *path, const vector<uint8_t> &content)
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return false;
+    }
+    bool ret = (write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()));
+    close(fd);
+    return ret;
+}
+
+static bool ReadFile(const char *path, vector<uint8_t> &content)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    content.clear();
+    uint8_t buf[4096];
+    ssize_t len;
+    while ((len = read(fd, buf, sizeof(buf))) > 0) {
+        content.insert(content.end(), buf, buf + len);
+    }
+    close(fd);
+    return len == 0;
+}
+
+static vector<uint8_t> MdOfBuffer(const uint8_t *data, size_t len)
+{
+    HcfMd *md = nullptr;
+    EXPECT_EQ(HcfMdCreate("SHA256", &md), HCF_SUCCESS);
+    HcfBlob input = { .data = const_cast<uint8_t *>(data), .len = len };
+    EXPECT_EQ(md->update(md, &input), HCF_SUCCESS);
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(md->doFinal(md, &out), HCF_SUCCESS);
+    vector<uint8_t> ret(out.data, out.data + out.len);
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(md);
+    return ret;
+}
+
+static HcfResult MdOfFd(int fd, uint64_t offset, uint64_t length, vector<uint8_t> &ret)
+{
+    HcfMd *md = nullptr;
+    EXPECT_EQ(HcfMdCreate("SHA256", &md), HCF_SUCCESS);
+    HcfResult res = HcfMdUpdateFd(md, fd, offset, length);
+    if (res == HCF_SUCCESS) {
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        res = md->doFinal(md, &out);
+        if (res == HCF_SUCCESS) {
+            ret.assign(out.data, out.data + out.len);
+        }
+        HcfBlobDataFree(&out);
+    }
+    HcfObjDestroy(md);
+    return res;
+}
+
+static HcfSymKey *GenerateAesKey()
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    EXPECT_EQ(HcfSymKeyGeneratorCreate("AES256", &generator), HCF_SUCCESS);
+    EXPECT_EQ(generator->generateSymKey(generator, &key), HCF_SUCCESS);
+    HcfObjDestroy(generator);
+    return key;
+}
+
+static HcfResult CipherFile(HcfSymKey *key, enum HcfCryptoMode mode, const char *inPath, const char *outPath)
+{
+    uint8_t iv[16] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = sizeof(iv);
+    HcfCipher *cipher = nullptr;
+    EXPECT_EQ(HcfCipherCreate("AES256|CTR|NoPadding", &cipher), HCF_SUCCESS);
+    EXPECT_EQ(cipher->init(cipher, mode, &key->key, &ivSpec.base), HCF_SUCCESS);
+    int inFd = open(inPath, O_RDONLY);
+    int outFd = open(outPath, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    HcfResult res = HcfCipherUpdateFd(cipher, inFd, 0, 0, outFd);
+    if (res == HCF_SUCCESS) {
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        res = cipher->doFinal(cipher, nullptr, &out);
+        if ((res == HCF_SUCCESS) && (out.len > 0) && (write(outFd, out.data, out.len) != (ssize_t)out.len)) {
+            res = HCF_ERR_CRYPTO_OPERATION;
+        }
+        HcfBlobDataFree(&out);
+    }
+    close(inFd);
+    close(outFd);
+    HcfObjDestroy(cipher);
+    return res;
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest001, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(LARGE_FILE_LEN);
+    ASSERT_TRUE(WriteFile(PLAIN_FILE, content));
+    int fd = open(PLAIN_FILE, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    vector<uint8_t> fileMd;
+    EXPECT_EQ(MdOfFd(fd, 0, 0, fileMd), HCF_SUCCESS);
+    EXPECT_EQ(fileMd, MdOfBuffer(content.data(), content.size()));
+    close(fd);
+    (void)unlink(PLAIN_FILE);
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest002, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(SMALL_FILE_LEN);
+    ASSERT_TRUE(WriteFile(PLAIN_FILE, content));
+    int fd = open(PLAIN_FILE, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    vector<uint8_t> fileMd;
+    EXPECT_EQ(MdOfFd(fd, RANGE_OFFSET, RANGE_LEN, fileMd), HCF_SUCCESS);
+    EXPECT_EQ(fileMd, MdOfBuffer(content.data() + RANGE_OFFSET, RANGE_LEN));
+    EXPECT_EQ(MdOfFd(fd, RANGE_OFFSET, 0, fileMd), HCF_SUCCESS);
+    EXPECT_EQ(fileMd, MdOfBuffer(content.data() + RANGE_OFFSET, SMALL_FILE_LEN - RANGE_OFFSET));
+    close(fd);
+    (void)unlink(PLAIN_FILE);
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest003, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(SMALL_FILE_LEN);
+    int fds[2] = { -1, -1 };
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], content.data(), content.size()), static_cast<ssize_t>(content.size()));
+    close(fds[1]);
+    vector<uint8_t> fileMd;
+    EXPECT_EQ(MdOfFd(fds[0], 0, 0, fileMd), HCF_SUCCESS);
+    EXPECT_EQ(fileMd, MdOfBuffer(content.data(), content.size()));
+    close(fds[0]);
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest004, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(SMALL_FILE_LEN);
+    ASSERT_TRUE(WriteFile(PLAIN_FILE, content));
+    int fd = open(PLAIN_FILE, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    vector<uint8_t> fileMd;
+    EXPECT_EQ(MdOfFd(fd, SMALL_FILE_LEN, RANGE_LEN, fileMd), HCF_INVALID_PARAMS);
+    EXPECT_EQ(MdOfFd(fd, SMALL_FILE_LEN + 1, 0, fileMd), HCF_INVALID_PARAMS);
+    EXPECT_EQ(MdOfFd(-1, 0, 0, fileMd), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfMdUpdateFd(nullptr, fd, 0, 0), HCF_INVALID_PARAMS);
+    close(fd);
+    (void)unlink(PLAIN_FILE);
+
+    int fds[2] = { -1, -1 };
+    ASSERT_EQ(pipe(fds), 0);
+    close(fds[1]);
+    EXPECT_EQ(MdOfFd(fds[0], 1, 0, fileMd), HCF_INVALID_PARAMS);
+    close(fds[0]);
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest005, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(LARGE_FILE_LEN);
+    ASSERT_TRUE(WriteFile(PLAIN_FILE, content));
+    HcfSymKey *key = GenerateAesKey();
+    ASSERT_NE(key, nullptr);
+    HcfHmacParamsSpec params = {};
+    params.base.algName = "HMAC";
+    params.mdName = "SHA256";
+    HcfMac *fileMac = nullptr;
+    HcfMac *bufMac = nullptr;
+    ASSERT_EQ(HcfMacCreate(reinterpret_cast<HcfMacParamsSpec *>(&params), &fileMac), HCF_SUCCESS);
+    ASSERT_EQ(HcfMacCreate(reinterpret_cast<HcfMacParamsSpec *>(&params), &bufMac), HCF_SUCCESS);
+    ASSERT_EQ(fileMac->init(fileMac, key), HCF_SUCCESS);
+    ASSERT_EQ(bufMac->init(bufMac, key), HCF_SUCCESS);
+
+    int fd = open(PLAIN_FILE, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(HcfMacUpdateFd(fileMac, fd, 0, 0), HCF_SUCCESS);
+    close(fd);
+    HcfBlob input = { .data = content.data(), .len = content.size() };
+    EXPECT_EQ(bufMac->update(bufMac, &input), HCF_SUCCESS);
+    HcfBlob fileOut = { .data = nullptr, .len = 0 };
+    HcfBlob bufOut = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(fileMac->doFinal(fileMac, &fileOut), HCF_SUCCESS);
+    EXPECT_EQ(bufMac->doFinal(bufMac, &bufOut), HCF_SUCCESS);
+    ASSERT_EQ(fileOut.len, bufOut.len);
+    EXPECT_EQ(memcmp(fileOut.data, bufOut.data, fileOut.len), 0);
+    HcfBlobDataFree(&fileOut);
+    HcfBlobDataFree(&bufOut);
+    HcfObjDestroy(fileMac);
+    HcfObjDestroy(bufMac);
+    HcfObjDestroy(key);
+    (void)unlink(PLAIN_FILE);
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest006, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(LARGE_FILE_LEN);
+    ASSERT_TRUE(WriteFile(PLAIN_FILE, content));
+    HcfSymKey *key = GenerateAesKey();
+    ASSERT_NE(key, nullptr);
+    EXPECT_EQ(CipherFile(key, ENCRYPT_MODE, PLAIN_FILE, ENC_FILE), HCF_SUCCESS);
+    EXPECT_EQ(CipherFile(key, DECRYPT_MODE, ENC_FILE, DEC_FILE), HCF_SUCCESS);
+    vector<uint8_t> encrypted;
+    vector<uint8_t> decrypted;
+    EXPECT_TRUE(ReadFile(ENC_FILE, encrypted));
+    EXPECT_TRUE(ReadFile(DEC_FILE, decrypted));
+    EXPECT_EQ(encrypted.size(), content.size());
+    EXPECT_NE(encrypted, content);
+    EXPECT_EQ(decrypted, content);
+    HcfObjDestroy(key);
+    (void)unlink(PLAIN_FILE);
+    (void)unlink(ENC_FILE);
+    (void)unlink(DEC_FILE);
+}
+
+HWTEST_F(CryptoFileCryptoTest, CryptoFileCryptoTest007, TestSize.Level0)
+{
+    vector<uint8_t> content = MakeContent(SMALL_FILE_LEN);
+    ASSERT_TRUE(WriteFile(PLAIN_FILE, content));
+    HcfSymKey *key = GenerateAesKey();
+    ASSERT_NE(key, nullptr);
+    uint8_t iv[16] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = sizeof(iv);
+    HcfCipher *cipher = nullptr;
+    ASSERT_EQ(HcfCipherCreate("AES256|CTR|NoPadding", &cipher), HCF_SUCCESS);
+    ASSERT_EQ(cipher->init(cipher, ENCRYPT_MODE, &key->key, &ivSpec.base), HCF_SUCCESS);
+    int fd = open(PLAIN_FILE, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(HcfCipherUpdateFd(cipher, fd, 0, 0, -1), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfCipherUpdateFd(nullptr, fd, 0, 0, fd), HCF_INVALID_PARAMS);
+    /* Writing into a read only descriptor is an I/O error. */
+    EXPECT_EQ(HcfCipherUpdateFd(cipher, fd, 0, 0, fd), HCF_ERR_CRYPTO_OPERATION);
+    close(fd);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(key);
+    (void)unlink(PLAIN_FILE);
+}
+}
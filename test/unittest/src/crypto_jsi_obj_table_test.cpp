@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "jsi_obj_table.h"
+
+using namespace std;
+using namespace testing::ext;
+using namespace OHOS::ACELite;
+
+namespace {
+class CryptoJsiObjTableTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void CryptoJsiObjTableTest::SetUp() {}
+void CryptoJsiObjTableTest::TearDown() {}
+void CryptoJsiObjTableTest::SetUpTestCase() {}
+void CryptoJsiObjTableTest::TearDownTestCase() {}
+
+/* Object addresses are word aligned, keep the low bits clear like real heap pointers. */
+constexpr uint32_t ADDR_BASE = 0x20000000;
+constexpr uint32_t ADDR_STRIDE = 0x40;
+constexpr uint32_t CHURN_ROUNDS = 1000;
+/* Every probe stays inside one run of occupied slots, a list scan would visit all the live objects instead. */
+constexpr uint32_t MAX_OCCUPIED_RUN = 32;
+
+static uint32_t g_visited = 0;
+
+static uint32_t MakeAddr(uint32_t index)
+{
+    return ADDR_BASE + index * ADDR_STRIDE;
+}
+
+static void CountVisit(uint32_t addr)
+{
+    (void)addr;
+    g_visited++;
+}
+
+static uint32_t LongestOccupiedRun(const ObjTable &table)
+{
+    uint32_t longest = 0;
+    for (uint32_t start = 0; start < JSI_OBJ_TABLE_CAPACITY; start++) {
+        uint32_t len = 0;
+        while ((len < JSI_OBJ_TABLE_CAPACITY) && (table.slots[(start + len) % JSI_OBJ_TABLE_CAPACITY] != 0)) {
+            len++;
+        }
+        longest = (len > longest) ? len : longest;
+    }
+    return longest;
+}
+
+HWTEST_F(CryptoJsiObjTableTest, CryptoJsiObjTableTest001, TestSize.Level0)
+{
+    ObjTable table;
+    ObjTableInit(&table);
+    EXPECT_EQ(ObjTableAdd(&table, MakeAddr(1)), HCF_SUCCESS);
+    EXPECT_EQ(ObjTableAdd(&table, MakeAddr(2)), HCF_SUCCESS);
+    EXPECT_EQ(ObjTableAdd(&table, MakeAddr(1)), HCF_INVALID_PARAMS);
+    EXPECT_EQ(ObjTableAdd(&table, 0), HCF_INVALID_PARAMS);
+    EXPECT_EQ(ObjTableCount(&table), 2);
+    EXPECT_TRUE(ObjTableFind(&table, MakeAddr(1)));
+    EXPECT_FALSE(ObjTableFind(&table, MakeAddr(3)));
+    EXPECT_TRUE(ObjTableDelete(&table, MakeAddr(1)));
+    EXPECT_FALSE(ObjTableDelete(&table, MakeAddr(1)));
+    EXPECT_FALSE(ObjTableFind(&table, MakeAddr(1)));
+    EXPECT_TRUE(ObjTableFind(&table, MakeAddr(2)));
+    EXPECT_EQ(ObjTableCount(&table), 1);
+    EXPECT_EQ(ObjTableAdd(nullptr, MakeAddr(1)), HCF_INVALID_PARAMS);
+    EXPECT_FALSE(ObjTableFind(nullptr, MakeAddr(1)));
+    EXPECT_FALSE(ObjTableDelete(nullptr, MakeAddr(1)));
+}
+
+HWTEST_F(CryptoJsiObjTableTest, CryptoJsiObjTableTest002, TestSize.Level0)
+{
+    ObjTable table;
+    ObjTableInit(&table);
+    for (uint32_t i = 0; i < JSI_OBJ_TABLE_MAX_COUNT; i++) {
+        ASSERT_EQ(ObjTableAdd(&table, MakeAddr(i)), HCF_SUCCESS);
+    }
+    EXPECT_EQ(ObjTableAdd(&table, MakeAddr(JSI_OBJ_TABLE_MAX_COUNT)), HCF_ERR_MALLOC);
+    /* Delete every other entry, the shifted probe runs must still reach all the others. */
+    for (uint32_t i = 0; i < JSI_OBJ_TABLE_MAX_COUNT; i += 2) {
+        ASSERT_TRUE(ObjTableDelete(&table, MakeAddr(i)));
+    }
+    for (uint32_t i = 0; i < JSI_OBJ_TABLE_MAX_COUNT; i++) {
+        EXPECT_EQ(ObjTableFind(&table, MakeAddr(i)), (i % 2) == 1);
+    }
+    EXPECT_EQ(ObjTableCount(&table), JSI_OBJ_TABLE_MAX_COUNT / 2);
+}
+
+HWTEST_F(CryptoJsiObjTableTest, CryptoJsiObjTableTest003, TestSize.Level0)
+{
+    ObjTable table;
+    ObjTableInit(&table);
+    uint32_t count = JSI_OBJ_TABLE_MAX_COUNT / 2;
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_EQ(ObjTableAdd(&table, MakeAddr(i)), HCF_SUCCESS);
+    }
+    g_visited = 0;
+    ObjTableClear(&table, CountVisit);
+    EXPECT_EQ(g_visited, count);
+    EXPECT_EQ(ObjTableCount(&table), 0);
+    EXPECT_FALSE(ObjTableFind(&table, MakeAddr(0)));
+    EXPECT_EQ(ObjTableAdd(&table, MakeAddr(0)), HCF_SUCCESS);
+}
+
+HWTEST_F(CryptoJsiObjTableTest, CryptoJsiObjTableTest004, TestSize.Level0)
+{
+    ObjTable table;
+    ObjTableInit(&table);
+    for (uint32_t i = 0; i < JSI_OBJ_TABLE_MAX_COUNT - 1; i++) {
+        ASSERT_EQ(ObjTableAdd(&table, MakeAddr(i)), HCF_SUCCESS);
+    }
+    EXPECT_LE(LongestOccupiedRun(table), MAX_OCCUPIED_RUN);
+    /* Backward shift deletion leaves no tombstones, so add and delete of a fresh object restores every slot. */
+    ObjTable snapshot = table;
+    for (uint32_t round = 0; round < CHURN_ROUNDS; round++) {
+        uint32_t addr = MakeAddr(JSI_OBJ_TABLE_MAX_COUNT + round);
+        ASSERT_EQ(ObjTableAdd(&table, addr), HCF_SUCCESS);
+        EXPECT_TRUE(ObjTableFind(&table, addr));
+        ASSERT_TRUE(ObjTableDelete(&table, addr));
+    }
+    EXPECT_EQ(memcmp(&snapshot, &table, sizeof(ObjTable)), 0);
+    EXPECT_LE(LongestOccupiedRun(table), MAX_OCCUPIED_RUN);
+}
+}
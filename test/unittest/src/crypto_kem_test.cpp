@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <securec.h>
 #include <cstring>
+#include <vector>
 
 #include "utils.h"
 #include "kem.h"
@@ -806,4 +807,175 @@ HWTEST_F(CryptoKemTest, CryptoKemStressTest001, TestSize.Level0)
     HcfObjDestroy(kem);
 }
 
+/* ====================================================================
+ *  Batch encapsulate/decapsulate tests
+ * ==================================================================== */
+
+static bool IsAllZero(const HcfBlob &blob)
+{
+    for (size_t i = 0; i < blob.len; i++) {
+        if (blob.data[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void AllocBatchBlob(HcfBlob &blob, size_t len)
+{
+    blob.data = static_cast<uint8_t *>(HcfMalloc(len, 0));
+    blob.len = (blob.data == nullptr) ? 0 : len;
+}
+
+/**
+ * @tc.name: CryptoKemBatchTest001
+ * @tc.desc: getOutputLen reports the fixed ML-KEM output lengths
+ * @tc.type: FUNC
+ */
+HWTEST_F(CryptoKemTest, CryptoKemBatchTest001, TestSize.Level0)
+{
+    const char *algoNames[] = { "ML-KEM512", "ML-KEM768", "ML-KEM1024" };
+    const uint32_t wrappedKeyLens[] = { 768, 1088, 1568 };
+    for (size_t i = 0; i < sizeof(algoNames) / sizeof(algoNames[0]); i++) {
+        HcfKem *kem = nullptr;
+        ASSERT_EQ(HcfKemCreate(algoNames[i], &kem), HCF_SUCCESS);
+        uint32_t sharedSecretLen = 0;
+        uint32_t wrappedKeyLen = 0;
+        EXPECT_EQ(kem->getOutputLen(kem, &sharedSecretLen, &wrappedKeyLen), HCF_SUCCESS);
+        EXPECT_EQ(sharedSecretLen, 32U);
+        EXPECT_EQ(wrappedKeyLen, wrappedKeyLens[i]);
+        EXPECT_NE(kem->getOutputLen(kem, nullptr, &wrappedKeyLen), HCF_SUCCESS);
+        HcfObjDestroy(kem);
+    }
+}
+
+/**
+ * @tc.name: CryptoKemBatchTest002
+ * @tc.desc: Batch encapsulate to several keys, serial and with workers, each result decapsulates correctly
+ * @tc.type: FUNC
+ */
+HWTEST_F(CryptoKemTest, CryptoKemBatchTest002, TestSize.Level0)
+{
+    HcfKeyPair *otherKeyPair = nullptr;
+    ASSERT_EQ(GenerateMlKemKeyPair("ML-KEM-768", &otherKeyPair), HCF_SUCCESS);
+    HcfKem *kem = nullptr;
+    ASSERT_EQ(HcfKemCreate("ML-KEM768", &kem), HCF_SUCCESS);
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    ASSERT_EQ(kem->getOutputLen(kem, &sharedSecretLen, &wrappedKeyLen), HCF_SUCCESS);
+
+    vector<HcfPubKey *> pubKeys = { pubKey_, pubKey_, otherKeyPair->pubKey, pubKey_, otherKeyPair->pubKey,
+        otherKeyPair->pubKey, pubKey_ };
+    vector<HcfPriKey *> priKeys = { priKey_, priKey_, otherKeyPair->priKey, priKey_, otherKeyPair->priKey,
+        otherKeyPair->priKey, priKey_ };
+    uint32_t count = static_cast<uint32_t>(pubKeys.size());
+    const uint32_t workerNums[] = { 0, 1, 3, 64 };
+    for (uint32_t workerNum : workerNums) {
+        HcfBlob sharedSecrets = { .data = nullptr, .len = 0 };
+        HcfBlob wrappedKeys = { .data = nullptr, .len = 0 };
+        AllocBatchBlob(sharedSecrets, count * sharedSecretLen);
+        AllocBatchBlob(wrappedKeys, count * wrappedKeyLen);
+        ASSERT_EQ(kem->encapsulateBatch(kem, pubKeys.data(), count, workerNum, &sharedSecrets, &wrappedKeys),
+            HCF_SUCCESS);
+        for (uint32_t i = 0; i < count; i++) {
+            HcfBlob wrappedKey = { .data = wrappedKeys.data + i * wrappedKeyLen, .len = wrappedKeyLen };
+            HcfBlob sharedSecret = { .data = nullptr, .len = 0 };
+            ASSERT_EQ(kem->decapsulate(kem, priKeys[i], &wrappedKey, &sharedSecret), HCF_SUCCESS);
+            ASSERT_EQ(sharedSecret.len, sharedSecretLen);
+            EXPECT_EQ(memcmp(sharedSecret.data, sharedSecrets.data + i * sharedSecretLen, sharedSecretLen), 0)
+                << "workerNum " << workerNum << " index " << i;
+            HcfBlobDataClearAndFree(&sharedSecret);
+        }
+        HcfBlobDataClearAndFree(&sharedSecrets);
+        HcfBlobDataClearAndFree(&wrappedKeys);
+    }
+    HcfObjDestroy(kem);
+    HcfObjDestroy(otherKeyPair);
+}
+
+/**
+ * @tc.name: CryptoKemBatchTest003
+ * @tc.desc: Batch decapsulate under one private key matches the single call results
+ * @tc.type: FUNC
+ */
+HWTEST_F(CryptoKemTest, CryptoKemBatchTest003, TestSize.Level0)
+{
+    HcfKem *kem = nullptr;
+    ASSERT_EQ(HcfKemCreate("ML-KEM768", &kem), HCF_SUCCESS);
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    ASSERT_EQ(kem->getOutputLen(kem, &sharedSecretLen, &wrappedKeyLen), HCF_SUCCESS);
+
+    const uint32_t count = 9;
+    vector<uint8_t> expected(count * sharedSecretLen);
+    HcfBlob wrappedKeys = { .data = nullptr, .len = 0 };
+    AllocBatchBlob(wrappedKeys, count * wrappedKeyLen);
+    ASSERT_NE(wrappedKeys.data, nullptr);
+    for (uint32_t i = 0; i < count; i++) {
+        HcfBlob sharedSecret = { .data = nullptr, .len = 0 };
+        HcfBlob wrappedKey = { .data = nullptr, .len = 0 };
+        ASSERT_EQ(kem->encapsulate(kem, pubKey_, nullptr, &sharedSecret, &wrappedKey), HCF_SUCCESS);
+        (void)memcpy_s(wrappedKeys.data + i * wrappedKeyLen, wrappedKeyLen, wrappedKey.data, wrappedKey.len);
+        (void)memcpy_s(expected.data() + i * sharedSecretLen, sharedSecretLen, sharedSecret.data, sharedSecret.len);
+        HcfBlobDataClearAndFree(&sharedSecret);
+        HcfBlobDataClearAndFree(&wrappedKey);
+    }
+    const uint32_t workerNums[] = { 0, 4, 16 };
+    for (uint32_t workerNum : workerNums) {
+        HcfBlob sharedSecrets = { .data = nullptr, .len = 0 };
+        AllocBatchBlob(sharedSecrets, count * sharedSecretLen);
+        ASSERT_EQ(kem->decapsulateBatch(kem, priKey_, &wrappedKeys, count, workerNum, &sharedSecrets), HCF_SUCCESS);
+        EXPECT_EQ(memcmp(sharedSecrets.data, expected.data(), expected.size()), 0) << "workerNum " << workerNum;
+        HcfBlobDataClearAndFree(&sharedSecrets);
+    }
+    HcfBlobDataClearAndFree(&wrappedKeys);
+    HcfObjDestroy(kem);
+}
+
+/**
+ * @tc.name: CryptoKemBatchTest004
+ * @tc.desc: Batch calls reject mismatched buffers, counts, worker numbers and keys
+ * @tc.type: FUNC
+ */
+HWTEST_F(CryptoKemTest, CryptoKemBatchTest004, TestSize.Level0)
+{
+    HcfKeyPair *keyPair512 = nullptr;
+    ASSERT_EQ(GenerateMlKemKeyPair("ML-KEM-512", &keyPair512), HCF_SUCCESS);
+    HcfKem *kem = nullptr;
+    ASSERT_EQ(HcfKemCreate("ML-KEM768", &kem), HCF_SUCCESS);
+    uint32_t sharedSecretLen = 0;
+    uint32_t wrappedKeyLen = 0;
+    ASSERT_EQ(kem->getOutputLen(kem, &sharedSecretLen, &wrappedKeyLen), HCF_SUCCESS);
+
+    const uint32_t count = 2;
+    HcfBlob sharedSecrets = { .data = nullptr, .len = 0 };
+    HcfBlob wrappedKeys = { .data = nullptr, .len = 0 };
+    AllocBatchBlob(sharedSecrets, count * sharedSecretLen);
+    AllocBatchBlob(wrappedKeys, count * wrappedKeyLen);
+    HcfPubKey *pubKeys[] = { pubKey_, pubKey_ };
+    EXPECT_NE(kem->encapsulateBatch(kem, pubKeys, 0, 0, &sharedSecrets, &wrappedKeys), HCF_SUCCESS);
+    EXPECT_NE(kem->encapsulateBatch(kem, pubKeys, count + 1, 0, &sharedSecrets, &wrappedKeys), HCF_SUCCESS);
+    EXPECT_NE(kem->encapsulateBatch(kem, pubKeys, count, HCF_KEM_MAX_BATCH_WORKER_NUM + 1, &sharedSecrets,
+        &wrappedKeys), HCF_SUCCESS);
+    EXPECT_NE(kem->encapsulateBatch(kem, nullptr, count, 0, &sharedSecrets, &wrappedKeys), HCF_SUCCESS);
+    HcfPubKey *nullKeys[] = { pubKey_, nullptr };
+    EXPECT_NE(kem->encapsulateBatch(kem, nullKeys, count, 0, &sharedSecrets, &wrappedKeys), HCF_SUCCESS);
+
+    /* a key of another parameter set in the middle fails the whole batch and clears the output */
+    HcfPubKey *mixedKeys[] = { pubKey_, keyPair512->pubKey };
+    EXPECT_NE(kem->encapsulateBatch(kem, mixedKeys, count, 0, &sharedSecrets, &wrappedKeys), HCF_SUCCESS);
+    EXPECT_TRUE(IsAllZero(sharedSecrets));
+    EXPECT_TRUE(IsAllZero(wrappedKeys));
+
+    EXPECT_NE(kem->decapsulateBatch(kem, keyPair512->priKey, &wrappedKeys, count, 0, &sharedSecrets), HCF_SUCCESS);
+    HcfBlob shortWrappedKeys = { .data = wrappedKeys.data, .len = wrappedKeys.len - 1 };
+    EXPECT_NE(kem->decapsulateBatch(kem, priKey_, &shortWrappedKeys, count, 0, &sharedSecrets), HCF_SUCCESS);
+    EXPECT_NE(kem->decapsulateBatch(kem, priKey_, &wrappedKeys, count, 0, nullptr), HCF_SUCCESS);
+
+    HcfBlobDataClearAndFree(&sharedSecrets);
+    HcfBlobDataClearAndFree(&wrappedKeys);
+    HcfObjDestroy(kem);
+    HcfObjDestroy(keyPair512);
+}
+
 } // namespace
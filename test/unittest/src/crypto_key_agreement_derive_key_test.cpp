@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "securec.h"
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "detailed_hkdf_params.h"
+#include "detailed_x963kdf_params.h"
+#include "kdf.h"
+#include "key_agreement.h"
+#include "memory.h"
+#include "memory_mock.h"
+#include "openssl_adapter_mock.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t DERIVED_KEY_LEN = 42;
+constexpr uint32_t SHA256_LEN = 32;
+
+class CryptoKeyAgreementDeriveKeyTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+
+    static HcfKeyPair *eccKeyPair_;
+    static HcfKeyPair *x25519KeyPair_;
+    static HcfKeyPair *dhKeyPair_;
+};
+
+HcfKeyPair *CryptoKeyAgreementDeriveKeyTest::eccKeyPair_ = nullptr;
+HcfKeyPair *CryptoKeyAgreementDeriveKeyTest::x25519KeyPair_ = nullptr;
+HcfKeyPair *CryptoKeyAgreementDeriveKeyTest::dhKeyPair_ = nullptr;
+
+static uint8_t g_salt[] = "derive key salt";
+static uint8_t g_info[] = "derive key info";
+
+static HcfKeyPair *GenerateKeyPair(const char *algoName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algoName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfKeyPair *keyPair = nullptr;
+    (void)generator->generateKeyPair(generator, nullptr, &keyPair);
+    HcfObjDestroy(generator);
+    return keyPair;
+}
+
+void CryptoKeyAgreementDeriveKeyTest::SetUpTestCase()
+{
+    eccKeyPair_ = GenerateKeyPair("ECC256");
+    x25519KeyPair_ = GenerateKeyPair("X25519");
+    dhKeyPair_ = GenerateKeyPair("DH_ffdhe2048");
+    ASSERT_NE(eccKeyPair_, nullptr);
+    ASSERT_NE(x25519KeyPair_, nullptr);
+    ASSERT_NE(dhKeyPair_, nullptr);
+}
+
+void CryptoKeyAgreementDeriveKeyTest::TearDownTestCase()
+{
+    HcfObjDestroy(eccKeyPair_);
+    HcfObjDestroy(x25519KeyPair_);
+    HcfObjDestroy(dhKeyPair_);
+}
+
+void CryptoKeyAgreementDeriveKeyTest::SetUp() {}
+void CryptoKeyAgreementDeriveKeyTest::TearDown() {}
+
+static HcfKeyAgreementKdfSpec MakeKdfSpec(const char *algName, const char *mdName, bool withSalt)
+{
+    HcfKeyAgreementKdfSpec spec = {
+        .algName = algName,
+        .mdName = mdName,
+        .salt = { .data = withSalt ? g_salt : nullptr, .len = withSalt ? sizeof(g_salt) : 0 },
+        .info = { .data = g_info, .len = sizeof(g_info) },
+        .keyLen = DERIVED_KEY_LEN,
+    };
+    return spec;
+}
+
+/* The reference result, the shared secret of generateSecret fed into an HcfKdf of the same spec. */
+static vector<uint8_t> DeriveBySteps(const char *agreementName, HcfKeyPair *keyPair,
+    const HcfKeyAgreementKdfSpec &spec)
+{
+    HcfKeyAgreement *keyAgreement = nullptr;
+    EXPECT_EQ(HcfKeyAgreementCreate(agreementName, &keyAgreement), HCF_SUCCESS);
+    HcfBlob secret = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(keyAgreement->generateSecret(keyAgreement, keyPair->priKey, keyPair->pubKey, &secret), HCF_SUCCESS);
+    HcfObjDestroy(keyAgreement);
+
+    string kdfName = string(spec.algName) + "|" + spec.mdName;
+    HcfKdf *kdf = nullptr;
+    EXPECT_EQ(HcfKdfCreate(kdfName.c_str(), &kdf), HCF_SUCCESS);
+    vector<uint8_t> out(spec.keyLen);
+    HcfBlob output = { .data = out.data(), .len = spec.keyLen };
+    if (strcmp(spec.algName, "HKDF") == 0) {
+        HcfHkdfParamsSpec params = {
+            .base = { .algName = "HKDF" },
+            .key = secret,
+            .salt = spec.salt,
+            .info = spec.info,
+            .output = output,
+        };
+        EXPECT_EQ(kdf->generateSecret(kdf, &params.base), HCF_SUCCESS);
+    } else {
+        HcfX963KDFParamsSpec params = {
+            .base = { .algName = "X963KDF" },
+            .key = secret,
+            .info = spec.info,
+            .output = output,
+        };
+        EXPECT_EQ(kdf->generateSecret(kdf, &params.base), HCF_SUCCESS);
+    }
+    HcfObjDestroy(kdf);
+    HcfBlobDataClearAndFree(&secret);
+    return out;
+}
+
+static void CheckDeriveKey(const char *agreementName, HcfKeyPair *keyPair, const HcfKeyAgreementKdfSpec &spec)
+{
+    HcfKeyAgreement *keyAgreement = nullptr;
+    ASSERT_EQ(HcfKeyAgreementCreate(agreementName, &keyAgreement), HCF_SUCCESS);
+    HcfBlob key = { .data = nullptr, .len = 0 };
+    HcfResult res = keyAgreement->deriveKey(keyAgreement, keyPair->priKey, keyPair->pubKey, &spec, &key);
+    HcfObjDestroy(keyAgreement);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    ASSERT_EQ(key.len, spec.keyLen);
+    vector<uint8_t> expected = DeriveBySteps(agreementName, keyPair, spec);
+    EXPECT_EQ(memcmp(key.data, expected.data(), key.len), 0);
+    HcfBlobDataClearAndFree(&key);
+}
+
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest001, TestSize.Level0)
+{
+    CheckDeriveKey("ECC256", eccKeyPair_, MakeKdfSpec("HKDF", "SHA256", true));
+    CheckDeriveKey("ECC256", eccKeyPair_, MakeKdfSpec("HKDF", "SM3", true));
+    CheckDeriveKey("ECC256", eccKeyPair_, MakeKdfSpec("X963KDF", "SHA512", false));
+}
+
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest002, TestSize.Level0)
+{
+    CheckDeriveKey("X25519", x25519KeyPair_, MakeKdfSpec("HKDF", "SHA384", true));
+    CheckDeriveKey("X25519", x25519KeyPair_, MakeKdfSpec("X963KDF", "SHA256", false));
+}
+
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest003, TestSize.Level0)
+{
+    CheckDeriveKey("DH_ffdhe2048", dhKeyPair_, MakeKdfSpec("HKDF", "SHA256", true));
+    CheckDeriveKey("DH_ffdhe2048", dhKeyPair_, MakeKdfSpec("X963KDF", "SHA1", false));
+}
+
+/* Without a salt HKDF uses a salt of hash length zeros. */
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest004, TestSize.Level0)
+{
+    HcfKeyAgreement *keyAgreement = nullptr;
+    ASSERT_EQ(HcfKeyAgreementCreate("X25519", &keyAgreement), HCF_SUCCESS);
+    HcfKeyAgreementKdfSpec spec = MakeKdfSpec("HKDF", "SHA256", false);
+    HcfBlob key = { .data = nullptr, .len = 0 };
+    HcfResult res = keyAgreement->deriveKey(keyAgreement, x25519KeyPair_->priKey, x25519KeyPair_->pubKey, &spec,
+        &key);
+    HcfObjDestroy(keyAgreement);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    uint8_t zeroSalt[SHA256_LEN] = { 0 };
+    spec.salt = { .data = zeroSalt, .len = sizeof(zeroSalt) };
+    vector<uint8_t> expected = DeriveBySteps("X25519", x25519KeyPair_, spec);
+    ASSERT_EQ(key.len, expected.size());
+    EXPECT_EQ(memcmp(key.data, expected.data(), key.len), 0);
+    HcfBlobDataClearAndFree(&key);
+}
+
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest005, TestSize.Level0)
+{
+    HcfKeyAgreement *keyAgreement = nullptr;
+    ASSERT_EQ(HcfKeyAgreementCreate("ECC256", &keyAgreement), HCF_SUCCESS);
+    HcfPriKey *priKey = eccKeyPair_->priKey;
+    HcfPubKey *pubKey = eccKeyPair_->pubKey;
+    HcfKeyAgreementKdfSpec spec = MakeKdfSpec("HKDF", "SHA256", true);
+    HcfBlob key = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(keyAgreement->deriveKey(nullptr, priKey, pubKey, &spec, &key), HCF_INVALID_PARAMS);
+    EXPECT_EQ(keyAgreement->deriveKey(keyAgreement, nullptr, pubKey, &spec, &key), HCF_INVALID_PARAMS);
+    EXPECT_EQ(keyAgreement->deriveKey(keyAgreement, priKey, nullptr, &spec, &key), HCF_INVALID_PARAMS);
+    EXPECT_EQ(keyAgreement->deriveKey(keyAgreement, priKey, pubKey, nullptr, &key), HCF_INVALID_PARAMS);
+    EXPECT_EQ(keyAgreement->deriveKey(keyAgreement, priKey, pubKey, &spec, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(keyAgreement->deriveKey(keyAgreement, x25519KeyPair_->priKey, x25519KeyPair_->pubKey, &spec, &key),
+        HCF_INVALID_PARAMS);
+
+    vector<HcfKeyAgreementKdfSpec> invalidSpecs(8, spec);
+    invalidSpecs[0].algName = "PBKDF2";
+    invalidSpecs[1].algName = nullptr;
+    invalidSpecs[2].mdName = "MD5";
+    invalidSpecs[3].keyLen = 0;
+    invalidSpecs[4].keyLen = HCF_KEY_AGREEMENT_MAX_DERIVED_KEY_LEN + 1;
+    invalidSpecs[5].info.data = nullptr;
+    invalidSpecs[6] = MakeKdfSpec("X963KDF", "SHA256", true);
+    invalidSpecs[7] = MakeKdfSpec("X963KDF", "SM3", false);
+    for (const HcfKeyAgreementKdfSpec &invalidSpec : invalidSpecs) {
+        EXPECT_EQ(keyAgreement->deriveKey(keyAgreement, priKey, pubKey, &invalidSpec, &key), HCF_INVALID_PARAMS);
+        EXPECT_EQ(key.data, nullptr);
+    }
+    HcfObjDestroy(keyAgreement);
+}
+
+static void DeriveKeyOnce(const HcfKeyAgreementKdfSpec &spec)
+{
+    HcfKeyAgreement *keyAgreement = nullptr;
+    if (HcfKeyAgreementCreate("ECC256", &keyAgreement) != HCF_SUCCESS) {
+        return;
+    }
+    HcfBlob key = { .data = nullptr, .len = 0 };
+    if (keyAgreement->deriveKey(keyAgreement, CryptoKeyAgreementDeriveKeyTest::eccKeyPair_->priKey,
+        CryptoKeyAgreementDeriveKeyTest::eccKeyPair_->pubKey, &spec, &key) == HCF_SUCCESS) {
+        HcfBlobDataClearAndFree(&key);
+    }
+    HcfObjDestroy(keyAgreement);
+}
+
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest006, TestSize.Level0)
+{
+    HcfKeyAgreementKdfSpec spec = MakeKdfSpec("HKDF", "SHA256", true);
+    StartRecordMallocNum();
+    DeriveKeyOnce(spec);
+    uint32_t mallocCount = GetMallocNum();
+    for (uint32_t i = 0; i < mallocCount; i++) {
+        ResetRecordMallocNum();
+        SetMockMallocIndex(i);
+        DeriveKeyOnce(spec);
+    }
+    EndRecordMallocNum();
+}
+
+HWTEST_F(CryptoKeyAgreementDeriveKeyTest, CryptoKeyAgreementDeriveKeyTest007, TestSize.Level0)
+{
+    HcfKeyAgreementKdfSpec spec = MakeKdfSpec("X963KDF", "SHA256", false);
+    StartRecordOpensslCallNum();
+    DeriveKeyOnce(spec);
+    uint32_t callCount = GetOpensslCallNum();
+    for (uint32_t i = 0; i < callCount; i++) {
+        ResetOpensslCallNum();
+        SetOpensslCallMockIndex(i);
+        DeriveKeyOnce(spec);
+    }
+    EndRecordOpensslCallNum();
+}
+}
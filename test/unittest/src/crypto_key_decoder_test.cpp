@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "securec.h"
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "memory.h"
+#include "openssl_key_decoder.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t TEST_REPEAT_NUM = 20;
+constexpr uint32_t TEST_THREAD_NUM = 8;
+
+/* every algorithm whose convertKey or convertPemKey goes through the decoders of openssl_key_decoder.c */
+const char *g_convertAlgNames[] = { "RSA2048", "ECC256", "ECC_BrainPoolP256r1", "SM2_256", "X25519", "Ed25519",
+    "DH_modp2048" };
+
+class CryptoKeyDecoderTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+vector<uint8_t> EncodePubKey(EVP_PKEY *pkey)
+{
+    unsigned char *der = nullptr;
+    int len = i2d_PUBKEY(pkey, &der);
+    vector<uint8_t> out;
+    if (len > 0) {
+        out.assign(der, der + len);
+    }
+    OPENSSL_free(der);
+    return out;
+}
+
+vector<uint8_t> EncodePkcs8PriKey(EVP_PKEY *pkey)
+{
+    PKCS8_PRIV_KEY_INFO *p8 = EVP_PKEY2PKCS8(pkey);
+    unsigned char *der = nullptr;
+    int len = i2d_PKCS8_PRIV_KEY_INFO(p8, &der);
+    vector<uint8_t> out;
+    if (len > 0) {
+        out.assign(der, der + len);
+    }
+    OPENSSL_free(der);
+    PKCS8_PRIV_KEY_INFO_free(p8);
+    return out;
+}
+
+bool IsSameBlob(const HcfBlob &left, const HcfBlob &right)
+{
+    return (left.len == right.len) && (memcmp(left.data, right.data, left.len) == 0);
+}
+
+/* Converting the encodings of a generated pair must give back keys with exactly the same encodings. */
+void CheckConvertKey(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate(algName, &generator), HCF_SUCCESS);
+    HcfKeyPair *keyPair = nullptr;
+    ASSERT_EQ(generator->generateKeyPair(generator, nullptr, &keyPair), HCF_SUCCESS);
+    HcfBlob pubBlob = { .data = nullptr, .len = 0 };
+    HcfBlob priBlob = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(keyPair->pubKey->base.getEncoded(&keyPair->pubKey->base, &pubBlob), HCF_SUCCESS);
+    ASSERT_EQ(keyPair->priKey->base.getEncoded(&keyPair->priKey->base, &priBlob), HCF_SUCCESS);
+
+    for (uint32_t i = 0; i < TEST_REPEAT_NUM; i++) {
+        HcfKeyPair *converted = nullptr;
+        ASSERT_EQ(generator->convertKey(generator, nullptr, &pubBlob, &priBlob, &converted), HCF_SUCCESS) << algName;
+        HcfBlob pubOut = { .data = nullptr, .len = 0 };
+        HcfBlob priOut = { .data = nullptr, .len = 0 };
+        EXPECT_EQ(converted->pubKey->base.getEncoded(&converted->pubKey->base, &pubOut), HCF_SUCCESS);
+        EXPECT_EQ(converted->priKey->base.getEncoded(&converted->priKey->base, &priOut), HCF_SUCCESS);
+        EXPECT_TRUE(IsSameBlob(pubBlob, pubOut)) << algName;
+        EXPECT_TRUE(IsSameBlob(priBlob, priOut)) << algName;
+        HcfBlobDataFree(&pubOut);
+        HcfBlobDataClearAndFree(&priOut);
+        HcfObjDestroy(converted);
+    }
+    HcfBlobDataFree(&pubBlob);
+    HcfBlobDataClearAndFree(&priBlob);
+    HcfObjDestroy(keyPair);
+    HcfObjDestroy(generator);
+}
+
+/* Not every key type can write PEM itself, so the PEM strings are made by OpenSSL from the DER encodings. */
+string DerToPem(const HcfBlob &der, bool isPubKey)
+{
+    const unsigned char *data = der.data;
+    EVP_PKEY *pkey = isPubKey ? d2i_PUBKEY(nullptr, &data, der.len) : d2i_AutoPrivateKey(nullptr, &data, der.len);
+    BIO *bio = BIO_new(BIO_s_mem());
+    string pem;
+    if ((pkey != nullptr) && (bio != nullptr) && (isPubKey ? PEM_write_bio_PUBKEY(bio, pkey) :
+        PEM_write_bio_PrivateKey(bio, pkey, nullptr, nullptr, 0, nullptr, nullptr)) == 1) {
+        char *pemData = nullptr;
+        long pemLen = BIO_get_mem_data(bio, &pemData);
+        pem.assign(pemData, pemLen);
+    }
+    BIO_free(bio);
+    EVP_PKEY_free(pkey);
+    return pem;
+}
+
+void CheckConvertPemKey(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate(algName, &generator), HCF_SUCCESS);
+    HcfKeyPair *keyPair = nullptr;
+    ASSERT_EQ(generator->generateKeyPair(generator, nullptr, &keyPair), HCF_SUCCESS);
+    HcfBlob pubBlob = { .data = nullptr, .len = 0 };
+    HcfBlob priBlob = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(keyPair->pubKey->base.getEncoded(&keyPair->pubKey->base, &pubBlob), HCF_SUCCESS);
+    ASSERT_EQ(keyPair->priKey->base.getEncoded(&keyPair->priKey->base, &priBlob), HCF_SUCCESS);
+    string pubPem = DerToPem(pubBlob, true);
+    string priPem = DerToPem(priBlob, false);
+    ASSERT_FALSE(pubPem.empty() || priPem.empty()) << algName;
+
+    for (uint32_t i = 0; i < TEST_REPEAT_NUM; i++) {
+        HcfKeyPair *converted = nullptr;
+        ASSERT_EQ(generator->convertPemKey(generator, nullptr, pubPem.c_str(), priPem.c_str(), &converted),
+            HCF_SUCCESS) << algName;
+        HcfBlob pubOut = { .data = nullptr, .len = 0 };
+        HcfBlob priOut = { .data = nullptr, .len = 0 };
+        EXPECT_EQ(converted->pubKey->base.getEncoded(&converted->pubKey->base, &pubOut), HCF_SUCCESS);
+        EXPECT_EQ(converted->priKey->base.getEncoded(&converted->priKey->base, &priOut), HCF_SUCCESS);
+        EXPECT_TRUE(IsSameBlob(pubBlob, pubOut)) << algName;
+        EXPECT_TRUE(IsSameBlob(priBlob, priOut)) << algName;
+        HcfBlobDataFree(&pubOut);
+        HcfBlobDataClearAndFree(&priOut);
+        HcfObjDestroy(converted);
+    }
+    HcfBlobDataFree(&pubBlob);
+    HcfBlobDataClearAndFree(&priBlob);
+    HcfObjDestroy(keyPair);
+    HcfObjDestroy(generator);
+}
+}
+
+HWTEST_F(CryptoKeyDecoderTest, CryptoKeyDecoderTest001, TestSize.Level0)
+{
+    for (const char *algName : g_convertAlgNames) {
+        CheckConvertKey(algName);
+    }
+}
+
+HWTEST_F(CryptoKeyDecoderTest, CryptoKeyDecoderTest002, TestSize.Level0)
+{
+    for (const char *algName : g_convertAlgNames) {
+        CheckConvertPemKey(algName);
+    }
+}
+
+/* A context that failed on bad input keeps decoding good input, and the failure leaves no OpenSSL error behind. */
+HWTEST_F(CryptoKeyDecoderTest, CryptoKeyDecoderTest003, TestSize.Level0)
+{
+    EVP_PKEY *ref = EVP_EC_gen("P-256");
+    ASSERT_NE(ref, nullptr);
+    vector<uint8_t> der = EncodePubKey(ref);
+    vector<uint8_t> bad = der;
+    bad[0] ^= 0xff;
+    HcfKeyDecoderParams params = { "DER", "SubjectPublicKeyInfo", "EC", EVP_PKEY_PUBLIC_KEY };
+    ERR_clear_error();
+    for (uint32_t i = 0; i < TEST_REPEAT_NUM; i++) {
+        EVP_PKEY *pkey = nullptr;
+        EXPECT_NE(DecodeKeyByCachedDecoder(&params, bad.data(), bad.size(), &pkey), HCF_SUCCESS);
+        EXPECT_EQ(pkey, nullptr);
+        EXPECT_EQ(ERR_peek_error(), 0UL);
+        ASSERT_EQ(DecodeKeyByCachedDecoder(&params, der.data(), der.size(), &pkey), HCF_SUCCESS);
+        EXPECT_EQ(EVP_PKEY_eq(pkey, ref), 1);
+        EVP_PKEY_free(pkey);
+    }
+    EVP_PKEY *pkey = nullptr;
+    EXPECT_EQ(DecodeKeyByCachedDecoder(nullptr, der.data(), der.size(), &pkey), HCF_INVALID_PARAMS);
+    EXPECT_EQ(DecodeKeyByCachedDecoder(&params, nullptr, der.size(), &pkey), HCF_INVALID_PARAMS);
+    EXPECT_EQ(DecodeKeyByCachedDecoder(&params, der.data(), 0, &pkey), HCF_INVALID_PARAMS);
+    EXPECT_EQ(DecodeKeyByCachedDecoder(&params, der.data(), der.size(), nullptr), HCF_INVALID_PARAMS);
+    EVP_PKEY_free(ref);
+}
+
+/* More threads than pooled contexts decode at once, each must get its own key back. */
+HWTEST_F(CryptoKeyDecoderTest, CryptoKeyDecoderTest004, TestSize.Level0)
+{
+    vector<EVP_PKEY *> refs(TEST_THREAD_NUM, nullptr);
+    vector<vector<uint8_t>> ders(TEST_THREAD_NUM);
+    for (uint32_t i = 0; i < TEST_THREAD_NUM; i++) {
+        refs[i] = EVP_EC_gen("P-256");
+        ASSERT_NE(refs[i], nullptr);
+        ders[i] = EncodePkcs8PriKey(refs[i]);
+    }
+    vector<uint32_t> mismatch(TEST_THREAD_NUM, 0);
+    vector<thread> workers;
+    for (uint32_t t = 0; t < TEST_THREAD_NUM; t++) {
+        workers.emplace_back([&, t]() {
+            HcfKeyDecoderParams params = { "DER", nullptr, "EC", EVP_PKEY_KEYPAIR };
+            for (uint32_t i = 0; i < TEST_REPEAT_NUM; i++) {
+                EVP_PKEY *pkey = nullptr;
+                if ((DecodeKeyByCachedDecoder(&params, ders[t].data(), ders[t].size(), &pkey) != HCF_SUCCESS) ||
+                    (EVP_PKEY_eq(pkey, refs[t]) != 1)) {
+                    mismatch[t]++;
+                }
+                EVP_PKEY_free(pkey);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    for (uint32_t i = 0; i < TEST_THREAD_NUM; i++) {
+        EXPECT_EQ(mismatch[i], 0U);
+        EVP_PKEY_free(refs[i]);
+    }
+}
+
+HWTEST_F(CryptoKeyDecoderTest, CryptoKeyDecoderTest005, TestSize.Level0)
+{
+    EVP_PKEY *ref = EVP_RSA_gen(2048);
+    ASSERT_NE(ref, nullptr);
+    vector<uint8_t> pkcs8 = EncodePkcs8PriKey(ref);
+    RSA *rsa = DecodeRsaPkcs8PriKeyDirect(pkcs8.data(), pkcs8.size());
+    ASSERT_NE(rsa, nullptr);
+    EVP_PKEY *pkey = EVP_PKEY_new();
+    ASSERT_EQ(EVP_PKEY_assign_RSA(pkey, rsa), 1);
+    EXPECT_EQ(EVP_PKEY_eq(pkey, ref), 1);
+    EVP_PKEY_free(pkey);
+
+    // The traditional RSAPrivateKey form, a truncated key and a non RSA key are left to the generic decoders.
+    unsigned char *traditional = nullptr;
+    int traditionalLen = i2d_RSAPrivateKey(EVP_PKEY_get0_RSA(ref), &traditional);
+    ASSERT_GT(traditionalLen, 0);
+    EXPECT_EQ(DecodeRsaPkcs8PriKeyDirect(traditional, traditionalLen), nullptr);
+    OPENSSL_free(traditional);
+    EXPECT_EQ(DecodeRsaPkcs8PriKeyDirect(pkcs8.data(), pkcs8.size() / 2), nullptr);
+    EVP_PKEY *ec = EVP_EC_gen("P-256");
+    vector<uint8_t> ecPkcs8 = EncodePkcs8PriKey(ec);
+    EXPECT_EQ(DecodeRsaPkcs8PriKeyDirect(ecPkcs8.data(), ecPkcs8.size()), nullptr);
+    EXPECT_EQ(DecodeRsaPkcs8PriKeyDirect(nullptr, pkcs8.size()), nullptr);
+    EVP_PKEY_free(ec);
+    EVP_PKEY_free(ref);
+}
+
+HWTEST_F(CryptoKeyDecoderTest, CryptoKeyDecoderTest006, TestSize.Level0)
+{
+    const int types[] = { EVP_PKEY_X25519, EVP_PKEY_ED25519 };
+    for (int type : types) {
+        EVP_PKEY *ref = EVP_PKEY_Q_keygen(nullptr, nullptr, (type == EVP_PKEY_X25519) ? "X25519" : "ED25519");
+        ASSERT_NE(ref, nullptr);
+        vector<uint8_t> spki = EncodePubKey(ref);
+        vector<uint8_t> pkcs8 = EncodePkcs8PriKey(ref);
+
+        EVP_PKEY *pub = DecodeEcxPubKeyDirect(spki.data(), spki.size());
+        ASSERT_NE(pub, nullptr);
+        EXPECT_EQ(EVP_PKEY_get_id(pub), type);
+        EXPECT_EQ(EVP_PKEY_eq(pub, ref), 1);
+        EVP_PKEY_free(pub);
+        EVP_PKEY *pri = DecodeEcxPriKeyDirect(type, pkcs8.data(), pkcs8.size());
+        ASSERT_NE(pri, nullptr);
+        EXPECT_EQ(EVP_PKEY_eq(pri, ref), 1);
+        EVP_PKEY_free(pri);
+
+        int otherType = (type == EVP_PKEY_X25519) ? EVP_PKEY_ED25519 : EVP_PKEY_X25519;
+        EXPECT_EQ(DecodeEcxPriKeyDirect(otherType, pkcs8.data(), pkcs8.size()), nullptr);
+        EXPECT_EQ(DecodeEcxPubKeyDirect(spki.data(), spki.size() - 1), nullptr);
+        EXPECT_EQ(DecodeEcxPriKeyDirect(type, pkcs8.data(), pkcs8.size() - 1), nullptr);
+        spki[1] ^= 0x01;
+        EXPECT_EQ(DecodeEcxPubKeyDirect(spki.data(), spki.size()), nullptr);
+        EVP_PKEY_free(ref);
+    }
+}
@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_cmac_params.h"
+#include "detailed_gcm_params.h"
+#include "detailed_hkdf_params.h"
+#include "detailed_hmac_params.h"
+#include "detailed_iv_params.h"
+#include "detailed_pbkdf2_params.h"
+#include "kdf.h"
+#include "mac.h"
+#include "mbedtls_ctx_pool.h"
+#include "md.h"
+#include "memory.h"
+#include "securec.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoMbedtlsPluginTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+constexpr uint32_t AES_IV_LEN = 16;
+constexpr uint32_t GCM_IV_LEN = 12;
+constexpr uint32_t GCM_TAG_LEN = 16;
+const uint8_t g_plainText[] = "mbedtls plugin test plain text, longer than one block";
+const uint32_t g_plainLen = sizeof(g_plainText) - 1;
+
+static HcfBlob ToBlob(const vector<uint8_t> &data)
+{
+    return { .data = const_cast<uint8_t *>(data.data()), .len = data.size() };
+}
+
+static bool IsBlobEqual(const HcfBlob &blob, const vector<uint8_t> &expect)
+{
+    return (blob.len == expect.size()) && (memcmp(blob.data, expect.data(), expect.size()) == 0);
+}
+
+static HcfSymKey *ConvertSymKey(const char *algName, const vector<uint8_t> &keyData)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfBlob keyBlob = ToBlob(keyData);
+    if (generator->convertSymKey(generator, &keyBlob, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+static HcfSymKey *GenerateSymKey(const char *algName)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    if (generator->generateSymKey(generator, &key) != HCF_SUCCESS) {
+        key = nullptr;
+    }
+    HcfObjDestroy(generator);
+    return key;
+}
+
+static HcfResult Digest(const char *algName, const vector<uint8_t> &msg, HcfBlob *out)
+{
+    HcfMd *md = nullptr;
+    HcfResult ret = HcfMdCreate(algName, &md);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    HcfBlob input = ToBlob(msg);
+    ret = md->update(md, &input);
+    if (ret == HCF_SUCCESS) {
+        ret = md->doFinal(md, out);
+    }
+    HcfObjDestroy(md);
+    return ret;
+}
+
+static HcfResult DoCipher(const char *cipherName, HcfCryptoMode mode, HcfSymKey *key, HcfParamsSpec *params,
+    const HcfBlob &input, HcfBlob *output)
+{
+    HcfCipher *cipher = nullptr;
+    HcfResult ret = HcfCipherCreate(cipherName, &cipher);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = cipher->init(cipher, mode, reinterpret_cast<HcfKey *>(key), params);
+    if (ret == HCF_SUCCESS) {
+        HcfBlob in = input;
+        ret = cipher->doFinal(cipher, &in, output);
+    }
+    HcfObjDestroy(cipher);
+    return ret;
+}
+
+static void CheckIvCipherRoundTrip(const char *cipherName)
+{
+    HcfSymKey *key = GenerateSymKey("AES128");
+    ASSERT_NE(key, nullptr);
+    uint8_t iv[AES_IV_LEN] = { 0 };
+    HcfIvParamsSpec ivSpec = {};
+    ivSpec.iv.data = iv;
+    ivSpec.iv.len = sizeof(iv);
+    HcfBlob plain = { .data = const_cast<uint8_t *>(g_plainText), .len = g_plainLen };
+    HcfBlob cipherText = { .data = nullptr, .len = 0 };
+    HcfBlob decrypted = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(DoCipher(cipherName, ENCRYPT_MODE, key, &ivSpec.base, plain, &cipherText), HCF_SUCCESS);
+    EXPECT_EQ(DoCipher(cipherName, DECRYPT_MODE, key, &ivSpec.base, cipherText, &decrypted), HCF_SUCCESS);
+    ASSERT_EQ(decrypted.len, g_plainLen);
+    EXPECT_EQ(memcmp(decrypted.data, g_plainText, g_plainLen), 0);
+    HcfBlobDataFree(&cipherText);
+    HcfBlobDataFree(&decrypted);
+    HcfObjDestroy(key);
+}
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest001, TestSize.Level0)
+{
+    const vector<uint8_t> msg = { 'a', 'b', 'c' };
+    const vector<uint8_t> sha224 = {
+        0x23, 0x09, 0x7d, 0x22, 0x34, 0x05, 0xd8, 0x22, 0x86, 0x42, 0xa4, 0x77, 0xbd, 0xa2, 0x55, 0xb3,
+        0x2a, 0xad, 0xbc, 0xe4, 0xbd, 0xa0, 0xb3, 0xf7, 0xe3, 0x6c, 0x9d, 0xa7
+    };
+    const vector<uint8_t> sha384 = {
+        0xcb, 0x00, 0x75, 0x3f, 0x45, 0xa3, 0x5e, 0x8b, 0xb5, 0xa0, 0x3d, 0x69, 0x9a, 0xc6, 0x50, 0x07,
+        0x27, 0x2c, 0x32, 0xab, 0x0e, 0xde, 0xd1, 0x63, 0x1a, 0x8b, 0x60, 0x5a, 0x43, 0xff, 0x5b, 0xed,
+        0x80, 0x86, 0x07, 0x2b, 0xa1, 0xe7, 0xcc, 0x23, 0x58, 0xba, 0xec, 0xa1, 0x34, 0xc8, 0x25, 0xa7
+    };
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(Digest("SHA224", msg, &out), HCF_SUCCESS);
+    EXPECT_TRUE(IsBlobEqual(out, sha224));
+    HcfBlobDataFree(&out);
+    ASSERT_EQ(Digest("SHA384", msg, &out), HCF_SUCCESS);
+    EXPECT_TRUE(IsBlobEqual(out, sha384));
+    HcfBlobDataFree(&out);
+}
+
+// RFC 4231 test case 2, the second message checks that doFinal leaves the mac ready for the next one
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest002, TestSize.Level0)
+{
+    const vector<uint8_t> keyData = { 'J', 'e', 'f', 'e' };
+    const char *msg = "what do ya want for nothing?";
+    const vector<uint8_t> expect = {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+        0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+    };
+    HcfSymKey *key = ConvertSymKey("HMAC", keyData);
+    ASSERT_NE(key, nullptr);
+    HcfHmacParamsSpec params = {};
+    params.base.algName = "HMAC";
+    params.mdName = "SHA256";
+    HcfMac *mac = nullptr;
+    ASSERT_EQ(HcfMacCreate(reinterpret_cast<HcfMacParamsSpec *>(&params), &mac), HCF_SUCCESS);
+    EXPECT_EQ(mac->getMacLength(mac), expect.size());
+    ASSERT_EQ(mac->init(mac, key), HCF_SUCCESS);
+    for (uint32_t i = 0; i < 2; i++) {
+        HcfBlob input = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>(msg)), .len = strlen(msg) };
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        EXPECT_EQ(mac->update(mac, &input), HCF_SUCCESS);
+        EXPECT_EQ(mac->doFinal(mac, &out), HCF_SUCCESS);
+        EXPECT_TRUE(IsBlobEqual(out, expect));
+        HcfBlobDataFree(&out);
+    }
+    HcfObjDestroy(mac);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest003, TestSize.Level0)
+{
+    HcfCmacParamsSpec params = {};
+    params.base.algName = "CMAC";
+    params.cipherName = "AES128";
+    HcfMac *mac = nullptr;
+    EXPECT_EQ(HcfMacCreate(reinterpret_cast<HcfMacParamsSpec *>(&params), &mac), HCF_NOT_SUPPORT);
+    EXPECT_EQ(mac, nullptr);
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest004, TestSize.Level0)
+{
+    CheckIvCipherRoundTrip("AES128|CBC|PKCS7");
+    CheckIvCipherRoundTrip("AES128|CTR|NoPadding");
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest005, TestSize.Level0)
+{
+    HcfSymKey *key = GenerateSymKey("AES256");
+    ASSERT_NE(key, nullptr);
+    uint8_t iv[GCM_IV_LEN] = { 0 };
+    uint8_t aad[8] = { 0 };
+    uint8_t tag[GCM_TAG_LEN] = { 0 };
+    HcfGcmParamsSpec spec = {};
+    spec.iv.data = iv;
+    spec.iv.len = sizeof(iv);
+    spec.aad.data = aad;
+    spec.aad.len = sizeof(aad);
+    spec.tag.data = tag;
+    spec.tag.len = sizeof(tag);
+    HcfBlob plain = { .data = const_cast<uint8_t *>(g_plainText), .len = g_plainLen };
+    HcfBlob cipherText = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(DoCipher("AES256|GCM|NoPadding", ENCRYPT_MODE, key, &spec.base, plain, &cipherText), HCF_SUCCESS);
+    ASSERT_EQ(cipherText.len, g_plainLen + GCM_TAG_LEN);
+    (void)memcpy_s(tag, sizeof(tag), cipherText.data + g_plainLen, GCM_TAG_LEN);
+    HcfBlob body = { .data = cipherText.data, .len = g_plainLen };
+    HcfBlob decrypted = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(DoCipher("AES256|GCM|NoPadding", DECRYPT_MODE, key, &spec.base, body, &decrypted), HCF_SUCCESS);
+    ASSERT_EQ(decrypted.len, g_plainLen);
+    EXPECT_EQ(memcmp(decrypted.data, g_plainText, g_plainLen), 0);
+    HcfBlobDataFree(&decrypted);
+
+    tag[0] ^= 1;
+    EXPECT_EQ(DoCipher("AES256|GCM|NoPadding", DECRYPT_MODE, key, &spec.base, body, &decrypted),
+        HCF_ERR_CRYPTO_OPERATION);
+    EXPECT_EQ(decrypted.data, nullptr);
+    HcfBlobDataFree(&cipherText);
+    HcfObjDestroy(key);
+}
+
+// RFC 5869 test case 1, full and extract only
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest006, TestSize.Level0)
+{
+    const vector<uint8_t> ikm(22, 0x0b);
+    const vector<uint8_t> salt = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c };
+    const vector<uint8_t> info = { 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9 };
+    const vector<uint8_t> okm = {
+        0x3c, 0xb2, 0x5f, 0x25, 0xfa, 0xac, 0xd5, 0x7a, 0x90, 0x43, 0x4f, 0x64, 0xd0, 0x36, 0x2f, 0x2a,
+        0x2d, 0x2d, 0x0a, 0x90, 0xcf, 0x1a, 0x5a, 0x4c, 0x5d, 0xb0, 0x2d, 0x56, 0xec, 0xc4, 0xc5, 0xbf,
+        0x34, 0x00, 0x72, 0x08, 0xd5, 0xb8, 0x87, 0x18, 0x58, 0x65
+    };
+    const vector<uint8_t> prk = {
+        0x07, 0x77, 0x09, 0x36, 0x2c, 0x2e, 0x32, 0xdf, 0x0d, 0xdc, 0x3f, 0x0d, 0xc4, 0x7b, 0xba, 0x63,
+        0x90, 0xb6, 0xc7, 0x3b, 0xb5, 0x0f, 0x9c, 0x31, 0x22, 0xec, 0x84, 0x4a, 0xd7, 0xc2, 0xb3, 0xe5
+    };
+    const char *algNames[] = { "HKDF|SHA256", "HKDF|SHA256|EXTRACT_ONLY" };
+    const vector<uint8_t> *expects[] = { &okm, &prk };
+    for (uint32_t i = 0; i < sizeof(algNames) / sizeof(algNames[0]); i++) {
+        HcfKdf *kdf = nullptr;
+        ASSERT_EQ(HcfKdfCreate(algNames[i], &kdf), HCF_SUCCESS);
+        vector<uint8_t> out(expects[i]->size());
+        HcfHkdfParamsSpec params = {
+            .base = { .algName = "HKDF", },
+            .key = ToBlob(ikm),
+            .salt = ToBlob(salt),
+            .info = ToBlob(info),
+            .output = { .data = out.data(), .len = out.size() },
+        };
+        EXPECT_EQ(kdf->generateSecret(kdf, &(params.base)), HCF_SUCCESS);
+        EXPECT_TRUE(IsBlobEqual(params.output, *expects[i]));
+        HcfObjDestroy(kdf);
+    }
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest007, TestSize.Level0)
+{
+    const vector<uint8_t> password = { 'p', 'a', 's', 's', 'w', 'o', 'r', 'd' };
+    const vector<uint8_t> salt = { 's', 'a', 'l', 't' };
+    const vector<uint8_t> expect = {
+        0x12, 0x0f, 0xb6, 0xcf, 0xfc, 0xf8, 0xb3, 0x2c, 0x43, 0xe7, 0x22, 0x52, 0x56, 0xc4, 0xf8, 0x37,
+        0xa8, 0x65, 0x48, 0xc9, 0x2c, 0xcc, 0x35, 0x48, 0x08, 0x05, 0x98, 0x7c, 0xb7, 0x0b, 0xe1, 0x7b
+    };
+    HcfKdf *kdf = nullptr;
+    ASSERT_EQ(HcfKdfCreate("PBKDF2|SHA256", &kdf), HCF_SUCCESS);
+    vector<uint8_t> out(expect.size());
+    HcfPBKDF2ParamsSpec params = {
+        .base = { .algName = "PBKDF2", },
+        .password = ToBlob(password),
+        .salt = ToBlob(salt),
+        .iterations = 1,
+        .output = { .data = out.data(), .len = out.size() },
+        .threadNum = 0,
+    };
+    EXPECT_EQ(kdf->generateSecret(kdf, &(params.base)), HCF_SUCCESS);
+    EXPECT_TRUE(IsBlobEqual(params.output, expect));
+    params.iterations = 0;
+    EXPECT_EQ(kdf->generateSecret(kdf, &(params.base)), HCF_INVALID_PARAMS);
+    HcfObjDestroy(kdf);
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest008, TestSize.Level0)
+{
+    HcfMbedtlsCtxPoolStat before = {};
+    MbedtlsCtxPoolGetStat(&before);
+    HcfMd *md = nullptr;
+    ASSERT_EQ(HcfMdCreate("SHA256", &md), HCF_SUCCESS);
+    HcfMbedtlsCtxPoolStat during = {};
+    MbedtlsCtxPoolGetStat(&during);
+    EXPECT_EQ(during.slotInUse + during.heapInUse, before.slotInUse + before.heapInUse + 1U);
+    EXPECT_GE(during.slotPeak, during.slotInUse);
+    HcfObjDestroy(md);
+    HcfMbedtlsCtxPoolStat after = {};
+    MbedtlsCtxPoolGetStat(&after);
+    EXPECT_EQ(after.slotInUse, before.slotInUse);
+    EXPECT_EQ(after.heapInUse, before.heapInUse);
+    EXPECT_EQ(after.slotSize, static_cast<uint32_t>(HCF_MBEDTLS_CTX_POOL_SLOT_SIZE));
+    EXPECT_EQ(after.slotNum, static_cast<uint32_t>(HCF_MBEDTLS_CTX_POOL_SLOT_NUM));
+}
+
+HWTEST_F(CryptoMbedtlsPluginTest, CryptoMbedtlsPluginTest009, TestSize.Level0)
+{
+    vector<HcfMd *> mds(HCF_MBEDTLS_CTX_POOL_SLOT_NUM + 1, nullptr);
+    for (auto &md : mds) {
+        ASSERT_EQ(HcfMdCreate("SHA1", &md), HCF_SUCCESS);
+    }
+    HcfMbedtlsCtxPoolStat stat = {};
+    MbedtlsCtxPoolGetStat(&stat);
+    EXPECT_EQ(stat.slotInUse, static_cast<uint32_t>(HCF_MBEDTLS_CTX_POOL_SLOT_NUM));
+    EXPECT_GE(stat.heapInUse, 1U);
+    for (auto md : mds) {
+        HcfObjDestroy(md);
+    }
+    MbedtlsCtxPoolGetStat(&stat);
+    EXPECT_EQ(stat.slotInUse, 0U);
+    EXPECT_EQ(stat.heapInUse, 0U);
+}
@@ -180,7 +180,7 @@ HWTEST_F(CryptoMlDsaSignVerifyTest, CryptoMlDsaSignInitRepeatTest001, TestSize.L
     ASSERT_EQ(ret, HCF_SUCCESS);
 
     ret = sign->init(sign, nullptr, mlDsa65KeyPair_->priKey);
-    ASSERT_NE(ret, HCF_SUCCESS);
+    ASSERT_EQ(ret, HCF_SUCCESS);
 
     HcfObjDestroy(sign);
 }
@@ -747,7 +747,7 @@ HWTEST_F(CryptoMlDsaSignVerifyTest, CryptoMlDsaVerifyInitRepeatTest001, TestSize
     ASSERT_EQ(ret, HCF_SUCCESS);
 
     ret = verify->init(verify, nullptr, mlDsa65KeyPair_->pubKey);
-    ASSERT_NE(ret, HCF_SUCCESS);
+    ASSERT_EQ(ret, HCF_SUCCESS);
 
     HcfObjDestroy(verify);
 }
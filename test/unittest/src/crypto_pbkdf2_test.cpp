@@ -566,4 +566,55 @@ HWTEST_P(CryptoPbkdf2Test, CryptoPbkdf2AlgoTest, TestSize.Level0)
     EXPECT_STREQ(name, algoName.c_str());
     HcfObjDestroy(generator);
 }
+
+// RFC 6070 test vector 5, the two SHA1 blocks of the 25-byte output are derived on separate threads
+HWTEST_F(CryptoPbkdf2Test, CryptoPbkdf2ParallelTest001, TestSize.Level0)
+{
+    const char *password = "passwordPASSWORDpassword";
+    const char *salt = "saltSALTsaltSALTsaltSALTsaltSALTsalt";
+    const uint8_t expect[] = {
+    0x3d, 0x2e, 0xec, 0x4f, 0xe4, 0x1c, 0x84, 0x9b, 0x80, 0xc8, 0xd8, 0x36,
+    0x62, 0xc0, 0xe4, 0x4a, 0x8b, 0x29, 0x1a, 0x96, 0x4c, 0xf2, 0xf0, 0x70,
+    0x38
+    };
+    HcfKdf *generator = nullptr;
+    ASSERT_EQ(HcfKdfCreate("PBKDF2|SHA1", &generator), HCF_SUCCESS);
+    uint8_t out[sizeof(expect)] = {0};
+    HcfPBKDF2ParamsSpec params = {
+        .base = { .algName = g_pbkdf2Name },
+        .password = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>(password)), .len = strlen(password) },
+        .salt = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>(salt)), .len = strlen(salt) },
+        .iterations = 4096,
+        .output = { .data = out, .len = sizeof(out) },
+        .threadNum = 4,
+    };
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(out, expect, sizeof(expect)), 0);
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoPbkdf2Test, CryptoPbkdf2ParallelTest002, TestSize.Level0)
+{
+    HcfKdf *generator = nullptr;
+    ASSERT_EQ(HcfKdfCreate("PBKDF2|SHA256", &generator), HCF_SUCCESS);
+    uint8_t serialOut[OUT_PUT_MAX_LENGTH] = {0};
+    uint8_t parallelOut[OUT_PUT_MAX_LENGTH] = {0};
+    // empty password and salt, the 100-byte output ends with a partial block
+    HcfPBKDF2ParamsSpec params = {
+        .base = { .algName = g_pbkdf2Name },
+        .password = { .data = nullptr, .len = 0 },
+        .salt = { .data = nullptr, .len = 0 },
+        .iterations = 1000,
+        .output = { .data = serialOut, .len = 100 },
+    };
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    params.output.data = parallelOut;
+    params.threadNum = 3;
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(serialOut, parallelOut, sizeof(serialOut)), 0);
+
+    params.threadNum = 65;
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_INVALID_PARAMS);
+    HcfObjDestroy(generator);
+}
 }
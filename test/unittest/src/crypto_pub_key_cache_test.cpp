@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "securec.h"
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "memory.h"
+#include "pub_key_cache.h"
+#include "signature.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t TEST_CACHE_CAPACITY = 16;
+constexpr uint32_t TEST_THREAD_NUM = 8;
+constexpr uint32_t TEST_THREAD_KEY_NUM = 6;
+constexpr uint32_t TEST_THREAD_REPEAT_NUM = 50;
+
+/* every algorithm whose convertKey looks up the public key cache */
+const char *g_cachedAlgNames[] = { "RSA2048", "ECC256", "ECC_BrainPoolP256r1", "SM2_256", "X25519", "Ed25519" };
+
+class CryptoPubKeyCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp()
+    {
+        ASSERT_EQ(HcfPubKeyCacheSetCapacity(0), HCF_SUCCESS);
+    }
+    void TearDown()
+    {
+        (void)HcfPubKeyCacheSetCapacity(0);
+    }
+};
+
+struct EncodedKeyPair {
+    HcfBlob pub = { .data = nullptr, .len = 0 };
+    HcfBlob pri = { .data = nullptr, .len = 0 };
+};
+
+bool GenerateEncodedKeyPair(HcfAsyKeyGenerator *generator, EncodedKeyPair &keys)
+{
+    HcfKeyPair *keyPair = nullptr;
+    if (generator->generateKeyPair(generator, nullptr, &keyPair) != HCF_SUCCESS) {
+        return false;
+    }
+    bool ok = (keyPair->pubKey->base.getEncoded(&keyPair->pubKey->base, &keys.pub) == HCF_SUCCESS) &&
+        (keyPair->priKey->base.getEncoded(&keyPair->priKey->base, &keys.pri) == HCF_SUCCESS);
+    HcfObjDestroy(keyPair);
+    return ok;
+}
+
+void FreeEncodedKeyPair(EncodedKeyPair &keys)
+{
+    HcfBlobDataFree(&keys.pub);
+    HcfBlobDataClearAndFree(&keys.pri);
+}
+
+HcfPubKeyCacheStats GetStats(void)
+{
+    HcfPubKeyCacheStats stats = {};
+    EXPECT_EQ(HcfPubKeyCacheGetStats(&stats), HCF_SUCCESS);
+    return stats;
+}
+
+bool IsSameBlob(const HcfBlob &left, const HcfBlob &right)
+{
+    return (left.len == right.len) && (memcmp(left.data, right.data, left.len) == 0);
+}
+
+HcfResult ConvertPubKey(HcfAsyKeyGenerator *generator, HcfBlob *pub, HcfKeyPair **keyPair)
+{
+    return generator->convertKey(generator, nullptr, pub, nullptr, keyPair);
+}
+
+/* The second import of the same encoding is a hit and gives an equal, separately destroyable key. */
+void CheckCacheHit(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate(algName, &generator), HCF_SUCCESS);
+    EncodedKeyPair keys;
+    ASSERT_TRUE(GenerateEncodedKeyPair(generator, keys));
+    HcfPubKeyCacheStats before = GetStats();
+
+    HcfKeyPair *first = nullptr;
+    HcfKeyPair *second = nullptr;
+    ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &first), HCF_SUCCESS) << algName;
+    ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &second), HCF_SUCCESS) << algName;
+    HcfPubKeyCacheStats after = GetStats();
+    EXPECT_EQ(after.misses - before.misses, 1) << algName;
+    EXPECT_EQ(after.hits - before.hits, 1) << algName;
+    EXPECT_NE(first->pubKey, second->pubKey);
+
+    HcfObjDestroy(first);
+    HcfBlob encoded = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(second->pubKey->base.getEncoded(&second->pubKey->base, &encoded), HCF_SUCCESS);
+    EXPECT_TRUE(IsSameBlob(keys.pub, encoded)) << algName;
+    HcfBlobDataFree(&encoded);
+    HcfObjDestroy(second);
+    FreeEncodedKeyPair(keys);
+    HcfObjDestroy(generator);
+}
+
+bool SignAndVerify(const char *signAlg, HcfKeyPair *signer, HcfKeyPair *verifier)
+{
+    uint8_t msg[] = "public key cache";
+    HcfBlob input = { .data = msg, .len = sizeof(msg) };
+    HcfBlob signature = { .data = nullptr, .len = 0 };
+    HcfSign *sign = nullptr;
+    HcfVerify *verify = nullptr;
+    bool ok = (HcfSignCreate(signAlg, &sign) == HCF_SUCCESS) &&
+        (sign->init(sign, nullptr, signer->priKey) == HCF_SUCCESS) &&
+        (sign->sign(sign, &input, &signature) == HCF_SUCCESS) &&
+        (HcfVerifyCreate(signAlg, &verify) == HCF_SUCCESS) &&
+        (verify->init(verify, nullptr, verifier->pubKey) == HCF_SUCCESS) &&
+        verify->verify(verify, &input, &signature);
+    HcfBlobDataFree(&signature);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(verify);
+    return ok;
+}
+
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest001, TestSize.Level0)
+{
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(TEST_CACHE_CAPACITY), HCF_SUCCESS);
+    for (const char *algName : g_cachedAlgNames) {
+        CheckCacheHit(algName);
+    }
+    HcfPubKeyCacheStats stats = GetStats();
+    EXPECT_EQ(stats.capacity, TEST_CACHE_CAPACITY);
+    EXPECT_EQ(stats.count, sizeof(g_cachedAlgNames) / sizeof(g_cachedAlgNames[0]));
+}
+
+/* Least recently used entries go first. */
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest002, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate("ECC256", &generator), HCF_SUCCESS);
+    EncodedKeyPair keys[3];
+    for (auto &key : keys) {
+        ASSERT_TRUE(GenerateEncodedKeyPair(generator, key));
+    }
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(2), HCF_SUCCESS);
+    HcfPubKeyCacheStats before = GetStats();
+    /* A B C evicts A, B is then the most recent, A again evicts C, so C misses too */
+    const uint32_t order[] = { 0, 1, 2, 1, 0, 2 };
+    for (uint32_t index : order) {
+        HcfKeyPair *keyPair = nullptr;
+        ASSERT_EQ(ConvertPubKey(generator, &keys[index].pub, &keyPair), HCF_SUCCESS);
+        HcfObjDestroy(keyPair);
+    }
+    HcfPubKeyCacheStats after = GetStats();
+    EXPECT_EQ(after.hits - before.hits, 1);
+    EXPECT_EQ(after.misses - before.misses, 5);
+    EXPECT_EQ(after.evictions - before.evictions, 3);
+    EXPECT_EQ(after.count, 2);
+
+    /* shrinking evicts the older entries right away */
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(1), HCF_SUCCESS);
+    EXPECT_EQ(GetStats().count, 1);
+    for (auto &key : keys) {
+        FreeEncodedKeyPair(key);
+    }
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest003, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate("RSA2048", &generator), HCF_SUCCESS);
+    EncodedKeyPair keys;
+    ASSERT_TRUE(GenerateEncodedKeyPair(generator, keys));
+    HcfPubKeyCacheStats before = GetStats();
+    for (uint32_t i = 0; i < 2; i++) {
+        HcfKeyPair *keyPair = nullptr;
+        ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &keyPair), HCF_SUCCESS);
+        HcfObjDestroy(keyPair);
+    }
+    HcfPubKeyCacheStats after = GetStats();
+    EXPECT_EQ(after.capacity, 0);
+    EXPECT_EQ(after.count, 0);
+    EXPECT_EQ(after.hits, before.hits);
+    EXPECT_EQ(after.misses, before.misses);
+
+    EXPECT_EQ(HcfPubKeyCacheSetCapacity(HCF_PUB_KEY_CACHE_MAX_CAPACITY + 1), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfPubKeyCacheGetStats(nullptr), HCF_INVALID_PARAMS);
+    FreeEncodedKeyPair(keys);
+    HcfObjDestroy(generator);
+}
+
+/* Private keys are never cached, not even when imported together with their public key. */
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest004, TestSize.Level0)
+{
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(TEST_CACHE_CAPACITY), HCF_SUCCESS);
+    for (const char *algName : g_cachedAlgNames) {
+        HcfAsyKeyGenerator *generator = nullptr;
+        ASSERT_EQ(HcfAsyKeyGeneratorCreate(algName, &generator), HCF_SUCCESS);
+        EncodedKeyPair keys;
+        ASSERT_TRUE(GenerateEncodedKeyPair(generator, keys));
+        HcfPubKeyCacheStats before = GetStats();
+        for (uint32_t i = 0; i < 2; i++) {
+            HcfKeyPair *keyPair = nullptr;
+            ASSERT_EQ(generator->convertKey(generator, nullptr, nullptr, &keys.pri, &keyPair), HCF_SUCCESS);
+            HcfObjDestroy(keyPair);
+        }
+        HcfPubKeyCacheStats after = GetStats();
+        EXPECT_EQ(after.count, before.count) << algName;
+        EXPECT_EQ(after.misses, before.misses) << algName;
+
+        HcfKeyPair *keyPair = nullptr;
+        ASSERT_EQ(generator->convertKey(generator, nullptr, &keys.pub, &keys.pri, &keyPair), HCF_SUCCESS);
+        HcfObjDestroy(keyPair);
+        EXPECT_EQ(GetStats().count, before.count + 1) << algName;
+        FreeEncodedKeyPair(keys);
+        HcfObjDestroy(generator);
+    }
+}
+
+/* Keys handed out before a purge stay usable, and the next import decodes again. */
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest005, TestSize.Level0)
+{
+    const char *algNames[] = { "RSA2048", "ECC256", "SM2_256", "Ed25519" };
+    const char *signAlgs[] = { "RSA2048|PKCS1|SHA256", "ECC256|SHA256", "SM2_256|SM3", "Ed25519" };
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(TEST_CACHE_CAPACITY), HCF_SUCCESS);
+    for (uint32_t i = 0; i < sizeof(algNames) / sizeof(algNames[0]); i++) {
+        HcfAsyKeyGenerator *generator = nullptr;
+        ASSERT_EQ(HcfAsyKeyGeneratorCreate(algNames[i], &generator), HCF_SUCCESS);
+        EncodedKeyPair keys;
+        ASSERT_TRUE(GenerateEncodedKeyPair(generator, keys));
+        HcfKeyPair *signer = nullptr;
+        HcfKeyPair *first = nullptr;
+        HcfKeyPair *cached = nullptr;
+        ASSERT_EQ(generator->convertKey(generator, nullptr, nullptr, &keys.pri, &signer), HCF_SUCCESS);
+        ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &first), HCF_SUCCESS);
+        ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &cached), HCF_SUCCESS);
+        HcfObjDestroy(first);
+
+        HcfPubKeyCachePurge();
+        HcfPubKeyCacheStats stats = GetStats();
+        EXPECT_EQ(stats.count, 0);
+        EXPECT_EQ(stats.capacity, TEST_CACHE_CAPACITY);
+        EXPECT_TRUE(SignAndVerify(signAlgs[i], signer, cached)) << algNames[i];
+
+        HcfKeyPair *again = nullptr;
+        ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &again), HCF_SUCCESS);
+        EXPECT_EQ(GetStats().misses, stats.misses + 1);
+        EXPECT_TRUE(SignAndVerify(signAlgs[i], signer, again)) << algNames[i];
+        HcfObjDestroy(again);
+        HcfObjDestroy(cached);
+        HcfObjDestroy(signer);
+        FreeEncodedKeyPair(keys);
+        HcfObjDestroy(generator);
+    }
+}
+
+/* A tampered encoding is not served from the cache. */
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest006, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate("Ed25519", &generator), HCF_SUCCESS);
+    EncodedKeyPair keys;
+    ASSERT_TRUE(GenerateEncodedKeyPair(generator, keys));
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(TEST_CACHE_CAPACITY), HCF_SUCCESS);
+    HcfKeyPair *keyPair = nullptr;
+    ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &keyPair), HCF_SUCCESS);
+    HcfObjDestroy(keyPair);
+    keyPair = nullptr;
+
+    HcfPubKeyCacheStats before = GetStats();
+    keys.pub.data[keys.pub.len - 1] ^= 0x01;
+    ASSERT_EQ(ConvertPubKey(generator, &keys.pub, &keyPair), HCF_SUCCESS);
+    HcfBlob encoded = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(keyPair->pubKey->base.getEncoded(&keyPair->pubKey->base, &encoded), HCF_SUCCESS);
+    EXPECT_TRUE(IsSameBlob(keys.pub, encoded));
+    EXPECT_EQ(GetStats().misses, before.misses + 1);
+    EXPECT_EQ(GetStats().hits, before.hits);
+    HcfBlobDataFree(&encoded);
+    HcfObjDestroy(keyPair);
+    FreeEncodedKeyPair(keys);
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoPubKeyCacheTest, CryptoPubKeyCacheTest007, TestSize.Level0)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    ASSERT_EQ(HcfAsyKeyGeneratorCreate("ECC256", &generator), HCF_SUCCESS);
+    vector<EncodedKeyPair> keys(TEST_THREAD_KEY_NUM);
+    for (auto &key : keys) {
+        ASSERT_TRUE(GenerateEncodedKeyPair(generator, key));
+    }
+    /* smaller than the key set so that lookups, inserts and evictions race with each other */
+    ASSERT_EQ(HcfPubKeyCacheSetCapacity(TEST_THREAD_KEY_NUM / 2), HCF_SUCCESS);
+    HcfPubKeyCacheStats before = GetStats();
+    vector<uint32_t> failures(TEST_THREAD_NUM, 0);
+    vector<thread> threads;
+    for (uint32_t t = 0; t < TEST_THREAD_NUM; t++) {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < TEST_THREAD_REPEAT_NUM; i++) {
+                EncodedKeyPair &key = keys[(i + t) % TEST_THREAD_KEY_NUM];
+                HcfKeyPair *keyPair = nullptr;
+                HcfBlob encoded = { .data = nullptr, .len = 0 };
+                if ((ConvertPubKey(generator, &key.pub, &keyPair) != HCF_SUCCESS) ||
+                    (keyPair->pubKey->base.getEncoded(&keyPair->pubKey->base, &encoded) != HCF_SUCCESS) ||
+                    !IsSameBlob(key.pub, encoded)) {
+                    failures[t]++;
+                }
+                HcfBlobDataFree(&encoded);
+                HcfObjDestroy(keyPair);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t failure : failures) {
+        EXPECT_EQ(failure, 0);
+    }
+    HcfPubKeyCacheStats after = GetStats();
+    EXPECT_EQ((after.hits - before.hits) + (after.misses - before.misses), TEST_THREAD_NUM * TEST_THREAD_REPEAT_NUM);
+    EXPECT_LE(after.count, TEST_THREAD_KEY_NUM / 2);
+    for (auto &key : keys) {
+        FreeEncodedKeyPair(key);
+    }
+    HcfObjDestroy(generator);
+}
+}
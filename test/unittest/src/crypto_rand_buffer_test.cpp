@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "blob.h"
+#include "openssl_adapter_mock.h"
+#include "rand.h"
+#include "rand_buffer_openssl.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoRandBufferTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+constexpr uint32_t SMALL_REQUEST_LEN = 16;
+constexpr uint32_t ODD_REQUEST_LEN = 7;
+constexpr uint32_t THREAD_NUM = 4;
+constexpr uint32_t THREAD_REQUEST_NUM = 200;
+
+/* Number of OpenSSL calls made by one small request on the calling thread. */
+static uint32_t CountSmallRequestCalls(uint8_t *data)
+{
+    StartRecordOpensslCallNum();
+    HcfResult ret = HcfRandBufferGenerate(data, SMALL_REQUEST_LEN);
+    uint32_t callNum = GetOpensslCallNum();
+    EndRecordOpensslCallNum();
+    EXPECT_EQ(ret, HCF_SUCCESS);
+    return callNum;
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest001, TestSize.Level0)
+{
+    uint8_t data[SMALL_REQUEST_LEN] = { 0 };
+    EXPECT_EQ(HcfRandBufferGenerate(nullptr, SMALL_REQUEST_LEN), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfRandBufferGenerate(data, 0), HCF_INVALID_PARAMS);
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest002, TestSize.Level0)
+{
+    uint8_t first[SMALL_REQUEST_LEN] = { 0 };
+    uint8_t second[SMALL_REQUEST_LEN] = { 0 };
+    HcfRandBufferInvalidate();
+    EXPECT_EQ(CountSmallRequestCalls(first), 1);
+    EXPECT_EQ(CountSmallRequestCalls(second), 0);
+    EXPECT_NE(memcmp(first, second, SMALL_REQUEST_LEN), 0);
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest003, TestSize.Level0)
+{
+    // Odd sizes that do not divide the buffer, the request crossing its end refills it.
+    HcfRandBufferInvalidate();
+    uint8_t data[ODD_REQUEST_LEN] = { 0 };
+    uint32_t requestNum = HCF_RAND_BUFFER_LEN / ODD_REQUEST_LEN + 1;
+    StartRecordOpensslCallNum();
+    for (uint32_t i = 0; i < requestNum; i++) {
+        ASSERT_EQ(HcfRandBufferGenerate(data, ODD_REQUEST_LEN), HCF_SUCCESS);
+    }
+    EXPECT_EQ(GetOpensslCallNum(), 2);
+    EndRecordOpensslCallNum();
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest004, TestSize.Level0)
+{
+    // Requests above the limit go to OpenSSL directly and leave the buffer alone.
+    uint8_t small[SMALL_REQUEST_LEN] = { 0 };
+    vector<uint8_t> large(HCF_RAND_BUFFER_MAX_REQUEST_LEN + 1);
+    (void)CountSmallRequestCalls(small);
+    StartRecordOpensslCallNum();
+    EXPECT_EQ(HcfRandBufferGenerate(large.data(), large.size()), HCF_SUCCESS);
+    EXPECT_EQ(GetOpensslCallNum(), 1);
+    EndRecordOpensslCallNum();
+    EXPECT_EQ(CountSmallRequestCalls(small), 0);
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest005, TestSize.Level0)
+{
+    // setSeed drops what was buffered before it.
+    HcfRand *randObj = nullptr;
+    ASSERT_EQ(HcfRandCreate(&randObj), HCF_SUCCESS);
+    HcfBlob random = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(randObj->generateRandom(randObj, SMALL_REQUEST_LEN, &random), HCF_SUCCESS);
+    uint8_t data[SMALL_REQUEST_LEN] = { 0 };
+    EXPECT_EQ(CountSmallRequestCalls(data), 0);
+    EXPECT_EQ(randObj->setSeed(randObj, &random), HCF_SUCCESS);
+    EXPECT_EQ(CountSmallRequestCalls(data), 1);
+    HcfBlobDataClearAndFree(&random);
+    HcfObjDestroy(randObj);
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest006, TestSize.Level0)
+{
+    // A failed refill leaves the buffer empty, the next request tries again.
+    HcfRandBufferInvalidate();
+    uint8_t data[SMALL_REQUEST_LEN] = { 0 };
+    StartRecordOpensslCallNum();
+    SetOpensslCallMockIndex(1);
+    EXPECT_EQ(HcfRandBufferGenerate(data, SMALL_REQUEST_LEN), HCF_ERR_CRYPTO_OPERATION);
+    EndRecordOpensslCallNum();
+    EXPECT_EQ(CountSmallRequestCalls(data), 1);
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest007, TestSize.Level0)
+{
+    // The child of a fork must not hand out the bytes the parent has buffered.
+    uint8_t parent[SMALL_REQUEST_LEN] = { 0 };
+    uint8_t child[SMALL_REQUEST_LEN] = { 0 };
+    (void)CountSmallRequestCalls(parent);
+    int fds[2] = { -1, -1 };
+    ASSERT_EQ(pipe(fds), 0);
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        (void)close(fds[0]);
+        uint8_t data[SMALL_REQUEST_LEN] = { 0 };
+        bool isSuccess = (HcfRandBufferGenerate(data, SMALL_REQUEST_LEN) == HCF_SUCCESS) &&
+            (write(fds[1], data, SMALL_REQUEST_LEN) == SMALL_REQUEST_LEN);
+        _exit(isSuccess ? 0 : 1);
+    }
+    (void)close(fds[1]);
+    EXPECT_EQ(HcfRandBufferGenerate(parent, SMALL_REQUEST_LEN), HCF_SUCCESS);
+    EXPECT_EQ(read(fds[0], child, SMALL_REQUEST_LEN), SMALL_REQUEST_LEN);
+    (void)close(fds[0]);
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+    EXPECT_NE(memcmp(parent, child, SMALL_REQUEST_LEN), 0);
+}
+
+HWTEST_F(CryptoRandBufferTest, CryptoRandBufferTest008, TestSize.Level0)
+{
+    // Every thread draws from its own buffer, no two threads see the same bytes.
+    vector<vector<uint8_t>> firsts(THREAD_NUM, vector<uint8_t>(SMALL_REQUEST_LEN));
+    vector<bool> results(THREAD_NUM, false);
+    vector<thread> threads;
+    for (uint32_t i = 0; i < THREAD_NUM; i++) {
+        threads.emplace_back([&firsts, &results, i]() {
+            uint8_t data[SMALL_REQUEST_LEN] = { 0 };
+            bool isSuccess = (HcfRandBufferGenerate(firsts[i].data(), SMALL_REQUEST_LEN) == HCF_SUCCESS);
+            for (uint32_t j = 0; isSuccess && (j < THREAD_REQUEST_NUM); j++) {
+                isSuccess = (HcfRandBufferGenerate(data, SMALL_REQUEST_LEN) == HCF_SUCCESS);
+            }
+            results[i] = isSuccess;
+        });
+    }
+    for (auto &worker : threads) {
+        worker.join();
+    }
+    for (uint32_t i = 0; i < THREAD_NUM; i++) {
+        EXPECT_TRUE(results[i]);
+        for (uint32_t j = i + 1; j < THREAD_NUM; j++) {
+            EXPECT_NE(firsts[i], firsts[j]);
+        }
+    }
+}
+}
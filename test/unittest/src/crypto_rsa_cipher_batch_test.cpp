@@ -0,0 +1,395 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "cipher.h"
+#include "memory.h"
+#include "openssl_adapter_mock.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoRsaCipherBatchTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+constexpr uint32_t BATCH_TEST_COUNT = 37;
+constexpr uint32_t BATCH_TEST_WORKER_NUM = 4;
+
+class BatchMessages {
+public:
+    explicit BatchMessages(uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            messages_.push_back("wrapped session key " + to_string(i));
+        }
+        for (auto &message : messages_) {
+            blobs_.push_back({ .data = reinterpret_cast<uint8_t *>(&message[0]), .len = message.size() });
+        }
+    }
+
+    HcfBlob *Blobs()
+    {
+        return blobs_.data();
+    }
+
+private:
+    vector<string> messages_;
+    vector<HcfBlob> blobs_;
+};
+
+static HcfKeyPair *GenerateTestKeyPair(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfKeyPair *keyPair = nullptr;
+    HcfResult res = generator->generateKeyPair(generator, nullptr, &keyPair);
+    HcfObjDestroy(generator);
+    return (res == HCF_SUCCESS) ? keyPair : nullptr;
+}
+
+// Encrypts a batch, decrypts it again as a batch and checks every output lies in its arena and matches its input.
+static void RsaCipherBatchTest(const char *keyAlgName, const char *cipherAlgName, uint32_t count, uint32_t workerNum)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate(cipherAlgName, &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(count);
+    vector<HcfBlob> ciphertexts(count);
+    vector<HcfBlob> plaintexts(count);
+    HcfBlob cipherArena = { .data = nullptr, .len = 0 };
+    HcfBlob plainArena = { .data = nullptr, .len = 0 };
+
+    res = cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)keyPair->pubKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), count, workerNum, &cipherArena, ciphertexts.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinalBatch(cipher, ciphertexts.data(), count, workerNum, &plainArena, plaintexts.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_GE(ciphertexts[i].data, cipherArena.data);
+        ASSERT_LE(ciphertexts[i].data + ciphertexts[i].len, cipherArena.data + cipherArena.len);
+        ASSERT_GE(plaintexts[i].data, plainArena.data);
+        ASSERT_LE(plaintexts[i].data + plaintexts[i].len, plainArena.data + plainArena.len);
+        ASSERT_EQ(plaintexts[i].len, messages.Blobs()[i].len);
+        EXPECT_EQ(memcmp(plaintexts[i].data, messages.Blobs()[i].data, plaintexts[i].len), 0);
+    }
+    // Batch outputs are interchangeable with those of doFinal.
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = cipher->doFinal(cipher, &ciphertexts[count - 1], &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    ASSERT_EQ(out.len, messages.Blobs()[count - 1].len);
+    EXPECT_EQ(memcmp(out.data, messages.Blobs()[count - 1].data, out.len), 0);
+
+    HcfBlobDataFree(&out);
+    HcfBlobDataFree(&plainArena);
+    HcfBlobDataFree(&cipherArena);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest001, TestSize.Level0)
+{
+    RsaCipherBatchTest("RSA2048|PRIMES_2", "RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", BATCH_TEST_COUNT, 0);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest002, TestSize.Level0)
+{
+    RsaCipherBatchTest("RSA2048|PRIMES_2", "RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", BATCH_TEST_COUNT, 1);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest003, TestSize.Level0)
+{
+    RsaCipherBatchTest("RSA2048|PRIMES_2", "RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", BATCH_TEST_COUNT,
+        BATCH_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest004, TestSize.Level0)
+{
+    RsaCipherBatchTest("RSA1024|PRIMES_2", "RSA1024|PKCS1", BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+}
+
+// More workers than messages.
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest005, TestSize.Level0)
+{
+    RsaCipherBatchTest("RSA1024|PRIMES_2", "RSA1024|PKCS1", 3, HCF_CIPHER_MAX_BATCH_WORKER_NUM);
+}
+
+// The OAEP label set after init applies to every message of the batch.
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest006, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA2048|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    uint8_t label[] = { 'l', 'a', 'b', 'e', 'l' };
+    HcfBlob labelBlob = { .data = label, .len = sizeof(label) };
+    HcfCipher *encryptor = nullptr;
+    HcfResult res = HcfCipherCreate("RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", &encryptor);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = encryptor->init(encryptor, ENCRYPT_MODE, (HcfKey *)keyPair->pubKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = encryptor->setCipherSpecUint8Array(encryptor, OAEP_MGF1_PSRC_UINT8ARR, labelBlob);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> ciphertexts(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    res = encryptor->doFinalBatch(encryptor, messages.Blobs(), BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM, &arena,
+        ciphertexts.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfCipher *decryptor = nullptr;
+    res = HcfCipherCreate("RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", &decryptor);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = decryptor->init(decryptor, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    EXPECT_NE(decryptor->doFinal(decryptor, &ciphertexts[0], &out), HCF_SUCCESS);
+    res = decryptor->setCipherSpecUint8Array(decryptor, OAEP_MGF1_PSRC_UINT8ARR, labelBlob);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    for (uint32_t i = 0; i < BATCH_TEST_COUNT; i++) {
+        res = decryptor->doFinal(decryptor, &ciphertexts[i], &out);
+        ASSERT_EQ(res, HCF_SUCCESS);
+        ASSERT_EQ(out.len, messages.Blobs()[i].len);
+        EXPECT_EQ(memcmp(out.data, messages.Blobs()[i].data, out.len), 0);
+        HcfBlobDataFree(&out);
+    }
+    vector<HcfBlob> plaintexts(BATCH_TEST_COUNT);
+    HcfBlob plainArena = { .data = nullptr, .len = 0 };
+    res = decryptor->doFinalBatch(decryptor, ciphertexts.data(), BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM,
+        &plainArena, plaintexts.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    for (uint32_t i = 0; i < BATCH_TEST_COUNT; i++) {
+        ASSERT_EQ(plaintexts[i].len, messages.Blobs()[i].len);
+        EXPECT_EQ(memcmp(plaintexts[i].data, messages.Blobs()[i].data, plaintexts[i].len), 0);
+    }
+
+    HcfBlobDataFree(&plainArena);
+    HcfBlobDataFree(&arena);
+    HcfObjDestroy(decryptor);
+    HcfObjDestroy(encryptor);
+    HcfObjDestroy(keyPair);
+}
+
+// Re-init with the key and mode of the prepared context makes no OpenSSL call, another key rebuilds it.
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest007, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfKeyPair *otherKeyPair = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(otherKeyPair, nullptr);
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate("RSA1024|PKCS1", &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(1);
+    HcfBlob ciphertext = { .data = nullptr, .len = 0 };
+    HcfBlob out = { .data = nullptr, .len = 0 };
+
+    res = cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)keyPair->pubKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinal(cipher, &messages.Blobs()[0], &ciphertext);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    StartRecordOpensslCallNum();
+    res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
+    EXPECT_EQ(res, HCF_SUCCESS);
+    EXPECT_EQ(GetOpensslCallNum(), 0);
+    EndRecordOpensslCallNum();
+    for (uint32_t i = 0; i < BATCH_TEST_WORKER_NUM; i++) {
+        res = cipher->doFinal(cipher, &ciphertext, &out);
+        ASSERT_EQ(res, HCF_SUCCESS);
+        ASSERT_EQ(out.len, messages.Blobs()[0].len);
+        EXPECT_EQ(memcmp(out.data, messages.Blobs()[0].data, out.len), 0);
+        HcfBlobDataFree(&out);
+    }
+
+    res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)otherKeyPair->priKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_NE(cipher->doFinal(cipher, &ciphertext, &out), HCF_SUCCESS);
+    res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinal(cipher, &ciphertext, &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_EQ(memcmp(out.data, messages.Blobs()[0].data, out.len), 0);
+
+    HcfBlobDataFree(&out);
+    HcfBlobDataFree(&ciphertext);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(otherKeyPair);
+    HcfObjDestroy(keyPair);
+}
+
+// One corrupted ciphertext fails the whole batch without an arena.
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest008, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA2048|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate("RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> ciphertexts(BATCH_TEST_COUNT);
+    vector<HcfBlob> plaintexts(BATCH_TEST_COUNT);
+    HcfBlob cipherArena = { .data = nullptr, .len = 0 };
+    HcfBlob plainArena = { .data = nullptr, .len = 0 };
+    res = cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)keyPair->pubKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &cipherArena, ciphertexts.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    ciphertexts[BATCH_TEST_COUNT / 2].data[0] ^= 0x01;
+    res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinalBatch(cipher, ciphertexts.data(), BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM, &plainArena,
+        plaintexts.data());
+    EXPECT_EQ(res, HCF_ERR_CRYPTO_OPERATION);
+    EXPECT_EQ(plainArena.data, nullptr);
+    for (uint32_t i = 0; i < BATCH_TEST_COUNT; i++) {
+        EXPECT_EQ(plaintexts[i].data, nullptr);
+    }
+
+    HcfBlobDataFree(&cipherArena);
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest009, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate("RSA1024|PKCS1", &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> outputs(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+
+    res = cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)keyPair->pubKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinalBatch(nullptr, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = cipher->doFinalBatch(cipher, nullptr, BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), 0, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, HCF_CIPHER_MAX_BATCH_WORKER_NUM + 1,
+        &arena, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, nullptr, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, nullptr);
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    messages.Blobs()[1].len = 0;
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    EXPECT_EQ(arena.data, nullptr);
+
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(keyPair);
+}
+
+// Ciphers without a batch path report it as not supported.
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest010, TestSize.Level0)
+{
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate("SM2|SM3", &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> outputs(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_NOT_SUPPORT);
+    HcfObjDestroy(cipher);
+
+    res = HcfCipherCreate("AES128|GCM|NoPadding", &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    EXPECT_EQ(res, HCF_NOT_SUPPORT);
+    HcfObjDestroy(cipher);
+}
+
+// Every OpenSSL call of the batch path failing in turn must fail cleanly without an arena.
+static void RsaCipherBatchOpensslMockTest(const char *cipherAlgName, HcfBlob *label)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate(cipherAlgName, &cipher);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = cipher->init(cipher, ENCRYPT_MODE, (HcfKey *)keyPair->pubKey, nullptr);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    if (label != nullptr) {
+        res = cipher->setCipherSpecUint8Array(cipher, OAEP_MGF1_PSRC_UINT8ARR, *label);
+        ASSERT_EQ(res, HCF_SUCCESS);
+    }
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> outputs(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+
+    StartRecordOpensslCallNum();
+    res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlobDataFree(&arena);
+    uint32_t callNum = GetOpensslCallNum();
+    for (uint32_t i = 0; i < callNum; i++) {
+        ResetOpensslCallNum();
+        SetOpensslCallMockIndex(i);
+        res = cipher->doFinalBatch(cipher, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, outputs.data());
+        if (res == HCF_SUCCESS) {
+            HcfBlobDataFree(&arena);
+            continue;
+        }
+        EXPECT_EQ(arena.data, nullptr);
+        EXPECT_EQ(outputs[0].data, nullptr);
+    }
+    EndRecordOpensslCallNum();
+
+    HcfObjDestroy(cipher);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest011, TestSize.Level0)
+{
+    RsaCipherBatchOpensslMockTest("RSA1024|PKCS1", nullptr);
+}
+
+HWTEST_F(CryptoRsaCipherBatchTest, CryptoRsaCipherBatchTest012, TestSize.Level0)
+{
+    uint8_t label[] = { 'l', 'a', 'b', 'e', 'l' };
+    HcfBlob labelBlob = { .data = label, .len = sizeof(label) };
+    RsaCipherBatchOpensslMockTest("RSA1024|PKCS1_OAEP|SHA256|MGF1_SHA256", &labelBlob);
+}
+}
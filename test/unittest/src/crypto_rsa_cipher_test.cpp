@@ -1299,7 +1299,7 @@ HWTEST_F(CryptoRsaCipherTest, CryptoRsaCipherTest930, TestSize.Level0)
     EXPECT_NE(res, HCF_SUCCESS);
 }
 
-// incorrect : init Cipher twice
+// correct : init Cipher twice, the second init keeps the prepared context
 HWTEST_F(CryptoRsaCipherTest, CryptoRsaCipherTest940, TestSize.Level0)
 {
     HcfResult res = HCF_SUCCESS;
@@ -1316,7 +1316,7 @@ HWTEST_F(CryptoRsaCipherTest, CryptoRsaCipherTest940, TestSize.Level0)
     res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
     EXPECT_EQ(res, HCF_SUCCESS);
     res = cipher->init(cipher, DECRYPT_MODE, (HcfKey *)keyPair->priKey, nullptr);
-    EXPECT_NE(res, HCF_SUCCESS);
+    EXPECT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(keyPair);
     HcfObjDestroy(generator);
@@ -825,7 +825,7 @@ HWTEST_F(CryptoRsaSignTest, CryptoRsaSignTest500, TestSize.Level0)
     res = sign->init(sign, nullptr, prikey);
     EXPECT_EQ(res, HCF_SUCCESS);
     res = sign->init(sign, nullptr, prikey);
-    EXPECT_NE(res, HCF_SUCCESS);
+    EXPECT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(sign);
     HcfObjDestroy(keyPair);
@@ -362,7 +362,7 @@ HWTEST_F(CryptoRsaVerifyTest, CryptoRsaVerifyTest192, TestSize.Level0)
     res = verify->init(verify, nullptr, pubkey);
     EXPECT_EQ(res, HCF_SUCCESS);
     res = verify->init(verify, nullptr, pubkey);
-    EXPECT_NE(res, HCF_SUCCESS);
+    EXPECT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(verify);
     HcfObjDestroy(keyPair);
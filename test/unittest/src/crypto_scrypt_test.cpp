@@ -272,4 +272,72 @@ HWTEST_F(CryptoScryptTest, CryptoScryptTestError12, TestSize.Level1)
     HcfResult ret = HcfKdfCreate(nullptr, nullptr);
     EXPECT_NE(ret, HCF_SUCCESS);
 }
+
+// RFC 7914 section 12, the 16 lanes are mixed on four threads
+HWTEST_F(CryptoScryptTest, CryptoScryptParallelTest001, TestSize.Level0)
+{
+    const uint8_t expect[] = {
+    0xfd, 0xba, 0xbe, 0x1c, 0x9d, 0x34, 0x72, 0x00, 0x78, 0x56, 0xe7, 0x19,
+    0x0d, 0x01, 0xe9, 0xfe, 0x7c, 0x6a, 0xd7, 0xcb, 0xc8, 0x23, 0x78, 0x30,
+    0xe7, 0x73, 0x76, 0x63, 0x4b, 0x37, 0x31, 0x62, 0x2e, 0xaf, 0x30, 0xd9,
+    0x2e, 0x22, 0xa3, 0x88, 0x6f, 0xf1, 0x09, 0x27, 0x9d, 0x98, 0x30, 0xda,
+    0xc7, 0x27, 0xaf, 0xb9, 0x4a, 0x83, 0xee, 0x6d, 0x83, 0x60, 0xcb, 0xdf,
+    0xa2, 0xcc, 0x06, 0x40
+    };
+    HcfKdf *generator = nullptr;
+    ASSERT_EQ(HcfKdfCreate("SCRYPT", &generator), HCF_SUCCESS);
+    uint8_t out[sizeof(expect)] = {0};
+    HcfScryptParamsSpec params = {
+        .base = { .algName = "SCRYPT", },
+        .passPhrase = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>("password")),
+            .len = strlen("password") },
+        .salt = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>("NaCl")), .len = strlen("NaCl") },
+        .n = 1024,
+        .r = 8,
+        .p = 16,
+        .maxMem = 32 * 1024 * 1024,
+        .output = { .data = out, .len = sizeof(out) },
+        .threadNum = 4,
+    };
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(out, expect, sizeof(expect)), 0);
+
+    // memory for the lanes and one scratch area only, the derivation stays on one thread
+    (void)memset_s(out, sizeof(out), 0, sizeof(out));
+    params.maxMem = 1067008;
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(out, expect, sizeof(expect)), 0);
+    HcfObjDestroy(generator);
+}
+
+HWTEST_F(CryptoScryptTest, CryptoScryptParallelTest002, TestSize.Level0)
+{
+    HcfKdf *generator = nullptr;
+    ASSERT_EQ(HcfKdfCreate("SCRYPT", &generator), HCF_SUCCESS);
+    uint8_t serialOut[OUT_PUT_MAX_LENGTH] = {0};
+    uint8_t parallelOut[OUT_PUT_MAX_LENGTH] = {0};
+    HcfScryptParamsSpec params = {
+        .base = { .algName = "SCRYPT", },
+        .passPhrase = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>("123456")), .len = strlen("123456") },
+        .salt = { .data = reinterpret_cast<uint8_t *>(const_cast<char *>("salt")), .len = strlen("salt") },
+        .n = 256,
+        .r = 3,
+        .p = 5,
+        .maxMem = 32 * 1024 * 1024,
+        .output = { .data = serialOut, .len = 96 },
+    };
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    params.output.data = parallelOut;
+    params.threadNum = 2;
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(serialOut, parallelOut, sizeof(serialOut)), 0);
+
+    // invalid parameters are reported by the serial path as before
+    params.n = 255;
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_ERR_CRYPTO_OPERATION);
+    params.n = 256;
+    params.threadNum = 65;
+    EXPECT_EQ(generator->generateSecret(generator, &(params.base)), HCF_INVALID_PARAMS);
+    HcfObjDestroy(generator);
+}
 }
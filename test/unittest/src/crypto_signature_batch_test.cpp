@@ -0,0 +1,389 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "memory.h"
+#include "openssl_adapter_mock.h"
+#include "signature.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoSignatureBatchTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+constexpr uint32_t BATCH_TEST_COUNT = 37;
+constexpr uint32_t BATCH_TEST_WORKER_NUM = 4;
+
+static const char *g_mockPrefix = "pending prefix";
+static HcfBlob g_mockPrefixInput = {
+    .data = (uint8_t *)g_mockPrefix,
+    .len = 15
+};
+
+class BatchMessages {
+public:
+    explicit BatchMessages(uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            messages_.push_back("batch message " + to_string(i));
+        }
+        for (auto &message : messages_) {
+            blobs_.push_back({ .data = reinterpret_cast<uint8_t *>(&message[0]), .len = message.size() });
+        }
+    }
+
+    HcfBlob *Blobs()
+    {
+        return blobs_.data();
+    }
+
+private:
+    vector<string> messages_;
+    vector<HcfBlob> blobs_;
+};
+
+static HcfKeyPair *GenerateTestKeyPair(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfKeyPair *keyPair = nullptr;
+    HcfResult res = generator->generateKeyPair(generator, nullptr, &keyPair);
+    HcfObjDestroy(generator);
+    return (res == HCF_SUCCESS) ? keyPair : nullptr;
+}
+
+static bool VerifyBatchSignature(HcfVerify *verify, HcfPubKey *pubKey, HcfBlob *input, HcfBlob *signatureData)
+{
+    return (verify->init(verify, nullptr, pubKey) == HCF_SUCCESS) && verify->verify(verify, input, signatureData);
+}
+
+// Signs a batch and checks every signature lies in the arena and verifies against its own message only.
+static void SignBatchAndVerifyTest(HcfSign *sign, HcfVerify *verify, HcfPubKey *pubKey, uint32_t count,
+    uint32_t workerNum)
+{
+    BatchMessages messages(count);
+    vector<HcfBlob> signatures(count);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    HcfResult res = sign->signBatch(sign, messages.Blobs(), count, workerNum, &arena, signatures.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    ASSERT_NE(arena.data, nullptr);
+
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_GE(signatures[i].data, arena.data);
+        ASSERT_LE(signatures[i].data + signatures[i].len, arena.data + arena.len);
+        EXPECT_TRUE(VerifyBatchSignature(verify, pubKey, &messages.Blobs()[i], &signatures[i]));
+    }
+    EXPECT_FALSE(VerifyBatchSignature(verify, pubKey, &messages.Blobs()[0], &signatures[count - 1]));
+    HcfBlobDataFree(&arena);
+}
+
+static void SignBatchTest(const char *keyAlgName, const char *signAlgName, uint32_t count, uint32_t workerNum)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate(signAlgName, &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate(signAlgName, &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    SignBatchAndVerifyTest(sign, verify, keyPair->pubKey, count, workerNum);
+
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest001, TestSize.Level0)
+{
+    SignBatchTest("ECC256", "ECC256|SHA256", BATCH_TEST_COUNT, 0);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest002, TestSize.Level0)
+{
+    SignBatchTest("ECC256", "ECC256|SHA256", BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest003, TestSize.Level0)
+{
+    SignBatchTest("ECC_BrainPoolP256r1", "ECC_BrainPoolP256r1|SHA256", BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest004, TestSize.Level0)
+{
+    SignBatchTest("SM2_256", "SM2|SM3", BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest005, TestSize.Level0)
+{
+    SignBatchTest("Ed25519", "Ed25519", BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest006, TestSize.Level0)
+{
+    SignBatchTest("RSA1024|PRIMES_2", "RSA1024|PKCS1|SHA256", BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+}
+
+// More workers than messages.
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest007, TestSize.Level0)
+{
+    SignBatchTest("ECC256", "ECC256|SHA256", 3, HCF_SIGN_MAX_BATCH_WORKER_NUM);
+}
+
+// PSS salt length set after init applies to every signature of the batch.
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest008, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA2048|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("RSA2048|PSS|SHA256|MGF1_SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->setSignSpecInt(sign, PSS_SALT_LEN_INT, 32);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("RSA2048|PSS|SHA256|MGF1_SHA256", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->setVerifySpecInt(verify, PSS_SALT_LEN_INT, 32);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    SignBatchAndVerifyTest(sign, verify, keyPair->pubKey, BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+// The SM2 user id set after init applies to every signature of the batch.
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest009, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("SM2_256");
+    ASSERT_NE(keyPair, nullptr);
+    uint8_t userId[] = { 'u', 's', 'e', 'r', '0', '1' };
+    HcfBlob userIdBlob = { .data = userId, .len = sizeof(userId) };
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("SM2|SM3", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->setSignSpecUint8Array(sign, SM2_USER_ID_UINT8ARR, userIdBlob);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("SM2|SM3", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->setVerifySpecUint8Array(verify, SM2_USER_ID_UINT8ARR, userIdBlob);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    SignBatchAndVerifyTest(sign, verify, keyPair->pubKey, BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+// Pending update data is neither signed by the batch nor lost for the next sign.
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest010, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("RSA1024|PKCS1|SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->update(sign, &g_mockPrefixInput);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("RSA1024|PKCS1|SHA256", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    SignBatchAndVerifyTest(sign, verify, keyPair->pubKey, BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM);
+
+    BatchMessages messages(1);
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &messages.Blobs()[0], &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->init(verify, nullptr, keyPair->pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->update(verify, &g_mockPrefixInput);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_TRUE(verify->verify(verify, &messages.Blobs()[0], &out));
+
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+// OnlySign signs the inputs as they are, checked through recover.
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest011, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("RSA1024|PKCS1|NoHash|OnlySign", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("RSA1024|PKCS1|NoHash|Recover", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->init(verify, nullptr, keyPair->pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> signatures(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, BATCH_TEST_WORKER_NUM, &arena,
+        signatures.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    for (uint32_t i = 0; i < BATCH_TEST_COUNT; i++) {
+        HcfBlob recovered = { .data = nullptr, .len = 0 };
+        res = verify->recover(verify, &signatures[i], &recovered);
+        ASSERT_EQ(res, HCF_SUCCESS);
+        ASSERT_EQ(recovered.len, messages.Blobs()[i].len);
+        EXPECT_EQ(memcmp(recovered.data, messages.Blobs()[i].data, recovered.len), 0);
+        HcfBlobDataFree(&recovered);
+    }
+
+    HcfBlobDataFree(&arena);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest012, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("ECC256");
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("ECC256|SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> signatures(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->signBatch(nullptr, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = sign->signBatch(sign, nullptr, BATCH_TEST_COUNT, 0, &arena, signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = sign->signBatch(sign, messages.Blobs(), 0, 0, &arena, signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, HCF_SIGN_MAX_BATCH_WORKER_NUM + 1, &arena,
+        signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, nullptr, signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, nullptr);
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    messages.Blobs()[1].len = 0;
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, signatures.data());
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    EXPECT_EQ(arena.data, nullptr);
+
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+// Engines without a batch path report the call as invalid.
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest013, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("DSA2048");
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("DSA2048|SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> signatures(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, signatures.data());
+    EXPECT_EQ(res, HCF_ERR_INVALID_CALL);
+
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+// Every OpenSSL call of the batch path failing in turn must fail cleanly without an arena.
+static void SignBatchOpensslMockTest(const char *keyAlgName, const char *signAlgName)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate(signAlgName, &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    BatchMessages messages(BATCH_TEST_COUNT);
+    vector<HcfBlob> signatures(BATCH_TEST_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+
+    StartRecordOpensslCallNum();
+    res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, signatures.data());
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlobDataFree(&arena);
+    uint32_t callNum = GetOpensslCallNum();
+    for (uint32_t i = 0; i < callNum; i++) {
+        ResetOpensslCallNum();
+        SetOpensslCallMockIndex(i);
+        res = sign->signBatch(sign, messages.Blobs(), BATCH_TEST_COUNT, 0, &arena, signatures.data());
+        if (res == HCF_SUCCESS) {
+            HcfBlobDataFree(&arena);
+            continue;
+        }
+        EXPECT_EQ(arena.data, nullptr);
+        EXPECT_EQ(signatures[0].data, nullptr);
+    }
+    EndRecordOpensslCallNum();
+
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest014, TestSize.Level0)
+{
+    SignBatchOpensslMockTest("ECC256", "ECC256|SHA256");
+}
+
+HWTEST_F(CryptoSignatureBatchTest, CryptoSignatureBatchTest015, TestSize.Level0)
+{
+    SignBatchOpensslMockTest("RSA1024|PRIMES_2", "RSA1024|PKCS1|NoHash|OnlySign");
+}
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "md.h"
+#include "memory.h"
+#include "signature.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoSignaturePrehashTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+static const char *g_mockMessage = "hello world";
+static HcfBlob g_mockInput = {
+    .data = (uint8_t *)g_mockMessage,
+    .len = 12
+};
+
+static HcfKeyPair *GenerateTestKeyPair(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfKeyPair *keyPair = nullptr;
+    HcfResult res = generator->generateKeyPair(generator, nullptr, &keyPair);
+    HcfObjDestroy(generator);
+    return (res == HCF_SUCCESS) ? keyPair : nullptr;
+}
+
+static HcfResult ComputeDigest(const char *mdName, HcfBlob *input, HcfBlob *digest)
+{
+    HcfMd *md = nullptr;
+    HcfResult res = HcfMdCreate(mdName, &md);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    res = md->update(md, input);
+    if (res == HCF_SUCCESS) {
+        res = md->doFinal(md, digest);
+    }
+    HcfObjDestroy(md);
+    return res;
+}
+
+static HcfResult PrehashSign(const char *signAlgName, HcfPriKey *priKey, HcfBlob *digest, HcfBlob *signatureData)
+{
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate(signAlgName, &sign);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    res = sign->setSignSpecBool(sign, SIGN_PREHASH_BOOL, true);
+    if (res == HCF_SUCCESS) {
+        res = sign->init(sign, nullptr, priKey);
+    }
+    if (res == HCF_SUCCESS) {
+        res = sign->sign(sign, digest, signatureData);
+    }
+    HcfObjDestroy(sign);
+    return res;
+}
+
+static bool TestVerify(const char *signAlgName, bool isPrehash, HcfPubKey *pubKey, HcfBlob *data,
+    HcfBlob *signatureData)
+{
+    HcfVerify *verify = nullptr;
+    if (HcfVerifyCreate(signAlgName, &verify) != HCF_SUCCESS) {
+        return false;
+    }
+    bool flag = (verify->setVerifySpecBool(verify, SIGN_PREHASH_BOOL, isPrehash) == HCF_SUCCESS) &&
+        (verify->init(verify, nullptr, pubKey) == HCF_SUCCESS) && verify->verify(verify, data, signatureData);
+    HcfObjDestroy(verify);
+    return flag;
+}
+
+// A prehash signature verifies over the message and a message signature verifies over the digest.
+static void PrehashInteropTest(const char *keyAlgName, const char *signAlgName, const char *mdName)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfBlob digest = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(ComputeDigest(mdName, &g_mockInput, &digest), HCF_SUCCESS);
+
+    HcfBlob prehashSig = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(PrehashSign(signAlgName, keyPair->priKey, &digest, &prehashSig), HCF_SUCCESS);
+    EXPECT_TRUE(TestVerify(signAlgName, false, keyPair->pubKey, &g_mockInput, &prehashSig));
+    EXPECT_TRUE(TestVerify(signAlgName, true, keyPair->pubKey, &digest, &prehashSig));
+
+    HcfSign *sign = nullptr;
+    ASSERT_EQ(HcfSignCreate(signAlgName, &sign), HCF_SUCCESS);
+    ASSERT_EQ(sign->init(sign, nullptr, keyPair->priKey), HCF_SUCCESS);
+    HcfBlob messageSig = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(sign->sign(sign, &g_mockInput, &messageSig), HCF_SUCCESS);
+    EXPECT_TRUE(TestVerify(signAlgName, true, keyPair->pubKey, &digest, &messageSig));
+    // The message itself is not a valid digest input.
+    EXPECT_FALSE(TestVerify(signAlgName, true, keyPair->pubKey, &g_mockInput, &messageSig));
+
+    HcfBlobDataFree(&messageSig);
+    HcfBlobDataFree(&prehashSig);
+    HcfBlobDataFree(&digest);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+static void PrehashWrongDigestLenTest(const char *keyAlgName, const char *signAlgName)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+    HcfBlob digest = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(ComputeDigest("SHA1", &g_mockInput, &digest), HCF_SUCCESS);
+
+    HcfBlob signatureData = { .data = nullptr, .len = 0 };
+    EXPECT_NE(PrehashSign(signAlgName, keyPair->priKey, &digest, &signatureData), HCF_SUCCESS);
+    EXPECT_EQ(signatureData.data, nullptr);
+
+    HcfBlobDataFree(&digest);
+    HcfObjDestroy(keyPair);
+}
+
+static void PrehashUpdateRejectedTest(const char *keyAlgName, const char *signAlgName)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+
+    HcfSign *sign = nullptr;
+    ASSERT_EQ(HcfSignCreate(signAlgName, &sign), HCF_SUCCESS);
+    ASSERT_EQ(sign->setSignSpecBool(sign, SIGN_PREHASH_BOOL, true), HCF_SUCCESS);
+    ASSERT_EQ(sign->init(sign, nullptr, keyPair->priKey), HCF_SUCCESS);
+    EXPECT_EQ(sign->update(sign, &g_mockInput), HCF_ERR_INVALID_CALL);
+    // The mode is fixed once the object has been initialized.
+    EXPECT_EQ(sign->setSignSpecBool(sign, SIGN_PREHASH_BOOL, false), HCF_ERR_INVALID_CALL);
+
+    HcfVerify *verify = nullptr;
+    ASSERT_EQ(HcfVerifyCreate(signAlgName, &verify), HCF_SUCCESS);
+    ASSERT_EQ(verify->setVerifySpecBool(verify, SIGN_PREHASH_BOOL, true), HCF_SUCCESS);
+    ASSERT_EQ(verify->init(verify, nullptr, keyPair->pubKey), HCF_SUCCESS);
+    EXPECT_EQ(verify->update(verify, &g_mockInput), HCF_ERR_INVALID_CALL);
+    EXPECT_EQ(verify->setVerifySpecBool(verify, SIGN_PREHASH_BOOL, false), HCF_ERR_INVALID_CALL);
+
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest001, TestSize.Level0)
+{
+    PrehashInteropTest("ECC256", "ECC256|SHA256", "SHA256");
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest002, TestSize.Level0)
+{
+    PrehashInteropTest("ECC_BrainPoolP256r1", "ECC_BrainPoolP256r1|SHA384", "SHA384");
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest003, TestSize.Level0)
+{
+    PrehashInteropTest("RSA2048", "RSA2048|PKCS1|SHA256", "SHA256");
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest004, TestSize.Level0)
+{
+    PrehashInteropTest("RSA2048", "RSA2048|PSS|SHA256|MGF1_SHA256", "SHA256");
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest005, TestSize.Level0)
+{
+    PrehashInteropTest("DSA2048", "DSA2048|SHA256", "SHA256");
+}
+
+// SM2 signs SM3(Z || M), which the caller computes with the user id, so only the digest paths are compared.
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest006, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("SM2_256");
+    ASSERT_NE(keyPair, nullptr);
+    HcfBlob digest = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(ComputeDigest("SM3", &g_mockInput, &digest), HCF_SUCCESS);
+
+    HcfBlob signatureData = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(PrehashSign("SM2_256|SM3", keyPair->priKey, &digest, &signatureData), HCF_SUCCESS);
+    EXPECT_TRUE(TestVerify("SM2_256|SM3", true, keyPair->pubKey, &digest, &signatureData));
+    EXPECT_FALSE(TestVerify("SM2_256|SM3", false, keyPair->pubKey, &g_mockInput, &signatureData));
+    digest.data[0] ^= 1;
+    EXPECT_FALSE(TestVerify("SM2_256|SM3", true, keyPair->pubKey, &digest, &signatureData));
+
+    HcfBlobDataFree(&signatureData);
+    HcfBlobDataFree(&digest);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest007, TestSize.Level0)
+{
+    PrehashWrongDigestLenTest("ECC256", "ECC256|SHA256");
+    PrehashWrongDigestLenTest("RSA2048", "RSA2048|PKCS1|SHA256");
+    PrehashWrongDigestLenTest("RSA2048", "RSA2048|PSS|SHA256|MGF1_SHA256");
+    PrehashWrongDigestLenTest("DSA2048", "DSA2048|SHA256");
+    PrehashWrongDigestLenTest("SM2_256", "SM2_256|SM3");
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest008, TestSize.Level0)
+{
+    PrehashUpdateRejectedTest("ECC256", "ECC256|SHA256");
+    PrehashUpdateRejectedTest("DSA2048", "DSA2048|SHA256");
+    PrehashUpdateRejectedTest("SM2_256", "SM2_256|SM3");
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest009, TestSize.Level0)
+{
+    HcfSign *sign = nullptr;
+    ASSERT_EQ(HcfSignCreate("DSA2048|NoHash", &sign), HCF_SUCCESS);
+    EXPECT_EQ(sign->setSignSpecBool(sign, SIGN_PREHASH_BOOL, true), HCF_INVALID_PARAMS);
+    EXPECT_EQ(sign->setSignSpecBool(sign, ML_DSA_MU_BOOL, true), HCF_INVALID_PARAMS);
+    HcfObjDestroy(sign);
+
+    HcfVerify *verify = nullptr;
+    ASSERT_EQ(HcfVerifyCreate("RSA2048|PKCS1|SHA256|Recover", &verify), HCF_SUCCESS);
+    EXPECT_EQ(verify->setVerifySpecBool(verify, SIGN_PREHASH_BOOL, true), HCF_INVALID_PARAMS);
+    HcfObjDestroy(verify);
+
+    ASSERT_EQ(HcfSignCreate("Ed25519", &sign), HCF_SUCCESS);
+    EXPECT_NE(sign->setSignSpecBool(sign, SIGN_PREHASH_BOOL, true), HCF_SUCCESS);
+    HcfObjDestroy(sign);
+}
+
+HWTEST_F(CryptoSignaturePrehashTest, CryptoSignaturePrehashTest010, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("ECC256");
+    ASSERT_NE(keyPair, nullptr);
+    HcfBlob digest = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(ComputeDigest("SHA256", &g_mockInput, &digest), HCF_SUCCESS);
+
+    HcfSign *sign = nullptr;
+    ASSERT_EQ(HcfSignCreate("ECC256|SHA256", &sign), HCF_SUCCESS);
+    ASSERT_EQ(sign->setSignSpecBool(sign, SIGN_PREHASH_BOOL, true), HCF_SUCCESS);
+    ASSERT_EQ(sign->init(sign, nullptr, keyPair->priKey), HCF_SUCCESS);
+    HcfBlob digests[] = { digest, digest, digest };
+    HcfBlob signatures[3] = {};
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(sign->signBatch(sign, digests, 3, 2, &arena, signatures), HCF_SUCCESS);
+    for (HcfBlob &signatureData : signatures) {
+        EXPECT_TRUE(TestVerify("ECC256|SHA256", false, keyPair->pubKey, &g_mockInput, &signatureData));
+    }
+
+    HcfBlobDataFree(&arena);
+    HcfBlobDataFree(&digest);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+}
@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "memory.h"
+#include "signature.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoSignatureResetTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+static const char *g_mockMessage = "hello world";
+static HcfBlob g_mockInput = {
+    .data = (uint8_t *)g_mockMessage,
+    .len = 12
+};
+
+static const char *g_mockPrefix = "discarded prefix";
+static HcfBlob g_mockPrefixInput = {
+    .data = (uint8_t *)g_mockPrefix,
+    .len = 17
+};
+
+static HcfKeyPair *GenerateTestKeyPair(const char *algName)
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    if (HcfAsyKeyGeneratorCreate(algName, &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfKeyPair *keyPair = nullptr;
+    HcfResult res = generator->generateKeyPair(generator, nullptr, &keyPair);
+    HcfObjDestroy(generator);
+    return (res == HCF_SUCCESS) ? keyPair : nullptr;
+}
+
+static bool VerifyTestSignature(const char *algName, HcfPubKey *pubKey, HcfBlob *signatureData)
+{
+    HcfVerify *verify = nullptr;
+    if (HcfVerifyCreate(algName, &verify) != HCF_SUCCESS) {
+        return false;
+    }
+    bool flag = (verify->init(verify, nullptr, pubKey) == HCF_SUCCESS) &&
+        verify->verify(verify, &g_mockInput, signatureData);
+    HcfObjDestroy(verify);
+    return flag;
+}
+
+static void SignReinitWithNewKeyTest(const char *keyAlgName, const char *signAlgName)
+{
+    HcfKeyPair *keyPair1 = GenerateTestKeyPair(keyAlgName);
+    HcfKeyPair *keyPair2 = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair1, nullptr);
+    ASSERT_NE(keyPair2, nullptr);
+
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate(signAlgName, &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    res = sign->init(sign, nullptr, keyPair1->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob out1 = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &g_mockInput, &out1);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    res = sign->init(sign, nullptr, keyPair2->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob out2 = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &g_mockInput, &out2);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    EXPECT_TRUE(VerifyTestSignature(signAlgName, keyPair1->pubKey, &out1));
+    EXPECT_TRUE(VerifyTestSignature(signAlgName, keyPair2->pubKey, &out2));
+    EXPECT_FALSE(VerifyTestSignature(signAlgName, keyPair1->pubKey, &out2));
+
+    HcfBlobDataFree(&out1);
+    HcfBlobDataFree(&out2);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair1);
+    HcfObjDestroy(keyPair2);
+}
+
+static void SignResetDiscardsUpdateTest(const char *keyAlgName, const char *signAlgName)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair(keyAlgName);
+    ASSERT_NE(keyPair, nullptr);
+
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate(signAlgName, &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    res = sign->update(sign, &g_mockPrefixInput);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->reset(sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &g_mockInput, &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_TRUE(VerifyTestSignature(signAlgName, keyPair->pubKey, &out));
+
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest001, TestSize.Level0)
+{
+    SignReinitWithNewKeyTest("ECC256", "ECC256|SHA256");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest002, TestSize.Level0)
+{
+    SignResetDiscardsUpdateTest("ECC256", "ECC256|SHA256");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest003, TestSize.Level0)
+{
+    SignReinitWithNewKeyTest("RSA1024|PRIMES_2", "RSA1024|PKCS1|SHA256");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest004, TestSize.Level0)
+{
+    SignResetDiscardsUpdateTest("RSA1024|PRIMES_2", "RSA1024|PKCS1|SHA256");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest005, TestSize.Level0)
+{
+    SignReinitWithNewKeyTest("SM2_256", "SM2|SM3");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest006, TestSize.Level0)
+{
+    SignResetDiscardsUpdateTest("SM2_256", "SM2|SM3");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest007, TestSize.Level0)
+{
+    SignResetDiscardsUpdateTest("DSA2048", "DSA2048|SHA256");
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest008, TestSize.Level0)
+{
+    SignReinitWithNewKeyTest("Ed25519", "Ed25519");
+}
+
+// The EVP_PKEY_CTX of the only sign mode is bound to the key and must follow a re-init.
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest009, TestSize.Level0)
+{
+    HcfKeyPair *keyPair1 = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    HcfKeyPair *keyPair2 = GenerateTestKeyPair("RSA1024|PRIMES_2");
+    ASSERT_NE(keyPair1, nullptr);
+    ASSERT_NE(keyPair2, nullptr);
+
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("RSA1024|PKCS1|NoHash|OnlySign", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair1->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair2->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &g_mockInput, &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("RSA1024|PKCS1|NoHash|Recover", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->init(verify, nullptr, keyPair2->pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob rawSignatureData = { .data = nullptr, .len = 0 };
+    res = verify->recover(verify, &out, &rawSignatureData);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    ASSERT_EQ(rawSignatureData.len, g_mockInput.len);
+    EXPECT_EQ(memcmp(rawSignatureData.data, g_mockInput.data, g_mockInput.len), 0);
+
+    HcfBlobDataFree(&rawSignatureData);
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair1);
+    HcfObjDestroy(keyPair2);
+}
+
+// PSS salt length set after init must survive a reset.
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest010, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("RSA2048|PRIMES_2");
+    ASSERT_NE(keyPair, nullptr);
+
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("RSA2048|PSS|SHA256|MGF1_SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->setSignSpecInt(sign, PSS_SALT_LEN_INT, 32);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    res = sign->update(sign, &g_mockPrefixInput);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->reset(sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    int32_t saltLen = 0;
+    res = sign->getSignSpecInt(sign, PSS_SALT_LEN_INT, &saltLen);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_EQ(saltLen, 32);
+
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &g_mockInput, &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("RSA2048|PSS|SHA256|MGF1_SHA256", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->init(verify, nullptr, keyPair->pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->setVerifySpecInt(verify, PSS_SALT_LEN_INT, 32);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_TRUE(verify->verify(verify, &g_mockInput, &out));
+
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+// SM2 user id set after init must survive a reset.
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest011, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("SM2_256");
+    ASSERT_NE(keyPair, nullptr);
+    uint8_t userId[] = { 'u', 's', 'e', 'r', '0', '1' };
+    HcfBlob userIdBlob = { .data = userId, .len = sizeof(userId) };
+
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("SM2|SM3", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->setSignSpecUint8Array(sign, SM2_USER_ID_UINT8ARR, userIdBlob);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->update(sign, &g_mockPrefixInput);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->reset(sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = sign->sign(sign, &g_mockInput, &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("SM2|SM3", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->init(verify, nullptr, keyPair->pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->setVerifySpecUint8Array(verify, SM2_USER_ID_UINT8ARR, userIdBlob);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_TRUE(verify->verify(verify, &g_mockInput, &out));
+
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest012, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateTestKeyPair("ECC256");
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("ECC256|SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    HcfBlob out = { .data = nullptr, .len = 0 };
+    res = sign->init(sign, nullptr, keyPair->priKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->sign(sign, &g_mockInput, &out);
+    ASSERT_EQ(res, HCF_SUCCESS);
+
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("ECC256|SHA256", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->init(verify, nullptr, keyPair->pubKey);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->update(verify, &g_mockPrefixInput);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->reset(verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_TRUE(verify->verify(verify, &g_mockInput, &out));
+
+    res = verify->reset(verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    EXPECT_TRUE(verify->verify(verify, &g_mockInput, &out));
+
+    HcfBlobDataFree(&out);
+    HcfObjDestroy(verify);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSignatureResetTest, CryptoSignatureResetTest013, TestSize.Level0)
+{
+    HcfSign *sign = nullptr;
+    HcfResult res = HcfSignCreate("ECC256|SHA256", &sign);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = sign->reset(sign);
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = sign->reset(nullptr);
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    HcfObjDestroy(sign);
+
+    HcfVerify *verify = nullptr;
+    res = HcfVerifyCreate("RSA1024|PKCS1|SHA256", &verify);
+    ASSERT_EQ(res, HCF_SUCCESS);
+    res = verify->reset(verify);
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    res = verify->reset(nullptr);
+    EXPECT_EQ(res, HCF_INVALID_PARAMS);
+    HcfObjDestroy(verify);
+}
+}
@@ -268,7 +268,7 @@ HWTEST_F(CryptoSm2SignTest, CryptoSm2SignTest017, TestSize.Level0)
 
     res = sign->init(sign, nullptr, sm2256KeyPair_->priKey);
 
-    ASSERT_EQ(res, HCF_INVALID_PARAMS);
+    ASSERT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(sign);
 }
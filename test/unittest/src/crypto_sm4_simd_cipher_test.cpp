@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <openssl/evp.h>
+#include <openssl/modes.h>
+#include <vector>
+#include "securec.h"
+
+#include "blob.h"
+#include "cipher.h"
+#include "detailed_gcm_params.h"
+#include "detailed_iv_params.h"
+#include "memory.h"
+#include "sm4_simd.h"
+#include "sm4_simd_openssl.h"
+#include "sym_key_generator.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t TEST_BLOCK_SIZE = 16;
+constexpr uint32_t TEST_MAX_BLOCK_NUM = 41;
+constexpr uint32_t TEST_GCM_TAG_LEN = 16;
+/* odd sizes so that updates cut through blocks and through the 8 block groups of the kernel */
+constexpr uint32_t TEST_UPDATE_LENS[] = { 1, 15, 17, 127, 129, 1000, 4096 };
+
+/* GB/T 32907-2016 appendix A */
+const uint8_t g_kat[TEST_BLOCK_SIZE] = {
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10
+};
+const uint8_t g_katCipherText[TEST_BLOCK_SIZE] = {
+    0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e, 0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46
+};
+
+/* RFC 8998 appendix A.1, the key is g_kat */
+const uint8_t g_gcmIv[] = { 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00, 0x00, 0xab, 0xcd };
+const uint8_t g_gcmAad[] = {
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2
+};
+const uint8_t g_gcmPlainText[] = {
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa
+};
+const uint8_t g_gcmCipherTextAndTag[] = {
+    0x17, 0xf3, 0x99, 0xf0, 0x8c, 0x67, 0xd5, 0xee, 0x19, 0xd0, 0xdc, 0x99, 0x69, 0xc4, 0xbb, 0x7d,
+    0x5f, 0xd4, 0x6f, 0xd3, 0x75, 0x64, 0x89, 0x06, 0x91, 0x57, 0xb2, 0x82, 0xbb, 0x20, 0x07, 0x35,
+    0xd8, 0x27, 0x10, 0xca, 0x5c, 0x22, 0xf0, 0xcc, 0xfa, 0x7c, 0xbf, 0x93, 0xd4, 0x96, 0xac, 0x15,
+    0xa5, 0x68, 0x34, 0xcb, 0xcf, 0x98, 0xc3, 0x97, 0xb4, 0x02, 0x4a, 0x26, 0x91, 0x23, 0x3b, 0x8d,
+    0x83, 0xde, 0x35, 0x41, 0xe4, 0xc2, 0xb5, 0x81, 0x77, 0xe0, 0x65, 0xa9, 0xbf, 0x7b, 0x62, 0xec
+};
+
+class CryptoSm4SimdCipherTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+static vector<uint8_t> MakeData(uint32_t len)
+{
+    vector<uint8_t> data(len);
+    for (uint32_t i = 0; i < len; i++) {
+        data[i] = static_cast<uint8_t>(i * 29 + 3);
+    }
+    return data;
+}
+
+static HcfSymKey *ConvertSm4Key(const uint8_t *keyData)
+{
+    HcfSymKeyGenerator *generator = nullptr;
+    HcfSymKey *key = nullptr;
+    if (HcfSymKeyGeneratorCreate("SM4_128", &generator) != HCF_SUCCESS) {
+        return nullptr;
+    }
+    HcfBlob keyBlob = { .data = const_cast<uint8_t *>(keyData), .len = TEST_BLOCK_SIZE };
+    (void)generator->convertSymKey(generator, &keyBlob, &key);
+    HcfObjDestroy(generator);
+    return key;
+}
+
+static void Append(vector<uint8_t> &result, HcfBlob *out)
+{
+    if (out->data != nullptr) {
+        result.insert(result.end(), out->data, out->data + out->len);
+    }
+    HcfBlobDataClearAndFree(out);
+}
+
+/* Feeds the input through the framework in uneven updates, the tail goes to doFinal. */
+static HcfResult RunFramework(const char *alg, enum HcfCryptoMode mode, HcfSymKey *key, HcfParamsSpec *params,
+    const vector<uint8_t> &input, vector<uint8_t> &result)
+{
+    HcfCipher *cipher = nullptr;
+    HcfResult ret = HcfCipherCreate(alg, &cipher);
+    if (ret != HCF_SUCCESS) {
+        return ret;
+    }
+    ret = cipher->init(cipher, mode, (HcfKey *)key, params);
+    uint8_t *data = const_cast<uint8_t *>(input.data());
+    uint32_t offset = 0;
+    for (uint32_t i = 0; (ret == HCF_SUCCESS) && (offset < input.size()); i++) {
+        uint32_t len = TEST_UPDATE_LENS[i % (sizeof(TEST_UPDATE_LENS) / sizeof(TEST_UPDATE_LENS[0]))];
+        len = (len < input.size() - offset) ? len : input.size() - offset;
+        HcfBlob in = { .data = data + offset, .len = len };
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        ret = cipher->update(cipher, &in, &out);
+        Append(result, &out);
+        offset += len;
+    }
+    if (ret == HCF_SUCCESS) {
+        HcfBlob out = { .data = nullptr, .len = 0 };
+        ret = cipher->doFinal(cipher, nullptr, &out);
+        Append(result, &out);
+    }
+    HcfObjDestroy(cipher);
+    return ret;
+}
+
+/* The existing engine: OpenSSL's own SM4, driven in one shot. */
+static bool RunOpenssl(const EVP_CIPHER *evpCipher, int enc, const uint8_t *key, const HcfBlob *iv,
+    const vector<uint8_t> &input, vector<uint8_t> &result, int padding)
+{
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    result.assign(input.size() + TEST_BLOCK_SIZE, 0);
+    int len = 0;
+    int finalLen = 0;
+    bool ok = (ctx != nullptr) &&
+        (EVP_CipherInit_ex(ctx, evpCipher, nullptr, key, (iv != nullptr) ? iv->data : nullptr, enc) == 1);
+    ok = ok && (EVP_CIPHER_CTX_set_padding(ctx, padding) == 1);
+    ok = ok && (EVP_CipherUpdate(ctx, result.data(), &len, input.data(), input.size()) == 1);
+    ok = ok && (EVP_CipherFinal_ex(ctx, result.data() + len, &finalLen) == 1);
+    result.resize(ok ? len + finalLen : 0);
+    EVP_CIPHER_CTX_free(ctx);
+    return ok;
+}
+
+static void OpensslSm4Block(const unsigned char in[16], unsigned char out[16], const void *key)
+{
+    int len = 0;
+    (void)EVP_EncryptUpdate((EVP_CIPHER_CTX *)key, out, &len, in, TEST_BLOCK_SIZE);
+}
+
+/* OpenSSL's generic GCM over OpenSSL's SM4, providers before 3.2 do not offer SM4-GCM by name. */
+static bool RunOpensslGcm(const uint8_t *key, const HcfBlob *iv, const HcfBlob *aad, const vector<uint8_t> &input,
+    vector<uint8_t> &result)
+{
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    bool ok = (ctx != nullptr) && (EVP_EncryptInit_ex(ctx, EVP_sm4_ecb(), nullptr, key, nullptr) == 1);
+    GCM128_CONTEXT *gcm = ok ? CRYPTO_gcm128_new(ctx, OpensslSm4Block) : nullptr;
+    result.assign(input.size() + TEST_GCM_TAG_LEN, 0);
+    ok = (gcm != nullptr);
+    if (ok) {
+        CRYPTO_gcm128_setiv(gcm, iv->data, iv->len);
+        ok = (CRYPTO_gcm128_aad(gcm, aad->data, aad->len) == 0) &&
+            (CRYPTO_gcm128_encrypt(gcm, input.data(), result.data(), input.size()) == 0);
+        CRYPTO_gcm128_tag(gcm, result.data() + input.size(), TEST_GCM_TAG_LEN);
+    }
+    CRYPTO_gcm128_release(gcm);
+    EVP_CIPHER_CTX_free(ctx);
+    return ok;
+}
+
+HWTEST_F(CryptoSm4SimdCipherTest, CryptoSm4SimdCipherTest001, TestSize.Level0)
+{
+    Sm4SimdKey encKey = {};
+    Sm4SimdKey decKey = {};
+    Sm4SimdSetKey(g_kat, false, &encKey);
+    Sm4SimdSetKey(g_kat, true, &decKey);
+    uint8_t out[TEST_BLOCK_SIZE] = { 0 };
+    Sm4SimdCryptBlocks(g_kat, out, 1, &encKey);
+    EXPECT_EQ(memcmp(out, g_katCipherText, sizeof(out)), 0);
+    Sm4SimdEncryptBlock(g_kat, out, &encKey);
+    EXPECT_EQ(memcmp(out, g_katCipherText, sizeof(out)), 0);
+    Sm4SimdCryptBlocks(out, out, 1, &decKey);
+    EXPECT_EQ(memcmp(out, g_kat, sizeof(out)), 0);
+
+    /* every tail length of the 8 and 4 block groups, in place and against OpenSSL */
+    for (uint32_t blocks = 0; blocks <= TEST_MAX_BLOCK_NUM; blocks++) {
+        vector<uint8_t> input = MakeData(blocks * TEST_BLOCK_SIZE);
+        vector<uint8_t> expect;
+        ASSERT_TRUE(RunOpenssl(EVP_sm4_ecb(), 1, g_kat, nullptr, input, expect, 0));
+        vector<uint8_t> actual = input;
+        Sm4SimdCryptBlocks(actual.data(), actual.data(), blocks, &encKey);
+        EXPECT_EQ(actual, expect) << "blocks " << blocks;
+        Sm4SimdCryptBlocks(actual.data(), actual.data(), blocks, &decKey);
+        EXPECT_EQ(actual, input) << "blocks " << blocks;
+    }
+    EXPECT_EQ(Sm4SimdEcbCipher() != nullptr, Sm4SimdIsSupported());
+    EXPECT_EQ(Sm4SimdCtrCipher() != nullptr, Sm4SimdIsSupported());
+    EXPECT_EQ(Sm4SimdGcmCipher() != nullptr, Sm4SimdIsSupported());
+}
+
+HWTEST_F(CryptoSm4SimdCipherTest, CryptoSm4SimdCipherTest002, TestSize.Level0)
+{
+    Sm4SimdKey key = {};
+    Sm4SimdSetKey(g_kat, false, &key);
+    uint8_t iv[TEST_BLOCK_SIZE] = { 0 };
+    (void)memcpy_s(iv, sizeof(iv), g_kat, sizeof(iv));
+    for (uint32_t blocks = 0; blocks <= TEST_MAX_BLOCK_NUM; blocks++) {
+        vector<uint8_t> input = MakeData(blocks * TEST_BLOCK_SIZE);
+        vector<uint8_t> expect;
+        HcfBlob ivBlob = { .data = iv, .len = sizeof(iv) };
+        ASSERT_TRUE(RunOpenssl(EVP_sm4_ctr(), 1, g_kat, &ivBlob, input, expect, 0));
+        vector<uint8_t> actual(input.size());
+        Sm4SimdCtr32EncryptBlocks(input.data(), actual.data(), blocks, &key, iv);
+        EXPECT_EQ(actual, expect) << "blocks " << blocks;
+    }
+}
+
+HWTEST_F(CryptoSm4SimdCipherTest, CryptoSm4SimdCipherTest003, TestSize.Level0)
+{
+    HcfSymKey *key = ConvertSm4Key(g_kat);
+    ASSERT_NE(key, nullptr);
+    const uint32_t lens[] = { 0, 15, 16, 17, 128, 129, 10000 };
+    for (uint32_t len : lens) {
+        vector<uint8_t> input = MakeData(len);
+        vector<uint8_t> expect;
+        ASSERT_TRUE(RunOpenssl(EVP_sm4_ecb(), 1, g_kat, nullptr, input, expect, 1));
+        vector<uint8_t> cipherText;
+        ASSERT_EQ(RunFramework("SM4_128|ECB|PKCS7", ENCRYPT_MODE, key, nullptr, input, cipherText), HCF_SUCCESS);
+        EXPECT_EQ(cipherText, expect) << "len " << len;
+        vector<uint8_t> plainText;
+        ASSERT_EQ(RunFramework("SM4_128|ECB|PKCS7", DECRYPT_MODE, key, nullptr, cipherText, plainText), HCF_SUCCESS);
+        EXPECT_EQ(plainText, input) << "len " << len;
+    }
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoSm4SimdCipherTest, CryptoSm4SimdCipherTest004, TestSize.Level0)
+{
+    HcfSymKey *key = ConvertSm4Key(g_kat);
+    ASSERT_NE(key, nullptr);
+    /* the low counter word wraps after two blocks, the carry has to reach the upper words */
+    uint8_t iv[TEST_BLOCK_SIZE] = { 0 };
+    (void)memset_s(iv + TEST_BLOCK_SIZE / 2, TEST_BLOCK_SIZE / 2, 0xff, TEST_BLOCK_SIZE / 2);
+    iv[TEST_BLOCK_SIZE - 1] = 0xfe;
+    HcfIvParamsSpec spec = {};
+    spec.iv.data = iv;
+    spec.iv.len = sizeof(iv);
+    vector<uint8_t> input = MakeData(10007);
+    vector<uint8_t> expect;
+    ASSERT_TRUE(RunOpenssl(EVP_sm4_ctr(), 1, g_kat, &spec.iv, input, expect, 0));
+    vector<uint8_t> cipherText;
+    ASSERT_EQ(RunFramework("SM4_128|CTR|NoPadding", ENCRYPT_MODE, key, (HcfParamsSpec *)&spec, input, cipherText),
+        HCF_SUCCESS);
+    EXPECT_EQ(cipherText, expect);
+    vector<uint8_t> plainText;
+    ASSERT_EQ(RunFramework("SM4_128|CTR|NoPadding", DECRYPT_MODE, key, (HcfParamsSpec *)&spec, cipherText,
+        plainText), HCF_SUCCESS);
+    EXPECT_EQ(plainText, input);
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoSm4SimdCipherTest, CryptoSm4SimdCipherTest005, TestSize.Level0)
+{
+    HcfSymKey *key = ConvertSm4Key(g_kat);
+    ASSERT_NE(key, nullptr);
+    uint8_t aad[20] = { 0 };
+    uint8_t tag[TEST_GCM_TAG_LEN] = { 0 };
+    uint8_t iv[TEST_BLOCK_SIZE] = { 0 };
+    (void)memcpy_s(aad, sizeof(aad), g_kat, sizeof(g_kat));
+    (void)memcpy_s(iv, sizeof(iv), g_katCipherText, sizeof(g_katCipherText));
+    /* 12 bytes is the direct counter, 16 bytes goes through GHASH */
+    const uint32_t ivLens[] = { 12, 16 };
+    const uint32_t lens[] = { 1, 16, 100, 4099 };
+    for (uint32_t ivLen : ivLens) {
+        for (uint32_t len : lens) {
+            HcfGcmParamsSpec spec = {};
+            spec.aad.data = aad;
+            spec.aad.len = sizeof(aad);
+            spec.tag.data = tag;
+            spec.tag.len = sizeof(tag);
+            spec.iv.data = iv;
+            spec.iv.len = ivLen;
+            vector<uint8_t> input = MakeData(len);
+            vector<uint8_t> expect;
+            ASSERT_TRUE(RunOpensslGcm(g_kat, &spec.iv, &spec.aad, input, expect));
+            vector<uint8_t> cipherText;
+            ASSERT_EQ(RunFramework("SM4_128|GCM|NoPadding", ENCRYPT_MODE, key, (HcfParamsSpec *)&spec, input,
+                cipherText), HCF_SUCCESS);
+            EXPECT_EQ(cipherText, expect) << "iv " << ivLen << " len " << len;
+
+            (void)memcpy_s(tag, sizeof(tag), cipherText.data() + len, sizeof(tag));
+            cipherText.resize(len);
+            vector<uint8_t> plainText;
+            EXPECT_EQ(RunFramework("SM4_128|GCM|NoPadding", DECRYPT_MODE, key, (HcfParamsSpec *)&spec, cipherText,
+                plainText), HCF_SUCCESS);
+            EXPECT_EQ(plainText, input);
+            tag[0] ^= 1;
+            plainText.clear();
+            EXPECT_NE(RunFramework("SM4_128|GCM|NoPadding", DECRYPT_MODE, key, (HcfParamsSpec *)&spec, cipherText,
+                plainText), HCF_SUCCESS);
+        }
+    }
+    HcfObjDestroy(key);
+}
+
+HWTEST_F(CryptoSm4SimdCipherTest, CryptoSm4SimdCipherTest006, TestSize.Level0)
+{
+    HcfSymKey *key = ConvertSm4Key(g_kat);
+    ASSERT_NE(key, nullptr);
+    uint8_t tag[TEST_GCM_TAG_LEN] = { 0 };
+    HcfGcmParamsSpec spec = {};
+    spec.aad.data = const_cast<uint8_t *>(g_gcmAad);
+    spec.aad.len = sizeof(g_gcmAad);
+    spec.tag.data = tag;
+    spec.tag.len = sizeof(tag);
+    spec.iv.data = const_cast<uint8_t *>(g_gcmIv);
+    spec.iv.len = sizeof(g_gcmIv);
+    vector<uint8_t> input(g_gcmPlainText, g_gcmPlainText + sizeof(g_gcmPlainText));
+    vector<uint8_t> expect(g_gcmCipherTextAndTag, g_gcmCipherTextAndTag + sizeof(g_gcmCipherTextAndTag));
+    vector<uint8_t> cipherText;
+    ASSERT_EQ(RunFramework("SM4_128|GCM|NoPadding", ENCRYPT_MODE, key, (HcfParamsSpec *)&spec, input, cipherText),
+        HCF_SUCCESS);
+    EXPECT_EQ(cipherText, expect);
+
+    (void)memcpy_s(tag, sizeof(tag), g_gcmCipherTextAndTag + sizeof(g_gcmPlainText), sizeof(tag));
+    cipherText.resize(sizeof(g_gcmPlainText));
+    vector<uint8_t> plainText;
+    EXPECT_EQ(RunFramework("SM4_128|GCM|NoPadding", DECRYPT_MODE, key, (HcfParamsSpec *)&spec, cipherText, plainText),
+        HCF_SUCCESS);
+    EXPECT_EQ(plainText, input);
+    HcfObjDestroy(key);
+}
+}
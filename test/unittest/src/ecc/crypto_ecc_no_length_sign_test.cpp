@@ -851,7 +851,7 @@ HWTEST_F(CryptoEccNoLengthSignTest, CryptoEccNoLengthSignTest223, TestSize.Level
 
     res = sign->init(sign, nullptr, ecc256KeyPair_->priKey);
 
-    ASSERT_EQ(res, HCF_INVALID_PARAMS);
+    ASSERT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(sign);
 }
@@ -977,7 +977,7 @@ HWTEST_F(CryptoEccVerifyTest, CryptoEccVerifyTest223, TestSize.Level0)
 
     res = verify->init(verify, nullptr, ecc256KeyPair_->pubKey);
 
-    ASSERT_EQ(res, HCF_INVALID_PARAMS);
+    ASSERT_EQ(res, HCF_SUCCESS);
 
     HcfObjDestroy(verify);
 }
@@ -358,4 +358,58 @@ HWTEST_F(NativeAsymCipherTest, NativeAsymCipherTest008, TestSize.Level0)
 
     OH_Crypto_FreeDataBlob(&encoded);
     OH_CryptoSm2CiphertextSpec_Destroy(sm2CipherSpec);
-}
\ No newline at end of file
+}
+HWTEST_F(NativeAsymCipherTest, NativeAsymCipherTest009, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *keyGen = nullptr;
+    OH_Crypto_ErrCode ret = OH_CryptoAsymKeyGenerator_Create("RSA2048", &keyGen);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    ret = OH_CryptoAsymKeyGenerator_Generate(keyGen, &keyPair);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+
+    uint8_t plain0[] = {0x68, 0x65, 0x6c, 0x6c, 0x6f};
+    uint8_t plain1[] = {0x01, 0x02, 0x03, 0x04};
+    uint8_t plain2[] = {0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21};
+    Crypto_DataBlob plainBlobs[] = {
+        {.data = plain0, .len = sizeof(plain0)},
+        {.data = plain1, .len = sizeof(plain1)},
+        {.data = plain2, .len = sizeof(plain2)},
+    };
+    uint32_t count = sizeof(plainBlobs) / sizeof(plainBlobs[0]);
+    Crypto_DataBlob cipherBlobs[sizeof(plainBlobs) / sizeof(plainBlobs[0])] = {};
+    Crypto_DataBlob decBlobs[sizeof(plainBlobs) / sizeof(plainBlobs[0])] = {};
+    Crypto_DataBlob cipherArena = {.data = nullptr, .len = 0};
+    Crypto_DataBlob decArena = {.data = nullptr, .len = 0};
+
+    OH_CryptoAsymCipher *cipher = nullptr;
+    ret = OH_CryptoAsymCipher_Create("RSA2048|PKCS1_OAEP|SHA256|MGF1_SHA256", &cipher);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+    EXPECT_NE(OH_CryptoAsymCipher_FinalBatch(cipher, plainBlobs, count, 2, &cipherArena, cipherBlobs),
+        CRYPTO_SUCCESS);
+    ret = OH_CryptoAsymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, keyPair);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoAsymCipher_FinalBatch(cipher, plainBlobs, 0, 2, &cipherArena, cipherBlobs),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsymCipher_FinalBatch(cipher, plainBlobs, count, 65, &cipherArena, cipherBlobs),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsymCipher_FinalBatch(nullptr, plainBlobs, count, 2, &cipherArena, cipherBlobs),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    ret = OH_CryptoAsymCipher_FinalBatch(cipher, plainBlobs, count, 2, &cipherArena, cipherBlobs);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+
+    ret = OH_CryptoAsymCipher_Init(cipher, CRYPTO_DECRYPT_MODE, keyPair);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+    ret = OH_CryptoAsymCipher_FinalBatch(cipher, cipherBlobs, count, 2, &decArena, decBlobs);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_EQ(decBlobs[i].len, plainBlobs[i].len);
+        EXPECT_EQ(memcmp(decBlobs[i].data, plainBlobs[i].data, plainBlobs[i].len), 0);
+    }
+
+    OH_Crypto_FreeDataBlob(&decArena);
+    OH_Crypto_FreeDataBlob(&cipherArena);
+    OH_CryptoAsymCipher_Destroy(cipher);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(keyGen);
+}
@@ -1560,4 +1560,39 @@ HWTEST_F(NativeAsymKeyTest, NativeAsymKeyTest034, TestSize.Level0)
 
     EndRecordOpensslCallNum();
 }
+
+HWTEST_F(NativeAsymKeyTest, NativeAsymKeyTest035, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    OH_Crypto_ErrCode res = OH_CryptoAsymKeyGenerator_Create("Ed25519", &generator);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    constexpr uint32_t keyPairNum = 5;
+    OH_CryptoKeyPair *keyPairs[keyPairNum] = { nullptr };
+    EXPECT_EQ(OH_CryptoAsymKeyGenerator_GenerateKeyPairs(generator, 0, 2, keyPairs), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsymKeyGenerator_GenerateKeyPairs(generator, keyPairNum, 65, keyPairs),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsymKeyGenerator_GenerateKeyPairs(nullptr, keyPairNum, 2, keyPairs),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsymKeyGenerator_GenerateKeyPairs(generator, keyPairNum, 2, nullptr),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    res = OH_CryptoAsymKeyGenerator_GenerateKeyPairs(generator, keyPairNum, 2, keyPairs);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    for (uint32_t i = 0; i < keyPairNum; i++) {
+        ASSERT_NE(keyPairs[i], nullptr);
+        Crypto_DataBlob pubKeyBlob = {.data = nullptr, .len = 0};
+        res = OH_CryptoPubKey_Encode(OH_CryptoKeyPair_GetPubKey(keyPairs[i]), CRYPTO_DER, nullptr, &pubKeyBlob);
+        EXPECT_EQ(res, CRYPTO_SUCCESS);
+        OH_Crypto_FreeDataBlob(&pubKeyBlob);
+        OH_CryptoKeyPair_Destroy(keyPairs[i]);
+    }
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+
+    res = OH_CryptoAsymKeyGenerator_Create("RSA512", &generator);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoAsymKeyGenerator_GenerateKeyPairs(generator, keyPairNum, 0, keyPairs), CRYPTO_OPERTION_ERROR);
+    EXPECT_EQ(keyPairs[0], nullptr);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
 }
@@ -0,0 +1,363 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "crypto_async.h"
+#include "crypto_common.h"
+#include "crypto_digest.h"
+#include "crypto_kdf.h"
+#include "crypto_signature.h"
+#include "crypto_sym_cipher.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+constexpr uint32_t ASYNC_DEFAULT_WORKER_NUM = 4;
+constexpr uint32_t ASYNC_DEFAULT_QUEUE_DEPTH = 64;
+constexpr uint32_t ASYNC_SUBMITTER_NUM = 8;
+constexpr uint32_t ASYNC_TASKS_PER_SUBMITTER = 16;
+constexpr uint32_t SHA256_LEN = 32;
+constexpr uint32_t ASYNC_RETRY_TIMES = 1000;
+
+class NativeAsyncTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown()
+    {
+        EXPECT_EQ(RestorePoolConfig(), CRYPTO_SUCCESS);
+    };
+
+    // The worker that reported the last result is still leaving its callback, retry until the pool is idle.
+    static OH_Crypto_ErrCode RestorePoolConfig()
+    {
+        OH_Crypto_ErrCode ret = CRYPTO_INVALID_CALL;
+        for (uint32_t i = 0; (i < ASYNC_RETRY_TIMES) && (ret == CRYPTO_INVALID_CALL); i++) {
+            ret = OH_CryptoAsync_SetPoolConfig(ASYNC_DEFAULT_WORKER_NUM, ASYNC_DEFAULT_QUEUE_DEPTH);
+            if (ret == CRYPTO_INVALID_CALL) {
+                this_thread::sleep_for(chrono::milliseconds(1));
+            }
+        }
+        return ret;
+    }
+};
+
+struct AsyncWaiter {
+    mutex lock;
+    condition_variable cond;
+    uint32_t doneNum = 0;
+    uint32_t failedNum = 0;
+    // A callback of a task submitted with a gated waiter blocks its worker until the gate opens.
+    bool gated = false;
+    bool gateOpen = false;
+    uint32_t blockedNum = 0;
+};
+
+void AsyncDone(uint64_t taskId, OH_Crypto_ErrCode result, void *userData)
+{
+    (void)taskId;
+    AsyncWaiter *waiter = static_cast<AsyncWaiter *>(userData);
+    unique_lock<mutex> guard(waiter->lock);
+    if (waiter->gated) {
+        waiter->blockedNum++;
+        waiter->cond.notify_all();
+        waiter->cond.wait(guard, [waiter] { return waiter->gateOpen; });
+    }
+    waiter->doneNum++;
+    if (result != CRYPTO_SUCCESS) {
+        waiter->failedNum++;
+    }
+    waiter->cond.notify_all();
+}
+
+void WaitDone(AsyncWaiter &waiter, uint32_t doneNum)
+{
+    unique_lock<mutex> guard(waiter.lock);
+    waiter.cond.wait(guard, [&waiter, doneNum] { return waiter.doneNum >= doneNum; });
+}
+
+void WaitBlocked(AsyncWaiter &waiter, uint32_t blockedNum)
+{
+    unique_lock<mutex> guard(waiter.lock);
+    waiter.cond.wait(guard, [&waiter, blockedNum] { return waiter.blockedNum >= blockedNum; });
+}
+
+void OpenGate(AsyncWaiter &waiter)
+{
+    lock_guard<mutex> guard(waiter.lock);
+    waiter.gateOpen = true;
+    waiter.cond.notify_all();
+}
+
+HWTEST_F(NativeAsyncTest, NativeAsyncTest001, TestSize.Level0)
+{
+    EXPECT_EQ(OH_CryptoAsync_SetPoolConfig(0, ASYNC_DEFAULT_QUEUE_DEPTH), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_SetPoolConfig(65, ASYNC_DEFAULT_QUEUE_DEPTH), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_SetPoolConfig(1, 0), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_SetPoolConfig(1, 4097), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_Cancel(0), CRYPTO_INVALID_CALL);
+
+    AsyncWaiter waiter;
+    OH_CryptoDigest *md = nullptr;
+    ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &md), CRYPTO_SUCCESS);
+    Crypto_DataBlob out = { 0 };
+    bool result = false;
+    EXPECT_EQ(OH_CryptoAsync_DigestFinal(nullptr, nullptr, &out, AsyncDone, &waiter, nullptr),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_DigestFinal(md, nullptr, nullptr, AsyncDone, &waiter, nullptr),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_DigestFinal(md, nullptr, &out, nullptr, &waiter, nullptr),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_GenerateKeyPair(reinterpret_cast<OH_CryptoAsymKeyGenerator *>(md), nullptr, AsyncDone,
+        &waiter, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_AsymCipherFinal(reinterpret_cast<OH_CryptoAsymCipher *>(md), nullptr, &out, AsyncDone,
+        &waiter, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_VerifyFinal(reinterpret_cast<OH_CryptoVerify *>(md), nullptr, nullptr, &result,
+        AsyncDone, &waiter, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoAsync_KdfDerive(reinterpret_cast<OH_CryptoKdf *>(md), nullptr, SHA256_LEN, &out, AsyncDone,
+        &waiter, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(waiter.doneNum, 0);
+    OH_DigestCrypto_Destroy(md);
+}
+
+/* Many submitters share the pool, each digest context is handed to one task at a time. */
+HWTEST_F(NativeAsyncTest, NativeAsyncTest002, TestSize.Level0)
+{
+    uint8_t message[] = "native async digest message";
+    Crypto_DataBlob in = { .data = message, .len = sizeof(message) - 1 };
+    OH_CryptoDigest *md = nullptr;
+    ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &md), CRYPTO_SUCCESS);
+    Crypto_DataBlob expect = { 0 };
+    ASSERT_EQ(OH_CryptoDigest_Update(md, &in), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoDigest_Final(md, &expect), CRYPTO_SUCCESS);
+    OH_DigestCrypto_Destroy(md);
+
+    const uint32_t taskNum = ASYNC_SUBMITTER_NUM * ASYNC_TASKS_PER_SUBMITTER;
+    vector<OH_CryptoDigest *> mds(taskNum, nullptr);
+    vector<Crypto_DataBlob> outs(taskNum, Crypto_DataBlob { 0 });
+    for (uint32_t i = 0; i < taskNum; i++) {
+        ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &mds[i]), CRYPTO_SUCCESS);
+    }
+    AsyncWaiter waiter;
+    vector<thread> submitters;
+    for (uint32_t s = 0; s < ASYNC_SUBMITTER_NUM; s++) {
+        submitters.emplace_back([&, s] {
+            for (uint32_t i = s * ASYNC_TASKS_PER_SUBMITTER; i < (s + 1) * ASYNC_TASKS_PER_SUBMITTER; i++) {
+                // A full queue is back pressure, the submitter retries once workers have drained it.
+                OH_Crypto_ErrCode ret = CRYPTO_INVALID_CALL;
+                while (ret == CRYPTO_INVALID_CALL) {
+                    ret = OH_CryptoAsync_DigestFinal(mds[i], &in, &outs[i], AsyncDone, &waiter, nullptr);
+                    if (ret == CRYPTO_INVALID_CALL) {
+                        this_thread::yield();
+                    }
+                }
+                EXPECT_EQ(ret, CRYPTO_SUCCESS);
+            }
+        });
+    }
+    for (auto &submitter : submitters) {
+        submitter.join();
+    }
+    WaitDone(waiter, taskNum);
+    EXPECT_EQ(waiter.failedNum, 0);
+    for (uint32_t i = 0; i < taskNum; i++) {
+        ASSERT_EQ(outs[i].len, expect.len);
+        EXPECT_EQ(memcmp(outs[i].data, expect.data, expect.len), 0);
+        OH_Crypto_FreeDataBlob(&outs[i]);
+        OH_DigestCrypto_Destroy(mds[i]);
+    }
+    OH_Crypto_FreeDataBlob(&expect);
+}
+
+HWTEST_F(NativeAsyncTest, NativeAsyncTest003, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    ASSERT_EQ(OH_CryptoAsymKeyGenerator_Create("RSA2048", &generator), CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    AsyncWaiter waiter;
+    uint64_t taskId = 0;
+    ASSERT_EQ(OH_CryptoAsync_GenerateKeyPair(generator, &keyPair, AsyncDone, &waiter, &taskId), CRYPTO_SUCCESS);
+    EXPECT_NE(taskId, 0);
+    WaitDone(waiter, 1);
+    ASSERT_EQ(waiter.failedNum, 0);
+    ASSERT_NE(keyPair, nullptr);
+
+    OH_CryptoSign *sign = nullptr;
+    OH_CryptoVerify *verify = nullptr;
+    ASSERT_EQ(OH_CryptoSign_Create("RSA2048|PKCS1|SHA256", &sign), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSign_Init(sign, OH_CryptoKeyPair_GetPrivKey(keyPair)), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoVerify_Create("RSA2048|PKCS1|SHA256", &verify), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoVerify_Init(verify, OH_CryptoKeyPair_GetPubKey(keyPair)), CRYPTO_SUCCESS);
+    uint8_t message[] = "native async sign message";
+    Crypto_DataBlob in = { .data = message, .len = sizeof(message) - 1 };
+    Crypto_DataBlob signData = { 0 };
+    ASSERT_EQ(OH_CryptoAsync_SignFinal(sign, &in, &signData, AsyncDone, &waiter, nullptr), CRYPTO_SUCCESS);
+    WaitDone(waiter, 2);
+    ASSERT_EQ(waiter.failedNum, 0);
+    bool result = false;
+    ASSERT_EQ(OH_CryptoAsync_VerifyFinal(verify, &in, &signData, &result, AsyncDone, &waiter, nullptr),
+        CRYPTO_SUCCESS);
+    WaitDone(waiter, 3);
+    EXPECT_EQ(waiter.failedNum, 0);
+    EXPECT_TRUE(result);
+
+    OH_Crypto_FreeDataBlob(&signData);
+    OH_CryptoVerify_Destroy(verify);
+    OH_CryptoSign_Destroy(sign);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
+
+/* One worker blocked in a callback and a queue of two: the third waiting task is refused, queued ones cancel. */
+HWTEST_F(NativeAsyncTest, NativeAsyncTest004, TestSize.Level0)
+{
+    ASSERT_EQ(OH_CryptoAsync_SetPoolConfig(1, 2), CRYPTO_SUCCESS);
+    uint8_t message[] = "native async queue message";
+    Crypto_DataBlob in = { .data = message, .len = sizeof(message) - 1 };
+    const uint32_t mdNum = 4;
+    OH_CryptoDigest *mds[mdNum] = { nullptr };
+    Crypto_DataBlob outs[mdNum] = { { 0 } };
+    for (uint32_t i = 0; i < mdNum; i++) {
+        ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &mds[i]), CRYPTO_SUCCESS);
+    }
+    AsyncWaiter gatedWaiter;
+    gatedWaiter.gated = true;
+    AsyncWaiter waiter;
+    uint64_t blockedId = 0;
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(mds[0], &in, &outs[0], AsyncDone, &gatedWaiter, &blockedId),
+        CRYPTO_SUCCESS);
+    WaitBlocked(gatedWaiter, 1);
+    EXPECT_EQ(OH_CryptoAsync_Cancel(blockedId), CRYPTO_INVALID_CALL);
+    EXPECT_EQ(OH_CryptoAsync_SetPoolConfig(ASYNC_DEFAULT_WORKER_NUM, ASYNC_DEFAULT_QUEUE_DEPTH), CRYPTO_INVALID_CALL);
+
+    uint64_t queuedIds[2] = { 0 };
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(mds[1], &in, &outs[1], AsyncDone, &waiter, &queuedIds[0]), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(mds[2], &in, &outs[2], AsyncDone, &waiter, &queuedIds[1]), CRYPTO_SUCCESS);
+    EXPECT_NE(queuedIds[0], queuedIds[1]);
+    EXPECT_EQ(OH_CryptoAsync_DigestFinal(mds[3], &in, &outs[3], AsyncDone, &waiter, nullptr), CRYPTO_INVALID_CALL);
+
+    EXPECT_EQ(OH_CryptoAsync_Cancel(queuedIds[1]), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoAsync_Cancel(queuedIds[1]), CRYPTO_INVALID_CALL);
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(mds[3], &in, &outs[3], AsyncDone, &waiter, nullptr), CRYPTO_SUCCESS);
+
+    OpenGate(gatedWaiter);
+    WaitDone(gatedWaiter, 1);
+    WaitDone(waiter, 2);
+    EXPECT_EQ(OH_CryptoAsync_Cancel(queuedIds[0]), CRYPTO_INVALID_CALL);
+    EXPECT_EQ(gatedWaiter.failedNum + waiter.failedNum, 0);
+    EXPECT_EQ(outs[2].data, nullptr);
+    for (uint32_t i = 0; i < mdNum; i++) {
+        EXPECT_EQ(outs[i].len, (i == 2) ? 0 : SHA256_LEN);
+        OH_Crypto_FreeDataBlob(&outs[i]);
+        OH_DigestCrypto_Destroy(mds[i]);
+    }
+}
+
+/* A context with a task outstanding is refused, and becomes available again once the task is cancelled. */
+HWTEST_F(NativeAsyncTest, NativeAsyncTest005, TestSize.Level0)
+{
+    ASSERT_EQ(OH_CryptoAsync_SetPoolConfig(1, ASYNC_DEFAULT_QUEUE_DEPTH), CRYPTO_SUCCESS);
+    OH_CryptoDigest *blocker = nullptr;
+    OH_CryptoDigest *md = nullptr;
+    ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &blocker), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &md), CRYPTO_SUCCESS);
+    Crypto_DataBlob blockerOut = { 0 };
+    Crypto_DataBlob out = { 0 };
+    AsyncWaiter gatedWaiter;
+    gatedWaiter.gated = true;
+    AsyncWaiter waiter;
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(blocker, nullptr, &blockerOut, AsyncDone, &gatedWaiter, nullptr),
+        CRYPTO_SUCCESS);
+    WaitBlocked(gatedWaiter, 1);
+
+    uint64_t taskId = 0;
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(md, nullptr, &out, AsyncDone, &waiter, &taskId), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoAsync_DigestFinal(md, nullptr, &out, AsyncDone, &waiter, nullptr), CRYPTO_INVALID_CALL);
+    EXPECT_EQ(OH_CryptoAsync_Cancel(taskId), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoAsync_DigestFinal(md, nullptr, &out, AsyncDone, &waiter, nullptr), CRYPTO_SUCCESS);
+
+    OpenGate(gatedWaiter);
+    WaitDone(gatedWaiter, 1);
+    WaitDone(waiter, 1);
+    EXPECT_EQ(gatedWaiter.failedNum + waiter.failedNum, 0);
+    EXPECT_EQ(out.len, SHA256_LEN);
+    OH_Crypto_FreeDataBlob(&blockerOut);
+    OH_Crypto_FreeDataBlob(&out);
+    OH_DigestCrypto_Destroy(blocker);
+    OH_DigestCrypto_Destroy(md);
+}
+
+HWTEST_F(NativeAsyncTest, NativeAsyncTest006, TestSize.Level0)
+{
+    OH_CryptoKdfParams *params = nullptr;
+    ASSERT_EQ(OH_CryptoKdfParams_Create("PBKDF2", &params), CRYPTO_SUCCESS);
+    uint8_t password[] = "native async password";
+    uint8_t saltData[] = "native async salt";
+    Crypto_DataBlob key = { .data = password, .len = sizeof(password) - 1 };
+    Crypto_DataBlob salt = { .data = saltData, .len = sizeof(saltData) - 1 };
+    int iterations = 10000;
+    Crypto_DataBlob iterationsData = { .data = reinterpret_cast<uint8_t *>(&iterations), .len = sizeof(int) };
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_KEY_DATABLOB, &key), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_SALT_DATABLOB, &salt), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_ITER_COUNT_INT, &iterationsData), CRYPTO_SUCCESS);
+    OH_CryptoKdf *kdf = nullptr;
+    ASSERT_EQ(OH_CryptoKdf_Create("PBKDF2|SHA256", &kdf), CRYPTO_SUCCESS);
+    Crypto_DataBlob derived = { 0 };
+    AsyncWaiter waiter;
+    ASSERT_EQ(OH_CryptoAsync_KdfDerive(kdf, params, SHA256_LEN, &derived, AsyncDone, &waiter, nullptr),
+        CRYPTO_SUCCESS);
+    WaitDone(waiter, 1);
+    ASSERT_EQ(waiter.failedNum, 0);
+    Crypto_DataBlob expect = { 0 };
+    ASSERT_EQ(OH_CryptoKdf_Derive(kdf, params, SHA256_LEN, &expect), CRYPTO_SUCCESS);
+    ASSERT_EQ(derived.len, expect.len);
+    EXPECT_EQ(memcmp(derived.data, expect.data, expect.len), 0);
+
+    OH_CryptoSymKeyGenerator *keyGenerator = nullptr;
+    OH_CryptoSymKey *symKey = nullptr;
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Create("AES256", &keyGenerator), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Convert(keyGenerator, &derived, &symKey), CRYPTO_SUCCESS);
+    OH_CryptoSymCipher *cipher = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipher_Create("AES256|ECB|PKCS7", &cipher), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, nullptr), CRYPTO_SUCCESS);
+    Crypto_DataBlob cipherText = { 0 };
+    ASSERT_EQ(OH_CryptoAsync_SymCipherFinal(cipher, &key, &cipherText, AsyncDone, &waiter, nullptr), CRYPTO_SUCCESS);
+    WaitDone(waiter, 2);
+    EXPECT_EQ(waiter.failedNum, 0);
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_DECRYPT_MODE, symKey, nullptr), CRYPTO_SUCCESS);
+    Crypto_DataBlob plainText = { 0 };
+    ASSERT_EQ(OH_CryptoSymCipher_Final(cipher, &cipherText, &plainText), CRYPTO_SUCCESS);
+    ASSERT_EQ(plainText.len, key.len);
+    EXPECT_EQ(memcmp(plainText.data, key.data, key.len), 0);
+
+    OH_Crypto_FreeDataBlob(&plainText);
+    OH_Crypto_FreeDataBlob(&cipherText);
+    OH_CryptoSymCipher_Destroy(cipher);
+    OH_CryptoSymKey_Destroy(symKey);
+    OH_CryptoSymKeyGenerator_Destroy(keyGenerator);
+    OH_Crypto_FreeDataBlob(&expect);
+    OH_Crypto_FreeDataBlob(&derived);
+    OH_CryptoKdf_Destroy(kdf);
+    OH_CryptoKdfParams_Destroy(params);
+}
+}
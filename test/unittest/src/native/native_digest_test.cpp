@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 #include "crypto_common.h"
 #include "crypto_digest.h"
 #include "memory.h"
@@ -123,4 +124,33 @@ HWTEST_F(NativeDigestTest, NativeDigestTest005, TestSize.Level0)
     EXPECT_EQ(cmpRes, CRYPTO_SUCCESS);
     OH_DigestCrypto_Destroy(mdObj);
 }
+
+HWTEST_F(NativeDigestTest, NativeDigestTest006, TestSize.Level0)
+{
+    uint8_t testData[] = "My test data";
+    int fds[2] = { -1, -1 };
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], testData, sizeof(testData)), static_cast<ssize_t>(sizeof(testData)));
+    close(fds[1]);
+    OH_CryptoDigest *fdObj = nullptr;
+    OH_CryptoDigest *bufObj = nullptr;
+    ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &fdObj), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoDigest_Create("SHA256", &bufObj), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoDigest_UpdateFd(fdObj, fds[0], 0, 0), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoDigest_UpdateFd(fdObj, -1, 0, 0), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoDigest_UpdateFd(nullptr, fds[0], 0, 0), CRYPTO_PARAMETER_CHECK_FAILED);
+    close(fds[0]);
+    Crypto_DataBlob inBlob = { .data = testData, .len = sizeof(testData) };
+    EXPECT_EQ(OH_CryptoDigest_Update(bufObj, &inBlob), CRYPTO_SUCCESS);
+    Crypto_DataBlob fdOut = { .data = nullptr, .len = 0 };
+    Crypto_DataBlob bufOut = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(OH_CryptoDigest_Final(fdObj, &fdOut), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoDigest_Final(bufObj, &bufOut), CRYPTO_SUCCESS);
+    ASSERT_EQ(fdOut.len, bufOut.len);
+    EXPECT_EQ(memcmp(fdOut.data, bufOut.data, fdOut.len), 0);
+    OH_Crypto_FreeDataBlob(&fdOut);
+    OH_Crypto_FreeDataBlob(&bufOut);
+    OH_DigestCrypto_Destroy(fdObj);
+    OH_DigestCrypto_Destroy(bufObj);
+}
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include "crypto_common.h"
+#include "crypto_asym_key.h"
+#include "crypto_envelope.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class NativeEnvelopeTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+static void NativeEnvelopeRoundTrip(const char *keyGenName, const char *envelopeName)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    ASSERT_EQ(OH_CryptoAsymKeyGenerator_Create(keyGenName, &generator), CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    ASSERT_EQ(OH_CryptoAsymKeyGenerator_Generate(generator, &keyPair), CRYPTO_SUCCESS);
+    OH_CryptoPubKey *pubkey = OH_CryptoKeyPair_GetPubKey(keyPair);
+    OH_CryptoPrivKey *privkey = OH_CryptoKeyPair_GetPrivKey(keyPair);
+    ASSERT_NE(pubkey, nullptr);
+    ASSERT_NE(privkey, nullptr);
+
+    OH_CryptoEnvelope *ctx = nullptr;
+    ASSERT_EQ(OH_CryptoEnvelope_Create(envelopeName, &ctx), CRYPTO_SUCCESS);
+    uint8_t plainText[] = "native envelope plain text";
+    uint8_t aadText[] = "native envelope aad";
+    Crypto_DataBlob in = { .data = plainText, .len = sizeof(plainText) - 1 };
+    Crypto_DataBlob aad = { .data = aadText, .len = sizeof(aadText) - 1 };
+    Crypto_DataBlob sealed = { 0 };
+    Crypto_DataBlob out = { 0 };
+    EXPECT_EQ(OH_CryptoEnvelope_Seal(ctx, pubkey, &aad, &in, &sealed), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoEnvelope_Open(ctx, privkey, nullptr, &sealed, &out), CRYPTO_OPERTION_ERROR);
+    EXPECT_EQ(OH_CryptoEnvelope_Open(ctx, privkey, &aad, &sealed, &out), CRYPTO_SUCCESS);
+    ASSERT_EQ(out.len, in.len);
+    EXPECT_EQ(memcmp(out.data, in.data, in.len), 0);
+
+    OH_Crypto_FreeDataBlob(&out);
+    OH_Crypto_FreeDataBlob(&sealed);
+    OH_CryptoEnvelope_Destroy(ctx);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
+
+HWTEST_F(NativeEnvelopeTest, NativeEnvelopeTest001, TestSize.Level0)
+{
+    NativeEnvelopeRoundTrip("X25519", "X25519-AES256-GCM");
+    NativeEnvelopeRoundTrip("ECC256", "ECC-AES256-GCM");
+    NativeEnvelopeRoundTrip("RSA2048", "RSA-KEM-AES256-GCM");
+}
+
+HWTEST_F(NativeEnvelopeTest, NativeEnvelopeTest002, TestSize.Level0)
+{
+    OH_CryptoEnvelope *ctx = nullptr;
+    EXPECT_EQ(OH_CryptoEnvelope_Create("X25519-AES256-GCM", nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoEnvelope_Create(nullptr, &ctx), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoEnvelope_Create("ECC-AES128-GCM", &ctx), CRYPTO_NOT_SUPPORTED);
+    ASSERT_EQ(OH_CryptoEnvelope_Create("X25519-AES256-GCM", &ctx), CRYPTO_SUCCESS);
+
+    uint8_t plainText[] = "native envelope plain text";
+    Crypto_DataBlob in = { .data = plainText, .len = sizeof(plainText) - 1 };
+    Crypto_DataBlob out = { 0 };
+    EXPECT_EQ(OH_CryptoEnvelope_Seal(nullptr, nullptr, nullptr, &in, &out), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoEnvelope_Seal(ctx, nullptr, nullptr, &in, &out), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoEnvelope_Open(ctx, nullptr, nullptr, &in, &out), CRYPTO_PARAMETER_CHECK_FAILED);
+    OH_CryptoEnvelope_Destroy(ctx);
+    OH_CryptoEnvelope_Destroy(nullptr);
+}
+}
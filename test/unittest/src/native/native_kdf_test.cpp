@@ -264,4 +264,48 @@ HWTEST_F(NativeKdfest, NativeKdfest007, TestSize.Level0)
     OH_CryptoKdfParams_Destroy(params);
     OH_Crypto_FreeDataBlob(&output);
 }
-}
\ No newline at end of file
+
+HWTEST_F(NativeKdfest, NativeKdfest008, TestSize.Level0)
+{
+    OH_CryptoKdfParams *params = nullptr;
+    OH_Crypto_ErrCode ret = OH_CryptoKdfParams_Create("PBKDF2", &params);
+    EXPECT_EQ(ret, CRYPTO_SUCCESS);
+    Crypto_DataBlob password = {.data = reinterpret_cast<uint8_t *>(const_cast<char *>(g_password)),
+        .len = strlen(g_password)};
+    Crypto_DataBlob salt = {.data = reinterpret_cast<uint8_t *>(const_cast<char *>(g_saltData)),
+        .len = strlen(g_saltData)};
+    int iterations = 1000;
+    Crypto_DataBlob iterationsData = {.data = reinterpret_cast<uint8_t *>(&iterations), .len = sizeof(int)};
+    EXPECT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_KEY_DATABLOB, &password), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_SALT_DATABLOB, &salt), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_ITER_COUNT_INT, &iterationsData), CRYPTO_SUCCESS);
+
+    OH_CryptoKdf *kdfCtx = nullptr;
+    ret = OH_CryptoKdf_Create("PBKDF2|SHA256", &kdfCtx);
+    EXPECT_EQ(ret, CRYPTO_SUCCESS);
+    Crypto_DataBlob serialOut = {0};
+    EXPECT_EQ(OH_CryptoKdf_Derive(kdfCtx, params, 96, &serialOut), CRYPTO_SUCCESS);
+
+    uint32_t threadNum = 3;
+    Crypto_DataBlob threadNumData = {.data = reinterpret_cast<uint8_t *>(&threadNum), .len = sizeof(uint32_t)};
+    EXPECT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_THREAD_NUM_UINT32, &threadNumData), CRYPTO_SUCCESS);
+    Crypto_DataBlob parallelOut = {0};
+    EXPECT_EQ(OH_CryptoKdf_Derive(kdfCtx, params, 96, &parallelOut), CRYPTO_SUCCESS);
+    ASSERT_EQ(parallelOut.len, serialOut.len);
+    EXPECT_EQ(memcmp(parallelOut.data, serialOut.data, serialOut.len), 0);
+
+    threadNumData.len = sizeof(uint64_t);
+    EXPECT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_THREAD_NUM_UINT32, &threadNumData),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    threadNum = 65;
+    threadNumData.len = sizeof(uint32_t);
+    EXPECT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_THREAD_NUM_UINT32, &threadNumData), CRYPTO_SUCCESS);
+    Crypto_DataBlob out = {0};
+    EXPECT_EQ(OH_CryptoKdf_Derive(kdfCtx, params, 96, &out), CRYPTO_PARAMETER_CHECK_FAILED);
+
+    OH_Crypto_FreeDataBlob(&serialOut);
+    OH_Crypto_FreeDataBlob(&parallelOut);
+    OH_CryptoKdf_Destroy(kdfCtx);
+    OH_CryptoKdfParams_Destroy(params);
+}
+}
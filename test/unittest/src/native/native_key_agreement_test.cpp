@@ -17,6 +17,7 @@
 #include "crypto_common.h"
 #include "crypto_asym_key.h"
 #include "crypto_key_agreement.h"
+#include "crypto_kdf.h"
 #include "memory.h"
 #include "memory_mock.h"
 
@@ -87,4 +88,77 @@ HWTEST_F(NativeKeyAgreementTest, NativeKeyAgreementTest002, TestSize.Level0)
     OH_Crypto_ErrCode ret = OH_CryptoKeyAgreement_Create("X25519", nullptr);
     EXPECT_NE(ret, CRYPTO_SUCCESS);
 }
-}
\ No newline at end of file
+
+static void CheckNativeDeriveKey(const char *kdfAlgoName, OH_CryptoKdfParams *params, OH_CryptoPrivKey *privkey,
+    OH_CryptoPubKey *pubkey, OH_CryptoKeyAgreement *ctx)
+{
+    constexpr uint32_t keyLen = 32;
+    Crypto_DataBlob key = {0};
+    OH_Crypto_ErrCode ret = OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, kdfAlgoName, params, keyLen, &key);
+    ASSERT_EQ(ret, CRYPTO_SUCCESS);
+    ASSERT_EQ(key.len, keyLen);
+
+    Crypto_DataBlob secret = {0};
+    ASSERT_EQ(OH_CryptoKeyAgreement_GenerateSecret(ctx, privkey, pubkey, &secret), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(params, CRYPTO_KDF_KEY_DATABLOB, &secret), CRYPTO_SUCCESS);
+    OH_CryptoKdf *kdf = nullptr;
+    ASSERT_EQ(OH_CryptoKdf_Create(kdfAlgoName, &kdf), CRYPTO_SUCCESS);
+    Crypto_DataBlob expected = {0};
+    ASSERT_EQ(OH_CryptoKdf_Derive(kdf, params, keyLen, &expected), CRYPTO_SUCCESS);
+    ASSERT_EQ(expected.len, key.len);
+    EXPECT_EQ(memcmp(expected.data, key.data, key.len), 0);
+
+    OH_Crypto_FreeDataBlob(&expected);
+    OH_CryptoKdf_Destroy(kdf);
+    OH_Crypto_FreeDataBlob(&secret);
+    OH_Crypto_FreeDataBlob(&key);
+}
+
+HWTEST_F(NativeKeyAgreementTest, NativeKeyAgreementTest003, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    ASSERT_EQ(OH_CryptoAsymKeyGenerator_Create("ECC256", &generator), CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    ASSERT_EQ(OH_CryptoAsymKeyGenerator_Generate(generator, &keyPair), CRYPTO_SUCCESS);
+    OH_CryptoPrivKey *privkey = OH_CryptoKeyPair_GetPrivKey(keyPair);
+    OH_CryptoPubKey *pubkey = OH_CryptoKeyPair_GetPubKey(keyPair);
+    OH_CryptoKeyAgreement *ctx = nullptr;
+    ASSERT_EQ(OH_CryptoKeyAgreement_Create("ECC256", &ctx), CRYPTO_SUCCESS);
+
+    uint8_t salt[] = "native salt";
+    uint8_t info[] = "native info";
+    Crypto_DataBlob saltBlob = { .data = salt, .len = sizeof(salt) };
+    Crypto_DataBlob infoBlob = { .data = info, .len = sizeof(info) };
+    OH_CryptoKdfParams *hkdfParams = nullptr;
+    ASSERT_EQ(OH_CryptoKdfParams_Create("HKDF", &hkdfParams), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(hkdfParams, CRYPTO_KDF_SALT_DATABLOB, &saltBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(hkdfParams, CRYPTO_KDF_INFO_DATABLOB, &infoBlob), CRYPTO_SUCCESS);
+    CheckNativeDeriveKey("HKDF|SHA256", hkdfParams, privkey, pubkey, ctx);
+
+    OH_CryptoKdfParams *x963Params = nullptr;
+    ASSERT_EQ(OH_CryptoKdfParams_Create("X963KDF", &x963Params), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoKdfParams_SetParam(x963Params, CRYPTO_KDF_INFO_DATABLOB, &infoBlob), CRYPTO_SUCCESS);
+    CheckNativeDeriveKey("X963KDF|SHA384", x963Params, privkey, pubkey, ctx);
+
+    Crypto_DataBlob key = {0};
+    EXPECT_EQ(OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, "HKDF", nullptr, 32, &key),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, "X963KDF|SHA256", hkdfParams, 32, &key),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, "HKDF|SHA256", nullptr, 0, &key),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, nullptr, nullptr, 32, &key),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, "HKDF|SHA256", nullptr, 32, nullptr),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoKeyAgreement_DeriveKey(ctx, privkey, pubkey, "HKDF|SHA256", nullptr, 32, &key),
+        CRYPTO_SUCCESS);
+    OH_Crypto_FreeDataBlob(&key);
+
+    OH_CryptoKdfParams_Destroy(x963Params);
+    OH_CryptoKdfParams_Destroy(hkdfParams);
+    OH_CryptoKeyAgreement_Destroy(ctx);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
+}
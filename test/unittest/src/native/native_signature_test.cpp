@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include "crypto_signature.h"
+#include "crypto_digest.h"
 #include "crypto_common.h"
 #include "crypto_asym_key.h"
 #include "blob.h"
@@ -816,4 +817,155 @@ HWTEST_F(NativeSignatureTest, MlDsaVerifyMallocFailTest001, TestSize.Level0)
     OH_CryptoKeyPair_Destroy(keyPair);
     OH_CryptoAsymKeyGenerator_Destroy(generator);
 }
+
+HWTEST_F(NativeSignatureTest, NativeSignatureResetTest001, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    OH_Crypto_ErrCode res = OH_CryptoAsymKeyGenerator_Create("ECC256", &generator);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    res = OH_CryptoAsymKeyGenerator_Generate(generator, &keyPair);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    uint8_t prefix[] = {0x01, 0x02, 0x03, 0x04};
+    uint8_t message[] = {0x68, 0x65, 0x6c, 0x6c, 0x6f};
+    Crypto_DataBlob prefixBlob = {.data = prefix, .len = sizeof(prefix)};
+    Crypto_DataBlob msgBlob = {.data = message, .len = sizeof(message)};
+
+    OH_CryptoSign *sign = nullptr;
+    res = OH_CryptoSign_Create("ECC256|SHA256", &sign);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoSign_Reset(sign), CRYPTO_PARAMETER_CHECK_FAILED);
+    res = OH_CryptoSign_Init(sign, OH_CryptoKeyPair_GetPrivKey(keyPair));
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    res = OH_CryptoSign_Update(sign, &prefixBlob);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    res = OH_CryptoSign_Reset(sign);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    Crypto_DataBlob signBlob = {.data = nullptr, .len = 0};
+    res = OH_CryptoSign_Final(sign, &msgBlob, &signBlob);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    OH_CryptoVerify *verify = nullptr;
+    res = OH_CryptoVerify_Create("ECC256|SHA256", &verify);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    res = OH_CryptoVerify_Init(verify, OH_CryptoKeyPair_GetPubKey(keyPair));
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    res = OH_CryptoVerify_Update(verify, &prefixBlob);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    res = OH_CryptoVerify_Reset(verify);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    EXPECT_TRUE(OH_CryptoVerify_Final(verify, &msgBlob, &signBlob));
+    EXPECT_EQ(OH_CryptoVerify_Reset(nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSign_Reset(nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+
+    OH_Crypto_FreeDataBlob(&signBlob);
+    OH_CryptoVerify_Destroy(verify);
+    OH_CryptoSign_Destroy(sign);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
+
+HWTEST_F(NativeSignatureTest, NativeSignatureSignBatchTest001, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    OH_Crypto_ErrCode res = OH_CryptoAsymKeyGenerator_Create("ECC256", &generator);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    res = OH_CryptoAsymKeyGenerator_Generate(generator, &keyPair);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    uint8_t message0[] = {0x68, 0x65, 0x6c, 0x6c, 0x6f};
+    uint8_t message1[] = {0x01, 0x02, 0x03, 0x04};
+    uint8_t message2[] = {0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21};
+    Crypto_DataBlob msgBlobs[] = {
+        {.data = message0, .len = sizeof(message0)},
+        {.data = message1, .len = sizeof(message1)},
+        {.data = message2, .len = sizeof(message2)},
+    };
+    uint32_t count = sizeof(msgBlobs) / sizeof(msgBlobs[0]);
+    Crypto_DataBlob signBlobs[sizeof(msgBlobs) / sizeof(msgBlobs[0])] = {};
+    Crypto_DataBlob arena = {.data = nullptr, .len = 0};
+
+    OH_CryptoSign *sign = nullptr;
+    res = OH_CryptoSign_Create("ECC256|SHA256", &sign);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    EXPECT_NE(OH_CryptoSign_SignBatch(sign, msgBlobs, count, 2, &arena, signBlobs), CRYPTO_SUCCESS);
+    res = OH_CryptoSign_Init(sign, OH_CryptoKeyPair_GetPrivKey(keyPair));
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoSign_SignBatch(sign, msgBlobs, 0, 2, &arena, signBlobs), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSign_SignBatch(sign, msgBlobs, count, 65, &arena, signBlobs), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSign_SignBatch(nullptr, msgBlobs, count, 2, &arena, signBlobs),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    res = OH_CryptoSign_SignBatch(sign, msgBlobs, count, 2, &arena, signBlobs);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    OH_CryptoVerify *verify = nullptr;
+    res = OH_CryptoVerify_Create("ECC256|SHA256", &verify);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    for (uint32_t i = 0; i < count; i++) {
+        res = OH_CryptoVerify_Init(verify, OH_CryptoKeyPair_GetPubKey(keyPair));
+        ASSERT_EQ(res, CRYPTO_SUCCESS);
+        EXPECT_TRUE(OH_CryptoVerify_Final(verify, &msgBlobs[i], &signBlobs[i]));
+    }
+
+    OH_Crypto_FreeDataBlob(&arena);
+    OH_CryptoVerify_Destroy(verify);
+    OH_CryptoSign_Destroy(sign);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
+
+HWTEST_F(NativeSignatureTest, NativeSignaturePrehashTest001, TestSize.Level0)
+{
+    OH_CryptoAsymKeyGenerator *generator = nullptr;
+    OH_Crypto_ErrCode res = OH_CryptoAsymKeyGenerator_Create("ECC256", &generator);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    OH_CryptoKeyPair *keyPair = nullptr;
+    res = OH_CryptoAsymKeyGenerator_Generate(generator, &keyPair);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+
+    uint8_t message[] = {0x68, 0x65, 0x6c, 0x6c, 0x6f};
+    Crypto_DataBlob msgBlob = {.data = message, .len = sizeof(message)};
+    OH_CryptoDigest *md = nullptr;
+    res = OH_CryptoDigest_Create("SHA256", &md);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoDigest_Update(md, &msgBlob), CRYPTO_SUCCESS);
+    Crypto_DataBlob digestBlob = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoDigest_Final(md, &digestBlob), CRYPTO_SUCCESS);
+
+    bool isPrehash = true;
+    Crypto_DataBlob flagBlob = {.data = reinterpret_cast<uint8_t *>(&isPrehash), .len = sizeof(isPrehash)};
+    Crypto_DataBlob badFlagBlob = {.data = reinterpret_cast<uint8_t *>(&isPrehash), .len = 0};
+    OH_CryptoSign *sign = nullptr;
+    res = OH_CryptoSign_Create("ECC256|SHA256", &sign);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoSign_SetParam(sign, CRYPTO_SIGN_PREHASH_BOOL, &badFlagBlob), CRYPTO_PARAMETER_CHECK_FAILED);
+    ASSERT_EQ(OH_CryptoSign_SetParam(sign, CRYPTO_SIGN_PREHASH_BOOL, &flagBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSign_Init(sign, OH_CryptoKeyPair_GetPrivKey(keyPair)), CRYPTO_SUCCESS);
+    EXPECT_NE(OH_CryptoSign_Update(sign, &msgBlob), CRYPTO_SUCCESS);
+    Crypto_DataBlob signBlob = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoSign_Final(sign, &digestBlob, &signBlob), CRYPTO_SUCCESS);
+
+    OH_CryptoVerify *verify = nullptr;
+    res = OH_CryptoVerify_Create("ECC256|SHA256", &verify);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoVerify_Init(verify, OH_CryptoKeyPair_GetPubKey(keyPair)), CRYPTO_SUCCESS);
+    EXPECT_TRUE(OH_CryptoVerify_Final(verify, &msgBlob, &signBlob));
+    OH_CryptoVerify_Destroy(verify);
+    verify = nullptr;
+    res = OH_CryptoVerify_Create("ECC256|SHA256", &verify);
+    ASSERT_EQ(res, CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoVerify_SetParam(verify, CRYPTO_SIGN_PREHASH_BOOL, &flagBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoVerify_Init(verify, OH_CryptoKeyPair_GetPubKey(keyPair)), CRYPTO_SUCCESS);
+    EXPECT_TRUE(OH_CryptoVerify_Final(verify, &digestBlob, &signBlob));
+
+    OH_Crypto_FreeDataBlob(&signBlob);
+    OH_Crypto_FreeDataBlob(&digestBlob);
+    OH_DigestCrypto_Destroy(md);
+    OH_CryptoVerify_Destroy(verify);
+    OH_CryptoSign_Destroy(sign);
+    OH_CryptoKeyPair_Destroy(keyPair);
+    OH_CryptoAsymKeyGenerator_Destroy(generator);
+}
 }
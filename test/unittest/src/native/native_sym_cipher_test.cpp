@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <fstream>
 #include <iostream>
+#include <vector>
 #include "crypto_common.h"
 #include "crypto_sym_cipher.h"
 #include "sym_key.h"
@@ -298,4 +299,155 @@ HWTEST_F(NativeSymCipherTest, CryptoSymCipherFullFlowTest001, TestSize.Level0)
     OH_CryptoSymKey_Destroy(symKey);
     OH_CryptoSymKeyGenerator_Destroy(keyGen);
 }
+
+static void CollectStreamOutput(void *userData, OH_Crypto_ErrCode result, const Crypto_DataBlob *out, bool isFinal)
+{
+    vector<uint8_t> *output = static_cast<vector<uint8_t> *>(userData);
+    if (result == CRYPTO_SUCCESS && out->data != nullptr) {
+        output->insert(output->end(), out->data, out->data + out->len);
+    }
+}
+
+HWTEST_F(NativeSymCipherTest, CryptoSymCipherStreamTest001, TestSize.Level0)
+{
+    OH_CryptoSymKeyGenerator *keyGen = nullptr;
+    OH_CryptoSymKey *symKey = nullptr;
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Create("AES128", &keyGen), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Generate(keyGen, &symKey), CRYPTO_SUCCESS);
+    OH_CryptoSymCipher *cipher = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipher_Create("AES128|ECB|PKCS7", &cipher), CRYPTO_SUCCESS);
+
+    uint8_t plainText[] = "the stream is processed in write order";
+    Crypto_DataBlob inBlob = {.data = plainText, .len = sizeof(plainText)};
+    Crypto_DataBlob expect = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, nullptr), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_Final(cipher, &inBlob, &expect), CRYPTO_SUCCESS);
+
+    vector<uint8_t> output;
+    OH_CryptoSymCipherStream *stream = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, nullptr), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipherStream_Create(cipher, 1, CollectStreamOutput, &output, &stream), CRYPTO_SUCCESS);
+    for (size_t offset = 0; offset < sizeof(plainText); offset += 5) {
+        Crypto_DataBlob chunk = {.data = plainText + offset, .len = min(sizeof(plainText) - offset, (size_t)5)};
+        EXPECT_EQ(OH_CryptoSymCipherStream_Write(stream, &chunk), CRYPTO_SUCCESS);
+    }
+    EXPECT_EQ(OH_CryptoSymCipherStream_Finish(stream, nullptr), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoSymCipherStream_Wait(stream), CRYPTO_SUCCESS);
+    EXPECT_EQ(output, vector<uint8_t>(expect.data, expect.data + expect.len));
+    EXPECT_EQ(OH_CryptoSymCipherStream_Write(stream, &inBlob), CRYPTO_INVALID_CALL);
+
+    OH_Crypto_FreeDataBlob(&expect);
+    OH_CryptoSymCipherStream_Destroy(stream);
+    OH_CryptoSymCipher_Destroy(cipher);
+    OH_CryptoSymKey_Destroy(symKey);
+    OH_CryptoSymKeyGenerator_Destroy(keyGen);
+}
+
+HWTEST_F(NativeSymCipherTest, CryptoSymCipherStreamNullTest001, TestSize.Level0)
+{
+    OH_CryptoSymCipherStream *stream = nullptr;
+    bool accepted = false;
+    EXPECT_EQ(OH_CryptoSymCipherStream_Create(nullptr, 0, CollectStreamOutput, nullptr, &stream),
+        CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipherStream_Write(nullptr, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipherStream_TryWrite(nullptr, nullptr, &accepted), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipherStream_Finish(nullptr, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipherStream_Wait(nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    OH_CryptoSymCipherStream_Destroy(nullptr);
+}
+
+HWTEST_F(NativeSymCipherTest, CryptoSymCipherDataUnitsTest001, TestSize.Level0)
+{
+    OH_CryptoSymKeyGenerator *keyGen = nullptr;
+    OH_CryptoSymKey *symKey = nullptr;
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Create("AES256", &keyGen), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Generate(keyGen, &symKey), CRYPTO_SUCCESS);
+    OH_CryptoSymCipher *cipher = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipher_Create("AES128|XTS|NoPadding", &cipher), CRYPTO_SUCCESS);
+    OH_CryptoSymCipherParams *params = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipherParams_Create(&params), CRYPTO_SUCCESS);
+    uint8_t tweak[16] = {0x05};
+    Crypto_DataBlob tweakBlob = {.data = tweak, .len = sizeof(tweak)};
+    ASSERT_EQ(OH_CryptoSymCipherParams_SetParam(params, CRYPTO_IV_DATABLOB, &tweakBlob), CRYPTO_SUCCESS);
+
+    // the second unit of a batch starting at unit 4 uses the same tweak as a single unit 5
+    uint8_t plainText[64] = {0};
+    Crypto_DataBlob unitBlob = {.data = plainText + 32, .len = 32};
+    Crypto_DataBlob expect = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, params), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_Final(cipher, &unitBlob, &expect), CRYPTO_SUCCESS);
+
+    Crypto_DataBlob inBlob = {.data = plainText, .len = sizeof(plainText)};
+    Crypto_DataBlob outBlob = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, params), CRYPTO_SUCCESS);
+    EXPECT_EQ(OH_CryptoSymCipher_SetParallelWorkerNum(cipher, 2), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_ProcessDataUnits(cipher, 4, 32, &inBlob, &outBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(outBlob.len, sizeof(plainText));
+    EXPECT_EQ(memcmp(outBlob.data + 32, expect.data, expect.len), 0);
+    EXPECT_EQ(OH_CryptoSymCipher_ProcessDataUnits(cipher, 4, 24, &inBlob, &outBlob), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipher_ProcessDataUnits(nullptr, 4, 32, &inBlob, &outBlob), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipher_SetParallelWorkerNum(cipher, 65), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipher_SetParallelWorkerNum(nullptr, 2), CRYPTO_PARAMETER_CHECK_FAILED);
+
+    OH_Crypto_FreeDataBlob(&outBlob);
+    OH_Crypto_FreeDataBlob(&expect);
+    OH_CryptoSymCipherParams_Destroy(params);
+    OH_CryptoSymCipher_Destroy(cipher);
+    OH_CryptoSymKey_Destroy(symKey);
+    OH_CryptoSymKeyGenerator_Destroy(keyGen);
+}
+
+HWTEST_F(NativeSymCipherTest, CryptoSymCipherAeadNonceTest001, TestSize.Level0)
+{
+    OH_CryptoSymKeyGenerator *keyGen = nullptr;
+    OH_CryptoSymKey *symKey = nullptr;
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Create("AES128", &keyGen), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymKeyGenerator_Generate(keyGen, &symKey), CRYPTO_SUCCESS);
+    OH_CryptoSymCipher *cipher = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipher_Create("AES128|GCM|NoPadding", &cipher), CRYPTO_SUCCESS);
+    uint8_t fixedField[4] = {0x0a, 0x0b, 0x0c, 0x0d};
+    Crypto_DataBlob fixedBlob = {.data = fixedField, .len = sizeof(fixedField)};
+    ASSERT_EQ(OH_CryptoSymCipher_SetAeadNonceMode(cipher, CRYPTO_AEAD_NONCE_COUNTER), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_SetAeadNonceFixedField(cipher, &fixedBlob), CRYPTO_SUCCESS);
+
+    // the record is nonce || ciphertext || tag, and the nonce is the fixed field followed by the counter
+    uint8_t plainText[32] = {0};
+    Crypto_DataBlob inBlob = {.data = plainText, .len = sizeof(plainText)};
+    Crypto_DataBlob outBlob = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, nullptr), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_Final(cipher, &inBlob, &outBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(outBlob.len, 12 + sizeof(plainText) + 16);
+    uint8_t expectNonce[12] = {0x0a, 0x0b, 0x0c, 0x0d};
+    EXPECT_EQ(memcmp(outBlob.data, expectNonce, sizeof(expectNonce)), 0);
+
+    OH_CryptoSymCipher *decipher = nullptr;
+    OH_CryptoSymCipherParams *params = nullptr;
+    ASSERT_EQ(OH_CryptoSymCipher_Create("AES128|GCM|NoPadding", &decipher), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipherParams_Create(&params), CRYPTO_SUCCESS);
+    Crypto_DataBlob nonceBlob = {.data = outBlob.data, .len = 12};
+    Crypto_DataBlob tagBlob = {.data = outBlob.data + outBlob.len - 16, .len = 16};
+    ASSERT_EQ(OH_CryptoSymCipherParams_SetParam(params, CRYPTO_IV_DATABLOB, &nonceBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipherParams_SetParam(params, CRYPTO_TAG_DATABLOB, &tagBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(OH_CryptoSymCipher_Init(decipher, CRYPTO_DECRYPT_MODE, symKey, params), CRYPTO_SUCCESS);
+    Crypto_DataBlob cipherBlob = {.data = outBlob.data + 12, .len = sizeof(plainText)};
+    Crypto_DataBlob decBlob = {.data = nullptr, .len = 0};
+    ASSERT_EQ(OH_CryptoSymCipher_Final(decipher, &cipherBlob, &decBlob), CRYPTO_SUCCESS);
+    ASSERT_EQ(decBlob.len, sizeof(plainText));
+    EXPECT_EQ(memcmp(decBlob.data, plainText, sizeof(plainText)), 0);
+
+    // an iv of the caller is rejected in a generated mode
+    ASSERT_NE(OH_CryptoSymCipher_Init(cipher, CRYPTO_ENCRYPT_MODE, symKey, params), CRYPTO_SUCCESS);
+    Crypto_DataBlob shortBlob = {.data = fixedField, .len = 3};
+    EXPECT_EQ(OH_CryptoSymCipher_SetAeadNonceFixedField(cipher, &shortBlob), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipher_SetAeadNonceFixedField(cipher, nullptr), CRYPTO_PARAMETER_CHECK_FAILED);
+    EXPECT_EQ(OH_CryptoSymCipher_SetAeadNonceMode(nullptr, CRYPTO_AEAD_NONCE_RANDOM), CRYPTO_PARAMETER_CHECK_FAILED);
+
+    OH_Crypto_FreeDataBlob(&decBlob);
+    OH_Crypto_FreeDataBlob(&outBlob);
+    OH_CryptoSymCipherParams_Destroy(params);
+    OH_CryptoSymCipher_Destroy(decipher);
+    OH_CryptoSymCipher_Destroy(cipher);
+    OH_CryptoSymKey_Destroy(symKey);
+    OH_CryptoSymKeyGenerator_Destroy(keyGen);
+}
 }
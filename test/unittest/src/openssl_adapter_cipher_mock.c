@@ -315,6 +315,14 @@ EVP_CIPHER_CTX *OpensslEvpCipherCtxNew(void)
     return EVP_CIPHER_CTX_new();
 }
 
+int OpensslEvpCipherCtxCopy(EVP_CIPHER_CTX *out, const EVP_CIPHER_CTX *in)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return EVP_CIPHER_CTX_copy(out, in);
+}
+
 int OpensslEvpCipherInit(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
                          const unsigned char *key, const unsigned char *iv, int enc)
 {
@@ -456,6 +464,126 @@ const EVP_CIPHER *OpensslEvpSm4Ofb(void)
     return EVP_sm4_ofb();
 }
 
+EVP_CIPHER *OpensslEvpCipherMethNew(int cipherType, int blockSize, int keyLen)
+{
+    return EVP_CIPHER_meth_new(cipherType, blockSize, keyLen);
+}
+
+void OpensslEvpCipherMethFree(EVP_CIPHER *cipher)
+{
+    EVP_CIPHER_meth_free(cipher);
+}
+
+int OpensslEvpCipherMethSetIvLength(EVP_CIPHER *cipher, int ivLen)
+{
+    return EVP_CIPHER_meth_set_iv_length(cipher, ivLen);
+}
+
+int OpensslEvpCipherMethSetFlags(EVP_CIPHER *cipher, unsigned long flags)
+{
+    return EVP_CIPHER_meth_set_flags(cipher, flags);
+}
+
+int OpensslEvpCipherMethSetImplCtxSize(EVP_CIPHER *cipher, int size)
+{
+    return EVP_CIPHER_meth_set_impl_ctx_size(cipher, size);
+}
+
+int OpensslEvpCipherMethSetInit(EVP_CIPHER *cipher,
+    int (*init)(EVP_CIPHER_CTX *ctx, const unsigned char *key, const unsigned char *iv, int enc))
+{
+    return EVP_CIPHER_meth_set_init(cipher, init);
+}
+
+int OpensslEvpCipherMethSetDoCipher(EVP_CIPHER *cipher,
+    int (*doCipher)(EVP_CIPHER_CTX *ctx, unsigned char *out, const unsigned char *in, size_t inl))
+{
+    return EVP_CIPHER_meth_set_do_cipher(cipher, doCipher);
+}
+
+int OpensslEvpCipherMethSetCtrl(EVP_CIPHER *cipher, int (*ctrl)(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr))
+{
+    return EVP_CIPHER_meth_set_ctrl(cipher, ctrl);
+}
+
+int OpensslEvpCipherMethSetCleanup(EVP_CIPHER *cipher, int (*cleanup)(EVP_CIPHER_CTX *ctx))
+{
+    return EVP_CIPHER_meth_set_cleanup(cipher, cleanup);
+}
+
+void *OpensslEvpCipherCtxGetCipherData(const EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_get_cipher_data(ctx);
+}
+
+unsigned char *OpensslEvpCipherCtxIvNoconst(EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_iv_noconst(ctx);
+}
+
+unsigned char *OpensslEvpCipherCtxBufNoconst(EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_buf_noconst(ctx);
+}
+
+int OpensslEvpCipherCtxGetNum(const EVP_CIPHER_CTX *ctx)
+{
+    return EVP_CIPHER_CTX_get_num(ctx);
+}
+
+int OpensslEvpCipherCtxSetNum(EVP_CIPHER_CTX *ctx, int num)
+{
+    return EVP_CIPHER_CTX_set_num(ctx, num);
+}
+
+void OpensslCryptoCtr128EncryptCtr32(const unsigned char *in, unsigned char *out, size_t len, const void *key,
+    unsigned char ivec[16], unsigned char ecountBuf[16], unsigned int *num, ctr128_f func)
+{
+    CRYPTO_ctr128_encrypt_ctr32(in, out, len, key, ivec, ecountBuf, num, func);
+}
+
+GCM128_CONTEXT *OpensslCryptoGcm128New(void *key, block128_f block)
+{
+    return CRYPTO_gcm128_new(key, block);
+}
+
+void OpensslCryptoGcm128Release(GCM128_CONTEXT *ctx)
+{
+    CRYPTO_gcm128_release(ctx);
+}
+
+void OpensslCryptoGcm128Setiv(GCM128_CONTEXT *ctx, const unsigned char *iv, size_t len)
+{
+    CRYPTO_gcm128_setiv(ctx, iv, len);
+}
+
+int OpensslCryptoGcm128Aad(GCM128_CONTEXT *ctx, const unsigned char *aad, size_t len)
+{
+    return CRYPTO_gcm128_aad(ctx, aad, len);
+}
+
+int OpensslCryptoGcm128EncryptCtr32(GCM128_CONTEXT *ctx, const unsigned char *in, unsigned char *out, size_t len,
+    ctr128_f stream)
+{
+    return CRYPTO_gcm128_encrypt_ctr32(ctx, in, out, len, stream);
+}
+
+int OpensslCryptoGcm128DecryptCtr32(GCM128_CONTEXT *ctx, const unsigned char *in, unsigned char *out, size_t len,
+    ctr128_f stream)
+{
+    return CRYPTO_gcm128_decrypt_ctr32(ctx, in, out, len, stream);
+}
+
+int OpensslCryptoGcm128Finish(GCM128_CONTEXT *ctx, const unsigned char *tag, size_t len)
+{
+    return CRYPTO_gcm128_finish(ctx, tag, len);
+}
+
+void OpensslCryptoGcm128Tag(GCM128_CONTEXT *ctx, unsigned char *tag, size_t len)
+{
+    CRYPTO_gcm128_tag(ctx, tag, len);
+}
+
 EVP_CIPHER *OpensslEvpCipherFetch(OSSL_LIB_CTX *ctx, const char *algorithm, const char *properties)
 {
     return EVP_CIPHER_fetch(ctx, algorithm, properties);
@@ -204,6 +204,52 @@ int OpensslBnCmp(const BIGNUM *a, const BIGNUM *b)
     return BN_cmp(a, b);
 }
 
+int OpensslBnSubWord(BIGNUM *a, BN_ULONG w)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return BN_sub_word(a, w);
+}
+
+int OpensslBnKronecker(const BIGNUM *a, const BIGNUM *b, BN_CTX *ctx)
+{
+    if (IsNeedMock()) {
+        return -2;
+    }
+    return BN_kronecker(a, b, ctx);
+}
+
+BN_MONT_CTX *OpensslBnMontCtxNew(void)
+{
+    if (IsNeedMock()) {
+        return NULL;
+    }
+    return BN_MONT_CTX_new();
+}
+
+int OpensslBnMontCtxSet(BN_MONT_CTX *mont, const BIGNUM *mod, BN_CTX *ctx)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return BN_MONT_CTX_set(mont, mod, ctx);
+}
+
+void OpensslBnMontCtxFree(BN_MONT_CTX *mont)
+{
+    BN_MONT_CTX_free(mont);
+}
+
+int OpensslBnModExpMontConsttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p, const BIGNUM *m, BN_CTX *ctx,
+    BN_MONT_CTX *inMont)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return BN_mod_exp_mont_consttime(rr, a, p, m, ctx, inMont);
+}
+
 EC_KEY *OpensslEcKeyNewByCurveName(int nid)
 {
     if (IsNeedMock()) {
@@ -307,6 +353,11 @@ EC_KEY *OpensslEcKeyDup(const EC_KEY *ecKey)
     return EC_KEY_dup(ecKey);
 }
 
+int OpensslEcKeyUpRef(EC_KEY *ecKey)
+{
+    return EC_KEY_up_ref(ecKey);
+}
+
 int OpensslEcKeySetGroup(EC_KEY *key, const EC_GROUP *group)
 {
     if (IsNeedMock()) {
@@ -510,6 +561,27 @@ void OpensslEvpMdCtxFree(EVP_MD_CTX *ctx)
     }
 }
 
+int OpensslEvpMdCtxReset(EVP_MD_CTX *ctx)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return EVP_MD_CTX_reset(ctx);
+}
+
+int OpensslEvpMdCtxCopyEx(EVP_MD_CTX *out, const EVP_MD_CTX *in)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return EVP_MD_CTX_copy_ex(out, in);
+}
+
+void OpensslEvpMdCtxSetFlags(EVP_MD_CTX *ctx, int flags)
+{
+    EVP_MD_CTX_set_flags(ctx, flags);
+}
+
 int OpensslEvpDigestSignInit(EVP_MD_CTX *ctx, EVP_PKEY_CTX **pctx, const EVP_MD *type, ENGINE *e, EVP_PKEY *pkey)
 {
     if (IsNeedMock()) {
@@ -705,6 +777,11 @@ void OpensslEvpPkeyFree(EVP_PKEY *pkey)
     }
 }
 
+int OpensslEvpPkeyUpRef(EVP_PKEY *pkey)
+{
+    return EVP_PKEY_up_ref(pkey);
+}
+
 EVP_PKEY_CTX *OpensslEvpPkeyCtxNew(EVP_PKEY *pkey, ENGINE *e)
 {
     if (IsNeedMock()) {
@@ -752,6 +829,14 @@ int OpensslEvpPkeyDeriveSetPeer(EVP_PKEY_CTX *ctx, EVP_PKEY *peer)
     return EVP_PKEY_derive_set_peer(ctx, peer);
 }
 
+int OpensslEvpPkeyDeriveSetPeerEx(EVP_PKEY_CTX *ctx, EVP_PKEY *peer, int validatePeer)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return EVP_PKEY_derive_set_peer_ex(ctx, peer, validatePeer);
+}
+
 int OpensslEvpPkeyDerive(EVP_PKEY_CTX *ctx, unsigned char *key, size_t *keylen)
 {
     if (key != NULL && g_isNeedSpecialMock) {
@@ -805,6 +890,22 @@ void OpensslEvpPkeyCtxFree(EVP_PKEY_CTX *ctx)
     }
 }
 
+EVP_PKEY_CTX *OpensslEvpPkeyCtxDup(const EVP_PKEY_CTX *ctx)
+{
+    if (IsNeedMock()) {
+        return NULL;
+    }
+    return EVP_PKEY_CTX_dup(ctx);
+}
+
+EVP_PKEY *OpensslEvpPkeyCtxGet0Pkey(EVP_PKEY_CTX *ctx)
+{
+    if (IsNeedMock()) {
+        return NULL;
+    }
+    return EVP_PKEY_CTX_get0_pkey(ctx);
+}
+
 EVP_PKEY_CTX *OpensslEvpPkeyCtxNewId(int id, ENGINE *e)
 {
     if (IsNeedMock()) {
@@ -818,6 +919,11 @@ int OpensslEvpPkeyBaseId(EVP_PKEY *pkey)
     return EVP_PKEY_base_id(pkey);
 }
 
+int OpensslEvpPkeyGetSize(const EVP_PKEY *pkey)
+{
+    return EVP_PKEY_get_size(pkey);
+}
+
 EVP_PKEY_CTX *OpensslEvpPkeyCtxNewFromName(OSSL_LIB_CTX *libctx, const char *name, const char *propquery)
 {
     if (IsNeedMock()) {
@@ -1105,6 +1211,11 @@ void OpensslRsaFree(RSA *rsa)
     }
 }
 
+int OpensslRsaUpRef(RSA *rsa)
+{
+    return RSA_up_ref(rsa);
+}
+
 int OpensslRsaGenerateMultiPrimeKey(RSA *rsa, int bits, int primes,
     BIGNUM *e, BN_GENCB *cb)
 {
@@ -1231,6 +1342,27 @@ EVP_PKEY *OpensslD2iAutoPrivateKey(EVP_PKEY **a, const unsigned char **pp, long
     return d2i_AutoPrivateKey(a, pp, length);
 }
 
+PKCS8_PRIV_KEY_INFO *OpensslD2iPkcs8PrivKeyInfo(PKCS8_PRIV_KEY_INFO **a, const unsigned char **pp, long length)
+{
+    return d2i_PKCS8_PRIV_KEY_INFO(a, pp, length);
+}
+
+void OpensslPkcs8PrivKeyInfoFree(PKCS8_PRIV_KEY_INFO *p8inf)
+{
+    PKCS8_PRIV_KEY_INFO_free(p8inf);
+}
+
+int OpensslPkcs8PkeyGet0(const ASN1_OBJECT **ppkalg, const unsigned char **pk, int *ppklen,
+    const X509_ALGOR **pa, const PKCS8_PRIV_KEY_INFO *p8)
+{
+    return PKCS8_pkey_get0(ppkalg, pk, ppklen, pa, p8);
+}
+
+int OpensslObjObj2Nid(const ASN1_OBJECT *o)
+{
+    return OBJ_obj2nid(o);
+}
+
 struct rsa_st *OpensslEvpPkeyGet1Rsa(EVP_PKEY *pkey)
 {
     return EVP_PKEY_get1_RSA(pkey);
@@ -1393,6 +1525,11 @@ int OpensslEvpDigestFinalEx(EVP_MD_CTX *ctx, unsigned char *md, unsigned int *si
     return EVP_DigestFinal_ex(ctx, md, size);
 }
 
+int OpensslEvpDigest(const void *data, size_t count, unsigned char *md, unsigned int *size, const EVP_MD *type)
+{
+    return EVP_Digest(data, count, md, size, type, NULL);
+}
+
 int OpensslEvpMdCtxSize(const EVP_MD_CTX *ctx)
 {
     if (IsNeedMock()) {
@@ -1448,6 +1585,22 @@ HMAC_CTX *OpensslHmacCtxNew(void)
     return HMAC_CTX_new();
 }
 
+int OpensslHmacUpdate(HMAC_CTX *ctx, const unsigned char *data, size_t len)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return HMAC_Update(ctx, data, len);
+}
+
+int OpensslHmacCtxCopy(HMAC_CTX *dctx, HMAC_CTX *sctx)
+{
+    if (IsNeedMock()) {
+        return -1;
+    }
+    return HMAC_CTX_copy(dctx, sctx);
+}
+
 int OpensslPkcs5Pbkdf2Hmac(const char *pass, int passlen, const unsigned char *salt,
     int saltlen, int iter, const EVP_MD *digest, int keylen, unsigned char *out)
 {
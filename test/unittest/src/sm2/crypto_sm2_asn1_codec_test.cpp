@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "asy_key_generator.h"
+#include "blob.h"
+#include "cipher.h"
+#include "memory.h"
+#include "securec.h"
+#include "signature.h"
+#include "sm2_asn1_codec.h"
+
+using namespace std;
+using namespace testing::ext;
+
+namespace {
+class CryptoSm2Asn1CodecTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void CryptoSm2Asn1CodecTest::SetUp() {}
+void CryptoSm2Asn1CodecTest::TearDown() {}
+void CryptoSm2Asn1CodecTest::SetUpTestCase() {}
+void CryptoSm2Asn1CodecTest::TearDownTestCase() {}
+
+constexpr size_t SM2_RAW_C1_LEN = 65;
+constexpr uint32_t BATCH_COUNT = 4;
+
+static uint8_t g_correctAsn1[] = {
+    48, 119, 2, 33, 0, 183, 70, 70, 149, 188, 64, 6, 110, 236, 85, 149, 216, 224, 102, 95, 92, 41, 105, 232, 5,
+    248, 122, 21, 174, 43, 226, 221, 104, 82, 88, 153, 45, 2, 32, 96, 229, 78, 209, 233, 110, 5, 149, 91, 110,
+    109, 181, 17, 75, 109, 146, 128, 170, 113, 205, 158, 193, 156, 90, 110, 40, 18, 119, 247, 198, 93, 107, 4,
+    32, 87, 167, 167, 247, 88, 146, 203, 234, 83, 126, 117, 129, 52, 142, 82, 54, 152, 226, 201, 111, 143, 115,
+    169, 125, 128, 42, 157, 31, 114, 198, 109, 244, 4, 14, 100, 227, 78, 195, 249, 179, 43, 70, 242, 69, 169, 10,
+    65, 123
+};
+static HcfBlob g_correctInput = { .data = g_correctAsn1, .len = sizeof(g_correctAsn1) };
+
+static HcfResult ConvertToVector(HcfResult (*func)(const HcfBlob *, const char *, HcfBlob *), const HcfBlob *input,
+    const char *mode, vector<uint8_t> &out)
+{
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    HcfResult res = func(input, mode, &output);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    out.resize(output.len);
+    output.data = out.data();
+    res = func(input, mode, &output);
+    if ((res == HCF_SUCCESS) && (output.len != out.size())) {
+        return HCF_ERR_CRYPTO_OPERATION;
+    }
+    return res;
+}
+
+static HcfResult ConvertSignature(HcfResult (*func)(const HcfBlob *, HcfBlob *), const HcfBlob *input,
+    vector<uint8_t> &out)
+{
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    HcfResult res = func(input, &output);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    out.resize(output.len);
+    output.data = out.data();
+    return func(input, &output);
+}
+
+static HcfKeyPair *GenerateSm2KeyPair()
+{
+    HcfAsyKeyGenerator *generator = nullptr;
+    HcfKeyPair *keyPair = nullptr;
+    if (HcfAsyKeyGeneratorCreate("SM2_256", &generator) == HCF_SUCCESS) {
+        (void)generator->generateKeyPair(generator, nullptr, &keyPair);
+    }
+    HcfObjDestroy(generator);
+    return keyPair;
+}
+
+static HcfResult Sm2Crypt(HcfKeyPair *keyPair, enum HcfCryptoMode mode, HcfBlob *input, HcfBlob *output)
+{
+    HcfCipher *cipher = nullptr;
+    HcfResult res = HcfCipherCreate("SM2_256|SM3", &cipher);
+    if (res != HCF_SUCCESS) {
+        return res;
+    }
+    HcfKey *key = (mode == ENCRYPT_MODE) ? (HcfKey *)keyPair->pubKey : (HcfKey *)keyPair->priKey;
+    res = cipher->init(cipher, mode, key, nullptr);
+    if (res == HCF_SUCCESS) {
+        res = cipher->doFinal(cipher, input, output);
+    }
+    HcfObjDestroy(cipher);
+    return res;
+}
+
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest001, TestSize.Level0)
+{
+    Sm2CipherTextView view;
+    ASSERT_EQ(HcfSm2CipherTextParseAsn1(&g_correctInput, &view), HCF_SUCCESS);
+    // The spans point into the input, the sign byte of x is dropped.
+    EXPECT_EQ(view.xCoordinate.data, g_correctAsn1 + 5);
+    EXPECT_EQ(view.xCoordinate.len, HCF_SM2_COORDINATE_LEN);
+    EXPECT_EQ(view.yCoordinate.data, g_correctAsn1 + 39);
+    EXPECT_EQ(view.yCoordinate.len, HCF_SM2_COORDINATE_LEN);
+    EXPECT_EQ(view.hashData.data, g_correctAsn1 + 73);
+    EXPECT_EQ(view.hashData.len, HCF_SM2_C3_DATA_LEN);
+    EXPECT_EQ(view.cipherTextData.data, g_correctAsn1 + 107);
+    EXPECT_EQ(view.cipherTextData.len, sizeof(g_correctAsn1) - 107);
+}
+
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest002, TestSize.Level0)
+{
+    vector<uint8_t> raw;
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextAsn1ToRaw, &g_correctInput, nullptr, raw), HCF_SUCCESS);
+    ASSERT_EQ(raw.size(), SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + 14);
+    EXPECT_EQ(raw[0], 0x04);
+    EXPECT_EQ(memcmp(raw.data() + 1, g_correctAsn1 + 5, HCF_SM2_COORDINATE_LEN), 0);
+    EXPECT_EQ(memcmp(raw.data() + SM2_RAW_C1_LEN, g_correctAsn1 + 73, HCF_SM2_C3_DATA_LEN), 0);
+
+    vector<uint8_t> der;
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextRawToAsn1, &rawBlob, "C1C3C2", der), HCF_SUCCESS);
+    EXPECT_EQ(der, vector<uint8_t>(g_correctAsn1, g_correctAsn1 + sizeof(g_correctAsn1)));
+
+    vector<uint8_t> rawC2C3;
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextAsn1ToRaw, &g_correctInput, "C1C2C3", rawC2C3), HCF_SUCCESS);
+    EXPECT_EQ(memcmp(rawC2C3.data() + SM2_RAW_C1_LEN, g_correctAsn1 + 107, 14), 0);
+    EXPECT_EQ(memcmp(rawC2C3.data() + SM2_RAW_C1_LEN + 14, g_correctAsn1 + 73, HCF_SM2_C3_DATA_LEN), 0);
+    HcfBlob rawC2C3Blob = { .data = rawC2C3.data(), .len = rawC2C3.size() };
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextRawToAsn1, &rawC2C3Blob, "C1C2C3", der), HCF_SUCCESS);
+    EXPECT_EQ(der, vector<uint8_t>(g_correctAsn1, g_correctAsn1 + sizeof(g_correctAsn1)));
+}
+
+// Ciphertexts of OpenSSL still decrypt after a trip through the raw form.
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest003, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateSm2KeyPair();
+    ASSERT_NE(keyPair, nullptr);
+    vector<uint8_t> plain(200, 0x5a);
+    HcfBlob input = { .data = plain.data(), .len = plain.size() };
+    HcfBlob cipherText = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(Sm2Crypt(keyPair, ENCRYPT_MODE, &input, &cipherText), HCF_SUCCESS);
+
+    vector<uint8_t> raw;
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextAsn1ToRaw, &cipherText, "", raw), HCF_SUCCESS);
+    EXPECT_EQ(raw.size(), SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + plain.size());
+    vector<uint8_t> der;
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextRawToAsn1, &rawBlob, "", der), HCF_SUCCESS);
+    EXPECT_EQ(der, vector<uint8_t>(cipherText.data, cipherText.data + cipherText.len));
+
+    HcfBlob derBlob = { .data = der.data(), .len = der.size() };
+    HcfBlob decrypted = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(Sm2Crypt(keyPair, DECRYPT_MODE, &derBlob, &decrypted), HCF_SUCCESS);
+    EXPECT_EQ(vector<uint8_t>(decrypted.data, decrypted.data + decrypted.len), plain);
+
+    HcfBlobDataFree(&decrypted);
+    HcfBlobDataFree(&cipherText);
+    HcfObjDestroy(keyPair);
+}
+
+// Leading zero coordinates shrink the INTEGER, a set top bit adds the sign byte.
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest004, TestSize.Level0)
+{
+    vector<uint8_t> raw(SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + 1, 0x11);
+    raw[0] = 0x04;
+    (void)memset_s(raw.data() + 1, HCF_SM2_COORDINATE_LEN, 0, HCF_SM2_COORDINATE_LEN - 1);
+    raw[1 + HCF_SM2_COORDINATE_LEN] = 0x80;
+    vector<uint8_t> der;
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextRawToAsn1, &rawBlob, nullptr, der), HCF_SUCCESS);
+    const uint8_t expectHead[] = { 0x30, 0x4b, 0x02, 0x01, 0x11, 0x02, 0x21, 0x00, 0x80 };
+    ASSERT_GT(der.size(), sizeof(expectHead));
+    EXPECT_EQ(memcmp(der.data(), expectHead, sizeof(expectHead)), 0);
+
+    vector<uint8_t> back;
+    HcfBlob derBlob = { .data = der.data(), .len = der.size() };
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextAsn1ToRaw, &derBlob, nullptr, back), HCF_SUCCESS);
+    EXPECT_EQ(back, raw);
+
+    // All zero coordinates encode as a single zero byte.
+    (void)memset_s(raw.data() + 1, 2 * HCF_SM2_COORDINATE_LEN, 0, 2 * HCF_SM2_COORDINATE_LEN);
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextRawToAsn1, &rawBlob, nullptr, der), HCF_SUCCESS);
+    const uint8_t zeroHead[] = { 0x30, 0x2b, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00 };
+    EXPECT_EQ(memcmp(der.data(), zeroHead, sizeof(zeroHead)), 0);
+    derBlob = { .data = der.data(), .len = der.size() };
+    ASSERT_EQ(ConvertToVector(HcfSm2CipherTextAsn1ToRaw, &derBlob, nullptr, back), HCF_SUCCESS);
+    EXPECT_EQ(back, raw);
+}
+
+// Long ciphertexts use the long length form.
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest005, TestSize.Level0)
+{
+    const size_t c2Lens[] = { 1, 127, 128, 255, 256, 70000 };
+    for (size_t c2Len : c2Lens) {
+        vector<uint8_t> raw(SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + c2Len, 0xa5);
+        raw[0] = 0x04;
+        vector<uint8_t> der;
+        HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+        ASSERT_EQ(ConvertToVector(HcfSm2CipherTextRawToAsn1, &rawBlob, nullptr, der), HCF_SUCCESS);
+        vector<uint8_t> back;
+        HcfBlob derBlob = { .data = der.data(), .len = der.size() };
+        ASSERT_EQ(ConvertToVector(HcfSm2CipherTextAsn1ToRaw, &derBlob, nullptr, back), HCF_SUCCESS);
+        EXPECT_EQ(back, raw);
+    }
+}
+
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest006, TestSize.Level0)
+{
+    vector<uint8_t> der(g_correctAsn1, g_correctAsn1 + sizeof(g_correctAsn1));
+    vector<uint8_t> out(256);
+    HcfBlob output = { .data = out.data(), .len = out.size() };
+    Sm2CipherTextView view;
+
+    HcfBlob truncated = { .data = der.data(), .len = der.size() - 1 };
+    EXPECT_NE(HcfSm2CipherTextAsn1ToRaw(&truncated, nullptr, &output), HCF_SUCCESS);
+    der.push_back(0);
+    HcfBlob trailing = { .data = der.data(), .len = der.size() };
+    EXPECT_NE(HcfSm2CipherTextAsn1ToRaw(&trailing, nullptr, &output), HCF_SUCCESS);
+    der.pop_back();
+
+    HcfBlob input = { .data = der.data(), .len = der.size() };
+    der[5] = 0x00;  // The sign byte is no longer needed, so the INTEGER is not minimal.
+    EXPECT_NE(HcfSm2CipherTextParseAsn1(&input, &view), HCF_SUCCESS);
+    der[5] = g_correctAsn1[5];
+    der[39] = 0x80;  // Negative y.
+    EXPECT_NE(HcfSm2CipherTextParseAsn1(&input, &view), HCF_SUCCESS);
+    der[39] = g_correctAsn1[39];
+    der[1] = 0x81;  // Long form for a short length.
+    EXPECT_NE(HcfSm2CipherTextParseAsn1(&input, &view), HCF_SUCCESS);
+    der[1] = g_correctAsn1[1];
+    EXPECT_EQ(HcfSm2CipherTextParseAsn1(&input, &view), HCF_SUCCESS);
+
+    EXPECT_EQ(HcfSm2CipherTextAsn1ToRaw(&input, "C1C2C2", &output), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfSm2CipherTextAsn1ToRaw(&input, nullptr, nullptr), HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfSm2CipherTextAsn1ToRaw(nullptr, nullptr, &output), HCF_INVALID_PARAMS);
+    HcfBlob small = { .data = out.data(), .len = SM2_RAW_C1_LEN };
+    EXPECT_EQ(HcfSm2CipherTextAsn1ToRaw(&input, nullptr, &small), HCF_INVALID_PARAMS);
+
+    vector<uint8_t> raw(SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN, 0x04);
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    EXPECT_EQ(HcfSm2CipherTextRawToAsn1(&rawBlob, nullptr, &output), HCF_INVALID_PARAMS);
+    raw.push_back(0x01);
+    raw[0] = 0x02;
+    rawBlob = { .data = raw.data(), .len = raw.size() };
+    EXPECT_EQ(HcfSm2CipherTextRawToAsn1(&rawBlob, nullptr, &output), HCF_INVALID_PARAMS);
+}
+
+// Signatures of OpenSSL survive the raw form byte for byte and still verify.
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest007, TestSize.Level0)
+{
+    HcfKeyPair *keyPair = GenerateSm2KeyPair();
+    ASSERT_NE(keyPair, nullptr);
+    HcfSign *sign = nullptr;
+    ASSERT_EQ(HcfSignCreate("SM2_256|SM3", &sign), HCF_SUCCESS);
+    ASSERT_EQ(sign->init(sign, nullptr, keyPair->priKey), HCF_SUCCESS);
+    uint8_t message[] = { 0x68, 0x65, 0x6c, 0x6c, 0x6f };
+    HcfBlob msgBlob = { .data = message, .len = sizeof(message) };
+    HcfBlob signature = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(sign->sign(sign, &msgBlob, &signature), HCF_SUCCESS);
+
+    vector<uint8_t> raw;
+    ASSERT_EQ(ConvertSignature(HcfSm2SignatureDerToRaw, &signature, raw), HCF_SUCCESS);
+    EXPECT_EQ(raw.size(), HCF_SM2_RAW_SIGNATURE_LEN);
+    vector<uint8_t> der;
+    HcfBlob rawBlob = { .data = raw.data(), .len = raw.size() };
+    ASSERT_EQ(ConvertSignature(HcfSm2SignatureRawToDer, &rawBlob, der), HCF_SUCCESS);
+    EXPECT_EQ(der, vector<uint8_t>(signature.data, signature.data + signature.len));
+
+    HcfVerify *verify = nullptr;
+    ASSERT_EQ(HcfVerifyCreate("SM2_256|SM3", &verify), HCF_SUCCESS);
+    ASSERT_EQ(verify->init(verify, nullptr, keyPair->pubKey), HCF_SUCCESS);
+    HcfBlob derBlob = { .data = der.data(), .len = der.size() };
+    EXPECT_TRUE(verify->verify(verify, &msgBlob, &derBlob));
+
+    rawBlob.len = HCF_SM2_RAW_SIGNATURE_LEN - 1;
+    HcfBlob output = { .data = nullptr, .len = 0 };
+    EXPECT_EQ(HcfSm2SignatureRawToDer(&rawBlob, &output), HCF_INVALID_PARAMS);
+    derBlob.len--;
+    EXPECT_EQ(HcfSm2SignatureDerToRaw(&derBlob, &output), HCF_INVALID_PARAMS);
+
+    HcfObjDestroy(verify);
+    HcfBlobDataFree(&signature);
+    HcfObjDestroy(sign);
+    HcfObjDestroy(keyPair);
+}
+
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest008, TestSize.Level0)
+{
+    vector<vector<uint8_t>> raws;
+    vector<HcfBlob> inputs;
+    for (uint32_t i = 0; i < BATCH_COUNT; i++) {
+        raws.emplace_back(SM2_RAW_C1_LEN + HCF_SM2_C3_DATA_LEN + 10 * (i + 1), (uint8_t)(0x30 + i));
+        raws[i][0] = 0x04;
+    }
+    for (auto &raw : raws) {
+        inputs.push_back({ .data = raw.data(), .len = raw.size() });
+    }
+    vector<HcfBlob> ders(BATCH_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(HcfSm2CipherTextRawToAsn1Batch(inputs.data(), BATCH_COUNT, nullptr, &arena, ders.data()), HCF_SUCCESS);
+    vector<uint8_t> derArena(arena.len);
+    arena.data = derArena.data();
+    ASSERT_EQ(HcfSm2CipherTextRawToAsn1Batch(inputs.data(), BATCH_COUNT, nullptr, &arena, ders.data()), HCF_SUCCESS);
+    EXPECT_EQ(arena.len, derArena.size());
+    EXPECT_EQ(ders[0].data, derArena.data());
+    EXPECT_EQ(ders[BATCH_COUNT - 1].data + ders[BATCH_COUNT - 1].len, derArena.data() + derArena.size());
+
+    vector<HcfBlob> backs(BATCH_COUNT);
+    HcfBlob rawArena = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(HcfSm2CipherTextAsn1ToRawBatch(ders.data(), BATCH_COUNT, "C1C3C2", &rawArena, backs.data()),
+        HCF_SUCCESS);
+    vector<uint8_t> rawBuf(rawArena.len);
+    rawArena.data = rawBuf.data();
+    ASSERT_EQ(HcfSm2CipherTextAsn1ToRawBatch(ders.data(), BATCH_COUNT, "C1C3C2", &rawArena, backs.data()),
+        HCF_SUCCESS);
+    for (uint32_t i = 0; i < BATCH_COUNT; i++) {
+        EXPECT_EQ(vector<uint8_t>(backs[i].data, backs[i].data + backs[i].len), raws[i]);
+    }
+
+    // A short arena or one bad item fails the whole batch.
+    rawArena.len = rawBuf.size() - 1;
+    EXPECT_EQ(HcfSm2CipherTextAsn1ToRawBatch(ders.data(), BATCH_COUNT, "C1C3C2", &rawArena, backs.data()),
+        HCF_INVALID_PARAMS);
+    EXPECT_EQ(backs[0].data, nullptr);
+    raws[2][0] = 0x02;
+    arena.len = derArena.size();
+    EXPECT_EQ(HcfSm2CipherTextRawToAsn1Batch(inputs.data(), BATCH_COUNT, nullptr, &arena, ders.data()),
+        HCF_INVALID_PARAMS);
+    EXPECT_EQ(HcfSm2CipherTextRawToAsn1Batch(inputs.data(), 0, nullptr, &arena, ders.data()), HCF_INVALID_PARAMS);
+}
+
+HWTEST_F(CryptoSm2Asn1CodecTest, CryptoSm2Asn1CodecTest009, TestSize.Level0)
+{
+    vector<vector<uint8_t>> raws;
+    vector<HcfBlob> inputs;
+    for (uint32_t i = 0; i < BATCH_COUNT; i++) {
+        raws.emplace_back(HCF_SM2_RAW_SIGNATURE_LEN, (uint8_t)(0x7e + i));
+    }
+    for (auto &raw : raws) {
+        inputs.push_back({ .data = raw.data(), .len = raw.size() });
+    }
+    vector<HcfBlob> ders(BATCH_COUNT);
+    HcfBlob arena = { .data = nullptr, .len = 0 };
+    ASSERT_EQ(HcfSm2SignatureRawToDerBatch(inputs.data(), BATCH_COUNT, &arena, ders.data()), HCF_SUCCESS);
+    vector<uint8_t> derArena(arena.len);
+    arena.data = derArena.data();
+    ASSERT_EQ(HcfSm2SignatureRawToDerBatch(inputs.data(), BATCH_COUNT, &arena, ders.data()), HCF_SUCCESS);
+    // Values with the top bit set need the sign byte.
+    EXPECT_EQ(ders[0].len, 70);
+    EXPECT_EQ(ders[BATCH_COUNT - 1].len, 72);
+
+    vector<HcfBlob> backs(BATCH_COUNT);
+    vector<uint8_t> rawBuf(HCF_SM2_RAW_SIGNATURE_LEN * BATCH_COUNT);
+    HcfBlob rawArena = { .data = rawBuf.data(), .len = rawBuf.size() };
+    ASSERT_EQ(HcfSm2SignatureDerToRawBatch(ders.data(), BATCH_COUNT, &rawArena, backs.data()), HCF_SUCCESS);
+    for (uint32_t i = 0; i < BATCH_COUNT; i++) {
+        EXPECT_EQ(vector<uint8_t>(backs[i].data, backs[i].data + backs[i].len), raws[i]);
+    }
+}
+}